@@ -8,6 +8,7 @@
 #include <mpi.h>
 #include <petsc.h>
 #include <Eigen/Dense>
+#include <Utilities/FieldId.h>
 
 class Mesh;
 class Model;
@@ -15,6 +16,7 @@ class Source;
 class Options;
 class Receiver;
 class ExodusModel;
+class ElementBatch;
 
 #include <Source/Source.h>
 #include <Receiver/Receiver.h>
@@ -46,6 +48,24 @@ class Element {
                                           const std::vector<std::string> &physics_base,
                                           const std::vector<std::string> &physics_couple,
                                           std::unique_ptr<Options> const &options);
+  /** Returns the concrete element type with the given type code (see TypeCode), built from a table of
+   * constructors rather than by comparing strings.
+   */
+  static std::unique_ptr<Element> Factory(const PetscInt type, std::unique_ptr<Options> const &options);
+  /** Compact code of the concrete element type of a shape and physics, in [0, NumTypeCodes()).
+   * @param [in] attenuation Whether the physics attenuate (--attenuation).
+   * @returns The code, or -1 if no element is built for them.
+   */
+  static PetscInt TypeCode(const std::string &shape,
+                           const std::vector<std::string> &physics_base,
+                           const std::vector<std::string> &physics_couple,
+                           const bool attenuation);
+  /** Number of type codes. */
+  static PetscInt NumTypeCodes();
+  /** Returns an empty batch which can hold elements of this element's concrete type. */
+  virtual std::unique_ptr<ElementBatch> MakeBatch() const = 0;
+  /** Make room for a number of elements of this concrete type, next to each other (see Pool). */
+  virtual void reserveSiblings(const size_t num) const = 0;
   ///@}
 
   /** @name Element setup.
@@ -69,6 +89,8 @@ class Element {
    * @param [in] sources Vector of all sources in the model.
    */
   virtual bool attachSource(std::unique_ptr<Source> &source, const bool finalize) = 0;
+  /** Remove all sources and receivers from the element (i.e. between shots). */
+  virtual void detachSourcesAndReceivers() = 0;
   /** Attach vertex coordinates to the element.
    * @param [in] distributed_mesh The parallel DM provided by PETSc.
    */
@@ -79,6 +101,10 @@ class Element {
       and tetrahedra.
    */
   virtual void precomputeElementTerms() = 0;
+  /** Returns an estimate of the largest stable time step on this element. Requires vertex
+   * coordinates and material properties to be attached.
+   */
+  virtual double CFL_estimate() = 0;
   ///@}
 
   
@@ -88,24 +114,40 @@ class Element {
    * function.
    */
   ///@{
+  /* The source, stiffness and surface terms are views into the thread's scratch arena, valid until the same
+   * term is computed again on the same thread (see Scratch), so that the time loop does not allocate. */
   /** Returns the interpolated source for a given time.
    * @ param [in] time Simulation time.
    * @ param [in] time_idx Simulation time index.
    */
-  virtual Eigen::MatrixXd computeSourceTerm(const double time, const PetscInt time_idx) = 0;
+  virtual Eigen::Map<Eigen::MatrixXd> computeSourceTerm(const double time, const PetscInt time_idx) = 0;
   /** Returns the action of the stiffness matrix applied to some field (probably displacement).
    * @param [in] u Displacement field.
    */
-  virtual Eigen::MatrixXd computeStiffnessTerm(const Eigen::Ref<const Eigen::MatrixXd>& u) = 0;
+  virtual Eigen::Map<Eigen::MatrixXd> computeStiffnessTerm(const Eigen::Ref<const Eigen::MatrixXd>& u) = 0;
   /** Computes the surface integral over an element. Note that this is usually zero. */
-  virtual Eigen::MatrixXd computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd>& u) = 0;
+  virtual Eigen::Map<Eigen::MatrixXd> computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd>& u) = 0;
+  /** Names of the parameters of the sensitivity kernels returned by computeKernels (i.e. VP, or VP and VS). */
+  virtual std::vector<std::string> KernelNames() const = 0;
+  /** Returns the derivative of the stiffness energy density of a forward and an adjoint field (u+ . K u, per
+   * unit volume) with respect to the log of each parameter of KernelNames, at the integration points (one column
+   * per parameter). Sensitivity kernels integrate these over time (see Simulation::runAdjoint).
+   * @param [in] u Forward field (the pulled fields).
+   * @param [in] u_adj Adjoint field (the pulled fields).
+   */
+  virtual Eigen::MatrixXd computeKernels(const Eigen::Ref<const Eigen::MatrixXd>& u,
+                                         const Eigen::Ref<const Eigen::MatrixXd>& u_adj) = 0;
   /** Returns the fields which are required from the global DOFs for local operation */
-  virtual std::vector<std::string> PullElementalFields() const = 0;
+  virtual const std::vector<FieldId> &PullElementalFields() const = 0;
   /** Returns the fields from the global DOFs into which we will sum */
-  virtual std::vector<std::string> PushElementalFields() const = 0;
+  virtual const std::vector<FieldId> &PushElementalFields() const = 0;
   /* TODO: Check if the following function is in the right place. */
   /** Returns the (real-space) lagrange polynomials evaluated at some point. */
   virtual Eigen::MatrixXd interpolateFieldAtPoint(const Eigen::Ref<const Eigen::VectorXd>& pnt) = 0;
+  /** Whether some point (in physical coordinates) lies within the element, as tested for a receiver. */
+  virtual bool containsPoint(const Eigen::Ref<const Eigen::VectorXd>& pnt) = 0;
+  /** Returns the physical coordinates of the integration points (one row per point). */
+  virtual Eigen::MatrixXd NodalCoordinates() = 0;
   ///@}
 
   /** @name Time loop (functions with side effects).
@@ -133,6 +175,8 @@ class Element {
   ///@{
   /** Set the element number of the local partition. */
   virtual inline void SetNum(const int num) = 0;
+  /** Set the time step of the time loop (used by elements with memory, see Attenuating). */
+  virtual inline void SetTimeStep(const PetscReal dt) = 0;
   /** Is this element on a mesh boundary. */
   virtual inline bool BndElm() const = 0;
   /** What is this elements number on the local partition. */
@@ -149,14 +193,25 @@ class Element {
   virtual inline int NumDofVtx() const = 0;
   /** How many integration point on this element. */
   virtual inline int NumIntPnt() const = 0;
-  /** What is the closure map on this element. */
-  virtual inline Eigen::VectorXi ClsMap() const = 0;
+  /** What is the closure map on this element (held by the element, or shared by all elements of its type). */
+  virtual inline const Eigen::Matrix<PetscInt, Eigen::Dynamic, 1> &ClsMap() const = 0;
   /** What is the order of the element */
   virtual inline int PlyOrd() const = 0;
-  /** Vertex coordinates of this element. */
-  virtual inline Eigen::MatrixXd VtxCrd() const = 0;
+  /** Vertex coordinates of this element, as a view of those held by the element (one row per vertex). */
+  virtual inline Eigen::Map<const Eigen::MatrixXd> VtxCrd() const = 0;
   /** What type of element am I? */
   virtual inline std::string Name() const = 0;
+  /** Names of the material parameters attached to this element. */
+  virtual std::vector<std::string> MaterialParameterNames() const = 0;
+  /** A material parameter at the integration points. */
+  virtual Eigen::VectorXd MaterialParameterAtIntPts(const std::string &par) = 0;
+  /** Bytes held by this element (including the element itself), of which OperatorBytes are taken by dense
+   * per-element operators (i.e. simplex stiffness matrices). */
+  virtual size_t MemoryBytes() const = 0;
+  virtual size_t OperatorBytes() const = 0;
+  /** Variant of the stiffness kernel of this element among those of its concrete type (i.e. the symmetry class of
+   * an elastic element). Elements are batched by type and variant, so that each batch runs a single kernel. */
+  virtual PetscInt StiffnessVariant() const = 0;
   ///@}
 
 };
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <Element/Element.h>
+#include <Element/ElementBatch.h>
 #include <Utilities/Options.h>
+#include <Utilities/Pool.h>
 
 template <typename T>
 class ElementAdapter: public Element, public T {
@@ -42,6 +44,26 @@ class ElementAdapter: public Element, public T {
    * These methods are mainly responsible for memory management, i.e. the creation and desctruction
    * of individual elements.
    */
+  ///@{
+  /** Returns an empty batch for elements of type T. */
+  virtual std::unique_ptr<ElementBatch> MakeBatch() const {
+    return std::unique_ptr<ElementBatch> (new ElementBatchOf<T>());
+  }
+  virtual void reserveSiblings(const size_t num) const { ElementPool().reserve(num); }
+
+  /** Elements of a type are carved out of a pool of their own, instead of one heap allocation each. The pool
+   * outlives every element (it is never destroyed, but releases its slabs once the last element is freed). */
+  static Pool &ElementPool() {
+    static Pool *pool = new Pool(sizeof(ElementAdapter<T>));
+    return *pool;
+  }
+  static void *operator new(size_t size) {
+    return size == sizeof(ElementAdapter<T>) ? ElementPool().allocate() : ::operator new(size);
+  }
+  static void operator delete(void *ptr, size_t size) {
+    if (size == sizeof(ElementAdapter<T>)) { ElementPool().deallocate(ptr); } else { ::operator delete(ptr); }
+  }
+  ///@}
 
   /** @name Element setup.
    * These methods are responsible for setting up each individual element for use within a time loop.
@@ -72,6 +94,10 @@ class ElementAdapter: public Element, public T {
   virtual bool attachSource(std::unique_ptr<Source> &source, const bool finalize) {
     return T::attachSource(source, finalize);
   }
+  /** Remove all sources and receivers from the element (i.e. between shots). */
+  virtual void detachSourcesAndReceivers() {
+    T::detachSourcesAndReceivers();
+  }
   /** Attach vertex coordinates to the element.
    * @param [in] distributed_mesh The parallel DM provided by PETSc.
    */
@@ -86,6 +112,12 @@ class ElementAdapter: public Element, public T {
   virtual void precomputeElementTerms() {
     T::precomputeElementTerms();
   }
+  /** Returns an estimate of the largest stable time step on this element. Requires vertex
+   * coordinates and material properties to be attached.
+   */
+  virtual double CFL_estimate() {
+    return T::CFL_estimate();
+  }
   ///@}
 
   /** @name Time loop (pure functions).
@@ -97,25 +129,32 @@ class ElementAdapter: public Element, public T {
    * @ param [in] time Simulation time.
    * @ param [in] time_idx Simulation time index.
    */
-  virtual Eigen::MatrixXd computeSourceTerm(const double time, const PetscInt time_idx) {
+  virtual Eigen::Map<Eigen::MatrixXd> computeSourceTerm(const double time, const PetscInt time_idx) {
     return T::computeSourceTerm(time, time_idx);
   }
   /** Returns the action of the stiffness matrix applied to some field (probably displacement).
    * @param [in] u Displacement field.
    */
-  virtual Eigen::MatrixXd computeStiffnessTerm(const Eigen::Ref<const Eigen::MatrixXd>& u) {
+  virtual Eigen::Map<Eigen::MatrixXd> computeStiffnessTerm(const Eigen::Ref<const Eigen::MatrixXd>& u) {
     return T::computeStiffnessTerm(u);
   }
   /** Computes the surface integral over an element. Note that this is usually zero. */
-  virtual Eigen::MatrixXd computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd>& u) {
+  virtual Eigen::Map<Eigen::MatrixXd> computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd>& u) {
     return T::computeSurfaceIntegral(u);
   };
+  /** Names of the parameters of the sensitivity kernels. */
+  virtual std::vector<std::string> KernelNames() const { return T::KernelNames(); }
+  /** Returns the derivatives of the stiffness energy density at the integration points (see Element). */
+  virtual Eigen::MatrixXd computeKernels(const Eigen::Ref<const Eigen::MatrixXd>& u,
+                                         const Eigen::Ref<const Eigen::MatrixXd>& u_adj) {
+    return T::computeKernels(u, u_adj);
+  }
   /** Returns the fields which are required from the global DOFs for local operation */
-  virtual std::vector<std::string> PullElementalFields() const {
+  virtual const std::vector<FieldId> &PullElementalFields() const {
     return T::PullElementalFields();
   }
   /** Returns the fields from the global DOFs into which we will sum */
-  virtual std::vector<std::string> PushElementalFields() const {
+  virtual const std::vector<FieldId> &PushElementalFields() const {
     return T::PushElementalFields();
   }
   /* TODO: Check if the following function is in the right place. */
@@ -123,6 +162,14 @@ class ElementAdapter: public Element, public T {
   virtual Eigen::MatrixXd interpolateFieldAtPoint(const Eigen::Ref<const Eigen::VectorXd>& pnt) {
     return T::interpolateFieldAtPoint(pnt);
   }
+  /** Whether some point (in physical coordinates) lies within the element. */
+  virtual bool containsPoint(const Eigen::Ref<const Eigen::VectorXd>& pnt) {
+    return T::containsPoint(pnt);
+  }
+  /** Returns the physical coordinates of the integration points (one row per point). */
+  virtual Eigen::MatrixXd NodalCoordinates() {
+    return stackColumns(T::buildNodalPoints());
+  }
   ///@}
 
   /** @name Time loop (functions with side effects).
@@ -153,6 +200,8 @@ class ElementAdapter: public Element, public T {
   ///@{
   /** Set the element number of the local partition. */
   inline void SetNum(const int num) { T::SetNumNew(num); }
+  /** Set the time step of the time loop (used by elements with memory, see Attenuating). */
+  inline void SetTimeStep(const PetscReal dt) { T::SetTimeStep(dt); }
   /** Is this element on a mesh boundary. */
   inline bool BndElm() const { return T::BndElm(); }
   /** What is this elements number on the local partition. */
@@ -170,12 +219,38 @@ class ElementAdapter: public Element, public T {
   /** How many integration point on this element. */
   inline int NumIntPnt() const { return T::NumIntPnt(); }
   /** Element vertices. */
-  inline Eigen::MatrixXd VtxCrd() const { return T::VtxCrd(); }
+  inline Eigen::Map<const Eigen::MatrixXd> VtxCrd() const {
+    return Eigen::Map<const Eigen::MatrixXd>(T::VtxCrd().data(), T::VtxCrd().rows(), T::VtxCrd().cols());
+  }
   /** What is the closure map on this element. */
-  virtual inline Eigen::VectorXi ClsMap() const { return T::ClsMap(); }
+  virtual inline const Eigen::Matrix<PetscInt, Eigen::Dynamic, 1> &ClsMap() const { return T::ClsMap(); }
   /** Vertex coordinates of this element. */
   virtual inline int PlyOrd() const { return T::PlyOrd(); }
   /** What type of element am I? */
   inline std::string Name() const  { return T::Name(); }
+  /** Names of the material parameters attached to this element. */
+  std::vector<std::string> MaterialParameterNames() const { return T::ParNames(); }
+  /** A material parameter at the integration points. */
+  Eigen::VectorXd MaterialParameterAtIntPts(const std::string &par) { return T::ParAtIntPts(par); }
+  /** Bytes held by this element, and by its dense operators. */
+  size_t MemoryBytes() const { return sizeof(*this) + T::MemoryBytes(); }
+  size_t OperatorBytes() const { return T::OperatorBytes(); }
+  /** Variant of the stiffness kernel. */
+  PetscInt StiffnessVariant() const { return T::StiffnessVariant(); }
   ///@}
+
+ private:
+
+  /** Nodal points of the shape (one vector per dimension), as the columns of a matrix. */
+  static Eigen::MatrixXd stackColumns(const std::tuple<Eigen::VectorXd, Eigen::VectorXd> &x) {
+    Eigen::MatrixXd crd(std::get<0>(x).size(), 2);
+    crd << std::get<0>(x), std::get<1>(x);
+    return crd;
+  }
+  static Eigen::MatrixXd stackColumns(const std::tuple<Eigen::VectorXd, Eigen::VectorXd, Eigen::VectorXd> &x) {
+    Eigen::MatrixXd crd(std::get<0>(x).size(), 3);
+    crd << std::get<0>(x), std::get<1>(x), std::get<2>(x);
+    return crd;
+  }
+
 };
@@ -0,0 +1,774 @@
+#pragma once
+
+// stl.
+#include <array>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+// 3rd party.
+#include <petsc.h>
+#include <Eigen/Dense>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// salvus.
+#include <Utilities/FieldId.h>
+#include <Utilities/LocalIndex.h>
+#include <Utilities/Profiler.h>
+#include <Utilities/Scratch.h>
+#include <Utilities/WorkStealing.h>
+
+// Number of elements whose stiffness terms are computed together, one per SIMD lane, for the
+// types which have lane kernels (see StiffnessLanes). 8 fills an AVX-512 register; compile with
+// -DELEMENT_SIMD_LANES=4 for AVX2.
+#ifndef ELEMENT_SIMD_LANES
+#define ELEMENT_SIMD_LANES 8
+#endif
+
+// forward decl.
+class Element;
+class HexP1;
+class TriP1;
+template <typename T> class ElementAdapter;
+template <typename Shape> class Scalar;
+template <typename ConcreteHex> class Hexahedra;
+template <typename Shape> class ScalarTri;
+template <typename ConcreteShape> class Triangle;
+
+/**
+ * Number of elements of type T whose stiffness terms are computed at once, through
+ * T::computeStiffnessTermLanes. Types without lane kernels use 1, i.e. one element at a time.
+ * Only exact types are listed, so wrappers which modify the stiffness term (e.g. the coupling mixins)
+ * keep the element-by-element path.
+ */
+template <typename T> struct StiffnessLanes { const static int value = 1; };
+template <> struct StiffnessLanes<Scalar<Hexahedra<HexP1>>> { const static int value = ELEMENT_SIMD_LANES; };
+template <> struct StiffnessLanes<ScalarTri<Scalar<Triangle<TriP1>>>> { const static int value = ELEMENT_SIMD_LANES; };
+
+/**
+ * Compute the terms of an element for one shot of the fields with the material of that member of an ensemble
+ * (T::selectMember, see Scalar), and return whether its receivers record the shot. Types without members only
+ * record the first shot.
+ */
+template <typename T>
+inline auto SelectMember(T *elm, const PetscInt shot, int) -> decltype(elm->selectMember(shot)) {
+  return elm->selectMember(shot);
+}
+template <typename T>
+inline bool SelectMember(T *, const PetscInt shot, long) { return !shot; }
+
+class ElementBatch {
+  /** \class ElementBatch
+    *
+    * \brief A group of elements which all share the same concrete (mixin) type.
+    *
+    * Elements are still owned by the ElemVec, but within the time loop they are visited batch by batch.
+    * Since the concrete type of each batch is known at compile time, the element kernels are called
+    * directly (and may be inlined) rather than through the virtual interface in Element. The gather/scatter
+    * indices of all elements in a batch are stored contiguously, and the pull/push field descriptors and
+    * element workspace are shared by the whole batch. For types with lane kernels, the geometry and material
+    * the stiffness term reads are also held by the batch, as structure-of-arrays blocks (see packLanes).
+    *
+    * Which batch an element joins is decided by Element::Factory, through the ElementAdapter type it returns
+    * (see ElementAdapter::MakeBatch).
+    *
+    * Within a batch, elements are further split into halo and interior regions. Halo elements touch at least
+    * one dof owned by another partition, and must be assembled through the local vectors. Interior elements
+    * only touch dofs owned by this partition, so they gather from and sum into the global vectors directly.
+    * This lets interior work proceed while the halo contributions are being communicated.
+    *
+    * When running with more than one thread per rank, each region is greedily colored so that no two elements
+    * of the same color share a dof. Colors are processed one after the other, and the elements within a color
+    * are processed in parallel, so contributions can be summed without races.
+    *
+    * For local time stepping, each element and dof may also be given a time step level. Assembling a single
+    * level then only visits the elements which touch a dof of that level, and only gathers the values of
+    * those dofs (i.e. the field is masked by the level). Source terms are only summed on level 0.
+    *
+    * Which elements hold sources is recorded when they are added, so the source term is only computed on
+    * those elements. Likewise, the elements holding receivers record the gathered field at each of them
+    * (without local time stepping, and for the first shot only), so receivers are sampled once per step
+    * at no extra gather.
+    *
+    * For types with lane kernels (see StiffnessLanes), the stiffness term is computed for several elements of
+    * one color at once, with the element index in the SIMD lane. The elements are gathered into lane-interleaved
+    * buffers, so that the kernels vectorize regardless of the polynomial order.
+    *
+    * With an activity mask (see setActivityMask), the elements whose gathered fields are still at rest are
+    * skipped, as the forces of a linear element at rest are zero. An element is looked at until it is first
+    * found in motion, and assembled from then on, so that its memory variables stay consistent. Elements may also
+    * be given a time before which they are not looked at, for a conservative estimate of the first arrival.
+    *
+    * With several simultaneous shots, each element is assembled once per shot while its data is
+    * still in cache, and all shots share one pass over the gather/scatter indices.
+    *
+    * By default the elements of a color are split statically between the threads. As their cost varies (with
+    * sources, receivers and resting elements), a color may instead be run as chunks of a fixed number of
+    * elements through a work-stealing schedule (see setWorkStealing and WorkStealing), most expensive first by
+    * the time each chunk took in the last assembly. The halo region is still assembled first in any case, so
+    * that its contributions are sent before the interior starts.
+    *
+    * While timing the elements (see timeElements), the seconds of each element are summed up, one clock read
+    * before and after it (a group of lanes is shared by its elements).
+    */
+
+ public:
+
+  /// Regions of the partition.
+  enum Region { Halo = 0, Interior = 1 };
+
+  /// Passed to assemble in place of a level to assemble all elements, without masking. Unrecorded does the same
+  /// without recording the receivers, for the extra stages of a step (see Order4Newmark).
+  const static PetscInt AllLevels = -1;
+  const static PetscInt Unrecorded = -2;
+
+ protected:
+
+  /// Contiguous vector indices (Salvus ordering) for all elements in each region. Halo indices
+  /// refer to the local vectors, interior indices to the local part of the global vectors. With
+  /// interleaved components, these are block indices (see assemble). 32-bit, as they are read by every gather
+  /// and scatter (see LocalInt).
+  std::array<std::vector<LocalInt>, 2> mIdx;
+  std::array<std::vector<PetscInt>, 2> mOff;
+
+  /// Element ranges of each color within a region.
+  std::array<std::vector<PetscInt>, 2> mColorOff;
+
+  /// Time step level of each entry in mIdx (empty without local time stepping).
+  std::array<std::vector<LocalInt>, 2> mDofLvl;
+
+  /// Per element: range of levels in which the element takes part, and whether it holds sources
+  /// or receivers.
+  std::array<std::vector<PetscInt>, 2> mLvlMin, mLvlMax;
+  std::array<std::vector<bool>, 2> mHasSrc, mHasRec;
+
+  /// Number of threads used in assemble.
+  PetscInt mNumThreads;
+
+  /// Elements per chunk of the work-stealing schedule (0 for the static one), and the schedule of each color of
+  /// a region (empty if static).
+  PetscInt mChunkSize;
+  std::array<std::vector<WorkStealing>, 2> mSchedules;
+
+  /// Whether assemble times each element, and the seconds summed up for each element of a region.
+  bool mTimeElements;
+  std::array<std::vector<double>, 2> mElmSeconds;
+
+  /**
+   * Plan the work-stealing schedules of the colors of a region (after coloring), with chunks of a multiple of
+   * some number of elements. Until timed, an element costs one, and two if it holds sources or receivers.
+   */
+  void planSchedules(const Region region, const PetscInt multiple);
+
+  /// Number of shots, interleaved as the components of each field (see finalize).
+  PetscInt mNumShots;
+
+  /// Activity mask (see setActivityMask): the largest field value of an element at rest (negative without a
+  /// mask), whether each element has been found in motion, and the time before which it is skipped (empty
+  /// without a schedule).
+  PetscReal mQuietMax;
+  std::array<std::vector<char>, 2> mAwake;
+  std::array<std::vector<PetscReal>, 2> mWakeTime;
+
+  /**
+   * Store the level information of a newly added element (see append).
+   * @param [in] region The element's region.
+   * @param [in] lvl Level of the element dofs (or NULL).
+   * @param [in] num_dof Number of entries in lvl.
+   * @param [in] elm_lvl Level of the element.
+   * @param [in] has_src Whether the element holds any sources.
+   */
+  void appendLevels(const Region region, const PetscInt *lvl, const PetscInt num_dof,
+                    const PetscInt elm_lvl, const bool has_src);
+
+  /**
+   * Whether an element takes part in the assembly of a given level.
+   * @param [in] region The element's region.
+   * @param [in] e The element's index in the region.
+   * @param [in] level The level being assembled (or AllLevels, Unrecorded).
+   */
+  inline bool active(const Region region, const PetscInt e, const PetscInt level) const {
+    return level < 0 || (mLvlMin[region][e] <= level && level <= mLvlMax[region][e]) ||
+        (level == 0 && mHasSrc[region][e]);
+  }
+
+  /**
+   * Whether an element may still be at rest, i.e. is looked at by the activity mask before it is assembled.
+   * @param [in] region The element's region.
+   * @param [in] e The element's index in the region.
+   */
+  inline bool watched(const Region region, const PetscInt e) const {
+    return mQuietMax >= 0 && !mAwake[region][e];
+  }
+
+  /**
+   * Whether a watched element is skipped without a look, as the first arrival has not reached it.
+   * @param [in] region The element's region.
+   * @param [in] e The element's index in the region.
+   * @param [in] time Simulation time.
+   */
+  inline bool asleep(const Region region, const PetscInt e, const PetscReal time) const {
+    return !mWakeTime[region].empty() && time < mWakeTime[region][e];
+  }
+
+  /**
+   * Greedily color the elements of a region such that elements of one color share no dofs, and
+   * reorder the region's index tables so that each color is contiguous.
+   * @param [in] region The region to color.
+   * @returns The permutation applied, i.e. new element e was old element perm[e].
+   */
+  std::vector<PetscInt> colorRegion(const Region region);
+
+ public:
+
+  ElementBatch(): mNumThreads(1), mChunkSize(0), mTimeElements(false), mNumShots(1), mQuietMax(-1) {
+    mOff[Halo].assign(1, 0); mOff[Interior].assign(1, 0);
+    mColorOff[Halo].assign(1, 0); mColorOff[Interior].assign(1, 0);
+  };
+  virtual ~ElementBatch() {};
+
+  /**
+   * Prepare the batch for the time loop, once all elements have been added.
+   * @param [in] num_threads Number of threads to use in assemble.
+   * @param [in] num_shots Number of shots propagated at once. Shot s is component s of the
+   * (scalar) fields, so the stride passed to assemble must equal num_shots, and the source term
+   * of an element holds one column per shot.
+   */
+  virtual void finalize(const PetscInt num_threads, const PetscInt num_shots) = 0;
+
+  /**
+   * Run the colors through a work-stealing schedule in assemble, instead of the static split. Set before
+   * finalize, which plans the schedules if there is more than one thread.
+   * @param [in] chunk_size Elements per chunk (rounded up to the lanes of the lane kernels), or 0 for static.
+   */
+  void setWorkStealing(const PetscInt chunk_size) { mChunkSize = chunk_size; }
+
+  /** Time each element in the following calls to assemble, or stop (after finalize). */
+  void timeElements(const bool time) { mTimeElements = time; }
+
+  /** Forget the seconds timed so far. */
+  void clearElementSeconds() {
+    for (auto &seconds: mElmSeconds) { std::fill(seconds.begin(), seconds.end(), 0); }
+  }
+
+  /**
+   * Add the seconds timed for each element of the batch to a table of all elements.
+   * @param [in/out] seconds Seconds of each element, by number (large enough for all elements of the batch).
+   */
+  virtual void addElementSeconds(std::vector<double> &seconds) const = 0;
+
+  /**
+   * Add an element to this batch. The element must be of the batch's concrete type.
+   * @param [in] elm The element.
+   * @param [in] region Whether the element is a halo or interior element.
+   * @param [in] idx Vector indices of the element dofs, in Salvus ordering (see Region).
+   * @param [in] num_dof Number of entries in idx.
+   * @param [in] lvl Time step level of each element dof, or NULL without local time stepping.
+   * @param [in] elm_lvl Time step level of the element.
+   */
+  virtual void append(Element *elm, const Region region, const PetscInt *idx,
+                      const PetscInt num_dof, const PetscInt *lvl = NULL,
+                      const PetscInt elm_lvl = 0) = 0;
+
+  /**
+   * Record again which elements hold sources and receivers, after they were detached and attached
+   * (i.e. between shots).
+   */
+  virtual void updateSourcesAndReceivers() = 0;
+
+  /**
+   * Copy again what the batch holds of the material of its elements (see packLanes), after their material
+   * and precomputed terms changed (i.e. see Problem::updateModel).
+   */
+  virtual void updateMaterial() = 0;
+
+  /**
+   * Skip the elements at rest in assemble (after finalize). The elements holding sources, and those given as
+   * awake, are always assembled. Elements holding receivers are not given a wake time, so that they record.
+   * @param [in] threshold Largest magnitude of a gathered field value of an element at rest (0 is exact).
+   * @param [in] wake_time Time before which each element (by number) is skipped without a look, or empty.
+   * @param [in] awake Whether each element (by number) is always assembled, or empty.
+   */
+  virtual void setActivityMask(const PetscReal threshold, const std::vector<PetscReal> &wake_time,
+                               const std::vector<bool> &awake) = 0;
+
+  /** Returns the fields pulled from the global DOFs by every element in this batch. */
+  virtual const std::vector<FieldId> &PullElementalFields() const = 0;
+
+  /** Returns the fields pushed to the global DOFs by every element in this batch. */
+  virtual const std::vector<FieldId> &PushElementalFields() const = 0;
+
+  /**
+   * Compute element forces for every element of a region in the batch, and sum them into the
+   * vectors of that region.
+   * @param [in] region The region to assemble.
+   * @param [in] level The time step level to assemble, or AllLevels (Unrecorded).
+   * @param [in/out] arrays Raw arrays of all fields, indexed by FieldId. These are the local
+   * arrays for the halo, and the global arrays for the interior. The value of a field at
+   * index i is arrays[field][stride * i].
+   * @param [in] stride Number of interleaved components per dof.
+   * @param [in] time Simulation time.
+   * @param [in] time_idx Simulation time index.
+   */
+  virtual void assemble(const Region region, const PetscInt level,
+                        std::array<PetscScalar*, NumFieldIds> const &arrays,
+                        const PetscInt stride, const PetscReal time, const PetscInt time_idx) = 0;
+
+  /**
+   * Record the receivers of a region from all dofs of their elements. With time step levels, assemble only
+   * gathers the dofs of the level, so the time stepper records once per (coarse) step through this instead,
+   * when all levels are at the same time.
+   * @param [in] region The region to record.
+   * @param [in] arrays Raw arrays of all fields, as in assemble.
+   * @param [in] stride Number of interleaved components per dof.
+   */
+  virtual void recordReceivers(const Region region, std::array<PetscScalar*, NumFieldIds> const &arrays,
+                               const PetscInt stride) = 0;
+
+  /** Number of elements in a region of the batch. */
+  inline PetscInt size(const Region region) const { return mOff[region].size() - 1; }
+
+};
+
+template <typename T>
+class ElementBatchOf: public ElementBatch {
+
+  /// Concrete (non-virtual) views into batched elements.
+  std::array<std::vector<T*>, 2> mElm;
+
+  /// Batch workspace (one per thread).
+  std::vector<Eigen::MatrixXd> mU, mA;
+
+  /// Lane-interleaved workspace (one per thread), i.e. row i holds GLL point i of all lanes.
+  typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> LaneMat;
+  std::vector<LaneMat> mUL, mSL;
+  std::vector<std::vector<PetscReal>> mLaneWork;
+
+  /// Lane-interleaved geometry and material of each group of L elements, in the order in which assembleColor
+  /// forms the groups (see packLanes). The material is held once per member of an ensemble. Empty without lane
+  /// kernels, or if the stiffness term does not read them.
+  std::array<std::vector<PetscReal>, 2> mLaneGeo, mLaneCoef;
+  /// First group of each color of a region.
+  std::array<std::vector<PetscInt>, 2> mColorGroup;
+  /// Values per group of geometry (0 if none is held) and of material, and materials per group.
+  PetscInt mLaneGeoSize, mLaneCoefSize, mNumLaneCoef;
+
+  /// Whether this type has lane kernels.
+  typedef std::integral_constant<bool, (StiffnessLanes<T>::value > 1)> HasLanes;
+
+  /**
+   * Gather the pulled fields of one element and shot into u (only the dofs of this level, if masked).
+   */
+  inline void gather(const Region region, const PetscInt e, const PetscInt level, const bool masked,
+                     std::array<PetscScalar*, NumFieldIds> const &arrays, const PetscInt stride,
+                     const PetscInt shot, Eigen::Ref<Eigen::MatrixXd> u) {
+    const std::vector<FieldId> &pull = PullElementalFields();
+    const PetscInt num_dof = u.rows();
+    const LocalInt *idx = mIdx[region].data() + mOff[region][e];
+    for (PetscInt i = 0; i < pull.size(); i++) {
+      const PetscScalar *val = arrays[static_cast<int>(pull[i])];
+      if (masked) {
+        const LocalInt *lvl = mDofLvl[region].data() + mOff[region][e];
+        for (PetscInt j = 0; j < num_dof; j++) { u(j, i) = lvl[j] == level ? val[stride * idx[j] + shot] : 0; }
+      } else {
+        for (PetscInt j = 0; j < num_dof; j++) { u(j, i) = val[stride * idx[j] + shot]; }
+      }
+    }
+  }
+
+  /**
+   * Sum the pushed fields of one element and shot from a.
+   */
+  inline void scatter(const Region region, const PetscInt e, std::array<PetscScalar*, NumFieldIds> const &arrays,
+                      const PetscInt stride, const PetscInt shot, const Eigen::Ref<const Eigen::MatrixXd> &a) {
+    const std::vector<FieldId> &push = PushElementalFields();
+    const PetscInt num_dof = a.rows();
+    const LocalInt *idx = mIdx[region].data() + mOff[region][e];
+    for (PetscInt i = 0; i < push.size(); i++) {
+      PetscScalar *val = arrays[static_cast<int>(push[i])];
+      for (PetscInt j = 0; j < num_dof; j++) { val[stride * idx[j] + shot] += a(j, i); }
+    }
+  }
+
+  /**
+   * Assemble one element (on thread t).
+   */
+  void assembleElement(const Region region, const PetscInt e, const PetscInt t, const PetscInt level,
+                       const bool masked, const bool record, std::array<PetscScalar*, NumFieldIds> const &arrays,
+                       const PetscInt stride, const PetscReal time, const PetscInt time_idx) {
+
+    if (!active(region, e, level)) return;
+    const bool watch = watched(region, e);
+    if (watch && asleep(region, e, time)) return;
+
+    Eigen::MatrixXd &u = mU[t], &a = mA[t];
+    T *elm = mElm[region][e];
+    const auto start = mTimeElements ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
+    for (PetscInt s = 0; s < mNumShots; s++) {
+
+      /* Gather (only the dofs of this level, if assembling a single level). */
+      {
+        Profiler::Scope scope(Profiler::Gather);
+        gather(region, e, level, masked, arrays, stride, s, u);
+        if (SelectMember(elm, s, 0) && record && mHasRec[region][e]) { elm->recordField(u); }
+      }
+
+      /* Nothing to sum while the element is at rest (in this shot). */
+      if (watch && !mAwake[region][e]) {
+        if (u.cwiseAbs().maxCoeff() <= mQuietMax) continue;
+        mAwake[region][e] = 1;
+      }
+
+      /* Acceleration = forcing - stiffness + surface terms. */
+      if (level > 0 || !mHasSrc[region][e]) { a.setZero(); }
+      else {
+        Profiler::Scope scope(Profiler::SourceTerm);
+        a = elm->computeSourceTerm(time, time_idx).middleCols(s * a.cols(), a.cols());
+      }
+      {
+        Profiler::Scope scope(Profiler::StiffnessTerm);
+        a -= elm->computeStiffnessTerm(u);
+      }
+      {
+        Profiler::Scope scope(Profiler::SurfaceTerm);
+        a += elm->computeSurfaceIntegral(u);
+      }
+
+      /* Scatter (sum). */
+      {
+        Profiler::Scope scope(Profiler::Scatter);
+        scatter(region, e, arrays, stride, s, a);
+      }
+
+    }
+    if (mTimeElements) {
+      mElmSeconds[region][e] += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+  }
+
+  /**
+   * Assemble the elements of one color, one element at a time.
+   */
+  void assembleColor(std::false_type, const Region region, const PetscInt c, const PetscInt level,
+                     std::array<PetscScalar*, NumFieldIds> const &arrays,
+                     const PetscInt stride, const PetscReal time, const PetscInt time_idx) {
+
+    const bool masked = level >= 0 && !mDofLvl[region].empty();
+    const bool record = !masked && (level == 0 || level == AllLevels);
+
+    /* Elements of one color share no dofs, so they can be summed concurrently. */
+    if (!mSchedules[region].empty()) {
+      mSchedules[region][c].run([&](const PetscInt beg, const PetscInt end, const PetscInt t) {
+        for (PetscInt e = beg; e < end; e++) {
+          assembleElement(region, e, t, level, masked, record, arrays, stride, time, time_idx);
+        }
+      });
+      return;
+    }
+    #pragma omp parallel for num_threads(mNumThreads) schedule(static)
+    for (PetscInt e = mColorOff[region][c]; e < mColorOff[region][c + 1]; e++) {
+#ifdef _OPENMP
+      const PetscInt t = omp_get_thread_num();
+#else
+      const PetscInt t = 0;
+#endif
+      assembleElement(region, e, t, level, masked, record, arrays, stride, time, time_idx);
+    }
+
+  }
+
+  /**
+   * Assemble the elements [e0, e0 + L) of a color ending at end (on thread t), with the stiffness term of L
+   * elements computed at once. Types with lane kernels pull and push a single field.
+   */
+  void assembleLanes(const Region region, const PetscInt e0, const PetscInt end, const PetscInt g, const PetscInt t,
+                     const PetscInt level, const bool masked, const bool record,
+                     std::array<PetscScalar*, NumFieldIds> const &arrays,
+                     const PetscInt stride, const PetscReal time, const PetscInt time_idx) {
+
+    const int L = StiffnessLanes<T>::value;
+
+    Eigen::MatrixXd &u = mU[t], &a = mA[t];
+    LaneMat &ul = mUL[t], &sl = mSL[t];
+
+    /* Missing (inactive, or resting) elements repeat the last element with a zero field, and are not scattered. */
+    T *elm[L];
+    bool on[L], live[L];
+    for (PetscInt l = 0; l < L; l++) {
+      const PetscInt e = std::min(e0 + l, end - 1);
+      elm[l] = mElm[region][e];
+      on[l] = e0 + l < end && active(region, e, level) && !(watched(region, e) && asleep(region, e, time));
+    }
+    const auto start = mTimeElements ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
+    for (PetscInt s = 0; s < mNumShots; s++) {
+
+      /* Gather into the lanes. */
+      bool any = false;
+      {
+        Profiler::Scope scope(Profiler::Gather);
+        for (PetscInt l = 0; l < L; l++) {
+          live[l] = false;
+          if (!on[l]) { ul.col(l).setZero(); continue; }
+          const PetscInt e = e0 + l;
+          gather(region, e, level, masked, arrays, stride, s, u);
+          if (SelectMember(elm[l], s, 0) && record && mHasRec[region][e]) { elm[l]->recordField(u); }
+          if (watched(region, e)) {
+            if (u.cwiseAbs().maxCoeff() <= mQuietMax) { ul.col(l).setZero(); continue; }
+            mAwake[region][e] = 1;
+          }
+          ul.col(l) = u.col(0);
+          live[l] = any = true;
+        }
+      }
+      if (!any) continue;
+
+      /* Stiffness term of all lanes, with the geometry and material of the group (and member). */
+      {
+        Profiler::Scope scope(Profiler::StiffnessTerm);
+        const PetscReal *geo = NULL, *coef = NULL;
+        if (mLaneGeoSize) {
+          geo = mLaneGeo[region].data() + g * mLaneGeoSize;
+          coef = mLaneCoef[region].data() + (g * mNumLaneCoef + std::min(s, mNumLaneCoef - 1)) * mLaneCoefSize;
+        }
+        T::template computeStiffnessTermLanes<L>(elm, geo, coef, ul.data(), sl.data(), mLaneWork[t]);
+      }
+
+      /* Acceleration = forcing - stiffness + surface terms, and scatter (sum). */
+      for (PetscInt l = 0; l < L; l++) {
+        if (!live[l]) continue;
+        const PetscInt e = e0 + l;
+        u.col(0) = ul.col(l);
+        if (level > 0 || !mHasSrc[region][e]) { a.setZero(); }
+        else {
+          Profiler::Scope scope(Profiler::SourceTerm);
+          a = elm[l]->computeSourceTerm(time, time_idx).middleCols(s * a.cols(), a.cols());
+        }
+        a.col(0) -= sl.col(l);
+        {
+          Profiler::Scope scope(Profiler::SurfaceTerm);
+          a += elm[l]->computeSurfaceIntegral(u);
+        }
+        {
+          Profiler::Scope scope(Profiler::Scatter);
+          scatter(region, e, arrays, stride, s, a);
+        }
+      }
+
+    }
+
+    /* The lanes share the time of the group. */
+    if (mTimeElements) {
+      const PetscInt num_on = std::count(on, on + L, true);
+      const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      for (PetscInt l = 0; l < L; l++) { if (on[l]) { mElmSeconds[region][e0 + l] += seconds / num_on; } }
+    }
+
+  }
+
+  /**
+   * Assemble the elements of one color, L at a time (see assembleLanes).
+   */
+  void assembleColor(std::true_type, const Region region, const PetscInt c, const PetscInt level,
+                     std::array<PetscScalar*, NumFieldIds> const &arrays,
+                     const PetscInt stride, const PetscReal time, const PetscInt time_idx) {
+
+    const int L = StiffnessLanes<T>::value;
+    const bool masked = level >= 0 && !mDofLvl[region].empty();
+    const bool record = !masked && (level == 0 || level == AllLevels);
+    const PetscInt beg = mColorOff[region][c], end = mColorOff[region][c + 1], grp = mColorGroup[region][c];
+
+    /* Chunks hold a multiple of L elements, so only the last one of the color is padded. */
+    if (!mSchedules[region].empty()) {
+      mSchedules[region][c].run([&](const PetscInt chunk_beg, const PetscInt chunk_end, const PetscInt t) {
+        for (PetscInt e0 = chunk_beg; e0 < chunk_end; e0 += L) {
+          assembleLanes(region, e0, end, grp + (e0 - beg) / L, t, level, masked, record, arrays, stride, time,
+                        time_idx);
+        }
+      });
+      return;
+    }
+    #pragma omp parallel for num_threads(mNumThreads) schedule(static)
+    for (PetscInt e0 = beg; e0 < end; e0 += L) {
+#ifdef _OPENMP
+      const PetscInt t = omp_get_thread_num();
+#else
+      const PetscInt t = 0;
+#endif
+      assembleLanes(region, e0, end, grp + (e0 - beg) / L, t, level, masked, record, arrays, stride, time,
+                    time_idx);
+    }
+
+  }
+
+  /**
+   * Pack the geometry and material which the lane kernels read into mLaneGeo and mLaneCoef, once the regions
+   * are colored: group by group, with the padding of the last group of a color repeating its last element
+   * (as in assembleLanes). The kernels then read each group contiguously, instead of collecting it from the
+   * elements on every step.
+   */
+  void packLanes(std::false_type) {}
+  void packLanes(std::true_type) {
+
+    const int L = StiffnessLanes<T>::value;
+    for (auto region: {Halo, Interior}) {
+      mColorGroup[region].assign(1, 0);
+      for (PetscInt c = 0; c + 1 < mColorOff[region].size(); c++) {
+        const PetscInt num_elm = mColorOff[region][c + 1] - mColorOff[region][c];
+        mColorGroup[region].push_back(mColorGroup[region].back() + (num_elm + L - 1) / L);
+      }
+      mLaneGeo[region].clear(); mLaneCoef[region].clear();
+    }
+
+    /* The members of an ensemble each have their own material, as the shots of the fields (see SelectMember). */
+    const std::vector<T*> &any = mElm[Halo].empty() ? mElm[Interior] : mElm[Halo];
+    mLaneGeoSize = any.empty() ? 0 : T::template LaneGeometrySize<L>(any.front());
+    if (!mLaneGeoSize) return;
+    mLaneCoefSize = L * any.front()->NumIntPnt();
+    mNumLaneCoef = mNumShots > 1 && SelectMember(any.front(), 1, 0) ? mNumShots : 1;
+    SelectMember(any.front(), 0, 0);
+
+    for (auto region: {Halo, Interior}) {
+      mLaneGeo[region].resize(mColorGroup[region].back() * mLaneGeoSize);
+      mLaneCoef[region].resize(mColorGroup[region].back() * mNumLaneCoef * mLaneCoefSize);
+      for (PetscInt c = 0; c + 1 < mColorOff[region].size(); c++) {
+        const PetscInt beg = mColorOff[region][c], end = mColorOff[region][c + 1];
+        for (PetscInt e0 = beg, g = mColorGroup[region][c]; e0 < end; e0 += L, g++) {
+          T *elm[L];
+          for (PetscInt l = 0; l < L; l++) { elm[l] = mElm[region][std::min(e0 + l, end - 1)]; }
+          T::template packLaneGeometry<L>(elm, mLaneGeo[region].data() + g * mLaneGeoSize);
+          for (PetscInt m = 0; m < mNumLaneCoef; m++) {
+            for (PetscInt l = 0; l < L; l++) { SelectMember(elm[l], m, 0); }
+            T::template packLaneMaterial<L>(elm, mLaneCoef[region].data() + (g * mNumLaneCoef + m) * mLaneCoefSize);
+          }
+          for (PetscInt l = 0; l < L; l++) { SelectMember(elm[l], 0, 0); }
+        }
+      }
+    }
+
+  }
+
+ public:
+
+  void append(Element *elm, const Region region, const PetscInt *idx, const PetscInt num_dof,
+              const PetscInt *lvl = NULL, const PetscInt elm_lvl = 0) {
+    mElm[region].push_back(static_cast<T*> (static_cast<ElementAdapter<T>*> (elm)));
+    for (PetscInt j = 0; j < num_dof; j++) { CheckLocalIndex(idx[j], "local dofs"); }
+    mIdx[region].insert(mIdx[region].end(), idx, idx + num_dof);
+    mOff[region].push_back(mOff[region].back() + num_dof);
+    appendLevels(region, lvl, num_dof, elm_lvl, !mElm[region].back()->Sources().empty());
+  }
+
+  void updateSourcesAndReceivers() {
+    for (auto region: {Halo, Interior}) {
+      mHasRec[region].resize(size(region));
+      for (PetscInt e = 0; e < size(region); e++) {
+        mHasSrc[region][e] = !mElm[region][e]->Sources().empty();
+        mHasRec[region][e] = !mElm[region][e]->Receivers().empty();
+        /* Elements woken in an earlier shot stay awake, which only assembles more than needed. */
+        if (mQuietMax >= 0 && mHasSrc[region][e]) { mAwake[region][e] = 1; }
+      }
+    }
+  }
+
+  void updateMaterial() { packLanes(HasLanes()); }
+
+  void setActivityMask(const PetscReal threshold, const std::vector<PetscReal> &wake_time,
+                       const std::vector<bool> &awake) {
+    mQuietMax = threshold;
+    for (auto region: {Halo, Interior}) {
+      mAwake[region].assign(size(region), 0);
+      mWakeTime[region].assign(wake_time.empty() ? 0 : size(region), -std::numeric_limits<PetscReal>::infinity());
+      for (PetscInt e = 0; e < size(region); e++) {
+        const PetscInt num = mElm[region][e]->ElmNum();
+        mAwake[region][e] = mHasSrc[region][e] || (num < awake.size() && awake[num]);
+        if (!wake_time.empty() && !mHasRec[region][e]) { mWakeTime[region][e] = wake_time[num]; }
+      }
+    }
+  }
+
+  void finalize(const PetscInt num_threads, const PetscInt num_shots) {
+    mNumThreads = num_threads; mNumShots = num_shots;
+    mU.resize(num_threads); mA.resize(num_threads);
+    mUL.resize(num_threads); mSL.resize(num_threads); mLaneWork.resize(num_threads);
+    Scratch::Reserve(num_threads);
+    for (auto region: {Halo, Interior}) {
+      if (num_threads > 1) {
+        std::vector<PetscInt> perm = colorRegion(region);
+        std::vector<T*> elm(mElm[region]);
+        for (PetscInt e = 0; e < perm.size(); e++) { mElm[region][e] = elm[perm[e]]; }
+      } else {
+        mColorOff[region] = {0, size(region)};
+      }
+    }
+    updateSourcesAndReceivers();
+    packLanes(HasLanes());
+    for (auto region: {Halo, Interior}) {
+      mElmSeconds[region].assign(size(region), 0);
+      mSchedules[region].clear();
+      if (mChunkSize > 0 && num_threads > 1) { planSchedules(region, StiffnessLanes<T>::value); }
+    }
+  }
+
+  void addElementSeconds(std::vector<double> &seconds) const {
+    for (auto region: {Halo, Interior}) {
+      for (PetscInt e = 0; e < size(region); e++) { seconds[mElm[region][e]->ElmNum()] += mElmSeconds[region][e]; }
+    }
+  }
+
+  /* Field descriptors are static for a given type, so any element will do. */
+  const std::vector<FieldId> &PullElementalFields() const {
+    return (mElm[Halo].empty() ? mElm[Interior] : mElm[Halo]).front()->PullElementalFields();
+  }
+  const std::vector<FieldId> &PushElementalFields() const {
+    return (mElm[Halo].empty() ? mElm[Interior] : mElm[Halo]).front()->PushElementalFields();
+  }
+
+  void recordReceivers(const Region region, std::array<PetscScalar*, NumFieldIds> const &arrays,
+                       const PetscInt stride) {
+
+    /* Only a few elements hold receivers, so they are gathered one by one on this thread. Without level masks,
+     * assemble has recorded them already. */
+    if (mElm[region].empty() || mDofLvl[region].empty()) return;
+    Eigen::MatrixXd &u = mU[0];
+    u.resize(mElm[region].front()->NumIntPnt(), PullElementalFields().size());
+    for (PetscInt e = 0; e < size(region); e++) {
+      if (!mHasRec[region][e]) continue;
+      for (PetscInt s = 0; s < mNumShots; s++) {
+        if (!SelectMember(mElm[region][e], s, 0)) continue;
+        gather(region, e, AllLevels, false, arrays, stride, s, u);
+        mElm[region][e]->recordField(u);
+      }
+    }
+
+  }
+
+  void assemble(const Region region, const PetscInt level,
+                std::array<PetscScalar*, NumFieldIds> const &arrays,
+                const PetscInt stride, const PetscReal time, const PetscInt time_idx) {
+
+    if (mElm[region].empty()) return;
+
+    const PetscInt num_dof = mElm[region].front()->NumIntPnt();
+    for (PetscInt t = 0; t < mNumThreads; t++) {
+      mU[t].resize(num_dof, PullElementalFields().size());
+      mA[t].resize(num_dof, PushElementalFields().size());
+      if (HasLanes::value) {
+        mUL[t].resize(num_dof, StiffnessLanes<T>::value);
+        mSL[t].resize(num_dof, StiffnessLanes<T>::value);
+      }
+    }
+
+    for (PetscInt c = 0; c < mColorOff[region].size() - 1; c++) {
+      assembleColor(HasLanes(), region, c, level, arrays, stride, time, time_idx);
+    }
+
+  }
+
+};
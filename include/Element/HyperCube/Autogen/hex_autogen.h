@@ -1,20 +0,0 @@
-#pragma once
-
-#include "order1_hex.h"
-#include "order2_hex.h"
-#include "order3_hex.h"
-#include "order4_hex.h"
-#include "order5_hex.h"
-#include "order6_hex.h"
-#include "order7_hex.h"
-#include "order8_hex.h"
-#include "order9_hex.h"
-
-
-
-
-
-
-
-
-
@@ -1,21 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-
-
-#ifndef PROJECT__ORDER10_SQUARE__H
-#define PROJECT__ORDER10_SQUARE__H
-
-void interpolate_order10_square(double epsilon, double eta, double *out_5381166748421946072);
-void interpolate_eps_derivative_order10_square(double epsilon, double eta, double *out_4446160830948235721);
-void interpolate_eta_derivative_order10_square(double epsilon, double eta, double *out_8054559429757235991);
-void closure_mapping_order10_square(int *out_8667584514404452486);
-void gll_weights_order10_square(double *out_5200892885835025512);
-void gll_coordinates_order10_square(double *out_956659557296293289);
-
-#endif
-
@@ -1,19 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-
-
-#ifndef PROJECT__ORDER1_HEX__H
-#define PROJECT__ORDER1_HEX__H
-
-void interpolate_order1_hex(double r, double s, double t, double *out_1550826091074812107);
-void interpolate_r_derivative_order1_hex(double s, double t, double *out_5498613790433297615);
-void interpolate_s_derivative_order1_hex(double r, double t, double *out_7425548709962864327);
-void interpolate_t_derivative_order1_hex(double r, double s, double *out_4165328884638393555);
-
-#endif
-
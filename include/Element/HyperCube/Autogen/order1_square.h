@@ -1,21 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-
-
-#ifndef PROJECT__ORDER1_SQUARE__H
-#define PROJECT__ORDER1_SQUARE__H
-
-void interpolate_order1_square(double epsilon, double eta, double *out_8090246698051949025);
-void interpolate_eps_derivative_order1_square(double eta, double *out_9073736670949263119);
-void interpolate_eta_derivative_order1_square(double epsilon, double *out_8473474700611321857);
-void closure_mapping_order1_square(int *out_2820443818077165713);
-void gll_weights_order1_square(double *out_3122137466506344549);
-void gll_coordinates_order1_square(double *out_3093496787365923720);
-
-#endif
-
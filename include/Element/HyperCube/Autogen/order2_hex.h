@@ -1,19 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-
-
-#ifndef PROJECT__ORDER2_HEX__H
-#define PROJECT__ORDER2_HEX__H
-
-void interpolate_order2_hex(double r, double s, double t, double *out_9002847687499221097);
-void interpolate_r_derivative_order2_hex(double r, double s, double t, double *out_8487963633987287817);
-void interpolate_s_derivative_order2_hex(double r, double s, double t, double *out_157595897019188835);
-void interpolate_t_derivative_order2_hex(double r, double s, double t, double *out_4912761615785967653);
-
-#endif
-
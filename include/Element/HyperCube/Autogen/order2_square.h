@@ -1,21 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-
-
-#ifndef PROJECT__ORDER2_SQUARE__H
-#define PROJECT__ORDER2_SQUARE__H
-
-void interpolate_order2_square(double epsilon, double eta, double *out_5124881133433324070);
-void interpolate_eps_derivative_order2_square(double epsilon, double eta, double *out_4655011469098782191);
-void interpolate_eta_derivative_order2_square(double epsilon, double eta, double *out_9086922723928993073);
-void closure_mapping_order2_square(int *out_5427770538133181134);
-void gll_weights_order2_square(double *out_1923134116974207604);
-void gll_coordinates_order2_square(double *out_2127667241337835057);
-
-#endif
-
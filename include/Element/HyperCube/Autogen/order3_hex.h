@@ -1,19 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-
-
-#ifndef PROJECT__ORDER3_HEX__H
-#define PROJECT__ORDER3_HEX__H
-
-void interpolate_order3_hex(double r, double s, double t, double *out_8216235190021024939);
-void interpolate_r_derivative_order3_hex(double r, double s, double t, double *out_5216069425318171019);
-void interpolate_s_derivative_order3_hex(double r, double s, double t, double *out_1643667870387349053);
-void interpolate_t_derivative_order3_hex(double r, double s, double t, double *out_1614254179988961949);
-
-#endif
-
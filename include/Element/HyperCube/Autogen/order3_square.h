@@ -1,21 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-
-
-#ifndef PROJECT__ORDER3_SQUARE__H
-#define PROJECT__ORDER3_SQUARE__H
-
-void interpolate_order3_square(double epsilon, double eta, double *out_5520632088669242493);
-void interpolate_eps_derivative_order3_square(double epsilon, double eta, double *out_1735109083759235119);
-void interpolate_eta_derivative_order3_square(double epsilon, double eta, double *out_7408361074971146125);
-void closure_mapping_order3_square(int *out_1434872603480458915);
-void gll_weights_order3_square(double *out_8586666373437537841);
-void gll_coordinates_order3_square(double *out_6407435751412178427);
-
-#endif
-
@@ -1,19 +0,0 @@
-/******************************************************************************
- *                       Code generated with sympy 1.0                        *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'SALVUS'                        *
- ******************************************************************************/
-
-
-#ifndef SALVUS__ORDER4_HEX__H
-#define SALVUS__ORDER4_HEX__H
-
-void interpolate_order4_hex(double r, double s, double t, double *out_2810135618052889493);
-void interpolate_r_derivative_order4_hex(double r, double s, double t, double *out_4104854468703356725);
-void interpolate_s_derivative_order4_hex(double r, double s, double t, double *out_3277023006449021479);
-void interpolate_t_derivative_order4_hex(double r, double s, double t, double *out_6249295730873589447);
-
-#endif
-
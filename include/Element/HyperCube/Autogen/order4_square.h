@@ -1,21 +0,0 @@
-/******************************************************************************
- *                      Code generated with sympy 0.7.6                       *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-
-
-#ifndef PROJECT__ORDER4_SQUARE__H
-#define PROJECT__ORDER4_SQUARE__H
-
-void interpolate_order4_square(double epsilon, double eta, double *out_5590410397267881018);
-void interpolate_eps_derivative_order4_square(double epsilon, double eta, double *out_9048464668387216643);
-void interpolate_eta_derivative_order4_square(double epsilon, double eta, double *out_6330729362090964521);
-void closure_mapping_order4_square(int *out_2138521137306367256);
-void gll_weights_order4_square(double *out_9021652956210223773);
-void gll_coordinates_order4_square(double *out_3496294405507664450);
-
-#endif
-
@@ -1,19 +0,0 @@
-/******************************************************************************
- *                       Code generated with sympy 1.0                        *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'SALVUS'                        *
- ******************************************************************************/
-
-
-#ifndef SALVUS__ORDER5_HEX__H
-#define SALVUS__ORDER5_HEX__H
-
-void interpolate_order5_hex(double r, double s, double t, double *out_609235444478643363);
-void interpolate_r_derivative_order5_hex(double r, double s, double t, double *out_2285369601028763103);
-void interpolate_s_derivative_order5_hex(double r, double s, double t, double *out_5749855306018701417);
-void interpolate_t_derivative_order5_hex(double r, double s, double t, double *out_8795509799562067773);
-
-#endif
-
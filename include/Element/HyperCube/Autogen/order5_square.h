@@ -1,21 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-
-
-#ifndef PROJECT__ORDER5_SQUARE__H
-#define PROJECT__ORDER5_SQUARE__H
-
-void interpolate_order5_square(double epsilon, double eta, double *out_4953907929813173491);
-void interpolate_eps_derivative_order5_square(double epsilon, double eta, double *out_8747288793387336531);
-void interpolate_eta_derivative_order5_square(double epsilon, double eta, double *out_3919865154438395407);
-void closure_mapping_order5_square(int *out_3462185086303802983);
-void gll_weights_order5_square(double *out_6934682480549297959);
-void gll_coordinates_order5_square(double *out_3001728889501436902);
-
-#endif
-
@@ -1,19 +0,0 @@
-/******************************************************************************
- *                       Code generated with sympy 1.0                        *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'SALVUS'                        *
- ******************************************************************************/
-
-
-#ifndef SALVUS__ORDER6_HEX__H
-#define SALVUS__ORDER6_HEX__H
-
-void interpolate_order6_hex(double r, double s, double t, double *out_3389759113221083689);
-void interpolate_r_derivative_order6_hex(double r, double s, double t, double *out_6017409534121301929);
-void interpolate_s_derivative_order6_hex(double r, double s, double t, double *out_8485919454306922259);
-void interpolate_t_derivative_order6_hex(double r, double s, double t, double *out_477444465807639245);
-
-#endif
-
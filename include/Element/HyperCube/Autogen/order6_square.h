@@ -1,21 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-
-
-#ifndef PROJECT__ORDER6_SQUARE__H
-#define PROJECT__ORDER6_SQUARE__H
-
-void interpolate_order6_square(double epsilon, double eta, double *out_3210054076336248177);
-void interpolate_eps_derivative_order6_square(double epsilon, double eta, double *out_5582450715052588863);
-void interpolate_eta_derivative_order6_square(double epsilon, double eta, double *out_2514256276583579295);
-void closure_mapping_order6_square(int *out_4288441802878156186);
-void gll_weights_order6_square(double *out_4731757004545806116);
-void gll_coordinates_order6_square(double *out_5275473663835076437);
-
-#endif
-
@@ -1,19 +0,0 @@
-/******************************************************************************
- *                       Code generated with sympy 1.0                        *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'SALVUS'                        *
- ******************************************************************************/
-
-
-#ifndef SALVUS__ORDER7_HEX__H
-#define SALVUS__ORDER7_HEX__H
-
-void interpolate_order7_hex(double r, double s, double t, double *out_3782884994657724121);
-void interpolate_r_derivative_order7_hex(double r, double s, double t, double *out_5981811669020709407);
-void interpolate_s_derivative_order7_hex(double r, double s, double t, double *out_2713895338419874139);
-void interpolate_t_derivative_order7_hex(double r, double s, double t, double *out_4289686846694546707);
-
-#endif
-
@@ -1,21 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-
-
-#ifndef PROJECT__ORDER7_SQUARE__H
-#define PROJECT__ORDER7_SQUARE__H
-
-void interpolate_order7_square(double epsilon, double eta, double *out_917917640078739063);
-void interpolate_eps_derivative_order7_square(double epsilon, double eta, double *out_7517406232432299947);
-void interpolate_eta_derivative_order7_square(double epsilon, double eta, double *out_4617504037014595993);
-void closure_mapping_order7_square(int *out_2018592701291190525);
-void gll_weights_order7_square(double *out_6230800783185834179);
-void gll_coordinates_order7_square(double *out_8428424020652233511);
-
-#endif
-
@@ -1,19 +0,0 @@
-/******************************************************************************
- *                       Code generated with sympy 1.0                        *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'SALVUS'                        *
- ******************************************************************************/
-
-
-#ifndef SALVUS__ORDER8_HEX__H
-#define SALVUS__ORDER8_HEX__H
-
-void interpolate_order8_hex(double r, double s, double t, double *out_7065208563635585863);
-void interpolate_r_derivative_order8_hex(double r, double s, double t, double *out_5493242672880106857);
-void interpolate_s_derivative_order8_hex(double r, double s, double t, double *out_1824522923888470723);
-void interpolate_t_derivative_order8_hex(double r, double s, double t, double *out_7962097692774158797);
-
-#endif
-
@@ -1,21 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-
-
-#ifndef PROJECT__ORDER8_SQUARE__H
-#define PROJECT__ORDER8_SQUARE__H
-
-void interpolate_order8_square(double epsilon, double eta, double *out_5857460273485771890);
-void interpolate_eps_derivative_order8_square(double epsilon, double eta, double *out_3539342882259231955);
-void interpolate_eta_derivative_order8_square(double epsilon, double eta, double *out_1604135558802125817);
-void closure_mapping_order8_square(int *out_1888811593364008808);
-void gll_weights_order8_square(double *out_3995493972137613764);
-void gll_coordinates_order8_square(double *out_4420238649482325602);
-
-#endif
-
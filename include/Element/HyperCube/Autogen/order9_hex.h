@@ -1,19 +0,0 @@
-/******************************************************************************
- *                       Code generated with sympy 1.0                        *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'SALVUS'                        *
- ******************************************************************************/
-
-
-#ifndef SALVUS__ORDER9_HEX__H
-#define SALVUS__ORDER9_HEX__H
-
-void interpolate_order9_hex(double r, double s, double t, double *out_8750083800957618891);
-void interpolate_r_derivative_order9_hex(double r, double s, double t, double *out_5272472380221138789);
-void interpolate_s_derivative_order9_hex(double r, double s, double t, double *out_1888848074252937955);
-void interpolate_t_derivative_order9_hex(double r, double s, double t, double *out_3447644913814556789);
-
-#endif
-
@@ -1,21 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-
-
-#ifndef PROJECT__ORDER9_SQUARE__H
-#define PROJECT__ORDER9_SQUARE__H
-
-void interpolate_order9_square(double epsilon, double eta, double *out_5708876025817303321);
-void interpolate_eps_derivative_order9_square(double epsilon, double eta, double *out_7338201687422862883);
-void interpolate_eta_derivative_order9_square(double epsilon, double eta, double *out_7489494862605754493);
-void closure_mapping_order9_square(int *out_88682657526787489);
-void gll_weights_order9_square(double *out_3469424585499671537);
-void gll_coordinates_order9_square(double *out_7097320842538396498);
-
-#endif
-
@@ -1,19 +0,0 @@
-//
-// Created by Michael Afanasiev on 2016-02-12.
-//
-
-#ifndef SALVUS_QUAD_AUTOGEN_H
-#define SALVUS_QUAD_AUTOGEN_H
-
-#include "Element/HyperCube/Autogen/order1_square.h"
-#include "Element/HyperCube/Autogen/order2_square.h"
-#include "Element/HyperCube/Autogen/order3_square.h"
-#include "Element/HyperCube/Autogen/order4_square.h"
-#include "Element/HyperCube/Autogen/order5_square.h"
-#include "Element/HyperCube/Autogen/order6_square.h"
-#include "Element/HyperCube/Autogen/order7_square.h"
-#include "Element/HyperCube/Autogen/order8_square.h"
-#include "Element/HyperCube/Autogen/order9_square.h"
-#include "Element/HyperCube/Autogen/order10_square.h"
-
-#endif //SALVUS_QUAD_AUTOGEN_H
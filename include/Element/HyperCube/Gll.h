@@ -0,0 +1,78 @@
+#pragma once
+
+// 3rd party.
+#include <petsc.h>
+#include <Eigen/Dense>
+#include <Utilities/Types.h>
+
+/**
+ * Gauss-Lobatto-Legendre basis of the tensor product elements (TensorQuad, Hexahedra), for any order.
+ *
+ * The 1D GLL points are -1, 1 and the roots of the derivative of the Legendre polynomial P_order, found by
+ * Newton's method; the weights are 2 / (order (order + 1) P_order(x)^2). Everything else is built from the
+ * 1D Lagrange polynomials through these points: the derivative matrix used by the tensor kernels, and the
+ * interpolation at arbitrary points as a tensor product of 1D values, with r varying fastest (then s, then t),
+ * which is the dof order of the elements.
+ */
+class Gll {
+
+ public:
+
+  /**
+   * GLL points in [-1, 1], in ascending order.
+   * @param [in] order Polynomial order (>= 1).
+   */
+  static RealVec Points(const PetscInt order);
+
+  /**
+   * GLL integration weights, one per point.
+   * @param [in] order Polynomial order (>= 1).
+   */
+  static RealVec Weights(const PetscInt order);
+
+  /**
+   * Gauss-Lobatto-Jacobi points of the weight (1 + x), in [-1, 1], in ascending order: -1, 1, and the roots of
+   * the Jacobi polynomial P^(1,2)_(order - 1), as the eigenvalues of its Jacobi matrix. These are the points
+   * across the axis of the axisymmetric quads, where the radius vanishes (see TensorQuad).
+   * @param [in] order Polynomial order (>= 1).
+   */
+  static RealVec JacobiPoints(const PetscInt order);
+
+  /**
+   * Gauss-Lobatto-Jacobi integration weights, one per point, of the integral of (1 + x) f(x) over [-1, 1].
+   * Unlike the (1 + x) weighted GLL weights, the weight of -1 does not vanish.
+   * @param [in] order Polynomial order (>= 1).
+   */
+  static RealVec JacobiWeights(const PetscInt order);
+
+  /**
+   * Values of the Lagrange polynomials through some points.
+   * @param [in] pts Interpolation points.
+   * @param [in] x Where to evaluate.
+   * @returns l_j(x) for each point j.
+   */
+  static RealVec Lagrange(const Eigen::Ref<const RealVec> &pts, const PetscReal x);
+
+  /**
+   * Derivatives of the Lagrange polynomials through some points.
+   * @param [in] pts Interpolation points.
+   * @param [in] x Where to evaluate.
+   * @returns l_j'(x) for each point j.
+   */
+  static RealVec LagrangeDerivative(const Eigen::Ref<const RealVec> &pts, const PetscReal x);
+
+  /**
+   * Derivative matrix through some points, D(i, j) = l_j'(x_i).
+   * @param [in] pts Interpolation points.
+   */
+  static RealMat DerivativeMatrix(const Eigen::Ref<const RealVec> &pts);
+
+  /**
+   * Tensor product of 1D values, the first varying fastest: out(i + n_r j) = r(i) s(j), and
+   * out(i + n_r j + n_r n_s k) = r(i) s(j) t(k).
+   */
+  static RealVec TensorProduct(const Eigen::Ref<const RealVec> &r, const Eigen::Ref<const RealVec> &s);
+  static RealVec TensorProduct(const Eigen::Ref<const RealVec> &r, const Eigen::Ref<const RealVec> &s,
+                               const Eigen::Ref<const RealVec> &t);
+
+};
@@ -33,9 +33,27 @@ class HexP1 {
   static bool checkHull(
       const PetscReal x, const PetscReal y, const PetscReal z,
       const Eigen::Ref<const HexVtx> &vtx);
+  /**
+   * Cheap test before checkHull: is a point within the axis-aligned bounding box of the vertices.
+   */
+  static bool checkBoundingBox(
+      const PetscReal x, const PetscReal y, const PetscReal z,
+      const Eigen::Ref<const HexVtx> &vtx);
+  /**
+   * Coefficients of the trilinear map of the vertices, x(r,s,t) = c0 + c1 r + c2 s + c3 t + c4 rs + c5 rt
+   * + c6 st + c7 rst.
+   * @returns One row per monomial, one column per coordinate.
+   */
+  static Eigen::Matrix<PetscReal,8,3> trilinearCoefficients(const Eigen::Ref<const HexVtx> &vtx);
   static RealVec3 inverseCoordinateTransform(
       const PetscReal x, const PetscReal y, const PetscReal z,
       const Eigen::Ref<const HexVtx> &vtx);
+  /**
+   * Derivatives of the vertex shape functions at a point (the Jacobian is derivatives * vtx).
+   * @returns One row per reference direction, one column per vertex.
+   */
+  static Eigen::Matrix<PetscReal,3,8> shapeDerivativesAtPoint(
+      const PetscReal r, const PetscReal s, const PetscReal t);
   static void inverseJacobianAtPoint(
       const PetscReal r, const PetscReal s, const PetscReal t,
       const Eigen::Ref<const HexVtx> &vtx, PetscReal &detJac,
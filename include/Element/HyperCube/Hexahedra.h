@@ -2,20 +2,14 @@
 
 // stl.
 #include <map>
+#include <memory>
 #include <vector>
 
 // 3rd party.
 #include <petsc.h>
 #include <Eigen/Dense>
 #include <Utilities/Types.h>
-
-// Maximum order for Hexahedra. Order 8 and 9 have generated code, but
-// take quite a long time to compile, which is quite annoying for
-// day-to-day use and development. Compile with -DHEX_MAX_ORDER 9 to
-// set otherwise.
-#ifndef HEX_MAX_ORDER
-#define HEX_MAX_ORDER 7
-#endif
+#include <Utilities/Memory.h>
 
 
 // forward decl.
@@ -26,6 +20,48 @@ class Options;
 class Receiver;
 class ExodusModel;
 
+/**
+ * Reference element data of a hex, which is identical for all elements of one polynomial order.
+ * It is set up once per order (see Hexahedra::ReferenceForOrder), and shared by all elements,
+ * which then only hold their own geometry and material.
+ */
+struct HexReference {
+
+  // Closure mapping.
+  IntVec mClsMap;
+
+  // Quadrature parameters.
+  RealVec mIntCrdR;
+  RealVec mIntCrdS;
+  RealVec mIntCrdT;
+  RealVec mIntWgtR;
+  RealVec mIntWgtS;
+  RealVec mIntWgtT;
+
+  // Matrix holding gradient information.
+  RealMat mGrd;
+  RealMat mGrdT;
+  RealMat mGrdWgt;
+  RealMat mGrdWgtT;
+
+  // Vertex shape functions at the GLL points (one row per point), and their derivatives along r, s and t
+  // (rows 3 i to 3 i + 2 for point i), so that the nodal points are mVtxInt * vtx and the Jacobian of point
+  // i is rows 3 i to 3 i + 2 of mVtxDer * vtx.
+  RealMat mVtxInt;
+  RealMat mVtxDer;
+
+};
+
+/**
+ * Precomputed geometry of a hex: the determinant and inverse of the Jacobian at each GLL point, or one of each
+ * for a parallelepiped. With --share-geometry, elements of the same geometry (i.e. the translates in a structured
+ * or extruded region) hold the same record (see Hexahedra::SharedGeometry), instead of one each.
+ */
+struct HexGeometry {
+  RealVec mDetJac;
+  std::vector<RealMat3x3> mInvJac;
+};
+
 template <typename ConcreteHex>
 class Hexahedra: public ConcreteHex {
 
@@ -63,12 +99,74 @@ private:
   const static PetscInt mNumDim = 3;
   const static PetscInt mNumVtx = 8;
 
-  const static PetscInt mMaxOrder = HEX_MAX_ORDER; // defined above
+  const static PetscInt mMaxOrder = 10;
+
+  // Tensor kernels with the number of GLL points per dimension fixed at compile time (so that the
+  // 1D contractions unroll), selected for the polynomial order in the constructor (as small matrix
+  // products with --small-gemm).
+  typedef void (*RefGradKernel)(const PetscReal *grd, const PetscReal *field, PetscReal *grad);
+  typedef void (*GradTestKernel)(const PetscReal *grd, const PetscReal *wgt, const PetscReal *flux,
+                                 PetscReal *out);
+  RefGradKernel mRefGradKernel;
+  GradTestKernel mGradTestKernel;
+
+  /**
+   * Gradient of a field in the reference element.
+   * @param [in] grd Derivatives of the 1D Lagrange polynomials at the GLL points (N x N).
+   * @param [in] field Field at the GLL points.
+   * @param [out] grad Derivatives along (r, s, t), one column each (N^3 x 3).
+   */
+  template <int N>
+  static void referenceGradientKernel(const PetscReal *grd, const PetscReal *field, PetscReal *grad);
+
+  /**
+   * Integrate a flux (already rotated to the reference element, and scaled by detJ) against the
+   * gradient of the test functions.
+   * @param [in] grd Derivatives of the 1D Lagrange polynomials at the GLL points (N x N).
+   * @param [in] wgt 1D integration weights.
+   * @param [in] flux Flux along (r, s, t), one column each (N^3 x 3).
+   * @param [out] out Coefficients at all GLL points.
+   */
+  template <int N>
+  static void gradTestAndIntegrateKernel(const PetscReal *grd, const PetscReal *wgt, const PetscReal *flux,
+                                         PetscReal *out);
+
+  /**
+   * The kernels above as products of small matrices (see SmallGemm), viewing the field as N x N^2: G * F along
+   * r, F_t * G^T for each slice along s, and F * G^T (as N^2 x N) along t. The products of each shape are
+   * dispatched on the first call.
+   */
+  template <int N>
+  static void referenceGradientGemmKernel(const PetscReal *grd, const PetscReal *field, PetscReal *grad);
+  template <int N>
+  static void gradTestAndIntegrateGemmKernel(const PetscReal *grd, const PetscReal *wgt, const PetscReal *flux,
+                                             PetscReal *out);
+  /** Select the tensor kernels with N points per dimension. */
+  template <int N>
+  void selectKernels(const bool small_gemm);
+
+  /**
+   * Scalar stiffness term (see scalarStiffnessLanes) for L elements at once, with N points per dimension.
+   * The innermost loops run over the lanes, so they vectorize independently of N.
+   */
+  template <int N, int L>
+  static void scalarStiffnessLanesKernel(const PetscReal *grd, const PetscReal *wgt, const PetscReal *geo,
+                                         const PetscReal *coef, const PetscReal *u, PetscReal *out,
+                                         PetscReal *work);
 
-  // Workspace.  
-  RealVec mParWork;
-  RealVec mStiffWork;
-  RealMat mGradWork;
+  /**
+   * Elastic stiffness term (see elasticStiffness) with N points per dimension, for the Voigt coefficients of a
+   * mask (see ElasticSymmetryMask), or the Lame parameters if the mask is 0. The stress only sums the terms of
+   * the mask, which are known at compile time, and scales by a single value of each if Constant. Not static, as
+   * the geometry is read through jacobianAtIntPnt.
+   */
+  template <int N, int Mask, bool Constant>
+  void elasticStiffnessKernel(const PetscReal *const *coef, const PetscReal *u, const PetscInt ldu,
+                              PetscReal *out, PetscReal *work);
+  /** Elastic stiffness term with N points per dimension, through the kernel of a symmetry class. */
+  template <int N, bool Constant>
+  void elasticStiffnessOfSymmetry(const ElasticSymmetry symmetry, const PetscReal *const *coef, const PetscReal *u,
+                                  const PetscInt ldu, PetscReal *out, PetscReal *work);
 
   // On Boundary.
   bool mBndElm;
@@ -92,38 +190,88 @@ private:
   // Element center.
   Eigen::Vector3d mElmCtr;
 
-  // Closure mapping.
-  IntVec mClsMap;
+  // Exodus model element (-1 if not known, see Mesh::ModelElement).
+  PetscInt mModElm;
 
-  // Quadrature parameters.
-  RealVec mIntCrdR;
-  RealVec mIntCrdS;
-  RealVec mIntCrdT;
-  RealVec mIntWgtR;
-  RealVec mIntWgtS;
-  RealVec mIntWgtT;
+  // Reference element data, shared by all elements of one order.
+  std::shared_ptr<const HexReference> mRef;
 
-  // Matrix holding gradient information.
-  RealMat mGrd;
-  RealMat mGrdT;
-  RealMat mGrdWgt;
-  RealMat mGrdWgtT;
-  
-  // Material parameters.
+  // Material parameters, at the vertices or, if constant within the element, a single value.
   std::map<std::string,RealVec> mPar;
+  // Material parameters read at the integration points (see ExodusModel::CachedParameterAtIntPts), a single
+  // value alike if constant.
+  std::map<std::string,RealVec> mParIntPts;
 
   // Sources and receivers.
   std::vector<std::unique_ptr<Source>> mSrc;
   std::vector<std::unique_ptr<Receiver>> mRec;
+  // Lagrange interpolation weights of each receiver, at its reference location.
+  std::vector<RealVec> mRecWeights;
+
+  // Precomputed geometry (unless --low-memory-geometry), i.e. the determinant and inverse of the
+  // Jacobian at each GLL point. Affine elements (parallelepipeds) only store one, in either mode. The record
+  // is shared with the elements of the same geometry with --share-geometry.
+  bool mPrecomputeGeometry, mShareGeometry;
+  bool mAffine;
+  std::shared_ptr<const HexGeometry> mGeo;
+
+  // Face geometry, computed on the first integral over a face (so only boundary elements hold any),
+  // and dropped when the vertices change: the dofs of each face, their surface detJ times the weights,
+  // and the outward normal.
+  std::vector<std::vector<PetscInt>> mFaceDofs;
+  std::vector<RealVec> mFaceWgt;
+  std::vector<RealVec3> mFaceNrm;
+
+  /**
+   * Compute the geometry of a face (see mFaceDofs).
+   * @param [in] face Face number (0..5).
+   */
+  void precomputeFace(const PetscInt face);
+
+  /**
+   * Get the determinant and inverse of the Jacobian at a GLL point, either from the precomputed
+   * geometry or recomputed from the vertex coordinates.
+   * @param [in] r_ind Index of the GLL point in r.
+   * @param [in] s_ind Index of the GLL point in s.
+   * @param [in] t_ind Index of the GLL point in t.
+   * @param [out] detJac Determinant of the Jacobian.
+   * @param [out] invJac Inverse of the Jacobian.
+   */
+  inline void jacobianAtIntPnt(const PetscInt r_ind, const PetscInt s_ind, const PetscInt t_ind,
+                               PetscReal &detJac, RealMat3x3 &invJac) {
+    if (mAffine) {
+      detJac = mGeo->mDetJac(0); invJac = mGeo->mInvJac[0];
+    } else if (mPrecomputeGeometry) {
+      PetscInt index = r_ind + s_ind * mNumIntPtsR + t_ind * mNumIntPtsR * mNumIntPtsS;
+      detJac = mGeo->mDetJac(index); invJac = mGeo->mInvJac[index];
+    } else {
+      PetscInt index = r_ind + s_ind * mNumIntPtsR + t_ind * mNumIntPtsR * mNumIntPtsS;
+      const RealMat3x3 jac = mRef->mVtxDer.template middleRows<3>(3 * index) * mVtxCrd;
+      detJac = jac.determinant(); invJac = jac.inverse();
+    }
+  }
 
-  // precomputed values for stiffness routine
-  RealVec mDetJac;
-  std::vector<RealMat3x3> mInvJac;
-  
  public:
 
   Hexahedra<ConcreteHex>(std::unique_ptr<Options> const &options);
 
+  /**
+   * Returns the reference element for a given polynomial order, which is set up on first use, and
+   * then shared by all elements of that order.
+   * @param [in] order The polynomial order.
+   * @returns The shared reference element.
+   */
+  static std::shared_ptr<const HexReference> ReferenceForOrder(const PetscInt order);
+
+  /**
+   * Returns the record of the elements (still alive) with the same geometry as the given one, to a relative
+   * tolerance, or else the given one, which later elements then share. Elements are hashed by their geometry
+   * rounded to a fraction of its scale, so that those of the same geometry almost always fall into one bucket.
+   * @param [in] geo Geometry of an element.
+   * @returns The shared record.
+   */
+  static std::shared_ptr<const HexGeometry> SharedGeometry(const std::shared_ptr<const HexGeometry> &geo);
+
   /**
    * Returns the quadrature locations for a given polynomial order.
    * @param [in] order The polynmomial order.
@@ -147,7 +295,7 @@ private:
                                         DM &distributed_mesh);
 
   /**
-   * Setup the auto-generated gradient operator, and stores the result in mGrd.
+   * Setup the auto-generated gradient operator, and stores the result in HexReference::mGrd.
    * @param [in] order The polynomial order.
    */
   static RealMat setupGradientOperator(const PetscInt order);
@@ -163,8 +311,9 @@ private:
   /**
    * Compute the gradient of a field at all GLL points.
    * @param [in] field Field to take the gradient of.
+   * @returns A view into the thread's scratch arena (valid until the next call, see Scratch).
    */
-  RealMat computeGradient(const Eigen::Ref<const RealVec>& field);
+  Eigen::Map<RealMat> computeGradient(const Eigen::Ref<const RealVec>& field);
 
   /**
    * Interpolate a parameter from vertex to GLL point.
@@ -172,6 +321,25 @@ private:
    */
   RealVec ParAtIntPts(const std::string& par);
 
+  /** Names of the material parameters attached to the element. */
+  std::vector<std::string> ParNames() const {
+    std::vector<std::string> names;
+    for (auto &p: mPar) { names.push_back(p.first); }
+    for (auto &p: mParIntPts) { names.push_back(p.first); }
+    return names;
+  }
+
+  /** Heap bytes held by the element (the reference element is shared, and not counted). */
+  size_t MemoryBytes() const {
+    return Memory::bytes(mBnd) + Memory::bytes(mPar) + Memory::bytes(mParIntPts) + Memory::bytes(mRecWeights) +
+        GeometryBytes() + Memory::bytes(mFaceDofs) + Memory::bytes(mFaceWgt) +
+        Memory::bytes(mFaceNrm) + sizeof(mSrc[0]) * mSrc.capacity() + sizeof(mRec[0]) * mRec.capacity();
+  }
+  /** Bytes of dense per-element operators (none, the operators are sum factorized). */
+  size_t OperatorBytes() const { return 0; }
+  /** Variant of the stiffness kernel (see Element::StiffnessVariant), of which the shape has only one. */
+  PetscInt StiffnessVariant() const { return 0; }
+
 
   /**
    * Multiply a field by the test functions and integrate.
@@ -188,17 +356,76 @@ private:
   RealVec applyTestAndIntegrateEdge(const Eigen::Ref<const RealVec> &f,
                                     const PetscInt edg);
 
+  /**
+   * Given a face, return its normal.
+   * @param [in] face Face number.
+   * @returns The unit normal of the face plane, pointing outwards.
+   */
+  RealVec3 getFaceNormal(const PetscInt face);
+
   /**
    * Multiply a field by the gradient of the test functions and integrate.
    * @param [in] f Field to calculate on.
+   * @returns A view into the thread's scratch arena (valid until the next call, see Scratch).
    */
-  RealVec applyGradTestAndIntegrate(const Eigen::Ref<const Eigen::MatrixXd>& f);
+  Eigen::Map<RealVec> applyGradTestAndIntegrate(const Eigen::Ref<const Eigen::MatrixXd>& f);
 
   /**
-   * precompute constants needed for stiffness routine
+   * Store the determinant and inverse of the Jacobian at each GLL point, if the geometry is
+   * precomputed, or only once if the element is affine. Called whenever the vertex coordinates
+   * change.
    */
   void precomputeConstants();
 
+  /** Whether the element is a parallelepiped, i.e. has a constant Jacobian (set with the vertices). */
+  bool IsAffine() const { return mAffine; }
+  /** The precomputed geometry, which elements of the same geometry share with --share-geometry (NULL with
+   * --low-memory-geometry, unless affine). */
+  const HexGeometry *Geometry() const { return mGeo.get(); }
+  /** Bytes of the precomputed geometry, as this element's share of its record. */
+  size_t GeometryBytes() const {
+    return mGeo ? (Memory::bytes(mGeo->mDetJac) + Memory::bytes(mGeo->mInvJac)) / mGeo.use_count() : 0;
+  }
+
+  /**
+   * Copy the geometry of this element into one lane of a lane-interleaved buffer (see
+   * scalarStiffnessLanes).
+   * @param [in] lane The lane of this element.
+   * @param [in] num_lanes Number of lanes in the buffer.
+   * @param [out] geo Inverse Jacobian (column-major) and its determinant at each GLL point i, as
+   * geo[num_lanes * (10 * i + k) + lane] for k = 0..9.
+   */
+  void interleaveGeometry(const PetscInt lane, const PetscInt num_lanes, PetscReal *geo);
+
+  /**
+   * Stiffness term of a scalar (isotropic) operator, i.e. the integral of coef * grad(u) against the
+   * gradient of the test functions, on L elements of this order at once. All buffers are
+   * lane-interleaved, i.e. the value at GLL point i of the element in lane l sits at [L * i + l].
+   * @param [in] geo Geometry of all lanes (see interleaveGeometry).
+   * @param [in] coef Coefficient at each GLL point.
+   * @param [in] u Field at each GLL point.
+   * @param [out] out Stiffness term at each GLL point.
+   * @param [in] work Scratch space of 3 * L * NumIntPnt() values.
+   */
+  template <int L>
+  void scalarStiffnessLanes(const PetscReal *geo, const PetscReal *coef, const PetscReal *u, PetscReal *out,
+                            PetscReal *work);
+
+  /**
+   * Stiffness term of an elastic operator in a single sweep. The gradients of all three displacement
+   * components are taken in one pass over the tensor, the stress and the rotated flux are formed per
+   * GLL point (with the geometry read once), and all three components are integrated against the
+   * gradient of the test functions in one backward pass.
+   * @param [in] u Displacement at the GLL points, one column per component (nGll x 3).
+   * @param [in] coef Stiffness at the GLL points: the 21 Voigt coefficients (see VoigtIndex), of which only
+   * those of the symmetry class are read (the others may be NULL). If isotropic, only lambda and mu.
+   * @param [in] symmetry Symmetry class of the stiffness, which selects the kernel.
+   * @param [in] constant Whether coef holds a single value of each coefficient, for the whole element.
+   * @returns nGll x 3 stiffness term, as a view into the thread's scratch arena (see Scratch).
+   */
+  Eigen::Map<RealMat> elasticStiffness(const Eigen::Ref<const RealMat>& u, const PetscReal *const *coef,
+                                       const ElasticSymmetry symmetry, const bool constant = false);
+
 //  void setFaceToValue(const PetscInt face, const PetscReal val, Eigen::Ref<RealVec> f);
 //  void setEdgeToValue(const PetscInt edg, const PetscReal val, Eigen::Ref<RealVec> f);
 //  void setVertexToValue(const PetscInt vtx, const PetscReal val, Eigen::Ref<RealVec> f);
@@ -251,6 +478,9 @@ private:
    */
   bool attachReceiver(std::unique_ptr<Receiver> &receiver, const bool finalize);
 
+  /** Remove all sources and receivers from the element (i.e. between shots). */
+  void detachSourcesAndReceivers() { mSrc.clear(); mRec.clear(); mRecWeights.clear(); }
+
   /**
    * If an element is detected to be on a boundary, apply the Dirichlet condition to the
    * dofs on that boundary.
@@ -273,37 +503,65 @@ private:
   void attachMaterialProperties(std::unique_ptr<ExodusModel> const &model, std::string parameter);
 
   /**
-   * Given some field at the GLL points, interpolate the field to some general point.
-   * @param [in] pnt Position in reference coordinates.
+   * Courant number of the explicit Newmark scheme, relative to estimatedElementRadius.
+   * @return The CFL constant.
+   */
+  double CFL_constant();
+
+  /**
+   * Smallest distance between two neighbouring GLL points of the element (in physical space).
+   * @return The element radius, as used in the CFL estimate.
+   */
+  double estimatedElementRadius();
+
+  /**
+   * The weights which interpolate a field at the GLL points to some general point, as for a receiver.
+   * @param [in] pnt Position in physical coordinates, within the element.
+   * @returns The Lagrange polynomial of each GLL point, evaluated at pnt.
    */
-  RealMat interpolateFieldAtPoint(const RealVec &pnt) { return Eigen::MatrixXd(1, 1); }
+  RealMat interpolateFieldAtPoint(const RealVec &pnt) {
+    RealVec3 ref_loc = ConcreteHex::inverseCoordinateTransform(pnt(0), pnt(1), pnt(2), mVtxCrd);
+    return interpolateLagrangePolynomials(ref_loc(0), ref_loc(1), ref_loc(2), mPlyOrd);
+  }
+
+  /** Whether a point (in physical coordinates) lies within the element. */
+  bool containsPoint(const RealVec &pnt) {
+    return ConcreteHex::checkBoundingBox(pnt(0), pnt(1), pnt(2), mVtxCrd) &&
+           ConcreteHex::checkHull(pnt(0), pnt(1), pnt(2), mVtxCrd);
+  }
 
   // Setters.
   inline void SetNumNew(const PetscInt num) { mElmNum = num; }
-  inline void SetVtxCrd(const Eigen::Ref<const HexVtx> &v) { mVtxCrd = v; }
+  inline void SetTimeStep(const PetscReal dt) { }
+  inline void SetVtxCrd(const Eigen::Ref<const HexVtx> &v) { mVtxCrd = v; precomputeConstants(); }
 
   // Getters.
   inline bool BndElm() const { return mBndElm; }
   inline PetscInt NumDim() const { return mNumDim; }
   inline PetscInt ElmNum() const { return mElmNum; }
+  inline PetscInt NumVtx() const { return mNumVtx; }
   inline PetscInt NumIntPnt() const { return mNumIntPnt; }
   inline PetscInt NumDofVol() const { return mNumDofVol; }
   inline PetscInt NumDofFac() const { return mNumDofFac; }
   inline PetscInt NumDofEdg() const { return mNumDofEdg; }
   inline PetscInt NumDofVtx() const { return mNumDofVtx; }
-  inline IntVec ClsMap() const { return mClsMap; }
+  inline const IntVec &ClsMap() const { return mRef->mClsMap; }
   inline int PlyOrd()      const { return mPlyOrd; }
-  inline RealMat VtxCrd() const { return mVtxCrd; }
+  inline const HexVtx &VtxCrd() const { return mVtxCrd; }
   inline static PetscInt MaxOrder() { return mMaxOrder; }
   inline void SetVtxPar(const Eigen::Ref<const RealVec> &v, const std::string &par) { mPar[par] = v; }
   const inline std::vector<std::unique_ptr<Source>> &Sources() const { return mSrc; }
   const inline std::vector<std::unique_ptr<Receiver>> &Receivers() const { return mRec; }
+  const inline std::vector<RealVec> &ReceiverWeights() const { return mRecWeights; }
 
   // Delegates.
   std::tuple<RealVec, RealVec, RealVec> buildNodalPoints() {
-    return ConcreteHex::buildNodalPoints(mIntCrdR, mIntCrdS, mIntCrdT, mVtxCrd);
+    const RealMat pts = mRef->mVtxInt * mVtxCrd;
+    return std::make_tuple(pts.col(0), pts.col(1), pts.col(2));
   };
 
   const static std::string Name() { return "TensorHex_" + ConcreteHex::Name(); }
+  /** Whether the basis is a tensor product, i.e. the stiffness term is sum factorized (see Scalar). */
+  static bool TensorBasis() { return true; }
 
 };
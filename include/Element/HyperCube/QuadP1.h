@@ -80,15 +80,25 @@ class QuadP1 {
       const PetscReal r, const PetscReal s, const Eigen::Ref<const QuadVtx> &vtx,
       PetscReal &detJac, Eigen::Ref<RealMat2x2> invJac) {
 
-    RealMat2x2 jac;
-    Eigen::Matrix<PetscReal,2,4> mult;
-    jac = (mult << dn0dr(r), dn1dr(r), dn2dr(r), dn3dr(r),
-           dn0ds(s), dn1ds(s), dn2ds(s), dn3ds(s)).finished() * vtx;
+    RealMat2x2 jac = shapeDerivativesAtPoint(r, s) * vtx;
     detJac = jac.determinant();
     invJac = jac.inverse();
 
   };
 
+  /**
+   * Derivatives of the vertex shape functions at a point, as used for the Jacobian (jac = derivatives * vtx).
+   * @param [in] r Reference coordinate r.
+   * @param [in] s Reference coordinate s.
+   * @returns One row per reference direction, one column per vertex.
+   */
+  static inline Eigen::Matrix<PetscReal,2,4> shapeDerivativesAtPoint(const PetscReal r, const PetscReal s) {
+    Eigen::Matrix<PetscReal,2,4> der;
+    der << dn0dr(r), dn1dr(r), dn2dr(r), dn3dr(r),
+           dn0ds(s), dn1ds(s), dn2ds(s), dn3ds(s);
+    return der;
+  };
+
   /*
    * Linearly interpolate a value at the vertices to some location on the interior.
    * @param [in] r Reference coordinate r.
@@ -13,6 +13,7 @@
 
 // salvus
 #include <Utilities/Types.h>
+#include <Utilities/Memory.h>
 
 // forward decl.
 class Mesh;
@@ -21,6 +22,40 @@ class Options;
 class Receiver;
 class ExodusModel;
 
+/**
+ * Reference element data of a quad, which is identical for all elements of one polynomial order.
+ * It is set up once per order (see TensorQuad::ReferenceForOrder), and shared by all elements,
+ * which then only hold their own geometry and material.
+ */
+struct QuadReference {
+
+  // Closure mapping.
+  IntVec mClsMap;
+
+  // Quadrature parameters.
+  RealVec mIntCrdR;
+  RealVec mIntCrdS;
+  RealVec mIntWgtR;
+  RealVec mIntWgtS;
+
+  // Matrices holding gradient information, along r and s (the same, unless the points differ).
+  RealMat mGrdR;
+  RealMat mGrdS;
+
+  // In the reference of an element with an edge on the axis of an axisymmetric mesh, the points across the
+  // axis are GLJ points (see Gll::JacobiPoints), and this is the ratio of the GLJ to the GLL weight at each
+  // point (empty in all other references). The kernels and integrals keep the GLL weights of mIntWgtR and
+  // mIntWgtS, which the element corrects by the ratio (see TensorQuad::mAxiWgt).
+  RealVec mWgtRatio;
+
+  // Vertex shape functions at the GLL points (one row per point), and their derivatives along r and s (rows
+  // 2 i and 2 i + 1 for point i), so that the nodal points are mVtxInt * vtx and the Jacobian of point i is
+  // rows 2 i, 2 i + 1 of mVtxDer * vtx.
+  RealMat mVtxInt;
+  RealMat mVtxDer;
+
+};
+
 template <typename ConcreteShape>
 class TensorQuad: public ConcreteShape {
 
@@ -70,9 +105,55 @@ private:
 
   // Workspace.
   RealVec mDetJac;
-  RealVec mParWork;
-  RealVec mStiffWork;
-  RealMat mGradWork;
+
+  // Tensor kernels with the number of GLL points per dimension fixed at compile time (so that the
+  // 1D contractions unroll), selected for the polynomial order in the constructor (as small matrix
+  // products with --small-gemm).
+  typedef void (*RefGradKernel)(const PetscReal *grd_r, const PetscReal *grd_s, const PetscReal *field,
+                                PetscReal *grad);
+  typedef void (*GradTestKernel)(const PetscReal *grd_r, const PetscReal *grd_s, const PetscReal *wgt,
+                                 const PetscReal *flux, PetscReal *out);
+  RefGradKernel mRefGradKernel;
+  GradTestKernel mGradTestKernel;
+
+  /**
+   * Gradient of a field in the reference element.
+   * @param [in] grd_r Derivatives of the 1D Lagrange polynomials at the points along r (N x N).
+   * @param [in] grd_s The same along s.
+   * @param [in] field Field at the GLL points.
+   * @param [out] grad Derivatives along (r, s), one column each (N^2 x 2).
+   */
+  template <int N>
+  static void referenceGradientKernel(const PetscReal *grd_r, const PetscReal *grd_s, const PetscReal *field,
+                                      PetscReal *grad);
+
+  /**
+   * Integrate each component of a flux (already scaled by detJ) against the reference gradient of
+   * the test functions.
+   * @param [in] grd_r Derivatives of the 1D Lagrange polynomials at the points along r (N x N).
+   * @param [in] grd_s The same along s.
+   * @param [in] wgt 1D integration weights.
+   * @param [in] flux Flux along (x, y), one column each (N^2 x 2).
+   * @param [out] out Integrals of (x, y) against the (r, s) derivatives, as columns (xr, xs, yr, ys)
+   * (N^2 x 4).
+   */
+  template <int N>
+  static void gradTestAndIntegrateKernel(const PetscReal *grd_r, const PetscReal *grd_s, const PetscReal *wgt,
+                                         const PetscReal *flux, PetscReal *out);
+
+  /**
+   * The kernels above as N x N matrix products (see SmallGemm): G_r * F along r, and F * G_s^T along s. The
+   * product is dispatched on the first call.
+   */
+  template <int N>
+  static void referenceGradientGemmKernel(const PetscReal *grd_r, const PetscReal *grd_s, const PetscReal *field,
+                                          PetscReal *grad);
+  template <int N>
+  static void gradTestAndIntegrateGemmKernel(const PetscReal *grd_r, const PetscReal *grd_s, const PetscReal *wgt,
+                                             const PetscReal *flux, PetscReal *out);
+  /** Select the tensor kernels with N points per dimension. */
+  template <int N>
+  void selectKernels(const bool small_gemm);
 
   // On Boundary.
   bool mBndElm;
@@ -95,25 +176,68 @@ private:
   // Element center.
   RealVec2 mElmCtr;
 
+  // Exodus model element (-1 if not known, see Mesh::ModelElement).
+  PetscInt mModElm;
+
   // Closure mapping.
-  IntVec mClsMap;
   std::vector<PetscInt> mEdgMap;
 
-  // Quadrature parameters.
-  RealVec mIntCrdR;
-  RealVec mIntCrdS;
-  RealVec mIntWgtR;
-  RealVec mIntWgtS;
-
-  // Matrix holding gradient information.
-  RealMat mGrd;
+  // Reference element data, shared by all elements of one order.
+  std::shared_ptr<const QuadReference> mRef;
 
   // Material parameters.
   std::map<std::string,RealVec4> mPar;
+  // Material parameters read at the integration points (see ExodusModel::CachedParameterAtIntPts).
+  std::map<std::string,RealVec> mParIntPts;
 
   // Sources and receivers.
   std::vector<std::unique_ptr<Source>> mSrc;
   std::vector<std::unique_ptr<Receiver>> mRec;
+  // Lagrange interpolation weights of each receiver, at its reference location.
+  std::vector<RealVec> mRecWeights;
+
+  // Precomputed geometry (unless --low-memory-geometry). mDetJac doubles as workspace otherwise.
+  // Affine elements (parallelograms) only store one Jacobian, in either mode.
+  bool mPrecomputeGeometry;
+  bool mAffine;
+  std::vector<RealMat2x2, Eigen::aligned_allocator<RealMat2x2>> mInvJac;
+
+  // Axisymmetric quadrature (--axisymmetric), of the integrals over r dr dz, with x the radius r. The radius at
+  // each GLL point (zero on the axis), and the factor of each point's planar quadrature weight: the radius, or
+  // in an element with an edge on the axis, the radius over the reference distance from the axis, times the
+  // GLJ weight ratio (see QuadReference::mWgtRatio), which stays finite on the axis. Both are empty otherwise.
+  // The edge on the axis, in vertex order (-1 if none), selects the reference.
+  bool mAxisymmetric;
+  RealVec mAxiRad;
+  RealVec mAxiWgt;
+  PetscInt mAxiEdg;
+
+  /** Find the edge on the axis, pick its reference, and set up the axisymmetric weights (see mAxiWgt). */
+  void precomputeAxisymmetry();
+
+  /** Lagrange polynomials through the reference points of this element (GLJ across the axis), at (r, s). */
+  RealVec lagrangeAtPoint(const PetscReal r, const PetscReal s) const;
+
+  /**
+   * Get the determinant and inverse of the Jacobian at a GLL point, either from the precomputed
+   * geometry or recomputed from the vertex coordinates.
+   * @param [in] r_ind Index of the GLL point in r.
+   * @param [in] s_ind Index of the GLL point in s.
+   * @param [out] detJac Determinant of the Jacobian.
+   * @param [out] invJac Inverse of the Jacobian.
+   */
+  inline void jacobianAtIntPnt(const PetscInt r_ind, const PetscInt s_ind, PetscReal &detJac,
+                               RealMat2x2 &invJac) {
+    if (mAffine) {
+      detJac = mDetJac(0); invJac = mInvJac[0];
+    } else if (mPrecomputeGeometry) {
+      PetscInt index = r_ind + s_ind * mNumIntPtsR;
+      detJac = mDetJac(index); invJac = mInvJac[index];
+    } else {
+      const RealMat2x2 jac = mRef->mVtxDer.template middleRows<2>(2 * (r_ind + s_ind * mNumIntPtsR)) * mVtxCrd;
+      detJac = jac.determinant(); invJac = jac.inverse();
+    }
+  }
 
  public:
 
@@ -130,6 +254,16 @@ private:
    */
   static RealVec GllPointsForOrder(const PetscInt order);
 
+  /**
+   * Returns the reference element for a given polynomial order, which is set up on first use, and
+   * then shared by all elements of that order.
+   * @param [in] order Polynomial order.
+   * @param [in] axis_edge Edge on the axis of an axisymmetric mesh (in vertex order), across which the points
+   * are GLJ points, or -1 for GLL points in both directions.
+   * @returns The shared reference element.
+   */
+  static std::shared_ptr<const QuadReference> ReferenceForOrder(const PetscInt order, const PetscInt axis_edge = -1);
+
   /**
    * Returns GLL integration weights for a given polynomial order.
    * @param [in] order Polynomial order.
@@ -156,9 +290,10 @@ private:
   /**
    * Compute the gradient of a field at all GLL points.
    * @param [in] field Field to take the gradient of.
-   * @returns nGll x nDim matrix containing field gradient components.
+   * @returns nGll x nDim matrix containing field gradient components. This is a view into the
+   * thread's scratch arena, valid until the next call (see Scratch).
    */
-  RealMat computeGradient(const Eigen::Ref<const RealVec>& field);
+  Eigen::Map<RealMat> computeGradient(const Eigen::Ref<const RealVec>& field);
 
   /**
    * Interpolate a parameter from vertex to GLL point.
@@ -167,6 +302,26 @@ private:
    */
   RealVec ParAtIntPts(const std::string& par);
 
+  /** Names of the material parameters attached to the element. */
+  std::vector<std::string> ParNames() const {
+    std::vector<std::string> names;
+    for (auto &p: mPar) { names.push_back(p.first); }
+    for (auto &p: mParIntPts) { names.push_back(p.first); }
+    return names;
+  }
+
+  /** Heap bytes held by the element (the reference element is shared, and not counted). */
+  size_t MemoryBytes() const {
+    return Memory::bytes(mBnd) + Memory::bytes(mEdgMap) + Memory::bytes(mPar) + Memory::bytes(mParIntPts) +
+        Memory::bytes(mRecWeights) + Memory::bytes(mDetJac) + Memory::bytes(mInvJac) + Memory::bytes(mAxiRad) +
+        Memory::bytes(mAxiWgt) +
+        sizeof(mSrc[0]) * mSrc.capacity() + sizeof(mRec[0]) * mRec.capacity();
+  }
+  /** Bytes of dense per-element operators (none, the operators are sum factorized). */
+  size_t OperatorBytes() const { return 0; }
+  /** Variant of the stiffness kernel (see Element::StiffnessVariant), of which the shape has only one. */
+  PetscInt StiffnessVariant() const { return 0; }
+
   /**
    * Multiply a field by the test functions and integrate.
    * @param [in] f Field to calculate on.
@@ -174,12 +329,20 @@ private:
    */
   RealVec applyTestAndIntegrate(const Eigen::Ref<const RealVec>& f);
 
+  /**
+   * Multiply a field by the test functions over the radius, and integrate (the hoop terms of the axisymmetric
+   * elastic stiffness). The points on the axis, where the radial displacement vanishes, take nothing.
+   * @param [in] f Field to calculate on.
+   * @returns Coefficients at gll points, as a view into the thread's scratch arena (see Scratch).
+   */
+  Eigen::Map<RealVec> applyTestOverRadiusAndIntegrate(const Eigen::Ref<const RealVec>& f);
+
   /**
    * Multiply a field by the gradient of the test functions and integrate.
    * @param [in] f Field to calculate on.
-   * @returns Coefficients at gll points.
+   * @returns Coefficients at gll points, as a view into the thread's scratch arena (see Scratch).
    */
-  RealVec applyGradTestAndIntegrate(const Eigen::Ref<const RealMat>& f);
+  Eigen::Map<RealVec> applyGradTestAndIntegrate(const Eigen::Ref<const RealMat>& f);
 
 
   /**
@@ -209,6 +372,16 @@ private:
   */
   void precomputeElementTerms() {}
 
+  /**
+   * Store the determinant and inverse of the Jacobian at each GLL point, if the geometry is
+   * precomputed, or only once if the element is affine. Called whenever the vertex coordinates
+   * change.
+   */
+  void precomputeConstants();
+
+  /** Whether the element is a parallelogram, i.e. has a constant Jacobian (set with the vertices). */
+  bool IsAffine() const { return mAffine; }
+
   std::vector<PetscInt> getDofsOnFace(const PetscInt face);
   std::vector<PetscInt> getDofsOnEdge(const PetscInt edge);
   PetscInt getDofsOnVtx(const PetscInt vtx);
@@ -229,6 +402,9 @@ private:
    */
   bool attachReceiver(std::unique_ptr<Receiver> &receiver, const bool finalize);
 
+  /** Remove all sources and receivers from the element (i.e. between shots). */
+  void detachSourcesAndReceivers() { mSrc.clear(); mRec.clear(); mRecWeights.clear(); }
+
   /**
    * Given a delta function at some location (r,s), computes the coefficients at the
    * GLL points that would integrate to the delta function over the element.
@@ -237,6 +413,13 @@ private:
    */
   RealVec getDeltaFunctionCoefficients(const Eigen::Ref<RealVec>& pnt);
 
+  /**
+   * The test functions over the radius at a point source (their radial derivative, if it is on the axis), over
+   * 2 pi, i.e. the hoop term of a moment tensor source in an axisymmetric mesh.
+   * @param [in] pnt Reference coordinates of the source.
+   */
+  RealVec getHoopDeltaFunctionCoefficients(const Eigen::Ref<RealVec>& pnt);
+
   /**
    * Given a model, save the material parameters at the element vertices.
    * @param [in] model The model containing the material parameters.
@@ -245,14 +428,34 @@ private:
   void attachMaterialProperties(std::unique_ptr<ExodusModel> const &model, std::string parameter);
 
   /**
-   * Given some field at the GLL points, interpolate the field to some general point.
-   * @param [in] pnt Position in reference coordinates.
+   * Courant number of the explicit Newmark scheme, relative to estimatedElementRadius.
+   * @return The CFL constant.
    */
-  RealMat interpolateFieldAtPoint(const RealVec2 &pnt) { return Eigen::MatrixXd(1, 1); }
+  double CFL_constant();
+
+  /**
+   * Smallest distance between two neighbouring GLL points of the element (in physical space).
+   * @return The element radius, as used in the CFL estimate.
+   */
+  double estimatedElementRadius();
+
+  /**
+   * The weights which interpolate a field at the GLL points to some general point, as for a receiver.
+   * @param [in] pnt Position in physical coordinates, within the element.
+   * @returns The Lagrange polynomial of each GLL point, evaluated at pnt.
+   */
+  RealMat interpolateFieldAtPoint(const RealVec2 &pnt) {
+    RealVec2 ref_loc = ConcreteShape::inverseCoordinateTransform(pnt(0), pnt(1), mVtxCrd);
+    return lagrangeAtPoint(ref_loc(0), ref_loc(1));
+  }
+
+  /** Whether a point (in physical coordinates) lies within the element. */
+  bool containsPoint(const RealVec2 &pnt) { return ConcreteShape::checkHull(pnt(0), pnt(1), mVtxCrd); }
 
   // Setters.
   inline void SetNumNew(const PetscInt num) { mElmNum = num; }
-  inline void SetVtxCrd(const Eigen::Ref<const QuadVtx> &v) { mVtxCrd = v; }
+  inline void SetTimeStep(const PetscReal dt) { }
+  inline void SetVtxCrd(const Eigen::Ref<const QuadVtx> &v) { mVtxCrd = v; precomputeConstants(); }
   inline void SetCplEdg(const std::vector<PetscInt> &v) { mEdgMap = v; }
   inline void SetVtxPar(const Eigen::Ref<const RealVec4> &v, const std::string &par) { mPar[par] = v; }
 
@@ -266,17 +469,23 @@ private:
   inline PetscInt NumDofFac() const { return mNumDofFac; }
   inline PetscInt NumDofEdg() const { return mNumDofEdg; }
   inline PetscInt NumDofVtx() const { return mNumDofVtx; }
-  inline IntVec ClsMap()      const { return mClsMap; }
+  inline const IntVec &ClsMap() const { return mRef->mClsMap; }
   inline int PlyOrd()         const { return mPlyOrd; }
-  inline QuadVtx VtxCrd()     const { return mVtxCrd; }
+  inline const QuadVtx &VtxCrd() const { return mVtxCrd; }
   const inline std::vector<std::unique_ptr<Source>> &Sources() const { return mSrc; }
   const inline std::vector<std::unique_ptr<Receiver>> &Receivers() const { return mRec; }
+  const inline std::vector<RealVec> &ReceiverWeights() const { return mRecWeights; }
+  /** Whether the element is integrated over r dr dz (--axisymmetric). */
+  inline bool Axisymmetric() const { return mAxisymmetric; }
+  /** Radius of each GLL point, zero on the axis (empty unless axisymmetric). */
+  inline const RealVec &AxisRadius() const { return mAxiRad; }
 
   inline static PetscInt MaxOrder() { return mMaxOrder; }
 
   // Delegates.
   std::tuple<Eigen::VectorXd, Eigen::VectorXd> buildNodalPoints() {
-    return ConcreteShape::buildNodalPoints(mIntCrdR, mIntCrdS, mVtxCrd);
+    const RealMat pts = mRef->mVtxInt * mVtxCrd;
+    return std::make_tuple(pts.col(0), pts.col(1));
   };
 
 
@@ -290,6 +499,8 @@ private:
    * Class name.
    */
   const static std::string Name() { return "TensorQuad_" + ConcreteShape::Name(); }
+  /** Whether the basis is a tensor product, i.e. the stiffness term is sum factorized (see Scalar). */
+  static bool TensorBasis() { return true; }
 
 };
 
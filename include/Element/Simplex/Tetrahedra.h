@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Utilities/Logging.h>
+#include <Utilities/Memory.h>
 
 // stl.
 #include <map>
@@ -89,6 +90,19 @@ class Tetrahedra: public ConcreteShape {
   static Eigen::Matrix<double,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor> mGradientPhi_dr_t;
   static Eigen::Matrix<double,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor> mGradientPhi_ds_t;
   static Eigen::Matrix<double,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor> mGradientPhi_dt_t;
+  /** [mGradientPhi_dr mGradientPhi_ds mGradientPhi_dt] (N x 3N), so that the reference gradient of a field, and
+   * the gradient of the test functions against one, are each a single product. */
+  static Eigen::MatrixXd mGradientPhi_drst;
+
+  // Kernels with the number of points N fixed at compile time, so that the products with the gradient
+  // operators are unrolled. The public methods dispatch to them by order, and fall back to the
+  // dynamically sized code for any other.
+  /** Physical gradient of a field (see computeGradient), into mGradWork. */
+  template <int N>
+  void gradientKernel(const Eigen::Ref<const Eigen::VectorXd>& field);
+  /** Gradient of the test functions against a reference field (see applyGradTestAndIntegrate), into mStiffWork. */
+  template <int N>
+  void gradTestAndIntegrateKernel(const Eigen::Ref<const Eigen::MatrixXd>& f);
   
   /**********************************************************************************
    * OBJECT MEMBERS. THESE VARIABLES AND FUNCTIONS SHOULD APPLY TO SPECIFIC ELEMENTS.
@@ -100,10 +114,6 @@ class Tetrahedra: public ConcreteShape {
   Eigen::Matrix<double,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor> mGradientPhi_dx_t;
   Eigen::Matrix<double,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor> mGradientPhi_dy_t;
   Eigen::Matrix<double,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor> mGradientPhi_dz_t;
-
-  Eigen::MatrixXd mWiDPhi_x;
-  Eigen::MatrixXd mWiDPhi_y;
-  Eigen::MatrixXd mWiDPhi_z;
   
   // Vertex coordinates.
   Eigen::Matrix<double,mNumVtx,mNumDim> mVtxCrd;
@@ -111,8 +121,11 @@ class Tetrahedra: public ConcreteShape {
   // Element center.
   Eigen::Vector3d mElmCtr;
 
+  // Exodus model element (-1 if not known, see Mesh::ModelElement).
+  PetscInt mModElm;
+
   // Closure mapping.
-  Eigen::VectorXi mClsMap;
+  IntVec mClsMap;
   
   // Workspace.
   double mDetJac;
@@ -129,13 +142,20 @@ class Tetrahedra: public ConcreteShape {
 
   // Material parameters.
   std::map<std::string,Eigen::Vector4d> mPar;
+  // Material parameters read at the integration points (see ExodusModel::CachedParameterAtIntPts).
+  std::map<std::string,RealVec> mParIntPts;
 
   // Sources and receivers.
   std::vector<std::shared_ptr<Source>> mSrc;
   std::vector<std::shared_ptr<Receiver>> mRec;
+  // Interpolation weights of each receiver (receivers are not supported on simplices yet).
+  std::vector<RealVec> mRecWeights;
   
-  // precomputed element stiffness matrix (with velocities)
-  Eigen::MatrixXd mElementStiffnessMatrix;
+  // The stiffness is applied as the gradient, scaled by the material, against the gradient of the test
+  // functions (see Scalar), never as an element matrix. The gradient is taken with the physical derivative
+  // operators (mGradientPhi_dx,...) of the element, or with --simplex-reference-stiffness, through the
+  // reference ones, so that only the Jacobian is stored.
+  bool mReferenceStiffness;
 
   Eigen::Matrix3d mInvJac;
   Eigen::Matrix3d mInvJacT;
@@ -156,6 +176,9 @@ class Tetrahedra: public ConcreteShape {
    */
   Tetrahedra(std::unique_ptr<Options> const &options);
 
+  /** Whether the basis is a tensor product (see Scalar). Tetrahedra keep their own dense operators. */
+  static bool TensorBasis() { return false; }
+
   /**
    * Returns the gll locations for a given polynomial order.
    * @param [in] order The polynmomial order.
@@ -185,6 +208,10 @@ class Tetrahedra: public ConcreteShape {
     std::cerr << "ERROR: interpolateFieldAtPoint not implemented\n"; exit(1);
     return Eigen::Matrix<double, -1, -1, 0, -1, -1>();
   }
+  bool containsPoint(const Eigen::VectorXd &pnt) {
+    std::cerr << "ERROR: containsPoint not implemented\n"; exit(1);
+    return false;
+  }
 
   void recordField(const Eigen::MatrixXd &u) { std::cerr << "ERROR: recordField not implemented\n"; exit(1); };
 
@@ -219,6 +246,30 @@ class Tetrahedra: public ConcreteShape {
    */
   Eigen::VectorXd ParAtIntPts(const std::string& par);
 
+  /** Names of the material parameters attached to the element. */
+  std::vector<std::string> ParNames() const {
+    std::vector<std::string> names;
+    for (auto &p: mPar) { names.push_back(p.first); }
+    for (auto &p: mParIntPts) { names.push_back(p.first); }
+    return names;
+  }
+
+  /** Heap bytes held by the element, including its operators (see OperatorBytes). */
+  size_t MemoryBytes() const {
+    return Memory::bytes(mClsMap) + Memory::bytes(mParWork) + Memory::bytes(mStiffWork) + Memory::bytes(mGradWork) +
+        Memory::bytes(mGrad_r) + Memory::bytes(mGrad_s) + Memory::bytes(mGrad_t) + Memory::bytes(mBnd) +
+        Memory::bytes(mPar) + Memory::bytes(mParIntPts) + Memory::bytes(mRecWeights) + OperatorBytes() +
+        sizeof(mSrc[0]) * mSrc.capacity() + sizeof(mRec[0]) * mRec.capacity();
+  }
+  /** Bytes of the dense per-element operators: the physical derivatives of the basis (none with
+   * --simplex-reference-stiffness). */
+  size_t OperatorBytes() const {
+    return Memory::bytes(mGradientPhi_dx) + Memory::bytes(mGradientPhi_dy) + Memory::bytes(mGradientPhi_dz) +
+        Memory::bytes(mGradientPhi_dx_t) + Memory::bytes(mGradientPhi_dy_t) + Memory::bytes(mGradientPhi_dz_t);
+  }
+  /** Variant of the stiffness kernel (see Element::StiffnessVariant), of which the shape has only one. */
+  PetscInt StiffnessVariant() const { return 0; }
+
   /**
    * Gets the indices on an edge.
    * @param [in] edg Edge id 0-2
@@ -298,6 +349,9 @@ class Tetrahedra: public ConcreteShape {
    */
   bool attachReceiver(std::unique_ptr<Receiver> &receiver, const bool finalize);
 
+  /** Remove all sources and receivers from the element (i.e. between shots). */
+  void detachSourcesAndReceivers() { mSrc.clear(); mRec.clear(); mRecWeights.clear(); }
+
   
   
   
@@ -318,6 +372,12 @@ class Tetrahedra: public ConcreteShape {
   Eigen::VectorXd computeStiffnessFull(const Eigen::Ref<const Eigen::VectorXd>&  field,
                                        const Eigen::Ref<const Eigen::VectorXd>& vp2);
   
+  /**
+   * Set up the physical derivative operators of the element, and build its stiffness matrix, which is not
+   * kept (the time loop applies the operators instead).
+   * @param [in] vp2 Material coefficient at the integration points.
+   * @returns The element stiffness matrix.
+   */
   Eigen::MatrixXd buildStiffnessMatrix(const Eigen::Ref<const Eigen::VectorXd>& vp2);
 
   /**
@@ -350,6 +410,7 @@ class Tetrahedra: public ConcreteShape {
    */
   void SetNum(int element_number) { mElmNum = element_number; }
   inline void SetNumNew(const PetscInt num) { mElmNum = num; }
+  inline void SetTimeStep(const PetscReal dt) { }
   inline void SetVtxCrd(const Eigen::Ref<const Eigen::Matrix<double,mNumVtx,mNumDim>> &v) { mVtxCrd = v; }
 
   inline PetscInt ElmNum()        const { return mElmNum; }
@@ -360,10 +421,13 @@ class Tetrahedra: public ConcreteShape {
   inline int NumDofFac()          const { return mNumDofFac; }
   inline int NumDofEdg()          const { return mNumDofEdg; }
   inline int NumDofVtx()          const { return mNumDofVtx; }
-  inline Eigen::MatrixXi ClsMap() const { return mClsMap; }
+  inline const IntVec &ClsMap() const { return mClsMap; }
   inline int PlyOrd()             const { return mPlyOrd; }
-  inline Eigen::MatrixXd VtxCrd() const { return mVtxCrd; }
+  inline bool ReferenceStiffness() const { return mReferenceStiffness; }
+  inline const Eigen::Matrix<double,mNumVtx,mNumDim> &VtxCrd() const { return mVtxCrd; }
   std::vector<std::shared_ptr<Source>> Sources() { return mSrc; }
+  std::vector<std::shared_ptr<Receiver>> Receivers() { return mRec; }
+  const inline std::vector<RealVec> &ReceiverWeights() const { return mRecWeights; }
 
   /**
    * Builds nodal coordinates (x,z) on all mesh degrees of freedom.
@@ -8,6 +8,7 @@
 
 // salvus
 #include <Utilities/Types.h>
+#include <Utilities/Memory.h>
 #include <Utilities/Logging.h>
 
 // forward decl.
@@ -65,8 +66,11 @@ class Triangle: public ConcreteShape {
   // Element center.
   Eigen::Vector2d mElmCtr;
 
+  // Exodus model element (-1 if not known, see Mesh::ModelElement).
+  PetscInt mModElm;
+
   // Closure mapping.
-  Eigen::VectorXi mClsMap;
+  IntVec mClsMap;
 
   // Workspace.
   double mDetJac;
@@ -93,20 +97,46 @@ class Triangle: public ConcreteShape {
   /** s-derivative of Lagrange poly Phi [row: phi_i, col: phi @ nth point]*/
   static Eigen::MatrixXd mGradientPhi_ds;
 
+  // Kernels with the number of points N fixed at compile time, so that the products with the gradient
+  // operators above are unrolled. The public methods dispatch to them by order, and fall back to the
+  // dynamically sized code for any other.
+  /** Physical gradient of a field (see computeGradient), into mGradWork. */
+  template <int N>
+  void gradientKernel(const Eigen::Ref<const RealVec>& field);
+  /** Gradient of the test functions against a reference field (see applyGradTestAndIntegrate), into mStiffWork. */
+  template <int N>
+  void gradTestAndIntegrateKernel(const Eigen::Ref<const RealMat>& f);
+  /** Reference stiffness (see applyReferenceStiffness). */
+  template <int N>
+  void referenceStiffnessKernel(const Eigen::Ref<const RealVec>& u, const Eigen::Ref<const RealVec>& coef,
+                                Eigen::Map<RealVec> &stiff);
+  /** Reference stiffness of L elements at once (see referenceStiffnessLanes). */
+  template <int N, int L>
+  void referenceStiffnessLanesKernel(const PetscReal *geo, const PetscReal *coef, const PetscReal *u,
+                                     PetscReal *out, PetscReal *work);
+
   /**********************************************************************************
    * OBJECT MEMBERS. THESE VARIABLES AND FUNCTIONS SHOULD APPLY TO SPECIFIC ELEMENTS.
    ***********************************************************************************/
 
   // Material parameters.
   std::map<std::string,Eigen::Vector3d> mPar;
+  // Material parameters read at the integration points (see ExodusModel::CachedParameterAtIntPts).
+  std::map<std::string,RealVec> mParIntPts;
 
   // Sources and receivers.
   std::vector<std::shared_ptr<Source>> mSrc;
   std::vector<std::shared_ptr<Receiver>> mRec;
+  // Interpolation weights of each receiver (receivers are not supported on simplices yet).
+  std::vector<RealVec> mRecWeights;
   
-  // precomputed element stiffness matrix (with velocities)
+  // precomputed element stiffness matrix (with velocities), unless --simplex-reference-stiffness.
   Eigen::MatrixXd mElementStiffnessMatrix;
 
+  // With --simplex-reference-stiffness: detJ * (invJ^T invJ) as (rr, rs, ss), in place of the matrix.
+  bool mReferenceStiffness;
+  Eigen::Vector3d mRefStiffCoef;
+
   // precomputed jacobians
   Eigen::Matrix2d mInvJac;
   Eigen::Matrix2d mInvJacT;
@@ -187,6 +217,27 @@ class Triangle: public ConcreteShape {
    * @param [in] par Parameter to interpolate (i.e. VP, VS).
    */
   RealVec ParAtIntPts(const std::string& par);
+
+  /** Names of the material parameters attached to the element. */
+  std::vector<std::string> ParNames() const {
+    std::vector<std::string> names;
+    for (auto &p: mPar) { names.push_back(p.first); }
+    for (auto &p: mParIntPts) { names.push_back(p.first); }
+    return names;
+  }
+
+  /** Heap bytes held by the element, including its stiffness matrix (see OperatorBytes). */
+  size_t MemoryBytes() const {
+    return Memory::bytes(mClsMap) + Memory::bytes(mParWork) + Memory::bytes(mStiffWork) + Memory::bytes(mGradWork) +
+        Memory::bytes(mBnd) + Memory::bytes(mGradientOperator) + Memory::bytes(mIntegrationWeights) +
+        Memory::bytes(mIntegrationCoordinates_r) + Memory::bytes(mIntegrationCoordinates_s) +
+        Memory::bytes(mPar) + Memory::bytes(mParIntPts) + Memory::bytes(mRecWeights) + OperatorBytes() +
+        sizeof(mSrc[0]) * mSrc.capacity() + sizeof(mRec[0]) * mRec.capacity();
+  }
+  /** Bytes of the precomputed element stiffness matrix (none with --simplex-reference-stiffness). */
+  size_t OperatorBytes() const { return Memory::bytes(mElementStiffnessMatrix); }
+  /** Variant of the stiffness kernel (see Element::StiffnessVariant), of which the shape has only one. */
+  PetscInt StiffnessVariant() const { return 0; }
   
   /**
    * Attaches a material parameter to the vertices on the current element.
@@ -245,6 +296,9 @@ class Triangle: public ConcreteShape {
    */
   bool attachReceiver(std::unique_ptr<Receiver> &receiver, const bool finalize);
 
+  /** Remove all sources and receivers from the element (i.e. between shots). */
+  void detachSourcesAndReceivers() { mSrc.clear(); mRec.clear(); mRecWeights.clear(); }
+
   std::vector<PetscInt> getDofsOnFace(const PetscInt face);
 
   /**
@@ -275,6 +329,7 @@ class Triangle: public ConcreteShape {
    * @param [in] pnt Position in reference coordinates.
    */
   Eigen::MatrixXd interpolateFieldAtPoint(const Eigen::VectorXd &pnt) { std::cerr << "ERROR: Not implemented"; exit(1); }
+  bool containsPoint(const Eigen::VectorXd &pnt) { std::cerr << "ERROR: Not implemented"; exit(1); }
 
   /**
    *
@@ -283,6 +338,30 @@ class Triangle: public ConcreteShape {
 
   Eigen::MatrixXd buildStiffnessMatrix(Eigen::VectorXd velocity);
 
+  /**
+   * Apply the stiffness matrix through the reference derivatives (see --simplex-reference-stiffness), i.e.
+   * K u = sum_ab c_ab D_a W D_b^T u, with the geometric coefficients c_ab of this element and W the
+   * integration weights times the material coefficient. The result is borrowed from the scratch arena.
+   * @param [in] u Field at the GLL points.
+   * @param [in] coef Material coefficient (i.e. VP^2) at the GLL points.
+   */
+  Eigen::Map<RealVec> applyReferenceStiffness(const Eigen::Ref<const RealVec>& u,
+                                              const Eigen::Ref<const RealVec>& coef);
+
+  /**
+   * Reference stiffness (see applyReferenceStiffness) of L elements at once. All fields are lane-interleaved,
+   * i.e. entry L*i+l holds point i of element l, so each reference derivative is applied to all lanes by a single
+   * (num_pnt x num_pnt) x (num_pnt x L) product.
+   * @param [in] geo Geometric coefficients (rr, rs, ss) of each element, 3*L values.
+   * @param [in] coef Material coefficient at each point.
+   * @param [in] u Field at each point.
+   * @param [out] out Stiffness term at each point.
+   * @param [in] work Scratch space of 2*num_pnt*L values.
+   */
+  template <int L>
+  void referenceStiffnessLanes(const PetscReal *geo, const PetscReal *coef, const PetscReal *u, PetscReal *out,
+                               PetscReal *work);
+
   double CFL_constant();
   
   /** Return the estimated element radius
@@ -292,6 +371,7 @@ class Triangle: public ConcreteShape {
   
   // Setters
   inline void SetNumNew(const PetscInt num) { mElmNum = num; }
+  inline void SetTimeStep(const PetscReal dt) { }
   inline void SetVtxCrd(const Eigen::Ref<const Eigen::Matrix<double,3,2>> &v) { mVtxCrd = v; }
 
   /**
@@ -316,11 +396,17 @@ class Triangle: public ConcreteShape {
   inline int NumDofFac()          const { return mNumDofFac; }
   inline int NumDofEdg()          const { return mNumDofEdg; }
   inline int NumDofVtx()          const { return mNumDofVtx; }
-  inline Eigen::MatrixXi ClsMap() const { return mClsMap; }
+  inline const IntVec &ClsMap() const { return mClsMap; }
   inline int PlyOrd()             const { return mPlyOrd; }
-  inline Eigen::MatrixXd VtxCrd() const { return mVtxCrd; }
-  inline Eigen::MatrixXd StiffnessMatrix() const { return mElementStiffnessMatrix; }
+  inline const Eigen::Matrix<double,mNumVtx,mNumDim> &VtxCrd() const { return mVtxCrd; }
+  inline const Eigen::MatrixXd &StiffnessMatrix() const { return mElementStiffnessMatrix; }
+  inline bool ReferenceStiffness() const { return mReferenceStiffness; }
+  /** Whether the basis is a tensor product (see Scalar). Triangles keep their own dense operators. */
+  static bool TensorBasis() { return false; }
+  inline const Eigen::Vector3d &ReferenceStiffnessCoefficients() const { return mRefStiffCoef; }
   std::vector<std::shared_ptr<Source>> Sources() { return mSrc; }
+  std::vector<std::shared_ptr<Receiver>> Receivers() { return mRec; }
+  const inline std::vector<RealVec> &ReceiverWeights() const { return mRecWeights; }
 
   
   /**
@@ -1,6 +1,7 @@
 #pragma once
 
 // stl.
+#include <functional>
 #include <set>
 #include <memory>
 #include <map>
@@ -14,6 +15,7 @@
 #include <petsc.h>
 #include <Eigen/Dense>
 #include <Element/Element.h>
+#include <Utilities/Types.h>
 
 // forward decl.
 class Options;
@@ -25,6 +27,73 @@ class Mesh {
 
   std::set<std::tuple<PetscInt,PetscInt>> mBndPts;
 
+  /** Per side set, whether each DMPlex point (offset by the chart start) lies on it. **/
+  std::vector<std::vector<bool>> mSideSetPts;
+  PetscInt mChartStart = 0;
+
+  /** Per local element, the (depth, index within that depth) of its closure entities on any side set. **/
+  std::vector<std::vector<std::tuple<PetscInt,PetscInt>>> mElmBndEntities;
+
+  /** Per local element, the indices (in its cone) of its faces on absorbing side sets. **/
+  std::vector<std::vector<PetscInt>> mElmAbsFaces;
+
+  /** Per local element, those of its absorbing faces which are on injection side sets. **/
+  std::vector<std::vector<PetscInt>> mElmInjFaces;
+
+  /** Side sets given by --absorbing-boundaries (or --injection-boundaries). **/
+  std::vector<PetscInt> mAbsSideSets;
+
+  /** Side sets of each pair of --periodic-boundaries (master, slave), or -1 for those without faces here. **/
+  std::vector<std::pair<PetscInt, PetscInt>> mPeriodicSideSets;
+
+  /** Order in which the local elements are processed (identity, unless --reorder-elements). **/
+  std::vector<PetscInt> mElmOrder;
+
+  /** Concrete element type of each local element (see Element::TypeCode). **/
+  std::vector<PetscInt> mElmTypeCode;
+
+  /** Vertex coordinates of all local elements, back to back (element e from mElmVtxOff[e], row-major), and
+   * element centers (one row per element). Extracted once the mesh is distributed. **/
+  std::vector<PetscReal> mElmVtx;
+  std::vector<PetscInt> mElmVtxOff;
+  Eigen::MatrixXd mElmCtr;
+
+  /** Faces (edges in 2D) of all local elements, back to back (element e from mElmFaceOff[e], in cone order),
+   * with the element across each (or -1 on the boundary of the partition). Element setup reads these instead of
+   * the DMPlex, so that elements may be set up concurrently. **/
+  std::vector<PetscInt> mElmFace, mElmFaceNbr, mElmFaceOff;
+
+  /** Transitive closures of all local elements, back to back (element e from mElmClsOff[e]), as the (point,
+   * orientation) pairs of DMPlexGetTransitiveClosure. The setup of the topology, the coupling fields and the
+   * dof ordering read these, instead of walking the DMPlex again for every element. **/
+  std::vector<PetscInt> mElmCls, mElmClsOff;
+
+  /** Extract mElmVtx, mElmCtr, the faces and the closures from the distributed mesh, in a single pass over the
+   * elements. **/
+  void extractElementCoordinates();
+
+  /** True if the cells were read from an exodus file, and so numbered (serially) as the model elements. **/
+  bool mExodusCells;
+
+  /** Exodus (model) element of each local element, carried through the distribution (empty if not known). **/
+  std::vector<PetscInt> mElmModelIdx;
+
+  /** Layers of overlapping cells distributed to each rank beyond its own (--halo-overlap). **/
+  PetscInt mOverlap;
+
+  /** Bisect the cells first onto the nodes, then within each onto its ranks (--hierarchical-partitioning), and
+   * the order of the nodes (--node-order). **/
+  bool mHierarchical;
+  std::string mNodeOrder;
+
+  /** Global number of each local element (as DMPlexGetCellNumbering, -(n + 1) if owned by another rank), with
+   * overlapping cells (empty otherwise). **/
+  std::vector<PetscInt> mElmGlbNum;
+
+  /** Slowest wave speed of the physics type within each of the elements (minimum over their vertices). **/
+  std::vector<PetscReal> minimumWaveSpeeds(unique_ptr<ExodusModel> const &model,
+                                           const std::vector<PetscInt> &elms, const std::string &type);
+
   /** Keeps track of all the fields defined in the mesh. **/
   std::set<std::string> mMeshFields;
 
@@ -45,9 +114,68 @@ class Mesh {
 
   PetscInt mNumberElementsLocal; /** < Num of elements on this processor. */
   PetscInt mNumDim;    /** < Num of dimensions of the mesh. */
+  PetscInt mNumComponents = 1;   /** < Num of interleaved components per dof. */
   PetscInt mNumberSideSets;      /** < Num of flagged boundaries. */
   PetscInt int_tstep;            /** < Timestep number. */
 
+  /**
+   * Distribute a (serial) mesh with the current partitioner, and take it as the distributed mesh.
+   * @param [in] dm The mesh, destroyed if it is distributed.
+   * @param [out] migration If given, the migration from the serial to the distributed points (NULL on one rank).
+   */
+  void distribute(DM dm, PetscSF *migration = NULL);
+
+  /**
+   * Ranks of each shared memory node (collective), in the order of --node-order: by their first rank, or by host
+   * name (with embedded numbers compared by value), which on most machines follows the network topology.
+   */
+  std::vector<std::vector<PetscInt>> nodeRanks() const;
+
+  /**
+   * Bisect weighted cells onto the ranks, with --hierarchical-partitioning first onto the nodes (in proportion to
+   * their ranks), so that the cut between nodes is that of as many parts as nodes, then within each node.
+   * @param [in] ctr Center of each cell.
+   * @param [in] weight Weight of each cell.
+   * @param [in] nodes Ranks of each node (see nodeRanks).
+   * @param [out] part Rank of each cell.
+   */
+  void partitionCells(const RealMat &ctr, const std::vector<PetscReal> &weight,
+                      const std::vector<std::vector<PetscInt>> &nodes, std::vector<PetscInt> &part) const;
+
+  /**
+   * Compute a cost-weighted partition of a serial exodus mesh (see read(model, options)), in the layout of
+   * PetscPartitionerShellSetPartition.
+   */
+  void weightedPartition(DM dm, unique_ptr<ExodusModel> const &model, unique_ptr<Options> const &options,
+                         std::vector<PetscInt> &sizes, std::vector<PetscInt> &points);
+
+  /**
+   * Read a partition cached by an earlier run. The cache is only used if it was written for the same mesh file
+   * contents and number of ranks.
+   * @param [in] filename Cache file.
+   * @param [in] num_cells Number of (serial) cells held by this rank.
+   * @param [out] sizes Number of cells per rank, as for PetscPartitionerShellSetPartition.
+   * @param [out] points Cells of each rank, as for PetscPartitionerShellSetPartition.
+   * @return True (on all ranks) if the cache was valid.
+   */
+  bool readPartitionCache(const std::string &filename, const PetscInt num_cells,
+                          std::vector<PetscInt> &sizes, std::vector<PetscInt> &points);
+
+  /**
+   * Write the partition of the distributed mesh which a later run can load with readPartitionCache.
+   * @param [in] filename Cache file.
+   * @param [in] num_cells Number of (serial) cells held by this rank before distribution.
+   * @param [in] migration The migration returned by distribute.
+   */
+  void writePartitionCache(const std::string &filename, const PetscInt num_cells, PetscSF migration);
+
+  /**
+   * Read the mesh file, either an exodus file (serially, onto the first rank) or a DMPlex HDF5 file ending in
+   * .h5 (in parallel, a chunk of cells per rank).
+   * @return The mesh, not yet distributed.
+   */
+  DM load();
+
  protected:
 
   /** < List of field names on global dof ("u","v",etc) */
@@ -56,9 +184,6 @@ class Mesh {
   /** < Holds information used to dump field values to disk. */
   PetscViewer mViewer;
 
-  /** The CFL constant for the time-stepping scheme (Newmark 2nd-order sets 1.0)*/
-  double mCFL = 1.0;
-
   std::map<PetscInt, std::string> mBoundaryIds;
   /** < mapping between boundary id
                                                        and its associated name (e.g.,
@@ -101,14 +226,60 @@ class Mesh {
    */
   void read(int dim, int numCells, int numVerts, int numVertsPerElem,
             int* cells, double* vertex_coords);
+
+  /**
+   * Builds a structured box mesh in memory (i.e. for scaling runs, of any size without a mesh file), instead of
+   * reading one. The box spans [0, BoxExtent] with BoxElements quads or hexahedra per dimension, each of which
+   * is split into 2 triangles or 6 tetrahedra with BoxSimplex. With BoxPerturbation, the interior vertices are
+   * moved by a random fraction (up to the perturbation) of the element size along each axis, so that the
+   * elements are no longer affine; the faces of the box stay flat. The mesh has no side sets, and is meant to be
+   * paired with a homogeneous model (see ExodusModel::setHomogeneous).
+   * @param [in] options The options class (--box-elements, --box-extent, --box-simplex, --box-perturbation,
+   * --box-seed).
+   */
+  void readBox(unique_ptr<Options> const &options);
   
   /**
-   * Reads an exodus mesh from a file defined in options.
+   * Reads an exodus mesh from a file defined in options (or a DMPlex HDF5 mesh, in parallel; see save).
    * By the time this method is finished, the mesh has been
-   * read, and parallelized across processors (via a call to Chaco).
+   * read, and parallelized across processors (via the PETSc partitioner, e.g. -petscpartitioner_type).
    * @param [in] options The master options struct. TODO: Move the gobbling of options to the constructor.
+   * @param [in] loaded Called once the mesh file is read and closed, before the mesh is distributed (i.e. to
+   * start work which overlaps the distribution, see Simulation::Simulation).
+   */
+  void read(const std::function<void()> &loaded = nullptr);
+
+  /**
+   * Reads an exodus mesh from a file defined in options, as read(). With --weighted-partitioning, the cells are
+   * distributed such that each rank receives about the same estimated cost rather than the same number of cells.
+   * The cost of a cell is taken from its physics (see Options::ElementCosts), and raised for cells coupling to a
+   * different physics. The cells are split by recursive coordinate bisection of the weighted cell centers, which
+   * keeps partitions compact and hence their interfaces (communication volume) small.
+   * @param [in] model The (already read) model, used to tell the physics of each cell.
+   * @param [in] options The options class.
+   */
+  void read(unique_ptr<ExodusModel> const &model, unique_ptr<Options> const &options);
+
+  /**
+   * Write the distributed mesh, with its labels (e.g. side sets), to a DMPlex HDF5 file. Passing this file
+   * (ending in .h5) as --mesh-file to later runs reads the mesh in parallel, instead of building the whole
+   * exodus mesh on the first rank.
+   * @param [in] filename HDF5 file name.
    */
-  void read();
+  void save(const std::string &filename);
+
+  /**
+   * Partition the cells by measured cost, and write the partition for a later setup to load as its partition
+   * cache (collective). The cells are bisected as with --weighted-partitioning, with the measured cost of each
+   * cell (see Problem::ElementCosts) for its weight.
+   * @param [in] filename Cache file (see readPartitionCache).
+   * @param [in] costs Measured cost of each local element.
+   * @return False (on all ranks) if the mesh was not read from an exodus file, whose cells the cache refers to.
+   */
+  bool writeBalancedPartition(const std::string &filename, const std::vector<PetscReal> &costs);
+
+  /** True if a mesh file is a DMPlex HDF5 file (by its .h5 extension), which is read in parallel. */
+  static bool isParallelMeshFile(const std::string &filename);
 
   /**
    * Generate coupling and boundary layers.
@@ -120,6 +291,12 @@ class Mesh {
   void setupTopology(unique_ptr<ExodusModel> const &model,
                      unique_ptr<Options> const &options);
 
+  /**
+   * Check that all elements, on all ranks, are of the same shape (collective). Called by setupTopology.
+   * @throws std::runtime_error If the mesh mixes shapes (i.e. quads and triangles).
+   */
+  void checkSingleShape() const;
+
   /**
    * Sets up the dofs across elements and processor boundaries.
    * Specifically, this function defines a `DMPlex section` spread across all elements. It is this section that
@@ -136,12 +313,19 @@ class Mesh {
                       unique_ptr<Options> const &options);
 
   /**
-   * Determines which type of mesh we are working with (tri/tet/quad/hex). For now, only supports
-   * single element types.
+   * Determines which type of mesh we are working with (tri/tet/quad/hex). Only meshes of a single element
+   * shape are supported (see setupTopology).
    * @return Element type ("tri","tet","quad","hex").
    */
   std::string baseElementType();
 
+  /**
+   * Shape of an element of the mesh's dimension.
+   * @param [in] num_vtx Number of vertices of the element.
+   * @return Element type ("tri","tet","quad","hex").
+   */
+  std::string ElementShape(const PetscInt num_vtx) const;
+
   /**
    * Number of elements owned by the current processors.
    * @ return Num of Elements.
@@ -183,6 +367,7 @@ class Mesh {
    */
   int readBoundaryNames(std::unique_ptr<Options> const &options);
 
+  /** The element across a face of an element (reads the faces extracted once the mesh is distributed). */
   PetscInt GetNeighbouringElement(const PetscInt interface, const PetscInt this_elm) const;
 
   /**
@@ -190,6 +375,62 @@ class Mesh {
    */
   Eigen::MatrixXd getElementCoordinateClosure(PetscInt elem_num);
 
+  /**
+   * Vertex coordinates of a local element (one vertex per row), as extracted for all elements when the mesh
+   * was distributed. Element setup reads these instead of querying the coordinate section again.
+   * @param [in] elem_num Local element number.
+   */
+  inline Eigen::Map<const Eigen::Matrix<PetscReal, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>
+  ElementVertexCoordinates(const PetscInt elem_num) const {
+    return Eigen::Map<const Eigen::Matrix<PetscReal, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>(
+        mElmVtx.data() + mElmVtxOff[elem_num], (mElmVtxOff[elem_num + 1] - mElmVtxOff[elem_num]) / mNumDim,
+        mNumDim);
+  }
+
+  /**
+   * Transitive closure of a local element, as extracted for all elements when the mesh was distributed.
+   * @param [in] elm Local element number.
+   * @param [out] num_pts Number of points in the closure.
+   * @returns The points of the closure and their orientations, interleaved (as from DMPlexGetTransitiveClosure).
+   */
+  inline const PetscInt *ElementClosure(const PetscInt elm, PetscInt &num_pts) const {
+    num_pts = (mElmClsOff[elm + 1] - mElmClsOff[elm]) / 2;
+    return mElmCls.data() + mElmClsOff[elm];
+  }
+
+  /** Centers of all local elements (one row per element). */
+  inline const Eigen::MatrixXd &ElementCenters() const { return mElmCtr; }
+
+  /**
+   * Index of the exodus model element which a local element was read from, so that its parameters can be
+   * looked up directly instead of through a spatial search. Only known for meshes read from an exodus file.
+   * @param [in] elem_num Local element number.
+   * @return Model element index, or -1 if not known.
+   */
+  inline PetscInt ModelElement(const PetscInt elem_num) const {
+    return mElmModelIdx.empty() ? -1 : mElmModelIdx[elem_num];
+  }
+  inline const std::vector<PetscInt> &ModelElements() const { return mElmModelIdx; }
+
+  /**
+   * Whether a local element is this rank's own, rather than one of the overlapping cells of another rank
+   * (--halo-overlap), which are only held to be stepped redundantly.
+   * @param [in] elem_num Local element number.
+   */
+  inline bool ElementOwned(const PetscInt elem_num) const {
+    return mElmGlbNum.empty() || mElmGlbNum[elem_num] >= 0;
+  }
+
+  /**
+   * Number of a local element across all ranks, the same on all ranks holding it.
+   * @param [in] elem_num Local element number.
+   * @return Global element number, or -1 if not known (without overlapping cells).
+   */
+  inline PetscInt ElementGlobalNumber(const PetscInt elem_num) const {
+    if (mElmGlbNum.empty()) { return -1; }
+    return mElmGlbNum[elem_num] >= 0 ? mElmGlbNum[elem_num] : -(mElmGlbNum[elem_num] + 1);
+  }
+
   static PetscInt numFieldPerPhysics(std::string physics);
 
   inline std::vector<std::string> ElementFields(const PetscInt num) {
@@ -203,17 +444,114 @@ class Mesh {
 
   inline std::set<std::tuple<PetscInt,PetscInt>> BoundaryPoints() { return mBndPts; }
 
+  /**
+   * Whether a mesh point lies on (the closure of) a side set. Only valid after setupTopology.
+   * @param [in] point DMPlex point.
+   * @param [in] side_set Index of the side set in the "Face Sets" label. Side sets without any face on this
+   * partition hold no points.
+   */
+  inline bool OnSideSet(const PetscInt point, const PetscInt side_set) const {
+    return side_set < mSideSetPts.size() && mSideSetPts[side_set][point - mChartStart];
+  }
+
+  /**
+   * Closure entities of an element which lie on any side set, computed in setupTopology. Each entry is
+   * the depth (0: vertex, 1: edge, 2: face) and the index among the element's closure points of that
+   * depth, i.e. what getDofsOnVtx/Edge/Face expect.
+   * @param [in] elm Local element number.
+   */
+  inline const std::vector<std::tuple<PetscInt,PetscInt>> &BoundaryEntities(const PetscInt elm) const {
+    return mElmBndEntities[elm];
+  }
+
+  /**
+   * Faces (edges in 2D) of an element on the side sets given by --absorbing-boundaries, computed in
+   * setupTopology. Each is the index of the face in the element's cone, i.e. what getDofsOnFace (getDofsOnEdge
+   * in 2D) expect. Such faces carry "boundary_absorbing" in their fields, so the element is built with an
+   * absorbing boundary (see Absorbing).
+   * @param [in] elm Local element number.
+   */
+  inline const std::vector<PetscInt> &AbsorbingFaces(const PetscInt elm) const { return mElmAbsFaces[elm]; }
+
+  /**
+   * Those of the absorbing faces of an element (see AbsorbingFaces) which lie on the side sets given by
+   * --injection-boundaries, and inject the wavefield of the injection file (see Injection).
+   * @param [in] elm Local element number.
+   */
+  inline const std::vector<PetscInt> &InjectionFaces(const PetscInt elm) const { return mElmInjFaces[elm]; }
+
+  /**
+   * Local DMPlex points on the side sets given by --absorbing-boundaries (the closures of their faces), as
+   * labeled in setupTopology.
+   */
+  std::vector<PetscInt> AbsorbingPoints() const;
+
+  /**
+   * Local DMPlex points on the side sets given by --homogeneous-dirichlet (the closures of their faces), as
+   * labeled in setupTopology. A point owned by this partition may only lie on such a face of another one (see
+   * Problem::initializeBoundaryDofs).
+   */
+  std::vector<PetscInt> HomogeneousDirichletPoints() const;
+
+  /**
+   * Side sets of each pair of --periodic-boundaries (master, then slave), as indices for OnSideSet, computed in
+   * setupTopology. A side set without any face on this partition is -1.
+   */
+  inline const std::vector<std::pair<PetscInt, PetscInt>> &PeriodicSideSets() const { return mPeriodicSideSets; }
+
+  /**
+   * Order in which the local elements should be created and processed, computed in setupTopology. With
+   * --reorder-elements, elements follow a Hilbert curve through their centers, and setupGlobalDof lays out the
+   * dofs in the same order.
+   */
+  inline const std::vector<PetscInt> &ElementOrder() const { return mElmOrder; }
+
+  /**
+   * Concrete element type of a local element, from its shape, physics and coupling (see Element::TypeCode),
+   * computed in setupTopology. The elements are built from it, without comparing their fields again.
+   * @return The type code, or -1 if no element is built for it.
+   */
+  inline PetscInt ElementTypeCode(const PetscInt elm) const { return mElmTypeCode[elm]; }
+
+  /**
+   * Lowest polynomial order with which an element has (at least) the requested number of GLL points per
+   * wavelength, i.e. order * wavelength / size >= points_per_wavelength.
+   * @param [in] size Element size (largest extent).
+   * @param [in] wave_speed Slowest wave speed in the element.
+   * @param [in] max_frequency Highest frequency to resolve.
+   * @param [in] points_per_wavelength Number of GLL points per minimum wavelength.
+   */
+  static PetscInt resolvingPolynomialOrder(const PetscReal size, const PetscReal wave_speed,
+                                           const PetscReal max_frequency, const PetscReal points_per_wavelength);
+
+  /**
+   * Keys ordering points along a Hilbert curve through their bounding box.
+   * @param [in] pts Points (one per row).
+   * @return Key of each point.
+   */
+  static std::vector<unsigned long long> hilbertKeys(const Eigen::Ref<const Eigen::MatrixXd> &pts);
+
   inline int NumberSideSets() { return mNumberSideSets; }
   inline int NumberDimensions() { return mNumDim; }
+  /** Number of field components interleaved at each dof (1, unless --interleaved-components). */
+  inline PetscInt NumberComponents() const { return mNumComponents; }
 
-  inline std::map<std::string, std::map<int, std::vector<int>>>
-  BoundaryElementFaces() { return mBoundaryElementFaces; }
+  inline const std::map<std::string, std::map<int, std::vector<int>>> &
+  BoundaryElementFaces() const { return mBoundaryElementFaces; }
   std::set<std::string> AllFields() const { return mMeshFields; }
 
-  std::vector<std::tuple<PetscInt,std::vector<std::string>>> CouplingFields(const PetscInt elm);
-  std::vector<std::string> TotalCouplingFields(const PetscInt elm);
-  std::vector<PetscInt> EdgeNumbers(const PetscInt elm);
+  /** Bytes of the element and boundary data held by the mesh on this rank (without the PETSc objects). */
+  size_t MemoryBytes() const;
+  /**
+   * Estimated bytes of the distributed DMPlex and its section on this rank: the cones (with their orientations)
+   * and supports of all points, the coordinates, and the offsets and dofs of every point and field.
+   */
+  size_t PetscBytes() const;
+
+  /* CouplingFields, TotalCouplingFields and EdgeNumbers only read what was extracted before, so they may be
+   * called concurrently. */
+  std::vector<std::tuple<PetscInt,std::vector<std::string>>> CouplingFields(const PetscInt elm) const;
+  std::vector<std::string> TotalCouplingFields(const PetscInt elm) const;
+  std::vector<PetscInt> EdgeNumbers(const PetscInt elm) const;
 
-  inline double CFL() { return mCFL; }
-  
 };
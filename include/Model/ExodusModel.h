@@ -4,15 +4,19 @@
 #include <vector>
 #include <assert.h>
 #include <memory>
+#include <map>
+#include <unordered_map>
 
 // 3rd party.
 #include <mpi.h>
 #include <petsc.h>
 #include <Eigen/Dense>
 #include <Utilities/Types.h>
+#include <Utilities/StaticKdTree.h>
+#include <Utilities/SharedArray.h>
+#include <Model/MaterialCache.h>
 
 extern "C" {
-#include "Utilities/kdtree.h"
 #include "exodusII.h"
 };
 
@@ -46,18 +50,18 @@ class ExodusModel {
 
   /* Functionality for multiple blocks. */
   std::vector<PetscInt> mElementBlockIds;
-  std::vector<PetscInt> mElementConnectivity;
+  SharedArray<PetscInt> mElementConnectivity;
   std::vector<PetscInt> mVerticesPerElementPerBlock;
 
   /* kDtree based on either element centres, or vertices. */
-  kdtree *mNodalKdTree;
-  kdtree *mElementalKdTree;
-  std::vector<PetscInt> mNodalKdTreeData;
-  std::vector<PetscInt> mElementalKdTreeData;
+  StaticKdTree mNodalKdTree;
+  StaticKdTree mElementalKdTree;
 
   /* Vector to hold variables on each element. */
   std::vector<std::string> mElementalVariableNames;
-  std::vector<PetscReal> mElementalVariables;
+  SharedArray<PetscReal> mElementalVariables;
+  /* Column of each elemental variable (by name) in mElementalVariables. */
+  std::unordered_map<std::string,PetscInt> mElementalVariableIndex;
 
   /* Vector to hold variables defined only at nodes. */
   std::vector<PetscReal> mNodalVariables;
@@ -71,13 +75,43 @@ class ExodusModel {
   std::vector<std::string> mInfo;
 
   /* Nodal locations. */
-  std::vector<PetscReal> mNodalX;
-  std::vector<PetscReal> mNodalY;
-  std::vector<PetscReal> mNodalZ;
+  SharedArray<PetscReal> mNodalX;
+  SharedArray<PetscReal> mNodalY;
+  SharedArray<PetscReal> mNodalZ;
 
   /* Side sets define edge boundary conditions. */
   std::vector<std::string> mSideSetNames;
 
+  /* With --distribute-model, only the first rank reads (and keeps) the full model, until localize(). */
+  bool mDistributed;
+  /* With --node-shared-model, the ranks of a node share one copy of the model. */
+  bool mNodeShared;
+  /* True once the model only holds the elements of this rank. */
+  bool mLocalized;
+  /* Slot of each model element held by a localized model (if localized by element index). */
+  std::unordered_map<PetscInt,PetscInt> mLocalSlot;
+  /* Model element held in each slot of a localized model (if localized by element index). */
+  std::vector<PetscInt> mLocalElements;
+
+  /* Material at the integration points written by an earlier run, the model hash and the number of model
+   * elements it is checked against. */
+  std::string mMaterialCacheFile;
+  MaterialCache mMaterialCache;
+  unsigned long long mModelHash;
+  PetscInt mNumberModelElements;
+
+  /* Further realizations of the material on the same elements (see addMember). */
+  std::vector<std::unique_ptr<ExodusModel>> mMembers;
+
+  /** Storage slot of a model element (its index, unless the model was localized). */
+  PetscInt elementSlot(const PetscInt elem_num) const;
+  /** Parameter, and physics, of the element stored in a slot. */
+  PetscScalar elementalParameter(const PetscInt spatial_index, std::string parameter_name,
+                                 const PetscInt vertex_num) const;
+  std::string elementType(const PetscInt spatial_index) const;
+  /** Column of a parameter at a vertex, falling back between VP and VPV (with a warning if requested). */
+  PetscInt elementalColumn(std::string parameter_name, const PetscInt vertex_num, const bool warn) const;
+
   /** Read (dimension specific) coordinate values. */
   void readCoordinates();
   /** Read mesh connectivity. */
@@ -125,11 +159,84 @@ class ExodusModel {
    */
   void read();
 
+  /**
+   * First part of read: parse the file, on rank 0 only (nothing is done on the other ranks). No MPI calls are
+   * made, so that it may run on a thread of its own while the main thread communicates.
+   */
+  void readFile();
+
+  /** Second part of read: broadcast what readFile parsed, and build the kd-trees (collective). */
+  void broadcastFile();
+
+  /**
+   * Instead of reading a file, hold a homogeneous model (i.e. for a synthetic box mesh, see Mesh::readBox). Every
+   * query returns the same material, which is given by VP, VS and RHO; the parameters of the other
+   * parameterizations (VPV, VPH, VSV, VSH, ETA, and C11, C13, C33, C55) are those of the same isotropic medium.
+   * Called on all ranks; the model holds no side sets.
+   * @param [in] dim Dimension.
+   * @param [in] physics "fluid" or "elastic".
+   * @param [in] material Parameters overriding the defaults (VP = 1, VS = 0.5, RHO = 1). Parameters which are
+   * not derived from these (i.e. C13) may be set as well.
+   */
+  void setHomogeneous(const PetscInt dim, const std::string &physics,
+                      const std::map<std::string,PetscReal> &material);
+
+  /**
+   * Keep only the elemental parameters of the elements of this rank. The first rank looks up the elements
+   * closest to every rank's element centers, and sends each rank the parameters of its own elements, so that
+   * the memory per rank no longer scales with the global model. Afterwards, elemental queries are only valid
+   * for these elements, and the model can no longer be written.
+   * @param [in] centers Centers of the local elements (one row per element), i.e. Mesh::ElementCenters().
+   * @param [in] elements Model element of each local element, if known (i.e. Mesh::ModelElements()). These
+   * are used instead of the closest element centers, and can still be queried by index afterwards.
+   */
+  void localize(const Eigen::Ref<const Eigen::MatrixXd> &centers,
+                const std::vector<PetscInt> &elements = std::vector<PetscInt>());
+
+  /**
+   * Read another realization of the material on the elements of this model (collective), as the next member of
+   * an ensemble (see --ensemble-model-files). It is read and distributed as this model is, without a material
+   * cache, and localized along with this model, so it must be added before localize.
+   * @param [in] filename Exodus file of the member.
+   * @throws std::runtime_error If the member does not hold as many elements (of the same dimension) as this model.
+   */
+  void addMember(const std::string &filename);
+  /** Number of members of the ensemble, this model being the first. */
+  PetscInt NumMembers() const { return mMembers.size() + 1; }
+  /** Member m > 0 of the ensemble. */
+  std::unique_ptr<ExodusModel> const &Member(const PetscInt m) const { return mMembers[m - 1]; }
+
+  /**
+   * Add a nodal variable (or replace one of the same name), to be written by write (collective). Each rank gives
+   * values at some points, which go to the closest vertex of the model, and are averaged there. Vertices without
+   * a value are zero.
+   * @param [in] name Name of the variable.
+   * @param [in] points Points of this rank (dim per point), i.e. element vertices.
+   * @param [in] values Value at each point.
+   */
+  void addNodalVariable(const std::string &name, const std::vector<PetscReal> &points,
+                        const std::vector<PetscReal> &values);
+
   /**
    * Writes out mesh on rank 0, including all necessary model quantities (parameters, etc.).
    */
   void write(const std::string filename);
 
+  /**
+   * Writes the elemental variables to an HDF5 file (collective). Each rank writes its own rows: the elements
+   * it holds if the model is localized, or else an even share of the (replicated) model elements, so that the
+   * output of a distributed model no longer goes through a single rank. The file holds the dataset
+   * /model_element (exodus index of each row, -1 where unknown), one dataset /elemental/<name> per elemental
+   * variable, and one dataset /fields/<name> per additional field.
+   * @param [in] filename HDF5 file.
+   * @param [in] fields Additional per-element fields (i.e. gradients), one value per element held by this rank
+   * (in the order of localize(), or all model elements if the model is not localized). All ranks pass the same
+   * field names.
+   */
+  void writeHdf5(const std::string filename,
+                 const std::map<std::string,std::vector<PetscReal>> &fields =
+                 std::map<std::string,std::vector<PetscReal>>());
+
   /**
    * Returns the closest parameter to a point (i.e. element node).
    * @param [in] point Point which to search for.
@@ -139,6 +246,11 @@ class ExodusModel {
   PetscReal getNodalParameterAtNode(const Eigen::Ref<const RealVec>& point,
                                     const std::string parameter_name);
 
+  /** Whether the model stores an elemental parameter (at its vertices), under exactly this base name. */
+  bool HasElementalParameter(const std::string &parameter_name) const {
+    return mElementalVariableIndex.count(parameter_name + "_0") > 0;
+  }
+
   /**
    * Returns a parameter at a specific vertex, following the ordering in the reference element. For example,
    * in a 2D quad, we have P_0, P_1, P_2, P_3. See the reference element ordering for further details.
@@ -151,11 +263,58 @@ class ExodusModel {
                                                     std::string parameter_name,
                                                     const PetscInt vertex_num) const;
 
+  /**
+   * Returns a parameter at a specific vertex of a model element, given by its index in the exodus file (i.e.
+   * Mesh::ModelElement), without a spatial search.
+   * @param [in] elem_num Index of the model element.
+   * @param [in] parameter_name The base parameter name.
+   * @param [in] vertex_num The vertex for which the parameter is desired.
+   * @return The value of the material parameter at the specified vertex.
+   */
+  PetscScalar getElementalMaterialParameterAtVertex(const PetscInt elem_num,
+                                                    std::string parameter_name,
+                                                    const PetscInt vertex_num) const;
+
+  /**
+   * Returns several parameters at all vertices of many elements at once. The parameter names are only
+   * resolved once, and the elements without a known model element are found in a single batched search.
+   * @param [in] centers Centers of the elements (one row per element).
+   * @param [in] elements Model element of each element (-1 if unknown), or empty to search for all of them.
+   * @param [in] parameter_names The base parameter names.
+   * @param [in] num_vtx Number of vertices per element.
+   * @param [out] values Parameters, element by element, vertex by vertex (num_elm x num_vtx x num_par).
+   */
+  void getElementalMaterialParameters(const Eigen::Ref<const Eigen::MatrixXd> &centers,
+                                      const std::vector<PetscInt> &elements,
+                                      const std::vector<std::string> &parameter_names,
+                                      const PetscInt num_vtx, std::vector<PetscReal> &values) const;
+
+  /**
+   * Returns a parameter at the integration points of a model element, as written by an earlier run with the
+   * same model and the same --material-cache-file.
+   * @param [in] elem_num Index of the model element.
+   * @param [in] parameter_name The base parameter name.
+   * @param [in] num_pnt Number of integration points of the element.
+   * @return num_pnt values, or NULL if they are not cached.
+   */
+  const PetscReal *CachedParameterAtIntPts(const PetscInt elem_num, const std::string &parameter_name,
+                                           const PetscInt num_pnt) const;
+  /** True if the material is cached for elements with this number of integration points. */
+  bool HasMaterialCache(const PetscInt num_pnt) const;
+  /**
+   * Write the material at the integration points of the local elements to the --material-cache-file
+   * (collective). See MaterialCache::write for the layout of the values.
+   */
+  void writeMaterialCache(const PetscInt num_pnt, const std::vector<PetscInt> &elements,
+                          const std::vector<std::string> &names, const std::vector<PetscReal> &values);
+
   /**
    * Returns a string specifying which type of material the element is.
    * I.e. will return "ACOUSTIC" for acoustic, "ELASTIC" for elastic.
    */
   std::string getElementType(const Eigen::VectorXd &elem_center);
+  /** Same as above, for a model element given by its index in the exodus file. */
+  std::string getElementType(const PetscInt elem_num);
 
   /**
    * Returns the a string specifying the side set name (x0, x1, ...).
@@ -164,6 +323,10 @@ class ExodusModel {
    */
   std::string SideSetName(const PetscInt side_set_num);
 
+  /** Bytes of the model arrays held by this rank, without the kd-trees (see SharedArray::Bytes). */
+  size_t MemoryBytes() const;
+  /** Bytes of the nodal and elemental kd-trees held by this rank. */
+  size_t KdTreeBytes() const { return mNodalKdTree.Bytes() + mElementalKdTree.Bytes(); }
 
 };
 
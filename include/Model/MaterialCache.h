@@ -0,0 +1,75 @@
+#pragma once
+
+// stl.
+#include <map>
+#include <string>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+
+/**
+ * Material parameters sampled at the integration points of the model elements, cached in a binary file.
+ *
+ * The parameters at the integration points only depend on the model, the mesh and the polynomial order, so one
+ * run writes them (write), and later runs map the file (open) instead of interpolating them again. The file
+ * holds a header, the parameter names, and one block of num_elm x num_pnt values per parameter, each aligned to
+ * a page. Elements are indexed by their exodus (model) index, so the file does not depend on the partition.
+ * Every rank maps the file read-only, and so only reads the pages holding its own elements.
+ */
+class MaterialCache {
+
+ public:
+
+  MaterialCache(): mMap(NULL), mMapSize(0), mNumElm(0), mNumPnt(0) {}
+  ~MaterialCache();
+
+  /**
+   * Map a cache file, if it exists and was written for this model (collective).
+   * @param [in] filename Cache file.
+   * @param [in] model_hash Hash of the model file (the same on all ranks).
+   * @param [in] num_elm Number of elements in the model.
+   * @return True (on all ranks) if the file was mapped.
+   */
+  bool open(const std::string &filename, const unsigned long long model_hash, const PetscInt num_elm);
+  /** Unmap the file (i.e. before it is written again). */
+  void close();
+
+  inline bool empty() const { return !mMap; }
+  /** Number of integration points per element the cache was written for. */
+  inline PetscInt NumPnt() const { return mNumPnt; }
+
+  /**
+   * Values of a parameter at the integration points of a model element.
+   * @param [in] elm Model element.
+   * @param [in] name Parameter name.
+   * @return NumPnt() values, or NULL if the parameter is not cached for this element.
+   */
+  const PetscReal *parameter(const PetscInt elm, const std::string &name) const;
+
+  /**
+   * Write a cache file (collective). Each rank contributes the elements it holds, and the file holds the
+   * union of the parameters of all ranks.
+   * @param [in] filename Cache file.
+   * @param [in] model_hash Hash of the model file.
+   * @param [in] num_elm Number of elements in the model.
+   * @param [in] num_pnt Number of integration points per element.
+   * @param [in] elements Model element of each element held by this rank.
+   * @param [in] names Parameters held by this rank.
+   * @param [in] values Parameters, element by element and parameter by parameter (elements x names x num_pnt),
+   * NaN where an element does not have a parameter.
+   */
+  static void write(const std::string &filename, const unsigned long long model_hash, const PetscInt num_elm,
+                    const PetscInt num_pnt, const std::vector<PetscInt> &elements,
+                    const std::vector<std::string> &names, const std::vector<PetscReal> &values);
+
+ private:
+
+  /// Mapped file, and the start of each parameter's block in it.
+  void *mMap;
+  size_t mMapSize;
+  std::map<std::string,const PetscReal*> mBlock;
+
+  PetscInt mNumElm, mNumPnt;
+
+};
@@ -0,0 +1,95 @@
+#pragma once
+
+// stl.
+#include <memory>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+#include <Eigen/Dense>
+#include <Utilities/FieldId.h>
+#include <Utilities/Memory.h>
+
+// forward decl.
+class Mesh;
+class Options;
+class ExodusModel;
+
+template <typename BasePhysics>
+class Absorbing: public BasePhysics {
+  /**
+   * \class Absorbing
+   *
+   * \brief First order absorbing boundary (Clayton-Engquist, or Stacey for elastic media) on the faces of an
+   * element which lie on the side sets given by --absorbing-boundaries.
+   *
+   * The outgoing waves are matched by a traction which only depends on the velocity on the face. For the
+   * scalar wave equation (with unit mass and stiffness vp^2) this is -vp v, and for elastic media
+   * -rho (vp (v.n) n + vs (v - (v.n) n)), with the isotropic wave speeds of the element. The boundary term is
+   * added to the surface integral with the velocity of the previous step, as the velocity of this one is not
+   * known yet in the explicit scheme.
+   *
+   * The faces are planar (as in the face integrals of the shapes). Their dofs, outward normals, and weights (the
+   * quadrature weights times the face Jacobian, times the impedances) are computed once, when the material is
+   * attached, so that a step only loops over the dofs of the absorbing faces. A dof on several absorbing faces
+   * (i.e. in a corner) is listed once per face.
+   *
+   * The faces on the side sets given by --injection-boundaries also inject an incident wavefield (see
+   * Injection), so that the traction of the face is t_inc - Z (v - v_inc): the incident waves pass into the
+   * element, and only the scattered ones are absorbed.
+   *
+   * Supported for Scalar, Elastic2D and Elastic3D on tensor elements (quads and hexes), which are told apart by
+   * the number of fields of BasePhysics.
+   */
+
+ private:
+
+  /// Local cone indices of the absorbing faces (see Mesh::AbsorbingFaces), and their face argument of
+  /// applyTestAndIntegrateEdge (the mesh edge in 2D, the cone index in 3D).
+  std::vector<PetscInt> mFaces, mFaceArgs;
+
+  /// Per absorbing face dof: its element dof, outward normal (one row each), and the weight of the normal and
+  /// tangential velocity (the same for scalar physics).
+  std::vector<PetscInt> mAbsDofs;
+  Eigen::MatrixXd mAbsNormals;
+  Eigen::VectorXd mAbsWgtP, mAbsWgtS;
+
+  /// Injecting faces (a subset of mFaces), and per injecting face dof: its entry in the absorbing dofs, its row
+  /// of the injection file, and its weight in the face integral (without the impedance).
+  std::vector<PetscInt> mInjFaces, mInjAbs, mInjRows;
+  Eigen::VectorXd mInjWgt;
+
+ public:
+
+  /**** Initializers ****/
+  Absorbing<BasePhysics>(std::unique_ptr<Options> const &options);
+
+  /** Remember the absorbing (and injecting) faces of the element (after the vertex coordinates are attached). */
+  void setBoundaryConditions(std::unique_ptr<Mesh> const &mesh);
+
+  /**
+   * Attach the material of BasePhysics, then precompute the weights of the absorbing faces, and look up the
+   * points of the injecting ones in the injection file.
+   */
+  void attachMaterialProperties(std::unique_ptr<ExodusModel> const &model);
+
+  /** The fields of BasePhysics, followed by their velocities. */
+  const std::vector<FieldId> &PullElementalFields() const;
+
+  /**
+   * Surface integral of BasePhysics, plus the traction of the absorbing faces (with the incident wavefield of
+   * the injecting ones), added in place to the view returned by BasePhysics (see Scratch).
+   * @param [in] u Pulled fields, with the velocities in the last columns.
+   */
+  Eigen::Map<Eigen::MatrixXd> computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd>& u);
+
+  /** Heap bytes held by the element (see Element::MemoryBytes). */
+  size_t MemoryBytes() const {
+    return BasePhysics::MemoryBytes() + Memory::bytes(mFaces) + Memory::bytes(mFaceArgs) + Memory::bytes(mAbsDofs) +
+        Memory::bytes(mAbsNormals) + Memory::bytes(mAbsWgtP) + Memory::bytes(mAbsWgtS) + Memory::bytes(mInjFaces) +
+        Memory::bytes(mInjAbs) + Memory::bytes(mInjRows) + Memory::bytes(mInjWgt);
+  }
+
+  const static std::string Name() { return "Absorbing_" + BasePhysics::Name(); }
+
+};
@@ -7,6 +7,9 @@
 // 3rd party.
 #include <petsc.h>
 #include <Eigen/Dense>
+#include <Utilities/FieldId.h>
+#include <Utilities/Memory.h>
+#include <Physics/FaceOperator.h>
 
 class Mesh;
 class Options;
@@ -18,9 +21,12 @@ class AcousticToElastic2D: public BasePhysics {
  private:
 
   std::vector<double> mRho_0;
-  std::vector<PetscInt> mEdg, mNbr;
+  std::vector<PetscInt> mEdg, mNbr, mNbrModElm;
   std::vector<Eigen::Vector2d> mNbrCtr;
 
+  /// Integrals over the coupled edges, scaled by the density of the fluid.
+  FaceOperator mCpl;
+
  public:
 
   /**** Initializers ****/
@@ -28,8 +34,14 @@ class AcousticToElastic2D: public BasePhysics {
   void setBoundaryConditions(std::unique_ptr<Mesh> const &mesh);
 
   void attachMaterialProperties(std::unique_ptr<ExodusModel> const &model);
-  std::vector<std::string> PullElementalFields() const;
-  Eigen::MatrixXd computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd>& u);
+  const std::vector<FieldId> &PullElementalFields() const;
+  Eigen::Map<Eigen::MatrixXd> computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd>& u);
+
+  /** Heap bytes held by the element (see Element::MemoryBytes). */
+  size_t MemoryBytes() const {
+    return BasePhysics::MemoryBytes() + Memory::bytes(mRho_0) + Memory::bytes(mEdg) + Memory::bytes(mNbr) +
+        Memory::bytes(mNbrModElm) + Memory::bytes(mNbrCtr) + mCpl.MemoryBytes();
+  }
 
   const static std::string Name() { return "FluidToSolid2D_" + BasePhysics::Name(); }
 
@@ -0,0 +1,57 @@
+#pragma once
+
+// std.
+#include <iostream>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+#include <Eigen/Dense>
+#include <Utilities/FieldId.h>
+#include <Utilities/Memory.h>
+#include <Physics/FaceOperator.h>
+
+// forward decl.
+class Mesh;
+class Options;
+class ExodusModel;
+
+/**
+ * \class AcousticToElastic3D
+ *
+ * \brief Solid hexahedra with faces on a fluid, which take the pressure of the fluid as a traction along the
+ * normal of those faces. With this, the water column of a marine model is a scalar field (see
+ * ElasticToAcoustic3D) rather than an elastic solid with vs = 0.
+ */
+template <typename BasePhysics>
+class AcousticToElastic3D: public BasePhysics {
+
+ private:
+
+  std::vector<double> mRho_0;
+  /// Coupled faces (their index in the element's cone, see Mesh::EdgeNumbers), and the fluid element across.
+  std::vector<PetscInt> mFace, mNbr, mNbrModElm;
+  std::vector<Eigen::Vector3d> mNbrCtr;
+
+  /// Integrals over the coupled faces, with their normals, scaled by the density of the fluid.
+  FaceOperator mCpl;
+
+ public:
+
+  /**** Initializers ****/
+  AcousticToElastic3D<BasePhysics>(std::unique_ptr<Options> const &options);
+  void setBoundaryConditions(std::unique_ptr<Mesh> const &mesh);
+
+  void attachMaterialProperties(std::unique_ptr<ExodusModel> const &model);
+  const std::vector<FieldId> &PullElementalFields() const;
+  Eigen::Map<Eigen::MatrixXd> computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd>& u);
+
+  /** Heap bytes held by the element (see Element::MemoryBytes). */
+  size_t MemoryBytes() const {
+    return BasePhysics::MemoryBytes() + Memory::bytes(mRho_0) + Memory::bytes(mFace) + Memory::bytes(mNbr) +
+        Memory::bytes(mNbrModElm) + Memory::bytes(mNbrCtr) + mCpl.MemoryBytes();
+  }
+
+  const static std::string Name() { return "FluidToSolid3D_" + BasePhysics::Name(); }
+
+};
@@ -0,0 +1,109 @@
+#pragma once
+
+// stl.
+#include <memory>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+#include <Eigen/Dense>
+#include <Utilities/FieldId.h>
+#include <Utilities/Memory.h>
+
+// forward decl.
+class Options;
+class ExodusModel;
+
+template <typename BasePhysics>
+class Attenuating: public BasePhysics {
+  /**
+   * \class Attenuating
+   *
+   * \brief Viscoelastic attenuation with coarse grained memory variables (after van Driel & Nissen-Meyer, 2014).
+   *
+   * The moduli relax as a generalized Maxwell body, M(w) = M_u (1 - sum_l y_l / (1 + i w tau_l)), with one
+   * standard linear solid per mechanism l. The relaxation times tau_l are spread logarithmically over
+   * --attenuation-band, and the weights y_l are fitted (non-negative, least squares) so that 1/Q is constant
+   * over the band, for a unit Q. They scale with 1/Q of each point, from QKAPPA (the bulk modulus, and the
+   * modulus of the scalar equation) and QMU (the shear modulus) of the model. The model's velocities are
+   * taken at the geometric center of the band, from which the unrelaxed moduli follow.
+   *
+   * Instead of all mechanisms at every GLL point, each point only carries one: the points take turns in a
+   * 2 x 2 (x 2) pattern over the tensor basis, with 2^dim mechanisms, each with dim times its weight. Only
+   * one set of memory variables is held per point (one per gradient component for the scalar equation; the
+   * trace and the deviatoric strain for elastic media), and the stiffness term costs a few more operations
+   * per point than the elastic one.
+   *
+   * The memory variables zeta relax towards y eps, and are advanced once per call of computeStiffnessTerm
+   * (i.e. once per step, see SetTimeStep) with the exact exponential over a step of constant strain. The
+   * stress of a step is taken with the memory variables of the previous step, so the scheme is explicit
+   * (first order in the memory variables). Local time stepping and simultaneous shots are not supported.
+   *
+   * Supported for Scalar (quads and hexes) and isotropic Elastic3D (hexes), which are told apart by the number
+   * of fields of BasePhysics.
+   */
+
+ private:
+
+  /// Number of mechanisms (2^dim), and the mechanism of each point.
+  PetscInt mNumMech;
+  std::vector<PetscInt> mMech;
+
+  /// Per mechanism: relaxation time, weight for a unit Q, and decay over one time step.
+  Eigen::VectorXd mTau, mUnitWgt, mDecay;
+
+  /// Per point: unrelaxed bulk (or scalar) and shear modulus, and the coarse grained weights of each.
+  Eigen::ArrayXd mKappa, mMu, mWgtKappa, mWgtMu;
+
+  /// Memory variables, one row per point: the gradient (scalar), or the trace and the deviatoric strain
+  /// (xx, yy, zz, yz, xz, xy) for elastic media.
+  Eigen::MatrixXd mMem;
+
+  /// Largest ratio of the unrelaxed to the reference moduli (which speeds up the waves).
+  PetscReal mMaxStiffening;
+
+ public:
+
+  /**** Initializers ****/
+  Attenuating<BasePhysics>(std::unique_ptr<Options> const &options);
+
+  /** Attach the material of BasePhysics, then the quality factors and unrelaxed moduli. */
+  void attachMaterialProperties(std::unique_ptr<ExodusModel> const &model);
+
+  /** Time step over which the memory variables advance per call of computeStiffnessTerm. */
+  void SetTimeStep(const PetscReal dt);
+
+  /** Remove the sources and receivers, and start the memory variables from rest (for the next shot). */
+  void detachSourcesAndReceivers() { mMem.setZero(); BasePhysics::detachSourcesAndReceivers(); }
+
+  /** Stable time step of BasePhysics, for the (faster) unrelaxed moduli. */
+  double CFL_estimate();
+
+  /**
+   * Stiffness term with the relaxed stress, advancing the memory variables by one step.
+   * @param [in] u Pulled fields.
+   * @returns A view into the thread's scratch arena (see Scratch).
+   */
+  Eigen::Map<Eigen::MatrixXd> computeStiffnessTerm(const Eigen::Ref<const Eigen::MatrixXd>& u);
+
+  /**
+   * Relaxation times and unit Q weights of mechanisms over a frequency band (see above).
+   * @param [in] f_min Lowest frequency of the band.
+   * @param [in] f_max Highest frequency of the band.
+   * @param [in] num_mech Number of mechanisms.
+   * @param [out] tau Relaxation times.
+   * @param [out] wgt Weights (non-negative).
+   */
+  static void RelaxationMechanisms(const PetscReal f_min, const PetscReal f_max, const PetscInt num_mech,
+                                   Eigen::VectorXd &tau, Eigen::VectorXd &wgt);
+
+  /** Heap bytes held by the element (see Element::MemoryBytes). */
+  size_t MemoryBytes() const {
+    return BasePhysics::MemoryBytes() + Memory::bytes(mMech) + Memory::bytes(mTau) + Memory::bytes(mUnitWgt) +
+        Memory::bytes(mDecay) + Memory::bytes(mKappa) + Memory::bytes(mMu) + Memory::bytes(mWgtKappa) +
+        Memory::bytes(mWgtMu) + Memory::bytes(mMem);
+  }
+
+  const static std::string Name() { return "Attenuating_" + BasePhysics::Name(); }
+
+};
@@ -1,13 +1,18 @@
 #pragma once
 
 // stl.
+#include <memory>
 #include <vector>
 
 // 3rd party.
 #include <Eigen/Dense>
+#include <Utilities/FieldId.h>
+#include <Utilities/Memory.h>
 
 // forward decl.
 class Mesh;
+class Source;
+class Receiver;
 class Options;
 class ExodusModel;
 
@@ -21,35 +26,81 @@ class Elastic2D: public Shape {
    * This element expects to be templated on "Shape", which refers to a concrete element type.
    * Some examples might be "TensorQuad", or "Generic". Functionality from these derived classes
    * will be required in, for example, the stiffness routine (to calculate the strain).
+   *
+   * With --axisymmetric, x and y are the radius r and the axis z of a medium invariant under rotation about
+   * it (monopole motion only, u_phi = 0). The stress then has a hoop component, from the hoop strain u_r / r,
+   * with C_phi_phi = C11, C_z_phi = C13 and C_r_phi = C11 - 2 C55 (transverse isotropy about the axis).
    */
 
  private:
 
-  /**** Workspace vectors (allocated in the constructor). ****/
+  /**** Stiffness at the integration points (set in attachMaterialProperties). ****/
   Eigen::VectorXd mc11, mc12, mc13, mc22, mc23, mc33;
-  Eigen::MatrixXd mStiff;
-  Eigen::MatrixXd mStress;
-  Eigen::MatrixXd mStrain;
+
+  /// Forces of the attached sources, with a column (#int pnt x #dim, one component after the other) per source
+  /// component: the delta function or, for a moment tensor, its gradient contracted with the moment tensor,
+  /// integrated against the test functions. The source term of a step is this times the source time functions.
+  Eigen::MatrixXd mSrcMat;
+  Eigen::VectorXd mSrcStf;
 
  public:
 
   /**** Initializers ****/
   Elastic2D<Shape>(std::unique_ptr<Options> const &options);
-  std::vector<std::string> PullElementalFields() const;
-  std::vector<std::string> PushElementalFields() const;
+  const std::vector<FieldId> &PullElementalFields() const;
+  const std::vector<FieldId> &PushElementalFields() const;
 
   /**** Setup functions ****/
   void prepareStiffness() {};
   Eigen::MatrixXd assembleElementMassMatrix();
   void attachMaterialProperties(std::unique_ptr<ExodusModel> const &model);
-  double CFL_estimate() { return 1; }
+  /**
+   * Attach a source through the shape, and integrate its delta function against the test
+   * functions once, since the source does not move.
+   * @param [in] source The source.
+   * @param [in] finalize Whether to actually attach, or only test for the source.
+   * @return True if the source lies in this element.
+   */
+  bool attachSource(std::unique_ptr<Source> &source, const bool finalize);
+  /**
+   * Attach a receiver through the shape, and register the fields it records.
+   * @param [in] receiver The receiver.
+   * @param [in] finalize Whether to actually attach, or only test for the receiver.
+   * @return True if the receiver lies in this element.
+   */
+  bool attachReceiver(std::unique_ptr<Receiver> &receiver, const bool finalize);
+  /** Remove all sources and receivers, and their precomputed coefficients. */
+  void detachSourcesAndReceivers() {
+    mSrcMat.resize(0, 0); mSrcStf.resize(0); Shape::detachSourcesAndReceivers();
+  }
+  /**
+   * Estimate the largest stable time step on this element, from the element radius and the
+   * fastest wave speed at the integration points.
+   * @return The stable time step.
+   */
+  double CFL_estimate();
   
   /**** Time loop functions ****/
-  Eigen::MatrixXd computeStiffnessTerm(const Eigen::MatrixXd &u);
-  Eigen::MatrixXd computeSourceTerm(const double time, const PetscInt time_idx);
-  Eigen::MatrixXd computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd>& u);
-  Eigen::MatrixXd computeStress(const Eigen::Ref<const Eigen::MatrixXd>& strain);
-  void recordField(const Eigen::MatrixXd &u) {};
+  /* The stress, stiffness, source and surface terms are views into the thread's scratch arena (see Scratch). */
+  Eigen::Map<Eigen::MatrixXd> computeStiffnessTerm(const Eigen::Ref<const Eigen::MatrixXd>& u);
+  Eigen::Map<Eigen::MatrixXd> computeSourceTerm(const double time, const PetscInt time_idx);
+  Eigen::Map<Eigen::MatrixXd> computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd>& u);
+  /** Sensitivity kernels of the stiffness parameters, each term of the energy density with its parameter (see
+   * Element::computeKernels). */
+  std::vector<std::string> KernelNames() const { return {"C11", "C13", "C33", "C55"}; }
+  Eigen::MatrixXd computeKernels(const Eigen::Ref<const Eigen::MatrixXd>& u,
+                                 const Eigen::Ref<const Eigen::MatrixXd>& u_adj);
+  Eigen::Map<Eigen::MatrixXd> computeStress(const Eigen::Ref<const Eigen::MatrixXd>& strain);
+  /** Record the field at each receiver, through its precomputed interpolation weights, and the quantities of
+   * the gradient it records (see Receiver::GradientFields). The gradient is taken once for all receivers. */
+  void recordField(const Eigen::Ref<const Eigen::MatrixXd>& u);
+
+  /** Heap bytes held by the element (see Element::MemoryBytes). */
+  size_t MemoryBytes() const {
+    return Shape::MemoryBytes() + Memory::bytes(mc11) + Memory::bytes(mc12) + Memory::bytes(mc13) +
+        Memory::bytes(mc22) + Memory::bytes(mc23) + Memory::bytes(mc33) + Memory::bytes(mSrcMat) +
+        Memory::bytes(mSrcStf);
+  }
 
   /**** Test helpers ****/
   const static std::string Name() { return "Elastic2D_" + Shape::Name(); }
@@ -1,13 +1,20 @@
 #pragma once
 
 // stl.
+#include <array>
+#include <memory>
 #include <vector>
 
 // 3rd party.
 #include <Eigen/Dense>
+#include <Utilities/FieldId.h>
+#include <Utilities/Memory.h>
+#include <Utilities/Types.h>
 
 // forward decl.
 class Mesh;
+class Source;
+class Receiver;
 class Options;
 class ExodusModel;
 
@@ -24,27 +31,102 @@ class Elastic3D: public Shape {
    */
 
  private:
-  /**** Workspace vectors (allocated in the constructor). ****/
-  Eigen::ArrayXd mc11, mc12, mc13, mc22, mc23, mc33, mc44, mc55, mc66, mRho;
-//  Eigen::MatrixXd mStiff, mStress, mStrain;
+  /**** Material parameters at the integration points (set in attachMaterialProperties). ****/
+  /// The 21 Voigt coefficients (see VoigtIndex). Only those of the element's symmetry class are kept, the
+  /// others are empty.
+  std::array<Eigen::ArrayXd, 21> mC;
+  Eigen::ArrayXd mRho;
+
+  /// Symmetry class of the stiffness at all integration points of the element, which selects the stress kernel.
+  /// Isotropic elements only keep the Lame parameters.
+  ElasticSymmetry mSymmetry;
+  Eigen::ArrayXd mLambda, mMu;
+
+  /// Whether the material is constant within the element. All parameters then hold a single value, which the
+  /// stress kernel scales by.
+  bool mConstant;
+
+  /** A parameter at all integration points (a copy of it, unless it is constant). */
+  Eigen::ArrayXd atIntPts(const Eigen::ArrayXd &par) const {
+    return par.size() == 1 ? Eigen::ArrayXd::Constant(Shape::NumIntPnt(), par(0)) : par;
+  }
+
+  /// Forces of the attached sources, with a column (#int pnt x #dim, one component after the other) per source
+  /// component: the delta function or, for a moment tensor, its gradient contracted with the moment tensor,
+  /// integrated against the test functions. The source term of a step is this times the source time functions.
+  Eigen::MatrixXd mSrcMat;
+  Eigen::VectorXd mSrcStf;
 
  public:
 
   /**** Initializers ****/
   Elastic3D<Shape>(std::unique_ptr<Options> const &options);
-  std::vector<std::string> PullElementalFields() const;
-  std::vector<std::string> PushElementalFields() const;
+  const std::vector<FieldId> &PullElementalFields() const;
+  const std::vector<FieldId> &PushElementalFields() const;
 
   /**** Setup functions ****/
   Eigen::MatrixXd assembleElementMassMatrix();
   void attachMaterialProperties(std::unique_ptr<ExodusModel> const &model);
+  /** Attach a single parameter through the shape (i.e. for mixins which need further parameters). */
+  using Shape::attachMaterialProperties;
+  /**
+   * Attach a source through the shape, and integrate its delta function against the test
+   * functions once, since the source does not move.
+   * @param [in] source The source.
+   * @param [in] finalize Whether to actually attach, or only test for the source.
+   * @return True if the source lies in this element.
+   */
+  bool attachSource(std::unique_ptr<Source> &source, const bool finalize);
+  /**
+   * Attach a receiver through the shape, and register the fields it records.
+   * @param [in] receiver The receiver.
+   * @param [in] finalize Whether to actually attach, or only test for the receiver.
+   * @return True if the receiver lies in this element.
+   */
+  bool attachReceiver(std::unique_ptr<Receiver> &receiver, const bool finalize);
+  /** Remove all sources and receivers, and their precomputed coefficients. */
+  void detachSourcesAndReceivers() {
+    mSrcMat.resize(0, 0); mSrcStf.resize(0); Shape::detachSourcesAndReceivers();
+  }
+  /**
+   * Estimate the largest stable time step on this element, from the element radius and the
+   * fastest wave speed at the integration points.
+   * @return The stable time step.
+   */
+  double CFL_estimate();
+  /** Whether the isotropic stress kernel is used on this element. */
+  bool Isotropic() const { return mSymmetry == ElasticSymmetry::ISOTROPIC; }
+  /** Symmetry class of the stiffness, whose stress kernel is used on this element. */
+  ElasticSymmetry Symmetry() const { return mSymmetry; }
+  /** Whether the material is constant within the element (and kept as a single value). */
+  bool ConstantMaterial() const { return mConstant; }
+  /** Elements are batched by their symmetry class (see Element::StiffnessVariant). */
+  PetscInt StiffnessVariant() const { return static_cast<PetscInt>(mSymmetry); }
+  /** Heap bytes held by the element (see Element::MemoryBytes). */
+  size_t MemoryBytes() const {
+    size_t bytes = 0;
+    for (auto &c: mC) { bytes += Memory::bytes(c); }
+    return Shape::MemoryBytes() + bytes + Memory::bytes(mRho) + Memory::bytes(mLambda) + Memory::bytes(mMu) +
+        Memory::bytes(mSrcMat) + Memory::bytes(mSrcStf);
+  }
 
   /**** Time loop functions ****/
-  Eigen::MatrixXd computeStiffnessTerm(const Eigen::MatrixXd &u);
-  Eigen::MatrixXd computeSourceTerm(const double time, const PetscInt time_idx);
-  Eigen::MatrixXd computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd>& u);
-  Eigen::Array<double,Eigen::Dynamic,6> computeStress(const Eigen::Ref<const Eigen::ArrayXd>& strain);
-  void recordField(const Eigen::MatrixXd &u) {};
+  /* The stress, stiffness, source and surface terms are views into the thread's scratch arena (see Scratch). */
+  Eigen::Map<Eigen::MatrixXd> computeStiffnessTerm(const Eigen::Ref<const Eigen::MatrixXd>& u);
+  Eigen::Map<Eigen::MatrixXd> computeSourceTerm(const double time, const PetscInt time_idx);
+  Eigen::Map<Eigen::MatrixXd> computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd>& u);
+  /**
+   * Sensitivity kernels of the isotropic velocities VP and VS (see Element::computeKernels), with rho vp^2 =
+   * lambda + 2 mu and rho vs^2 = mu: 2 rho vp^2 div u+ div u, and 4 rho vs^2 (eps+ : eps - div u+ div u). For
+   * anisotropic elements, these are the kernels of the vertical velocities (rho vp^2 = c33, rho vs^2 = c44).
+   */
+  std::vector<std::string> KernelNames() const { return {"VP", "VS"}; }
+  Eigen::MatrixXd computeKernels(const Eigen::Ref<const Eigen::MatrixXd>& u,
+                                 const Eigen::Ref<const Eigen::MatrixXd>& u_adj);
+  Eigen::Map<Eigen::MatrixXd> computeStress(const Eigen::Ref<const Eigen::MatrixXd>& strain);
+  /** Record the field at each receiver, through its precomputed interpolation weights, and the quantities of
+   * the gradient it records (see Receiver::GradientFields). The gradient is taken once for all receivers. */
+  void recordField(const Eigen::Ref<const Eigen::MatrixXd>& u);
 
 
   const static std::string Name() { return "Elastic3D_" + Shape::Name(); }
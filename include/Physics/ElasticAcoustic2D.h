@@ -7,6 +7,9 @@
 // 3rd party.
 #include <petsc.h>
 #include <Eigen/Dense>
+#include <Utilities/FieldId.h>
+#include <Utilities/Memory.h>
+#include <Physics/FaceOperator.h>
 
 // forward decl.
 class Mesh;
@@ -21,14 +24,22 @@ class ElasticToAcoustic2D: public BasePhysics {
   std::vector<PetscInt> mEdg, mNbr;
   std::vector<Eigen::Vector2d> mNbrCtr;
 
+  /// Integrals over the coupled edges, with their normals.
+  FaceOperator mCpl;
+
  public:
 
   /**** Initializers ****/
   ElasticToAcoustic2D<BasePhysics>(std::unique_ptr<Options> const &options);
   void setBoundaryConditions(std::unique_ptr<Mesh> const &mesh);
 
-  std::vector<std::string> PullElementalFields() const;
-  Eigen::MatrixXd computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd>& u);
+  const std::vector<FieldId> &PullElementalFields() const;
+  Eigen::Map<Eigen::MatrixXd> computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd>& u);
+
+  /** Heap bytes held by the element (see Element::MemoryBytes). */
+  size_t MemoryBytes() const {
+    return BasePhysics::MemoryBytes() + Memory::bytes(mEdg) + Memory::bytes(mNbr) + Memory::bytes(mNbrCtr) + mCpl.MemoryBytes();
+  }
 
   const static std::string Name() { return "SolidToFluid2D_" + BasePhysics::Name(); }
 
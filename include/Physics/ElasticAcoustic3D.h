@@ -0,0 +1,54 @@
+#pragma once
+
+// stl.
+#include <iostream>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+#include <Eigen/Dense>
+#include <Utilities/FieldId.h>
+#include <Utilities/Memory.h>
+#include <Physics/FaceOperator.h>
+
+// forward decl.
+class Mesh;
+class Options;
+class ExodusModel;
+
+/**
+ * \class ElasticToAcoustic3D
+ *
+ * \brief Fluid hexahedra with faces on a solid, which take the normal velocity of the solid as the flux through
+ * those faces (see AcousticToElastic3D).
+ */
+template <typename BasePhysics>
+class ElasticToAcoustic3D: public BasePhysics {
+
+ private:
+
+  /// Coupled faces (their index in the element's cone, see Mesh::EdgeNumbers), and the solid element across.
+  std::vector<PetscInt> mFace, mNbr;
+  std::vector<Eigen::Vector3d> mNbrCtr;
+
+  /// Integrals over the coupled faces, with their normals.
+  FaceOperator mCpl;
+
+ public:
+
+  /**** Initializers ****/
+  ElasticToAcoustic3D<BasePhysics>(std::unique_ptr<Options> const &options);
+  void setBoundaryConditions(std::unique_ptr<Mesh> const &mesh);
+
+  const std::vector<FieldId> &PullElementalFields() const;
+  Eigen::Map<Eigen::MatrixXd> computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd>& u);
+
+  /** Heap bytes held by the element (see Element::MemoryBytes). */
+  size_t MemoryBytes() const {
+    return BasePhysics::MemoryBytes() + Memory::bytes(mFace) + Memory::bytes(mNbr) + Memory::bytes(mNbrCtr) +
+        mCpl.MemoryBytes();
+  }
+
+  const static std::string Name() { return "SolidToFluid3D_" + BasePhysics::Name(); }
+
+};
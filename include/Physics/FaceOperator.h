@@ -0,0 +1,83 @@
+#pragma once
+
+// stl.
+#include <functional>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+#include <Eigen/Dense>
+#include <Utilities/Memory.h>
+
+/**
+ * \class FaceOperator
+ *
+ * \brief Precomputed face integrals of an element, for the coupling terms of faces shared with other physics.
+ *
+ * Each face holds its dofs, and the (face dof x face dof) matrix which maps a field on those dofs to its face
+ * integral against the test functions, times a scale (i.e. a density) and with its unit normal. The matrices
+ * are found once, by applying the face integral of the shape to the unit vectors of the face dofs, so that a
+ * step is a small mat-vec per face on the face dofs only, without the edge Jacobians or any full sized
+ * temporaries of the shape. With the collocated GLL points of the tensor shapes the matrices are diagonal,
+ * but the face integral of any other basis fits as well.
+ *
+ * The faces are given by a function integrating a field over them, so that one operator serves the edges of
+ * quads and the faces of hexes (or tets) alike.
+ */
+class FaceOperator {
+
+ public:
+
+  /// Integral of a field (at all points of the element) over a face, against the test functions.
+  typedef std::function<Eigen::VectorXd(const Eigen::VectorXd &)> Integral;
+
+  /** Remove all faces. */
+  void clear();
+
+  /**
+   * Add a face.
+   * @param [in] num_pnt Number of points of the element.
+   * @param [in] integral Integral over the face (i.e. the shape's applyTestAndIntegrateEdge).
+   * @param [in] normal Unit normal of the face (unused by apply).
+   * @param [in] scale Factor of the face integral.
+   */
+  void addFace(const PetscInt num_pnt, const Integral &integral, const Eigen::VectorXd &normal,
+               const PetscReal scale = 1);
+
+  /**
+   * Add the scaled face integrals of a field.
+   * @param [in] f Field at all points of the element.
+   * @param [in,out] out Integrals, at all points of the element.
+   */
+  void apply(const Eigen::Ref<const Eigen::VectorXd> &f, Eigen::Ref<Eigen::VectorXd> out) const;
+
+  /**
+   * Add the scaled face integrals of the normal component of a vector field.
+   * @param [in] u Vector field at all points of the element, one column per dimension.
+   * @param [in,out] out Integrals, at all points of the element.
+   */
+  void applyNormal(const Eigen::Ref<const Eigen::MatrixXd> &u, Eigen::Ref<Eigen::VectorXd> out) const;
+
+  /**
+   * Add the scaled face integrals of a field along the unit normal, i.e. the traction of a pressure.
+   * @param [in] f Field at all points of the element.
+   * @param [in,out] out Integrals, at all points of the element, one column per dimension.
+   */
+  void applyAlongNormal(const Eigen::Ref<const Eigen::VectorXd> &f, Eigen::Ref<Eigen::MatrixXd> out) const;
+
+  PetscInt NumFaces() const { return mDofs.size(); }
+
+  /** Heap bytes held by the operator. */
+  size_t MemoryBytes() const {
+    return Memory::bytes(mDofs) + Memory::bytes(mOps) + Memory::bytes(mNormals) + Memory::bytes(mScales);
+  }
+
+ private:
+
+  /// Per face: its dofs, integration matrix, unit normal and scale.
+  std::vector<std::vector<PetscInt>> mDofs;
+  std::vector<Eigen::MatrixXd> mOps;
+  std::vector<Eigen::VectorXd> mNormals;
+  std::vector<PetscReal> mScales;
+
+};
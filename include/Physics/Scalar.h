@@ -1,14 +1,18 @@
 #pragma once
 
 // stl.
+#include <memory>
 #include <vector>
 
 // 3rd party.
 #include <Eigen/Dense>
 #include <Utilities/Types.h>
+#include <Utilities/Memory.h>
 
 // forward decl.
 class Mesh;
+class Source;
+class Receiver;
 class Options;
 class ExodusModel;
 
@@ -26,31 +30,142 @@ class Scalar: public Shape {
 
  private:
 
-  /**** Workspace vectors (allocated in the constructor). ****/
+  /**** Material parameters at the integration points (set in attachMaterialProperties). ****/
+  /// A single value if the velocity is constant within the element, which the stress then scales by.
   RealVec mVpSquared;
-  RealVec mStiff;
-  RealVec mSource;
-  RealMat mStress;
-  RealMat mStrain;
+
+  /// The same for the other members of an ensemble (see ExodusModel::addMember), and the member whose material
+  /// the stiffness term uses (see selectMember).
+  std::vector<RealVec> mMemberVpSquared;
+  PetscInt mMember;
+
+  /// Delta function of each attached source, integrated against the test functions.
+  std::vector<RealVec> mSrcCoef;
+
+  /// Number of shots propagated at once, i.e. columns of the source term.
+  PetscInt mNumShots;
+
+  /// Dense element stiffness matrix, applied instead of the sum-factorized gradients on tensor elements
+  /// (with --dense-element-stiffness, empty otherwise). With --mixed-precision, it is held and applied in single
+  /// precision instead (mStiffMat is then empty).
+  bool mDenseStiffness, mSingleStiffness;
+  RealMat mStiffMat;
+  Eigen::MatrixXf mStiffMatSingle;
+
+  /** Apply the dense stiffness matrix to a column of the field. */
+  template <typename Out>
+  inline void applyDenseStiffness(const Eigen::Ref<const RealVec> &u, Out &&stiff) const {
+    if (mSingleStiffness) { stiff = (mStiffMatSingle * u.cast<float>()).template cast<PetscReal>(); }
+    else { stiff.noalias() = mStiffMat * u; }
+  }
 
  public:
 
   /**** Initializers ****/
   Scalar<Shape>(std::unique_ptr<Options> const &options);
   ~Scalar<Shape>() {};
-  std::vector<std::string> PullElementalFields() const;
-  std::vector<std::string> PushElementalFields() const;
+  const std::vector<FieldId> &PullElementalFields() const;
+  const std::vector<FieldId> &PushElementalFields() const;
 
   /**** Setup functions ****/  
   RealMat assembleElementMassMatrix();
   void attachMaterialProperties(std::unique_ptr<ExodusModel> const &model);
+  /** Attach a single parameter through the shape (i.e. for mixins which need further parameters). */
+  using Shape::attachMaterialProperties;
+  /**
+   * Precompute the terms of the shape, and the dense stiffness matrix (with --dense-element-stiffness). Column j of
+   * the matrix is the stiffness term of the j-th basis function, so the material must be attached first.
+   */
+  void precomputeElementTerms();
+  /**
+   * Attach a source through the shape, and integrate its delta function against the test
+   * functions once, since the source does not move.
+   * @param [in] source The source.
+   * @param [in] finalize Whether to actually attach, or only test for the source.
+   * @return True if the source lies in this element.
+   */
+  bool attachSource(std::unique_ptr<Source> &source, const bool finalize);
+  /**
+   * Attach a receiver through the shape, and register the fields it records.
+   * @param [in] receiver The receiver.
+   * @param [in] finalize Whether to actually attach, or only test for the receiver.
+   * @return True if the receiver lies in this element.
+   */
+  bool attachReceiver(std::unique_ptr<Receiver> &receiver, const bool finalize);
+  /** Remove all sources and receivers, and their precomputed coefficients. */
+  void detachSourcesAndReceivers() { mSrcCoef.clear(); Shape::detachSourcesAndReceivers(); }
+  /**
+   * Estimate the largest stable time step on this element, from the element radius and the
+   * fastest wave speed at the integration points.
+   * @return The stable time step.
+   */
+  double CFL_estimate();
 
   /**** Time loop functions ****/
-  RealMat computeStress(const Eigen::Ref<const RealMat>& strain);
-  RealMat computeStiffnessTerm(const Eigen::Ref<const RealMat>& u);
-  RealMat computeSurfaceIntegral(const Eigen::Ref<const RealMat>& u);
-  RealMat computeSourceTerm(const double time, const PetscInt time_idx);
-  void recordField(const Eigen::Ref<const RealMat>& u) {};
+  /* The stress and stiffness term are views into the thread's scratch arena (see Scratch). */
+  Eigen::Map<RealMat> computeStress(const Eigen::Ref<const RealMat>& strain);
+  Eigen::Map<RealMat> computeStiffnessTerm(const Eigen::Ref<const RealMat>& u);
+  /**
+   * Number of values of the lane-interleaved geometry of L elements (see packLaneGeometry), or 0 with dense
+   * stiffness matrices, which need neither geometry nor material.
+   */
+  template <int L>
+  static PetscInt LaneGeometrySize(const Scalar<Shape> *elm);
+  /** Copy the geometry of L elements into a lane-interleaved block (see Hexahedra::interleaveGeometry). */
+  template <int L>
+  static void packLaneGeometry(Scalar<Shape> *const *elms, PetscReal *geo);
+  /** Copy the squared velocity of L elements (of their selected members) into coef[L * i + l]. */
+  template <int L>
+  static void packLaneMaterial(Scalar<Shape> *const *elms, PetscReal *coef);
+  /**
+   * Compute the stiffness term of L elements at once, with one element per SIMD lane. Only
+   * available if the shape provides lane kernels (see StiffnessLanes in ElementBatch.h).
+   * @param [in] elms The L elements.
+   * @param [in] geo Geometry of all elements, as packed by packLaneGeometry (unused with dense stiffness).
+   * @param [in] coef Material of all elements, as packed by packLaneMaterial (unused with dense stiffness).
+   * @param [in] u Field of all elements, lane-interleaved (u[L * i + l] at GLL point i of elms[l]).
+   * @param [out] stiff Stiffness term of all elements, lane-interleaved.
+   * @param [in/out] work Scratch space, resized as needed.
+   */
+  template <int L>
+  static void computeStiffnessTermLanes(Scalar<Shape> *const *elms, const PetscReal *geo, const PetscReal *coef,
+                                        const PetscReal *u, PetscReal *stiff, std::vector<PetscReal> &work);
+  /** The surface integral, which is zero, as a view into the thread's scratch arena (see Scratch). */
+  Eigen::Map<RealMat> computeSurfaceIntegral(const Eigen::Ref<const RealMat>& u);
+  /** Sensitivity kernel of the velocity VP: 2 vp^2 grad u+ . grad u (see Element::computeKernels). */
+  std::vector<std::string> KernelNames() const { return {"VP"}; }
+  RealMat computeKernels(const Eigen::Ref<const RealMat>& u, const Eigen::Ref<const RealMat>& u_adj);
+  /** Returns the forcing of each shot (one column per shot), summed over the attached sources, as a view into
+   * the thread's scratch arena (see Scratch). */
+  Eigen::Map<RealMat> computeSourceTerm(const double time, const PetscInt time_idx);
+  /** Record the field at each receiver, through its precomputed interpolation weights (as the fields of the
+   * selected member of an ensemble). */
+  void recordField(const Eigen::Ref<const Eigen::MatrixXd>& u);
+  /**
+   * Compute the following terms with the material of one member of an ensemble, which is that shot of the fields.
+   * @param [in] shot Shot of the fields.
+   * @return Whether the receivers record this shot (every member of an ensemble, or else only the first shot).
+   */
+  bool selectMember(const PetscInt shot) {
+    mMember = mMemberVpSquared.empty() ? 0 : shot;
+    return !shot || mMember;
+  }
+
+  /// Squared velocity at the integration points, or a single value if it is constant within the element (of the
+  /// selected member).
+  const RealVec &VpSquared() const { return mMember ? mMemberVpSquared[mMember - 1] : mVpSquared; }
+  /// Squared velocity at an integration point.
+  PetscReal VpSquared(const PetscInt i) const { return VpSquared()(VpSquared().size() > 1 ? i : 0); }
+
+  /** Heap bytes held by the element (see Element::MemoryBytes). */
+  size_t MemoryBytes() const {
+    return Shape::MemoryBytes() + Memory::bytes(mVpSquared) + Memory::bytes(mMemberVpSquared) +
+        Memory::bytes(mSrcCoef) + OperatorBytes() - Shape::OperatorBytes();
+  }
+  /** Bytes of dense per-element operators (see Element::OperatorBytes). */
+  size_t OperatorBytes() const {
+    return Shape::OperatorBytes() + Memory::bytes(mStiffMat) + Memory::bytes(mStiffMatSingle);
+  }
 
   const static std::string Name() { return "Scalar_" + Shape::Name(); }
 
@@ -20,10 +20,6 @@ class ScalarTri: public Shape {
    * Custom class for triangles
    */
 
- private:
-
-  RealVec mStiff;
-
  public:
 
   /**** Initializers ****/
@@ -32,7 +28,28 @@ class ScalarTri: public Shape {
   
   /**** Time loop functions ****/
   
-  RealMat computeStiffnessTerm(const Eigen::Ref<const RealMat>& u);
+  /**
+   * Apply the precomputed element stiffness matrix, or the reference derivatives with only the
+   * geometric coefficients of the element (with --simplex-reference-stiffness).
+   */
+  Eigen::Map<RealMat> computeStiffnessTerm(const Eigen::Ref<const RealMat>& u);
+  /**
+   * Lane-interleaved geometry and material of L elements (see Scalar::packLaneGeometry): the geometric
+   * coefficients (rr, rs, ss) of each element, 3 * L values, which are only used with reference stiffness.
+   */
+  template <int L>
+  static PetscInt LaneGeometrySize(const ScalarTri<Shape> *elm);
+  template <int L>
+  static void packLaneGeometry(ScalarTri<Shape> *const *elms, PetscReal *geo);
+  template <int L>
+  static void packLaneMaterial(ScalarTri<Shape> *const *elms, PetscReal *coef);
+  /**
+   * Compute the stiffness term of L elements at once (see Scalar::computeStiffnessTermLanes). With reference
+   * stiffness, the reference derivatives are applied to all lanes by one matrix product each.
+   */
+  template <int L>
+  static void computeStiffnessTermLanes(ScalarTri<Shape> *const *elms, const PetscReal *geo, const PetscReal *coef,
+                                        const PetscReal *u, PetscReal *stiff, std::vector<PetscReal> &work);
 
   const static std::string Name() { return "ScalarTri_" + Shape::Name(); }
 
@@ -0,0 +1,70 @@
+#pragma once
+
+// stl.
+#include <memory>
+#include <string>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+
+// salvus.
+#include <Utilities/Types.h>
+#include <Utilities/Memory.h>
+
+class Mesh;
+class Options;
+
+/**
+ * The forward wavefield on the absorbing boundaries, from which it is reconstructed backwards in time alongside an
+ * adjoint run (--adjoint-reconstruction boundary, see Simulation::runAdjoint).
+ *
+ * Without damping, a Newmark step can be taken back exactly (see Problem::takeTimeStepBack). The absorbing terms
+ * damp the wavefield, so that stepping back is only wrong on the dofs of absorbing faces, and the stiffness
+ * spreads the error from there. Recording the Newmark state (u, v and a_) of these dofs before each forward step,
+ * and imposing it after each step back, keeps the wavefield exact everywhere. With the final state held by the
+ * fields, the boundary gives the states in reverse order by as many steps as the forward run took, in
+ * #steps x #state fields x #boundary dofs values, rather than the recomputation of Checkpoints.
+ */
+class BoundaryWavefield {
+
+ public:
+
+  /**
+   * Collect the owned dofs on the absorbing boundaries (collective), and make room for their states.
+   * @param [in] mesh The mesh, with its global dofs set up.
+   * @param [in] options Options of the shot.
+   * @param [in] fields The global fields of the forward wavefield.
+   */
+  BoundaryWavefield(std::unique_ptr<Mesh> const &mesh, std::unique_ptr<Options> const &options,
+                    FieldDict &fields);
+
+  /**
+   * Record the state of the boundary dofs.
+   * @param [in] time_idx Number of steps taken, below the number of steps of the shot.
+   * @param [in] fields The global fields.
+   */
+  void record(const PetscInt time_idx, FieldDict &fields);
+
+  /**
+   * Impose a recorded state on the boundary dofs.
+   * @param [in] time_idx Number of steps taken.
+   * @param [in,out] fields The global fields.
+   */
+  void impose(const PetscInt time_idx, FieldDict &fields);
+
+  /** Owned dofs on the absorbing boundaries, as indices into the local part of the global vectors. */
+  inline const std::vector<PetscInt> &Dofs() const { return mDofs; }
+
+  /** Heap bytes held by the boundary wavefield. */
+  size_t MemoryBytes() const { return Memory::bytes(mDofs) + Memory::bytes(mStates); }
+
+ private:
+
+  std::vector<std::string> mFields;
+  std::vector<PetscInt> mDofs;
+
+  /// Per step, per state field, the values on mDofs.
+  std::vector<PetscScalar> mStates;
+
+};
@@ -0,0 +1,61 @@
+#pragma once
+
+// stl.
+#include <memory>
+#include <string>
+
+// 3rd party.
+#include <petsc.h>
+
+// salvus.
+#include <Utilities/Types.h>
+
+class Mesh;
+class Options;
+
+/**
+ * Setup report of the elements which limit the time step.
+ *
+ * The stable time step of an element is its CFL estimate (the smallest GLL point spacing, from its vertices and
+ * order, over its largest velocity, see Element::CFL_estimate), scaled as in Problem::stableTimeStep. report
+ * prints the --cfl-report elements with the smallest stable time step over all ranks, with their centre and
+ * type, i.e. where the mesh would be worth fixing. It also prints a histogram of the stable time steps of all
+ * elements in powers of two of the smallest, which are the levels the elements would be binned into by local
+ * time stepping (see Order2NewmarkLts). With --cfl-report-file, the stable time step of every element is
+ * written as well, one element per line ("global,rank,local,x,y,z,dt,type"), for a point cloud in e.g.
+ * ParaView. Overlapping cells (--halo-overlap) are only counted on the rank owning them.
+ */
+class CflReport {
+
+ public:
+
+  /**
+   * Print the report, and write the file if asked for (collective).
+   * @param [in] elements Local elements, with material parameters attached.
+   * @param [in] mesh The mesh the elements were built on.
+   * @param [in] options Options (--cfl-report, --cfl-report-file).
+   */
+  static void report(ElemVec const &elements, std::unique_ptr<Mesh> const &mesh,
+                     std::unique_ptr<Options> const &options);
+
+ private:
+
+  /// Number of histogram bins, the last of which holds all larger steps.
+  static const PetscInt NumBins = 8;
+
+  /// An element in the list of limiting ones, as sent between ranks.
+  struct Entry {
+    double dt;
+    double centre[3];
+    PetscInt global, rank, local;
+    char type[48];
+  };
+
+  /**
+   * Write the stable time step of every element, gathered onto the first rank (collective).
+   * @param [in] file Name of the file.
+   * @param [in] lines Lines of this rank, each ending with a newline.
+   */
+  static void write(const std::string &file, const std::string &lines);
+
+};
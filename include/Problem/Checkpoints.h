@@ -0,0 +1,119 @@
+#pragma once
+
+// stl.
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+
+// salvus.
+#include <Utilities/Types.h>
+#include <Utilities/Memory.h>
+
+class Options;
+
+/**
+ * Checkpoints of the forward wavefield, which give its states in reverse order to an adjoint run.
+ *
+ * A state is the Newmark state of each field (u, v and a_, the acceleration of the last step), with its time. The
+ * checkpoints fit into --checkpoint-memory megabytes per rank, with --checkpoint-disk-slots more in a file per
+ * rank under --checkpoint-dir. Schedule lays out the steps, stores and restores which deliver the states from the
+ * last to the first with the least recomputation for the checkpoints at hand (binomial checkpointing, after
+ * Griewank's revolve). The first checkpoints, which are restored least often, are those on disk. With
+ * --checkpoint-tolerance, each field of a state is compressed with that error bound (see Compression), which fits
+ * more checkpoints into the budget at the cost of an inexact forward wavefield.
+ */
+class Checkpoints {
+
+ public:
+
+  /// Actions of a schedule: advance the forward wavefield to a step, store or restore a checkpoint, and hand the
+  /// current state to the adjoint.
+  enum Action { Advance, Store, Restore, Deliver };
+  struct Step {
+    Action action;
+    PetscInt arg;  ///< Step to advance to, or the checkpoint.
+  };
+
+  /**
+   * Schedule the reversal of a run, from the state of step 0 (which is the first to be stored).
+   * @param [in] num_steps Number of time steps of the run.
+   * @param [in] num_slots Number of checkpoints.
+   * @returns The actions, which deliver the states num_steps, ..., 0 in turn.
+   */
+  static std::vector<Step> Schedule(const PetscInt num_steps, const PetscInt num_slots);
+
+  /**
+   * Number of steps which some checkpoints reverse, if each step is advanced at most a number of times: the
+   * binomial coefficient (slots + times) over slots.
+   * @param [in] num_slots Number of checkpoints.
+   * @param [in] num_times Number of times any step is advanced.
+   */
+  static double ReversibleSteps(const PetscInt num_slots, const PetscInt num_times);
+
+  /**
+   * Fields of the Newmark state.
+   * @param [in] fields The fields of a wavefield.
+   * @returns All but the inverse mass and the accelerations being assembled (a, ax, ...).
+   */
+  static std::vector<std::string> StateFields(FieldDict &fields);
+
+  /**
+   * Size the checkpoints to the budget (collective), and open the disk tier.
+   * @param [in] options Options of the shot (--checkpoint-memory, --checkpoint-disk-slots, --checkpoint-dir,
+   * --checkpoint-tolerance).
+   * @param [in] fields The global fields of the forward wavefield.
+   * @throws std::runtime_error If not a single checkpoint fits.
+   */
+  Checkpoints(std::unique_ptr<Options> const &options, FieldDict &fields);
+  ~Checkpoints();
+  Checkpoints(const Checkpoints&) = delete;
+  Checkpoints &operator=(const Checkpoints&) = delete;
+
+  /** Number of checkpoints, in memory and on disk. */
+  inline PetscInt NumSlots() const { return mNumDisk + mMemory.size(); }
+
+  /**
+   * Store the state of the fields.
+   * @param [in] slot Checkpoint.
+   * @param [in] time_idx Number of steps taken.
+   * @param [in] time Simulated time.
+   * @param [in] fields The global fields.
+   */
+  void store(const PetscInt slot, const PetscInt time_idx, const PetscReal time, FieldDict &fields);
+
+  /**
+   * Restore the fields from a checkpoint.
+   * @param [in] slot Checkpoint.
+   * @param [out] time_idx Number of steps taken.
+   * @param [out] time Simulated time.
+   * @param [in,out] fields The global fields, which start from rest again if restored to step zero.
+   */
+  void restore(const PetscInt slot, PetscInt &time_idx, PetscReal &time, FieldDict &fields);
+
+  /** Heap bytes held by the checkpoints in memory. */
+  size_t MemoryBytes() const { return Memory::bytes(mMemory) + Memory::bytes(mTimeIdx) + Memory::bytes(mTime); }
+
+ private:
+
+  /// Fields of a state with their number of values on this rank, the bytes of a state, and the tolerance of its
+  /// compression (0 for none).
+  std::vector<std::string> mFields;
+  std::vector<size_t> mFieldSizes;
+  size_t mSize;
+  double mTolerance;
+
+  /// Checkpoints in memory (which follow those on disk), and the number on disk with their file.
+  std::vector<std::vector<unsigned char>> mMemory;
+  PetscInt mNumDisk;
+  std::string mDiskFile;
+  std::fstream mDisk;
+
+  /// Step and time of each checkpoint.
+  std::vector<PetscInt> mTimeIdx;
+  std::vector<PetscReal> mTime;
+
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+// stl.
+#include <memory>
+#include <string>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+
+// salvus.
+#include <Utilities/Types.h>
+#include <Utilities/Memory.h>
+
+class Options;
+
+/**
+ * Frequency domain wavefields of a shot, accumulated while stepping (an on the fly DFT).
+ *
+ * Every --dft-every steps, the fields (--dft-fields, by default the displacement) are added to their discrete
+ * Fourier transform at each of --dft-frequencies,
+ *
+ *   U(f) += u(t) exp(-2 pi i f t) M dt,
+ *
+ * on the owned dofs inside --dft-region (or all of them). Nothing is written while stepping: the transforms are
+ * held as a real and an imaginary part per field, #dofs x #components rows by #frequencies columns, and written
+ * once after the shot (--dft-file). The file holds:
+ *
+ *   /coordinates       #dofs x dim, the physical coordinates of the selected dofs.
+ *   /frequencies       #frequencies.
+ *   /<field>_real      #frequencies x #dofs x #components, and /<field>_imag alike.
+ *
+ * The frequencies must lie below the Nyquist frequency of the sampling, 1 / (2 M dt).
+ */
+class Fourier {
+
+ public:
+
+  /**
+   * @param [in] shot Options of the shot (--dft-frequencies, --dft-every, --dft-fields, --dft-region), with its
+   * time step.
+   */
+  Fourier(std::unique_ptr<Options> const &shot);
+
+  /**
+   * Select the owned dofs within the region, and zero the transforms.
+   * @param [in] elements Vector of all elements.
+   * @param [in] PETScDM The PETSc DM.
+   * @param [in] PETScSection The mesh section, with the global dofs laid out.
+   * @param [in] fields The global fields, which must hold the transformed ones.
+   */
+  void setup(ElemVec const &elements, DM PETScDM, PetscSection PETScSection, FieldDict &fields);
+
+  /**
+   * Add the fields to the transforms, once every --dft-every steps.
+   * @param [in] time_idx Number of steps taken.
+   * @param [in] time Simulated time of the fields.
+   * @param [in] fields The global fields.
+   */
+  void accumulate(const PetscInt time_idx, const PetscReal time, FieldDict &fields);
+
+  /** Whether accumulate takes the fields after some number of steps. */
+  bool Due(const PetscInt time_idx) const { return !(time_idx % mEvery); }
+
+  /**
+   * Write the transforms, each rank its dofs as one contiguous block of rows in rank order (collective).
+   * @param [in] file Name of the HDF5 file.
+   */
+  void write(const std::string &file);
+
+  /** Transformed fields. */
+  std::vector<std::string> Fields() const { return mFields; }
+
+  /** Real and imaginary part of the transform of a field, one column per frequency. */
+  const RealMat &Real(const std::string &field) const { return mReal[index(field)]; }
+  const RealMat &Imag(const std::string &field) const { return mImag[index(field)]; }
+
+  /** Heap bytes held by the transforms. */
+  size_t MemoryBytes() const {
+    return Memory::bytes(mDofs) + Memory::bytes(mCoordinates) + Memory::bytes(mReal) + Memory::bytes(mImag);
+  }
+
+ private:
+
+  std::vector<PetscReal> mFrequencies, mRegion;
+  std::vector<std::string> mFields;
+  PetscInt mEvery, mNumDim, mNumComponents;
+  PetscReal mTimeStep;
+
+  /// Selected dofs, as the index of their first component in the local part of the global vectors, and their
+  /// coordinates (dim per dof).
+  std::vector<PetscInt> mDofs;
+  std::vector<PetscReal> mCoordinates;
+
+  /// Per field: real and imaginary part of the transform.
+  std::vector<RealMat> mReal, mImag;
+
+  /** Position of a field among the transformed fields. */
+  size_t index(const std::string &field) const;
+
+};
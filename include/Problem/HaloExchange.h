@@ -0,0 +1,190 @@
+#pragma once
+
+// stl.
+#include <array>
+#include <vector>
+
+// 3rd party.
+#include <mpi.h>
+#include <petsc.h>
+
+// salvus.
+#include <Utilities/LocalIndex.h>
+
+/**
+ * Persistent halo exchange between the local and global vectors of the mesh section.
+ *
+ * This does what DMGlobalToLocal and DMLocalToGlobal (with ADD_VALUES) do, but the communication pattern is
+ * extracted from the section's star forest once, with contiguous send and receive buffers per neighbouring
+ * rank and persistent MPI requests. Each exchange then only packs, starts and waits on the same requests.
+ * Several fields (of the same section) are exchanged together, interleaved per dof in the buffers, so there
+ * is a single message per neighbour and direction regardless of the number of fields. In single precision, the
+ * values travel as floats (half the bytes), and are still inserted and summed into the double vectors. In half
+ * precision (a quarter of the bytes), each message holds the largest magnitude of each field, by which its
+ * values are scaled to fit the range of a half (see --halo-precision).
+ *
+ * The reduction (reduceBegin, reduceEnd) works on the local vectors alone: the ghosts' contributions are summed
+ * on the owners, and the sums sent back to the ghosts, so that every copy of a dof ends up with the same total.
+ * Without the sums (refresh), the owners' values replace those of the ghosts.
+ *
+ * Node aware (--node-aware-halo), the buffers of all ranks of a node live in one MPI-3 shared memory window.
+ * A rank reads what its neighbours on the node packed for it directly from their buffers, so nothing is sent
+ * within the node. All that goes from the ranks of one node to those of another travels as a single message,
+ * sent by one rank of the node (chosen by the other node, to spread the messages over the ranks) straight from
+ * and into the buffers of the window, through an indexed datatype. The ranks of a node synchronize with a fence
+ * when the buffers are packed and when the messages arrived, and alternate between two sets of buffers, so that
+ * the next exchange is packed while slower ranks are still unpacking the last.
+ *
+ * For the communication report (see Problem::reportHalo), the bytes of the segments sent to and received from
+ * each neighbour are counted, and with timeWaits (and without node awareness), the seconds each exchange waited
+ * until the messages of a neighbour completed.
+ */
+class HaloExchange {
+
+ public:
+
+  /** Precision in which the values travel. */
+  enum Precision { Double, Single, Half };
+
+  /**
+   * Extract the communication pattern, and register the requests.
+   * @param [in] PETScDM The PETSc DM, with its section set up.
+   * @param [in] width Number of fields exchanged together.
+   * @param [in] precision Precision in which to send the values (see --halo-precision).
+   * @param [in] node_aware True to share the buffers within each node, and aggregate the messages between nodes.
+   */
+  HaloExchange(DM PETScDM, const PetscInt width, const Precision precision = Double, const bool node_aware = false);
+  HaloExchange(const HaloExchange&) = delete;
+  HaloExchange &operator=(const HaloExchange&) = delete;
+  ~HaloExchange();
+
+  inline PetscInt Width() const { return mWidth; }
+  inline Precision WirePrecision() const { return mPrecision; }
+
+  /** Neighbouring ranks (owning a ghost of this rank, or ghosting one of its dofs), ascending. */
+  std::vector<PetscMPIInt> Neighbours() const;
+
+  /** Local dofs owned by this rank, those of them ghosted by another rank, and the ghosts. */
+  inline PetscInt NumOwned() const { return mSelfLoc.size(); }
+  PetscInt NumShared() const;
+  inline PetscInt NumGhosts() const { return mGhostLoc.size(); }
+
+  /**
+   * Traffic with each neighbour since construction.
+   * @param [out] sent Bytes sent to each neighbour (in the order of Neighbours).
+   * @param [out] received Bytes received from each.
+   * @param [out] waited Seconds waited until the messages of each completed (0 unless timed, see timeWaits).
+   */
+  void traffic(std::vector<double> &sent, std::vector<double> &received, std::vector<double> &waited) const;
+
+  /** Time the wait for each neighbour from now on (which completes the messages one by one), or stop. */
+  inline void timeWaits(const bool time) { mTimeWaits = time; }
+
+  /**
+   * Global -> local (insert).
+   * @param [in] glb Owned values of each field (the global vector arrays).
+   * @param [out] loc Local values of each field (the local vector arrays).
+   */
+  void scatter(const std::vector<const PetscScalar*> &glb, const std::vector<PetscScalar*> &loc);
+
+  /**
+   * Local -> global (add). Contributions to dofs ghosted by other ranks are only added in gatherEnd, so the
+   * global values may be assembled into while the exchange is in flight.
+   * @param [in] loc Local values of each field (the local vector arrays).
+   * @param [in/out] glb Owned values of each field (the global vector arrays).
+   */
+  void gatherBegin(const std::vector<const PetscScalar*> &loc, const std::vector<PetscScalar*> &glb);
+  void gatherEnd(const std::vector<PetscScalar*> &glb);
+
+  /**
+   * Local -> local (sum over all copies of each dof). Contributions of other ranks are only added in reduceEnd,
+   * so the owned values may be assembled into while the exchange is in flight, but not the ghosts.
+   * @param [in/out] loc Local values of each field (the local vector arrays).
+   */
+  void reduceBegin(const std::vector<PetscScalar*> &loc);
+  void reduceEnd(const std::vector<PetscScalar*> &loc);
+
+  /**
+   * Local -> local (insert the owners' values into the ghosts), i.e. DMGlobalToLocal on the local vectors alone.
+   * @param [in/out] loc Local values of each field (the local vector arrays).
+   */
+  void refresh(const std::vector<PetscScalar*> &loc);
+
+  /**
+   * Copy the owned dofs from the local to the global vectors, with no communication (of any number of fields).
+   * @param [in] loc Local values of each field (the local vector arrays).
+   * @param [out] glb Owned values of each field (the global vector arrays).
+   */
+  void copyOwned(const std::vector<const PetscScalar*> &loc, const std::vector<PetscScalar*> &glb);
+
+ private:
+
+  PetscInt mWidth;
+  Precision mPrecision;
+
+  /// Local dofs owned by this rank, and their index in the global vector. All dofs of the exchange are
+  /// rank-local indices, in 32 bits (see LocalInt).
+  std::vector<LocalInt> mSelfLoc, mSelfGlb;
+
+  /// Ghost dofs, grouped by owning rank (mGhostOff[r] to mGhostOff[r + 1] for the r-th owner).
+  std::vector<PetscMPIInt> mGhostRank;
+  std::vector<PetscInt> mGhostOff;
+  std::vector<LocalInt> mGhostLoc;
+
+  /// Owned dofs ghosted by other ranks, grouped by ghosting rank, and their index in the local vector.
+  std::vector<PetscMPIInt> mOwnedRank;
+  std::vector<PetscInt> mOwnedOff;
+  std::vector<LocalInt> mOwnedGlb, mOwnedLoc;
+
+  /// Buffers (a segment of segmentBytes per neighbour, in any precision, held as doubles for their alignment),
+  /// and the requests sending owned -> ghost (scatter) and ghost -> owned (gather).
+  std::vector<PetscScalar> mGhostBuf, mOwnedBuf;
+  std::vector<MPI_Request> mScatterReq, mGatherReq;
+
+  /// Per set of buffers, where the segment of each owned and ghost neighbour is packed, and where what the owners
+  /// (scatter) and the ghosts (gather) sent is read from. Without node awareness, both sets are the same.
+  std::array<std::vector<char*>, 2> mOwnedSeg, mGhostSeg, mScatterIn, mGatherIn;
+  PetscInt mParity = 0;
+
+  /// Bytes sent to and received from each owned and then each ghost neighbour (in the order of the requests),
+  /// and the seconds waited for their messages while timed.
+  std::vector<double> mSentBytes, mRecvBytes, mWaitSeconds;
+  bool mTimeWaits = false;
+
+  /// Node aware: the ranks of the node, the window holding their buffers, and per set of buffers, the messages
+  /// between nodes (with their datatypes) which this rank sends and receives.
+  bool mNodeAware;
+  MPI_Comm mNode = MPI_COMM_NULL;
+  MPI_Win mWin = MPI_WIN_NULL;
+  std::array<std::vector<MPI_Request>, 2> mNodeScatterReq, mNodeGatherReq;
+  std::vector<MPI_Datatype> mNodeTypes;
+
+  /** Bytes of the segment of a neighbour with num dofs. */
+  size_t segmentBytes(const PetscInt num) const;
+
+  /** Lay out the buffers of the node in a shared window, and register the messages between nodes, in units of
+   * type (of unit bytes). */
+  void setupNodeAware(MPI_Datatype type, const size_t unit);
+
+  /** Next set of buffers (when node aware), before packing an exchange. */
+  inline void next() { if (mNodeAware) { mParity = 1 - mParity; } }
+
+  /** Start and complete the messages of the packed buffers, owners to ghosts or ghosts to owners. */
+  void start(const bool scatter);
+  void finish(const bool scatter);
+
+  /** The exchanges, on the buffers of one precision (T packing and unpacking their segments, see
+   * HaloExchange.cpp). */
+  template <typename T>
+  void scatterAs(const std::vector<const PetscScalar*> &glb, const std::vector<PetscScalar*> &loc);
+  template <typename T>
+  void gatherBeginAs(const std::vector<const PetscScalar*> &loc, const std::vector<PetscScalar*> &glb,
+                     const bool add_self);
+  template <typename T>
+  void gatherEndAs(const std::vector<PetscScalar*> &glb);
+  template <typename T>
+  void reduceEndAs(const std::vector<PetscScalar*> &loc);
+  template <typename T>
+  void refreshAs(const std::vector<PetscScalar*> &loc);
+
+};
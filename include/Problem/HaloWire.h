@@ -0,0 +1,105 @@
+#pragma once
+
+// stl.
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// 3rd party.
+#include <petsc.h>
+
+/**
+ * Wire formats of the halo exchange (see HaloExchange::Precision). Each packs and unpacks the segment of a
+ * neighbour: num dofs of width fields, interleaved per dof. The values come from value(i, f), and are handed to
+ * put(i, f, value) on the other side.
+ */
+
+/**
+ * Nearest half precision float (IEEE binary16) to x, as its bits, for magnitudes of at most 1. Larger values
+ * become infinities, and NaNs stay NaNs.
+ */
+inline uint16_t ToHalf(const float x) {
+  uint32_t b; std::memcpy(&b, &x, sizeof(b));
+  const uint16_t sign = (b >> 16) & 0x8000;
+  const uint32_t raw_exp = (b >> 23) & 0xff;
+  const int32_t exp = static_cast<int32_t>(raw_exp) - 127 + 15;
+  uint32_t man = b & 0x7fffff;
+  if (raw_exp == 0xff && man) { return sign | 0x7e00; }
+  if (exp >= 31) { return sign | 0x7c00; }
+  if (exp <= 0) {
+    /* Subnormal, or flushed to zero below half the smallest of those. */
+    if (exp < -10) { return sign; }
+    man |= 0x800000;
+    const uint32_t shift = 14 - exp;
+    return sign | ((man >> shift) + ((man >> (shift - 1)) & 1));
+  }
+  /* Rounding up may carry into the exponent, which is what it should do. */
+  return (sign | (exp << 10) | (man >> 13)) + ((man >> 12) & 1);
+}
+
+/** The float of half precision bits (see ToHalf). */
+inline float FromHalf(const uint16_t h) {
+  const int32_t exp = (h >> 10) & 0x1f, man = h & 0x3ff;
+  const float mag = exp == 31 ? (man ? NAN : INFINITY)
+                  : exp ? std::ldexp(static_cast<float>(1024 + man), exp - 25)
+                        : std::ldexp(static_cast<float>(man), -24);
+  return h & 0x8000 ? -mag : mag;
+}
+
+/** As values of type T. */
+template <typename T>
+struct PlainWire {
+  static size_t bytes(const PetscInt num, const PetscInt width) { return num * width * sizeof(T); }
+  template <typename Value>
+  static void pack(char *seg, const PetscInt num, const PetscInt width, Value value) {
+    T *buf = reinterpret_cast<T *>(seg);
+    for (PetscInt i = 0; i < num; i++, buf += width) {
+      for (PetscInt f = 0; f < width; f++) { buf[f] = value(i, f); }
+    }
+  }
+  template <typename Put>
+  static void unpack(const char *seg, const PetscInt num, const PetscInt width, Put put) {
+    const T *buf = reinterpret_cast<const T *>(seg);
+    for (PetscInt i = 0; i < num; i++, buf += width) {
+      for (PetscInt f = 0; f < width; f++) { put(i, f, buf[f]); }
+    }
+  }
+};
+
+/**
+ * As half precision floats, relative to the largest magnitude of each field in the segment, which are sent
+ * first (as floats). Small or large values then stay within the range of a half, and each value is off by at
+ * most 2^-11 of that largest one. Segments are padded to 8 bytes, so that the next scales stay aligned. A NaN
+ * is sent as a NaN, without spoiling the scale of its field, and an infinity arrives as a NaN.
+ */
+struct HalfWire {
+  static size_t bytes(const PetscInt num, const PetscInt width) {
+    return (width * sizeof(float) + num * width * sizeof(uint16_t) + 7) / 8 * 8;
+  }
+  template <typename Value>
+  static void pack(char *seg, const PetscInt num, const PetscInt width, Value value) {
+    float *scale = reinterpret_cast<float *>(seg);
+    uint16_t *buf = reinterpret_cast<uint16_t *>(scale + width);
+    for (PetscInt f = 0; f < width; f++) { scale[f] = 0; }
+    for (PetscInt i = 0; i < num; i++) {
+      for (PetscInt f = 0; f < width; f++) { scale[f] = std::max<float>(scale[f], std::abs(value(i, f))); }
+    }
+    for (PetscInt i = 0; i < num; i++, buf += width) {
+      for (PetscInt f = 0; f < width; f++) {
+        buf[f] = ToHalf(scale[f] > 0 ? value(i, f) / scale[f] : value(i, f));
+      }
+    }
+  }
+  template <typename Put>
+  static void unpack(const char *seg, const PetscInt num, const PetscInt width, Put put) {
+    const float *scale = reinterpret_cast<const float *>(seg);
+    const uint16_t *buf = reinterpret_cast<const uint16_t *>(scale + width);
+    for (PetscInt i = 0; i < num; i++, buf += width) {
+      for (PetscInt f = 0; f < width; f++) {
+        const float val = FromHalf(buf[f]);
+        put(i, f, scale[f] > 0 ? static_cast<PetscScalar>(scale[f]) * val : val);
+      }
+    }
+  }
+};
@@ -0,0 +1,88 @@
+#pragma once
+
+// stl.
+#include <memory>
+#include <vector>
+
+// 3rd party.
+#include <mpi.h>
+#include <petsc.h>
+
+// salvus.
+#include <Utilities/Types.h>
+
+class Mesh;
+
+/**
+ * Constraints of the hanging nodes of a 2:1 non-conforming mesh of quads or hexes (--hanging-nodes).
+ *
+ * A coarse face (or edge, in 2D) which is covered by the faces of 2^(d-1) finer elements belongs to a single
+ * element of the DMPlex topology, as do the fine faces. The dofs of the fine elements on such a face (the
+ * hanging nodes) are not independent, but take the value of the coarse element's basis at their location:
+ * u_s = sum_m w_sm u_m, with the masters m the coarse element's dofs. With C the (sparse) matrix of these
+ * weights, and S the diagonal mask of the hanging dofs, the conforming field is P u = u - S u + C u. The
+ * forces are summed onto the masters by the transpose, P^T f = f - S f + C^T f, and the lumped mass the same
+ * way (the row sums of P^T M P), so that the assembly and the time stepping stay those of a conforming mesh.
+ * The hanging dofs take no force, and a mass of one.
+ *
+ * The faces without a neighbouring element, which are not on a side set, are gathered from all ranks, and a
+ * fine face is matched to the (at least 1.5 times larger) coplanar face whose bounding box holds its own. The
+ * fine rank sends the location of each of its nodes on the face to the rank of the coarse element, which
+ * evaluates the weights, and inserts the rows of C. C is a parallel PETSc matrix, so that the fine and coarse
+ * elements may be on different ranks. Coarsening layers must be separated by at least one layer of elements,
+ * i.e. a master may not hang itself.
+ */
+class HangingNodes {
+
+ public:
+
+  /**
+   * Find the hanging nodes of the mesh, and their weights (collective).
+   * @param [in] elements Local elements, with their vertex coordinates.
+   * @param [in] mesh The mesh, with its global dofs set up.
+   * @returns The constraints, or null if the mesh has no hanging nodes.
+   */
+  static std::unique_ptr<HangingNodes> Build(ElemVec const &elements, std::unique_ptr<Mesh> const &mesh);
+
+  ~HangingNodes();
+  HangingNodes(const HangingNodes&) = delete;
+  HangingNodes &operator=(const HangingNodes&) = delete;
+
+  /** Set the hanging dofs of a global vector to the values of their masters (u <- P u). */
+  void constrain(Vec u);
+
+  /** Sum the values of the hanging dofs of a global vector onto their masters, and zero them (f <- P^T f). */
+  void distribute(Vec f);
+
+  /** Lump the diagonal mass of a global vector onto the masters, with a mass of one on the hanging dofs. */
+  void lumpMass(Vec m);
+
+  /** Number of hanging nodes over all ranks (each with all of its components). */
+  inline PetscInt NumHanging() const { return mNumHanging; }
+
+ private:
+
+  HangingNodes(): mWeights(nullptr), mWork(nullptr), mNumHanging(0) {}
+
+  /// Weights of the masters of each hanging dof (C), and a work vector of its layout.
+  Mat mWeights;
+  Vec mWork;
+
+  /// Hanging dofs owned by this rank (all components), as indices into the local part of the global vectors,
+  /// and the number of hanging nodes over all ranks.
+  std::vector<PetscInt> mHanging;
+  PetscInt mNumHanging;
+
+  /// A face of an element without a neighbour: its bounding box, centre and normal, and its element.
+  struct Face {
+    double min[3], max[3], centre[3], normal[3], size;
+    PetscInt rank, element;
+  };
+
+  /// A node of a fine element on a coarse face, sent to the rank of the coarse element.
+  struct Node {
+    double x[3];
+    PetscInt dof, element;
+  };
+
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+// stl.
+#include <memory>
+
+// 3rd party.
+#include <petsc.h>
+
+// salvus.
+#include <Utilities/Types.h>
+#include <Element/Element.h>
+
+class Mesh;
+class Options;
+
+/**
+ * Energy and stability monitor of a shot, which aborts a run once it has gone unstable (i.e. with too large a
+ * time step, or a degenerate element), instead of letting it step through its whole duration.
+ *
+ * Every --energy-check-every steps, check is called between assembly and the time step, when the acceleration
+ * vectors still hold the assembled forces f - K u. The energy is then estimated from the vectors at hand, with
+ * no further assembly: the kinetic energy 1/2 v^T M v (with the inverse mass mi), and the strain energy
+ * 1/2 u^T K u, approximated by -1/2 u^T (f - K u). The source term makes the latter an estimate only, and with
+ * local time stepping the forces are those of the coarsest level.
+ *
+ * A run is taken as unstable if any value of the fields is not finite, or if the energy grows by more than
+ * --energy-growth at a number of consecutive checks. A source which ramps up may increase the energy quickly
+ * too, so the growth must last. The diagnostic names the rank with the largest (or non-finite) energy, and
+ * the element on it with the largest displacement, with its bounding box.
+ */
+class Monitor {
+
+ public:
+
+  /** @param [in] shot Options of the shot (--energy-check-every, --energy-growth). */
+  Monitor(std::unique_ptr<Options> const &shot);
+
+  /**
+   * Check the energy, once every --energy-check-every steps (collective at those steps).
+   * @param [in] time_idx Number of steps taken.
+   * @param [in] time Simulated time.
+   * @param [in] fields Global fields, with the assembled forces in the acceleration vectors.
+   * @param [in] elements Local elements.
+   * @param [in] mesh The mesh.
+   * @throws std::runtime_error On all ranks, if the run is unstable.
+   */
+  void check(const PetscInt time_idx, const PetscReal time, FieldDict &fields, ElemVec const &elements,
+             std::unique_ptr<Mesh> const &mesh);
+
+  /** Whether check looks at the fields after some number of steps. */
+  bool Due(const PetscInt time_idx) const { return mEvery && !(time_idx % mEvery); }
+
+  /**
+   * Kinetic and (estimated) strain energy of the local dofs (see above).
+   * @returns Whether all values of the fields are finite.
+   */
+  static bool localEnergy(FieldDict &fields, PetscReal &kinetic, PetscReal &strain);
+
+ private:
+
+  /// Number of consecutive checks over which the energy must grow.
+  const static PetscInt mGrowthChecks = 3;
+
+  PetscInt mEvery;
+  PetscReal mGrowth;
+
+  /// Energy at the previous check, and the number of consecutive checks at which it grew.
+  PetscReal mLastEnergy;
+  PetscInt mNumGrowing;
+
+  /** Abort, with the rank and element to blame (collective). */
+  void abort(const PetscReal time, const PetscReal score, const std::string &reason, FieldDict &fields,
+             ElemVec const &elements, std::unique_ptr<Mesh> const &mesh);
+
+};
@@ -0,0 +1,153 @@
+#pragma once
+
+// stl.
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+#include <hdf5.h>
+
+// salvus.
+#include <Utilities/Types.h>
+
+class Mesh;
+class ExodusModel;
+class Options;
+
+/**
+ * Movie of a selection of the global dofs, in a HDF5 file of its own.
+ *
+ * PETSc's viewer writes every frame as the whole global vectors, in double precision. This instead writes only the
+ * dofs inside a bounding box (--movie-region), on a side set (--movie-side-set) and/or on the mesh vertices
+ * (--movie-vertices-only), in double, float or half precision (--movie-precision). The file holds:
+ *
+ *   /coordinates  #dofs x dim, the physical coordinates of the selected dofs.
+ *   /time         #frames, the time of each frame.
+ *   /<field>      #frames x #dofs x #components, one per movie field, grown by one frame per write.
+ *
+ * With --movie-tolerance, each frame of a field is instead compressed with that error bound (see Compression):
+ * /<field> holds the levels of a grid shared by all ranks, as unsigned integers, and /<field>_grid (#frames x 2)
+ * the lowest value and the step of each frame's grid, so that a sample is lowest + level * step.
+ *
+ * Each rank writes the selected dofs it owns, as one contiguous block of rows (in rank order). A run resumed with
+ * --restart-from opens the movie of the run before instead, and appends to it.
+ */
+class Movie {
+
+ public:
+
+  /**
+   * Whether the movie options select part of the dofs a lower precision or compression, and so need a Movie instead of PETSc's
+   * viewer.
+   * @param [in] options Movie options.
+   */
+  static bool Selective(std::unique_ptr<Options> const &options);
+
+  /**
+   * Select the mesh points which may hold movie dofs (the side set, and vertices), and create the file
+   * (collective). The dofs themselves are selected by setup, once the global dofs are laid out.
+   * @param [in] options Movie options.
+   * @param [in] mesh The mesh, with its topology set up.
+   * @param [in] model The model, for the side set names.
+   */
+  Movie(std::unique_ptr<Options> const &options, std::unique_ptr<Mesh> const &mesh,
+        std::unique_ptr<ExodusModel> const &model);
+  ~Movie();
+  Movie(const Movie&) = delete;
+  Movie &operator=(const Movie&) = delete;
+
+  /**
+   * Select the dofs owned by this rank, and write their coordinates (collective). The element closures give the
+   * coordinates of each dof, and so whether it lies within the region.
+   * @param [in] elements Vector of all elements.
+   * @param [in] PETScDM The PETSc DM.
+   * @param [in] PETScSection The mesh section, with the global dofs laid out.
+   */
+  void setup(ElemVec const &elements, DM PETScDM, PetscSection PETScSection);
+
+  /**
+   * Owned dofs of some mesh points within a bounding box, with their coordinates (as selected by setup).
+   * @param [in] elements Vector of all elements.
+   * @param [in] PETScDM The PETSc DM.
+   * @param [in] PETScSection The mesh section, with the global dofs laid out.
+   * @param [in] points Mesh points which may hold dofs (offset by chart_start), or empty for all points.
+   * @param [in] chart_start First point of the chart.
+   * @param [in] region Bounding box (min and max per dimension), or empty for the whole mesh.
+   * @param [out] dofs Index of the first component of each dof in the local part of the global vectors.
+   * @param [out] coordinates Physical coordinates, dim per dof.
+   */
+  static void SelectDofs(ElemVec const &elements, DM PETScDM, PetscSection PETScSection,
+                         const std::vector<bool> &points, const PetscInt chart_start,
+                         const std::vector<PetscReal> &region, std::vector<PetscInt> &dofs,
+                         std::vector<PetscReal> &coordinates);
+
+  /**
+   * Create a dataset of doubles (or floats), and write one block of it (collective). Ranks without a block give
+   * an empty buffer.
+   * @param [in] file_id HDF5 file.
+   * @param [in] name Name of the dataset.
+   * @param [in] dims Extent of the dataset.
+   * @param [in] start First index of this rank's block in each dimension.
+   * @param [in] count Extent of this rank's block.
+   * @param [in] buf Values of the block, in row major order.
+   */
+  static void WriteRows(hid_t file_id, const std::string &name, const std::vector<hsize_t> &dims,
+                        const std::vector<hsize_t> &start, const std::vector<hsize_t> &count,
+                        std::vector<double> buf);
+  static void WriteRows(hid_t file_id, const std::string &name, const std::vector<hsize_t> &dims,
+                        const std::vector<hsize_t> &start, const std::vector<hsize_t> &count,
+                        std::vector<float> buf);
+
+  /** Whether setup was called. The selection does not change afterwards. */
+  inline bool IsSetUp() const { return mSetUp; }
+
+  /**
+   * Write a frame of some fields (collective).
+   * @param [in] time Simulation time.
+   * @param [in] save_fields Names of the fields.
+   * @param [in] fields The global fields.
+   */
+  void write(const PetscReal time, const std::vector<std::string> &save_fields, FieldDict &fields);
+
+  /** Number of frames written. */
+  inline hsize_t NumFrames() const { return mNumFrames; }
+
+  /**
+   * Continue a resumed movie after some frames (collective), dropping any written after them (see Restart).
+   * @param [in] num Number of frames to keep.
+   */
+  void SetNumFrames(const hsize_t num);
+
+  /** Write what the file holds so far to disk (collective). */
+  void flush();
+
+ private:
+
+  /// Mesh points which may hold movie dofs (offset by the chart start), and the bounding box (if any).
+  std::vector<bool> mPoints;
+  PetscInt mChartStart;
+  std::vector<PetscReal> mRegion;
+
+  PetscInt mNumDim, mNumComponents;
+  PetscReal mTolerance;
+  bool mSetUp, mResume;
+
+  /// Selected dofs, as the index of their first component in the local part of the global vectors.
+  std::vector<PetscInt> mDofs;
+
+  /// Selected dofs of all ranks, and the first row of this rank's.
+  hsize_t mNumSelected, mOffset;
+
+  /// File, sample type in the file, time and field datasets (with the grids of compressed frames), and the
+  /// number of frames written.
+  hid_t mFileId, mType, mTimeSet;
+  std::map<std::string, hid_t> mSets, mGridSets;
+  hsize_t mNumFrames;
+
+  /** Create the (empty) dataset of a field, on its first frame (collective). */
+  hid_t fieldSet(const std::string &field);
+
+};
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <Problem/Order2Newmark.h>
+
+/**
+ * Second order explicit time stepping by the central difference (leapfrog) scheme,
+ * u_{n+1} = 2u_n - u_{n-1} + dt^2 M^-1 a_n, which only keeps the displacement of the current and the previous
+ * step, and the acceleration the forces are assembled into. It advances the wavefield exactly as Order2Newmark
+ * does without damping, and holds three fields per component instead of four (u, u_ and a, with no velocity).
+ *
+ * A wavefield starts from rest, with the first step of the Newmark scheme (u_1 = u_0 + dt^2/2 a_0), i.e. the first
+ * step of new fields, or of those reset or restored to step zero (see FieldDict::FromRest). As nothing keeps the
+ * velocity, elements pulling it (i.e. absorbing boundaries, or fluid-solid interfaces) are rejected by
+ * initializeGlobalDofs.
+ */
+class Order2Leapfrog: public Order2Newmark {
+
+ public:
+
+  /**
+   * Returns individual field components for a given physical system.
+   * @param physics "fluid", or "elastic2d" or "elastic3d", etc.
+   * @param interleaved If true, vector physics store all components in one block field (u, u_, a).
+   * @return The defined fields (i.e. ux, ux_, ax, ...
+   */
+  static std::vector<std::string> physicsToFields(const std::set<std::string> &physics,
+                                                  const bool interleaved = false);
+
+  Order2Leapfrog(const std::unique_ptr<Options>& options) : Order2Newmark(options) {}
+
+  /**
+   * Set up the fields of the leapfrog scheme, the mass matrix and the assembly plan.
+   * @param [in] elements Vector of all elements (with material parameters attached).
+   * @param [in] mesh A pointer to the mesh wrapper.
+   * @returns A dictionary of modified fields.
+   * @throws std::runtime_error If an element pulls a field the scheme does not keep (i.e. the velocity).
+   */
+  FieldDict initializeGlobalDofs(ElemVec const &elements, std::unique_ptr<Mesh> &mesh);
+
+  std::tuple<FieldDict, PetscScalar> takeTimeStep(
+      FieldDict fields, PetscScalar time, std::unique_ptr<Options> const &options);
+
+  /**
+   * Rewind the displacement from the state after a step (u_{n+1}, u_n, and the filtered a_n) to u_{n-1}.
+   */
+  FieldDict rewindDisplacement(FieldDict fields);
+
+  /**
+   * Complete a reverse step, to (u_n, u_{n-1}, a_{n-1}), with the accelerations a_{n-1} assembled at the
+   * rewound displacement.
+   */
+  std::tuple<FieldDict, PetscScalar> takeTimeStepBack(
+      FieldDict fields, PetscScalar time, std::unique_ptr<Options> const &options);
+
+};
@@ -5,22 +5,67 @@
 
 class Order2Newmark: public Problem {
 
+ protected:
+
   PetscReal mDt;
 
+  /// Set by applyInverseMassMatrix, and consumed by the fused update in takeTimeStep.
+  bool mInverseMassPending;
+
+  /// True if the fields are not of the standard (host) vector type: the update is then made of PETSc vector
+  /// operations, which run where the vectors live (i.e. on the device), instead of a loop over their arrays.
+  bool mVecKernelUpdate;
+
+  /**
+   * Swap the vectors held by two fields, keeping each field's name. The local vectors are only swapped if both
+   * fields have one.
+   * @param [in/out] a First field.
+   * @param [in/out] b Second field.
+   */
+  static void swapFieldVectors(std::unique_ptr<field> &a, std::unique_ptr<field> &b);
+
+  /// Time step level of each element, passed on to the assembly plan (empty for global stepping).
+  std::vector<PetscInt> mElementLevel;
+
+  /**
+   * Sum the element mass matrices into the (zeroed) mass field, and invert it.
+   * @param [in] elements Vector of all elements.
+   * @param [in] mesh A pointer to the mesh wrapper.
+   * @param [in/out] fields A map containing references to the global fields (with mi).
+   */
+  void assembleInverseMassMatrix(ElemVec const &elements, std::unique_ptr<Mesh> &mesh, FieldDict &fields);
+
  public:
 
   /**
    * Returns individual field components for a given physical system.
    * @param physics "fluid", or "elastic2d" or "elastic3d", etc.
+   * @param interleaved If true, vector physics store all components in one block field (u, v, ...).
    * @return The defined fields (i.e. u, ux, uy, uz, ...
    */
-  static std::vector<std::string> physicsToFields(const std::set<std::string> &physics);
+  static std::vector<std::string> physicsToFields(const std::set<std::string> &physics,
+                                                  const bool interleaved = false);
 
   Order2Newmark(const std::unique_ptr<Options>& options);
+  void SetTimeStep(const PetscReal dt) { mDt = dt; }
   FieldDict initializeGlobalDofs(ElemVec const &elements, std::unique_ptr<Mesh> &mesh);
+  FieldDict reinitializeGlobalDofs(ElemVec const &elements, std::unique_ptr<Mesh> &mesh, FieldDict fields);
+  /**
+   * Marks the acceleration for filtering through the inverse mass matrix. The filter itself is
+   * fused into takeTimeStep, so the acceleration is only scaled once takeTimeStep has run.
+   */
   FieldDict applyInverseMassMatrix(FieldDict fields);
   std::tuple<FieldDict, PetscScalar> takeTimeStep(
       FieldDict fields, PetscScalar time, std::unique_ptr<Options> const &options);
+  /** Copy the acceleration of the last step, which the rotated buffers keep in a_, into a (see takeTimeStep). */
+  void prepareOutput(FieldDict &fields);
+  FieldDict rewindDisplacement(FieldDict fields);
+  /**
+   * Reverse the Newmark update, from the state after a step (u_{n+1}, v_n, a_n) and the accelerations a_{n-1}
+   * assembled at the rewound displacement (u_{n-1}), to the state before it (u_n, v_{n-1}, a_{n-1}).
+   */
+  std::tuple<FieldDict, PetscScalar> takeTimeStepBack(
+      FieldDict fields, PetscScalar time, std::unique_ptr<Options> const &options);
 
 };
 
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <array>
+#include <Problem/Order2Newmark.h>
+
+/**
+ * Explicit Newmark with local time stepping (multi-rate leapfrog, after Diaz & Grote, 2009).
+ *
+ * Each element is binned into a level from its CFL estimate, so that --time-step / 2^level is
+ * stable on the element. Dofs take the finest level of the elements they touch. Within one
+ * (coarse) step, the stiffness of a level is frozen, while the finer levels are sub-cycled with
+ * two steps of half the size, recursively. Elements are therefore only evaluated 2^level times
+ * per step, instead of all elements being evaluated at the finest rate.
+ *
+ * The sub-cycling produces one effective acceleration per dof, which is then passed through the
+ * regular Newmark update. With a single level, this is exactly Order2Newmark.
+ */
+class Order2NewmarkLts: public Order2Newmark {
+
+  /// Maximum number of levels (from the options).
+  PetscInt mMaxLevels;
+
+  /// DM on which the sub-cycles are assembled.
+  DM mDM;
+
+  /// Recognized components present in the fields (index into the recognized field lists).
+  std::vector<PetscInt> mComps;
+
+  /// Per level (>= 1) and recognized component: current and previous sub-step state, acceleration
+  /// frozen from the coarser levels, and scratch acceleration.
+  std::vector<std::array<Vec, 4>> mState, mStatePrev, mFrozen, mAcl;
+
+  /**
+   * Bin every element into the coarsest level at which it is stable (into mElementLevel).
+   * @param [in] elements Vector of all elements (with material parameters attached).
+   */
+  void binElementLevels(ElemVec const &elements);
+
+  /**
+   * (Re)allocate the work vectors of the sub-cycled levels, after the assembly plan is set up.
+   * @param [in] fields A map containing references to the global fields.
+   */
+  void allocateWorkVectors(FieldDict &fields);
+
+  /**
+   * Advance the dofs of a level over one step of its parent level, in two sub-steps.
+   * @param [in] level The level to sub-cycle (>= 1).
+   * @param [in] u Displacement at the start of the parent step.
+   * @param [in] z Acceleration frozen from the coarser levels (may alias acl).
+   * @param [in] dt Time step of the parent level.
+   * @param [out] acl Effective acceleration over the parent step.
+   * @param [in/out] fields A map containing references to the global fields.
+   * @param [in] time Simulation time at the start of the coarse step.
+   */
+  void subCycle(const PetscInt level, std::array<Vec, 4> const &u, std::array<Vec, 4> const &z,
+                const PetscReal dt, std::array<Vec, 4> const &acl, FieldDict &fields, const PetscReal time);
+
+  /**
+   * Compute the acceleration acting on a sub-step state, i.e. the frozen acceleration minus the
+   * stiffness of this level, plus the (sub-cycled) contribution of the finer levels.
+   * @param [in] level The level of the sub-step.
+   * @param [in] u Sub-step state.
+   * @param [in] z Acceleration frozen from the coarser levels.
+   * @param [in] dt Time step of this level.
+   * @param [out] acl The acceleration.
+   * @param [in/out] fields A map containing references to the global fields.
+   * @param [in] time Simulation time at the start of the coarse step.
+   */
+  void levelAcceleration(const PetscInt level, std::array<Vec, 4> const &u, std::array<Vec, 4> const &z,
+                         const PetscReal dt, std::array<Vec, 4> const &acl, FieldDict &fields,
+                         const PetscReal time);
+
+ public:
+
+  Order2NewmarkLts(const std::unique_ptr<Options>& options);
+  ~Order2NewmarkLts();
+
+  /**
+   * Bin elements into time step levels, then set up the fields and assembly plan as in
+   * Order2Newmark.
+   * @param [in] elements Vector of all elements (with material parameters attached).
+   * @param [in] mesh A pointer to the mesh wrapper.
+   * @returns A dictionary of modified fields.
+   */
+  FieldDict initializeGlobalDofs(ElemVec const &elements, std::unique_ptr<Mesh> &mesh);
+
+  /**
+   * Bin elements into levels again (for the new material), and rebuild the levelled assembly plan if any
+   * element changed level, before resetting the fields as in Order2Newmark.
+   */
+  FieldDict reinitializeGlobalDofs(ElemVec const &elements, std::unique_ptr<Mesh> &mesh, FieldDict fields);
+
+  /**
+   * Sub-cycle the finer levels on top of the (coarse) acceleration from assembleIntoGlobalDof,
+   * and advance all fields with the resulting effective acceleration.
+   */
+  std::tuple<FieldDict, PetscScalar> takeTimeStep(
+      FieldDict fields, PetscScalar time, std::unique_ptr<Options> const &options);
+
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+// stl.
+#include <memory>
+#include <vector>
+
+// 3rd party.
+#include <mpi.h>
+#include <petsc.h>
+
+// salvus.
+#include <Utilities/Types.h>
+
+class Mesh;
+
+/**
+ * Periodic identification of the dofs on pairs of side sets (--periodic-boundaries), so that a laterally
+ * homogeneous (or periodic) model only needs a single period of the domain.
+ *
+ * Each pair is a master side set and a slave side set, which is the master translated (i.e. x1 = x0 + L). The
+ * dofs of the slave take the value of the dof of the master at the translated location, u_s = u_m, and their
+ * forces and mass are summed onto it. This is the constraint of the hanging nodes (see HangingNodes), with a
+ * single weight of one per slave: the conforming field is P u = u - S u + C u, and the forces P^T f, so that the
+ * element loop and the halo exchange stay those of the open mesh, and the slaves take no force and a mass of one.
+ *
+ * The translation of a pair is that of the bounding boxes of its side sets. The nodes on the faces of both side
+ * sets are gathered from all ranks, so that the master and slave may be on different ranks. A node on several
+ * slave side sets (i.e. an edge or corner of the box, with several pairs) is followed through the pairs until it
+ * reaches a node on no slave side set, which is then its master.
+ */
+class PeriodicBoundaries {
+
+ public:
+
+  /**
+   * Match the dofs of the periodic side sets (collective).
+   * @param [in] elements Local elements, with their vertex coordinates.
+   * @param [in] mesh The mesh, with its topology and global dofs set up.
+   * @returns The constraints, or null without --periodic-boundaries.
+   * @throws std::runtime_error If a node of a slave side set has no node of its master.
+   */
+  static std::unique_ptr<PeriodicBoundaries> Build(ElemVec const &elements, std::unique_ptr<Mesh> const &mesh);
+
+  ~PeriodicBoundaries();
+  PeriodicBoundaries(const PeriodicBoundaries&) = delete;
+  PeriodicBoundaries &operator=(const PeriodicBoundaries&) = delete;
+
+  /** Set the slave dofs of a global vector to the values of their masters (u <- P u). */
+  void constrain(Vec u);
+
+  /** Sum the values of the slave dofs of a global vector onto their masters, and zero them (f <- P^T f). */
+  void distribute(Vec f);
+
+  /** Lump the diagonal mass of a global vector onto the masters, with a mass of one on the slave dofs. */
+  void lumpMass(Vec m);
+
+  /** Number of slave nodes over all ranks (each with all of its components). */
+  inline PetscInt NumSlaves() const { return mNumSlaves; }
+
+ private:
+
+  PeriodicBoundaries(): mMasters(nullptr), mWork(nullptr), mNumSlaves(0) {}
+
+  /// Master of each slave dof (C), and a work vector of its layout.
+  Mat mMasters;
+  Vec mWork;
+
+  /// Slave dofs owned by this rank (all components), as indices into the local part of the global vectors, and
+  /// the number of slave nodes over all ranks.
+  std::vector<PetscInt> mSlaves;
+  PetscInt mNumSlaves;
+
+  /// A node on the face of a periodic side set: its location, global (block) dof, and the side sets it lies on
+  /// (bit 2p for the master of pair p, bit 2p + 1 for its slave).
+  struct Node {
+    double x[3];
+    PetscInt dof;
+    unsigned long long on;
+  };
+
+};
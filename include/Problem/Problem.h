@@ -10,6 +10,12 @@
 #include <Utilities/Types.h>
 #include <Eigen/Dense>
 #include <Element/Element.h>
+#include <Element/ElementBatch.h>
+#include <Problem/HaloExchange.h>
+#include <Problem/HangingNodes.h>
+#include <Problem/PeriodicBoundaries.h>
+#include <Problem/Movie.h>
+#include <Source/Injection.h>
 
 class Mesh;
 class Model;
@@ -28,24 +34,195 @@ class Problem {
 
  private:
 
-  /// Control the saving of the movie.
+  /// Control the saving of the movie: PETSc's viewer for whole vectors, or a selection of the dofs.
   PetscViewer mViewer; PetscInt mOutputFrame;
+  std::unique_ptr<Movie> mMovie;
+
+  /// Assembly plan. Elements grouped by concrete type, with their local vector indices.
+  std::vector<std::unique_ptr<ElementBatch>> mBatches;
+  PetscInt mNumBatchedElements = 0;
+
+  /// Threads per rank used in the element loop, and the elements per chunk of its work-stealing schedule (0 if
+  /// static).
+  PetscInt mNumThreads, mWorkStealingChunk;
+
+  /// Number of shots propagated at once, as the interleaved components of the scalar field.
+  PetscInt mNumShots;
+
+  /// Number of field components interleaved at each dof of the mesh section.
+  PetscInt mNumComponents = 1;
+
+  /// Number of local time step levels in the assembly plan (1 without local time stepping).
+  PetscInt mNumLevels = 1;
+
+  /// Time index of the last assembleIntoGlobalDof.
+  PetscInt mTimeIdx = 0;
+
+  /// Indices of the homogeneous Dirichlet dofs into the local part of the global vectors (all components), or
+  /// into the local vectors with a ghosted state.
+  std::vector<LocalInt> mBndDofs;
+
+  /// Whether to constrain the hanging nodes of a non-conforming mesh (--hanging-nodes), and their constraints
+  /// (null on a conforming mesh).
+  bool mUseHangingNodes;
+  std::unique_ptr<HangingNodes> mHangingNodes;
+
+  /// Identification of the dofs of the periodic side sets (null without --periodic-boundaries).
+  std::unique_ptr<PeriodicBoundaries> mPeriodic;
+
+  /// Largest field value of an element at rest, negative without an activity mask (--activity-mask), and per
+  /// element (by number) the time before which it is skipped without a look (empty without --activity-arrival),
+  /// and whether it is always assembled (see ElementBatch::setActivityMask).
+  PetscReal mActivityThreshold;
+  std::vector<PetscReal> mWakeTime;
+  std::vector<bool> mAwakeElm;
+
+  /** Estimate the first arrival from the sources at each element, and the elements assembled regardless. */
+  void initializeActivityMask(ElemVec const &elements, std::unique_ptr<Mesh> const &mesh,
+                              std::unique_ptr<Options> const &options);
+
+  /// Whether the time stepper's state is kept in the local vectors, ghosts included (--ghosted-state).
+  bool mGhostedState;
+
+  /// Steps between halo exchanges of a ghosted state on overlapping cells (--halo-overlap, 0 to sum the halo every
+  /// step), the steps taken since the last one, and the exchange of the state.
+  PetscInt mHaloOverlap;
+  PetscInt mStepsSinceRefresh = 0;
+  std::unique_ptr<HaloExchange> mStateHalo;
+
+  /// With overlapping cells, whether each (local) element is this rank's own, and its global number.
+  std::vector<bool> mElmOwned;
+  std::vector<PetscInt> mElmGlbNum;
+
+  /** Replace the ghosts of the state (all fields but the mass matrix and the pushed ones) by their owners'. */
+  void refreshState(FieldDict &fields, DM PETScDM);
+
+  /// Persistent halo exchanges of the pulled and pushed fields, set up on first use, the precision they send in
+  /// (--halo-precision), and whether they are node aware (--node-aware-halo).
+  std::unique_ptr<HaloExchange> mPullHalo, mPushHalo;
+  HaloExchange::Precision mHaloPrecision;
+  bool mNodeHalo;
+
+  /// Whether the halo exchanges time their wait for each neighbour (--halo-report-file).
+  bool mTimeHaloWaits;
+
+  /** A halo exchange of the fields of the DM, node aware or not, timing its waits or not. */
+  HaloExchange *newHalo(DM PETScDM, const PetscInt width, const HaloExchange::Precision precision) const;
+
+  /// Fields of the assembly plan: the pulled and pushed vectors, and all vectors and fields accessed by the
+  /// elements (see initializeAssemblyPlan).
+  std::set<FieldId> mPullVecs, mPushVecs, mAccessVecs, mAccessFields;
+
+  /// Arrays of the fields in a halo exchange, kept to reuse their storage from step to step.
+  std::vector<const PetscScalar*> mReadArrays;
+  std::vector<PetscScalar*> mWriteArrays;
+
+  /// Seconds spent completing halo exchanges (i.e. waiting for other ranks), see ExchangeSeconds.
+  PetscReal mExchangeSeconds = 0;
+
+  /// Batch and region of each element in the assembly plan, and while measuring the element costs, the
+  /// seconds spent assembling each region of each batch (see MeasureCosts).
+  std::vector<std::pair<PetscInt, ElementBatch::Region>> mElmBatch;
+  std::vector<std::array<double, 2>> mBatchSeconds;
+  bool mMeasureCosts = false;
+
+  /// Name of the element type of each batch, the steps between the steps whose elements are timed one by one
+  /// (0 for never), the number of steps timed, and the last of them.
+  std::vector<std::string> mBatchNames;
+  PetscInt mElementTimingEvery, mTimedSteps = 0, mLastTimedStep = -1;
+
+ protected:
+
+  /**
+   * Compute element forces for a single time step level (see ElementBatch), and sum them into
+   * the global degrees of freedom. The pushed fields are zeroed first, and their homogeneous
+   * Dirichlet dofs last.
+   * @param [in/out] fields A map containing references to the global fields.
+   * @param [in] level The level to assemble, or ElementBatch::AllLevels.
+   * @param [in] time Simulation time.
+   * @param [in] time_idx Simulation time index.
+   * @param [in] PETScDM A pointer to the governing PETSc DM.
+   */
+  void assembleLevel(FieldDict &fields, const PetscInt level, const PetscReal time,
+                     const PetscInt time_idx, DM PETScDM);
+
+  /** Number of local time step levels in the assembly plan. */
+  inline PetscInt NumLevels() const { return mNumLevels; }
+
+  /** Time index of the step being taken, for the further assemblies of the time stepper. */
+  inline PetscInt LastTimeIndex() const { return mTimeIdx; }
+
+  /** Whether the state is kept in the local vectors (see GhostedState). */
+  inline bool GhostedState() const { return mGhostedState; }
+
+  /** Layers of overlapping cells held by each rank (see mHaloOverlap). */
+  inline PetscInt HaloOverlap() const { return mHaloOverlap; }
+
+  /**
+   * Transfer several fields from the global to the local partition (GlobalToLocal), in one communication
+   * phase instead of one per field, through a persistent halo exchange (see HaloExchange).
+   * @param [in] names The field ids.
+   * @param [in] PETScDM A pointer to the governing PETScDM.
+   * @param [in/out] A map containing references to the global fields.
+   */
+  void checkOutFields(const std::set<FieldId> &names, DM PETScDM, FieldDict &fields);
+
+  /**
+   * Start summing several fields from the local into the global partition (LocalToGlobal), in one
+   * communication phase. The global vectors may be accessed, and added to, until checkInFieldsEnd is called.
+   * @param [in] names The field ids.
+   * @param [in] PETScDM A pointer to the governing PETScDM.
+   * @param [in/out] A map containing references to the global fields.
+   */
+  void checkInFieldsBegin(const std::set<FieldId> &names, DM PETScDM, FieldDict &fields);
+  void checkInFieldsEnd(const std::set<FieldId> &names, DM PETScDM, FieldDict &fields);
 
  public:
 
-  /// Empty constructor.
-  Problem(const std::unique_ptr<Options> &options) {
+  /** Seconds spent so far in the blocking parts of the halo exchanges, most of which is spent waiting for
+   * slower ranks. The rest of a time step is the work of this rank. */
+  inline PetscReal ExchangeSeconds() const { return mExchangeSeconds; }
 
-    /* Assume we're not going to save a movie. */
-    mViewer = nullptr; mOutputFrame = 0;
+  /** Time the assembly of each batch and region of the elements from now on, or stop (see ElementCosts). */
+  void MeasureCosts(const bool measure);
 
-  };
+  /** Measured seconds of each local element (by number): those of its batch and region since MeasureCosts,
+   * shared evenly by their elements. Sources, receivers and coupling terms show in the batch they fall in. */
+  std::vector<PetscReal> ElementCosts() const;
+
+  /** Seconds per step of each local element (by number), timed element by element every --element-timing-every
+   * steps (0 if never timed). */
+  std::vector<PetscReal> ElementSeconds() const;
+
+  /**
+   * Report the timed seconds per element and step of each element type (by name, over all ranks), and of the
+   * slowest rank, write the seconds of each element as a cell field, and start timing anew (collective).
+   * @param [in] PETScDM The DM of the elements.
+   * @param [in] filename HDF5 file of the mesh, with the cell fields element_cost (seconds per step) and
+   * element_rank, or empty for none.
+   */
+  void reportElementTiming(DM PETScDM, const std::string &filename);
+
+  /**
+   * Report the halo traffic of all exchanges so far (collective): log the most neighbours of a rank, the most
+   * bytes a rank sends per step, the largest ratio of shared to owned dofs, and the longest wait for a
+   * neighbour, and write the traffic between each pair of ranks.
+   * @param [in] PETScDM The DM of the fields.
+   * @param [in] num_steps Steps taken by the exchanges.
+   * @param [in] filename Text file of the bytes sent per step from each rank (row) to each other (column), and of
+   * the seconds waited per step, and the neighbours and dofs of each rank, or empty for none.
+   */
+  void reportHalo(DM PETScDM, const PetscInt num_steps, const std::string &filename);
+
+  /// Constructor.
+  Problem(const std::unique_ptr<Options> &options);
 
   /// Empty destructor.
   virtual ~Problem() {
 
-    /* Clean up the viewer if it was initialized. */
+    /* Clean up the viewer if it was initialized, and the injection file. */
     if (mViewer) PetscViewerDestroy(&mViewer);
+    Injection::Close();
 
   };
 
@@ -70,6 +247,51 @@ class Problem {
                              std::unique_ptr<ExodusModel> const &model,
                              std::unique_ptr<Options> const &options);
 
+  /**
+   * Create the sources and receivers given by a set of options, and attach each to the element (and
+   * partition) holding it. All elements must be free of sources and receivers (see
+   * Element::detachSourcesAndReceivers), so that the sources and receivers are numbered from zero.
+   * initializeElements calls this; between shots, it may be called again on the same elements. The sources of
+   * an adjoint wavefield are attached on top of those of the forward one (see Simulation::runAdjoint).
+   * @param [in] elements Vector of all elements.
+   * @param [in] options A reference to the options class.
+   * @param [in] wavefield Wavefield the sources drive (see Source::Wavefield).
+   */
+  void attachSourcesAndReceivers(ElemVec const &elements, std::unique_ptr<Options> const &options,
+                                 const PetscInt wavefield = 0);
+
+  /**
+   * Set all fields back to zero, except the (inverse) mass matrix. I.e. between shots.
+   * @param [in] fields The fields returned by initializeGlobalDofs.
+   * @returns A dictionary of modified fields.
+   */
+  FieldDict resetFields(FieldDict fields);
+
+  /**
+   * Estimate the largest stable time step, from the CFL estimate of every element (minimum GLL
+   * spacing over maximum velocity) on all partitions, scaled by --time-step-safety-factor.
+   * With local time stepping, this may be up to 2^(levels-1) times the smallest element's step.
+   * initializeElements uses this to choose the time step if --time-step was not given, and to
+   * warn if it was given but is too large.
+   * @param [in] elements Vector of all elements, with material parameters attached.
+   * @param [in] options A reference to the options class.
+   * @returns The stable time step.
+   */
+  PetscReal stableTimeStep(ElemVec const &elements, std::unique_ptr<Options> const &options);
+
+  /**
+   * Factor from the CFL estimate of an element to its stable time step: --time-step-safety-factor, and the
+   * stability limit of the time stepping scheme relative to leapfrog.
+   * @param [in] options A reference to the options class.
+   */
+  static PetscReal TimeStepScale(std::unique_ptr<Options> const &options);
+
+  /**
+   * Set the time step of the time stepping scheme (i.e. once it has been chosen automatically).
+   * @param [in] dt The time step.
+   */
+  virtual void SetTimeStep(const PetscReal dt) {};
+
 
   /**
    * This function is responsible for computing element-wise forces, and then summing up
@@ -90,11 +312,126 @@ class Problem {
                                                        std::unique_ptr<Options> const &options);
 
   /**
-   * Save the solution at a certain time.
+   * Build the precomputed gather/scatter plan used by assembleIntoGlobalDof. For each
+   * element, this stores the location of every elemental dof in the local (partition)
+   * vector, with the Salvus closure permutation (ClsMap) already applied. The mesh closure
+   * is therefore only walked once here, rather than for every element, field, and time step.
+   * Elements are also grouped into batches of identical concrete type, which are then
+   * processed without virtual dispatch. Must be called after Mesh::setupGlobalDof.
+   * For local time stepping, each element may be given a time step level. Dofs then take the
+   * finest level of the elements they touch, and assembleIntoGlobalDof only assembles level 0.
+   * @param [in] elements Vector of all elements.
+   * @param [in] PETScDM The PETSc DM object.
+   * @param [in] PETScSection the PETSc section object.
+   * @param [in] elm_level Time step level of each element (empty for a single level).
+   */
+  void initializeAssemblyPlan(ElemVec const &elements, DM PETScDM, PetscSection PETScSection,
+                              std::vector<PetscInt> const &elm_level = std::vector<PetscInt>());
+
+  /**
+   * The fields which need a local vector besides the global one, as those the elements pull or push. With a
+   * ghosted state, all fields do. The others (i.e. the velocity and previous acceleration of Newmark, and the
+   * inverse mass) are only read and written on their global vectors, and the time schemes allocate no local
+   * ones for them.
+   * @param [in] elements Vector of all elements.
+   * @param [in] num_comps Number of interleaved components (block fields are returned for more than one).
+   * @returns The identifiers of the (block) fields with a local vector.
+   */
+  static std::set<FieldId> LocalFields(ElemVec const &elements, const PetscInt num_comps);
+
+  /**
+   * Collect the dofs of some mesh points which this partition owns, as indices into the local part of the global
+   * vectors (collective). A partition owning a dof may not hold the points it lies on, so the points are flagged
+   * on a local vector and summed onto their owners. Must be called after Mesh::setupGlobalDof.
+   * @param [in] mesh The mesh, with its global dofs set up.
+   * @param [in] points Local DMPlex points.
+   * @returns The owned dofs, in ascending order.
+   */
+  static std::vector<PetscInt> OwnedDofs(std::unique_ptr<Mesh> const &mesh, std::vector<PetscInt> const &points);
+
+  /**
+   * Collect the dofs on the homogeneous Dirichlet side sets which this partition owns (collective, see
+   * OwnedDofs). Their accelerations are zeroed after each assembly, on the global vectors, so that boundary
+   * elements compute their stiffness terms as interior ones do.
+   * @param [in] mesh The mesh, with its topology and global dofs set up.
+   */
+  void initializeBoundaryDofs(std::unique_ptr<Mesh> const &mesh);
+
+  /** Homogeneous Dirichlet dofs of the global vectors owned by this partition (see initializeBoundaryDofs). */
+  inline const std::vector<LocalInt> &BoundaryDofs() const { return mBndDofs; }
+
+  /**
+   * Find the hanging nodes of a non-conforming mesh, with --hanging-nodes (collective, see HangingNodes). From
+   * then on, each assembly sets them from their masters on the pulled global vectors, and sums them onto the
+   * masters on the pushed ones. Must be called after Mesh::setupGlobalDof, and before the mass matrix is lumped.
+   * @param [in] elements Local elements, with their vertex coordinates.
+   * @param [in] mesh The mesh, with its topology and global dofs set up.
+   */
+  void initializeHangingNodes(ElemVec const &elements, std::unique_ptr<Mesh> const &mesh);
+
+  /** Constraints of the hanging nodes, or null on a conforming mesh (see initializeHangingNodes). */
+  inline HangingNodes *Hanging() const { return mHangingNodes.get(); }
+
+  /**
+   * Identify the dofs of the periodic side sets, with --periodic-boundaries (collective, see PeriodicBoundaries).
+   * From then on they are constrained in each assembly as the hanging nodes are. Must be called after
+   * Mesh::setupGlobalDof, and before the mass matrix is lumped.
+   * @param [in] elements Local elements, with their vertex coordinates.
+   * @param [in] mesh The mesh, with its topology and global dofs set up.
+   */
+  void initializePeriodicBoundaries(ElemVec const &elements, std::unique_ptr<Mesh> const &mesh);
+
+  /** Identification of the periodic dofs, or null without periodic side sets (see initializePeriodicBoundaries). */
+  inline PeriodicBoundaries *Periodic() const { return mPeriodic.get(); }
+
+  /**
+   * With a ghosted state (--ghosted-state), the time stepper advances the local vectors, owned dofs and ghosts
+   * alike, and the summed acceleration reaches the ghosts in the same halo exchange. The global vectors, from
+   * which the output and the checks read, are only brought up to date here, by copying the owned dofs (with no
+   * communication). Hanging and periodic slave dofs, which otherwise only take the values of their masters before
+   * the next assembly, are constrained here on the global vectors.
+   * @param [in/out] fields The fields, all of which but the (inverse) mass matrix are copied.
+   * @param [in] PETScDM The PETSc DM.
+   */
+  void updateGlobalState(FieldDict &fields, DM PETScDM);
+
+  /**
+   * Bring the fields which the time stepper does not keep current up to date, before they are written (after
+   * updateGlobalState, and only between time steps). Does nothing by default.
+   * @param [in/out] fields The fields.
+   */
+  virtual void prepareOutput(FieldDict &fields) {}
+
+  /**
+   * The opposite of updateGlobalState (collective), once the state was set on the global vectors (i.e. read
+   * from a restart file). Does nothing without a ghosted state.
+   * @param [in/out] fields The fields, all of which but the (inverse) mass matrix are copied.
+   * @param [in] PETScDM The PETSc DM.
+   */
+  void updateLocalState(FieldDict &fields, DM PETScDM);
+
+  /**
+   * Save a movie frame (collective), if a movie was set up in initializeElements.
+   * @param [in] time Simulation time.
+   * @param [in] save_fields Names of the fields in the frame.
+   * @param [in] fields The global fields.
+   * @param [in] PetscDM The PETSc DM.
    */
   void saveSolution(const PetscReal time, const std::vector<std::string> &save_fields,
                     FieldDict &fields, DM PetscDM);
 
+  /** Number of movie frames saved so far. */
+  PetscInt OutputFrame() const;
+
+  /**
+   * Continue the movie of a resumed run after some frames (see Restart).
+   * @param [in] frame Number of frames saved before.
+   */
+  void SetOutputFrame(const PetscInt frame);
+
+  /** Write the movie saved so far to disk (collective). */
+  void flushSolution();
+
   /**
    * Given a set of elements, initialize the global degrees of freedom in a way appropriate
    * for the problem as hand. I.e. set up a sparsity pattern, or create a global mass vector.
@@ -104,6 +441,34 @@ class Problem {
    */
   virtual FieldDict initializeGlobalDofs(ElemVec const &elements, std::unique_ptr<Mesh> &mesh) = 0;
 
+  /**
+   * After the material of the elements changed (see updateModel), recompute the material dependent global
+   * terms (i.e. the mass matrix) in the existing fields, and reset all other fields to zero.
+   * @param [in] elements Vector of all elements.
+   * @param [in] mesh A pointer to the mesh wrapper.
+   * @param [in] fields The fields returned by initializeGlobalDofs.
+   * @returns A dictionary of modified fields.
+   */
+  virtual FieldDict reinitializeGlobalDofs(ElemVec const &elements, std::unique_ptr<Mesh> &mesh,
+                                           FieldDict fields) = 0;
+
+  /**
+   * Replace the material of existing elements by that of a new model, i.e. between the forward runs of an
+   * inversion. Only the material dependent terms are recomputed (element material and precomputed terms, the
+   * material held by the assembly plan, and the global mass matrix), and all fields are reset, so that the mesh,
+   * decomposition, global dofs, sources and receivers are kept as they are. The new model describes the same
+   * mesh; with --distribute-model, it must be localized as the first one was.
+   * @param [in] elements Vector of all elements, from initializeElements.
+   * @param [in] mesh A pointer to the mesh wrapper.
+   * @param [in] model A pointer to the new model.
+   * @param [in] options A reference to the options class.
+   * @param [in] fields The fields returned by initializeGlobalDofs.
+   * @returns A dictionary of modified fields.
+   */
+  FieldDict updateModel(ElemVec const &elements, std::unique_ptr<Mesh> &mesh,
+                        std::unique_ptr<ExodusModel> const &model, std::unique_ptr<Options> const &options,
+                        FieldDict fields);
+
   /**
    * Filter the acceleration through the inverse mass matrix (depending on the method).
    * @param [in] fields A map containing references to the global fields.
@@ -120,9 +485,43 @@ class Problem {
   virtual std::tuple<FieldDict, PetscScalar> takeTimeStep(
       FieldDict fields, PetscScalar time, std::unique_ptr<Options> const &options) = 0;
 
+  /**
+   * Undo the kinematic part of a time step on the displacement, which is then that of the step before
+   * (i.e. u_{n-1} = u_{n+1} - 2 dt v_n for Newmark). The forces at that displacement may then be assembled, and
+   * takeTimeStepBack completes the reverse step. Stepping back is exact (up to round off) where the forces do
+   * not damp the wavefield, and so not on absorbing boundaries (see BoundaryWavefield).
+   * @param [in] fields A map containing references to the global fields, after a time step.
+   * @returns A dictionary of modified fields.
+   * @throws std::runtime_error If the time stepper can't be reversed.
+   */
+  virtual FieldDict rewindDisplacement(FieldDict fields);
+
+  /**
+   * Complete a reverse time step (see rewindDisplacement), with the assembled accelerations of the step before.
+   * @param [in] fields A map containing references to the global fields.
+   * @param [in] time Simulation time after the step.
+   * @param [in] options A reference to the options class.
+   * @returns A dictionary of modified fields, and the time before the step.
+   * @throws std::runtime_error If the time stepper can't be reversed.
+   */
+  virtual std::tuple<FieldDict, PetscScalar> takeTimeStepBack(
+      FieldDict fields, PetscScalar time, std::unique_ptr<Options> const &options);
+
+  /**
+   * Solve for the static displacement under the loads of the sources at some time (collective), instead of
+   * stepping through time (see StaticSolver).
+   * @param [in] fields A map containing references to the global fields.
+   * @param [in] time Time of the loads.
+   * @param [in] PETScDM The PETSc DM.
+   * @returns A dictionary of modified fields.
+   * @throws std::runtime_error If the problem can't be solved statically.
+   */
+  virtual FieldDict solveStatic(FieldDict fields, const PetscReal time, DM PETScDM);
+
   /**
    * Queries the graph closure for the mesh, and gets the field on a given element. Note that this
-   * does not perform any parallel scattering.
+   * does not perform any parallel scattering. If the section interleaves components, component
+   * fields (i.e. "ux") are extracted from their block field (i.e. "u").
    * @param [in] name A string specifying the field name.
    * @param [in] num The element number.
    * @param [in] closure A vector of indices specifying the correct locations in the global DOFs.
@@ -176,28 +575,28 @@ class Problem {
    * Queries the global distributed DOFs for a certain field vector. If the vector exists,
    * it is properly transferred to the local partition (GlobalToLocal). If it does not exist,
    * an assertation error is thrown.
-   * @param [in] name A string specifying the field name.
+   * @param [in] name The field id.
    * @param [in] PETScDM A pointer to the governing PETScDM.
    * @param [in/out] A map containing references to the global fields.
    */
-  static void checkOutField(const std::string &name, DM PETScDM, FieldDict &fields);
+  static void checkOutField(const FieldId name, DM PETScDM, FieldDict &fields);
 
   /**
    * Queries the global distributed DOfs for a certain field vector. If the vector exists,
    * it is properly transferred to the global partition (LocalToGlobal). If it does not exist,
    * and assertation error is thrown.
-   * @param [in] name A string specifying the field name.
+   * @param [in] name The field id.
    * @param [in] PETScDM A pointer to the governing PETScDM.
    * @param [in/out] A map containing references to the global fields.
    */
-  static void checkInField(const std::string &name, DM PETScDM, FieldDict &fields);
+  static void checkInField(const FieldId name, DM PETScDM, FieldDict &fields);
 
   /**
    * Sets a global/local field pair to zero.
-   * @param [in] name A string specifying the field name.
+   * @param [in] name The field id.
    * @param [in/out] A map containing references to the global fields.
    */
-  static void zeroField(const std::string &name, FieldDict &fields);
+  static void zeroField(const FieldId name, FieldDict &fields);
 
 
 };
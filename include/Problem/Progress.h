@@ -0,0 +1,55 @@
+#pragma once
+
+// stl.
+#include <chrono>
+#include <memory>
+
+// 3rd party.
+#include <petsc.h>
+
+class Options;
+
+/**
+ * Throttled progress of a shot: simulated time, steps and global dof updates per second, the estimated time
+ * to completion, and the imbalance between ranks.
+ *
+ * A report is collective, so every rank must take it at the same step. With --progress-every, reports are
+ * every that many steps. Otherwise they are about every --progress-interval seconds: each report turns the
+ * interval into a number of steps, from the (reduced, hence common) rate since the previous one. The first
+ * report, after the first step, only measures this rate.
+ *
+ * The imbalance is the largest over the mean work of the ranks since the previous report, where the work of
+ * a rank is its wall time less the time it spent completing halo exchanges (see Problem::ExchangeSeconds).
+ * A rank on a degraded node shows up as an imbalance above 1 (and, often, as the other ranks waiting).
+ */
+class Progress {
+
+ public:
+
+  /**
+   * @param [in] shot Options of the shot (duration and progress options).
+   * @param [in] num_dof Global degrees of freedom updated per step.
+   */
+  Progress(std::unique_ptr<Options> const &shot, const PetscInt num_dof);
+
+  /**
+   * Called after each time step, on all ranks (collective at the steps which are reported).
+   * @param [in] time_idx Number of steps taken.
+   * @param [in] time Simulated time reached.
+   * @param [in] exchange_seconds Seconds spent in halo exchanges so far (Problem::ExchangeSeconds).
+   */
+  void step(const PetscInt time_idx, const PetscReal time, const PetscReal exchange_seconds);
+
+ private:
+
+  typedef std::chrono::steady_clock clock;
+
+  PetscReal mDuration, mInterval;
+  PetscInt mEvery, mNumDof;
+
+  /// Step of the next report, and the state at the previous one.
+  PetscInt mNextStep, mLastStep;
+  PetscReal mLastTime, mLastExchange;
+  clock::time_point mLastWall;
+
+};
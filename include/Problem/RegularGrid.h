@@ -0,0 +1,104 @@
+#pragma once
+
+// stl.
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+#include <hdf5.h>
+
+// salvus.
+#include <Utilities/Types.h>
+
+class Options;
+
+/**
+ * Wavefields of a shot interpolated to a regular grid (--grid-file), for tools which can not read the GLL points.
+ *
+ * The grid is given by its first point (--grid-origin), the spacing (--grid-spacing) and the number of points
+ * (--grid-shape) along each axis. At setup, every point is located in a local element, whose Lagrange polynomials
+ * at the point's reference coordinates give a row of a sparse (PETSc) interpolation matrix, from the global dofs
+ * to the grid points. A frame of a field (--grid-fields, by default the displacement) every --grid-every steps is
+ * then a single product with that matrix. The file holds:
+ *
+ *   /origin, /spacing  dim, the grid.
+ *   /time              #frames, the time of each frame.
+ *   /<field>           #frames x [nz x] ny x nx x #components, grown by one frame per write, and chunked by frame.
+ *
+ * with NaN at the points outside the mesh. The rows of the matrix are distributed by lines of the grid along x,
+ * so that each rank writes one block of lines (in rank order). A point on the faces of several elements takes the
+ * row of the lowest rank holding one of them. The elements must be quads or hexes.
+ */
+class RegularGrid {
+
+ public:
+
+  /**
+   * Create the file and write the grid (collective).
+   * @param [in] shot Options of the shot (--grid-file, --grid-origin, --grid-spacing, --grid-shape, --grid-every,
+   * --grid-fields).
+   */
+  RegularGrid(std::unique_ptr<Options> const &shot);
+
+  ~RegularGrid();
+  RegularGrid(const RegularGrid&) = delete;
+  RegularGrid &operator=(const RegularGrid&) = delete;
+
+  /**
+   * Locate the grid points in the elements, and build the interpolation matrix (collective).
+   * @param [in] elements Vector of all elements, with their vertex coordinates.
+   * @param [in] PETScDM The PETSc DM.
+   * @param [in] PETScSection The mesh section, with the global dofs laid out.
+   * @param [in] fields The global fields, which must hold the interpolated ones.
+   * @throws std::runtime_error If the elements are not quads or hexes, or a field is not registered.
+   */
+  void setup(ElemVec const &elements, DM PETScDM, PetscSection PETScSection, FieldDict &fields);
+
+  /** Whether write is due after some number of steps. */
+  bool Due(const PetscInt time_idx) const { return !(time_idx % mEvery); }
+
+  /**
+   * Interpolate the fields to the grid, and append them as a frame (collective).
+   * @param [in] time Simulated time of the fields.
+   * @param [in] fields The global fields.
+   */
+  void write(const PetscReal time, FieldDict &fields);
+
+  /** Number of grid points (over all ranks) inside the mesh. */
+  inline PetscInt NumInside() const { return mNumInside; }
+
+ private:
+
+  std::vector<PetscReal> mOrigin, mSpacing;
+  std::vector<std::string> mFields;
+  PetscInt mEvery, mNumDim, mNumComponents;
+
+  /// Points along each axis (nx, ny, nz, with nz = 1 in 2D), and the first line along x of each rank (with the
+  /// number of lines last).
+  hsize_t mShape[3];
+  std::vector<hsize_t> mFirstLine;
+
+  /// Weights of the global dofs at each grid point of this rank's lines (all components), and the values of a
+  /// frame at them.
+  Mat mWeights;
+  Vec mValues;
+
+  /// Points of this rank's lines outside the mesh, relative to its first point, and the points inside overall.
+  std::vector<PetscInt> mOutside;
+  PetscInt mNumInside;
+
+  /// File, time and field datasets, and the number of frames written.
+  hid_t mFileId, mTimeSet;
+  std::map<std::string, hid_t> mSets;
+  hsize_t mNumFrames;
+
+  /** Rank holding a line of the grid. */
+  int lineRank(const hsize_t line) const;
+
+  /** Create the (empty) dataset of a field, on its first frame (collective). */
+  hid_t fieldSet(const std::string &field);
+
+};
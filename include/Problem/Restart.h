@@ -0,0 +1,89 @@
+#pragma once
+
+// stl.
+#include <memory>
+#include <string>
+#include <vector>
+
+// 3rd party.
+#include <mpi.h>
+#include <petsc.h>
+
+// salvus.
+#include <Utilities/Types.h>
+#include <Utilities/Memory.h>
+#include <Utilities/AsyncWriter.h>
+
+class Options;
+
+/**
+ * Restart files, from which a later job resumes a run where it was left (--restart-every, --restart-file,
+ * --restart-from).
+ *
+ * A restart file (HDF5) holds the Newmark state of the fields (see Checkpoints::StateFields), with the time, the
+ * number of steps taken and of movie frames written, and where the receiver output stands: the samples written of
+ * each receiver, and the state of the decimation filters. The receiver output is written and flushed along with
+ * it, so that a resumed run appends to the same receiver file and movie.
+ *
+ * All ranks write the file at once, each the part of the global vectors it owns, and /ownership holds the size of
+ * each part. A restart therefore needs the same mesh and decomposition, i.e. the --save-mesh-file of the first run
+ * on the same number of ranks, and this is checked on read.
+ */
+class Restart {
+
+ public:
+
+  /**
+   * Size the state to the fields.
+   * @param [in] options Options of the shot (--async-output).
+   * @param [in] fields The global fields.
+   */
+  Restart(std::unique_ptr<Options> const &options, FieldDict &fields);
+  ~Restart();
+  Restart(const Restart&) = delete;
+  Restart &operator=(const Restart&) = delete;
+
+  /**
+   * Write a restart file (collective). The state is copied before returning, and with asynchronous output
+   * written by a background thread. It goes to a temporary file first, which replaces the file once complete,
+   * so that a job killed while writing leaves the previous restart file.
+   * @param [in] file Name of the file.
+   * @param [in] time_idx Number of steps taken.
+   * @param [in] time Simulated time.
+   * @param [in] output_frame Number of movie frames written.
+   * @param [in] fields The global fields.
+   */
+  void write(const std::string &file, const PetscInt time_idx, const PetscReal time, const PetscInt output_frame,
+             FieldDict &fields);
+
+  /**
+   * Read a restart file (collective), once the receiver output is open.
+   * @param [in] file Name of the file.
+   * @param [out] time_idx Number of steps taken.
+   * @param [out] time Simulated time.
+   * @param [out] output_frame Number of movie frames written.
+   * @param [in,out] fields The global fields, which only start from rest if resumed at step zero.
+   * @throws std::runtime_error If the file can't be read, or was written with another decomposition.
+   */
+  void read(const std::string &file, PetscInt &time_idx, PetscReal &time, PetscInt &output_frame,
+            FieldDict &fields);
+
+  /** Wait for the write in flight (if any), i.e. before other HDF5 output. */
+  void wait();
+
+  /** Heap bytes held by the copy of the state. */
+  size_t MemoryBytes() const { return Memory::bytes(mSnapshot); }
+
+ private:
+
+  /// Fields of the state, with the first of this rank's values and their number.
+  std::vector<std::string> mFields;
+  std::vector<PetscInt> mStarts, mSizes;
+
+  /// Copy of the state written from, the thread writing it, and a copy of the communicator for the thread's
+  /// collective calls.
+  std::vector<double> mSnapshot;
+  std::unique_ptr<AsyncWriter> mWriter;
+  MPI_Comm mComm;
+
+};
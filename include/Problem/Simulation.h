@@ -0,0 +1,184 @@
+#pragma once
+
+// stl.
+#include <memory>
+#include <string>
+
+// 3rd party.
+#include <petsc.h>
+
+// salvus.
+#include <Utilities/Types.h>
+#include <Element/Element.h>
+#include <Utilities/Memory.h>
+
+class Mesh;
+class Problem;
+class ExodusModel;
+class Options;
+class Misfit;
+
+/**
+ * A simulation session, which keeps the mesh, model, elements and fields alive over several shots.
+ *
+ * Setting up a run (reading the mesh and model, decomposition, element construction, global dofs and the mass
+ * matrix) does not depend on the sources and receivers. The constructor therefore does all of this once, and
+ * each shot (run) only attaches its own sources and receivers, zeroes the fields, and steps through time. The
+ * shots of a survey can then be run in a single process, i.e. from --shot-files.
+ */
+class Simulation {
+
+  std::unique_ptr<Mesh> mMesh;
+  std::unique_ptr<ExodusModel> mModel;
+  std::unique_ptr<Problem> mProblem;
+  ElemVec mElements;
+  FieldDict mFields;
+
+  /// Time step chosen at setup, kept by the shots which do not set one.
+  PetscReal mTimeStep;
+
+  /// Whether to report the memory of each subsystem (--memory-report).
+  bool mMemoryReport;
+
+  /// Misfit of the last gradient, which keeps the observed data read for its receivers (see runGradient).
+  std::unique_ptr<Misfit> mMisfit;
+
+  /// Kernels of the local elements, of the last adjoint run, and the mass of each element.
+  RealVec mStiffnessKernel, mMassKernel;
+  std::vector<RealVec> mElementMass;
+
+  /// Kernels at the integration points of the local elements (see Element::computeKernels), in single
+  /// precision: element e holds #points x #kernels values (column major) from mPointKernelOffset[e] on.
+  std::vector<float> mPointKernels;
+  std::vector<size_t> mPointKernelOffset;
+
+  /**
+   * Add a step to the kernels, for the forward wavefield in the fields and the adjoint one (collective).
+   * @param [in] adjoint The global fields of the adjoint wavefield.
+   * @param [in] dt Time step.
+   * @param [in] point_dt Time step of the kernels at the integration points, or 0 to leave them out of this
+   * step (see --kernel-every).
+   */
+  void accumulateKernels(FieldDict &adjoint, const PetscReal dt, const PetscReal point_dt);
+
+  /**
+   * Write the kernels of the last adjoint run (collective): the element kernels and those at the integration
+   * points to an HDF5 file, and those at the element vertices into the model (see --kernel-vertex-file).
+   * @param [in] options Options of the shot.
+   */
+  void writeKernels(std::unique_ptr<Options> const &options);
+
+ public:
+
+  /**
+   * Read the mesh and model, and set up the elements and global dofs (collective).
+   * @param [in] options A reference to the options class.
+   */
+  Simulation(std::unique_ptr<Options> const &options);
+  ~Simulation();
+
+  /**
+   * Run one shot (collective): attach the shot's sources and receivers to the elements, reset the fields,
+   * and step through the shot's duration (or solve a static problem, see StaticSolver).
+   * @param [in] shot Options of the shot (sources, receivers, duration, output). The mesh, model and
+   * physics options are those given at setup.
+   * @returns The number of time steps taken (none for a static problem).
+   */
+  PetscInt run(std::unique_ptr<Options> const &shot);
+
+  /**
+   * Measure the cost of the local elements over the first --rebalance-steps steps of a shot, and write a
+   * partition which balances it as the partition cache (collective, see Mesh::writeBalancedPartition). The cost
+   * of the sources, receivers and coupling terms of the shot shows in that of their elements, which static
+   * estimates (--weighted-partitioning) miss. Nothing is written. A Simulation set up again with the same options
+   * then loads the partition, and starts the shot from rest on it.
+   * @param [in] shot Options of the shot.
+   * @returns False if the mesh cannot be rebalanced (i.e. it was not read from an exodus file).
+   */
+  bool rebalance(std::unique_ptr<Options> const &shot);
+
+  /**
+   * Predict the cost of a shot from its setup (collective, --dry-run): report the memory per rank and the
+   * degrees of freedom, and time --dry-run-steps steps without sources, receivers or output. The compute time of
+   * a step (its wall time less that of the halo exchanges) is taken to scale with the elements per rank, and the
+   * exchange time with the halo dofs per rank, i.e. the surface of a partition, (E / P)^((d - 1) / d). From this
+   * come the wall time and core hours of the shot's --duration, and the largest power of two of ranks at which
+   * the parallel efficiency (compute over step time) stays at --target-efficiency. The exchange time is
+   * measured, so it is only modelled when there is more than one rank. Latency, which does not shrink with the
+   * partitions, makes the prediction for many more ranks optimistic.
+   * @param [in] shot Options of the shot (its duration and time step).
+   */
+  void dryRun(std::unique_ptr<Options> const &shot);
+
+  /**
+   * Run the adjoint of a shot (collective), which gives the sensitivity kernels of each element. The adjoint
+   * wavefield is driven by the sources of the adjoint shot (i.e. the time reversed residuals at the receivers),
+   * and steps from the end of the shot to its start. The forward wavefield is needed in reverse order with it:
+   * one forward run stores checkpoints, from which the states in between are recomputed (see Checkpoints), or
+   * with --adjoint-reconstruction boundary, it records the absorbing boundaries and then steps back from its final
+   * state (see BoundaryWavefield).
+   *
+   * For the (self-adjoint) equations without attenuation, the derivatives of a misfit with respect to the log of
+   * the stiffness and of the mass of element e are
+   *
+   *   K_e = -int_0^T u+(T - t) . K_e u(t) dt,  M_e = -int_0^T u+(T - t) . M_e a(t) dt,
+   *
+   * with the forward displacement u and acceleration a, and the adjoint displacement u+.
+   * @param [in] forward Options of the shot (its sources, without receivers).
+   * @param [in] adjoint Options of the adjoint shot (its sources, without receivers), of the same duration.
+   * @returns The number of time steps taken by the adjoint wavefield.
+   */
+  PetscInt runAdjoint(std::unique_ptr<Options> const &forward, std::unique_ptr<Options> const &adjoint);
+
+  /**
+   * Run a shot and its adjoint (collective, --observed-data-file): the synthetics at the receivers are kept in
+   * memory, measured against the observed data (see Misfit), and their adjoint sources drive the adjoint shot
+   * (see runAdjoint), without writing the synthetics or reading back an adjoint shot file. The receivers must
+   * record every step. The synthetics are not written by the forward run.
+   * @param [in] shot Options of the shot (its sources and receivers).
+   * @returns The number of time steps taken by the adjoint wavefield.
+   */
+  PetscInt runGradient(std::unique_ptr<Options> const &shot);
+
+  /**
+   * Run the reciprocal shots of a survey (collective, --reciprocal): for each receiver and axis, a point force at
+   * the receiver, with the strain (and displacement) recorded at each source. By reciprocity, G_ij(x_r, x_s) =
+   * G_ji(x_s, x_r), so component i at receiver r of a moment tensor source M at x_s is M : e(x_s), with e the
+   * strain when the force is along axis i. A point force f gives f . u(x_s). There is then one shot per receiver
+   * and component, whatever the number of sources. The seismograms are written to the receiver file, as one
+   * dataset per component (i.e. /ux) of #sources x #receivers x #samples, in the order of the options. They are
+   * those of the sources' time function (which the reciprocal force shares) and amplitudes. With --sgt-file, the
+   * strain at the points of --sgt-points is written to a database after each shot as well (see StrainDatabase).
+   * @param [in] options Options of the survey (its sources and receivers).
+   * @returns The number of time steps taken by all shots.
+   */
+  PetscInt runReciprocal(std::unique_ptr<Options> const &options);
+
+  /** Stiffness and mass kernels of the local elements, from the last adjoint run (see runAdjoint). */
+  inline const RealVec &StiffnessKernel() const { return mStiffnessKernel; }
+  inline const RealVec &MassKernel() const { return mMassKernel; }
+  /** Kernels at the integration points of a local element, one column per Element::KernelNames. */
+  inline Eigen::Map<const Eigen::MatrixXf> PointKernels(const PetscInt elm) const {
+    const PetscInt num_pnt = mElements[elm]->NumIntPnt();
+    return Eigen::Map<const Eigen::MatrixXf>(mPointKernels.data() + mPointKernelOffset[elm], num_pnt,
+                                            (mPointKernelOffset[elm + 1] - mPointKernelOffset[elm]) / num_pnt);
+  }
+
+  /**
+   * Options of one shot: the command line, with the options in a shot file on top (collective).
+   * @param [in] argc Number of command line arguments.
+   * @param [in] argv Command line arguments.
+   * @param [in] file PETSc options file of the shot.
+   * @returns The parsed options.
+   */
+  static std::unique_ptr<Options> ShotOptions(int argc, char **argv, const std::string &file);
+
+  inline FieldDict &Fields() { return mFields; }
+
+  /** Number of global degrees of freedom (all field components, over all ranks). */
+  PetscInt NumGlobalDof();
+
+  /** Bytes held by each subsystem on this rank (see Memory). */
+  Memory::Bytes MemoryBytes();
+
+};
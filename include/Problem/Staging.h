@@ -0,0 +1,104 @@
+#pragma once
+
+// stl.
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+#ifdef SALVUS_ADIOS2
+#include <adios2.h>
+#endif
+
+// salvus.
+#include <Utilities/Types.h>
+
+class Options;
+
+/**
+ * Wavefields and receiver samples of a shot published while stepping to an ADIOS2 stream (--staging-stream),
+ * which analysis or rendering on other nodes reads concurrently, instead of going through files.
+ *
+ * Every --staging-every steps is a step of the stream, with the engine of --staging-engine (SST by default;
+ * SSC, or BP4 to a file for debugging, work alike). A step holds the variables
+ *
+ *   time                  the time of the step (a single value).
+ *   <field>               #dofs x #components, the owned dofs of each of --staging-fields (by default the
+ *                         displacement), one block per rank in rank order.
+ *   receivers/<field>     #receivers, the latest sample of each field recorded by the receivers (in the order of
+ *                         the options; only those recording the field are set).
+ *
+ * and the first step the mesh as well:
+ *
+ *   coordinates           #dofs x dim, the physical coordinates of the dofs.
+ *   connectivity          #elements x #nodes, the dofs (rows of the fields) of each element, in the tensor
+ *                         order of its GLL points (padded with -1 for elements with fewer nodes).
+ *
+ * The stream is an optional dependency: without ADIOS2 found by CMake, --staging-stream is an error.
+ */
+class Staging {
+
+ public:
+
+  /** Whether salvus was built with ADIOS2. */
+  static bool Available();
+
+  /**
+   * Open the stream (collective). With SST, this waits for the readers its parameters ask for (none by default).
+   * @param [in] shot Options of the shot (--staging-stream, --staging-engine, --staging-every, --staging-fields).
+   * @throws std::runtime_error If salvus was built without ADIOS2.
+   */
+  Staging(std::unique_ptr<Options> const &shot);
+
+  /** Close the stream (collective). */
+  ~Staging();
+  Staging(const Staging&) = delete;
+  Staging &operator=(const Staging&) = delete;
+
+  /**
+   * Select the owned dofs and the connectivity of the elements, and define the variables (collective).
+   * @param [in] elements Vector of all elements.
+   * @param [in] PETScDM The PETSc DM.
+   * @param [in] PETScSection The mesh section, with the global dofs laid out.
+   * @param [in] fields The global fields, which must hold the published ones.
+   */
+  void setup(ElemVec const &elements, DM PETScDM, PetscSection PETScSection, FieldDict &fields);
+
+  /** Whether write is due after some number of steps. */
+  bool Due(const PetscInt time_idx) const { return !(time_idx % mEvery); }
+
+  /**
+   * Publish a step of the stream (collective).
+   * @param [in] time Simulated time of the fields.
+   * @param [in] fields The global fields.
+   */
+  void write(const PetscReal time, FieldDict &fields);
+
+  /** Number of steps published. */
+  inline PetscInt NumSteps() const { return mNumSteps; }
+
+ private:
+
+  std::vector<std::string> mFields;
+  PetscInt mEvery, mNumDim, mNumComponents, mNumReceivers, mNumSteps;
+
+  /// Owned dofs, as the index of their first component in the local part of the global vectors, their
+  /// coordinates, and the connectivity of the local elements (#nodes rows of the fields each).
+  std::vector<PetscInt> mDofs;
+  std::vector<PetscReal> mCoordinates;
+  std::vector<int64_t> mConnectivity;
+
+  /// Dofs and elements over all ranks, the first of this rank's, and the nodes per element.
+  unsigned long long mNumDofs, mDofOffset, mNumElements, mElementOffset;
+  PetscInt mNumNodes;
+
+#ifdef SALVUS_ADIOS2
+  /// The ADIOS2 instance, the IO of the stream, and its engine.
+  std::unique_ptr<adios2::ADIOS> mAdios;
+  adios2::IO mIo;
+  adios2::Engine mEngine;
+#endif
+
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <Problem/Problem.h>
+
+/**
+ * Solve for the static displacement under the loads of the sources, K u = f, without a global matrix. The
+ * stiffness matrix is a PETSc shell, whose product is the element loop of the time steppers (see
+ * Problem::assembleLevel): with the forces a(x) = f - K x, K x = a(0) - a(x). Homogeneous Dirichlet dofs are
+ * taken out of the products and given identity rows, which keeps the operator symmetric, and the system is
+ * solved by conjugate gradients (the PETSc options of the solver take the prefix -static_).
+ *
+ * The Jacobi preconditioner takes the assembled diagonal of the stiffness, found once by probing each element's
+ * stiffness term with the unit fields of its dofs. A single displacement field is solved for, i.e. scalar
+ * physics, or vector physics with interleaved components (--interleaved-components).
+ */
+class StaticSolver: public Problem {
+
+  /// Stiffness operator (shell) and its solver.
+  Mat mOperator;
+  KSP mKsp;
+
+  /// Load of the last solve, diagonal of the stiffness (with the Dirichlet dofs at one), the solution, and
+  /// the work vector of a product.
+  Vec mLoad, mDiagonal, mSolution, mWork;
+
+  /// Fields, time and DM of the solve in progress, for the products.
+  FieldDict *mFields;
+  PetscReal mTime;
+  DM mDM;
+
+  /// Relative residual and preconditioner of the solve (see Options::StaticTolerance).
+  PetscReal mTolerance;
+  std::string mPreconditioner;
+
+  /**
+   * Sum the diagonal of the element stiffness matrices into mDiagonal (collective).
+   * @param [in] elements Vector of all elements.
+   * @param [in] mesh A pointer to the mesh wrapper.
+   */
+  void assembleDiagonal(ElemVec const &elements, std::unique_ptr<Mesh> &mesh);
+
+  /**
+   * Apply the stiffness operator (collective).
+   * @param [in] x Displacement.
+   * @param [out] y Stiffness term of the displacement, and the displacement itself on the Dirichlet dofs.
+   */
+  void applyStiffness(Vec x, Vec y);
+
+  /** PETSc callbacks of the shell operator. */
+  static PetscErrorCode Apply(Mat op, Vec x, Vec y);
+  static PetscErrorCode GetDiagonal(Mat op, Vec diag);
+
+ public:
+
+  StaticSolver(const std::unique_ptr<Options> &options);
+  ~StaticSolver();
+
+  /**
+   * Set up the displacement and force fields, the assembly plan, and the solver with its preconditioner.
+   * @param [in] elements Vector of all elements (with material parameters attached).
+   * @param [in] mesh A pointer to the mesh wrapper.
+   * @returns A dictionary of modified fields.
+   * @throws std::runtime_error If the physics has several displacement fields, or an element pulls a field
+   * other than the displacement (i.e. on an absorbing boundary).
+   */
+  FieldDict initializeGlobalDofs(ElemVec const &elements, std::unique_ptr<Mesh> &mesh);
+
+  /**
+   * Zero the fields, and take the diagonal of the new material.
+   */
+  FieldDict reinitializeGlobalDofs(ElemVec const &elements, std::unique_ptr<Mesh> &mesh, FieldDict fields);
+
+  /** There is no mass matrix. */
+  FieldDict applyInverseMassMatrix(FieldDict fields) { return fields; }
+
+  /** @throws std::runtime_error A static problem is not stepped through time. */
+  std::tuple<FieldDict, PetscScalar> takeTimeStep(
+      FieldDict fields, PetscScalar time, std::unique_ptr<Options> const &options);
+
+  /**
+   * Solve for the displacement, starting from the current one, and record it at the receivers. The forces
+   * are left with the residual f - K u.
+   * @throws std::runtime_error If the solver does not converge.
+   */
+  FieldDict solveStatic(FieldDict fields, const PetscReal time, DM PETScDM);
+
+};
@@ -0,0 +1,73 @@
+#pragma once
+
+// stl.
+#include <memory>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+#include <hdf5.h>
+
+class Options;
+
+/**
+ * Strain Green's function database of a reciprocal survey (--sgt-file, see Simulation::runReciprocal).
+ *
+ * Each reciprocal shot (a unit force along one axis at a receiver) records the strain at the candidate source
+ * points of --sgt-points (e.g. a fault grid), which follow the sources among its receivers. The strain is low-pass
+ * filtered and decimated by --sgt-every, as the samples of a decimated receiver, so that the database holds the
+ * band of the force's time function at a fraction of the samples. After each shot, the points of all ranks are
+ * written in one collective write. The file holds:
+ *
+ *   /coordinates       #points x dim, the points.
+ *   /receivers         #receivers x dim, the receivers the forces act at.
+ *   /strain            #receivers x dim x #points x #strain x #samples: strain component k (in the order of
+ *                      Receiver::StrainNames) at a point, of the force at a receiver along an axis. Chunked by
+ *                      blocks of points of a shot.
+ *   /strain_grid       #receivers x dim x #points x #strain x 2, with --sgt-tolerance only: the lowest level and
+ *                      step of each trace, whose samples /strain then holds as levels (see Compression).
+ *
+ * and the attributes dt (between samples), center_freq and time_delay (of the Ricker time function of the forces)
+ * of the root group. Component i at receiver r of a moment tensor source M at point p is then M : e(r, i, p), as
+ * for the reciprocal seismograms of the sources (with twice the off diagonal terms), for that time function.
+ */
+class StrainDatabase {
+
+ public:
+
+  /**
+   * Create the database and write the points and receivers (collective).
+   * @param [in] options Options of the survey (--sgt-file, --sgt-points, --sgt-every, --sgt-tolerance), with its
+   * time step.
+   */
+  StrainDatabase(std::unique_ptr<Options> const &options);
+
+  ~StrainDatabase();
+  StrainDatabase(const StrainDatabase&) = delete;
+  StrainDatabase &operator=(const StrainDatabase&) = delete;
+
+  /**
+   * Write the strain recorded at the points by the receivers of a reciprocal shot, just run (collective).
+   * @param [in] receiver Number of the receiver of the shot.
+   * @param [in] component Axis of its force.
+   * @throws std::runtime_error If a point did not record the strain (i.e. it does not lie in an elastic element).
+   */
+  void write(const PetscInt receiver, const PetscInt component);
+
+ private:
+
+  /// The file, its strain and grid datasets, and the (file) type of the strain.
+  hid_t mFileId, mStrainSet, mGridSet, mType;
+
+  /// Number of points, strain components and samples, the receiver number of the first point in a shot, and the
+  /// relative tolerance of the quantised strain (0 for float).
+  hsize_t mNumPoints, mNumStrain, mNumSamples;
+  PetscInt mNumDim, mFirst;
+  double mTolerance;
+
+  /** Write the rows (#strain x num_cols each) of some points of a shot, ascending, in one collective write. */
+  static void writePoints(hid_t set, const PetscInt receiver, const PetscInt component,
+                          const std::vector<hsize_t> &points, const hsize_t num_strain, const hsize_t num_cols,
+                          hid_t mem_type, const void *buf);
+
+};
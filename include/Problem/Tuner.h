@@ -0,0 +1,83 @@
+#pragma once
+
+// stl.
+#include <memory>
+#include <string>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+
+class Mesh;
+class Options;
+class ExodusModel;
+
+/**
+ * Startup choice between the variants of the element kernels which are selected at run time.
+ *
+ * Tensor elements (quads and hexes) either store their Jacobians, or recompute them from the vertices in each
+ * call (--low-memory-geometry), and up to order 3 they may also apply dense element stiffness matrices instead
+ * of the sum-factorized derivatives (--dense-element-stiffness, scalar physics only). When built with LIBXSMM,
+ * their stored geometry variant is also tried with the contractions as generated small matrix products
+ * (--small-gemm), whose speed depends on the instruction set of the processor. Simplices either store dense
+ * per-element operators, or apply the reference derivatives with the geometric coefficients of the element
+ * (--simplex-reference-stiffness). Which is faster
+ * depends on the order, the number of elements per rank (whether the stored data still fits in cache) and the
+ * machine, and the stored variants may not fit into memory at all.
+ *
+ * tune builds each variant on a sample of the local elements of every rank, and times their stiffness term
+ * over a few iterations. The fastest variant on average over the ranks is used, unless the elements of some
+ * rank would need more than --auto-tune-memory MB with it (estimated from the sample, see Element::MemoryBytes).
+ * The choice is remembered in --auto-tune-file, keyed by the hardware, element type and order, and later runs
+ * with the same key use it without timing.
+ */
+class Tuner {
+
+ public:
+
+  /**
+   * Choose the kernel variant of the elements of a mesh, and set it in the options (collective). Called before
+   * the elements are built (see Problem::initializeElements).
+   * @param [in] mesh The mesh, with its topology set up.
+   * @param [in] model The model.
+   * @param [in] options Options, whose variant flags are set.
+   */
+  static void tune(std::unique_ptr<Mesh> const &mesh, std::unique_ptr<ExodusModel> const &model,
+                   std::unique_ptr<Options> const &options);
+
+  /** Description of the processor of the first rank (its model name and number of hardware threads). */
+  static std::string Hardware();
+
+ private:
+
+  /// Number of local elements sampled, and of stiffness terms timed on each.
+  const static PetscInt mSampleSize = 16;
+  const static PetscInt mIterations = 20;
+
+  /// Highest order at which the dense stiffness of tensor elements is tried.
+  const static PetscInt mMaxDenseOrder = 3;
+
+  /** A variant, and the options which select it. */
+  struct Variant {
+    std::string name;
+    PetscBool flag;
+    PetscBool dense;
+    PetscBool gemm;
+  };
+
+  /** Set the flags of a variant in the options (flag is that of the element family of type). */
+  static void apply(const std::string &type, const Variant &variant, std::unique_ptr<Options> const &options);
+
+  /**
+   * Time the stiffness term of a sample of the local elements (collective).
+   * @param [out] seconds Mean seconds per stiffness term over all ranks (0 if no rank has elements).
+   * @param [out] megabytes Estimated MB of the elements of the rank which would need the most.
+   */
+  static void measure(std::unique_ptr<Mesh> const &mesh, std::unique_ptr<ExodusModel> const &model,
+                      std::unique_ptr<Options> const &options, double &seconds, double &megabytes);
+
+  /** Variant cached for a key in a file (empty if none), and remember a choice (first rank only). */
+  static std::string readCache(const std::string &filename, const std::string &key);
+  static void writeCache(const std::string &filename, const std::string &key, const std::string &variant);
+
+};
@@ -0,0 +1,104 @@
+#pragma once
+
+// stl.
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+
+// forward decl.
+class Options;
+class Receiver;
+
+/**
+ * Misfit of the synthetics at the receivers against observed data, and its adjoint sources, computed in process
+ * from the samples the receivers hold (see Simulation::runGradient), instead of writing the synthetics and reading
+ * back adjoint sources computed by another tool.
+ *
+ * The observed data is read from a file in the layout of the receiver output: one dataset per recorded field
+ * (/u, or /ux, /uy and /uz), of #receivers x #samples, with row i holding receiver i. Each rank reads only the rows
+ * of its own receivers, and keeps them for the later gradients of the same receivers.
+ *
+ * Each component of each receiver is measured on its own, and the misfits are summed:
+ *
+ *   l2        chi = 1/2 int (s - d)^2 dt, with the adjoint source s - d.
+ *   cc        chi = 1/2 dT^2, with the traveltime shift dT of the peak of the cross-correlation of the synthetic
+ *             s and the data d (refined between samples), searched up to --misfit-max-shift. The adjoint source
+ *             is dT s' / int s'^2 dt (Tromp et al., 2005).
+ *   tf-phase  chi = 1/2 int int W^2 (phi_s - phi_d)^2 dt dw, with the phases phi of the Gabor transforms of s and
+ *             d (a Gaussian window of one period of --misfit-max-frequency, on a grid of half a window in time
+ *             and of 32 frequencies up to --misfit-max-frequency), weighted by the normalized envelope W of the
+ *             data, and wrapped to (-pi, pi] (Fichtner et al., 2008). The adjoint source is the exact derivative
+ *             of the discrete misfit.
+ *
+ * An adjoint source is the derivative of the misfit by the synthetic, per unit time. The adjoint shot steps from
+ * the end of the forward shot, so its force at step k is the adjoint source at forward step N - k.
+ */
+class Misfit {
+
+ public:
+
+  /// Measures of the misfit.
+  enum Type { L2, CrossCorrelation, TimeFrequencyPhase };
+
+  /**
+   * Misfit of the options.
+   * @param [in] options The options of the shot (--observed-data-file, --misfit, --misfit-max-frequency and
+   * --misfit-max-shift).
+   */
+  Misfit(std::unique_ptr<Options> const &options);
+
+  /** Observed data file. */
+  inline const std::string &File() const { return mFile; }
+
+  /**
+   * Read the observed data of the receivers not read yet (on this rank only).
+   * @param [in] receivers Receivers on this rank.
+   * @throws std::runtime_error If the file does not hold a recorded field of a receiver.
+   */
+  void load(const std::vector<Receiver*> &receivers);
+
+  /**
+   * Measure the misfit of the receivers (collective), and set their adjoint sources (see AdjointSource), time
+   * reversed for the adjoint shot. The observed data is read first, if needed.
+   * @param [in] receivers Receivers on this rank, their samples those of the forward shot.
+   * @param [in] dt Time step of the shot.
+   * @param [in] num_steps Steps of the shot.
+   * @returns The misfit, summed over all receivers.
+   */
+  double evaluate(const std::vector<Receiver*> &receivers, const PetscReal dt, const PetscInt num_steps);
+
+  /**
+   * Misfit of a single trace.
+   * @param [in] syn Synthetic samples.
+   * @param [in] obs Observed samples (as many).
+   * @param [in] dt Sampling interval.
+   * @param [out] adj Adjoint source of each sample.
+   * @returns The misfit.
+   */
+  double measure(const std::vector<double> &syn, const std::vector<double> &obs, const PetscReal dt,
+                 std::vector<double> &adj) const;
+
+  /** Displacement fields of a receiver, which the misfit measures, in the order of the source components. */
+  static std::vector<std::string> MeasuredFields(const Receiver &receiver);
+
+ private:
+
+  std::string mFile;
+  Type mType;
+  PetscReal mMaxFrequency, mMaxShift;
+
+  /// Observed samples of each measured field of the receivers read so far, by receiver number.
+  std::map<long, std::vector<std::vector<double>>> mObserved;
+
+  double l2(const std::vector<double> &syn, const std::vector<double> &obs, const PetscReal dt,
+            std::vector<double> &adj) const;
+  double crossCorrelation(const std::vector<double> &syn, const std::vector<double> &obs, const PetscReal dt,
+                          std::vector<double> &adj) const;
+  double timeFrequencyPhase(const std::vector<double> &syn, const std::vector<double> &obs, const PetscReal dt,
+                            std::vector<double> &adj) const;
+
+};
@@ -3,8 +3,12 @@
 // stl.
 #include <memory>
 #include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
 
 // 3rd party.
+#include <petsc.h>
 #include <Eigen/Dense>
 
 // forward decl.
@@ -30,6 +34,38 @@ class Receiver {
   std::string mName;
   /** < Receiver name */
 
+  bool mStrain, mStress, mRotation;
+  /** < Whether the strain, stress and rotation are recorded as well (elastic physics only, see GradientFields) */
+
+  static std::vector<float> mBlock;
+  static std::vector<Receiver*> mStoreReceivers;
+  static std::vector<std::string> mStoreFields;
+  static size_t mStoreCapacity;
+  /** < Samples of all receivers on this rank (field x receiver x time, see allocateStore), and its layout */
+
+  std::vector<std::string> mFields;
+  /** < Fields recorded by index (see registerFields) */
+
+  std::vector<float*> mSeries;
+  std::vector<size_t> mCount;
+  size_t mCapacity;
+  /** < Samples of each registered field inside mBlock, how many were taken, and room for each */
+
+  PetscInt mDecimation;
+  std::vector<double> mTaps;
+  std::vector<std::vector<double>> mHistory;
+  std::vector<size_t> mNumInputs;
+  /** < Decimation factor, anti-alias filter, and the latest inputs (and their number) of each field */
+
+  /** < Half width of the anti-alias filter, in output samples */
+  static const PetscInt mFilterHalfWidth = 8;
+
+  /** Filter one input of a field, and keep the output if this input completes one. */
+  void filter(const double val, const PetscInt field);
+
+  /** Feed zeros (i.e. the medium at rest) until the outputs centred on all inputs taken so far are complete. */
+  void flushFilter();
+
  protected:
 
   std::map<std::string,std::vector<float>> store;
@@ -38,9 +74,52 @@ class Receiver {
  public:
 
   inline void SetNum(const PetscInt num) { mNum = num; }
-  Receiver(std::unique_ptr<Options> const &options);
+  /**
+   * Receiver of the options.
+   * @param [in] num Number of the receiver, in the order of the options (and of the output rows).
+   */
+  Receiver(std::unique_ptr<Options> const &options, const PetscInt num);
   virtual ~Receiver();
-  static std::vector<std::unique_ptr<Receiver>> Factory(std::unique_ptr<Options> const &options);
+
+  /**
+   * The receivers of the options, or only those within a box, i.e. those which this rank may hold. The others
+   * are not built, so that each rank only holds about its own receivers. They keep their number.
+   * @param [in] box Lower then upper corner of the box, or empty for all receivers.
+   */
+  static std::vector<std::unique_ptr<Receiver>> Factory(std::unique_ptr<Options> const &options,
+                                                        const std::vector<double> &box = std::vector<double>());
+
+  /**
+   * Open the output of the receivers in the store, in the format of the receiver file (collective).
+   * Samples are then written every --receiver-write-every steps (see writeOutput), into one dataset per
+   * field for all receivers.
+   * @param [in] options Receiver options (file, number of receivers and of time steps).
+   */
+  static void openOutput(std::unique_ptr<Options> const &options);
+
+  /** Write the samples taken since the last write (collective). */
+  static void writeOutput();
+
+  /** Wait for the write in flight, with asynchronous output (--async-output). */
+  static void waitOutput();
+
+  /** Write the remaining samples and close the output (collective). */
+  static void closeOutput();
+
+  /** Write what the output holds so far to disk (collective), with no write in flight. */
+  static void flushOutput();
+
+  /** Number of samples written of each receiver, as far as this rank knows (its own receivers, see Restart). */
+  static std::vector<unsigned long long> OutputWritten();
+  static void SetOutputWritten(const std::vector<unsigned long long> &written);
+
+  /**
+   * State of the decimation filters of the receivers in the store: for each decimated receiver and field, the
+   * number of inputs taken and the latest inputs. A run resumed from it continues the same outputs (see Restart).
+   */
+  static std::vector<double> FilterState();
+  /** @throws std::runtime_error If the state is not that of the receivers in the store. */
+  static void SetFilterState(const std::vector<double> &state);
 
   /* Get number of active receivers. */
   static PetscInt NumReceivers() { return mNumRecs; }
@@ -49,6 +128,45 @@ class Receiver {
   inline void SetRefLocS (double val) { mRefLocS = val; }
   inline void SetRefLocT (double val) { mRefLocT = val; }
 
+  /** True if the receiver records the strain, stress or rotation as well as the displacement (see
+   * Options::ReceiverStrain). */
+  inline bool RecordsStrain() const { return mStrain; }
+  inline bool RecordsStress() const { return mStress; }
+  inline bool RecordsRotation() const { return mRotation; }
+  inline bool RecordsGradient() const { return mStrain || mStress || mRotation; }
+
+  /**
+   * Names of the quantities recorded from the gradient of the displacement, which the physics records after its
+   * own fields, in this order: the strain, the stress and the rotation, as far as they are recorded.
+   * @param [in] num_dim Number of dimensions.
+   */
+  std::vector<std::string> GradientFields(const PetscInt num_dim) const;
+
+  /** Names of all quantities which may be recorded from the gradient (in 3D, which holds those of 2D). */
+  static std::vector<std::string> GradientNames();
+
+  /**
+   * Names of the (tensor) strain components recorded with RecordsStrain, in the Voigt order of the moment tensors
+   * (xx, yy, zz, yz, xz, xy, or xx, yy, xy in 2D).
+   * @param [in] num_dim Number of dimensions.
+   */
+  static std::vector<std::string> StrainNames(const PetscInt num_dim) {
+    if (num_dim == 3) { return {"exx", "eyy", "ezz", "eyz", "exz", "exy"}; }
+    return {"exx", "eyy", "exy"};
+  }
+
+  /** Names of the stress components recorded with RecordsStress, in the same order as the strain. */
+  static std::vector<std::string> StressNames(const PetscInt num_dim) {
+    if (num_dim == 3) { return {"sxx", "syy", "szz", "syz", "sxz", "sxy"}; }
+    return {"sxx", "syy", "sxy"};
+  }
+
+  /** Names of the components of the rotation (half the curl of the displacement), or only rz in 2D. */
+  static std::vector<std::string> RotationNames(const PetscInt num_dim) {
+    if (num_dim == 3) { return {"rx", "ry", "rz"}; }
+    return {"rz"};
+  }
+
   inline long Num() { return mNum; }
   inline std::string Name() { return mName; }
   inline PetscReal LocX() { return mLocX; }
@@ -60,6 +178,107 @@ class Receiver {
 
   void record(const double val, const std::string &field);
 
+  /**
+   * Register the fields recorded by index. They are only recorded once the store is allocated.
+   * @param [in] fields Names of the fields, in the order of their index.
+   */
+  void registerFields(const std::vector<std::string> &fields);
+
+  /**
+   * Allocate the samples of the registered fields of many receivers, as one block. The block is laid out
+   * as field x receiver x time, with the fields of all receivers in order of appearance, so each time
+   * series (and each field of all receivers) is contiguous and can be written at once.
+   * @param [in] receivers Receivers held by this rank, which replace any allocated before.
+   * @param [in] num_samples Room for the samples of each field and receiver. Later samples are dropped.
+   */
+  static void allocateStore(const std::vector<Receiver*> &receivers, const size_t num_samples);
+
+  /**
+   * Record one sample of a registered field, without looking the field up or allocating.
+   * @param [in] val The sample.
+   * @param [in] field Index of the field, as registered.
+   */
+  inline void record(const double val, const PetscInt field) {
+    if (mDecimation > 1) { filter(val, field); return; }
+    if (mCount[field] < mCapacity) { mSeries[field][mCount[field]++] = val; }
+  }
+
+  /** Factor by which the samples are decimated. Output k is the low-passed input at time step k * factor. */
+  inline PetscInt Decimation() const { return mDecimation; }
+
+  /** Number of samples taken since the store was allocated or rewound (the most of any field). */
+  inline size_t Pending() const {
+    size_t num = 0;
+    for (auto count: mCount) { num = std::max(num, count); }
+    return num;
+  }
+
+  /**
+   * Linear-phase low-pass filter for decimation: a Blackman-windowed sinc with unit gain at zero frequency,
+   * cut off at 80% of the decimated Nyquist frequency, and mFilterHalfWidth output samples to each side.
+   * @param [in] decimation Decimation factor.
+   */
+  static std::vector<double> LowPass(const PetscInt decimation);
+
+  /**
+   * Number of decimated samples of a number of time steps.
+   * @param [in] num_steps Number of time steps (inputs).
+   * @param [in] decimation Decimation factor.
+   */
+  static size_t NumOutputs(const size_t num_steps, const PetscInt decimation) {
+    return (num_steps + decimation - 1) / decimation;
+  }
+
+  /**
+   * Room needed in the store for the samples of some receivers over a number of time steps. The filtered
+   * outputs lag their inputs, so those still pending at the end (see closeOutput) need room as well.
+   * @param [in] receivers The receivers.
+   * @param [in] num_steps Number of time steps between writes.
+   */
+  static size_t StoreCapacityFor(const std::vector<Receiver*> &receivers, const size_t num_steps);
+
+  /** Receivers and fields of the store, in the order of its layout. */
+  static const std::vector<Receiver*> &StoreReceivers() { return mStoreReceivers; }
+  static const std::vector<std::string> &StoreFields() { return mStoreFields; }
+
+  /** Room for the samples of each field and receiver in the store. */
+  static size_t StoreCapacity() { return mStoreCapacity; }
+
+  /**
+   * Samples of all receivers in the store, for one of its fields (#receivers x capacity, row-major).
+   * @param [in] field Index of the field in StoreFields.
+   */
+  static const float *StoreSamples(const size_t field) {
+    return mBlock.data() + field * mStoreReceivers.size() * mStoreCapacity;
+  }
+
+  /** Number of samples taken since the store was allocated or rewound. */
+  static size_t StorePending();
+
+  /** Take the next samples from the start of the store again (i.e. once they are written). */
+  static void rewindStore();
+
+  /**
+   * Swap the samples of the store with a second block of the same layout, and rewind the store. The samples
+   * taken so far can then be written from the second block while the next ones are taken.
+   * @param [in,out] block The second block, resized to the store if needed. Holds the samples on return.
+   */
+  static void swapStore(std::vector<float> &block);
+
+  /** Bytes of the sample buffers of this rank: the store, the decimation filters, and the streamed output. */
+  static size_t BufferBytes();
+
+  /** Names of all fields recorded so far (by name or by index). */
+  std::vector<std::string> Fields() const;
+
+  /**
+   * Samples of a field.
+   * @param [in] field Name of the field.
+   * @param [out] num Number of samples (0 if the field was not recorded).
+   * @return The samples (NULL if the field was not recorded).
+   */
+  const float *Samples(const std::string &field, size_t &num) const;
+
   virtual void write() = 0;
 
 };
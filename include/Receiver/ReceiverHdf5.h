@@ -1,8 +1,14 @@
 #pragma once
 
+// stl.
+#include <memory>
+
 // 3rd party.
 #include <hdf5.h>
 
+// salvus.
+#include <Utilities/AsyncWriter.h>
+
 // parents.
 #include <Receiver/Receiver.h>
 
@@ -12,15 +18,82 @@ class Options;
 class ReceiverHdf5 : public Receiver {
 
   static hid_t mFileId;
+  static std::string mFileName;
   hsize_t max_size;
   static std::vector<std::string> mWriteRegisteredFields;
 
+  /// Streamed output: file, one dataset per field (and the index of each in the store, or -1), and
+  /// the samples of each receiver, and written so far of each (decimated receivers have fewer).
+  static hid_t mStreamFileId;
+  static std::vector<hid_t> mStreamSets;
+  static std::vector<PetscInt> mStreamStoreField;
+  static hsize_t mStreamNumSamples;
+  static std::vector<hsize_t> mStreamRowWritten;
+
+  /// Asynchronous output: the thread writing the samples, the block they are written from (see
+  /// Receiver::swapStore), and a copy of the communicator for the thread's collective calls.
+  static std::unique_ptr<AsyncWriter> mStreamWriter;
+  static std::vector<float> mStreamSnapshot;
+  static MPI_Comm mStreamComm;
+
 public:
 
-  ReceiverHdf5(std::unique_ptr<Options> const &options);
+  ReceiverHdf5(std::unique_ptr<Options> const &options, const PetscInt num);
   ~ReceiverHdf5();
 
   void write();
 
+  /**
+   * Create the streamed receiver output (collective). The file holds one dataset per recorded field,
+   * i.e. /ux or /exx (see Receiver::GradientFields), of size #receivers x #samples, with row i holding
+   * receiver i (in the order of --receiver-names). The receivers held by each rank are those in the store (see
+   * Receiver::allocateStore).
+   * A decimated receiver fills its row up to its own number of samples, and /decimation holds the factor of each.
+   * @param [in] filename Name of the file.
+   * @param [in] num_receivers Number of receivers on all ranks.
+   * @param [in] num_samples Number of samples of the least decimated receiver.
+   * @param [in] decimation Decimation factor of each receiver (empty if none is decimated).
+   * @param [in] async Write from a background thread (see writeStream). Needs MPI_THREAD_MULTIPLE, and falls
+   * back to synchronous writes without it.
+   * @param [in] resume Open the file of an earlier run instead, whose datasets are continued (see Restart).
+   */
+  static void openStream(const std::string &filename, const hsize_t num_receivers, const hsize_t num_samples,
+                         const std::vector<PetscInt> &decimation, const bool async, const bool resume);
+
+  /**
+   * Label the streamed output with the encoding of the sources which fired together (collective, see
+   * --source-encoding): /source_shot, /source_polarity and /source_time_shift, one entry per source, so that the
+   * observed data can be encoded the same way.
+   * @param [in] shot Shot (field component) of each source.
+   * @param [in] polarity Polarity of each source.
+   * @param [in] time_shift Time shift of each source, as applied (in whole time steps).
+   */
+  static void writeStreamEncoding(const std::vector<PetscInt> &shot, const std::vector<double> &polarity,
+                                  const std::vector<double> &time_shift);
+
+  /**
+   * Write the samples taken since the last write, and rewind the store (collective). Each rank writes the
+   * rows of its own receivers only, in one collective hyperslab write per field. With asynchronous output,
+   * the samples are swapped into a second block and written from the background thread, and this only
+   * waits for the previous write.
+   */
+  static void writeStream();
+
+  /** Wait for the write in flight (if any), i.e. before other HDF5 output. */
+  static void waitStream();
+
+  /** Write the remaining samples, and close the streamed output (collective). */
+  static void closeStream();
+
+  /** Flush the streamed output to disk (collective), with no write in flight. */
+  static void flushStream();
+
+  /** Samples written of each receiver, which this rank only counts for its own. */
+  static const std::vector<hsize_t> &StreamRowWritten() { return mStreamRowWritten; }
+  static void SetStreamRowWritten(const std::vector<hsize_t> &written);
+
+  /** Bytes of the block the streamed samples are written from. */
+  static size_t StreamBytes() { return sizeof(float) * mStreamSnapshot.capacity(); }
+
 };
 
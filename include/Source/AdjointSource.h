@@ -0,0 +1,51 @@
+#pragma once
+
+// stl.
+#include <map>
+#include <memory>
+
+// 3rd party.
+#include <petsc.h>
+#include <Eigen/Dense>
+
+// parents.
+#include <Source/Source.h>
+
+// forward decl.
+class Options;
+
+/**
+ * Source whose time function is held in memory (source type adjoint), i.e. the adjoint source at a receiver, as
+ * computed in process from the misfit of a forward run (see Misfit and Options::AdjointShot).
+ *
+ * The time functions are set by the number of the source (that of its receiver) on the rank holding the receiver,
+ * before the adjoint shot attaches its sources, which then only look them up. They stay until cleared, i.e. by the
+ * next gradient.
+ */
+class AdjointSource: public Source {
+
+  /// Time functions of the sources on this rank (#components x #steps), by number, and that of this source.
+  static std::map<PetscInt, Eigen::MatrixXd> mTraces;
+  const Eigen::MatrixXd *mTrace;
+
+ public:
+
+  AdjointSource(std::unique_ptr<Options> const &options, const PetscInt num);
+  ~AdjointSource() {};
+
+  /**
+   * Set the time function of a source.
+   * @param [in] num Number of the source.
+   * @param [in] trace Force of each time step of the (adjoint) run, #components x #steps. Steps past the end
+   * are zero.
+   */
+  static void SetTrace(const PetscInt num, const Eigen::MatrixXd &trace) { mTraces[num] = trace; }
+  static void ClearTraces() { mTraces.clear(); }
+
+  Eigen::VectorXd evaluate(const double &time, const PetscInt &time_idx);
+  void tabulate(double *forces, const PetscInt first_step, const PetscInt num_steps, const double dt);
+
+  /** Look the time function up. @throws std::runtime_error If this rank holds none for the source. */
+  void loadData();
+
+};
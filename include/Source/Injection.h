@@ -0,0 +1,105 @@
+#pragma once
+
+// stl.
+#include <memory>
+#include <string>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+#include <hdf5.h>
+
+// salvus.
+#include <Utilities/StaticKdTree.h>
+
+// forward decl.
+class Options;
+
+/**
+ * Wavefield injected through the side sets given by --injection-boundaries, from a previous (coarser, larger)
+ * simulation, so that only a small box around the target needs to be simulated at high resolution.
+ *
+ * The injection file (--injection-file) holds the incident wavefield at the nodes of the injection boundary:
+ * the datasets "coordinates" (#points x #dim), "displacement" and "traction" (#samples x #points x #components,
+ * with one component per field of the physics), and the attributes "dt" and "start_time" of the root group,
+ * which give the time of sample k as start_time + k dt. The traction is the stress times the outward normal of
+ * the injection boundary (vp^2 du/dn for scalar physics). The faces of the boundary absorb the outgoing
+ * (scattered) waves, so that their traction is t_inc - Z (v - v_inc), with v_inc the derivative of the incident
+ * displacement (see Absorbing).
+ *
+ * The data of the points of each rank is read a window of samples at a time (--injection-window), and brought to
+ * the time of each assembly by linear interpolation between the samples. Like the source table, this is shared
+ * by the elements of the rank, and only written between their assemblies.
+ */
+class Injection {
+
+ public:
+
+  /**
+   * Open the injection file of the options, and index its points (before the elements are set up).
+   * @param [in] options Options, with --injection-file and --injection-window.
+   */
+  static void Open(std::unique_ptr<Options> const &options);
+
+  /** Forget the points and close the file. */
+  static void Close();
+
+  /** True once a file is open. */
+  static inline bool Active() { return mFile >= 0; }
+
+  /** Number of components of each point in the file. */
+  static inline PetscInt NumComponents() { return mNumCmp; }
+
+  /**
+   * Point of the file at a node of an injection boundary, which the data is then read for (safe to call from
+   * elements set up concurrently).
+   * @param [in] x Coordinates of the node.
+   * @returns Row of the point in the file.
+   */
+  static PetscInt Lookup(const PetscReal *x);
+
+  /** Order the points looked up for reading, once all elements are set up. */
+  static void Finalize();
+
+  /**
+   * Bring the incident velocity and traction of the points looked up to a time, reading a window of samples if
+   * it is not held (a no-op if already there).
+   * @param [in] time Time of the coming assembly.
+   */
+  static void Advance(const PetscReal time);
+
+  /** Incident velocity and traction of a point at the time of the last Advance (NumComponents values each). */
+  static inline const PetscReal *Velocity(const PetscInt row) { return &mVel[mSlot[row] * mNumCmp]; }
+  static inline const PetscReal *Traction(const PetscInt row) { return &mTrc[mSlot[row] * mNumCmp]; }
+
+ private:
+
+  /// The file, its displacement and traction datasets, their number of samples, points and components, and the
+  /// time of the first sample and between samples.
+  static hid_t mFile, mDsp, mTrcSet;
+  static PetscInt mNumSamples, mNumPoints, mNumCmp;
+  static PetscReal mStartTime, mDt;
+
+  /// Points of the file (for Lookup), and the largest distance to them of a node on the boundary.
+  static StaticKdTree mTree;
+  static PetscReal mTol;
+
+  /// Rows of the file read by this rank (ascending after Finalize), and the slot of each row among them (-1 if
+  /// not read).
+  static std::vector<PetscInt> mRows, mSlot;
+
+  /// Window of samples held (mWindow from mFirst on, of all rows read), as #samples x #rows x #components.
+  static PetscInt mWindow, mFirst;
+  static std::vector<PetscReal> mDspWin, mTrcWin;
+
+  /// Incident velocity and traction at mTime, #rows x #components.
+  static PetscReal mTime;
+  static std::vector<PetscReal> mVel, mTrc;
+
+  /** Read the window of samples from a sample on (those outside the file are zero). */
+  static void read(const PetscInt first);
+
+  /** Values of a row of sample k of a window, or zero outside the file. */
+  static const PetscReal *sample(const std::vector<PetscReal> &win, const PetscInt k, const PetscInt slot);
+
+};
@@ -23,9 +23,10 @@ class Ricker: public Source {
 
  public:
 
-  Ricker(std::unique_ptr<Options> const &options);
+  Ricker(std::unique_ptr<Options> const &options, const PetscInt num);
   ~Ricker() {};
-  Eigen::VectorXd fire(const double &time, const PetscInt &time_idx);
+  Eigen::VectorXd evaluate(const double &time, const PetscInt &time_idx);
+  void tabulate(double *forces, const PetscInt first_step, const PetscInt num_steps, const double dt);
 
 };
 
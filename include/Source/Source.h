@@ -1,6 +1,7 @@
 #pragma once
 
 // stl.
+#include <cmath>
 #include <vector>
 #include <memory>
 
@@ -29,22 +30,68 @@ class Source {
 
   PetscInt mNumComponents;
 
+  /// Shot this source belongs to, i.e. the component of the field it drives with --simultaneous-shots.
+  PetscInt mShot;
+
+  /// Wavefield this source drives, and the wavefield being stepped (see Simulation::runAdjoint).
+  PetscInt mWavefield;
+  static PetscInt mActiveWavefield;
+
+  /// Moment tensor in Voigt order (see Options::SrcMomentTensor), or empty for a point force.
+  Eigen::VectorXd mMomentTensor;
+
+  /// Encoding of the source (--source-encoding): its polarity, and its time shift, in seconds and in the steps of
+  /// the table.
+  double mPolarity, mTimeShift;
+  PetscInt mShiftSteps;
+
+  /// Force of a window of time steps of the sources on this rank (source x time x component, see tabulate): the
+  /// first step and number of steps it holds, the steps it has room for, the steps of the run and the time step.
+  static std::vector<double> mTable;
+  static std::vector<Source*> mTableSources;
+  static PetscInt mTableFirst, mTableSteps, mTableWindow, mTableTotal;
+  static double mTableDt;
+
+  /** Fill the table with the steps from mTableFirst on. */
+  static void fillTable();
+
+  /// This source's forces in the table (NULL if not tabulated), and the force off the table.
+  double *mForces;
+  Eigen::VectorXd mForce;
+
  public:
 
+  /// Wavefields which sources may drive: the forward one, and the adjoint one of a gradient.
+  enum Wavefield { Forward, Adjoint };
+
   /* Get number of active sources. */
   static PetscInt NumSources() { return number; }
 
-  /* Constructor. */
-  Source(std::unique_ptr<Options> const &options);
+  /* Constructor, of the source with some number in the options. */
+  Source(std::unique_ptr<Options> const &options, const PetscInt num);
   virtual ~Source();
 
-  /* Factory method returning single sources. */
-  static std::vector<std::unique_ptr<Source>> Factory(std::unique_ptr<Options> const &options);
+  /**
+   * The sources of the options, or only those within a box, i.e. those which this rank may hold. The others are
+   * not built. They keep their number, by which their options are indexed.
+   * @param [in] box Lower then upper corner of the box, or empty for all sources.
+   */
+  static std::vector<std::unique_ptr<Source>> Factory(std::unique_ptr<Options> const &options,
+                                                      const std::vector<double> &box = std::vector<double>());
 
   /* Unique numbers. */
   inline void SetNum(const PetscInt num) { mNum = num; }
   PetscInt Num() { return mNum; }
 
+  /* Shot (field component) this source drives. */
+  inline void SetShot(const PetscInt shot) { mShot = shot; }
+  inline PetscInt Shot() { return mShot; }
+
+  /* Wavefield this source drives, and the wavefield which is stepped. Sources of the other one do not fire. */
+  inline void SetWavefield(const PetscInt wavefield) { mWavefield = wavefield; }
+  inline PetscInt GetWavefield() const { return mWavefield; }
+  static void SetActiveWavefield(const PetscInt wavefield) { mActiveWavefield = wavefield; }
+
   /* Physical coordinates. */
   inline void SetLocX(double location_x) { mLocX = location_x; }
   inline void SetLocY(double location_y) { mLocY = location_y; }
@@ -63,17 +110,96 @@ class Source {
   inline double LocS() { return mLocS; }
   inline double LocT() { return mLocT; }
 
+  /* Moment tensor, which the (single component) force is the time function of. */
+  inline bool IsMomentTensor() const { return mMomentTensor.size() > 0; }
+  inline void SetMomentTensor(const Eigen::VectorXd &moment_tensor) { mMomentTensor = moment_tensor; }
+
+  /* Polarity and time shift of the encoding: the force is polarity * f(t - shift). */
+  inline double Polarity() const { return mPolarity; }
+  inline double TimeShift() const { return mTimeShift; }
+
+  /**
+   * Time steps a shift takes: it is rounded to whole steps, so that sources read from a file are shifted exactly.
+   * @param [in] shift Time shift.
+   * @param [in] dt Time step.
+   */
+  static inline PetscInt ShiftSteps(const double shift, const double dt) {
+    return dt > 0 ? static_cast<PetscInt>(std::lround(shift / dt)) : 0;
+  }
+
+  /**
+   * The moment tensor as a full (symmetric) matrix.
+   * @param [in] num_dim Number of dimensions.
+   */
+  Eigen::MatrixXd MomentTensor(const PetscInt num_dim) const;
+
   inline void SetNumComponents(PetscInt numComponents ) { mNumComponents = numComponents; };  
   inline PetscInt GetNumComponents() { return mNumComponents; };  
 
   /**
-   * Returns a vector of length mSourceComponents for the force, given a certain time. 
+   * Returns a vector of length mSourceComponents for the force, given a certain time. Once tabulated, this is a
+   * view into the table, without any computation or allocation. Times between the tabulated steps (i.e. of the
+   * finer levels of local time stepping), and steps outside the window held, are evaluated. Sources of a wavefield
+   * which is not being stepped give no force. Both are encoded (see Polarity), with the shift of the table.
+   * @param [in] time Simulation time.
+   * @param [in] time_idx Simulation time index.
+   */
+  inline Eigen::Map<const Eigen::VectorXd> fire(const double &time, const PetscInt &time_idx) {
+    if (mWavefield != mActiveWavefield) {
+      mForce.setZero(mNumComponents);
+      return Eigen::Map<const Eigen::VectorXd>(mForce.data(), mForce.size());
+    }
+    const PetscInt step = time_idx - mTableFirst;
+    if (mForces && step >= 0 && step < mTableSteps &&
+        std::abs(time - time_idx * mTableDt) <= 1e-6 * mTableDt) {
+      return Eigen::Map<const Eigen::VectorXd>(mForces + step * mNumComponents, mNumComponents);
+    }
+    if (time_idx < mShiftSteps) {
+      mForce.setZero(mNumComponents);
+    } else {
+      mForce = mPolarity * evaluate(time - mShiftSteps * mTableDt, time_idx - mShiftSteps);
+    }
+    return Eigen::Map<const Eigen::VectorXd>(mForce.data(), mForce.size());
+  }
+
+  /**
+   * Returns a vector of length mSourceComponents for the force, given a certain time.
    * This needs to be implemented by each derived class. For
    * instance, a Ricker source will need to implement the source time characteristics of a ricker source time
    * function.
    */
-  virtual Eigen::VectorXd fire(const double &time, const PetscInt &time_idx) = 0;
+  virtual Eigen::VectorXd evaluate(const double &time, const PetscInt &time_idx) = 0;
+
+  /**
+   * Write the force of many time steps (mNumComponents per step). By default, each step is evaluated in turn.
+   * @param [out] forces Forces of num_steps steps.
+   * @param [in] first_step First time step.
+   * @param [in] num_steps Number of time steps.
+   * @param [in] dt Time step.
+   */
+  virtual void tabulate(double *forces, const PetscInt first_step, const PetscInt num_steps, const double dt);
+
+  /**
+   * Precompute the forces of some sources into one block (source x time x component), so that fire only looks
+   * them up. The block holds a window of steps, starting with the first, which advanceTable moves along. The
+   * forces are encoded, i.e. shifted by ShiftSteps of the time step and multiplied by the polarity.
+   * @param [in] sources Sources held by this rank, which replace any tabulated before. Any file data must be
+   * loaded.
+   * @param [in] num_steps Number of time steps of the run.
+   * @param [in] dt Time step.
+   * @param [in] window Number of time steps held at once, or 0 for all of them.
+   */
+  static void tabulate(const std::vector<Source*> &sources, const PetscInt num_steps, const double dt,
+                       const PetscInt window = 0);
+
+  /**
+   * Refill the table from a step on (or up to it, for a step before the window), if it does not hold that step.
+   * Not thread-safe: call it from the time loop, before the forces of the step are summed up.
+   * @param [in] time_idx Simulation time index.
+   */
+  static void advanceTable(const PetscInt time_idx);
 
+  /** Prepare for tabulate and evaluate (i.e. open the source file). Only called for the sources on this rank. */
   virtual void loadData();
 
 };
@@ -6,6 +6,7 @@
 
 // 3rd party.
 #include <petsc.h>
+#include <hdf5.h>
 
 // parents.
 #include <Source/Source.h>
@@ -13,6 +14,14 @@
 // forward decl.
 class Options;
 
+/**
+ * Source time function read from the source file (dataset <name>/data, #components x #steps, or #steps for a
+ * single component).
+ *
+ * The data of a source is only read on the rank it is attached to, a window of steps at a time (see
+ * Source::tabulate), so that memory does not grow with the length of the run. The sources of a rank share one
+ * open file.
+ */
 class SourceHdf5: public Source {
 
   double mAmplitude;
@@ -24,13 +33,31 @@ class SourceHdf5: public Source {
 
   PetscInt mNumTimeSteps;
 
+  /// File shared by the sources of this rank, and the number of them with their dataset open.
+  static hid_t mFileId;
+  static PetscInt mNumOpen;
+
+  /// This source's dataset (-1 until loadData), its rank and the steps it holds, and a buffer for reads.
+  hid_t mSet;
+  int mSetRank;
+  hsize_t mSetSteps;
+  std::vector<double> mRead;
+
+  /**
+   * Read some steps of the dataset, as mNumComponents per step. Steps past the end of the dataset are zero.
+   * @param [out] forces Forces of num_steps steps.
+   * @param [in] first_step First time step.
+   * @param [in] num_steps Number of time steps.
+   */
+  void read(double *forces, const PetscInt first_step, const PetscInt num_steps);
+
  public:
 
-  SourceHdf5(std::unique_ptr<Options> const &options);
-  ~SourceHdf5() {};
-  Eigen::VectorXd fire(const double &time, const PetscInt &time_idx);
-  
+  SourceHdf5(std::unique_ptr<Options> const &options, const PetscInt num);
+  ~SourceHdf5();
+  Eigen::VectorXd evaluate(const double &time, const PetscInt &time_idx);
+  void tabulate(double *forces, const PetscInt first_step, const PetscInt num_steps, const double dt);
+
   void loadData();
 
-  Eigen::MatrixXd source_time_function;
-};
\ No newline at end of file
+};
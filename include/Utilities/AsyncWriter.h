@@ -0,0 +1,44 @@
+#pragma once
+
+// stl.
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/**
+ * Background thread running one output task at a time (i.e. an HDF5 write of a snapshot).
+ *
+ * The caller hands off a task which only touches data the caller will not modify until the task is done,
+ * such as the second of two buffers, and keeps computing. At most one task is in flight: submitting the next
+ * waits for the previous one, so two buffers are enough. The thread is started with the first task.
+ */
+class AsyncWriter {
+
+ public:
+
+  AsyncWriter(): mBusy(false), mStop(false) {}
+  ~AsyncWriter();
+  AsyncWriter(const AsyncWriter&) = delete;
+  AsyncWriter &operator=(const AsyncWriter&) = delete;
+
+  /**
+   * Run a task in the background, once the previous task is done.
+   * @param [in] task The task.
+   */
+  void submit(std::function<void()> task);
+
+  /** Wait for the task in flight (if any). */
+  void wait();
+
+ private:
+
+  std::thread mThread;
+  std::mutex mMutex;
+  std::condition_variable mCond;
+  std::function<void()> mTask;
+  bool mBusy, mStop;
+
+  void loop();
+
+};
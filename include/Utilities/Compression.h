@@ -0,0 +1,61 @@
+#pragma once
+
+// stl.
+#include <cstddef>
+#include <cstdint>
+
+// 3rd party.
+#include <petsc.h>
+
+/**
+ * Error bounded lossy compression of field snapshots (checkpoints and movie frames).
+ *
+ * The values of a block are rounded to a uniform grid, whose step is twice the tolerance times the largest
+ * magnitude of the block, so that no value is off by more than tolerance * max |value|. The grid then holds at
+ * most ceil(1 / tolerance) + 1 levels, and each value is stored as its level in Bits(tolerance) bits (i.e. 10
+ * bits instead of 64 for a tolerance of 1e-3). A compressed block is the lowest level and the step (two doubles),
+ * followed by the packed levels, so that its size only depends on the number of values and the tolerance.
+ */
+class Compression {
+
+ public:
+
+  /**
+   * Bits per value for a tolerance.
+   * @param [in] tolerance Largest error, relative to the largest magnitude of a block (0 < tolerance <= 1).
+   * @throws std::runtime_error If the tolerance is out of range, or takes more than 32 bits.
+   */
+  static int Bits(const double tolerance);
+
+  /** Bytes of a compressed block of values. */
+  static size_t Bytes(const size_t num, const double tolerance);
+
+  /** Step of the grid of a block with a largest magnitude: 2 tolerance max_abs (1 for a block of zeros). */
+  static inline double Step(const double max_abs, const double tolerance) {
+    return max_abs > 0 ? 2 * tolerance * max_abs : 1;
+  }
+
+  /** Level of a value on a grid. */
+  static inline uint32_t Level(const double val, const double lowest, const double step) {
+    return static_cast<uint32_t>((val - lowest) / step + 0.5);
+  }
+
+  /**
+   * Compress a block.
+   * @param [in] val Values.
+   * @param [in] num Number of values.
+   * @param [in] tolerance Relative tolerance.
+   * @param [out] out Bytes(num, tolerance) bytes.
+   */
+  static void compress(const PetscScalar *val, const size_t num, const double tolerance, unsigned char *out);
+
+  /**
+   * Decompress a block.
+   * @param [in] in The compressed block.
+   * @param [in] num Number of values.
+   * @param [in] tolerance Relative tolerance the block was compressed with.
+   * @param [out] val Values.
+   */
+  static void decompress(const unsigned char *in, const size_t num, const double tolerance, PetscScalar *val);
+
+};
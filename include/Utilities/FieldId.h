@@ -0,0 +1,98 @@
+#pragma once
+
+// stl.
+#include <string>
+#include <stdexcept>
+
+/**
+ * Interned identifiers for every global field known to the solver.
+ *
+ * Physics mixins (Scalar, Elastic2D, Elastic3D, and the couplings) describe the fields they
+ * pull from and push to the global DOFs in terms of these identifiers, and the FieldDict is
+ * indexed directly by them. This keeps string allocations and comparisons out of the element
+ * loop. Names are only used at the edges (i.e. command line options, output, and tests).
+ * When adding a field, add it both here and in FieldName() below.
+ */
+enum class FieldId : int {
+  u, v, a, a_,
+  ux, vx, ax, ax_,
+  uy, vy, ay, ay_,
+  uz, vz, az, az_,
+  u_, ux_, uy_, uz_,
+  mi,
+  NumFields /* Must remain last. */
+};
+
+/// Number of registered fields.
+const static int NumFieldIds = static_cast<int>(FieldId::NumFields);
+
+/**
+ * Returns the name of a registered field.
+ * @param [in] id The field identifier.
+ * @returns The field name (i.e. "ux").
+ */
+inline const char *FieldName(const FieldId id) {
+  static const char *names[NumFieldIds] = {
+    "u", "v", "a", "a_",
+    "ux", "vx", "ax", "ax_",
+    "uy", "vy", "ay", "ay_",
+    "uz", "vz", "az", "az_",
+    "u_", "ux_", "uy_", "uz_",
+    "mi"
+  };
+  return names[static_cast<int>(id)];
+}
+
+/**
+ * Returns the field holding all components of a vector field, when components are interleaved
+ * in a single block vector (i.e. ux, uy, uz -> u). Scalar fields map to themselves.
+ * @param [in] id The (component) field identifier.
+ * @returns The block field identifier.
+ */
+inline FieldId BlockField(const FieldId id) {
+  switch (id) {
+    case FieldId::ux: case FieldId::uy: case FieldId::uz: return FieldId::u;
+    case FieldId::vx: case FieldId::vy: case FieldId::vz: return FieldId::v;
+    case FieldId::ax: case FieldId::ay: case FieldId::az: return FieldId::a;
+    case FieldId::ax_: case FieldId::ay_: case FieldId::az_: return FieldId::a_;
+    case FieldId::ux_: case FieldId::uy_: case FieldId::uz_: return FieldId::u_;
+    default: return id;
+  }
+}
+
+/**
+ * Returns the component index of a field within its block field (x -> 0, y -> 1, z -> 2).
+ * @param [in] id The (component) field identifier.
+ * @returns The component index, or 0 for scalar fields.
+ */
+inline int BlockComponent(const FieldId id) {
+  switch (id) {
+    case FieldId::uy: case FieldId::vy: case FieldId::ay: case FieldId::ay_: case FieldId::uy_: return 1;
+    case FieldId::uz: case FieldId::vz: case FieldId::az: case FieldId::az_: case FieldId::uz_: return 2;
+    default: return 0;
+  }
+}
+
+/**
+ * Looks up the identifier of a field, without throwing if the name is not registered.
+ * @param [in] name The field name (i.e. "ux").
+ * @param [out] id The field identifier, if the name is registered.
+ * @returns Whether the name is registered.
+ */
+inline bool FindFieldId(const std::string &name, FieldId &id) {
+  for (int i = 0; i < NumFieldIds; i++) {
+    if (name == FieldName(static_cast<FieldId>(i))) { id = static_cast<FieldId>(i); return true; }
+  }
+  return false;
+}
+
+/**
+ * Returns the identifier of a registered field. Throws if the name is not registered.
+ * @param [in] name The field name (i.e. "ux").
+ * @returns The field identifier.
+ */
+inline FieldId FieldIdFromName(const std::string &name) {
+  FieldId id;
+  if (!FindFieldId(name, id)) { throw std::runtime_error("Field " + name + " is not a registered field."); }
+  return id;
+}
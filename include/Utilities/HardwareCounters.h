@@ -0,0 +1,53 @@
+#pragma once
+
+// stl.
+#include <array>
+
+/**
+ * Hardware performance counters of the calling thread, through Linux perf_event (no other dependency).
+ *
+ * Each thread opens one group of counters, on its first read, which then counts the user space work of that
+ * thread only. The generic events are the cycles, the instructions and the last level cache misses (each of
+ * which moves one line from or to memory). The floating point operations are the FP_ARITH_INST_RETIRED events
+ * of Intel processors (scalar, and 128, 256 and 512 bit packed double precision instructions); they are not
+ * available elsewhere, or where perf_event_paranoid forbids them. Counters which cannot be opened read 0.
+ */
+class HardwareCounters {
+
+ public:
+
+  enum Counter { Cycles, Instructions, CacheMisses, FpScalar, Fp128, Fp256, Fp512, NumCounters };
+  typedef std::array<unsigned long long, NumCounters> Values;
+
+  /** Bytes of a cache line, i.e. moved per cache miss. */
+  static constexpr double LineBytes = 64;
+
+  /**
+   * Open the counters of the calling thread (if not open yet).
+   * @returns True if at least the cycles are counted.
+   */
+  static bool open();
+
+  /** True if the calling thread counts a counter. */
+  static bool available(const Counter counter);
+
+  /**
+   * Current counts of the calling thread, opening its counters on first use.
+   * @param [out] values Count of each counter (0 if not available).
+   */
+  static void read(Values &values);
+
+  /** Double precision operations of some counts (a packed instruction counts once per lane). */
+  static double Flops(const Values &values) {
+    return values[FpScalar] + 2.0 * values[Fp128] + 4.0 * values[Fp256] + 8.0 * values[Fp512];
+  }
+
+  /** Fraction of the floating point instructions which are packed (vector) instructions. */
+  static double VectorRatio(const Values &values) {
+    const double packed = 1.0 * values[Fp128] + values[Fp256] + values[Fp512];
+    return packed + values[FpScalar] > 0 ? packed / (packed + values[FpScalar]) : 0;
+  }
+
+  static const char *Name(const Counter counter);
+
+};
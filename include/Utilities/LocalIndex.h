@@ -0,0 +1,33 @@
+#pragma once
+
+// stl.
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+// 3rd party.
+#include <petsc.h>
+
+/**
+ * Index into the arrays of this rank (local vectors, or the local part of the global ones), as stored in the
+ * tables read in every step: the gather/scatter indices and levels of the element batches, the dofs of the
+ * halo exchanges, and the boundary dofs.
+ *
+ * PetscInt is 64-bit in builds for meshes of more than 2^31 dofs, but those only matter to the global
+ * numbering: the dofs of a single rank fit 32 bits, which halves the bytes streamed through for the indices
+ * (a large share of the memory traffic of low orders). The tables are checked as they are filled (see
+ * CheckLocalIndex), and arithmetic on the indices is still done in PetscInt.
+ */
+typedef int32_t LocalInt;
+
+/**
+ * Throw if a rank-local index or size does not fit a LocalInt.
+ * @param [in] num The index or size.
+ * @param [in] what What is indexed, for the message.
+ */
+inline void CheckLocalIndex(const PetscInt num, const std::string &what) {
+  if (num > static_cast<PetscInt>(std::numeric_limits<LocalInt>::max())) {
+    throw std::runtime_error("The " + what + " of this rank do not fit 32-bit local indices. Use more ranks.");
+  }
+}
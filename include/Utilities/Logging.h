@@ -35,11 +35,17 @@ public:
   Logger();
   virtual ~Logger();
   std::ostringstream& Get(LogLevel level_) { level = level_; return os; }
+  /** Whether a message of this level is printed on this rank (errors always are). */
+  static bool Enabled(LogLevel level_);
+  /** Rank of this process, fetched once PETSc is initialized. */
+  static int Rank();
 };
 
-#define LOG() Logger().Get(LogLevel::STD)
-#define DEBUG() Logger().Get(LogLevel::DEBUG)
-#define VERBOSE() Logger().Get(LogLevel::VERBOSE)
+// A message which is not printed is not formatted either.
+#define LOG_AT(level_) if (!Logger::Enabled(level_)) {} else Logger().Get(level_)
+#define LOG() LOG_AT(LogLevel::STD)
+#define DEBUG() LOG_AT(LogLevel::DEBUG)
+#define VERBOSE() LOG_AT(LogLevel::VERBOSE)
 #define ERROR() Logger().Get(LogLevel::ERROR)
 
 struct GlobalLoggerState {
@@ -47,5 +53,6 @@ struct GlobalLoggerState {
   LogLevel level = LogLevel::STD;
   std::ofstream output_file;
   LogWhere log_where = LogWhere::STDOUT;
+  int rank = -1;
 };
 
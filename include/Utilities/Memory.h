@@ -0,0 +1,87 @@
+#pragma once
+
+// stl.
+#include <array>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+#include <Eigen/Dense>
+
+/**
+ * Bytes held by each subsystem of a run, to tell which one takes up the memory of a rank.
+ *
+ * The subsystems count what they hold (see i.e. Element::MemoryBytes, ExodusModel::MemoryBytes), into a
+ * category each, and report prints every category with its maximum and average over the ranks, next to the
+ * memory of the process (resident and peak). The containers are counted by their allocated elements, not by
+ * the overhead of the allocator. The PETSc mesh and section are estimated from their points and dofs.
+ */
+class Memory {
+
+ public:
+
+  enum Category {
+    Elements, Operators, Fields, Model, KdTrees, Receivers, Mesh, PetscMesh,
+    NumCategories
+  };
+
+  typedef std::array<double, NumCategories> Bytes;
+
+  /**
+   * Print the bytes of each category, with their maximum and average over the ranks (collective).
+   * @param [in] when Point of the run (i.e. "after setup").
+   * @param [in] bytes Bytes of each category held by this rank.
+   */
+  static void report(const std::string &when, const Bytes &bytes);
+
+  /** Heap bytes of the elements of a container (and, recursively, of what they hold). */
+  template <typename S, int R, int C, int O, int MR, int MC>
+  static size_t bytes(const Eigen::Matrix<S, R, C, O, MR, MC> &m) {
+    return R == Eigen::Dynamic || C == Eigen::Dynamic ? sizeof(S) * m.size() : 0;
+  }
+  template <typename S, int R, int C, int O, int MR, int MC>
+  static size_t bytes(const Eigen::Array<S, R, C, O, MR, MC> &m) {
+    return R == Eigen::Dynamic || C == Eigen::Dynamic ? sizeof(S) * m.size() : 0;
+  }
+  template <typename T, typename A>
+  static size_t bytes(const std::vector<T, A> &v) {
+    size_t sum = sizeof(T) * v.capacity();
+    for (auto &e: v) { sum += bytes(e); }
+    return sum;
+  }
+  static size_t bytes(const std::vector<bool> &v) { return v.capacity() / 8; }
+  template <typename K, typename V>
+  static size_t bytes(const std::map<K, V> &m) {
+    size_t sum = 0;
+    for (auto &e: m) { sum += NodeBytes + sizeof(e) + bytes(e.first) + bytes(e.second); }
+    return sum;
+  }
+  template <typename K, typename V>
+  static size_t bytes(const std::unordered_map<K, V> &m) {
+    size_t sum = sizeof(void *) * m.bucket_count();
+    for (auto &e: m) { sum += sizeof(void *) + sizeof(e) + bytes(e.first) + bytes(e.second); }
+    return sum;
+  }
+  template <typename K>
+  static size_t bytes(const std::set<K> &s) {
+    size_t sum = 0;
+    for (auto &e: s) { sum += NodeBytes + sizeof(e) + bytes(e); }
+    return sum;
+  }
+  static size_t bytes(const std::string &s) { return s.capacity() > 15 ? s.capacity() : 0; }
+  /** Anything else is held in place. */
+  template <typename T>
+  static size_t bytes(const T &) { return 0; }
+
+ private:
+
+  /// Pointers and color of a node of a tree (std::map and std::set).
+  static constexpr size_t NodeBytes = 32;
+
+  static const char *Name(const Category category);
+
+};
@@ -1,8 +1,11 @@
 #pragma once
 
 // stl.
+#include <algorithm>
 #include <iostream>
 #include <iosfwd>
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -14,18 +17,60 @@ class Options {
 
   PetscBool mTesting;
   PetscBool mSaveMovie;
+  PetscBool mInterleavedComponents;
+  std::string mFieldVecType;
+  PetscBool mLowMemoryGeometry;
+  PetscBool mShareGeometry;
+  PetscBool mSimplexReferenceStiffness;
+  PetscBool mDenseElementStiffness;
+  PetscBool mSmallGemm;
+  PetscBool mMixedPrecision;
+  std::string mHaloPrecision;
+  PetscBool mGhostedState;
+  PetscInt mHaloOverlap;
+  PetscBool mHangingNodes;
+  PetscBool mAutoTune;
+  std::string mAutoTuneFile;
+  PetscReal mAutoTuneMemory;
+  PetscBool mWeightedPartitioning;
+  PetscBool mHierarchicalPartitioning;
+  std::string mNodeOrder;
+  PetscBool mReorderElements;
+  PetscBool mDistributeModel;
+  PetscBool mNodeSharedModel;
+  PetscBool mOverlapSetup;
 
   PetscInt mNumDim;
   PetscInt mNumSrc;
   PetscInt mPolynomialOrder;
   PetscInt mSaveFrameEvery;
+  PetscInt mNumThreads;
+  PetscInt mWorkStealingChunk;
+  PetscBool mNodeAwareHalo;
 
   PetscReal mDuration;
   PetscReal mTimeStep;
+  PetscReal mTimeStepSafetyFactor;
+  PetscInt mCflReport;
+  std::string mCflReportFile;
+  PetscReal mCouplingCost;
+  PetscInt mRebalanceSteps;
+  PetscReal mMaxFrequency;
+  PetscReal mPointsPerWavelength;
   PetscInt mNumTimeSteps;
+  PetscInt mMaxTimeStepLevels;
+  std::string mTimeSteppingScheme;
+  PetscInt mNumSimultaneousShots;
+  std::vector<std::string> mEnsembleModelFiles;
+  PetscBool mStaticProblem;
+  PetscReal mStaticTolerance;
+  std::string mStaticPreconditioner;
 
   std::string mMeshFile;
+  std::string mSaveMeshFile;
+  std::string mPartitionCacheFile;
   std::string mModelFile;
+  std::string mMaterialCacheFile;
   std::string mSourceType;
   std::string mMovieFile;
 
@@ -36,10 +81,15 @@ class Options {
   std::vector<PetscReal> mSrcLocY;
   std::vector<PetscReal> mSrcLocZ;
   std::vector<PetscInt> mSrcNumComponents;
+  std::vector<PetscInt> mSrcShot;
+  PetscInt mSourceWindow;
+  std::vector<std::string> mSourceEncoding;
+  std::vector<PetscReal> mSrcPolarity, mSrcTimeShift;
   std::vector<PetscReal> mSrcRickerAmplitude;
   std::vector<PetscReal> mSrcRickerCenterFreq;
   std::vector<PetscReal> mSrcRickerTimeDelay;
   std::vector<Eigen::VectorXd > mSrcRickerDirection;
+  std::vector<Eigen::VectorXd> mSrcMomentTensor;
 
   // Receivers.
   PetscInt mNumRec;
@@ -48,57 +98,601 @@ class Options {
   std::vector<PetscReal> mRecLocY;
   std::vector<PetscReal> mRecLocZ;
   std::vector<std::string> mRecNames;
+  std::vector<PetscInt> mRecDecimation;
+  std::vector<PetscReal> mRecWindowEnd;
+  PetscInt mReceiverWriteEvery;
+  PetscBool mAsyncOutput;
+  PetscBool mProfile;
+  PetscBool mProfileCounters;
+  std::string mTraceFile;
+  PetscInt mElementTimingEvery;
+  std::string mElementCostFile;
+  std::string mHaloReportFile;
+  PetscReal mProgressInterval;
+  PetscInt mProgressEvery;
+  PetscInt mEnergyCheckEvery;
+  PetscReal mEnergyGrowth;
+  PetscBool mMemoryReport;
+  PetscBool mDryRun;
+  PetscInt mDryRunSteps;
+  PetscReal mTargetEfficiency;
   std::vector<std::string> mMovieFields;
+  std::vector<PetscReal> mMovieRegion;
+  std::string mMovieSideSet;
+  PetscBool mMovieVerticesOnly;
+  std::string mMoviePrecision;
+  PetscReal mMovieTolerance;
+  std::vector<PetscReal> mDftFrequencies;
+  PetscInt mDftEvery;
+  std::vector<std::string> mDftFields;
+  std::vector<PetscReal> mDftRegion;
+  std::string mDftFile;
+  std::string mGridFile;
+  std::vector<PetscReal> mGridOrigin, mGridSpacing;
+  std::vector<PetscInt> mGridShape;
+  PetscInt mGridEvery;
+  std::vector<std::string> mGridFields;
+  std::string mStagingStream, mStagingEngine;
+  PetscInt mStagingEvery;
+  std::vector<std::string> mStagingFields;
+
+  // Adjoint simulations.
+  std::string mAdjointShotFile;
+  std::string mObservedDataFile;
+  std::string mMisfit;
+  PetscReal mMisfitMaxFrequency, mMisfitMaxShift;
+  PetscReal mCheckpointMemory;
+  PetscInt mCheckpointDiskSlots;
+  std::string mCheckpointDir;
+  PetscReal mCheckpointTolerance;
+  std::string mKernelFile;
+  PetscInt mKernelEvery;
+  std::string mKernelVertexFile;
+  std::string mAdjointReconstruction;
+
+  // Restarts.
+  PetscInt mRestartEvery;
+  std::string mRestartFile;
+  std::string mRestartFrom;
 
   // Boundaries.
   std::vector<std::string> mHomogeneousDirichletBoundaries;
+  std::vector<std::string> mAbsorbingBoundaries;
+  std::vector<std::string> mInjectionBoundaries;
+  std::vector<std::string> mPeriodicBoundaries;
+  std::string mInjectionFile;
+  PetscInt mInjectionWindow;
+
+  // Activity mask.
+  PetscBool mActivityMask, mActivityArrival;
+  PetscReal mActivityThreshold;
+
+  // Attenuation.
+  PetscBool mAttenuation;
+  std::vector<PetscReal> mAttenuationBand;
+
+  // Axisymmetry.
+  PetscBool mAxisymmetric;
+
+  // Partitioning.
+  std::map<std::string,PetscReal> mElementCosts;
+
+  // Synthetic box mesh and model.
+  std::vector<PetscInt> mBoxElements;
+  std::vector<PetscReal> mBoxExtent;
+  PetscBool mBoxSimplex;
+  PetscReal mBoxPerturbation;
+  PetscInt mBoxSeed;
+  std::string mBoxPhysics;
+  std::map<std::string,PetscReal> mBoxMaterial;
+
+  // Shots.
+  std::vector<std::string> mShotFiles;
+
+  // Reciprocity, and whether the receivers record the strain, stress and rotation (--receiver-quantities, and always
+  // the strain for the reciprocal shots).
+  PetscBool mReciprocal;
+  PetscBool mReceiverStrain = PETSC_FALSE, mReceiverStress = PETSC_FALSE, mReceiverRotation = PETSC_FALSE;
+
+  // Strain Green's function database of the reciprocal shots, its points, and the time function of the force.
+  std::string mSgtFile;
+  std::vector<std::string> mSgtNames;
+  std::vector<PetscReal> mSgtLocX, mSgtLocY, mSgtLocZ;
+  PetscInt mSgtEvery = 1;
+  PetscReal mSgtTolerance = 0;
+  PetscReal mReciprocalCenterFreq = 0, mReciprocalTimeDelay = 0;
 
  public:
 
   void setOptions();
 
+  /**
+   * Take the receivers from a catalogue (see --receiver-catalogue), one "name, x, y[, z]" line per receiver, with
+   * blank lines and lines starting with '#' skipped. Replaces any receivers set so far.
+   * @param [in] contents Contents of the catalogue.
+   * @param [in] name Name of the catalogue (for errors).
+   * @throws std::runtime_error If a line does not hold a name and NumDim coordinates.
+   */
+  void readReceiverCatalogue(const std::string &contents, const std::string &name);
+
+  /**
+   * Take the points of the strain Green's function database from a catalogue (see --sgt-points), in the format
+   * of a receiver catalogue. Replaces any points set so far.
+   * @param [in] contents Contents of the catalogue.
+   * @param [in] name Name of the catalogue (for errors).
+   * @throws std::runtime_error If a line does not hold a name and NumDim coordinates.
+   */
+  void readSgtCatalogue(const std::string &contents, const std::string &name);
+
   PetscBool SaveMovie() const { return mSaveMovie; }
+  PetscBool InterleavedComponents() const { return mInterleavedComponents; }
+  /** PETSc vector type of the global and local fields: "standard" for host memory, or a device type. */
+  std::string FieldVecType() const { return mFieldVecType; }
+  /** True if elements should recompute their Jacobians from the vertices, instead of storing them. */
+  PetscBool LowMemoryGeometry() const { return mLowMemoryGeometry; }
+  /** True if hexes of the same precomputed geometry (to a relative tolerance) share one record of it. */
+  PetscBool ShareGeometry() const { return mShareGeometry; }
+  /** True if simplices should apply their stiffness through the reference derivatives, instead of storing dense
+   * per-element operators. */
+  PetscBool SimplexReferenceStiffness() const { return mSimplexReferenceStiffness; }
+  /** True if scalar quads and hexes should apply a dense element stiffness matrix, assembled at setup, instead
+   * of the sum-factorized gradients (which only pays off at low orders). */
+  PetscBool DenseElementStiffness() const { return mDenseElementStiffness; }
+  /** True if quads and hexes apply their 1D contractions as small matrix products (generated for the processor
+   * when built with LIBXSMM, see SmallGemm), instead of the unrolled loops. */
+  PetscBool SmallGemm() const { return mSmallGemm; }
+  /** True if dense element stiffness matrices and halo values are held in single precision. */
+  PetscBool MixedPrecision() const { return mMixedPrecision; }
+  /** Precision in which the halo exchange sends the values ("double", "single" or "half"). */
+  std::string HaloPrecision() const { return mHaloPrecision; }
+  /** True if the time stepper keeps its state in the local vectors, ghosts included, rather than the global
+   * ones, which then only hold it after Problem::updateGlobalState. */
+  PetscBool GhostedState() const { return mGhostedState; }
+  /** Layers of cells each rank holds beyond its own, and steps between halo exchanges of a ghosted state
+   * (0 for a reduction every step). */
+  PetscInt HaloOverlap() const { return mHaloOverlap; }
+  /** True if the dofs on the faces of a 2:1 non-conforming mesh are constrained to the coarse side (see
+   * HangingNodes). */
+  PetscBool HangingNodes() const { return mHangingNodes; }
+  /** True if the options above should be chosen at startup, by timing them (see Tuner). */
+  PetscBool AutoTune() const { return mAutoTune; }
+  /** File caching the choices of the tuner between runs (empty if not requested). */
+  std::string AutoTuneFile() const { return mAutoTuneFile; }
+  /** Memory the elements of a rank may take, in MB (0 for no limit). */
+  PetscReal AutoTuneMemory() const { return mAutoTuneMemory; }
+  /** True if the mesh should be partitioned by estimated element cost (see Mesh::read). */
+  PetscBool WeightedPartitioning() const { return mWeightedPartitioning; }
+  /** True if elements and dofs should be ordered along a space-filling curve (see Mesh::ElementOrder). */
+  PetscBool ReorderElements() const { return mReorderElements; }
+  /** Relative cost of an element of each physics, and the extra (relative) cost of coupling elements. */
+  const std::map<std::string,PetscReal> &ElementCosts() const { return mElementCosts; }
+  PetscReal CouplingCost() const { return mCouplingCost; }
+  /** Steps over which the element costs are measured to rebalance the partition (0 for none, see
+   * Simulation::rebalance). */
+  PetscInt RebalanceSteps() const { return mRebalanceSteps; }
+  /** True if the cells should be bisected onto the nodes first, then onto the ranks of each node. */
+  PetscBool HierarchicalPartitioning() const { return mHierarchicalPartitioning; }
+  /** Order of the nodes in the partition ("rank" or "hostname"). */
+  std::string NodeOrder() const { return mNodeOrder; }
+  /** True if each rank should only hold the model parameters of its own elements (see ExodusModel::localize). */
+  PetscBool DistributeModel() const { return mDistributeModel; }
+  /** Hold the (replicated) model once per node, in shared memory. */
+  PetscBool NodeSharedModel() const { return mNodeSharedModel; }
+  /** Parse the model file while the mesh is distributed, when the partition does not depend on it. */
+  PetscBool OverlapSetup() const { return mOverlapSetup; }
+  /** File caching the mesh partition between runs (empty if not requested). */
+  std::string PartitionCacheFile() const { return mPartitionCacheFile; }
 
   PetscInt Dimension() const { return mNumDim; }
   PetscInt PolynomialOrder() const { return mPolynomialOrder; }
+  /** Highest frequency to resolve (0 if not given), with the given number of GLL points per minimum
+   * wavelength. If given, the polynomial order is chosen from the model (see Mesh::setupTopology). */
+  PetscReal MaxFrequency() const { return mMaxFrequency; }
+  PetscReal PointsPerWavelength() const { return mPointsPerWavelength; }
   PetscInt NumberSources() {  return mNumSrc; }
   PetscInt NumberReceivers() const { return mNumRec; }
 
   PetscReal Duration() const { return mDuration; }
   PetscReal TimeStep() const { return mTimeStep; }
+  PetscReal TimeStepSafetyFactor() const { return mTimeStepSafetyFactor; }
+  /** Number of elements with the smallest stable time step to report at setup (0 for none, see CflReport). */
+  PetscInt CflReport() const { return mCflReport; }
+  /** File of the stable time step of every element (empty for none). */
+  std::string CflReportFile() const { return mCflReportFile; }
+  /** True if no --time-step was given, i.e. the stable time step should be used. */
+  bool AutomaticTimeStep() const { return mTimeStep <= 0; }
   PetscInt NumTimeSteps() const { return mNumTimeSteps; }
+  PetscInt MaxTimeStepLevels() const { return mMaxTimeStepLevels; }
+  /** Time stepping scheme ("newmark", "newmark4" or "leapfrog", see Problem::Factory). */
+  std::string TimeSteppingScheme() const { return mTimeSteppingScheme; }
+  /** Number of shots propagated at once, each as one interleaved component of the fields. */
+  PetscInt SimultaneousShots() const { return mNumSimultaneousShots; }
+  /** Models of the ensemble members after the first (which is --model-file), each propagated as one of the
+   * simultaneous shots, with the same sources (see ExodusModel::addMember). */
+  const std::vector<std::string> &EnsembleModelFiles() const { return mEnsembleModelFiles; }
+  /** True if the displacement under the loads of the sources (at time zero) is solved for, instead of stepping
+   * through time (see StaticSolver). */
+  PetscBool StaticProblem() const { return mStaticProblem; }
+  /** Relative residual to which a static problem is solved. */
+  PetscReal StaticTolerance() const { return mStaticTolerance; }
+  /** Preconditioner of a static solve ("jacobi" or "none"). */
+  std::string StaticPreconditioner() const { return mStaticPreconditioner; }
+  PetscInt NumThreads() const { return mNumThreads; }
+  /** Elements per chunk of the work-stealing schedule of the element loop (0 for the static split). */
+  PetscInt WorkStealingChunk() const { return mWorkStealingChunk; }
+  /** True if the halo exchanges go through shared memory within a node, and as one message between two nodes. */
+  PetscBool NodeAwareHalo() const { return mNodeAwareHalo; }
+  /** Time each phase of the run, and print a summary at the end. */
+  PetscBool Profile() const { return mProfile; }
+  /** Count hardware events (flops, cache misses) of each phase as well (see Profiler::EnableCounters). */
+  PetscBool ProfileCounters() const { return mProfileCounters; }
+  /** Chrome trace file of the phases of every rank (empty for none, see Profiler::EnableTrace). */
+  std::string TraceFile() const { return mTraceFile; }
+  /** Steps between the steps whose element loop is timed element by element (0 for never). */
+  PetscInt ElementTimingEvery() const { return mElementTimingEvery; }
+  /** HDF5 file of the mesh with the timed seconds per step of each element as a cell field (empty for none). */
+  std::string ElementCostFile() const { return mElementCostFile; }
+  /** Text file of the halo traffic between each pair of ranks, per step (empty for none, see Problem::reportHalo). */
+  std::string HaloReportFile() const { return mHaloReportFile; }
+  /** Seconds between progress reports (0 for none), or else the steps between them (if not 0). */
+  PetscReal ProgressInterval() const { return mProgressInterval; }
+  PetscInt ProgressEvery() const { return mProgressEvery; }
+  /** Steps between checks of the energy of the fields (0 for none), and the growth between checks taken
+   * as unstable (see Monitor). */
+  PetscInt EnergyCheckEvery() const { return mEnergyCheckEvery; }
+  PetscReal EnergyGrowth() const { return mEnergyGrowth; }
+  /** Report the memory of each subsystem after setup and at the end of each shot (see Memory). */
+  PetscBool MemoryReport() const { return mMemoryReport; }
+  /** Only set up, and predict the time and memory of the run from a few steps (see Simulation::dryRun). */
+  PetscBool DryRun() const { return mDryRun; }
+  PetscInt DryRunSteps() const { return mDryRunSteps; }
+  /** Parallel efficiency for which the dry run suggests a number of ranks. */
+  PetscReal TargetEfficiency() const { return mTargetEfficiency; }
 
   std::string MeshFile() const { return mMeshFile; }
+  /** HDF5 file to write the distributed mesh to (empty if not requested). */
+  std::string SaveMeshFile() const { return mSaveMeshFile; }
   std::string ReceiverType() const { return "hdf5"; }
   std::string ModelFile() const { return mModelFile; }
+  /** Elements per dimension of a synthetic box mesh, used instead of the mesh and model files (empty if none). */
+  std::vector<PetscInt> BoxElements() const { return mBoxElements; }
+  /** Length of the box in each dimension (it starts at the origin). */
+  std::vector<PetscReal> BoxExtent() const { return mBoxExtent; }
+  /** True if the box is split into triangles or tetrahedra, instead of quads or hexahedra. */
+  PetscBool BoxSimplex() const { return mBoxSimplex; }
+  /** Random displacement of the interior vertices, relative to the element size, and its seed. */
+  PetscReal BoxPerturbation() const { return mBoxPerturbation; }
+  PetscInt BoxSeed() const { return mBoxSeed; }
+  /** Physics ("fluid" or "elastic") and (homogeneous) material parameters of the box. */
+  std::string BoxPhysics() const { return mBoxPhysics; }
+  const std::map<std::string,PetscReal> &BoxMaterial() const { return mBoxMaterial; }
+  /** Binary file caching the material at the integration points (empty if not requested). */
+  std::string MaterialCacheFile() const { return mMaterialCacheFile; }
   std::string MovieFile() const { return mMovieFile; }
   std::string SourceType() const { return mSourceType; }
   std::string ReceiverFileName() const { return mReceiverFileName; }
 
-  std::vector<PetscReal> RecLocX() const { return mRecLocX; }
-  std::vector<PetscReal> RecLocY() const { return mRecLocY; }
-  std::vector<PetscReal> RecLocZ() const { return mRecLocZ; }
+  const std::vector<PetscReal> &RecLocX() const { return mRecLocX; }
+  const std::vector<PetscReal> &RecLocY() const { return mRecLocY; }
+  const std::vector<PetscReal> &RecLocZ() const { return mRecLocZ; }
 
   std::string SourceFileName() const { return mSourceFileName; }
-  std::vector<PetscReal> SrcLocX() const { return mSrcLocX; }
-  std::vector<PetscReal> SrcLocY() const { return mSrcLocY; }
-  std::vector<PetscReal> SrcLocZ() const { return mSrcLocZ; }
-  std::vector<PetscInt> SrcNumComponents() const { return mSrcNumComponents; }
-  std::vector<PetscReal> SrcRickerAmplitude() const { return mSrcRickerAmplitude; }
-  std::vector<PetscReal> SrcRickerCenterFreq() const { return mSrcRickerCenterFreq; }
-  std::vector<PetscReal> SrcRickerTimeDelay() const { return mSrcRickerTimeDelay; }
-  Eigen::VectorXd SrcRickerDirection(const PetscInt Num) const { return mSrcRickerDirection[Num]; }
-  std::vector<std::string> SrcName() const { return mSourceNames; }
+  const std::vector<PetscReal> &SrcLocX() const { return mSrcLocX; }
+  const std::vector<PetscReal> &SrcLocY() const { return mSrcLocY; }
+  const std::vector<PetscReal> &SrcLocZ() const { return mSrcLocZ; }
+  const std::vector<PetscInt> &SrcNumComponents() const { return mSrcNumComponents; }
+  const std::vector<PetscInt> &SrcShot() const { return mSrcShot; }
+  /** Encoding of the sources which fire together in a shot (--source-encoding: "polarity" and/or "shift"). */
+  const std::vector<std::string> &SourceEncoding() const { return mSourceEncoding; }
+  /** Random polarity (+-1) and time shift of each source, drawn from --encoding-seed (empty if not encoded). The
+   * shift is rounded to whole time steps when the sources are tabulated (see Source::ShiftSteps). */
+  const std::vector<PetscReal> &SrcPolarity() const { return mSrcPolarity; }
+  const std::vector<PetscReal> &SrcTimeShift() const { return mSrcTimeShift; }
+  const std::vector<PetscReal> &SrcRickerAmplitude() const { return mSrcRickerAmplitude; }
+  const std::vector<PetscReal> &SrcRickerCenterFreq() const { return mSrcRickerCenterFreq; }
+  const std::vector<PetscReal> &SrcRickerTimeDelay() const { return mSrcRickerTimeDelay; }
+  const Eigen::VectorXd &SrcRickerDirection(const PetscInt Num) const { return mSrcRickerDirection[Num]; }
+  /** Moment tensor of a source in Voigt order (xx, yy, zz, yz, xz, xy, or xx, yy, xy in 2D), or empty for a force. */
+  Eigen::VectorXd SrcMomentTensor(const PetscInt Num) const {
+    return Num < mSrcMomentTensor.size() ? mSrcMomentTensor[Num] : Eigen::VectorXd();
+  }
+  const std::vector<std::string> &SrcName() const { return mSourceNames; }
+  /** Number of time steps of the source time functions held at once (0 for the whole run). */
+  PetscInt SourceWindow() const { return mSourceWindow; }
   
 
-  std::vector<std::string> RecNames() const { return mRecNames; }
+  const std::vector<std::string> &RecNames() const { return mRecNames; }
+  /** Factor by which the samples of each receiver are decimated (1 to keep every time step). */
+  const std::vector<PetscInt> &RecDecimation() const { return mRecDecimation; }
+  /** Time by which the window of each receiver is complete (empty to record the whole duration). */
+  const std::vector<PetscReal> &RecWindowEnd() const { return mRecWindowEnd; }
+  /**
+   * Time at which a forward shot may stop: the end of the last receiver window, if every receiver has one and
+   * it is before the end of the shot, and the duration otherwise.
+   */
+  PetscReal StopTime() const {
+    if (mRecWindowEnd.empty()) { return mDuration; }
+    return std::min(mDuration, *std::max_element(mRecWindowEnd.begin(), mRecWindowEnd.end()));
+  }
+  /** Number of time steps between writes of the receiver samples (0 to only write at the end). */
+  PetscInt ReceiverWriteEvery() const { return mReceiverWriteEvery; }
+  /** Write the receiver samples from a background thread, while the next steps are computed. */
+  PetscBool AsyncOutput() const { return mAsyncOutput; }
   std::vector<std::string> MovieFields() const { return mMovieFields; }
+  /** Number of time steps between movie frames. */
+  PetscInt SaveFrameEvery() const { return mSaveFrameEvery; }
+  /** Bounding box of the movie (min and max per dimension), or empty for the whole mesh. */
+  std::vector<PetscReal> MovieRegion() const { return mMovieRegion; }
+  /** Side set the movie is restricted to (i.e. the free surface), or empty for the whole mesh. */
+  std::string MovieSideSet() const { return mMovieSideSet; }
+  /** True if the movie only holds the dofs on mesh vertices, instead of all GLL points. */
+  PetscBool MovieVerticesOnly() const { return mMovieVerticesOnly; }
+  /** Precision of the movie samples: double, float or half. */
+  std::string MoviePrecision() const { return mMoviePrecision; }
+  /** Error bound of compressed movie frames, relative to their largest magnitude, or 0 to not compress them. */
+  PetscReal MovieTolerance() const { return mMovieTolerance; }
+  /** Frequencies (Hz) of the wavefields transformed while stepping, or empty for none (see Fourier). */
+  std::vector<PetscReal> DftFrequencies() const { return mDftFrequencies; }
+  /** Number of time steps between samples of the transforms. */
+  PetscInt DftEvery() const { return mDftEvery; }
+  /** Transformed fields, or empty for the displacement. */
+  std::vector<std::string> DftFields() const { return mDftFields; }
+  /** Bounding box of the transforms (min and max per dimension), or empty for the whole mesh. */
+  std::vector<PetscReal> DftRegion() const { return mDftRegion; }
+  /** HDF5 file of the transforms, written after the shot. */
+  std::string DftFile() const { return mDftFile; }
+  /** HDF5 file of the wavefields on a regular grid, or empty for none (see RegularGrid). */
+  std::string GridFile() const { return mGridFile; }
+  /** First point of the grid, spacing and number of points along each axis (one per dimension). */
+  std::vector<PetscReal> GridOrigin() const { return mGridOrigin; }
+  std::vector<PetscReal> GridSpacing() const { return mGridSpacing; }
+  std::vector<PetscInt> GridShape() const { return mGridShape; }
+  /** Number of time steps between frames of the grid. */
+  PetscInt GridEvery() const { return mGridEvery; }
+  /** Fields interpolated to the grid, or empty for the displacement. */
+  std::vector<std::string> GridFields() const { return mGridFields; }
+  /** Name of the ADIOS2 stream published to while stepping, or empty for none (see Staging). */
+  std::string StagingStream() const { return mStagingStream; }
+  /** ADIOS2 engine of the stream (SST by default). */
+  std::string StagingEngine() const { return mStagingEngine; }
+  /** Number of time steps between steps of the stream. */
+  PetscInt StagingEvery() const { return mStagingEvery; }
+  /** Fields published to the stream, or empty for the displacement. */
+  std::vector<std::string> StagingFields() const { return mStagingFields; }
+
+  /** Options file of the adjoint shot (its adjoint sources), or empty for a forward run. */
+  std::string AdjointShotFile() const { return mAdjointShotFile; }
+  /** HDF5 file of the observed data at the receivers (in the layout of the receiver output), or empty. */
+  std::string ObservedDataFile() const { return mObservedDataFile; }
+  /** Misfit of the synthetics against the observed data: l2, cc (traveltime) or tf-phase (see Misfit). */
+  std::string MisfitType() const { return mMisfit; }
+  /** Highest frequency of the time-frequency phase misfit (0 for a tenth of the sampling rate). */
+  PetscReal MisfitMaxFrequency() const { return mMisfitMaxFrequency; }
+  /** Largest traveltime shift searched by the cross-correlation misfit (0 for a quarter of the duration). */
+  PetscReal MisfitMaxShift() const { return mMisfitMaxShift; }
+  /** Megabytes per rank for checkpoints of the forward wavefield, in an adjoint run (see Checkpoints). */
+  PetscReal CheckpointMemory() const { return mCheckpointMemory; }
+  /** Checkpoints on disk, on top of those in memory. */
+  PetscInt CheckpointDiskSlots() const { return mCheckpointDiskSlots; }
+  /** Directory of the checkpoints on disk. */
+  std::string CheckpointDir() const { return mCheckpointDir; }
+  /** Error bound of compressed checkpoints, relative to the largest magnitude of each field, or 0 for exact ones. */
+  PetscReal CheckpointTolerance() const { return mCheckpointTolerance; }
+  /** HDF5 file of the element kernels of an adjoint run, or empty to not write them. */
+  std::string KernelFile() const { return mKernelFile; }
+  /** Adjoint steps between additions to the kernels at the integration points. */
+  PetscInt KernelEvery() const { return mKernelEvery; }
+  /** Exodus file of the model, with the kernels at its vertices as nodal fields, or empty to not write it. */
+  std::string KernelVertexFile() const { return mKernelVertexFile; }
+  /** How an adjoint run reconstructs the forward wavefield: "checkpoints" or "boundary" (see BoundaryWavefield). */
+  std::string AdjointReconstruction() const { return mAdjointReconstruction; }
+
+  /** Time steps between restart files of a run, or 0 for none (see Restart). */
+  PetscInt RestartEvery() const { return mRestartEvery; }
+  /** HDF5 file the restart state is written to. */
+  std::string RestartFile() const { return mRestartFile; }
+  /** Restart file to resume the run from, or empty to start from rest. */
+  std::string RestartFrom() const { return mRestartFrom; }
 
   std::vector<std::string> HomogeneousDirichlet() const { return mHomogeneousDirichletBoundaries; }
+  /** Side sets with first order absorbing (Clayton-Engquist/Stacey) boundaries, see Absorbing. */
+  std::vector<std::string> AbsorbingBoundaries() const { return mAbsorbingBoundaries; }
+  /** Side sets which inject the wavefield of --injection-file, and absorb the outgoing waves (see Injection). */
+  std::vector<std::string> InjectionBoundaries() const { return mInjectionBoundaries; }
+  /** Pairs of side sets (master, then slave) whose dofs are identified, see PeriodicBoundaries. */
+  std::vector<std::string> PeriodicBoundaries() const { return mPeriodicBoundaries; }
+  /** HDF5 file with the incident wavefield at the nodes of the injection boundaries. */
+  std::string InjectionFile() const { return mInjectionFile; }
+  /** Number of samples of the injection file read at a time. */
+  PetscInt InjectionWindow() const { return mInjectionWindow; }
+
+  /** True if elements whose fields are at rest are skipped in the assembly (see ElementBatch::setActivityMask). */
+  PetscBool ActivityMask() const { return mActivityMask; }
+  /** Largest magnitude of a field value at rest (0, i.e. exact, by default). */
+  PetscReal ActivityThreshold() const { return mActivityThreshold; }
+  /** True if elements are also skipped (without looking at them) before the first arrival from the sources. */
+  PetscBool ActivityArrival() const { return mActivityArrival; }
+
+  /** True if the elements attenuate, with the quality factors of the model (see Attenuating). */
+  PetscBool Attenuation() const { return mAttenuation; }
+  /** Lowest and highest frequency (Hz) over which the quality factors are held constant. */
+  std::vector<PetscReal> AttenuationBand() const { return mAttenuationBand; }
+
+  /** True if a 2D quad mesh is the (r, z) half plane of an axisymmetric medium, with the axis at x = 0. */
+  PetscBool Axisymmetric() const { return mAxisymmetric; }
+
+  std::vector<std::string> ShotFiles() const { return mShotFiles; }
+
+  /** True if the sources and receivers are swapped, i.e. one shot runs per receiver and component, and the
+   * seismograms of all sources are assembled from the strain at them (see Simulation::runReciprocal). */
+  PetscBool Reciprocal() const { return mReciprocal; }
+  /** True if the receivers record the strain, stress or rotation as well as the displacement (elastic physics
+   * only, see Receiver::StrainNames, StressNames and RotationNames). */
+  PetscBool ReceiverStrain() const { return mReceiverStrain; }
+  PetscBool ReceiverStress() const { return mReceiverStress; }
+  PetscBool ReceiverRotation() const { return mReceiverRotation; }
+
+  /**
+   * Options of one reciprocal shot: a point force along one axis at a receiver, with the time function shared by
+   * the sources (of unit amplitude), and a receiver recording the strain at each source, named and numbered after
+   * it. Nothing is written by the shot itself.
+   * @param [in] receiver Number of the receiver.
+   * @param [in] component Axis of the force.
+   */
+  std::unique_ptr<Options> ReciprocalShot(const PetscInt receiver, const PetscInt component) const;
+
+  /**
+   * Options of the adjoint shot of a gradient computed in process: an adjoint source at each receiver, named and
+   * numbered after it, whose time function is held in memory (see AdjointSource and Misfit). It records nothing.
+   * @param [in] num_components Components of each source (those of the recorded displacement).
+   */
+  std::unique_ptr<Options> AdjointShot(const PetscInt num_components) const;
+
+  /** Center frequency and delay of the Ricker time function of the reciprocal force: those of the sources, or
+   * --sgt-center-freq and --sgt-time-delay without them. */
+  PetscReal ReciprocalCenterFreq() const { return mReciprocalCenterFreq; }
+  PetscReal ReciprocalTimeDelay() const { return mReciprocalTimeDelay; }
+
+  /** File of the strain Green's function database of the reciprocal shots (empty if none, see StrainDatabase). */
+  std::string SgtFile() const { return mSgtFile; }
+  /** Names and locations of the points of the database, which follow the sources among the receivers of a shot. */
+  const std::vector<std::string> &SgtNames() const { return mSgtNames; }
+  const std::vector<PetscReal> &SgtLocX() const { return mSgtLocX; }
+  const std::vector<PetscReal> &SgtLocY() const { return mSgtLocY; }
+  const std::vector<PetscReal> &SgtLocZ() const { return mSgtLocZ; }
+  PetscInt NumberSgtPoints() const { return mSgtNames.size(); }
+  /** Decimation of the strain in the database (low-pass filtered, as for --receiver-decimation). */
+  PetscInt SgtEvery() const { return mSgtEvery; }
+  /** Relative tolerance of the quantised strain (see Compression), or 0 to store it as float. */
+  PetscReal SgtTolerance() const { return mSgtTolerance; }
 
   /* Setters (mainly for testing). */
   void SetDimension(const PetscInt dim) { mNumDim = dim; }
+  void SetPolynomialOrder(const PetscInt order) { mPolynomialOrder = order; }
+  void SetMaxFrequency(const PetscReal freq) { mMaxFrequency = freq; }
   void SetSourceType(const std::string type) { mSourceType = type; }
+  void SetSourceWindow(const PetscInt num) { mSourceWindow = num; }
+  void SetSrcEncoding(const std::vector<PetscReal> &polarity, const std::vector<PetscReal> &time_shift) {
+    mSrcPolarity = polarity; mSrcTimeShift = time_shift;
+  }
+  void SetSrcMomentTensor(const std::vector<Eigen::VectorXd> moment_tensor) { mSrcMomentTensor = moment_tensor; }
   void SetReceiverFileName(const std::string type) { mReceiverFileName = type; }
+  void SetReceiverWriteEvery(const PetscInt num) { mReceiverWriteEvery = num; }
+  void SetRecDecimation(const std::vector<PetscInt> decimation) { mRecDecimation = decimation; }
+  void SetRecWindowEnd(const std::vector<PetscReal> end) { mRecWindowEnd = end; }
+  void SetAsyncOutput(const PetscBool async) { mAsyncOutput = async; }
+  void SetTraceFile(const std::string file) { mTraceFile = file; }
+  void SetElementTiming(const PetscInt every, const std::string &file) {
+    mElementTimingEvery = every; mElementCostFile = file;
+  }
+  void SetHaloReportFile(const std::string file) { mHaloReportFile = file; }
+  void SetMovieFile(const std::string file) { mMovieFile = file; }
+  void SetMovieFields(const std::vector<std::string> fields) { mMovieFields = fields; }
+  void SetSaveFrameEvery(const PetscInt num) { mSaveFrameEvery = num; }
+  void SetMovieRegion(const std::vector<PetscReal> region) { mMovieRegion = region; }
+  void SetMovieSideSet(const std::string side_set) { mMovieSideSet = side_set; }
+  void SetMovieVerticesOnly(const PetscBool vertices) { mMovieVerticesOnly = vertices; }
+  void SetMoviePrecision(const std::string precision) { mMoviePrecision = precision; }
+  void SetMovieTolerance(const PetscReal tolerance) { mMovieTolerance = tolerance; }
+  void SetCheckpoints(const PetscReal megabytes, const PetscInt disk_slots, const std::string dir) {
+    mCheckpointMemory = megabytes; mCheckpointDiskSlots = disk_slots; mCheckpointDir = dir;
+  }
+  void SetCheckpointTolerance(const PetscReal tolerance) { mCheckpointTolerance = tolerance; }
+  void SetKernelEvery(const PetscInt num) { mKernelEvery = num; }
+  void SetAdjointReconstruction(const std::string method) { mAdjointReconstruction = method; }
+  void SetMisfit(const std::string &file, const std::string &type, const PetscReal max_frequency,
+                 const PetscReal max_shift) {
+    mObservedDataFile = file; mMisfit = type; mMisfitMaxFrequency = max_frequency; mMisfitMaxShift = max_shift;
+  }
+  void ClearReceivers() {
+    mNumRec = 0; mRecLocX.clear(); mRecLocY.clear(); mRecLocZ.clear(); mRecNames.clear(); mRecDecimation.clear();
+    mRecWindowEnd.clear();
+  }
+  void SetRestart(const PetscInt every, const std::string file, const std::string from) {
+    mRestartEvery = every; mRestartFile = file; mRestartFrom = from;
+  }
+  void SetDft(const std::vector<PetscReal> frequencies, const PetscInt every, const std::vector<PetscReal> region) {
+    mDftFrequencies = frequencies; mDftEvery = every; mDftRegion = region;
+  }
+  void SetGrid(const std::string file, const std::vector<PetscReal> origin, const std::vector<PetscReal> spacing,
+               const std::vector<PetscInt> shape, const PetscInt every) {
+    mGridFile = file; mGridOrigin = origin; mGridSpacing = spacing; mGridShape = shape; mGridEvery = every;
+  }
+  void SetStaging(const std::string stream, const std::string engine, const PetscInt every) {
+    mStagingStream = stream; mStagingEngine = engine; mStagingEvery = every;
+  }
+  void SetNumThreads(const PetscInt num) { mNumThreads = num; }
+  void SetWorkStealingChunk(const PetscInt size) { mWorkStealingChunk = size; }
+  void SetNodeAwareHalo(const PetscBool set) { mNodeAwareHalo = set; }
+  void SetProgressInterval(const PetscReal seconds) { mProgressInterval = seconds; }
+  void SetProgressEvery(const PetscInt num) { mProgressEvery = num; }
+  void SetEnergyCheckEvery(const PetscInt num) { mEnergyCheckEvery = num; }
+  void SetEnergyGrowth(const PetscReal factor) { mEnergyGrowth = factor; }
+  void SetDryRun(const PetscBool set, const PetscInt steps, const PetscReal efficiency) {
+    mDryRun = set; mDryRunSteps = steps; mTargetEfficiency = efficiency;
+  }
+  /** Set the time step, rounded down so that it divides the duration into whole steps. */
+  void SetTimeStep(const PetscReal dt);
+  void SetMaxTimeStepLevels(const PetscInt num) { mMaxTimeStepLevels = num; }
+  void SetCflReport(const PetscInt num, const std::string file) { mCflReport = num; mCflReportFile = file; }
+  void SetTimeSteppingScheme(const std::string &scheme) { mTimeSteppingScheme = scheme; }
+  void SetSimultaneousShots(const PetscInt num) { mNumSimultaneousShots = num; }
+  void SetEnsembleModelFiles(const std::vector<std::string> &files) { mEnsembleModelFiles = files; }
+  void SetStaticProblem(const PetscBool set, const PetscReal tolerance, const std::string &preconditioner) {
+    mStaticProblem = set; mStaticTolerance = tolerance; mStaticPreconditioner = preconditioner;
+  }
+  void SetInterleavedComponents(const PetscBool set) { mInterleavedComponents = set; }
+  void SetFieldVecType(const std::string type) { mFieldVecType = type; }
+  void SetLowMemoryGeometry(const PetscBool set) { mLowMemoryGeometry = set; }
+  void SetShareGeometry(const PetscBool set) { mShareGeometry = set; }
+  void SetSimplexReferenceStiffness(const PetscBool set) { mSimplexReferenceStiffness = set; }
+  void SetDenseElementStiffness(const PetscBool set) { mDenseElementStiffness = set; }
+  void SetSmallGemm(const PetscBool set) { mSmallGemm = set; }
+  void SetMixedPrecision(const PetscBool set) { mMixedPrecision = set; }
+  void SetHaloPrecision(const std::string &precision) { mHaloPrecision = precision; }
+  void SetGhostedState(const PetscBool set) { mGhostedState = set; }
+  void SetHaloOverlap(const PetscInt layers) { mHaloOverlap = layers; }
+  void SetHangingNodes(const PetscBool set) { mHangingNodes = set; }
+  void SetAttenuation(const PetscBool set, const std::vector<PetscReal> band) {
+    mAttenuation = set; mAttenuationBand = band;
+  }
+  void SetAxisymmetric(const PetscBool set) { mAxisymmetric = set; }
+  void SetReciprocal(const PetscBool set) { mReciprocal = set; }
+  void SetReceiverStrain(const PetscBool set) { mReceiverStrain = set; }
+  void SetReceiverStress(const PetscBool set) { mReceiverStress = set; }
+  void SetReceiverRotation(const PetscBool set) { mReceiverRotation = set; }
+  void SetReciprocalTimeFunction(const PetscReal center_freq, const PetscReal time_delay) {
+    mReciprocalCenterFreq = center_freq; mReciprocalTimeDelay = time_delay;
+  }
+  void SetSgt(const std::string &file, const PetscInt every, const PetscReal tolerance) {
+    mSgtFile = file; mSgtEvery = every; mSgtTolerance = tolerance;
+  }
+  void SetInjection(const std::vector<std::string> &boundaries, const std::string &file, const PetscInt window) {
+    mInjectionBoundaries = boundaries; mInjectionFile = file; mInjectionWindow = window;
+  }
+  void SetPeriodicBoundaries(const std::vector<std::string> &pairs) { mPeriodicBoundaries = pairs; }
+  void SetActivityMask(const PetscBool set, const PetscReal threshold, const PetscBool arrival) {
+    mActivityMask = set; mActivityThreshold = threshold; mActivityArrival = arrival;
+  }
+  void SetAutoTune(const PetscBool set) { mAutoTune = set; }
+  void SetAutoTuneFile(const std::string &file) { mAutoTuneFile = file; }
+  void SetAutoTuneMemory(const PetscReal megabytes) { mAutoTuneMemory = megabytes; }
+  void SetWeightedPartitioning(const PetscBool set) { mWeightedPartitioning = set; }
+  void SetRebalanceSteps(const PetscInt num) { mRebalanceSteps = num; }
+  void SetHierarchicalPartitioning(const PetscBool set) { mHierarchicalPartitioning = set; }
+  void SetNodeOrder(const std::string &order) { mNodeOrder = order; }
+  void SetPartitionCacheFile(const std::string &file) { mPartitionCacheFile = file; }
+  void SetReorderElements(const PetscBool set) { mReorderElements = set; }
+  void SetDistributeModel(const PetscBool set) { mDistributeModel = set; }
+  void SetNodeSharedModel(const PetscBool set) { mNodeSharedModel = set; }
+  void SetOverlapSetup(const PetscBool set) { mOverlapSetup = set; }
+  void SetMaterialCacheFile(const std::string &file) { mMaterialCacheFile = file; }
+  void SetShotFiles(const std::vector<std::string> &files) { mShotFiles = files; }
+  void SetBoxElements(const std::vector<PetscInt> &elements) { mBoxElements = elements; }
+  void SetBoxExtent(const std::vector<PetscReal> &extent) { mBoxExtent = extent; }
+  void SetBoxSimplex(const PetscBool set) { mBoxSimplex = set; }
+  void SetBoxPerturbation(const PetscReal perturbation) { mBoxPerturbation = perturbation; }
+  void SetBoxSeed(const PetscInt seed) { mBoxSeed = seed; }
+  void SetBoxPhysics(const std::string &physics) { mBoxPhysics = physics; }
 
 };
@@ -0,0 +1,73 @@
+#pragma once
+
+// stl.
+#include <cstddef>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+
+/**
+ * Slab allocator for objects of one size (i.e. the elements of one type, see ElementAdapter).
+ *
+ * Instead of one heap allocation per object, objects are carved out of slabs of at least a megabyte, aligned to
+ * the cache line, so that the elements of a type lie next to each other in the order they were created. Freed
+ * objects are reused, and the slabs are only released once every object of the pool is freed.
+ *
+ * The pages of a slab are first touched in parallel, by the threads of the element loop (SetNumThreads) with
+ * its static schedule. A slab reserved for all elements of a type (reserve) is thus placed in the memory of the
+ * thread which assembles each of them, as the element batches keep the elements in the order they were created.
+ *
+ * A pool is not thread safe: elements are created and destroyed outside of parallel regions.
+ */
+class Pool {
+
+ public:
+
+  /** @param [in] size Bytes of each object. */
+  Pool(const size_t size);
+  ~Pool();
+  Pool(const Pool&) = delete;
+  Pool &operator=(const Pool&) = delete;
+
+  /** Memory for one object. */
+  void *allocate();
+
+  /** Return the memory of an object to the pool, and release the slabs if it was the last one. */
+  void deallocate(void *ptr);
+
+  /**
+   * Make room for a number of objects in one contiguous (first touched) slab, unless the last slab still holds
+   * them.
+   * @param [in] num Number of objects about to be allocated.
+   */
+  void reserve(const size_t num);
+
+  /** Objects held, and the bytes of all slabs. */
+  inline size_t NumObjects() const { return mNumObjects; }
+  size_t SlabBytes() const;
+
+  /** Threads which first touch the slabs (the threads of the element loop). */
+  static void SetNumThreads(const PetscInt num_threads) { mNumThreads = num_threads; }
+
+  /// Alignment of the slabs and of each object.
+  static constexpr size_t Alignment = 64;
+
+ private:
+
+  size_t mSize, mSlabObjects, mNumObjects;
+
+  /// Slabs with their number of objects, and the unused objects at the end of the last one.
+  std::vector<char*> mSlabs;
+  std::vector<size_t> mSlabSizes;
+  char *mNext, *mEnd;
+
+  /// Freed objects.
+  std::vector<void*> mFree;
+
+  static PetscInt mNumThreads;
+
+  void addSlab(const size_t num);
+  void release();
+
+};
@@ -0,0 +1,178 @@
+#pragma once
+
+// stl.
+#include <array>
+#include <chrono>
+#include <string>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+#include <Utilities/HardwareCounters.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * Time spent in each phase of the setup and of the time loop.
+ *
+ * The phases run by the main thread are PETSc log events, within a "Setup" and a "Time loop" stage, so that
+ * -log_view breaks the run down by phase. The phases of single elements (gather, source, stiffness and surface
+ * terms, scatter) run inside the threaded element loops, where PETSc's logging may not be called, and are far too
+ * short to each be an event. With --profile, every phase is additionally timed per thread, and summary prints the
+ * time of each phase with its minimum, maximum and average over the ranks. On each rank, the time of a phase is
+ * that of its slowest thread. Phases include those nested within them (i.e. the element terms of the sub-levels
+ * of local time stepping are also part of the time step).
+ *
+ * With --trace-file, every phase run by the main thread is also recorded as an event (its name, start and
+ * duration) in memory, and writeTrace gathers the events of all ranks into one Chrome trace (JSON, for
+ * chrome://tracing or Perfetto), with a row per rank. A scope may be labelled (e.g. the post and the wait of a
+ * halo exchange), which names its event. The time line shows where the ranks wait for each other, and how much of
+ * an exchange is hidden behind the elements assembled meanwhile.
+ */
+class Profiler {
+
+ public:
+
+  enum Phase {
+    MeshRead, Distribute, Topology, ElementInit, MassMatrix,
+    Gather, SourceTerm, StiffnessTerm, SurfaceTerm, Scatter,
+    HaloExchange, InverseMass, TimeStep, Output,
+    NumPhases
+  };
+
+  enum Stage { Setup, TimeLoop, NumStages };
+
+  /** Register the stages and events with PETSc. Called once, after PetscInitialize. */
+  static void Register();
+
+  /**
+   * Time every phase, on up to num_threads threads. Not to be called from within a parallel region.
+   * @param [in] num_threads Number of threads per rank.
+   */
+  static void Enable(const PetscInt num_threads);
+
+  /**
+   * Also count the cycles, instructions, cache misses and floating point operations of every phase (see
+   * HardwareCounters), for which summary then adds the achieved GFLOP/s, memory bandwidth, arithmetic intensity
+   * (the position on the roofline) and share of vector instructions. Reading the counters costs a system call
+   * per scope, which inflates the times of the short per-element phases. Call after Enable.
+   * @returns False (with a warning) if the counters are not available.
+   */
+  static bool EnableCounters();
+
+  /**
+   * Record the phases of the main thread as events, from now on (collective: the time lines of the ranks start
+   * together).
+   * @param [in] file Chrome trace file which writeTrace writes.
+   */
+  static void EnableTrace(const std::string &file);
+
+  /** Push a stage (if registered). Stages do not nest. */
+  static void PushStage(const Stage stage) { if (mRegistered) { PetscLogStagePush(mStages[stage]); } }
+  /** Pop the stage pushed last. */
+  static void PopStage() { if (mRegistered) { PetscLogStagePop(); } }
+
+  /** Print the time, and number of calls, of each phase (collective). Does nothing unless enabled. */
+  static void summary();
+
+  /** Write the events of all ranks to the trace file (collective). Does nothing unless tracing. */
+  static void writeTrace();
+
+  /**
+   * A phase, timed from construction to destruction.
+   */
+  class Scope {
+
+   public:
+
+    /**
+     * @param [in] phase Phase the time is added to.
+     * @param [in] label Name of the event in the trace (a string literal), instead of that of the phase.
+     */
+    Scope(const Phase phase, const char *label = nullptr): mPhase(phase), mLabel(label) {
+      if (mRegistered && !PerElement(phase)) { PetscLogEventBegin(mEvents[phase], 0, 0, 0, 0); }
+      if (mCounting) { HardwareCounters::read(mStartCounts); }
+      if (mEnabled || mTracing) { mStart = std::chrono::steady_clock::now(); }
+    }
+
+    ~Scope() {
+      if (mEnabled || mTracing) {
+        const auto end = std::chrono::steady_clock::now();
+        if (mEnabled) { add(mPhase, std::chrono::duration<double>(end - mStart).count()); }
+        if (mTracing && !PerElement(mPhase)) { trace(mLabel ? mLabel : Name(mPhase), mStart, end); }
+      }
+      if (mCounting) { addCounts(mPhase, mStartCounts); }
+      if (mRegistered && !PerElement(mPhase)) { PetscLogEventEnd(mEvents[mPhase], 0, 0, 0, 0); }
+    }
+
+    Scope(const Scope&) = delete;
+    Scope &operator=(const Scope&) = delete;
+
+   private:
+
+    const Phase mPhase;
+    const char *mLabel;
+    std::chrono::steady_clock::time_point mStart;
+    HardwareCounters::Values mStartCounts;
+
+  };
+
+ private:
+
+  static bool mRegistered, mEnabled, mCounting, mTracing;
+  static std::array<PetscLogEvent, NumPhases> mEvents;
+  static std::array<PetscLogStage, NumStages> mStages;
+
+  /// Seconds spent, and calls, per thread and phase.
+  static std::vector<std::array<double, NumPhases>> mSeconds;
+  static std::vector<std::array<PetscInt, NumPhases>> mCalls;
+  /// Hardware counts, per thread and phase.
+  static std::vector<std::array<HardwareCounters::Values, NumPhases>> mCounts;
+
+  /// An event of the trace: its name, and its start and duration in microseconds since the trace began.
+  struct Event { const char *name; double start, duration; };
+  static std::vector<Event> mTrace;
+  static std::chrono::steady_clock::time_point mTraceStart;
+  static std::string mTraceFile;
+
+  /** Whether a phase is timed per element, inside the threaded element loops. */
+  static bool PerElement(const Phase phase) { return phase >= Gather && phase <= Scatter; }
+
+  static const char *Name(const Phase phase);
+
+  static void add(const Phase phase, const double seconds) {
+#ifdef _OPENMP
+    const size_t t = omp_get_thread_num();
+#else
+    const size_t t = 0;
+#endif
+    if (t < mSeconds.size()) { mSeconds[t][phase] += seconds; mCalls[t][phase]++; }
+  }
+
+  /** Add the counts since start to a phase. */
+  static void addCounts(const Phase phase, const HardwareCounters::Values &start) {
+#ifdef _OPENMP
+    const size_t t = omp_get_thread_num();
+#else
+    const size_t t = 0;
+#endif
+    if (t >= mCounts.size()) { return; }
+    HardwareCounters::Values end; HardwareCounters::read(end);
+    for (PetscInt c = 0; c < HardwareCounters::NumCounters; c++) { mCounts[t][phase][c] += end[c] - start[c]; }
+  }
+
+  /** Record an event of the main thread. */
+  static void trace(const char *name, const std::chrono::steady_clock::time_point &start,
+                    const std::chrono::steady_clock::time_point &end) {
+#ifdef _OPENMP
+    if (omp_get_thread_num()) { return; }
+#endif
+    typedef std::chrono::duration<double, std::micro> micro;
+    mTrace.push_back({name, micro(start - mTraceStart).count(), micro(end - start).count()});
+  }
+
+  /** Print the rates of the hardware counts of each phase (collective). */
+  static void counterSummary(const std::array<double, NumPhases> &seconds);
+
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+// stl.
+#include <array>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+#include <Eigen/Dense>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * Per-thread scratch arena for the element kernels.
+ *
+ * Instead of every element owning its own work arrays (or allocating them on every call), the
+ * kernels borrow them from here. Each thread holds one buffer per slot, which only ever grows, so
+ * once every element type has been evaluated the kernels no longer allocate. The arena is sized
+ * for the number of threads by the element batches (see ElementBatch::finalize), before elements
+ * are assembled concurrently.
+ *
+ * A borrowed buffer is valid until the same slot is borrowed again on the same thread. Kernels
+ * returning a view into the arena (e.g. Hexahedra::computeGradient) therefore hand out a result
+ * which must be used, or copied, before the same kernel is called again -- on any element.
+ */
+class Scratch {
+
+ public:
+
+  /// Buffers which may be borrowed at the same time. The shape and the physics use separate slots,
+  /// so that the physics can hold on to its buffers while calling into the shape. The source and
+  /// surface terms, which are returned alongside the stiffness term, have slots of their own.
+  enum Slot {
+    ShapeGrad, ShapeFlux, ShapeStiff, ShapeTemp,
+    PhysicsStrain, PhysicsStress, PhysicsStiff, PhysicsTemp,
+    PhysicsSource, PhysicsSurface, FaceTemp,
+    NumSlots
+  };
+
+  /**
+   * Make room for (at least) num_threads threads borrowing buffers concurrently. Buffers borrowed
+   * before are invalidated, so this must not be called from within a parallel region.
+   * @param [in] num_threads Number of threads.
+   */
+  static void Reserve(const PetscInt num_threads) {
+    if (num_threads > mBuffers.size()) { mBuffers.resize(num_threads); }
+  }
+
+  /**
+   * Borrow a matrix from the calling thread. The contents are undefined.
+   * @param [in] slot Buffer to borrow.
+   * @param [in] rows Number of rows.
+   * @param [in] cols Number of columns.
+   */
+  static Eigen::Map<Eigen::MatrixXd> Matrix(const Slot slot, const PetscInt rows, const PetscInt cols) {
+    return Eigen::Map<Eigen::MatrixXd>(borrow(slot, rows * cols), rows, cols);
+  }
+
+  /**
+   * Borrow a vector from the calling thread. The contents are undefined.
+   * @param [in] slot Buffer to borrow.
+   * @param [in] size Number of entries.
+   */
+  static Eigen::Map<Eigen::VectorXd> Vector(const Slot slot, const PetscInt size) {
+    return Eigen::Map<Eigen::VectorXd>(borrow(slot, size), size);
+  }
+
+ private:
+
+  /// Buffers, per thread and slot.
+  static std::vector<std::array<std::vector<PetscReal>, NumSlots>> mBuffers;
+
+  static PetscReal *borrow(const Slot slot, const PetscInt size) {
+#ifdef _OPENMP
+    std::vector<PetscReal> &buf = mBuffers[omp_get_thread_num()][slot];
+#else
+    std::vector<PetscReal> &buf = mBuffers[0][slot];
+#endif
+    if (buf.size() < size) { buf.resize(size); }
+    return buf.data();
+  }
+
+};
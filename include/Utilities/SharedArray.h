@@ -0,0 +1,61 @@
+#pragma once
+
+// stl.
+#include <vector>
+
+// 3rd party.
+#include <mpi.h>
+#include <petsc.h>
+
+/**
+ * Read-only array, held either by this rank alone or once per node.
+ *
+ * The values are set on one rank (assign), and broadcast to all ranks. With node_shared, the broadcast only
+ * goes to the first rank of every node, into an MPI-3 shared memory window, and the other ranks of the node
+ * look at that same copy. Large read-only data replicated on every rank (i.e. the exodus model) is then only
+ * held once per node.
+ */
+template <typename T>
+class SharedArray {
+
+ public:
+
+  SharedArray(): mData(NULL), mSize(0), mWin(MPI_WIN_NULL), mWinBytes(0) {}
+  ~SharedArray() { clear(); }
+  SharedArray(const SharedArray&) = delete;
+  SharedArray &operator=(const SharedArray&) = delete;
+
+  /** Hold some values on this rank. */
+  void assign(std::vector<T> values);
+
+  /**
+   * Broadcast the values held by a rank to all ranks (collective).
+   * @param [in] root Rank holding the values.
+   * @param [in] node_shared Keep a single copy per node, in shared memory, instead of one per rank.
+   */
+  void broadcast(const int root, const bool node_shared);
+
+  /** Release the values (collective over the node, if they are shared). */
+  void clear();
+
+  inline bool empty() const { return !mSize; }
+  inline size_t size() const { return mSize; }
+  inline const T *data() const { return mData; }
+  inline const T *begin() const { return mData; }
+  inline const T *end() const { return mData + mSize; }
+  inline const T &operator[](const size_t i) const { return mData[i]; }
+  /** Bytes allocated by this rank (the copy of a node is counted on the rank which allocated it). */
+  inline size_t Bytes() const { return sizeof(T) * mLocal.capacity() + mWinBytes; }
+
+ private:
+
+  /// Values held by this rank alone (if not shared), and the view used for access.
+  std::vector<T> mLocal;
+  const T *mData;
+  size_t mSize;
+
+  /// Shared memory window holding the values of the node (if shared), and the bytes this rank allocated in it.
+  MPI_Win mWin;
+  size_t mWinBytes;
+
+};
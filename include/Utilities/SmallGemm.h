@@ -0,0 +1,55 @@
+#pragma once
+
+// 3rd party.
+#include <petsc.h>
+#ifdef SALVUS_LIBXSMM
+#include <libxsmm.h>
+#endif
+
+/**
+ * Product C = A * B of small, packed, column major matrices of one shape (A is m x k, B is k x n and C m x n),
+ * as in the 1D contractions of the tensor elements (--small-gemm).
+ *
+ * With LIBXSMM found by CMake, the constructor dispatches a kernel generated (JIT) for the shape and the
+ * instruction set of the processor it runs on, so that one build gets near the peak of each machine. LIBXSMM
+ * keeps the kernels of all shapes, and dispatching the same shape again returns the same code. Without it, or
+ * for shapes it does not generate code for, the product falls back to Eigen.
+ */
+class SmallGemm {
+
+ public:
+
+  /** Whether salvus was built with LIBXSMM. */
+  static bool Available();
+
+  /**
+   * Dispatch the kernel of a shape.
+   * @param [in] m Rows of A and C.
+   * @param [in] n Columns of B and C.
+   * @param [in] k Columns of A, and rows of B.
+   */
+  SmallGemm(const int m, const int n, const int k);
+
+  /** C = A * B, overwriting C. */
+  void operator()(const PetscReal *a, const PetscReal *b, PetscReal *c) const {
+#ifdef SALVUS_LIBXSMM
+    if (mKernel) { mKernel(a, b, c); return; }
+#endif
+    fallback(a, b, c);
+  }
+
+  /** Whether the product runs through a generated kernel. */
+  bool Generated() const;
+
+ private:
+
+  int mM, mN, mK;
+
+#ifdef SALVUS_LIBXSMM
+  /// The generated kernel (NULL if LIBXSMM did not generate one).
+  libxsmm_dmmfunction mKernel;
+#endif
+
+  void fallback(const PetscReal *a, const PetscReal *b, PetscReal *c) const;
+
+};
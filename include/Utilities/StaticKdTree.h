@@ -0,0 +1,86 @@
+#pragma once
+
+// stl.
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+#include <Utilities/SharedArray.h>
+
+/**
+ * Static kd-tree for nearest neighbour queries (i.e. to find the model element closest to an element
+ * center).
+ *
+ * The tree is built once from all points, by recursive median splits along the widest extent, and stored
+ * implicitly in a single array: the median of each range is the node, and the two halves its children. The
+ * points are reordered into tree order, so a query walks contiguous memory and does not allocate. Batched
+ * queries are independent, and run in parallel with OpenMP.
+ */
+class StaticKdTree {
+
+ public:
+
+  StaticKdTree(): mDim(0) {}
+
+  /**
+   * Build the tree.
+   * @param [in] dim Dimension of the points.
+   * @param [in] pts Points, one after the other (num_pts x dim, row-major).
+   * @param [in] num_pts Number of points.
+   */
+  void build(const PetscInt dim, const PetscReal *pts, const PetscInt num_pts);
+
+  /**
+   * Broadcast the tree built on one rank to all ranks (collective).
+   * @param [in] root Rank which built the tree.
+   * @param [in] node_shared Keep a single copy per node (see SharedArray).
+   */
+  void broadcast(const int root, const bool node_shared);
+
+  /** Remove all points. */
+  void clear() { mPts.clear(); mIdx.clear(); mAxis.clear(); }
+
+  inline bool empty() const { return mIdx.empty(); }
+  inline PetscInt size() const { return mIdx.size(); }
+  /** Bytes held by this rank (see SharedArray::Bytes). */
+  inline size_t Bytes() const { return mPts.Bytes() + mIdx.Bytes() + mAxis.Bytes(); }
+
+  /**
+   * Nearest point.
+   * @param [in] pt Query point (dim values).
+   * @return Index (in the order passed to build) of the closest point.
+   */
+  PetscInt nearest(const PetscReal *pt) const;
+
+  /**
+   * Nearest points of many query points.
+   * @param [in] pts Query points (num_pts x dim, row-major).
+   * @param [in] num_pts Number of query points.
+   * @param [out] idx Index of the closest point, for each query point.
+   */
+  void nearest(const PetscReal *pts, const PetscInt num_pts, PetscInt *idx) const;
+
+  /**
+   * All points within a distance of a query point.
+   * @param [in] pt Query point (dim values).
+   * @param [in] radius Largest distance.
+   * @param [out] idx Index (in the order passed to build) of each point found, in no particular order.
+   */
+  void within(const PetscReal *pt, const PetscReal radius, std::vector<PetscInt> &idx) const;
+
+ private:
+
+  PetscInt mDim;
+
+  /// Points in tree order, their index as passed to build, and the split axis of each node.
+  SharedArray<PetscReal> mPts;
+  SharedArray<PetscInt> mIdx;
+  SharedArray<char> mAxis;
+
+  void split(const PetscReal *pts, const PetscInt lo, const PetscInt hi, std::vector<PetscInt> &idx,
+             std::vector<char> &axis) const;
+  void search(const PetscReal *pt, const PetscInt lo, const PetscInt hi, PetscInt &best, PetscReal &best_d2) const;
+  void collect(const PetscReal *pt, const PetscInt lo, const PetscInt hi, const PetscReal r2,
+               std::vector<PetscInt> &idx) const;
+
+};
@@ -1,15 +1,18 @@
 #pragma once
 
+#include <array>
 #include <petsc.h>
 #include <Eigen/Dense>
 #include <Element/Element.h>
+#include <Utilities/FieldId.h>
 
-/* Structure managing PETSc vectors. */
+/* Structure managing PETSc vectors. Fields which are neither gathered nor summed on the local partition (see
+ * Problem::LocalFields) go without a local vector, which is then null. */
 struct field {
-  field(const std::string name, DM &dm)
+  field(const std::string name, DM &dm, const bool local = true)
   {
-    mName = name;
-    DMCreateLocalVector(dm, &mLoc);  VecSet(mLoc, 0);
+    mName = name; mLoc = nullptr;
+    if (local) { DMCreateLocalVector(dm, &mLoc); VecSet(mLoc, 0); }
     DMCreateGlobalVector(dm, &mGlb); VecSet(mGlb, 0);
     PetscObjectSetName((PetscObject) mGlb, mName.c_str());
   }
@@ -20,7 +23,7 @@ struct field {
   }
   std::string mName; /** < Field name (i.e. displacement_x) */
   Vec mGlb;          /** < Global PETSc vector */
-  Vec mLoc;          /** < Local PETSc vector */
+  Vec mLoc;          /** < Local PETSc vector (if any) */
 };
 
 /* Here and some convienience typedefs to save space in functions. */
@@ -40,7 +43,33 @@ typedef Eigen::Matrix<PetscInt, Eigen::Dynamic, 1> IntVec;
 
 /// Complex objects.
 typedef std::vector<std::unique_ptr<Element>> ElemVec;
-typedef std::map<std::string, std::unique_ptr<field>> FieldDict;
+
+/* Dictionary of global fields, indexed by interned field id. Name-based access is kept for
+ * setup and testing, and resolves to the same slot. Names that are not registered fields are
+ * never counted, but throw when accessed. The dictionary also keeps whether its wavefield is at
+ * the start of a run from rest, which time steppers may step differently (see Order2Leapfrog). */
+class FieldDict {
+  std::array<std::unique_ptr<field>, NumFieldIds> mFields;
+  bool mFromRest = true;
+ public:
+  std::unique_ptr<field> &operator[](const FieldId id) { return mFields[static_cast<int>(id)]; }
+  std::unique_ptr<field> &operator[](const std::string &name) { return (*this)[FieldIdFromName(name)]; }
+  bool count(const FieldId id) const { return mFields[static_cast<int>(id)] != nullptr; }
+  bool count(const std::string &name) const { FieldId id; return FindFieldId(name, id) && count(id); }
+  void insert(std::unique_ptr<field> f) {
+    FieldId id = FieldIdFromName(f->mName); (*this)[id] = std::move(f);
+  }
+  /* New fields start from rest, until the first step. Resets and restores set it again. */
+  bool FromRest() const { return mFromRest; }
+  void SetFromRest(const bool from_rest) { mFromRest = from_rest; }
+  std::vector<std::string> Names() const {
+    std::vector<std::string> names;
+    for (int i = 0; i < NumFieldIds; i++) {
+      if (mFields[i]) { names.push_back(mFields[i]->mName); }
+    }
+    return names;
+  }
+};
 
 /// Custom exceptions.
 class salvus_warning: public std::exception {
@@ -54,3 +83,26 @@ class salvus_warning: public std::exception {
 
 /// Strongly typed Element types
 enum class ElementType {QUADP1, TRIP1, HEXP1, TETP1};
+
+/**
+ * Symmetry classes of the elastic stiffness of an element, from the cheapest stress kernel (see
+ * Hexahedra::elasticStiffness). VTI and orthorhombic media are orthotropic, a TTI medium whose symmetry axis is
+ * tilted in the y-z (x-z) plane is monoclinic about x (y), and any other medium is triclinic.
+ */
+enum class ElasticSymmetry {ISOTROPIC, ORTHOTROPIC, MONOCLINIC_X, MONOCLINIC_Y, TRICLINIC};
+
+/** Index of c_ij (0-based i, j) among the 21 Voigt coefficients c11, c12, ..., c16, c22, ..., c66 (the upper
+ * triangle, row by row). */
+inline constexpr int VoigtIndex(const int i, const int j) {
+  return i > j ? VoigtIndex(j, i) : 6 * i - i * (i - 1) / 2 + j - i;
+}
+
+/** Coefficients of a symmetry class which may be non zero, as a mask of their Voigt indices (the Lame parameters
+ * take the place of the isotropic ones). */
+inline constexpr int ElasticSymmetryMask(const ElasticSymmetry symmetry) {
+  /* c11, c12, c13, c22, c23, c33, c44, c55, c66; then c14, c24, c34, c56 about x, and c15, c25, c35, c46
+   * about y. */
+  return symmetry == ElasticSymmetry::TRICLINIC ? (1 << 21) - 1 :
+      0x1488c7 | (symmetry == ElasticSymmetry::MONOCLINIC_X ? 0x81108 : 0) |
+      (symmetry == ElasticSymmetry::MONOCLINIC_Y ? 0x22210 : 0);
+}
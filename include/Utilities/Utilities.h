@@ -65,6 +65,37 @@ namespace utilities {
    */
   std::vector<std::string> broadcastStringVecFromRank(std::vector<std::string> &send_buffer, int rank);
 
+  /**
+   * FNV-1a hash of a file's contents (i.e. to check that a cache was written for the same input file).
+   * @param [in] filename File to hash.
+   * @returns The hash (of an empty file, if the file cannot be read).
+   */
+  unsigned long long hashFile(const std::string &filename);
+
+  /**
+   * Read a file on rank 0, and broadcast its contents to all ranks (collective), so that an input file is
+   * read once rather than by every rank.
+   * @param [in] filename File to read.
+   * @param [out] contents Contents of the file.
+   * @returns False (on all ranks) if the file cannot be read.
+   */
+  bool readFileToAll(const std::string &filename, std::string &contents);
+
+  /**
+   * Whether a point lies within an axis aligned box.
+   * @param [in] box Lower corner then upper corner (2 or 3 coordinates each), or empty for all of space.
+   * @param [in] x, y, z The point (z is not used in 2D).
+   */
+  bool pointInBox(const std::vector<double> &box, const double x, const double y, const double z);
+
+  /**
+   * Whether values (i.e. a material at the integration points of an element) are all the same, to a relative
+   * tolerance. Such values are then kept as a single one.
+   * @param [in] values The values.
+   * @returns True if there are no two values which differ.
+   */
+  bool isConstant(const Eigen::Ref<const Eigen::ArrayXd> &values);
+
 }
 
 void seg_scan(int *invec, int *inoutvec, int *len, MPI_Datatype *dtype);
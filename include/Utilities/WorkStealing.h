@@ -0,0 +1,115 @@
+#pragma once
+
+// stl.
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+// 3rd party.
+#include <petsc.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * Work-stealing schedule of a parallel loop over fixed-size chunks of a range (--work-stealing-chunk, see
+ * ElementBatch).
+ *
+ * The chunks are sorted by their estimated cost, and dealt round robin to the queues of the threads, so that
+ * each thread starts with its most expensive chunks and the queues hold about the same cost. A thread takes the
+ * chunks of its own queue from the front, and once it is empty, steals the cheapest chunk left (from the back)
+ * of the other queues, so that no thread idles while another still has work. Each queue is a single atomic
+ * range, taken from either end by one compare-and-swap.
+ *
+ * The cost of a chunk is first estimated from that of its elements. Every run then times each chunk, and the
+ * next run deals them by the (smoothed) time they took. A schedule is not thread safe: it is planned and run
+ * outside of parallel regions.
+ */
+class WorkStealing {
+
+ public:
+
+  WorkStealing(): mNumThreads(1), mMeasured(false) {}
+
+  /**
+   * Split a range into chunks, and deal them by an estimate of their cost.
+   * @param [in] begin First index of the range.
+   * @param [in] end One past the last index.
+   * @param [in] size Indices per chunk (the last may hold fewer).
+   * @param [in] num_threads Threads which run the chunks.
+   * @param [in] cost Relative cost of each index of the range, until the chunks are timed.
+   */
+  void plan(const PetscInt begin, const PetscInt end, const PetscInt size, const PetscInt num_threads,
+            const std::vector<double> &cost);
+
+  /**
+   * Run all chunks on the threads (collective over them), and deal them again by the time each took.
+   * @param [in] body Called as body(begin, end, thread) for each chunk [begin, end), with the number of the
+   * thread running it.
+   */
+  template <typename Body>
+  void run(Body body) {
+    for (PetscInt t = 0; t < mNumThreads; t++) { mQueues[t].range = pack(mQueueBegin[t], mQueueBegin[t + 1]); }
+    #pragma omp parallel num_threads(mNumThreads)
+    {
+#ifdef _OPENMP
+      const PetscInt t = omp_get_thread_num();
+#else
+      const PetscInt t = 0;
+#endif
+      PetscInt c;
+      while (next(t, c)) {
+        const auto start = std::chrono::steady_clock::now();
+        body(mBegin[c], mBegin[c + 1], t);
+        mSeconds[c] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      }
+    }
+    measured();
+  }
+
+  /** Number of chunks. */
+  inline PetscInt NumChunks() const { return mCost.size(); }
+
+  /** Chunks in the queue of a thread, in the order it takes them. */
+  std::vector<PetscInt> Queue(const PetscInt thread) const {
+    return std::vector<PetscInt>(mOrder.begin() + mQueueBegin[thread], mOrder.begin() + mQueueBegin[thread + 1]);
+  }
+
+ private:
+
+  PetscInt mNumThreads;
+
+  /// First index of each chunk (with the end of the range last), the cost of each chunk (in seconds once
+  /// measured), and the seconds of the last run.
+  std::vector<PetscInt> mBegin;
+  std::vector<double> mCost, mSeconds;
+  bool mMeasured;
+
+  /// Chunks of all queues, the queue of thread t at [mQueueBegin[t], mQueueBegin[t + 1]) of mOrder.
+  std::vector<PetscInt> mOrder, mQueueBegin;
+
+  /// Front and back of the chunks left in each queue (as positions in mOrder), on a cache line each.
+  struct Range {
+    std::atomic<unsigned long long> range;
+    char pad[64 - sizeof(std::atomic<unsigned long long>)];
+  };
+  std::unique_ptr<Range[]> mQueues;
+
+  static unsigned long long pack(const PetscInt front, const PetscInt back) {
+    return (static_cast<unsigned long long>(front) << 32) | static_cast<unsigned long long>(back);
+  }
+
+  /** Take a chunk from the front of a queue, or from its back. False if the queue is empty. */
+  bool take(const PetscInt queue, const bool front, PetscInt &chunk);
+
+  /** The next chunk of a thread: its own, or stolen. False once all queues are empty. */
+  bool next(const PetscInt thread, PetscInt &chunk);
+
+  /** Deal the chunks to the queues by their cost. */
+  void deal();
+
+  /** Fold the seconds of a run into the costs, and deal again. */
+  void measured();
+
+};
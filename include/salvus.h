@@ -7,20 +7,43 @@
 #include <Element/HyperCube/HexP1.h>
 #include <Element/HyperCube/TensorQuad.h>
 #include <Element/HyperCube/QuadP1.h>
-#include <Element/HyperCube/Autogen/quad_autogen.h>
+#include <Element/HyperCube/Gll.h>
 
 /* Utilities. */
+#include <Utilities/AsyncWriter.h>
 #include <Utilities/kdtree.h>
 #include <Utilities/Logging.h>
 #include <Utilities/Options.h>
+#include <Utilities/Profiler.h>
+#include <Utilities/HardwareCounters.h>
+#include <Utilities/LocalIndex.h>
+#include <Utilities/Memory.h>
+#include <Utilities/Scratch.h>
+#include <Utilities/SmallGemm.h>
+#include <Utilities/Pool.h>
+#include <Utilities/StaticKdTree.h>
+#include <Utilities/WorkStealing.h>
+#include <Utilities/SharedArray.h>
 #include <Utilities/Types.h>
 #include <Utilities/Utilities.h>
 
 #include <Mesh/Mesh.h>
 #include <Problem/Problem.h>
+#include <Problem/Simulation.h>
+#include <Problem/Progress.h>
+#include <Problem/Monitor.h>
+#include <Problem/Fourier.h>
+#include <Problem/Staging.h>
+#include <Problem/Checkpoints.h>
+#include <Problem/Restart.h>
+#include <Problem/BoundaryWavefield.h>
+#include <Problem/Tuner.h>
 #include <Model/ExodusModel.h>
+#include <Model/MaterialCache.h>
 
 #include <Source/Source.h>
+#include <Source/AdjointSource.h>
 #include <Receiver/Receiver.h>
 #include <Receiver/ReceiverHdf5.h>
+#include <Receiver/Misfit.h>
 
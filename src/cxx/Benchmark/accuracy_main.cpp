@@ -0,0 +1,265 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <petsc.h>
+#include <salvus.h>
+
+/*
+ * Cost against accuracy of the discretization.
+ *
+ * Runs a problem with an analytic solution on synthetic boxes (see Mesh::readBox), for each polynomial order of
+ * --accuracy-orders and each density of --accuracy-elements-per-wavelength, and reports the error of each run next
+ * to its cost: wall time, global dofs and memory. The cheapest run within a relative error of --accuracy-target is
+ * then the configuration to choose on this machine, for meshes of a similar quality and number of wavelengths.
+ *
+ * The problem is a Ricker point source of --accuracy-frequency (the centre frequency f) in a homogeneous acoustic
+ * medium (VP of --box-material, 1 by default), u_tt - c^2 lap u = s(t) delta(x - x_s), recorded by a receiver
+ * --accuracy-distance dominant wavelengths c / f away. Its solution is u = s(t - r / c) / (4 pi c^2 r) in 3D, and
+ * the convolution of s with the Green's function H(t - r / c) / (2 pi c^2 sqrt(t^2 - r^2 / c^2)) in 2D. The box
+ * is large enough that no reflection from its sides reaches the receiver within the duration of the shot, and
+ * the error is the relative L2 norm of the difference of the recorded and the analytic trace over all steps.
+ *
+ * The elements per wavelength are those of the shortest wavelength which matters, c / (2 f), at which the Ricker
+ * spectrum has fallen to a fifth of its peak. The time step is the stable one (--time-step-safety-factor), so
+ * the error holds that of the time stepping too, as a run would. The options of the boxes (i.e. --box-simplex,
+ * --box-perturbation) and of the solver are those of the command line.
+ *
+ * One JSON record per run is appended to --accuracy-output (or printed to stdout).
+ */
+
+INIT_LOGGING_STATE();
+
+struct Record {
+  PetscInt order, elements, dofs, steps;
+  double elements_per_wavelength, time_step, setup_seconds, seconds, megabytes, error;
+};
+
+/** A Ricker wavelet of centre frequency f, delayed by t0. */
+static double ricker(const double t, const double f, const double t0) {
+  const double factor = M_PI * M_PI * f * f * (t - t0) * (t - t0);
+  return (1 - 2 * factor) * std::exp(-factor);
+}
+
+/**
+ * Solution of u_tt - c^2 lap u = s(t) delta(x) for a Ricker wavelet s.
+ * @param [in] dim Dimension.
+ * @param [in] r Distance from the source.
+ * @param [in] c Wave speed.
+ * @param [in] t Time.
+ * @param [in] f Centre frequency of the wavelet.
+ * @param [in] t0 Delay of the wavelet.
+ */
+static double analytic(const PetscInt dim, const double r, const double c, const double t, const double f,
+                       const double t0) {
+
+  if (dim == 3) { return ricker(t - r / c, f, t0) / (4 * M_PI * c * c * r); }
+
+  /* With t' = (r / c) cosh(theta), the singularity of the Green's function at the wavefront drops out:
+   * u = 1 / (2 pi c^2) int_0^acosh(c t / r) s(t - (r / c) cosh(theta)) dtheta, by Simpson's rule. */
+  if (c * t <= r) { return 0; }
+  const PetscInt n = 2000;
+  const double upper = std::acosh(c * t / r), h = upper / n;
+  double sum = 0;
+  for (PetscInt i = 0; i <= n; i++) {
+    const double weight = i == 0 || i == n ? 1 : i % 2 ? 4 : 2;
+    sum += weight * ricker(t - r / c * std::cosh(i * h), f, t0);
+  }
+  return sum * h / 3 / (2 * M_PI * c * c);
+
+}
+
+/** A value in full precision, as an option. */
+static std::string text(const double value) {
+  std::ostringstream os;
+  os.precision(17);
+  os << value;
+  return os.str();
+}
+
+static std::string json(const Record &r, const PetscInt dim) {
+  std::ostringstream os;
+  os.precision(6);
+  os << "{\"dimension\": " << dim << ", \"order\": " << r.order << ", \"elements_per_wavelength\": "
+     << r.elements_per_wavelength << ", \"elements\": " << r.elements << ", \"dofs\": " << r.dofs
+     << ", \"steps\": " << r.steps << ", \"time_step\": " << r.time_step << ", \"setup_seconds\": "
+     << r.setup_seconds << ", \"seconds\": " << r.seconds << ", \"megabytes\": " << r.megabytes
+     << ", \"error\": " << r.error << "}";
+  return os.str();
+}
+
+int main(int argc, char *argv[]) {
+
+  PetscInitialize(&argc, &argv, NULL, NULL);
+  Profiler::Register();
+
+  try {
+
+    /* Sweep options. */
+    PetscBool parameter_set;
+    std::vector<PetscInt> orders(32);
+    PetscInt num_orders = orders.size();
+    PetscOptionsGetIntArray(NULL, NULL, "--accuracy-orders", orders.data(), &num_orders, &parameter_set);
+    if (parameter_set) { orders.resize(num_orders); } else { orders = {2, 3, 4, 5, 6}; }
+    std::vector<PetscReal> densities(32);
+    PetscInt num_densities = densities.size();
+    PetscOptionsGetScalarArray(NULL, NULL, "--accuracy-elements-per-wavelength", densities.data(), &num_densities,
+                               &parameter_set);
+    if (parameter_set) { densities.resize(num_densities); } else { densities = {1, 1.5, 2, 3, 4}; }
+    for (auto d: densities) {
+      if (d <= 0) { throw std::runtime_error("--accuracy-elements-per-wavelength must be positive."); }
+    }
+    PetscReal frequency = 1, distance = 3, target = 0;
+    PetscOptionsGetReal(NULL, NULL, "--accuracy-frequency", &frequency, &parameter_set);
+    if (frequency <= 0) { throw std::runtime_error("--accuracy-frequency must be positive."); }
+    PetscOptionsGetReal(NULL, NULL, "--accuracy-distance", &distance, &parameter_set);
+    if (distance <= 0) { throw std::runtime_error("--accuracy-distance must be positive."); }
+    PetscOptionsGetReal(NULL, NULL, "--accuracy-target", &target, &parameter_set);
+    char char_buffer[PETSC_MAX_PATH_LEN];
+    PetscOptionsGetString(NULL, NULL, "--accuracy-output", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+    std::string output = parameter_set ? std::string(char_buffer) : "";
+
+    /* The medium, and the geometry of the boxes. The source sits in the centre, and the receiver along the first
+     * axis from it. The wavelet lasts about 1.2 / f to either side of its delay, so its reflection off the nearest
+     * side arrives after the end of the shot with a half width of the distance and 1.5 wavelengths. The box,
+     * order and duration of each run are set below. */
+    PetscInt dim = 0;
+    PetscOptionsGetInt(NULL, NULL, "--dimension", &dim, &parameter_set);
+    if (dim != 2 && dim != 3) { throw std::runtime_error("--dimension must be 2 or 3."); }
+    PetscOptionsSetValue(NULL, "--box-physics", "fluid");
+    PetscOptionsSetValue(NULL, "--box-elements", dim == 3 ? "1,1,1" : "1,1");
+    PetscOptionsSetValue(NULL, "--polynomial-order", std::to_string(orders[0]).c_str());
+    PetscOptionsSetValue(NULL, "--duration", "1");
+    std::unique_ptr<Options> options(new Options);
+    options->setOptions();
+    const auto vp_given = options->BoxMaterial().find("VP");
+    const double c = vp_given == options->BoxMaterial().end() ? 1.0 : vp_given->second;
+    const double dominant = c / frequency, shortest = 0.5 * dominant;
+    const double r = distance * dominant, half_width = r + 1.5 * dominant, t0 = 1.2 / frequency;
+    const double duration = t0 + r / c + 1.2 / frequency;
+    const char *axes[3] = {"x", "y", "z"};
+
+    typedef std::chrono::steady_clock clock;
+    auto wall = [](const clock::time_point &start) {
+      double seconds = std::chrono::duration<double>(clock::now() - start).count();
+      MPI_Allreduce(MPI_IN_PLACE, &seconds, 1, MPI_DOUBLE, MPI_MAX, PETSC_COMM_WORLD);
+      return seconds;
+    };
+
+    std::vector<Record> records;
+    for (auto order: orders) {
+      for (auto density: densities) {
+
+        /* The box of this density, with the shot. */
+        const PetscInt n = std::max<PetscInt>(1, std::ceil(2 * half_width * density / shortest));
+        std::string elements, extent;
+        for (PetscInt d = 0; d < dim; d++) {
+          elements += (d ? "," : "") + std::to_string(n);
+          extent += (d ? "," : "") + text(2 * half_width);
+        }
+        PetscOptionsSetValue(NULL, "--box-elements", elements.c_str());
+        PetscOptionsSetValue(NULL, "--box-extent", extent.c_str());
+        PetscOptionsSetValue(NULL, "--polynomial-order", std::to_string(order).c_str());
+        PetscOptionsSetValue(NULL, "--duration", text(duration).c_str());
+        PetscOptionsSetValue(NULL, "--number-of-sources", "1");
+        PetscOptionsSetValue(NULL, "--source-type", "ricker");
+        PetscOptionsSetValue(NULL, "--source-num-components", "1");
+        PetscOptionsSetValue(NULL, "--ricker-amplitude", "1");
+        PetscOptionsSetValue(NULL, "--ricker-time-delay", text(t0).c_str());
+        PetscOptionsSetValue(NULL, "--ricker-center-freq", text(frequency).c_str());
+        PetscOptionsSetValue(NULL, "--number-of-receivers", "1");
+        PetscOptionsSetValue(NULL, "--receiver-names", "analytic");
+        PetscOptionsSetValue(NULL, "--receiver-file-name", "accuracy.h5");
+        for (PetscInt d = 0; d < dim; d++) {
+          const double x = half_width + (d ? 0 : r);
+          PetscOptionsSetValue(NULL, ("--source-location-" + std::string(axes[d])).c_str(),
+                               text(half_width).c_str());
+          PetscOptionsSetValue(NULL, ("--receiver-location-" + std::string(axes[d])).c_str(),
+                               text(x).c_str());
+        }
+
+        /* The trace stays in the receiver store, as for a misfit (see Simulation::runGradient). */
+        Record rec;
+        rec.order = order; rec.elements_per_wavelength = density;
+        rec.elements = 1;
+        for (PetscInt d = 0; d < dim; d++) { rec.elements *= n; }
+        try {
+          options->setOptions();
+          options->SetReceiverFileName("");
+          options->SetReceiverWriteEvery(0);
+          MPI_Barrier(PETSC_COMM_WORLD);
+          auto start = clock::now();
+          std::unique_ptr<Simulation> simulation(new Simulation(options));
+          rec.setup_seconds = wall(start);
+          rec.dofs = simulation->NumGlobalDof();
+          MPI_Barrier(PETSC_COMM_WORLD);
+          start = clock::now();
+          rec.steps = simulation->run(options);
+          rec.seconds = wall(start);
+          rec.time_step = options->TimeStep();
+
+          Memory::Bytes bytes = simulation->MemoryBytes();
+          double total = 0;
+          for (auto b: bytes) { total += b; }
+          MPI_Allreduce(MPI_IN_PLACE, &total, 1, MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
+          rec.megabytes = total / (1024.0 * 1024.0);
+
+          /* The recorded trace against the analytic one, on the rank of the receiver. */
+          double sums[2] = {0, 0};
+          for (auto receiver: Receiver::StoreReceivers()) {
+            size_t num; const float *samples = receiver->Samples("u", num);
+            for (size_t k = 0; k < num; k++) {
+              const double exact = analytic(dim, r, c, k * rec.time_step, frequency, t0);
+              sums[0] += (samples[k] - exact) * (samples[k] - exact); sums[1] += exact * exact;
+            }
+          }
+          MPI_Allreduce(MPI_IN_PLACE, sums, 2, MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
+          if (!(sums[1] > 0)) { throw std::runtime_error("the receiver recorded no samples."); }
+          rec.error = std::sqrt(sums[0] / sums[1]);
+        } catch (std::runtime_error &e) {
+          LOG() << "Warning: skipping order " << order << " at " << density << " elements per wavelength: "
+                << e.what();
+          continue;
+        }
+        records.push_back(rec);
+
+        LOG() << "Order " << order << ", " << density << " elements per wavelength: error " << rec.error << " in "
+              << rec.seconds << " s, " << rec.dofs << " dofs, " << rec.megabytes << " MB.";
+        if (!PetscGlobalRank) {
+          if (output.empty()) { std::cout << json(rec, dim) << std::endl; }
+          else { std::ofstream(output, std::ios::app) << json(rec, dim) << std::endl; }
+        }
+
+      }
+    }
+
+    /* The cheapest run (in wall time) within the target error. */
+    if (target > 0) {
+      const Record *best = nullptr;
+      for (auto &rec: records) {
+        if (rec.error <= target && (!best || rec.seconds < best->seconds)) { best = &rec; }
+      }
+      if (best) {
+        LOG() << "Cheapest within an error of " << target << ": order " << best->order << " at "
+              << best->elements_per_wavelength << " elements per wavelength (error " << best->error << ", "
+              << best->seconds << " s).";
+      } else {
+        LOG() << "Warning: no run is within an error of " << target << ".";
+      }
+    }
+
+  } catch (std::runtime_error &e) {
+    LOG() << e.what();
+    PetscFinalize();
+    return 1;
+  }
+
+  PetscFinalize();
+  return 0;
+
+}
@@ -0,0 +1,396 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <petsc.h>
+#include <salvus.h>
+#include <Physics/Scalar.h>
+#include <Physics/ScalarTri.h>
+#include <Physics/Elastic2D.h>
+#include <Physics/Elastic3D.h>
+#include <Element/Simplex/Triangle.h>
+#include <Element/Simplex/TriP1.h>
+#include <Element/Simplex/Tetrahedra.h>
+#include <Element/Simplex/TetP1.h>
+
+/*
+ * Microbenchmarks of the element kernels.
+ *
+ * The elements are built as in a run, from --mesh-file and --model-file (or a synthetic box, see Mesh::readBox), for
+ * each order of --bench-orders (or else --polynomial-order). Up to --bench-elements elements of each concrete type
+ * found in the mesh form a batch, over which each kernel is called in turn until --bench-min-time seconds have
+ * passed. The results go to --bench-output as JSON (or to stdout), one record per workload, type, order and kernel.
+ * The setup phases (reading the mesh, its topology and the element initialization) are recorded as well, as type
+ * "setup", per integration point of all elements.
+ *
+ * Performance regressions: with --bench-suite, the workloads are a fixed set of small boxes instead (one per
+ * concrete element type, see Suite), so that every kernel is covered. Each timing is repeated --bench-repetitions
+ * times, and its median kept. With --bench-baseline, every record is compared to the one of the same workload,
+ * type, order and kernel in an earlier output, and a record slower than it by more than --bench-tolerance (a
+ * fraction, 0.1 by default) is a regression: the benchmark then fails, or only warns with --bench-warn-only.
+ *
+ * The flop counts are nominal: those of the sum-factorized operators (tensor elements) or of the dense ones
+ * (simplices), and of the Jacobian transformation at each point. The bytes are those of the fields read and
+ * written by a call, per element.
+ */
+
+INIT_LOGGING_STATE();
+
+struct Record {
+  std::string workload, type, kernel;
+  PetscInt order, elements, calls;
+  double seconds, ns_per_dof, spread, gflops, bytes_per_element;
+  /// Median seconds per call (of an element, or of the whole setup phase).
+  double per_call;
+};
+
+/** A synthetic box of the regression suite. */
+struct Workload {
+  std::string name, elements;
+  PetscInt dim;
+  bool simplex;
+  std::string physics;
+};
+
+/** The regression suite: small boxes (about the size of the unit test meshes) of every concrete element type. */
+static const std::vector<Workload> Suite = {
+    {"quad_fluid", "8,8", 2, false, "fluid"},
+    {"quad_elastic", "8,8", 2, false, "elastic"},
+    {"tri_fluid", "8,8", 2, true, "fluid"},
+    {"hex_fluid", "4,4,4", 3, false, "fluid"},
+    {"hex_elastic", "4,4,4", 3, false, "elastic"},
+    {"tet_fluid", "3,3,3", 3, true, "fluid"}};
+
+/** Median of some values (which are reordered). */
+static double median(std::vector<double> &values) {
+  std::sort(values.begin(), values.end());
+  const size_t n = values.size();
+  return n % 2 ? values[n / 2] : 0.5 * (values[n / 2 - 1] + values[n / 2]);
+}
+
+/** Nominal flops of a gradient (or of its transpose, integrating against the gradient of the test functions). */
+static double gradientFlops(const bool simplex, const PetscInt dim, const PetscInt order, const PetscInt num_pnt) {
+  const double per_pnt = simplex ? num_pnt : order + 1;
+  return 2.0 * dim * num_pnt * per_pnt + 2.0 * dim * dim * num_pnt;
+}
+
+/**
+ * Time a kernel over a batch of elements.
+ * @param [in] kernel Runs the kernel on one element, and returns a value of its result (so that it is not elided).
+ * @param [in] repetitions Number of timings, each of at least min_time seconds.
+ * @return The calls and seconds of all timings, with the median seconds per call, and the spread of the
+ * timings relative to it.
+ */
+template <typename E, typename K>
+static Record timeKernel(const std::vector<E*> &batch, K kernel, const double min_time, const PetscInt repetitions) {
+
+  typedef std::chrono::steady_clock clock;
+  Record rec;
+  rec.elements = batch.size(); rec.calls = 0; rec.seconds = 0;
+  volatile double sink = 0;
+
+  /* One pass first, so that the scratch buffers are allocated. */
+  for (auto elm: batch) { sink = sink + kernel(elm); }
+  std::vector<double> per_call;
+  for (PetscInt r = 0; r < repetitions; r++) {
+    PetscInt calls = 0;
+    auto start = clock::now();
+    std::chrono::duration<double> elapsed(0);
+    while (elapsed.count() < min_time) {
+      for (auto elm: batch) { sink = sink + kernel(elm); }
+      calls += batch.size();
+      elapsed = clock::now() - start;
+    }
+    rec.calls += calls; rec.seconds += elapsed.count();
+    per_call.push_back(elapsed.count() / calls);
+  }
+  const double fastest = *std::min_element(per_call.begin(), per_call.end());
+  const double slowest = *std::max_element(per_call.begin(), per_call.end());
+  const double typical = median(per_call);
+  rec.spread = (slowest - fastest) / typical;
+  rec.per_call = typical;
+  return rec;
+
+}
+
+/**
+ * Run the kernels of the elements of one concrete type.
+ */
+template <typename T>
+static void benchType(ElemVec const &elements, const std::string &workload, const bool simplex,
+                      const PetscInt order, const PetscInt max_elements, const double min_time,
+                      const PetscInt repetitions, std::vector<Record> &records) {
+
+  std::vector<T*> batch;
+  for (auto &elm: elements) {
+    auto adapter = dynamic_cast<ElementAdapter<T>*>(elm.get());
+    if (adapter && batch.size() < max_elements) { batch.push_back(adapter); }
+  }
+  if (batch.empty()) { return; }
+
+  T *first = batch[0];
+  const PetscInt num_pnt = first->NumIntPnt(), dim = first->NumDim();
+  const PetscInt num_pull = first->PullElementalFields().size(), num_push = first->PushElementalFields().size();
+  const Eigen::MatrixXd u = Eigen::MatrixXd::Random(num_pnt, num_pull);
+  const Eigen::VectorXd f = Eigen::VectorXd::Random(num_pnt);
+  const Eigen::MatrixXd g = Eigen::MatrixXd::Random(num_pnt, dim);
+
+  /* The stiffness term is num_pull gradients and integrations, and the constitutive relation at each point. */
+  const PetscInt num_voigt = dim == 3 ? 6 : 3;
+  const double grad_flops = gradientFlops(simplex, dim, order, num_pnt);
+  const double stiff_flops = num_pull * 2 * grad_flops +
+      (num_pull > 1 ? 2.0 * num_voigt * num_voigt * num_pnt : 1.0 * dim * num_pnt);
+
+  auto add = [&](Record rec, const std::string &kernel, const double flops, const double bytes) {
+    rec.workload = workload; rec.type = T::Name(); rec.kernel = kernel; rec.order = order;
+    rec.ns_per_dof = 1e9 * rec.per_call / (num_pnt * num_pull);
+    rec.gflops = 1e-9 * flops / rec.per_call;
+    rec.bytes_per_element = bytes;
+    records.push_back(rec);
+    LOG() << workload << " " << rec.type << " order " << order << " " << kernel << ": " << rec.ns_per_dof
+          << " ns/dof, " << rec.gflops << " GFLOP/s";
+  };
+
+  add(timeKernel(batch, [&](T *elm) { return elm->computeStiffnessTerm(u)(0, 0); }, min_time, repetitions),
+      "computeStiffnessTerm", stiff_flops, 8.0 * num_pnt * (num_pull + num_push));
+  add(timeKernel(batch, [&](T *elm) { return elm->computeGradient(f)(0, 0); }, min_time, repetitions),
+      "computeGradient", grad_flops, 8.0 * num_pnt * (1 + dim));
+  add(timeKernel(batch, [&](T *elm) { return elm->applyGradTestAndIntegrate(g)(0); }, min_time, repetitions),
+      "applyGradTestAndIntegrate", grad_flops, 8.0 * num_pnt * (dim + 1));
+  add(timeKernel(batch, [&](T *elm) { return elm->assembleElementMassMatrix()(0, 0); }, min_time, repetitions),
+      "assembleElementMassMatrix", 2.0 * num_pnt, 8.0 * num_pnt);
+
+}
+
+static std::string json(const std::vector<Record> &records, const PetscInt num_ranks) {
+  std::ostringstream os;
+  os.precision(6);
+  os << "{\n  \"ranks\": " << num_ranks << ",\n  \"results\": [";
+  for (size_t i = 0; i < records.size(); i++) {
+    const Record &r = records[i];
+    os << (i ? ",\n" : "\n") << "    {\"workload\": \"" << r.workload << "\", \"type\": \"" << r.type
+       << "\", \"order\": " << r.order << ", \"kernel\": \"" << r.kernel << "\", \"elements\": " << r.elements
+       << ", \"calls\": " << r.calls << ", \"seconds\": " << r.seconds << ", \"ns_per_dof\": " << r.ns_per_dof
+       << ", \"spread\": " << r.spread << ", \"gflops\": " << r.gflops
+       << ", \"bytes_per_element\": " << r.bytes_per_element << "}";
+  }
+  os << "\n  ]\n}\n";
+  return os.str();
+}
+
+/** Value following "key": in a JSON record, as a string (empty if not found). */
+static std::string field(const std::string &record, const std::string &key) {
+  const std::string tag = "\"" + key + "\": ";
+  const size_t pos = record.find(tag);
+  if (pos == std::string::npos) { return ""; }
+  const size_t start = pos + tag.size() + (record[pos + tag.size()] == '"');
+  return record.substr(start, record.find_first_of("\",}", start) - start);
+}
+
+static std::string key(const std::string &workload, const std::string &type, const PetscInt order,
+                       const std::string &kernel) {
+  return workload + " " + type + " order " + std::to_string(order) + " " + kernel;
+}
+
+/**
+ * Compare the records to a baseline (an earlier --bench-output), and log each regression and improvement.
+ * @return The number of records slower than their baseline by more than the tolerance.
+ */
+static PetscInt compare(const std::vector<Record> &records, const std::string &baseline, const double tolerance) {
+
+  std::ifstream file(baseline);
+  if (!file) { throw std::runtime_error("Can't open baseline '" + baseline + "'."); }
+  std::map<std::string, double> base;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.find("\"kernel\"") == std::string::npos) { continue; }
+    base[key(field(line, "workload"), field(line, "type"), std::stoi(field(line, "order")), field(line, "kernel"))] =
+        std::stod(field(line, "ns_per_dof"));
+  }
+
+  PetscInt regressions = 0;
+  for (auto &r: records) {
+    auto b = base.find(key(r.workload, r.type, r.order, r.kernel));
+    if (b == base.end()) {
+      LOG() << "Warning: no baseline for " << key(r.workload, r.type, r.order, r.kernel);
+      continue;
+    }
+    const double ratio = r.ns_per_dof / b->second;
+    if (ratio > 1 + tolerance) {
+      LOG() << "Warning: regression in " << b->first << ": " << r.ns_per_dof << " ns/dof, baseline "
+            << b->second << " (" << 100 * (ratio - 1) << "% slower)";
+      regressions++;
+    } else if (ratio < 1 - tolerance) {
+      LOG() << "Improvement in " << b->first << ": " << r.ns_per_dof << " ns/dof, baseline " << b->second
+            << " (" << 100 * (1 - ratio) << "% faster)";
+    }
+  }
+  LOG() << regressions << " regression(s) in " << records.size() << " records, at a tolerance of "
+        << 100 * tolerance << "%.";
+  return regressions;
+
+}
+
+/**
+ * Benchmark the setup and the kernels of one mesh (the command line's, or a box of the suite).
+ */
+static void benchWorkload(std::unique_ptr<Options> &options, std::unique_ptr<ExodusModel> &model,
+                          const std::string &workload, const std::vector<PetscInt> &orders,
+                          const PetscInt max_elements, const double min_time, const PetscInt repetitions,
+                          std::vector<Record> &records) {
+
+  typedef std::chrono::steady_clock clock;
+  for (auto order: orders) {
+
+    PetscOptionsSetValue(NULL, "--polynomial-order", std::to_string(order).c_str());
+    options->setOptions();
+    const bool box = !options->BoxElements().empty();
+
+    /* Elements of this order, as in a run, set up once per repetition. Orders a shape does not support are
+     * skipped. */
+    std::unique_ptr<Mesh> mesh;
+    ElemVec elements;
+    std::vector<double> phases[3];
+    try {
+      for (PetscInt r = 0; r < repetitions; r++) {
+        elements.clear();
+        mesh = Mesh::Factory(options);
+        auto problem = Problem::Factory(options);
+        auto start = clock::now();
+        if (box) { mesh->readBox(options); } else { mesh->read(model, options); }
+        auto topology = clock::now();
+        mesh->setupTopology(model, options);
+        auto initialize = clock::now();
+        elements = problem->initializeElements(mesh, model, options);
+        auto end = clock::now();
+        phases[0].push_back(std::chrono::duration<double>(topology - start).count());
+        phases[1].push_back(std::chrono::duration<double>(initialize - topology).count());
+        phases[2].push_back(std::chrono::duration<double>(end - initialize).count());
+      }
+    } catch (std::runtime_error &e) {
+      LOG() << "Warning: skipping order " << order << ": " << e.what();
+      continue;
+    }
+
+    /* The setup phases, per integration point of all elements. */
+    PetscInt num_pnt = 0;
+    for (auto &elm: elements) { num_pnt += elm->NumIntPnt(); }
+    const char *names[3] = {"readMesh", "setupTopology", "initializeElements"};
+    for (int p = 0; p < 3; p++) {
+      Record rec;
+      rec.workload = workload; rec.type = "setup"; rec.kernel = names[p]; rec.order = order;
+      rec.elements = elements.size(); rec.calls = repetitions; rec.gflops = 0; rec.bytes_per_element = 0;
+      rec.seconds = 0;
+      for (auto s: phases[p]) { rec.seconds += s; }
+      const double fastest = *std::min_element(phases[p].begin(), phases[p].end());
+      const double slowest = *std::max_element(phases[p].begin(), phases[p].end());
+      const double typical = median(phases[p]);
+      rec.per_call = typical;
+      rec.spread = typical > 0 ? (slowest - fastest) / typical : 0;
+      rec.ns_per_dof = num_pnt ? 1e9 * typical / num_pnt : 0;
+      records.push_back(rec);
+      LOG() << workload << " setup order " << order << " " << names[p] << ": " << rec.ns_per_dof << " ns/dof";
+    }
+
+    benchType<Scalar<TensorQuad<QuadP1>>>(elements, workload, false, order, max_elements, min_time, repetitions,
+                                          records);
+    benchType<Elastic2D<TensorQuad<QuadP1>>>(elements, workload, false, order, max_elements, min_time,
+                                             repetitions, records);
+    benchType<ScalarTri<Scalar<Triangle<TriP1>>>>(elements, workload, true, order, max_elements, min_time,
+                                                  repetitions, records);
+    benchType<Scalar<Hexahedra<HexP1>>>(elements, workload, false, order, max_elements, min_time, repetitions,
+                                        records);
+    benchType<Elastic3D<Hexahedra<HexP1>>>(elements, workload, false, order, max_elements, min_time,
+                                           repetitions, records);
+    benchType<Scalar<Tetrahedra<TetP1>>>(elements, workload, true, order, max_elements, min_time, repetitions,
+                                         records);
+
+  }
+
+}
+
+int main(int argc, char *argv[]) {
+
+  PetscInitialize(&argc, &argv, NULL, NULL);
+
+  try {
+
+    std::unique_ptr<Options> options(new Options);
+    options->setOptions();
+
+    /* Benchmark options. */
+    PetscBool parameter_set;
+    std::vector<PetscInt> orders(32);
+    PetscInt num_orders = orders.size();
+    PetscOptionsGetIntArray(NULL, NULL, "--bench-orders", orders.data(), &num_orders, &parameter_set);
+    if (parameter_set) { orders.resize(num_orders); } else { orders.assign(1, options->PolynomialOrder()); }
+    PetscInt max_elements = 64;
+    PetscOptionsGetInt(NULL, NULL, "--bench-elements", &max_elements, &parameter_set);
+    PetscReal min_time = 0.1;
+    PetscOptionsGetReal(NULL, NULL, "--bench-min-time", &min_time, &parameter_set);
+    char char_buffer[PETSC_MAX_PATH_LEN];
+    PetscOptionsGetString(NULL, NULL, "--bench-output", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+    std::string output = parameter_set ? std::string(char_buffer) : "";
+
+    /* Regression options. */
+    PetscBool suite = PETSC_FALSE, warn_only = PETSC_FALSE;
+    PetscOptionsGetBool(NULL, NULL, "--bench-suite", &suite, &parameter_set);
+    PetscOptionsGetBool(NULL, NULL, "--bench-warn-only", &warn_only, &parameter_set);
+    PetscInt repetitions = 1;
+    PetscOptionsGetInt(NULL, NULL, "--bench-repetitions", &repetitions, &parameter_set);
+    if (repetitions < 1) { throw std::runtime_error("--bench-repetitions must be at least 1."); }
+    PetscReal tolerance = 0.1;
+    PetscOptionsGetReal(NULL, NULL, "--bench-tolerance", &tolerance, &parameter_set);
+    if (tolerance < 0) { throw std::runtime_error("--bench-tolerance must not be negative."); }
+    PetscOptionsGetString(NULL, NULL, "--bench-baseline", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+    std::string baseline = parameter_set ? std::string(char_buffer) : "";
+
+    std::vector<Record> records;
+    std::unique_ptr<ExodusModel> model(new ExodusModel(options));
+    if (suite) {
+      /* The boxes replace any mesh given on the command line. The time loop is not run, so any duration will do. */
+      PetscBool has_duration;
+      PetscOptionsHasName(NULL, NULL, "--duration", &has_duration);
+      if (!has_duration) { PetscOptionsSetValue(NULL, "--duration", "1"); }
+      for (auto &w: Suite) {
+        PetscOptionsSetValue(NULL, "--box-elements", w.elements.c_str());
+        PetscOptionsSetValue(NULL, "--box-simplex", w.simplex ? "true" : "false");
+        PetscOptionsSetValue(NULL, "--box-physics", w.physics.c_str());
+        PetscOptionsSetValue(NULL, "--dimension", std::to_string(w.dim).c_str());
+        options->setOptions();
+        model->setHomogeneous(w.dim, w.physics, options->BoxMaterial());
+        benchWorkload(options, model, w.name, orders, max_elements, min_time, repetitions, records);
+      }
+    } else {
+      if (options->BoxElements().empty()) { model->read(); }
+      else { model->setHomogeneous(options->BoxElements().size(), options->BoxPhysics(), options->BoxMaterial()); }
+      benchWorkload(options, model, "mesh", orders, max_elements, min_time, repetitions, records);
+    }
+
+    int num_ranks; MPI_Comm_size(PETSC_COMM_WORLD, &num_ranks);
+    PetscInt regressions = 0;
+    if (!PetscGlobalRank) {
+      if (output.empty()) { std::cout << json(records, num_ranks); }
+      else { std::ofstream(output) << json(records, num_ranks); }
+      if (!baseline.empty()) { regressions = compare(records, baseline, tolerance); }
+    }
+    MPI_Bcast(&regressions, 1, MPIU_INT, 0, PETSC_COMM_WORLD);
+    if (regressions && !warn_only) {
+      throw std::runtime_error(std::to_string(regressions) + " kernel(s) or setup phase(s) regressed.");
+    }
+
+  } catch (std::runtime_error &e) {
+    LOG() << e.what();
+    PetscFinalize();
+    return 1;
+  }
+
+  PetscFinalize();
+  return 0;
+
+}
@@ -0,0 +1,114 @@
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <petsc.h>
+#include <salvus.h>
+
+/*
+ * Scaling runs.
+ *
+ * Sets up and runs the shot given on the command line as salvus does, usually on a synthetic box (--box-elements,
+ * see Mesh::readBox) so that the problem size is not bound by a mesh file. With --scaling-weak, the elements along
+ * the first axis are multiplied by the number of ranks, so that each rank keeps the same share of the work.
+ *
+ * The wall time of the time loop (of the slowest rank) is reported per time step and global degree of freedom.
+ * With --scaling-output, one JSON record per run is appended to that file, and the parallel efficiency is relative
+ * to its first record: the time per step and dof, times the number of ranks, of the first run over that of this
+ * one. This is the usual strong scaling efficiency for runs of the same size, and the weak scaling efficiency for
+ * runs of the same size per rank.
+ */
+
+INIT_LOGGING_STATE();
+
+/** Value following "key": in a JSON record (0 if not found). */
+static double field(const std::string &record, const std::string &key) {
+  const std::string tag = "\"" + key + "\": ";
+  const size_t pos = record.find(tag);
+  return pos == std::string::npos ? 0 : std::stod(record.substr(pos + tag.size()));
+}
+
+int main(int argc, char *argv[]) {
+
+  PetscInitialize(&argc, &argv, NULL, NULL);
+  Profiler::Register();
+
+  try {
+
+    std::unique_ptr<Options> options(new Options);
+    options->setOptions();
+    if (options->Profile()) { Profiler::Enable(options->NumThreads()); }
+    if (options->ProfileCounters()) { Profiler::EnableCounters(); }
+    if (!options->TraceFile().empty()) { Profiler::EnableTrace(options->TraceFile()); }
+    int num_ranks; MPI_Comm_size(PETSC_COMM_WORLD, &num_ranks);
+
+    /* Scaling options. */
+    PetscBool weak = PETSC_FALSE, parameter_set;
+    PetscOptionsGetBool(NULL, NULL, "--scaling-weak", &weak, &parameter_set);
+    char char_buffer[PETSC_MAX_PATH_LEN];
+    PetscOptionsGetString(NULL, NULL, "--scaling-output", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+    std::string output = parameter_set ? std::string(char_buffer) : "";
+    if (weak) {
+      if (options->BoxElements().empty()) { throw std::runtime_error("--scaling-weak requires --box-elements."); }
+      std::vector<PetscInt> elements = options->BoxElements();
+      elements[0] *= num_ranks;
+      options->SetBoxElements(elements);
+    }
+
+    typedef std::chrono::steady_clock clock;
+    auto wall = [](const clock::time_point &start) {
+      double seconds = std::chrono::duration<double>(clock::now() - start).count();
+      MPI_Allreduce(MPI_IN_PLACE, &seconds, 1, MPI_DOUBLE, MPI_MAX, PETSC_COMM_WORLD);
+      return seconds;
+    };
+
+    MPI_Barrier(PETSC_COMM_WORLD);
+    auto start = clock::now();
+    std::unique_ptr<Simulation> simulation(new Simulation(options));
+    const double setup = wall(start);
+    const PetscInt num_dof = simulation->NumGlobalDof();
+
+    MPI_Barrier(PETSC_COMM_WORLD);
+    start = clock::now();
+    const PetscInt num_steps = simulation->run(options);
+    const double seconds = wall(start);
+    Profiler::summary();
+    Profiler::writeTrace();
+
+    if (!PetscGlobalRank) {
+
+      /* Time per step and dof, times the ranks, of the first record (if any) over that of this run. */
+      const double per_dof_step = num_steps && num_dof ? seconds / (1.0 * num_steps * num_dof) : 0;
+      double efficiency = 1;
+      if (!output.empty()) {
+        std::ifstream previous(output);
+        std::string first;
+        if (std::getline(previous, first) && !first.empty() && per_dof_step) {
+          efficiency = field(first, "ns_per_dof_step") * 1e-9 * field(first, "ranks") / (per_dof_step * num_ranks);
+        }
+      }
+
+      std::ostringstream os;
+      os.precision(6);
+      os << "{\"ranks\": " << num_ranks << ", \"threads\": " << options->NumThreads() << ", \"dofs\": " << num_dof
+         << ", \"steps\": " << num_steps << ", \"setup_seconds\": " << setup << ", \"seconds\": " << seconds
+         << ", \"ns_per_dof_step\": " << 1e9 * per_dof_step << ", \"efficiency\": " << efficiency << "}";
+      LOG() << "Scaling: " << os.str();
+      if (output.empty()) { std::cout << os.str() << std::endl; }
+      else { std::ofstream(output, std::ios::app) << os.str() << std::endl; }
+
+    }
+
+  } catch (std::runtime_error &e) {
+    LOG() << e.what();
+    PetscFinalize();
+    return 1;
+  }
+
+  PetscFinalize();
+  return 0;
+
+}
@@ -18,9 +18,12 @@
 #include <Physics/Elastic3D.h>
 #include <Physics/AcousticElastic2D.h>
 #include <Physics/ElasticAcoustic2D.h>
+#include <Physics/AcousticElastic3D.h>
+#include <Physics/ElasticAcoustic3D.h>
+#include <Physics/Absorbing.h>
+#include <Physics/Attenuating.h>
 #include <Utilities/Utilities.h>
 #include <Utilities/Logging.h>
-#include <Physics/HomogeneousDirichlet.h>
 
 enum elem_code { eQuad, eHex, eTri, eTet, eNotImplemented };
 elem_code etype(const std::string &etype) {
@@ -34,31 +37,44 @@ elem_code etype(const std::string &etype) {
 enum phys_code {
   /* Pure fluid. */
   eFluid,
-  /* Pure fluid on mesh boundary. */
-  eFluidBoundaryHomoDirichlet,
   /* Pure 2d elastic. */
   eElastic2D,
-  /* 2D elastic boundary. */
-  eElastic2DBoundaryHomoDirichlet,
   /* Pure 3d elastic. */
   eElastic3D,
-  /* 3D elastic boundary. */
-  eElastic3DBoundaryHomoDirichlet,
+  /* Pure fluid, 2d and 3d elastic with an absorbing boundary. */
+  eFluidAbsorbing,
+  eElastic2DAbsorbing,
+  eElastic3DAbsorbing,
+  /* Pure fluid and 3d elastic with attenuation, with or without an absorbing boundary. */
+  eFluidAttenuating,
+  eElastic3DAttenuating,
+  eFluidAbsorbingAttenuating,
+  eElastic3DAbsorbingAttenuating,
   /* 2D fluid couple to base solid. */
   eFluidToSolid2D,
   /* 2D solid couple to base fluid. */
   eSolidToFluid2D,
-  /* 2D solid couple to base fluid on boundary. */
-  eSolidToFluidBoundary2DHomoDirichlet,
-  /* 2D fluid couple to base solid on boundary. */
-  eFluidToSolidBoundary2DHomoDirichlet,
+  /* 3D fluid couple to base solid, and 3D solid couple to base fluid. */
+  eFluidToSolid3D,
+  eSolidToFluid3D,
   /* If nothing appropriate was found. */
   eError
 };
 phys_code ptype(const std::vector<std::string> &ptype, const std::vector<std::string> &ctype) {
 
-  /* Turn coupling types into a set, as there may be multiple. */
+  /* Turn coupling types into a set, as there may be multiple. Homogeneous Dirichlet boundaries are
+   * enforced on the global dofs (see Problem::initializeBoundaryDofs), so they do not change the element. */
   std::set<std::string> cset(ctype.begin(), ctype.end());
+  cset.erase("boundary_homo_dirichlet");
+
+  /* Absorbing boundaries are only supported without coupling. */
+  if (cset.erase("boundary_absorbing")) {
+    if (ptype.size() != 1 || !cset.empty()) { return eError; }
+    if (ptype[0] == "fluid") { return eFluidAbsorbing; }
+    if (ptype[0] == "2delastic") { return eElastic2DAbsorbing; }
+    if (ptype[0] == "3delastic") { return eElastic3DAbsorbing; }
+    return eError;
+  }
 
   if (!ptype.size() || ptype.size() > 1) {
     return eError;
@@ -69,13 +85,9 @@ phys_code ptype(const std::vector<std::string> &ptype, const std::vector<std::st
     } else if (cset.size() == 1) {
       if (cset.find("2delastic") != cset.end()) {
         return eSolidToFluid2D;
-      } else if (cset.find("boundary_homo_dirichlet") != cset.end()) {
-        return eFluidBoundaryHomoDirichlet;
       }
-    } else if (cset.size() == 2) {
-      if (cset.find("2delastic") != cset.end() &&
-          cset.find("boundary_homo_dirichlet")  != cset.end()) {
-        return eSolidToFluidBoundary2DHomoDirichlet;
+      if (cset.find("3delastic") != cset.end()) {
+        return eSolidToFluid3D;
       }
     } else {
       return eError;
@@ -88,13 +100,6 @@ phys_code ptype(const std::vector<std::string> &ptype, const std::vector<std::st
     else if (cset.size() == 1) {
       if (cset.find("fluid") != cset.end()) {
         return eFluidToSolid2D;
-      } else if (cset.find("boundary_homo_dirichlet") != cset.end()) {
-        return eElastic2DBoundaryHomoDirichlet;
-      }
-    } else if (cset.size() == 2) {
-      if ((cset.find("fluid") != cset.end()) &&
-          (cset.find("boundary_homo_dirichlet") != cset.end())) {
-        return eFluidToSolidBoundary2DHomoDirichlet;
       }
     } else {
       return eError;
@@ -104,8 +109,8 @@ phys_code ptype(const std::vector<std::string> &ptype, const std::vector<std::st
     if (cset.empty()) {
       return eElastic3D;
     } else if (cset.size() == 1) {
-      if (cset.find("boundary_homo_dirichlet") != cset.end()) {
-        return eElastic3DBoundaryHomoDirichlet;
+      if (cset.find("fluid") != cset.end()) {
+        return eFluidToSolid3D;
       }
     } else {
       return eError;
@@ -114,191 +119,86 @@ phys_code ptype(const std::vector<std::string> &ptype, const std::vector<std::st
   return eError;
 }
 
-std::unique_ptr<Element> Element::Factory(const std::string &shape,
-                                          const std::vector<std::string> &physics_base,
-                                          const std::vector<std::string> &physics_couple,
-                                          std::unique_ptr<Options> const &options) {
-
-
-  std::string base = physics_base[0], couple;
-  for (auto &p: physics_couple) { couple += p + ", "; }
-
-  switch (etype(shape)) {
-
-    case eQuad:
-      switch (ptype(physics_base, physics_couple)) {
-
-        case eFluid:
-          return std::unique_ptr<Element> (
-              new ElementAdapter<
-                  Scalar<
-                      TensorQuad<
-                          QuadP1>>>(options));
-
-        case eElastic2D:
-          return std::unique_ptr<Element> (
-              new ElementAdapter<
-                  Elastic2D<
-                      TensorQuad<
-                          QuadP1>>>(options));
-
-        case eFluidBoundaryHomoDirichlet:
-          return std::unique_ptr<Element> (
-              new ElementAdapter<
-                  HomogeneousDirichlet<
-                      Scalar<
-                          TensorQuad<
-                              QuadP1>>>>(options));
-
-        case eElastic2DBoundaryHomoDirichlet:
-          return std::unique_ptr<Element> (
-              new ElementAdapter<
-                  HomogeneousDirichlet<
-                      Elastic2D<
-                          TensorQuad<
-                              QuadP1>>>>(options));
-
-        case eSolidToFluid2D:
-          return std::unique_ptr<Element> (
-              new ElementAdapter<
-                  ElasticToAcoustic2D<
-                      Scalar<
-                          TensorQuad<
-                              QuadP1>>>>(options));
-
-        case eFluidToSolid2D:
-          return std::unique_ptr<Element> (
-              new ElementAdapter<
-                  AcousticToElastic2D<
-                      Elastic2D<
-                          TensorQuad<
-                              QuadP1>>>>(options));
-
-        case eSolidToFluidBoundary2DHomoDirichlet:
-          return std::unique_ptr<Element> (
-              new ElementAdapter<
-                  HomogeneousDirichlet<
-                      ElasticToAcoustic2D<
-                          Scalar<
-                              TensorQuad<
-                                  QuadP1>>>>>(options));
-
-        case eFluidToSolidBoundary2DHomoDirichlet:
-          return std::unique_ptr<Element> (
-              new ElementAdapter<
-                  HomogeneousDirichlet<
-                      AcousticToElastic2D<
-                          Elastic2D<
-                              TensorQuad<
-                                  QuadP1>>>>>(options));
-
-        default:
-          throw std::runtime_error("Element could not be built.\n"
-                                   "Type:             quad\n"
-                                   "Base physics:     " + base +"\n"
-                                   "Coupling physics: " + couple);
-
-      }
-    case eTri:
-      switch (ptype(physics_base, physics_couple)) {
-
-        case eFluid:
-          return std::unique_ptr<Element> (new ElementAdapter<
-                                           ScalarTri<
-                                           Scalar<
-                                           Triangle<
-                                           TriP1>>>>(options));
-          break;
-        case eFluidBoundaryHomoDirichlet:
-          return std::unique_ptr<Element> (new ElementAdapter<
-                                           HomogeneousDirichlet<
-                                           ScalarTri<
-                                           Scalar<
-                                           Triangle<
-                                           TriP1>>>>>(options));
-          break;
-        default:
-          throw std::runtime_error("Element could not be built.\n"
-                                   "Type:             tri\n"
-                                   "Base physics:     " + base +"\n"
-                                   "Coupling physics: " + couple);
-          break;
-      }
-    
-    case eHex:
-      switch (ptype(physics_base, physics_couple)) {
-
-        case eFluid:
-          return std::unique_ptr<Element> (
-              new ElementAdapter<
-                  Scalar<
-                      Hexahedra<
-                          HexP1>>>(options));
-
-        case eElastic3D:
-          return std::unique_ptr<Element> (
-              new ElementAdapter<
-                  Elastic3D<
-                      Hexahedra<
-                          HexP1>>>(options));
-
-        case eFluidBoundaryHomoDirichlet:
-          return std::unique_ptr<Element> (
-              new ElementAdapter<
-                  HomogeneousDirichlet<
-                      Scalar<
-                          Hexahedra<
-                              HexP1>>>>(options));
+/* The attenuating variant of a physics (see Attenuating), if there is one. */
+phys_code attenuating(const phys_code code) {
+  switch (code) {
+    case eFluid: return eFluidAttenuating;
+    case eElastic3D: return eElastic3DAttenuating;
+    case eFluidAbsorbing: return eFluidAbsorbingAttenuating;
+    case eElastic3DAbsorbing: return eElastic3DAbsorbingAttenuating;
+    default: return eError;
+  }
+}
 
-        case eElastic3DBoundaryHomoDirichlet:
-          return std::unique_ptr<Element> (
-              new ElementAdapter<
-                  HomogeneousDirichlet<
-                      Elastic3D<
-                          Hexahedra<
-                              HexP1>>>>(options));
+/* Element types are numbered by shape and physics, and built through a table of their constructors. */
+typedef Element *(*Constructor)(std::unique_ptr<Options> const &options);
+template <typename T>
+static Element *construct(std::unique_ptr<Options> const &options) { return new ElementAdapter<T>(options); }
+
+static const std::vector<Constructor> &constructors() {
+  static const std::vector<Constructor> table = [] {
+    std::vector<Constructor> t(eNotImplemented * eError, nullptr);
+    auto at = [&t](const elem_code e, const phys_code p) -> Constructor & { return t[e * eError + p]; };
+    at(eQuad, eFluid) = construct<Scalar<TensorQuad<QuadP1>>>;
+    at(eQuad, eElastic2D) = construct<Elastic2D<TensorQuad<QuadP1>>>;
+    at(eQuad, eFluidAbsorbing) = construct<Absorbing<Scalar<TensorQuad<QuadP1>>>>;
+    at(eQuad, eElastic2DAbsorbing) = construct<Absorbing<Elastic2D<TensorQuad<QuadP1>>>>;
+    at(eQuad, eFluidAttenuating) = construct<Attenuating<Scalar<TensorQuad<QuadP1>>>>;
+    at(eQuad, eFluidAbsorbingAttenuating) = construct<Absorbing<Attenuating<Scalar<TensorQuad<QuadP1>>>>>;
+    at(eQuad, eSolidToFluid2D) = construct<ElasticToAcoustic2D<Scalar<TensorQuad<QuadP1>>>>;
+    at(eQuad, eFluidToSolid2D) = construct<AcousticToElastic2D<Elastic2D<TensorQuad<QuadP1>>>>;
+    at(eTri, eFluid) = construct<ScalarTri<Scalar<Triangle<TriP1>>>>;
+    at(eHex, eFluid) = construct<Scalar<Hexahedra<HexP1>>>;
+    at(eHex, eElastic3D) = construct<Elastic3D<Hexahedra<HexP1>>>;
+    at(eHex, eFluidAbsorbing) = construct<Absorbing<Scalar<Hexahedra<HexP1>>>>;
+    at(eHex, eElastic3DAbsorbing) = construct<Absorbing<Elastic3D<Hexahedra<HexP1>>>>;
+    at(eHex, eFluidAttenuating) = construct<Attenuating<Scalar<Hexahedra<HexP1>>>>;
+    at(eHex, eElastic3DAttenuating) = construct<Attenuating<Elastic3D<Hexahedra<HexP1>>>>;
+    at(eHex, eFluidAbsorbingAttenuating) = construct<Absorbing<Attenuating<Scalar<Hexahedra<HexP1>>>>>;
+    at(eHex, eElastic3DAbsorbingAttenuating) = construct<Absorbing<Attenuating<Elastic3D<Hexahedra<HexP1>>>>>;
+    at(eHex, eSolidToFluid3D) = construct<ElasticToAcoustic3D<Scalar<Hexahedra<HexP1>>>>;
+    at(eHex, eFluidToSolid3D) = construct<AcousticToElastic3D<Elastic3D<Hexahedra<HexP1>>>>;
+    at(eTet, eFluid) = construct<Scalar<Tetrahedra<TetP1>>>;
+    return t;
+  }();
+  return table;
+}
 
-        default:
-          throw std::runtime_error("Element could not be built.\n"
-                                   "Type:             quad\n"
-                                   "Base physics:     " + base +"\n"
-                                   "Coupling physics: " + couple);
-          break;
-      }
+PetscInt Element::NumTypeCodes() { return eNotImplemented * eError; }
+
+PetscInt Element::TypeCode(const std::string &shape,
+                           const std::vector<std::string> &physics_base,
+                           const std::vector<std::string> &physics_couple,
+                           const bool attenuation) {
+  const elem_code e = etype(shape);
+  const phys_code p = attenuation ? attenuating(ptype(physics_base, physics_couple)) :
+                                    ptype(physics_base, physics_couple);
+  if (e == eNotImplemented || p == eError || !constructors()[e * eError + p]) { return -1; }
+  return e * eError + p;
+}
 
-    case eTet:
-      switch (ptype(physics_base, physics_couple)) {
+std::unique_ptr<Element> Element::Factory(const PetscInt type, std::unique_ptr<Options> const &options) {
+  if (type < 0 || type >= NumTypeCodes() || !constructors()[type]) {
+    throw std::runtime_error("Element type " + std::to_string(type) + " could not be built.");
+  }
+  return std::unique_ptr<Element> (constructors()[type](options));
+}
 
-        case eFluid:
-          return std::unique_ptr<Element> (new ElementAdapter<
-                                           Scalar<
-                                           Tetrahedra<
-                                           TetP1>>>(options));
-          break;
-        case eFluidBoundaryHomoDirichlet:
-          return std::unique_ptr<Element> (new ElementAdapter<
-                                           HomogeneousDirichlet<
-                                           Scalar<
-                                           Tetrahedra<
-                                           TetP1>>>>(options));
-          break;
-        default:
-          throw std::runtime_error("Element could not be built.\n"
-                                   "Type:             tri\n"
-                                   "Base physics:     " + base +"\n"
-                                   "Coupling physics: " + couple);
-          break;
-      }
-      
-    default:
-      throw std::runtime_error("Element could not be built.\n"
-                               "Type:             \n" + shape + "\n"
-                               "Base physics:     " + base +"\n"
-                               "Coupling physics: " + couple);
-      break;
+std::unique_ptr<Element> Element::Factory(const std::string &shape,
+                                          const std::vector<std::string> &physics_base,
+                                          const std::vector<std::string> &physics_couple,
+                                          std::unique_ptr<Options> const &options) {
 
+  const PetscInt type = TypeCode(shape, physics_base, physics_couple, options->Attenuation());
+  if (type < 0) {
+    std::string base = physics_base.empty() ? "" : physics_base[0], couple;
+    for (auto &p: physics_couple) { couple += p + ", "; }
+    if (options->Attenuation()) { couple += "(attenuating)"; }
+    throw std::runtime_error("Element could not be built.\n"
+                             "Type:             " + shape + "\n"
+                             "Base physics:     " + base + "\n"
+                             "Coupling physics: " + couple);
   }
-
-  throw std::runtime_error("Element shape not supported.");
+  return Factory(type, options);
 
 }
@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <Element/ElementBatch.h>
+
+void ElementBatch::appendLevels(const Region region, const PetscInt *lvl, const PetscInt num_dof,
+                                const PetscInt elm_lvl, const bool has_src) {
+
+  /* An element takes part from its own level, up to the finest level of any of its dofs. */
+  PetscInt max_lvl = elm_lvl;
+  if (lvl) {
+    mDofLvl[region].insert(mDofLvl[region].end(), lvl, lvl + num_dof);
+    max_lvl = std::max(max_lvl, *std::max_element(lvl, lvl + num_dof));
+  }
+  mLvlMin[region].push_back(elm_lvl);
+  mLvlMax[region].push_back(max_lvl);
+  mHasSrc[region].push_back(has_src);
+
+}
+
+std::vector<PetscInt> ElementBatch::colorRegion(const Region region) {
+
+  const PetscInt num_elm = size(region);
+  if (!num_elm) { mColorOff[region].assign(1, 0); return {}; }
+
+  /* Colors already touching each dof. */
+  PetscInt num_idx = *std::max_element(mIdx[region].begin(), mIdx[region].end()) + 1;
+  std::vector<std::vector<PetscInt>> dof_colors(num_idx);
+
+  /* Greedy: give each element the lowest color not used by any of its dofs. */
+  PetscInt num_colors = 0;
+  std::vector<PetscInt> color(num_elm);
+  std::vector<bool> taken;
+  for (PetscInt e = 0; e < num_elm; e++) {
+    taken.assign(num_colors + 1, false);
+    for (PetscInt j = mOff[region][e]; j < mOff[region][e + 1]; j++) {
+      for (auto c: dof_colors[mIdx[region][j]]) { taken[c] = true; }
+    }
+    color[e] = std::find(taken.begin(), taken.end(), false) - taken.begin();
+    num_colors = std::max(num_colors, color[e] + 1);
+    for (PetscInt j = mOff[region][e]; j < mOff[region][e + 1]; j++) {
+      dof_colors[mIdx[region][j]].push_back(color[e]);
+    }
+  }
+
+  /* Stable sort of elements by color. */
+  std::vector<PetscInt> perm(num_elm);
+  for (PetscInt e = 0; e < num_elm; e++) { perm[e] = e; }
+  std::stable_sort(perm.begin(), perm.end(),
+                   [&color](const PetscInt a, const PetscInt b) { return color[a] < color[b]; });
+
+  /* Rebuild index and level tables, and color ranges, in the new order. */
+  const bool has_lvl = !mDofLvl[region].empty();
+  std::vector<LocalInt> idx, lvl;
+  std::vector<PetscInt> off(1, 0), lvl_min(num_elm), lvl_max(num_elm);
+  std::vector<bool> has_src(num_elm);
+  idx.reserve(mIdx[region].size()); lvl.reserve(mDofLvl[region].size()); off.reserve(num_elm + 1);
+  mColorOff[region].assign(1, 0);
+  for (PetscInt e = 0; e < num_elm; e++) {
+    PetscInt old = perm[e];
+    idx.insert(idx.end(), mIdx[region].begin() + mOff[region][old],
+               mIdx[region].begin() + mOff[region][old + 1]);
+    if (has_lvl) {
+      lvl.insert(lvl.end(), mDofLvl[region].begin() + mOff[region][old],
+                 mDofLvl[region].begin() + mOff[region][old + 1]);
+    }
+    off.push_back(idx.size());
+    lvl_min[e] = mLvlMin[region][old]; lvl_max[e] = mLvlMax[region][old];
+    has_src[e] = mHasSrc[region][old];
+    if (e == num_elm - 1 || color[perm[e + 1]] != color[old]) { mColorOff[region].push_back(e + 1); }
+  }
+  mIdx[region].swap(idx); mOff[region].swap(off); mDofLvl[region].swap(lvl);
+  mLvlMin[region].swap(lvl_min); mLvlMax[region].swap(lvl_max); mHasSrc[region].swap(has_src);
+
+  return perm;
+
+}
+
+void ElementBatch::planSchedules(const Region region, const PetscInt multiple) {
+
+  const PetscInt chunk = (mChunkSize + multiple - 1) / multiple * multiple;
+  mSchedules[region].resize(mColorOff[region].size() - 1);
+  for (size_t c = 0; c < mSchedules[region].size(); c++) {
+    const PetscInt beg = mColorOff[region][c], end = mColorOff[region][c + 1];
+    std::vector<double> cost(end - beg);
+    for (PetscInt e = beg; e < end; e++) { cost[e - beg] = mHasSrc[region][e] || mHasRec[region][e] ? 2 : 1; }
+    mSchedules[region][c].plan(beg, end, chunk, mNumThreads, cost);
+  }
+
+}
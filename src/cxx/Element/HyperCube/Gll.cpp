@@ -0,0 +1,138 @@
+#include <Element/HyperCube/Gll.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+/* Legendre polynomials P_order and P_order-1 at x, by their three term recurrence. */
+static void legendre(const PetscInt order, const PetscReal x, PetscReal &p, PetscReal &p_prev) {
+  p_prev = 1; p = x;
+  for (PetscInt k = 2; k <= order; k++) {
+    const PetscReal p_next = ((2 * k - 1) * x * p - (k - 1) * p_prev) / k;
+    p_prev = p; p = p_next;
+  }
+}
+
+RealVec Gll::Points(const PetscInt order) {
+
+  if (order < 1) { throw std::runtime_error("GLL points need an order >= 1, not " + std::to_string(order)); }
+
+  /* Newton's method on (1 - x^2) P_order'(x), from the Chebyshev-Gauss-Lobatto points (which are close), in
+   * the form (x P_order - P_order-1) / ((order + 1) P_order). The end points are fixed by it. */
+  RealVec x(order + 1);
+  for (PetscInt i = 0; i <= order; i++) { x(i) = -std::cos(M_PI * i / order); }
+  for (PetscInt it = 0; it < 100; it++) {
+    PetscReal change = 0;
+    for (PetscInt i = 0; i <= order; i++) {
+      PetscReal p, p_prev; legendre(order, x(i), p, p_prev);
+      const PetscReal dx = (x(i) * p - p_prev) / ((order + 1) * p);
+      x(i) -= dx; change = std::max(change, std::abs(dx));
+    }
+    if (change < 4 * std::numeric_limits<PetscReal>::epsilon()) { break; }
+  }
+
+  /* Exactly symmetric about 0. */
+  for (PetscInt i = 0; i <= order / 2; i++) {
+    const PetscReal xi = (x(order - i) - x(i)) / 2;
+    x(i) = -xi; x(order - i) = xi;
+  }
+  if (order % 2 == 0) { x(order / 2) = 0; }
+  return x;
+
+}
+
+RealVec Gll::Weights(const PetscInt order) {
+  const RealVec x = Points(order);
+  RealVec w(order + 1);
+  for (PetscInt i = 0; i <= order; i++) {
+    PetscReal p, p_prev; legendre(order, x(i), p, p_prev);
+    w(i) = 2.0 / (order * (order + 1) * p * p);
+  }
+  return w;
+}
+
+RealVec Gll::JacobiPoints(const PetscInt order) {
+
+  if (order < 1) { throw std::runtime_error("GLJ points need an order >= 1, not " + std::to_string(order)); }
+
+  /* The interior points are the Gauss points of the weight (1 - x) (1 + x)^2, i.e. the eigenvalues of the
+   * symmetric tridiagonal matrix of the three term recurrence of the Jacobi polynomials P^(1,2) (Golub and
+   * Welsch, 1969). */
+  const PetscReal a = 1, b = 2;
+  const PetscInt n = order - 1;
+  RealMat jac = RealMat::Zero(n, n);
+  for (PetscInt k = 0; k < n; k++) {
+    const PetscReal c = 2 * k + a + b;
+    jac(k, k) = (b * b - a * a) / (c * (c + 2));
+    if (k == 0) { continue; }
+    jac(k, k - 1) = jac(k - 1, k) =
+        std::sqrt(4 * k * (k + a) * (k + b) * (k + a + b) / (c * c * (c + 1) * (c - 1)));
+  }
+  RealVec x(order + 1);
+  x(0) = -1; x(order) = 1;
+  if (n) {
+    Eigen::SelfAdjointEigenSolver<RealMat> eig(jac);
+    RealVec roots = eig.eigenvalues();
+    std::sort(roots.data(), roots.data() + n);
+    x.segment(1, n) = roots;
+  }
+  return x;
+
+}
+
+RealVec Gll::JacobiWeights(const PetscInt order) {
+
+  /* Interpolatory weights, the integrals of (1 + x) l_j(x), which the GLL rule of one order more integrates
+   * exactly. */
+  const RealVec x = JacobiPoints(order);
+  const RealVec gll_x = Points(order + 1), gll_w = Weights(order + 1);
+  RealVec w = RealVec::Zero(order + 1);
+  for (PetscInt k = 0; k < gll_x.size(); k++) { w += gll_w(k) * (1 + gll_x(k)) * Lagrange(x, gll_x(k)); }
+  return w;
+
+}
+
+RealVec Gll::Lagrange(const Eigen::Ref<const RealVec> &pts, const PetscReal x) {
+  const PetscInt n = pts.size();
+  RealVec l = RealVec::Ones(n);
+  for (PetscInt j = 0; j < n; j++) {
+    for (PetscInt k = 0; k < n; k++) { if (k != j) { l(j) *= (x - pts(k)) / (pts(j) - pts(k)); } }
+  }
+  return l;
+}
+
+RealVec Gll::LagrangeDerivative(const Eigen::Ref<const RealVec> &pts, const PetscReal x) {
+  /* l_j'(x) = sum_m 1 / (x_j - x_m) prod_k (x - x_k) / (x_j - x_k), over m, k != j and k != m. */
+  const PetscInt n = pts.size();
+  RealVec dl = RealVec::Zero(n);
+  for (PetscInt j = 0; j < n; j++) {
+    for (PetscInt m = 0; m < n; m++) {
+      if (m == j) { continue; }
+      PetscReal term = 1 / (pts(j) - pts(m));
+      for (PetscInt k = 0; k < n; k++) { if (k != j && k != m) { term *= (x - pts(k)) / (pts(j) - pts(k)); } }
+      dl(j) += term;
+    }
+  }
+  return dl;
+}
+
+RealMat Gll::DerivativeMatrix(const Eigen::Ref<const RealVec> &pts) {
+  RealMat d(pts.size(), pts.size());
+  for (PetscInt i = 0; i < pts.size(); i++) { d.row(i) = LagrangeDerivative(pts, pts(i)).transpose(); }
+  return d;
+}
+
+RealVec Gll::TensorProduct(const Eigen::Ref<const RealVec> &r, const Eigen::Ref<const RealVec> &s) {
+  RealVec out(r.size() * s.size());
+  for (PetscInt j = 0; j < s.size(); j++) { out.segment(j * r.size(), r.size()) = r * s(j); }
+  return out;
+}
+
+RealVec Gll::TensorProduct(const Eigen::Ref<const RealVec> &r, const Eigen::Ref<const RealVec> &s,
+                           const Eigen::Ref<const RealVec> &t) {
+  const RealVec rs = TensorProduct(r, s);
+  RealVec out(rs.size() * t.size());
+  for (PetscInt k = 0; k < t.size(); k++) { out.segment(k * rs.size(), rs.size()) = rs * t(k); }
+  return out;
+}
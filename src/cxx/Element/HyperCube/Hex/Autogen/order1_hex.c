@@ -1,61 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-#include <Element/HyperCube/Autogen/order1_hex.h>
-#include <math.h>
-
-void interpolate_order1_hex(double r, double s, double t, double *out_1550826091074812107) {
-
-   out_1550826091074812107[0] = -0.125*(r - 1.0)*(s - 1.0)*(t - 1.0);
-   out_1550826091074812107[1] = 0.125*(r + 1.0)*(s - 1.0)*(t - 1.0);
-   out_1550826091074812107[2] = 0.125*(r - 1.0)*(s + 1.0)*(t - 1.0);
-   out_1550826091074812107[3] = -0.125*(r + 1.0)*(s + 1.0)*(t - 1.0);
-   out_1550826091074812107[4] = 0.125*(r - 1.0)*(s - 1.0)*(t + 1.0);
-   out_1550826091074812107[5] = -0.125*(r + 1.0)*(s - 1.0)*(t + 1.0);
-   out_1550826091074812107[6] = -0.125*(r - 1.0)*(s + 1.0)*(t + 1.0);
-   out_1550826091074812107[7] = 0.125*(r + 1.0)*(s + 1.0)*(t + 1.0);
-
-}
-
-void interpolate_r_derivative_order1_hex(double s, double t, double *out_5498613790433297615) {
-
-   out_5498613790433297615[0] = -0.125*(s - 1.0)*(t - 1.0);
-   out_5498613790433297615[1] = 0.125*(s - 1.0)*(t - 1.0);
-   out_5498613790433297615[2] = 0.125*(s + 1.0)*(t - 1.0);
-   out_5498613790433297615[3] = -0.125*(s + 1.0)*(t - 1.0);
-   out_5498613790433297615[4] = 0.125*(s - 1.0)*(t + 1.0);
-   out_5498613790433297615[5] = -0.125*(s - 1.0)*(t + 1.0);
-   out_5498613790433297615[6] = -0.125*(s + 1.0)*(t + 1.0);
-   out_5498613790433297615[7] = 0.125*(s + 1.0)*(t + 1.0);
-
-}
-
-void interpolate_s_derivative_order1_hex(double r, double t, double *out_7425548709962864327) {
-
-   out_7425548709962864327[0] = -0.125*(r - 1.0)*(t - 1.0);
-   out_7425548709962864327[1] = 0.125*(r + 1.0)*(t - 1.0);
-   out_7425548709962864327[2] = 0.125*(r - 1.0)*(t - 1.0);
-   out_7425548709962864327[3] = -0.125*(r + 1.0)*(t - 1.0);
-   out_7425548709962864327[4] = 0.125*(r - 1.0)*(t + 1.0);
-   out_7425548709962864327[5] = -0.125*(r + 1.0)*(t + 1.0);
-   out_7425548709962864327[6] = -0.125*(r - 1.0)*(t + 1.0);
-   out_7425548709962864327[7] = 0.125*(r + 1.0)*(t + 1.0);
-
-}
-
-void interpolate_t_derivative_order1_hex(double r, double s, double *out_4165328884638393555) {
-
-   out_4165328884638393555[0] = -0.125*(r - 1.0)*(s - 1.0);
-   out_4165328884638393555[1] = 0.125*(r + 1.0)*(s - 1.0);
-   out_4165328884638393555[2] = 0.125*(r - 1.0)*(s + 1.0);
-   out_4165328884638393555[3] = -0.125*(r + 1.0)*(s + 1.0);
-   out_4165328884638393555[4] = 0.125*(r - 1.0)*(s - 1.0);
-   out_4165328884638393555[5] = -0.125*(r + 1.0)*(s - 1.0);
-   out_4165328884638393555[6] = -0.125*(r - 1.0)*(s + 1.0);
-   out_4165328884638393555[7] = 0.125*(r + 1.0)*(s + 1.0);
-
-}
@@ -1,137 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-#include <Element/HyperCube/Autogen/order2_hex.h>
-#include <math.h>
-
-void interpolate_order2_hex(double r, double s, double t, double *out_9002847687499221097) {
-
-   out_9002847687499221097[0] = 0.125*r*s*t*(r - 1.0)*(s - 1.0)*(t - 1.0);
-   out_9002847687499221097[1] = -0.25*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(t - 1.0);
-   out_9002847687499221097[2] = 0.125*r*s*t*(r + 1.0)*(s - 1.0)*(t - 1.0);
-   out_9002847687499221097[3] = -0.25*r*t*(r - 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0);
-   out_9002847687499221097[4] = 0.5*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0);
-   out_9002847687499221097[5] = -0.25*r*t*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0);
-   out_9002847687499221097[6] = 0.125*r*s*t*(r - 1.0)*(s + 1.0)*(t - 1.0);
-   out_9002847687499221097[7] = -0.25*s*t*(r - 1.0)*(r + 1.0)*(s + 1.0)*(t - 1.0);
-   out_9002847687499221097[8] = 0.125*r*s*t*(r + 1.0)*(s + 1.0)*(t - 1.0);
-   out_9002847687499221097[9] = -0.25*r*s*(r - 1.0)*(s - 1.0)*(t - 1.0)*(t + 1.0);
-   out_9002847687499221097[10] = 0.5*s*(r - 1.0)*(r + 1.0)*(s - 1.0)*(t - 1.0)*(t + 1.0);
-   out_9002847687499221097[11] = -0.25*r*s*(r + 1.0)*(s - 1.0)*(t - 1.0)*(t + 1.0);
-   out_9002847687499221097[12] = 0.5*r*(r - 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0);
-   out_9002847687499221097[13] = -1.0*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0);
-   out_9002847687499221097[14] = 0.5*r*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0);
-   out_9002847687499221097[15] = -0.25*r*s*(r - 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0);
-   out_9002847687499221097[16] = 0.5*s*(r - 1.0)*(r + 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0);
-   out_9002847687499221097[17] = -0.25*r*s*(r + 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0);
-   out_9002847687499221097[18] = 0.125*r*s*t*(r - 1.0)*(s - 1.0)*(t + 1.0);
-   out_9002847687499221097[19] = -0.25*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(t + 1.0);
-   out_9002847687499221097[20] = 0.125*r*s*t*(r + 1.0)*(s - 1.0)*(t + 1.0);
-   out_9002847687499221097[21] = -0.25*r*t*(r - 1.0)*(s - 1.0)*(s + 1.0)*(t + 1.0);
-   out_9002847687499221097[22] = 0.5*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t + 1.0);
-   out_9002847687499221097[23] = -0.25*r*t*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t + 1.0);
-   out_9002847687499221097[24] = 0.125*r*s*t*(r - 1.0)*(s + 1.0)*(t + 1.0);
-   out_9002847687499221097[25] = -0.25*s*t*(r - 1.0)*(r + 1.0)*(s + 1.0)*(t + 1.0);
-   out_9002847687499221097[26] = 0.125*r*s*t*(r + 1.0)*(s + 1.0)*(t + 1.0);
-
-}
-
-void interpolate_r_derivative_order2_hex(double r, double s, double t, double *out_8487963633987287817) {
-
-   out_8487963633987287817[0] = 0.125*r*s*t*(s - 1.0)*(t - 1.0) + 0.125*s*t*(r - 1.0)*(s - 1.0)*(t - 1.0);
-   out_8487963633987287817[1] = -0.25*s*t*(r - 1.0)*(s - 1.0)*(t - 1.0) - 0.25*s*t*(r + 1.0)*(s - 1.0)*(t - 1.0);
-   out_8487963633987287817[2] = 0.125*r*s*t*(s - 1.0)*(t - 1.0) + 0.125*s*t*(r + 1.0)*(s - 1.0)*(t - 1.0);
-   out_8487963633987287817[3] = -0.25*r*t*(s - 1.0)*(s + 1.0)*(t - 1.0) - 0.25*t*(r - 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0);
-   out_8487963633987287817[4] = 0.5*t*(r - 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0) + 0.5*t*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0);
-   out_8487963633987287817[5] = -0.25*r*t*(s - 1.0)*(s + 1.0)*(t - 1.0) - 0.25*t*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0);
-   out_8487963633987287817[6] = 0.125*r*s*t*(s + 1.0)*(t - 1.0) + 0.125*s*t*(r - 1.0)*(s + 1.0)*(t - 1.0);
-   out_8487963633987287817[7] = -0.25*s*t*(r - 1.0)*(s + 1.0)*(t - 1.0) - 0.25*s*t*(r + 1.0)*(s + 1.0)*(t - 1.0);
-   out_8487963633987287817[8] = 0.125*r*s*t*(s + 1.0)*(t - 1.0) + 0.125*s*t*(r + 1.0)*(s + 1.0)*(t - 1.0);
-   out_8487963633987287817[9] = -0.25*r*s*(s - 1.0)*(t - 1.0)*(t + 1.0) - 0.25*s*(r - 1.0)*(s - 1.0)*(t - 1.0)*(t + 1.0);
-   out_8487963633987287817[10] = 0.5*s*(r - 1.0)*(s - 1.0)*(t - 1.0)*(t + 1.0) + 0.5*s*(r + 1.0)*(s - 1.0)*(t - 1.0)*(t + 1.0);
-   out_8487963633987287817[11] = -0.25*r*s*(s - 1.0)*(t - 1.0)*(t + 1.0) - 0.25*s*(r + 1.0)*(s - 1.0)*(t - 1.0)*(t + 1.0);
-   out_8487963633987287817[12] = 0.5*r*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 0.5*(r - 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0);
-   out_8487963633987287817[13] = -1.0*(r - 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 1.0*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0);
-   out_8487963633987287817[14] = 0.5*r*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 0.5*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0);
-   out_8487963633987287817[15] = -0.25*r*s*(s + 1.0)*(t - 1.0)*(t + 1.0) - 0.25*s*(r - 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0);
-   out_8487963633987287817[16] = 0.5*s*(r - 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 0.5*s*(r + 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0);
-   out_8487963633987287817[17] = -0.25*r*s*(s + 1.0)*(t - 1.0)*(t + 1.0) - 0.25*s*(r + 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0);
-   out_8487963633987287817[18] = 0.125*r*s*t*(s - 1.0)*(t + 1.0) + 0.125*s*t*(r - 1.0)*(s - 1.0)*(t + 1.0);
-   out_8487963633987287817[19] = -0.25*s*t*(r - 1.0)*(s - 1.0)*(t + 1.0) - 0.25*s*t*(r + 1.0)*(s - 1.0)*(t + 1.0);
-   out_8487963633987287817[20] = 0.125*r*s*t*(s - 1.0)*(t + 1.0) + 0.125*s*t*(r + 1.0)*(s - 1.0)*(t + 1.0);
-   out_8487963633987287817[21] = -0.25*r*t*(s - 1.0)*(s + 1.0)*(t + 1.0) - 0.25*t*(r - 1.0)*(s - 1.0)*(s + 1.0)*(t + 1.0);
-   out_8487963633987287817[22] = 0.5*t*(r - 1.0)*(s - 1.0)*(s + 1.0)*(t + 1.0) + 0.5*t*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t + 1.0);
-   out_8487963633987287817[23] = -0.25*r*t*(s - 1.0)*(s + 1.0)*(t + 1.0) - 0.25*t*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t + 1.0);
-   out_8487963633987287817[24] = 0.125*r*s*t*(s + 1.0)*(t + 1.0) + 0.125*s*t*(r - 1.0)*(s + 1.0)*(t + 1.0);
-   out_8487963633987287817[25] = -0.25*s*t*(r - 1.0)*(s + 1.0)*(t + 1.0) - 0.25*s*t*(r + 1.0)*(s + 1.0)*(t + 1.0);
-   out_8487963633987287817[26] = 0.125*r*s*t*(s + 1.0)*(t + 1.0) + 0.125*s*t*(r + 1.0)*(s + 1.0)*(t + 1.0);
-
-}
-
-void interpolate_s_derivative_order2_hex(double r, double s, double t, double *out_157595897019188835) {
-
-   out_157595897019188835[0] = 0.125*r*s*t*(r - 1.0)*(t - 1.0) + 0.125*r*t*(r - 1.0)*(s - 1.0)*(t - 1.0);
-   out_157595897019188835[1] = -0.25*s*t*(r - 1.0)*(r + 1.0)*(t - 1.0) - 0.25*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(t - 1.0);
-   out_157595897019188835[2] = 0.125*r*s*t*(r + 1.0)*(t - 1.0) + 0.125*r*t*(r + 1.0)*(s - 1.0)*(t - 1.0);
-   out_157595897019188835[3] = -0.25*r*t*(r - 1.0)*(s - 1.0)*(t - 1.0) - 0.25*r*t*(r - 1.0)*(s + 1.0)*(t - 1.0);
-   out_157595897019188835[4] = 0.5*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(t - 1.0) + 0.5*t*(r - 1.0)*(r + 1.0)*(s + 1.0)*(t - 1.0);
-   out_157595897019188835[5] = -0.25*r*t*(r + 1.0)*(s - 1.0)*(t - 1.0) - 0.25*r*t*(r + 1.0)*(s + 1.0)*(t - 1.0);
-   out_157595897019188835[6] = 0.125*r*s*t*(r - 1.0)*(t - 1.0) + 0.125*r*t*(r - 1.0)*(s + 1.0)*(t - 1.0);
-   out_157595897019188835[7] = -0.25*s*t*(r - 1.0)*(r + 1.0)*(t - 1.0) - 0.25*t*(r - 1.0)*(r + 1.0)*(s + 1.0)*(t - 1.0);
-   out_157595897019188835[8] = 0.125*r*s*t*(r + 1.0)*(t - 1.0) + 0.125*r*t*(r + 1.0)*(s + 1.0)*(t - 1.0);
-   out_157595897019188835[9] = -0.25*r*s*(r - 1.0)*(t - 1.0)*(t + 1.0) - 0.25*r*(r - 1.0)*(s - 1.0)*(t - 1.0)*(t + 1.0);
-   out_157595897019188835[10] = 0.5*s*(r - 1.0)*(r + 1.0)*(t - 1.0)*(t + 1.0) + 0.5*(r - 1.0)*(r + 1.0)*(s - 1.0)*(t - 1.0)*(t + 1.0);
-   out_157595897019188835[11] = -0.25*r*s*(r + 1.0)*(t - 1.0)*(t + 1.0) - 0.25*r*(r + 1.0)*(s - 1.0)*(t - 1.0)*(t + 1.0);
-   out_157595897019188835[12] = 0.5*r*(r - 1.0)*(s - 1.0)*(t - 1.0)*(t + 1.0) + 0.5*r*(r - 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0);
-   out_157595897019188835[13] = -1.0*(r - 1.0)*(r + 1.0)*(s - 1.0)*(t - 1.0)*(t + 1.0) - 1.0*(r - 1.0)*(r + 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0);
-   out_157595897019188835[14] = 0.5*r*(r + 1.0)*(s - 1.0)*(t - 1.0)*(t + 1.0) + 0.5*r*(r + 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0);
-   out_157595897019188835[15] = -0.25*r*s*(r - 1.0)*(t - 1.0)*(t + 1.0) - 0.25*r*(r - 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0);
-   out_157595897019188835[16] = 0.5*s*(r - 1.0)*(r + 1.0)*(t - 1.0)*(t + 1.0) + 0.5*(r - 1.0)*(r + 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0);
-   out_157595897019188835[17] = -0.25*r*s*(r + 1.0)*(t - 1.0)*(t + 1.0) - 0.25*r*(r + 1.0)*(s + 1.0)*(t - 1.0)*(t + 1.0);
-   out_157595897019188835[18] = 0.125*r*s*t*(r - 1.0)*(t + 1.0) + 0.125*r*t*(r - 1.0)*(s - 1.0)*(t + 1.0);
-   out_157595897019188835[19] = -0.25*s*t*(r - 1.0)*(r + 1.0)*(t + 1.0) - 0.25*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(t + 1.0);
-   out_157595897019188835[20] = 0.125*r*s*t*(r + 1.0)*(t + 1.0) + 0.125*r*t*(r + 1.0)*(s - 1.0)*(t + 1.0);
-   out_157595897019188835[21] = -0.25*r*t*(r - 1.0)*(s - 1.0)*(t + 1.0) - 0.25*r*t*(r - 1.0)*(s + 1.0)*(t + 1.0);
-   out_157595897019188835[22] = 0.5*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(t + 1.0) + 0.5*t*(r - 1.0)*(r + 1.0)*(s + 1.0)*(t + 1.0);
-   out_157595897019188835[23] = -0.25*r*t*(r + 1.0)*(s - 1.0)*(t + 1.0) - 0.25*r*t*(r + 1.0)*(s + 1.0)*(t + 1.0);
-   out_157595897019188835[24] = 0.125*r*s*t*(r - 1.0)*(t + 1.0) + 0.125*r*t*(r - 1.0)*(s + 1.0)*(t + 1.0);
-   out_157595897019188835[25] = -0.25*s*t*(r - 1.0)*(r + 1.0)*(t + 1.0) - 0.25*t*(r - 1.0)*(r + 1.0)*(s + 1.0)*(t + 1.0);
-   out_157595897019188835[26] = 0.125*r*s*t*(r + 1.0)*(t + 1.0) + 0.125*r*t*(r + 1.0)*(s + 1.0)*(t + 1.0);
-
-}
-
-void interpolate_t_derivative_order2_hex(double r, double s, double t, double *out_4912761615785967653) {
-
-   out_4912761615785967653[0] = 0.125*r*s*t*(r - 1.0)*(s - 1.0) + 0.125*r*s*(r - 1.0)*(s - 1.0)*(t - 1.0);
-   out_4912761615785967653[1] = -0.25*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0) - 0.25*s*(r - 1.0)*(r + 1.0)*(s - 1.0)*(t - 1.0);
-   out_4912761615785967653[2] = 0.125*r*s*t*(r + 1.0)*(s - 1.0) + 0.125*r*s*(r + 1.0)*(s - 1.0)*(t - 1.0);
-   out_4912761615785967653[3] = -0.25*r*t*(r - 1.0)*(s - 1.0)*(s + 1.0) - 0.25*r*(r - 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0);
-   out_4912761615785967653[4] = 0.5*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 1.0) + 0.5*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0);
-   out_4912761615785967653[5] = -0.25*r*t*(r + 1.0)*(s - 1.0)*(s + 1.0) - 0.25*r*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0);
-   out_4912761615785967653[6] = 0.125*r*s*t*(r - 1.0)*(s + 1.0) + 0.125*r*s*(r - 1.0)*(s + 1.0)*(t - 1.0);
-   out_4912761615785967653[7] = -0.25*s*t*(r - 1.0)*(r + 1.0)*(s + 1.0) - 0.25*s*(r - 1.0)*(r + 1.0)*(s + 1.0)*(t - 1.0);
-   out_4912761615785967653[8] = 0.125*r*s*t*(r + 1.0)*(s + 1.0) + 0.125*r*s*(r + 1.0)*(s + 1.0)*(t - 1.0);
-   out_4912761615785967653[9] = -0.25*r*s*(r - 1.0)*(s - 1.0)*(t - 1.0) - 0.25*r*s*(r - 1.0)*(s - 1.0)*(t + 1.0);
-   out_4912761615785967653[10] = 0.5*s*(r - 1.0)*(r + 1.0)*(s - 1.0)*(t - 1.0) + 0.5*s*(r - 1.0)*(r + 1.0)*(s - 1.0)*(t + 1.0);
-   out_4912761615785967653[11] = -0.25*r*s*(r + 1.0)*(s - 1.0)*(t - 1.0) - 0.25*r*s*(r + 1.0)*(s - 1.0)*(t + 1.0);
-   out_4912761615785967653[12] = 0.5*r*(r - 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0) + 0.5*r*(r - 1.0)*(s - 1.0)*(s + 1.0)*(t + 1.0);
-   out_4912761615785967653[13] = -1.0*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0) - 1.0*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t + 1.0);
-   out_4912761615785967653[14] = 0.5*r*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0) + 0.5*r*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t + 1.0);
-   out_4912761615785967653[15] = -0.25*r*s*(r - 1.0)*(s + 1.0)*(t - 1.0) - 0.25*r*s*(r - 1.0)*(s + 1.0)*(t + 1.0);
-   out_4912761615785967653[16] = 0.5*s*(r - 1.0)*(r + 1.0)*(s + 1.0)*(t - 1.0) + 0.5*s*(r - 1.0)*(r + 1.0)*(s + 1.0)*(t + 1.0);
-   out_4912761615785967653[17] = -0.25*r*s*(r + 1.0)*(s + 1.0)*(t - 1.0) - 0.25*r*s*(r + 1.0)*(s + 1.0)*(t + 1.0);
-   out_4912761615785967653[18] = 0.125*r*s*t*(r - 1.0)*(s - 1.0) + 0.125*r*s*(r - 1.0)*(s - 1.0)*(t + 1.0);
-   out_4912761615785967653[19] = -0.25*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0) - 0.25*s*(r - 1.0)*(r + 1.0)*(s - 1.0)*(t + 1.0);
-   out_4912761615785967653[20] = 0.125*r*s*t*(r + 1.0)*(s - 1.0) + 0.125*r*s*(r + 1.0)*(s - 1.0)*(t + 1.0);
-   out_4912761615785967653[21] = -0.25*r*t*(r - 1.0)*(s - 1.0)*(s + 1.0) - 0.25*r*(r - 1.0)*(s - 1.0)*(s + 1.0)*(t + 1.0);
-   out_4912761615785967653[22] = 0.5*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 1.0) + 0.5*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t + 1.0);
-   out_4912761615785967653[23] = -0.25*r*t*(r + 1.0)*(s - 1.0)*(s + 1.0) - 0.25*r*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t + 1.0);
-   out_4912761615785967653[24] = 0.125*r*s*t*(r - 1.0)*(s + 1.0) + 0.125*r*s*(r - 1.0)*(s + 1.0)*(t + 1.0);
-   out_4912761615785967653[25] = -0.25*s*t*(r - 1.0)*(r + 1.0)*(s + 1.0) - 0.25*s*(r - 1.0)*(r + 1.0)*(s + 1.0)*(t + 1.0);
-   out_4912761615785967653[26] = 0.125*r*s*t*(r + 1.0)*(s + 1.0) + 0.125*r*s*(r + 1.0)*(s + 1.0)*(t + 1.0);
-
-}
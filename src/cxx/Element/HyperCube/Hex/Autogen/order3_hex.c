@@ -1,285 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-#include <Element/HyperCube/Autogen/order3_hex.h>
-#include <math.h>
-
-void interpolate_order3_hex(double r, double s, double t, double *out_8216235190021024939) {
-
-   out_8216235190021024939[0] = -0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_8216235190021024939[1] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_8216235190021024939[2] = -0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_8216235190021024939[3] = 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_8216235190021024939[4] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_8216235190021024939[5] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_8216235190021024939[6] = 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_8216235190021024939[7] = -0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_8216235190021024939[8] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_8216235190021024939[9] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_8216235190021024939[10] = -1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_8216235190021024939[11] = 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_8216235190021024939[12] = 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_8216235190021024939[13] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_8216235190021024939[14] = 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_8216235190021024939[15] = -0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_8216235190021024939[16] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[17] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[18] = 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[19] = -0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[20] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[21] = 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[22] = -2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[23] = 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[24] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[25] = -2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[26] = 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[27] = -1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[28] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[29] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[30] = -1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[31] = 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[32] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[33] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[34] = -1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[35] = 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[36] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[37] = -2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[38] = 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[39] = -1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[40] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[41] = 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[42] = -2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[43] = 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[44] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[45] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[46] = 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[47] = -0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[48] = 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[49] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[50] = 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[51] = -0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[52] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[53] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[54] = -1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[55] = 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[56] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[57] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[58] = 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[59] = -0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[60] = -0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[61] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[62] = -0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_8216235190021024939[63] = 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-
-}
-
-void interpolate_r_derivative_order3_hex(double r, double s, double t, double *out_5216069425318171019) {
-
-   out_5216069425318171019[0] = -0.244140625*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.244140625*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_5216069425318171019[1] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_5216069425318171019[2] = -0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_5216069425318171019[3] = 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.244140625*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.244140625*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_5216069425318171019[4] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_5216069425318171019[5] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 1.220703125*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 1.220703125*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_5216069425318171019[6] = 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 1.220703125*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 1.220703125*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_5216069425318171019[7] = -0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_5216069425318171019[8] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_5216069425318171019[9] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 1.220703125*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 1.220703125*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_5216069425318171019[10] = -1.220703125*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 1.220703125*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 1.220703125*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_5216069425318171019[11] = 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_5216069425318171019[12] = 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.244140625*(r - 1.0)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_5216069425318171019[13] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_5216069425318171019[14] = 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_5216069425318171019[15] = -0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.244140625*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.244140625*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_5216069425318171019[16] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[17] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[18] = 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 1.220703125*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[19] = -0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[20] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[21] = 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 2.72957516784642*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 2.72957516784642*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[22] = -2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 2.72957516784642*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 2.72957516784642*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[23] = 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 1.220703125*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[24] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[25] = -2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 2.72957516784642*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 2.72957516784642*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[26] = 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 2.72957516784642*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 2.72957516784642*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[27] = -1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 1.220703125*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[28] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[29] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[30] = -1.220703125*(r - 1.0)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 1.220703125*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[31] = 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[32] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[33] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[34] = -1.220703125*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[35] = 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[36] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[37] = -2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 2.72957516784642*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 2.72957516784642*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[38] = 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 2.72957516784642*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 2.72957516784642*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[39] = -1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[40] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[41] = 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 2.72957516784642*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 2.72957516784642*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[42] = -2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 2.72957516784642*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 2.72957516784642*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[43] = 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[44] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[45] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[46] = 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[47] = -0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[48] = 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.244140625*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[49] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[50] = 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[51] = -0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.244140625*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.244140625*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[52] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[53] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[54] = -1.220703125*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[55] = 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[56] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[57] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[58] = 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[59] = -0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[60] = -0.244140625*(r - 1.0)*(r - 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.244140625*(r - 1.0)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[61] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[62] = -0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_5216069425318171019[63] = 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.244140625*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.244140625*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-
-}
-
-void interpolate_s_derivative_order3_hex(double r, double s, double t, double *out_1643667870387349053) {
-
-   out_1643667870387349053[0] = -0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1643667870387349053[1] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1643667870387349053[2] = -0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1643667870387349053[3] = 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1643667870387349053[4] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1643667870387349053[5] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1643667870387349053[6] = 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1643667870387349053[7] = -0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1643667870387349053[8] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1643667870387349053[9] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1643667870387349053[10] = -1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1643667870387349053[11] = 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1643667870387349053[12] = 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1643667870387349053[13] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1643667870387349053[14] = 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1643667870387349053[15] = -0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1643667870387349053[16] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[17] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[18] = 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[19] = -0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[20] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[21] = 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[22] = -2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[23] = 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[24] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[25] = -2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[26] = 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[27] = -1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[28] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[29] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[30] = -1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[31] = 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[32] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[33] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[34] = -1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[35] = 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[36] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[37] = -2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[38] = 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[39] = -1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[40] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[41] = 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[42] = -2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[43] = 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[44] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[45] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[46] = 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[47] = -0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[48] = 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[49] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[50] = 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[51] = -0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[52] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[53] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[54] = -1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[55] = 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[56] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[57] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[58] = 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[59] = -0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[60] = -0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[61] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[62] = -0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1643667870387349053[63] = 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0) + 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-
-}
-
-void interpolate_t_derivative_order3_hex(double r, double s, double t, double *out_1614254179988961949) {
-
-   out_1614254179988961949[0] = -0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958) - 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958) - 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1614254179988961949[1] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1614254179988961949[2] = -0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1614254179988961949[3] = 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958) + 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958) + 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1614254179988961949[4] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1614254179988961949[5] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1614254179988961949[6] = 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) + 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) + 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1614254179988961949[7] = -0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1614254179988961949[8] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1614254179988961949[9] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1614254179988961949[10] = -1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) - 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) - 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1614254179988961949[11] = 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1614254179988961949[12] = 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) + 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) + 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1614254179988961949[13] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1614254179988961949[14] = 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1614254179988961949[15] = -0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) - 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) - 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958);
-   out_1614254179988961949[16] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[17] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 1.0) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[18] = 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958) + 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 1.0) + 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[19] = -0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t - 0.447213595499958) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 1.0) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[20] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[21] = 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) + 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[22] = -2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) - 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[23] = 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) + 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[24] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[25] = -2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) - 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[26] = 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) + 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[27] = -1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) - 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[28] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[29] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[30] = -1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) - 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[31] = 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t - 0.447213595499958) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[32] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[33] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 1.0) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[34] = -1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958) - 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 1.0) - 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[35] = 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 0.447213595499958) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 1.0)*(t + 1.0) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[36] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[37] = -2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) - 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[38] = 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) + 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[39] = -1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) - 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[40] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[41] = 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) + 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 2.72957516784642*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[42] = -2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) - 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 2.72957516784642*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[43] = 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) + 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 1.220703125*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[44] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[45] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[46] = 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) + 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[47] = -0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 0.447213595499958) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[48] = 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 1.0) + 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[49] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[50] = 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[51] = -0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t - 0.447213595499958)*(t + 1.0) - 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[52] = -0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[53] = 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[54] = -1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[55] = 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s - 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[56] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[57] = -1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0) - 1.220703125*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[58] = 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0) + 1.220703125*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[59] = -0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 1.0)*(s + 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[60] = -0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0) - 0.244140625*(r - 1.0)*(r - 0.447213595499958)*(r + 0.447213595499958)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[61] = 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0) + 0.545915033569285*(r - 1.0)*(r - 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[62] = -0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) - 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0) - 0.545915033569285*(r - 1.0)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-   out_1614254179988961949[63] = 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 0.447213595499958) + 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t - 0.447213595499958)*(t + 1.0) + 0.244140625*(r - 0.447213595499958)*(r + 0.447213595499958)*(r + 1.0)*(s - 0.447213595499958)*(s + 0.447213595499958)*(s + 1.0)*(t + 0.447213595499958)*(t + 1.0);
-
-}
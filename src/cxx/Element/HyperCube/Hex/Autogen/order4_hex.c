@@ -1,529 +0,0 @@
-/******************************************************************************
- *                       Code generated with sympy 1.0                        *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'SALVUS'                        *
- ******************************************************************************/
-#include <Element/HyperCube/Autogen/order4_hex.h>
-#include <math.h>
-
-void interpolate_order4_hex(double r, double s, double t, double *out_2810135618052889493) {
-
-   out_2810135618052889493[0] = 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[1] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[2] = 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[3] = -1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[4] = 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[5] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[6] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[7] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[8] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[9] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[10] = 1.78645833333333*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[11] = -4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[12] = 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[13] = -4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[14] = 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[15] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[16] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[17] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[18] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[19] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[20] = 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[21] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[22] = 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[23] = -1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[24] = 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_2810135618052889493[25] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[26] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[27] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[28] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[29] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[30] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[31] = -8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[32] = 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[33] = -8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[34] = 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[35] = -4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[36] = 9.72627314814815*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[37] = -11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[38] = 9.72627314814815*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[39] = -4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[40] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[41] = -8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[42] = 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[43] = -8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[44] = 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[45] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[46] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[47] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[48] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[49] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[50] = 1.78645833333333*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[51] = -4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[52] = 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[53] = -4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[54] = 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[55] = -4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[56] = 9.72627314814815*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[57] = -11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[58] = 9.72627314814815*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[59] = -4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[60] = 4.76388888888889*r*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[61] = -11.1157407407407*r*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[62] = 12.7037037037037*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[63] = -11.1157407407407*r*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[64] = 4.76388888888889*r*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[65] = -4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[66] = 9.72627314814815*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[67] = -11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[68] = 9.72627314814815*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[69] = -4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[70] = 1.78645833333333*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[71] = -4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[72] = 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[73] = -4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[74] = 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[75] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[76] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[77] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[78] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[79] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[80] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[81] = -8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[82] = 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[83] = -8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[84] = 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[85] = -4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[86] = 9.72627314814815*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[87] = -11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[88] = 9.72627314814815*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[89] = -4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[90] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[91] = -8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[92] = 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[93] = -8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[94] = 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[95] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[96] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[97] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[98] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[99] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[100] = 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[101] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[102] = 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[103] = -1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[104] = 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[105] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[106] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[107] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[108] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[109] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[110] = 1.78645833333333*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[111] = -4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[112] = 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[113] = -4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[114] = 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[115] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[116] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[117] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[118] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[119] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[120] = 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[121] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[122] = 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[123] = -1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_2810135618052889493[124] = 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-
-}
-
-void interpolate_r_derivative_order4_hex(double r, double s, double t, double *out_4104854468703356725) {
-
-   out_4104854468703356725[0] = 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[1] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[2] = 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[3] = -1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[4] = 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[5] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[6] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[7] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[8] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[9] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[10] = 1.78645833333333*r*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*r*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[11] = -4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[12] = 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 4.76388888888889*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 4.76388888888889*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[13] = -4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[14] = 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*r*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[15] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[16] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[17] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[18] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[19] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[20] = 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[21] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[22] = 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[23] = -1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[24] = 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_4104854468703356725[25] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[26] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[27] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[28] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[29] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[30] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[31] = -8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[32] = 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[33] = -8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[34] = 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[35] = -4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[36] = 9.72627314814815*r*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[37] = -11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 11.1157407407407*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 11.1157407407407*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[38] = 9.72627314814815*r*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[39] = -4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[40] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[41] = -8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[42] = 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[43] = -8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[44] = 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[45] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[46] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[47] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[48] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[49] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[50] = 1.78645833333333*r*s*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[51] = -4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[52] = 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[53] = -4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[54] = 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[55] = -4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[56] = 9.72627314814815*r*s*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[57] = -11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[58] = 9.72627314814815*r*s*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[59] = -4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[60] = 4.76388888888889*r*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*r*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*r*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[61] = -11.1157407407407*r*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*r*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*r*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[62] = 12.7037037037037*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 12.7037037037037*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 12.7037037037037*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 12.7037037037037*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[63] = -11.1157407407407*r*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*r*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*r*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[64] = 4.76388888888889*r*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*r*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*r*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[65] = -4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[66] = 9.72627314814815*r*s*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[67] = -11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[68] = 9.72627314814815*r*s*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[69] = -4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[70] = 1.78645833333333*r*s*(r - 1.0)*(r - 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 1.0)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[71] = -4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[72] = 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[73] = -4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[74] = 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[75] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[76] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[77] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[78] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[79] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[80] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[81] = -8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[82] = 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[83] = -8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[84] = 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[85] = -4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[86] = 9.72627314814815*r*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[87] = -11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[88] = 9.72627314814815*r*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[89] = -4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[90] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[91] = -8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[92] = 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[93] = -8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[94] = 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[95] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[96] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[97] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[98] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[99] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[100] = 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[101] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[102] = 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[103] = -1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[104] = 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[105] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[106] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[107] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[108] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[109] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[110] = 1.78645833333333*r*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[111] = -4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[112] = 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[113] = -4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[114] = 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[115] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[116] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[117] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[118] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[119] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[120] = 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[121] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[122] = 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[123] = -1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_4104854468703356725[124] = 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-
-}
-
-void interpolate_s_derivative_order4_hex(double r, double s, double t, double *out_3277023006449021479) {
-
-   out_3277023006449021479[0] = 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[1] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[2] = 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[3] = -1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[4] = 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[5] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[6] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[7] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[8] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[9] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[10] = 1.78645833333333*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[11] = -4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[12] = 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[13] = -4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[14] = 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[15] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[16] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[17] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[18] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[19] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[20] = 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[21] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[22] = 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[23] = -1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[24] = 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_3277023006449021479[25] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[26] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[27] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[28] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[29] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[30] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[31] = -8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[32] = 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[33] = -8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[34] = 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[35] = -4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[36] = 9.72627314814815*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[37] = -11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[38] = 9.72627314814815*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[39] = -4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[40] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[41] = -8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[42] = 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[43] = -8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[44] = 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[45] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[46] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[47] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[48] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[49] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[50] = 1.78645833333333*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[51] = -4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[52] = 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[53] = -4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[54] = 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[55] = -4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[56] = 9.72627314814815*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[57] = -11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[58] = 9.72627314814815*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[59] = -4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[60] = 4.76388888888889*r*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*r*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*r*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*r*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[61] = -11.1157407407407*r*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*r*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*r*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*r*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[62] = 12.7037037037037*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 12.7037037037037*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 12.7037037037037*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 12.7037037037037*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[63] = -11.1157407407407*r*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*r*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*r*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*r*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[64] = 4.76388888888889*r*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*r*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*r*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*r*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[65] = -4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[66] = 9.72627314814815*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[67] = -11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[68] = 9.72627314814815*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[69] = -4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[70] = 1.78645833333333*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[71] = -4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[72] = 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[73] = -4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[74] = 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[75] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[76] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[77] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[78] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[79] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[80] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[81] = -8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[82] = 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[83] = -8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[84] = 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[85] = -4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[86] = 9.72627314814815*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[87] = -11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[88] = 9.72627314814815*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[89] = -4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[90] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[91] = -8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[92] = 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[93] = -8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[94] = 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[95] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[96] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[97] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[98] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[99] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[100] = 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[101] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[102] = 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[103] = -1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[104] = 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[105] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[106] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[107] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[108] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[109] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[110] = 1.78645833333333*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[111] = -4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[112] = 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[113] = -4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[114] = 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[115] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[116] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[117] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[118] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[119] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[120] = 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[121] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[122] = 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[123] = -1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_3277023006449021479[124] = 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-
-}
-
-void interpolate_t_derivative_order4_hex(double r, double s, double t, double *out_6249295730873589447) {
-
-   out_6249295730873589447[0] = 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977) + 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[1] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[2] = 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[3] = -1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[4] = 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[5] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[6] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[7] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[8] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[9] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[10] = 1.78645833333333*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 1.78645833333333*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 1.78645833333333*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*r*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[11] = -4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[12] = 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 4.76388888888889*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[13] = -4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[14] = 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*r*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[15] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[16] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[17] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[18] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[19] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[20] = 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[21] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[22] = 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[23] = -1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[24] = 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977);
-   out_6249295730873589447[25] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[26] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[27] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[28] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[29] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[30] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[31] = -8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[32] = 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[33] = -8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[34] = 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[35] = -4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[36] = 9.72627314814815*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 9.72627314814815*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[37] = -11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 11.1157407407407*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[38] = 9.72627314814815*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 9.72627314814815*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[39] = -4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[40] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[41] = -8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[42] = 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[43] = -8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[44] = 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[45] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[46] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[47] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[48] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[49] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[50] = 1.78645833333333*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[51] = -4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[52] = 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[53] = -4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[54] = 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[55] = -4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[56] = 9.72627314814815*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 9.72627314814815*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[57] = -11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[58] = 9.72627314814815*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 9.72627314814815*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[59] = -4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[60] = 4.76388888888889*r*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 4.76388888888889*r*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 4.76388888888889*r*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*r*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[61] = -11.1157407407407*r*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 11.1157407407407*r*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 11.1157407407407*r*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*r*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[62] = 12.7037037037037*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 12.7037037037037*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 12.7037037037037*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 12.7037037037037*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[63] = -11.1157407407407*r*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 11.1157407407407*r*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 11.1157407407407*r*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*r*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[64] = 4.76388888888889*r*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 4.76388888888889*r*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 4.76388888888889*r*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*r*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[65] = -4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[66] = 9.72627314814815*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 9.72627314814815*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[67] = -11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[68] = 9.72627314814815*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 9.72627314814815*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[69] = -4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[70] = 1.78645833333333*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[71] = -4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[72] = 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[73] = -4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[74] = 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t - 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[75] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[76] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[77] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[78] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[79] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[80] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[81] = -8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[82] = 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[83] = -8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[84] = 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[85] = -4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[86] = 9.72627314814815*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 9.72627314814815*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[87] = -11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 11.1157407407407*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 11.1157407407407*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[88] = 9.72627314814815*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 9.72627314814815*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 9.72627314814815*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*r*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[89] = -4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 4.16840277777778*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[90] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[91] = -8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[92] = 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 9.72627314814815*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 9.72627314814815*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[93] = -8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 8.51048900462963*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 8.51048900462963*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[94] = 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[95] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[96] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[97] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[98] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[99] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 1.0)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[100] = 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[101] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[102] = 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 1.0) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[103] = -1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[104] = 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[105] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[106] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[107] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[108] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[109] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[110] = 1.78645833333333*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[111] = -4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[112] = 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 4.76388888888889*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 4.76388888888889*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[113] = -4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*r*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[114] = 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*r*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[115] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[116] = 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[117] = -4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 4.16840277777778*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[118] = 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 3.64735243055556*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[119] = -1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 1.0)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[120] = 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[121] = -1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*(r - 1.0)*(r - 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[122] = 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 1.78645833333333*s*t*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 1.78645833333333*s*(r - 1.0)*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[123] = -1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*t*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) - 1.56315104166667*r*s*(r - 1.0)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-   out_6249295730873589447[124] = 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*t*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t + 0.654653670707977)*(t + 1.0) + 0.669921875*r*s*(r - 0.654653670707977)*(r + 0.654653670707977)*(r + 1.0)*(s - 0.654653670707977)*(s + 0.654653670707977)*(s + 1.0)*(t - 0.654653670707977)*(t + 0.654653670707977)*(t + 1.0);
-
-}
@@ -17,59 +17,24 @@ bool HexP1::checkHull(const PetscReal x, const PetscReal y, const PetscReal z,
     throw std::runtime_error("Poorly behaved Hexahedra detected!!");
   }
 
-  // assumes right-hand rule vertex layout (same as PETSc)
-  PetscReal v0x = vtx(0,0); PetscReal v0y = vtx(0,1); PetscReal v0z = vtx(0,2);
-  PetscReal v1x = vtx(1,0); PetscReal v1y = vtx(1,1); PetscReal v1z = vtx(1,2);
-  PetscReal v2x = vtx(2,0); PetscReal v2y = vtx(2,1); PetscReal v2z = vtx(2,2);
-  PetscReal v3x = vtx(3,0); PetscReal v3y = vtx(3,1); PetscReal v3z = vtx(3,2);
-  PetscReal v4x = vtx(4,0); PetscReal v4y = vtx(4,1); PetscReal v4z = vtx(4,2);
-  PetscReal v5x = vtx(5,0); PetscReal v5y = vtx(5,1); PetscReal v5z = vtx(5,2);
-  PetscReal v6x = vtx(6,0); PetscReal v6y = vtx(6,1); PetscReal v6z = vtx(6,2);
-  PetscReal v7x = vtx(7,0); PetscReal v7y = vtx(7,1); PetscReal v7z = vtx(7,2);
-
-  // sides: bottom, top, front, back, left, right (all right-hand rule with normal outwards)
-  std::vector<std::string> side_names = {
-    "bottom", "top   ", "front ",
-    "back  ", "left  ", "right "
+  // sides: bottom, top, front, back, left, right (all right-hand rule with normal outwards), by the
+  // vertices a, b, d of each (assumes right-hand rule vertex layout, same as PETSc)
+  static const PetscInt sides[6][3] = {
+    {0, 1, 3}, // bottom
+    {4, 5, 7}, // top
+    {0, 3, 4}, // front
+    {2, 1, 6}, // back
+    {0, 4, 1}, // left
+    {2, 6, 3}  // right
   };
 
-  std::vector<std::vector<PetscReal>> sides_x = {
-    {v0x,v1x,v2x,v3x}, // bottom
-    {v4x,v5x,v6x,v7x}, // top
-    {v0x,v3x,v5x,v4x}, // front
-    {v2x,v1x,v7x,v6x}, // back
-    {v0x,v4x,v7x,v1x}, // left
-    {v2x,v6x,v5x,v3x}  // right 
-  };
-
-  std::vector<std::vector<PetscReal>> sides_y = {
-    {v0y,v1y,v2y,v3y}, // bottom
-    {v4y,v5y,v6y,v7y}, // top
-    {v0y,v3y,v5y,v4y}, // front
-    {v2y,v1y,v7y,v6y}, // back
-    {v0y,v4y,v7y,v1y}, // left
-    {v2y,v6y,v5y,v3y}  // right
-  };
+  RealVec3 test_point; test_point << x, y, z;
 
-  std::vector<std::vector<PetscReal>> sides_z = {
-    {v0z,v1z,v2z,v3z}, // bottom
-    {v4z,v5z,v6z,v7z}, // top
-    {v0z,v3z,v5z,v4z}, // front
-    {v2z,v1z,v7z,v6z}, // back
-    {v0z,v4z,v7z,v1z}, // left
-    {v2z,v6z,v5z,v3z}  // right
-  };
+  for (PetscInt sideid = 0; sideid < 6; sideid++) {
 
-  RealVec3 test_point; test_point << x, y, z;
-  
-  for (PetscInt sideid=0; sideid<sides_z.size(); sideid++) {
-  
-    RealVec3 pt_a,pt_b,pt_d;
-    pt_a << sides_x[sideid][0], sides_y[sideid][0], sides_z[sideid][0];
-    pt_b << sides_x[sideid][1], sides_y[sideid][1], sides_z[sideid][1];
-    pt_d << sides_x[sideid][3], sides_y[sideid][3], sides_z[sideid][3];
-    RealVec3 line_1 = pt_b - pt_a;
-    RealVec3 line_2 = pt_d - pt_a;
+    const RealVec3 pt_a = vtx.row(sides[sideid][0]).transpose();
+    const RealVec3 line_1 = vtx.row(sides[sideid][1]).transpose() - pt_a;
+    const RealVec3 line_2 = vtx.row(sides[sideid][2]).transpose() - pt_a;
     RealVec3 normal_side = line_1.cross(line_2);
     PetscReal normal_side_dot_test_point = normal_side.dot(test_point-pt_a);
     // if test point is colinear with the side's outward normal, it
@@ -132,50 +97,64 @@ PetscReal referenceToElementMapping(
 
 }
 
+Matrix<PetscReal,8,3> HexP1::trilinearCoefficients(const Ref<const HexVtx> &vtx) {
+  /* Vertex i sits at the corner (r_i, s_i, t_i) of the reference hex, and its shape function is
+   * (1 + r_i r)(1 + s_i s)(1 + t_i t) / 8, so the coefficient of each monomial is the sum over the vertices of the
+   * monomial at their corner, times the vertex, over 8. */
+  static const PetscReal corner[8][3] = {
+    {-1, -1, -1}, {-1, +1, -1}, {+1, +1, -1}, {+1, -1, -1},
+    {-1, -1, +1}, {+1, -1, +1}, {+1, +1, +1}, {-1, +1, +1}
+  };
+  Matrix<PetscReal,8,8> mono;
+  for (PetscInt i = 0; i < mNumVtx; i++) {
+    const PetscReal r = corner[i][0], s = corner[i][1], t = corner[i][2];
+    mono.col(i) << 1, r, s, t, r * s, r * t, s * t, r * s * t;
+  }
+  return mono * vtx / 8;
+}
+
+/* Jacobian of the trilinear map at a point, from its coefficients (one row per reference direction). */
+static RealMat3x3 jacobianFromCoefficients(const Matrix<PetscReal,8,3> &c,
+                                           const PetscReal r, const PetscReal s, const PetscReal t) {
+  RealMat3x3 jac;
+  jac.row(0) = c.row(1) + s * c.row(4) + t * c.row(5) + s * t * c.row(7);
+  jac.row(1) = c.row(2) + r * c.row(4) + t * c.row(6) + r * t * c.row(7);
+  jac.row(2) = c.row(3) + r * c.row(5) + s * c.row(6) + r * s * c.row(7);
+  return jac;
+}
+
 Vector3d HexP1::inverseCoordinateTransform(
     const PetscReal x_real, const PetscReal y_real, const PetscReal z_real,
     const Ref<const HexVtx> &vtx) {
 
-  // assumes right-hand rule vertex layout (same as PETSc)
-  PetscReal v0x = vtx(0,0); PetscReal v0y = vtx(0,1); PetscReal v0z = vtx(0,2);
-  PetscReal v1x = vtx(1,0); PetscReal v1y = vtx(1,1); PetscReal v1z = vtx(1,2);
-  PetscReal v2x = vtx(2,0); PetscReal v2y = vtx(2,1); PetscReal v2z = vtx(2,2);
-  PetscReal v3x = vtx(3,0); PetscReal v3y = vtx(3,1); PetscReal v3z = vtx(3,2);
-  PetscReal v4x = vtx(4,0); PetscReal v4y = vtx(4,1); PetscReal v4z = vtx(4,2);
-  PetscReal v5x = vtx(5,0); PetscReal v5y = vtx(5,1); PetscReal v5z = vtx(5,2);
-  PetscReal v6x = vtx(6,0); PetscReal v6y = vtx(6,1); PetscReal v6z = vtx(6,2);
-  PetscReal v7x = vtx(7,0); PetscReal v7y = vtx(7,1); PetscReal v7z = vtx(7,2);
-
   // Using Newton iterations
   // https://en.wikipedia.org/wiki/Newton%27s_method#Nonlinear_systems_of_equations
   // J_F(xn)(x_{n+1} - x_n) = -F(x_n)
   // Solve for x_{n+1}
   // where J_F(x_n) is jacobian:
+  const Matrix<PetscReal,8,3> c = trilinearCoefficients(vtx);
+  const RealVec3 x {x_real, y_real, z_real};
   PetscReal tol = 1e-6;
   PetscInt num_iter = 0;
-  RealVec3 solution {0.0, 0.0, 0.0}; // initial guess at (0.0,0.0)
-  while (true) {
 
-    RealMat3x3 jacobian_inverse_t;
-    PetscReal detJ;
+  /* Initial guess from the affine part of the map, which is exact for parallelepipeds. */
+  RealVec3 solution = jacobianFromCoefficients(c, 0, 0, 0).transpose().partialPivLu().solve(
+      x - c.row(0).transpose());
+  while (true) {
 
     PetscReal r = solution(0);
     PetscReal s = solution(1);
     PetscReal t = solution(2);
 
     // mapping from reference hex [-1,1]x[-1,1]x[-1,1] to *this* element
-    PetscReal Tx = referenceToElementMapping(v0x,v1x,v2x,v3x,v4x,v5x,v6x,v7x,r,s,t);
-    PetscReal Ty = referenceToElementMapping(v0y,v1y,v2y,v3y,v4y,v5y,v6y,v7y,r,s,t);
-    PetscReal Tz = referenceToElementMapping(v0z,v1z,v2z,v3z,v4z,v5z,v6z,v7z,r,s,t);
-     
-    Vector3d objective_function{x_real - Tx, y_real - Ty, z_real - Tz};
-
-    inverseJacobianAtPoint(r, s, t, vtx, detJ, jacobian_inverse_t);
+    Matrix<PetscReal,8,1> mono;
+    mono << 1, r, s, t, r * s, r * t, s * t, r * s * t;
+    Vector3d objective_function = x - c.transpose() * mono;
 
     if ((objective_function.array().abs() < tol).all()) {
       return solution;
     } else {
-      solution += (jacobian_inverse_t.transpose() * objective_function);
+      solution += jacobianFromCoefficients(c, r, s, t).transpose().partialPivLu().solve(objective_function);
     }
     if (num_iter > 10) {
       throw std::runtime_error("inverseCoordinateTransform in HexP1 failed to converge after "
@@ -190,55 +169,21 @@ void HexP1::inverseJacobianAtPoint(
     PetscReal r, PetscReal s, PetscReal t, const Ref<const HexVtx> &vtx,
     PetscReal &detJac, Eigen::Ref<RealMat3x3> invJac) {
 
-  // assumes right-hand rule vertex layout (same as PETSc)
-  PetscReal v0x = vtx(0,0); PetscReal v0y = vtx(0,1); PetscReal v0z = vtx(0,2);
-  PetscReal v1x = vtx(1,0); PetscReal v1y = vtx(1,1); PetscReal v1z = vtx(1,2);
-  PetscReal v2x = vtx(2,0); PetscReal v2y = vtx(2,1); PetscReal v2z = vtx(2,2);
-  PetscReal v3x = vtx(3,0); PetscReal v3y = vtx(3,1); PetscReal v3z = vtx(3,2);
-  PetscReal v4x = vtx(4,0); PetscReal v4y = vtx(4,1); PetscReal v4z = vtx(4,2);
-  PetscReal v5x = vtx(5,0); PetscReal v5y = vtx(5,1); PetscReal v5z = vtx(5,2);
-  PetscReal v6x = vtx(6,0); PetscReal v6y = vtx(6,1); PetscReal v6z = vtx(6,2);
-  PetscReal v7x = vtx(7,0); PetscReal v7y = vtx(7,1); PetscReal v7z = vtx(7,2);
-
-  PetscReal dxdr=-0.5*v0x + 0.5*v3x + 0.5*(s + 1.0)*(0.5*v0x - 0.5*v1x + 0.5*v2x - 0.5*v3x) +
-      0.5*(t + 1.0)*(0.5*v0x - 0.5*v3x - 0.5*v4x + 0.5*v5x - 0.5*(s + 1.0)*(0.5*v0x - 0.5*v1x +
-      0.5*v2x - 0.5*v3x) + 0.5*(s + 1.0)*(0.5*v4x - 0.5*v5x + 0.5*v6x - 0.5*v7x));
-  PetscReal dydr=-0.5*v0y + 0.5*v3y + 0.5*(s + 1.0)*(0.5*v0y - 0.5*v1y + 0.5*v2y - 0.5*v3y) +
-      0.5*(t + 1.0)*(0.5*v0y - 0.5*v3y - 0.5*v4y + 0.5*v5y - 0.5*(s + 1.0)*(0.5*v0y - 0.5*v1y +
-      0.5*v2y - 0.5*v3y) + 0.5*(s + 1.0)*(0.5*v4y - 0.5*v5y + 0.5*v6y - 0.5*v7y));
-  PetscReal dzdr=-0.5*v0z + 0.5*v3z + 0.5*(s + 1.0)*(0.5*v0z - 0.5*v1z + 0.5*v2z - 0.5*v3z) +
-      0.5*(t + 1.0)*(0.5*v0z - 0.5*v3z - 0.5*v4z + 0.5*v5z - 0.5*(s + 1.0)*(0.5*v0z - 0.5*v1z +
-      0.5*v2z - 0.5*v3z) + 0.5*(s + 1.0)*(0.5*v4z - 0.5*v5z + 0.5*v6z - 0.5*v7z));
-  PetscReal dxds=-0.5*v0x + 0.5*v1x - 0.25*(r + 1.0)*(-v0x + v3x) + 0.25*(r + 1.0)*(-v1x + v2x) +
-      0.5*(t + 1.0)*(0.5*v0x - 0.5*v1x - 0.5*v4x + 0.5*v7x + 0.25*(r + 1.0)*(-v0x + v3x) -
-      0.25*(r + 1.0)*(-v1x + v2x) - 0.25*(r + 1.0)*(-v4x + v5x) + 0.25*(r + 1.0)*(v6x - v7x));
-  PetscReal dyds=-0.5*v0y + 0.5*v1y - 0.25*(r + 1.0)*(-v0y + v3y) + 0.25*(r + 1.0)*(-v1y + v2y) +
-      0.5*(t + 1.0)*(0.5*v0y - 0.5*v1y - 0.5*v4y + 0.5*v7y + 0.25*(r + 1.0)*(-v0y + v3y) -
-      0.25*(r + 1.0)*(-v1y + v2y) - 0.25*(r + 1.0)*(-v4y + v5y) + 0.25*(r + 1.0)*(v6y - v7y));
-  PetscReal dzds=-0.5*v0z + 0.5*v1z - 0.25*(r + 1.0)*(-v0z + v3z) + 0.25*(r + 1.0)*(-v1z + v2z) +
-      0.5*(t + 1.0)*(0.5*v0z - 0.5*v1z - 0.5*v4z + 0.5*v7z + 0.25*(r + 1.0)*(-v0z + v3z) -
-      0.25*(r + 1.0)*(-v1z + v2z) - 0.25*(r + 1.0)*(-v4z + v5z) + 0.25*(r + 1.0)*(v6z - v7z));
-  PetscReal dxdt=-0.5*v0x + 0.5*v4x - 0.25*(r + 1.0)*(-v0x + v3x) + 0.25*(r + 1.0)*(-v4x + v5x) -
-      0.25*(s + 1.0)*(-v0x + v1x - 0.5*(r + 1.0)*(-v0x + v3x) + 0.5*(r + 1.0)*(-v1x + v2x)) +
-      0.25*(s + 1.0)*(-v4x + v7x - 0.5*(r + 1.0)*(-v4x + v5x) + 0.5*(r + 1.0)*(v6x - v7x));
-  PetscReal dydt=-0.5*v0y + 0.5*v4y - 0.25*(r + 1.0)*(-v0y + v3y) + 0.25*(r + 1.0)*(-v4y + v5y) -
-      0.25*(s + 1.0)*(-v0y + v1y - 0.5*(r + 1.0)*(-v0y + v3y) + 0.5*(r + 1.0)*(-v1y + v2y)) +
-      0.25*(s + 1.0)*(-v4y + v7y - 0.5*(r + 1.0)*(-v4y + v5y) + 0.5*(r + 1.0)*(v6y - v7y));
-  PetscReal dzdt=-0.5*v0z + 0.5*v4z - 0.25*(r + 1.0)*(-v0z + v3z) + 0.25*(r + 1.0)*(-v4z + v5z) -
-      0.25*(s + 1.0)*(-v0z + v1z - 0.5*(r + 1.0)*(-v0z + v3z) + 0.5*(r + 1.0)*(-v1z + v2z)) +
-      0.25*(s + 1.0)*(-v4z + v7z - 0.5*(r + 1.0)*(-v4z + v5z) + 0.5*(r + 1.0)*(v6z - v7z));
-    
-  RealMat3x3 J;
-  J <<
-    dxdr, dydr, dzdr,
-    dxds, dyds, dzds,
-    dxdt, dydt, dzdt;
-
+  const RealMat3x3 J = jacobianFromCoefficients(trilinearCoefficients(vtx), r, s, t);
   detJac = J.determinant();
   invJac = J.inverse();
 
 }
 
+bool HexP1::checkBoundingBox(const PetscReal x, const PetscReal y, const PetscReal z,
+                             const Ref<const HexVtx> &vtx) {
+  /* With some slack for points on the faces. */
+  const RealVec3 lo = vtx.colwise().minCoeff().transpose(), hi = vtx.colwise().maxCoeff().transpose();
+  const PetscReal slack = 1e-6 * (hi - lo).maxCoeff();
+  const RealVec3 p {x, y, z};
+  return ((p - lo).array() >= -slack).all() && ((hi - p).array() >= -slack).all();
+}
+
 RealVec HexP1::interpolateAtPoint(PetscReal r, PetscReal s, PetscReal t) {
   /**  
    *  reference hex, with r,s,t=[-1,1]x[-1,1]x[-1,1]
@@ -297,6 +242,16 @@ RealVec HexP1::interpolateAtPoint(PetscReal r, PetscReal s, PetscReal t) {
   return interpolator;
 }
 
+Eigen::Matrix<PetscReal,3,8> HexP1::shapeDerivativesAtPoint(PetscReal r, PetscReal s, PetscReal t) {
+  /* The shape functions are linear in each coordinate, so their derivative along one is half their difference
+   * between its two ends. */
+  Eigen::Matrix<PetscReal,3,8> der;
+  der.row(0) = (interpolateAtPoint(1, s, t) - interpolateAtPoint(-1, s, t)).transpose() / 2;
+  der.row(1) = (interpolateAtPoint(r, 1, t) - interpolateAtPoint(r, -1, t)).transpose() / 2;
+  der.row(2) = (interpolateAtPoint(r, s, 1) - interpolateAtPoint(r, s, -1)).transpose() / 2;
+  return der;
+}
+
 void HexP1::faceJacobianAtPoint(const PetscReal r, const PetscReal s, const Eigen::Ref<const QuadVtx> &vtx,
                                 PetscReal &detJac) {
 
@@ -2,18 +2,22 @@
 #include <Source/Source.h>
 #include <Utilities/Options.h>
 #include <Utilities/Logging.h>
+#include <Utilities/Scratch.h>
+#include <Utilities/SmallGemm.h>
+#include <Utilities/Utilities.h>
 #include <Model/ExodusModel.h>
 #include <Receiver/Receiver.h>
 #include <Element/HyperCube/HexP1.h>
 #include <Element/HyperCube/Hexahedra.h>
+#include <Element/ElementBatch.h>
 
+#include <algorithm>
+#include <cmath>
 #include <complex>
+#include <limits>
+#include <unordered_map>
 
-// Extern.
-extern "C" {
-#include <Element/HyperCube/Autogen/quad_autogen.h>
-#include <Element/HyperCube/Autogen/hex_autogen.h>
-}
+#include <Element/HyperCube/Gll.h>
 
 using namespace Eigen;
 
@@ -28,6 +32,7 @@ Hexahedra<ConcreteHex>::Hexahedra(std::unique_ptr<Options> const &options) {
 
   // Basic properties.
   mPlyOrd = options->PolynomialOrder();
+  mModElm = -1;
   
   // Gll points.
   mNumDofVtx = 1;
@@ -35,129 +40,222 @@ Hexahedra<ConcreteHex>::Hexahedra(std::unique_ptr<Options> const &options) {
   mNumDofFac = (mPlyOrd - 1) * (mPlyOrd - 1);
   mNumDofVol = (mPlyOrd - 1) * (mPlyOrd - 1) * (mPlyOrd - 1);
 
-  // Integration points.
-  mIntCrdR = GllPointsForOrder(mPlyOrd);
-  mIntCrdS = GllPointsForOrder(mPlyOrd);
-  mIntCrdT = GllPointsForOrder(mPlyOrd);
-  mIntWgtR = GllIntegrationWeights(mPlyOrd);
-  mIntWgtS = GllIntegrationWeights(mPlyOrd);
-  mIntWgtT = GllIntegrationWeights(mPlyOrd);
-  
+  // Integration points and gradient operator (shared by all elements of this order).
+  mRef = ReferenceForOrder(mPlyOrd);
+
   // Save number of integration points.
-  mNumIntPtsR = mIntCrdR.size();
-  mNumIntPtsS = mIntCrdS.size();
-  mNumIntPtsT = mIntCrdT.size();
+  mNumIntPtsR = mRef->mIntCrdR.size();
+  mNumIntPtsS = mRef->mIntCrdS.size();
+  mNumIntPtsT = mRef->mIntCrdT.size();
   mNumIntPnt = mNumIntPtsR * mNumIntPtsS * mNumIntPtsT;
 
+  /* Store the Jacobians (set up with the vertices), unless memory is tight. */
+  mPrecomputeGeometry = !options->LowMemoryGeometry();
+  mShareGeometry = options->ShareGeometry();
+  mAffine = false;
+  mFaceDofs.resize(6); mFaceWgt.resize(6); mFaceNrm.assign(6, RealVec3::Zero());
+
+  /* Select the tensor kernels for this order (N = order + 1 points per dimension). */
+  const bool small_gemm = options->SmallGemm();
+  if (mPlyOrd == 1) { selectKernels<2>(small_gemm); }
+  else if (mPlyOrd == 2) { selectKernels<3>(small_gemm); }
+  else if (mPlyOrd == 3) { selectKernels<4>(small_gemm); }
+  else if (mPlyOrd == 4) { selectKernels<5>(small_gemm); }
+  else if (mPlyOrd == 5) { selectKernels<6>(small_gemm); }
+  else if (mPlyOrd == 6) { selectKernels<7>(small_gemm); }
+  else if (mPlyOrd == 7) { selectKernels<8>(small_gemm); }
+  else if (mPlyOrd == 8) { selectKernels<9>(small_gemm); }
+  else if (mPlyOrd == 9) { selectKernels<10>(small_gemm); }
+  else if (mPlyOrd == 10) { selectKernels<11>(small_gemm); }
+
+}
+
+template <typename ConcreteHex>
+std::shared_ptr<const HexReference> Hexahedra<ConcreteHex>::ReferenceForOrder(const PetscInt order) {
+
+  /* Elements are set up serially, so the cache needs no locking. */
+  static std::map<PetscInt, std::shared_ptr<const HexReference>> references;
+  if (references.count(order)) { return references[order]; }
+
+  std::shared_ptr<HexReference> ref(new HexReference);
+
+  // Integration points.
+  ref->mIntCrdR = GllPointsForOrder(order);
+  ref->mIntCrdS = GllPointsForOrder(order);
+  ref->mIntCrdT = GllPointsForOrder(order);
+  ref->mIntWgtR = GllIntegrationWeights(order);
+  ref->mIntWgtS = GllIntegrationWeights(order);
+  ref->mIntWgtT = GllIntegrationWeights(order);
+  PetscInt num_pts_r = ref->mIntCrdR.size();
+  PetscInt num_int_pnt = num_pts_r * ref->mIntCrdS.size() * ref->mIntCrdT.size();
+
   // setup evaluated derivatives of test functions
-  mGrd = setupGradientOperator(mPlyOrd);
-  mGrdT = mGrd.transpose();
+  ref->mGrd = setupGradientOperator(order);
+  ref->mGrdT = ref->mGrd.transpose();
 
   /* Identity closure for tensor basis. */
-  mClsMap = IntVec::LinSpaced(mNumIntPnt, 0, mNumIntPnt - 1);
+  ref->mClsMap = IntVec::LinSpaced(num_int_pnt, 0, num_int_pnt - 1);
 
-  mGrdWgt.resize(mNumIntPtsR,mNumIntPtsR);
-  for(PetscInt i=0;i<mNumIntPtsR;i++) {
-    for(PetscInt j=0;j<mNumIntPtsR;j++) {
-      mGrdWgt(i,j) = mGrd(i,j)*mIntWgtR[i];
+  ref->mGrdWgt.resize(num_pts_r, num_pts_r);
+  for(PetscInt i=0;i<num_pts_r;i++) {
+    for(PetscInt j=0;j<num_pts_r;j++) {
+      ref->mGrdWgt(i,j) = ref->mGrd(i,j)*ref->mIntWgtR[i];
+    }
+  }
+  ref->mGrdWgtT = ref->mGrdWgt.transpose();
+
+  /* Vertex interpolation and geometry derivatives at the GLL points, the same for all elements. */
+  const PetscInt num_pts_s = ref->mIntCrdS.size();
+  ref->mVtxInt.resize(num_int_pnt, mNumVtx);
+  ref->mVtxDer.resize(mNumDim * num_int_pnt, mNumVtx);
+  for (PetscInt t_ind = 0; t_ind < ref->mIntCrdT.size(); t_ind++) {
+    for (PetscInt s_ind = 0; s_ind < num_pts_s; s_ind++) {
+      for (PetscInt r_ind = 0; r_ind < num_pts_r; r_ind++) {
+        const PetscInt index = r_ind + s_ind * num_pts_r + t_ind * num_pts_r * num_pts_s;
+        const PetscReal r = ref->mIntCrdR(r_ind), s = ref->mIntCrdS(s_ind), t = ref->mIntCrdT(t_ind);
+        ref->mVtxInt.row(index) = ConcreteHex::interpolateAtPoint(r, s, t).transpose();
+        ref->mVtxDer.template middleRows<3>(mNumDim * index) = ConcreteHex::shapeDerivativesAtPoint(r, s, t);
+      }
+    }
+  }
+
+  references[order] = ref;
+  return ref;
+
+}
+
+template <typename ConcreteHex>
+template <int N>
+void Hexahedra<ConcreteHex>::referenceGradientKernel(const PetscReal *grd, const PetscReal *field,
+                                                     PetscReal *grad) {
+
+  const int N2 = N * N, N3 = N * N * N;
+  for (int t_ind = 0; t_ind < N; t_ind++) {
+    for (int s_ind = 0; s_ind < N; s_ind++) {
+      for (int r_ind = 0; r_ind < N; r_ind++) {
+        PetscReal dr = 0, ds = 0, dt = 0;
+        for (int i = 0; i < N; i++) {
+          dr += grd[r_ind + i * N] * field[i + s_ind * N + t_ind * N2];
+          ds += grd[s_ind + i * N] * field[r_ind + i * N + t_ind * N2];
+          dt += grd[t_ind + i * N] * field[r_ind + s_ind * N + i * N2];
+        }
+        PetscInt index = r_ind + s_ind * N + t_ind * N2;
+        grad[index] = dr; grad[index + N3] = ds; grad[index + 2 * N3] = dt;
+      }
+    }
+  }
+
+}
+
+template <typename ConcreteHex>
+template <int N>
+void Hexahedra<ConcreteHex>::gradTestAndIntegrateKernel(const PetscReal *grd, const PetscReal *wgt,
+                                                        const PetscReal *flux, PetscReal *out) {
+
+  const int N2 = N * N, N3 = N * N * N;
+  const PetscReal *fr = flux, *fs = flux + N3, *ft = flux + 2 * N3;
+  for (int t_ind = 0; t_ind < N; t_ind++) {
+    for (int s_ind = 0; s_ind < N; s_ind++) {
+      for (int r_ind = 0; r_ind < N; r_ind++) {
+        PetscReal dphi_r_dfx = 0, dphi_s_dfy = 0, dphi_t_dfz = 0;
+        for (int i = 0; i < N; i++) {
+          dphi_r_dfx += fr[i + s_ind * N + t_ind * N2] * grd[i + r_ind * N] * wgt[i];
+          dphi_s_dfy += fs[r_ind + i * N + t_ind * N2] * grd[i + s_ind * N] * wgt[i];
+          dphi_t_dfz += ft[r_ind + s_ind * N + i * N2] * grd[i + t_ind * N] * wgt[i];
+        }
+        out[r_ind + s_ind * N + t_ind * N2] = dphi_r_dfx * wgt[s_ind] * wgt[t_ind] +
+                                              dphi_s_dfy * wgt[r_ind] * wgt[t_ind] +
+                                              dphi_t_dfz * wgt[r_ind] * wgt[s_ind];
+      }
+    }
+  }
+
+}
+
+template <typename ConcreteHex>
+template <int N>
+void Hexahedra<ConcreteHex>::selectKernels(const bool small_gemm) {
+  if (small_gemm) {
+    mRefGradKernel = &referenceGradientGemmKernel<N>; mGradTestKernel = &gradTestAndIntegrateGemmKernel<N>;
+  } else {
+    mRefGradKernel = &referenceGradientKernel<N>; mGradTestKernel = &gradTestAndIntegrateKernel<N>;
+  }
+}
+
+template <typename ConcreteHex>
+template <int N>
+void Hexahedra<ConcreteHex>::referenceGradientGemmKernel(const PetscReal *grd, const PetscReal *field,
+                                                         PetscReal *grad) {
+
+  const int N2 = N * N, N3 = N * N * N;
+  static const SmallGemm along_r(N, N2, N), along_s(N, N, N), along_t(N2, N, N);
+  PetscReal grd_t[N * N];
+  for (int i = 0; i < N; i++) {
+    for (int j = 0; j < N; j++) { grd_t[i + j * N] = grd[j + i * N]; }
+  }
+  along_r(grd, field, grad);
+  for (int t_ind = 0; t_ind < N; t_ind++) { along_s(field + t_ind * N2, grd_t, grad + N3 + t_ind * N2); }
+  along_t(field, grd_t, grad + 2 * N3);
+
+}
+
+template <typename ConcreteHex>
+template <int N>
+void Hexahedra<ConcreteHex>::gradTestAndIntegrateGemmKernel(const PetscReal *grd, const PetscReal *wgt,
+                                                            const PetscReal *flux, PetscReal *out) {
+
+  const int N2 = N * N, N3 = N * N * N;
+  static const SmallGemm along_r(N, N2, N), along_s(N, N, N), along_t(N2, N, N);
+
+  /* The weighted derivatives (grd(i, r) * wgt(i)), and their transpose. */
+  PetscReal grd_wgt[N * N], grd_wgt_t[N * N];
+  for (int r = 0; r < N; r++) {
+    for (int i = 0; i < N; i++) {
+      grd_wgt[i + r * N] = grd_wgt_t[r + i * N] = grd[i + r * N] * wgt[i];
+    }
+  }
+
+  /* Contract the fluxes along their direction, then sum them with the weights of the other two. */
+  PetscReal dphi[3 * N3];
+  const PetscReal *fr = flux, *fs = flux + N3, *ft = flux + 2 * N3;
+  along_r(grd_wgt_t, fr, dphi);
+  for (int t_ind = 0; t_ind < N; t_ind++) { along_s(fs + t_ind * N2, grd_wgt, dphi + N3 + t_ind * N2); }
+  along_t(ft, grd_wgt, dphi + 2 * N3);
+  for (int t_ind = 0; t_ind < N; t_ind++) {
+    for (int s_ind = 0; s_ind < N; s_ind++) {
+      for (int r_ind = 0; r_ind < N; r_ind++) {
+        const int index = r_ind + s_ind * N + t_ind * N2;
+        out[index] = dphi[index] * wgt[s_ind] * wgt[t_ind] + dphi[index + N3] * wgt[r_ind] * wgt[t_ind] +
+                     dphi[index + 2 * N3] * wgt[r_ind] * wgt[s_ind];
+      }
     }
   }
-  mGrdWgtT = mGrdWgt.transpose();
-  
-  mDetJac.setZero(mNumIntPnt);
-  mParWork.setZero(mNumIntPnt);
-  mStiffWork.setZero(mNumIntPnt);
-  mGradWork.setZero(mNumIntPnt, mNumDim);
 
 }
 
 template <typename ConcreteHex>
 RealVec Hexahedra<ConcreteHex>::GllPointsForOrder(const PetscInt order) {
   if (order > mMaxOrder) { throw std::runtime_error("Polynomial order not supported"); }
-  RealVec gll_points(order + 1);
-  if (order == 1) {
-    gll_coordinates_order1_square(gll_points.data());
-  } else if (order == 2) {
-    gll_coordinates_order2_square(gll_points.data());
-  } else if (order == 3) {
-    gll_coordinates_order3_square(gll_points.data());
-  } else if (order == 4) {
-    gll_coordinates_order4_square(gll_points.data());
-  } else if (order == 5) {
-    gll_coordinates_order5_square(gll_points.data());
-  } else if (order == 6) {
-    gll_coordinates_order6_square(gll_points.data());
-  } else if (order == 7) {
-    gll_coordinates_order7_square(gll_points.data());
-  }
-#if HEX_MAX_ORDER > 7
-  else if (order == 8) {
-    gll_coordinates_order8_square(gll_points.data());
-  } else if (order == 9) {
-    gll_coordinates_order9_square(gll_points.data());
-  }
-#endif
-  return gll_points;
+  return Gll::Points(order);
 }
 
 template <typename ConcreteHex>
 RealVec Hexahedra<ConcreteHex>::GllIntegrationWeights(const PetscInt order) {
   if (order > mMaxOrder) { throw std::runtime_error("Polynomial order not supported"); }
-  RealVec integration_weights(order + 1);
-  if (order == 1) {
-    gll_weights_order1_square(integration_weights.data());
-  } else if (order == 2) {
-    gll_weights_order2_square(integration_weights.data());
-  } else if (order == 3) {
-    gll_weights_order3_square(integration_weights.data());
-  } else if (order == 4) {
-    gll_weights_order4_square(integration_weights.data());
-  } else if (order == 5) {
-    gll_weights_order5_square(integration_weights.data());
-  } else if (order == 6) {
-    gll_weights_order6_square(integration_weights.data());
-  } else if (order == 7) {
-    gll_weights_order7_square(integration_weights.data());
-  }
-#if HEX_MAX_ORDER > 7
-  else if (order == 8) {
-    gll_weights_order8_square(integration_weights.data());
-  } else if (order == 9) {
-    gll_weights_order9_square(integration_weights.data());
-  }
-#endif
-  return integration_weights;
+  return Gll::Weights(order);
 }
 
 template <typename ConcreteHex>
 void Hexahedra<ConcreteHex>::attachVertexCoordinates(std::unique_ptr<Mesh> const &mesh) {
 
-  Vec coordinates_local;
-  PetscInt coordinate_buffer_size;
-  PetscSection coordinate_section;
-  PetscReal *coordinates_buffer = NULL;
-
-
-  DMGetCoordinatesLocal(mesh->DistributedMesh(), &coordinates_local);
-  DMGetCoordinateSection(mesh->DistributedMesh(), &coordinate_section);
-  DMPlexVecGetClosure(mesh->DistributedMesh(), coordinate_section, coordinates_local, mElmNum,
-                      &coordinate_buffer_size, &coordinates_buffer);
-  std::vector<PetscReal> coordinates_element(coordinates_buffer,
-                                             coordinates_buffer + coordinate_buffer_size);
-  DMPlexVecRestoreClosure(mesh->DistributedMesh(), coordinate_section, coordinates_local, mElmNum,
-                          &coordinate_buffer_size, &coordinates_buffer);
-
-  for (PetscInt i = 0; i < mNumVtx; i++) {
-    mVtxCrd(i, 0) = coordinates_element[mNumDim * i + 0];
-    mVtxCrd(i, 1) = coordinates_element[mNumDim * i + 1];
-    mVtxCrd(i, 2) = coordinates_element[mNumDim * i + 2];
-  }
+  // Coordinates were extracted for all elements when the mesh was distributed.
+  mVtxCrd = mesh->ElementVertexCoordinates(mElmNum);
 
   // Save element center
-  mElmCtr <<
-    mVtxCrd.col(0).mean(),
-    mVtxCrd.col(1).mean(),
-    mVtxCrd.col(2).mean();
+  mElmCtr = mesh->ElementCenters().row(mElmNum).transpose();
+  mModElm = mesh->ModelElement(mElmNum);
+
+  precomputeConstants();
 
 }
 
@@ -317,8 +415,7 @@ std::vector<PetscInt> Hexahedra<ConcreteHex>::getDofsOnFace(const PetscInt face)
 }
 
 template <typename ConcreteHex>
-RealVec Hexahedra<ConcreteHex>::applyTestAndIntegrateEdge(const Eigen::Ref<const RealVec> &f,
-                                                          const PetscInt edg) {
+void Hexahedra<ConcreteHex>::precomputeFace(const PetscInt edg) {
 
   RealVec3 q0, q1, q2, q3;
   RealVec int_crd_r, int_crd_s, int_wgt_r, int_wgt_s;
@@ -328,38 +425,38 @@ RealVec Hexahedra<ConcreteHex>::applyTestAndIntegrateEdge(const Eigen::Ref<const
     case 0: /* bottom */
       q0 = mVtxCrd.row(0); q1 = mVtxCrd.row(1);
       q2 = mVtxCrd.row(2); q3 = mVtxCrd.row(3);
-      int_crd_r = mIntCrdR; int_crd_s = mIntCrdS;
-      int_wgt_r = mIntWgtR; int_wgt_s = mIntWgtS;
+      int_crd_r = mRef->mIntCrdR; int_crd_s = mRef->mIntCrdS;
+      int_wgt_r = mRef->mIntWgtR; int_wgt_s = mRef->mIntWgtS;
       break;
     case 1: /* top */
       q0 = mVtxCrd.row(4); q1 = mVtxCrd.row(5);
       q2 = mVtxCrd.row(6); q3 = mVtxCrd.row(7);
-      int_crd_r = mIntCrdR; int_crd_s = mIntCrdS;
-      int_wgt_r = mIntWgtR; int_wgt_s = mIntWgtS;
+      int_crd_r = mRef->mIntCrdR; int_crd_s = mRef->mIntCrdS;
+      int_wgt_r = mRef->mIntWgtR; int_wgt_s = mRef->mIntWgtS;
       break;
     case 2: /* front */
       q0 = mVtxCrd.row(0); q1 = mVtxCrd.row(3);
       q2 = mVtxCrd.row(5); q3 = mVtxCrd.row(4);
-      int_crd_r = mIntCrdR; int_crd_s = mIntCrdT;
-      int_wgt_r = mIntWgtR; int_wgt_s = mIntWgtT;
+      int_crd_r = mRef->mIntCrdR; int_crd_s = mRef->mIntCrdT;
+      int_wgt_r = mRef->mIntWgtR; int_wgt_s = mRef->mIntWgtT;
       break;
     case 3: /* back */
       q0 = mVtxCrd.row(2); q1 = mVtxCrd.row(1);
       q2 = mVtxCrd.row(7); q3 = mVtxCrd.row(6);
-      int_crd_r = mIntCrdR; int_crd_s = mIntCrdT;
-      int_wgt_r = mIntWgtR; int_wgt_s = mIntWgtT;
+      int_crd_r = mRef->mIntCrdR; int_crd_s = mRef->mIntCrdT;
+      int_wgt_r = mRef->mIntWgtR; int_wgt_s = mRef->mIntWgtT;
       break;
     case 4: /* right */
       q0 = mVtxCrd.row(3); q1 = mVtxCrd.row(2);
       q2 = mVtxCrd.row(6); q3 = mVtxCrd.row(5);
-      int_crd_r = mIntCrdS; int_crd_s = mIntCrdT;
-      int_wgt_r = mIntWgtS; int_wgt_s = mIntWgtT;
+      int_crd_r = mRef->mIntCrdS; int_crd_s = mRef->mIntCrdT;
+      int_wgt_r = mRef->mIntWgtS; int_wgt_s = mRef->mIntWgtT;
       break;
     case 5: /* left */
       q0 = mVtxCrd.row(1); q1 = mVtxCrd.row(0);
       q2 = mVtxCrd.row(4); q3 = mVtxCrd.row(7);
-      int_crd_r = mIntCrdS; int_crd_s = mIntCrdT;
-      int_wgt_r = mIntWgtS; int_wgt_s = mIntWgtT;
+      int_crd_r = mRef->mIntCrdS; int_crd_s = mRef->mIntCrdT;
+      int_wgt_r = mRef->mIntWgtS; int_wgt_s = mRef->mIntWgtT;
       break;
     default:
       throw std::runtime_error("Unknown face " + std::to_string(edg) + " on hexahedra " +
@@ -389,24 +486,54 @@ RealVec Hexahedra<ConcreteHex>::applyTestAndIntegrateEdge(const Eigen::Ref<const
   eVtx(3, 1) = e1.dot(q3 - q0);
 
   PetscInt i = 0;
-  std::vector<PetscInt> face_closure = getDofsOnFace(edg);
-  mParWork.setZero();
+  mFaceDofs[edg] = getDofsOnFace(edg);
+  mFaceWgt[edg].resize(mFaceDofs[edg].size());
   for (PetscInt s_ind = 0; s_ind < int_crd_s.size(); s_ind++) {
     for (PetscInt r_ind = 0; r_ind < int_crd_r.size(); r_ind++) {
 
       PetscReal detJac;
-      PetscReal r = mIntCrdR(r_ind);
-      PetscReal s = mIntCrdS(s_ind);
+      PetscReal r = mRef->mIntCrdR(r_ind);
+      PetscReal s = mRef->mIntCrdS(s_ind);
 
       ConcreteHex::faceJacobianAtPoint(r, s, eVtx, detJac);
-      mParWork(face_closure[i]) = f(face_closure[i]) * detJac * int_wgt_r(r_ind) *
-          int_wgt_s(s_ind);
+      mFaceWgt[edg](i) = detJac * int_wgt_r(r_ind) * int_wgt_s(s_ind);
       i++;
 
     }
   }
 
-  return mParWork;
+  /* Outwards, seen from the mean of the vertices. */
+  const RealVec3 ctr = mVtxCrd.colwise().mean().transpose();
+  mFaceNrm[edg] = n.dot(q0 - ctr) < 0 ? RealVec3(-n) : n;
+
+}
+
+template <typename ConcreteHex>
+RealVec Hexahedra<ConcreteHex>::applyTestAndIntegrateEdge(const Eigen::Ref<const RealVec> &f,
+                                                          const PetscInt edg) {
+
+  if (edg < 0 || edg >= 6) {
+    throw std::runtime_error("Unknown face " + std::to_string(edg) + " on hexahedra " +
+        std::to_string(mElmNum));
+  }
+  if (!mFaceWgt[edg].size()) { precomputeFace(edg); }
+
+  RealVec result = RealVec::Zero(mNumIntPnt);
+  const std::vector<PetscInt> &dofs = mFaceDofs[edg];
+  for (PetscInt i = 0; i < dofs.size(); i++) { result(dofs[i]) = f(dofs[i]) * mFaceWgt[edg](i); }
+  return result;
+
+}
+
+template <typename ConcreteHex>
+RealVec3 Hexahedra<ConcreteHex>::getFaceNormal(const PetscInt face) {
+
+  if (face < 0 || face >= 6) {
+    throw std::runtime_error("Unknown face " + std::to_string(face) + " on hexahedra " +
+        std::to_string(mElmNum));
+  }
+  if (!mFaceWgt[face].size()) { precomputeFace(face); }
+  return mFaceNrm[face];
 
 }
 
@@ -415,13 +542,59 @@ template <typename ConcreteHex>
 void Hexahedra<ConcreteHex>::attachMaterialProperties(
     std::unique_ptr<ExodusModel> const &model, std::string parameter_name) {
 
+  /* Use the material sampled at the integration points by an earlier run, if there is one. */
+  const PetscReal *cached = mModElm >= 0 ?
+      model->CachedParameterAtIntPts(mModElm, parameter_name, mNumIntPnt) : NULL;
+  if (cached) {
+    Eigen::Map<const RealVec> values(cached, mNumIntPnt);
+    mParIntPts[parameter_name] = utilities::isConstant(values.array()) ? RealVec::Constant(1, values(0)) :
+        RealVec(values);
+    return;
+  }
+  mParIntPts.erase(parameter_name);
+
   RealVec material_at_vertices(mNumVtx);
 
   for (auto i = 0; i < mNumVtx; i++) {
-    material_at_vertices(i) = model->getElementalMaterialParameterAtVertex(mElmCtr, parameter_name, i);
+    material_at_vertices(i) = mModElm >= 0 ?
+        model->getElementalMaterialParameterAtVertex(mModElm, parameter_name, i) :
+        model->getElementalMaterialParameterAtVertex(mElmCtr, parameter_name, i);
   }
+  /* Blocky and layered models are mostly constant within an element, which then keeps a single value. */
+  if (utilities::isConstant(material_at_vertices.array())) { material_at_vertices.conservativeResize(1); }
   mPar[parameter_name] = material_at_vertices;
-  
+
+}
+
+template <typename ConcreteHex>
+double Hexahedra<ConcreteHex>::CFL_constant() {
+  return 0.4; // conservative for GLL spacing, orders 1-9
+}
+
+template <typename ConcreteHex>
+double Hexahedra<ConcreteHex>::estimatedElementRadius() {
+
+  RealVec x, y, z;
+  std::tie(x, y, z) = buildNodalPoints();
+
+  // smallest distance between neighbouring points along r, s and t
+  auto dist = [&](PetscInt i, PetscInt j) {
+    return std::sqrt((x(j) - x(i)) * (x(j) - x(i)) + (y(j) - y(i)) * (y(j) - y(i)) +
+                     (z(j) - z(i)) * (z(j) - z(i)));
+  };
+  double h = std::numeric_limits<double>::max();
+  for (PetscInt t_ind = 0; t_ind < mNumIntPtsT; t_ind++) {
+    for (PetscInt s_ind = 0; s_ind < mNumIntPtsS; s_ind++) {
+      for (PetscInt r_ind = 0; r_ind < mNumIntPtsR; r_ind++) {
+        PetscInt i = r_ind + s_ind * mNumIntPtsR + t_ind * mNumIntPtsR * mNumIntPtsS;
+        if (r_ind + 1 < mNumIntPtsR) { h = std::min(h, dist(i, i + 1)); }
+        if (s_ind + 1 < mNumIntPtsS) { h = std::min(h, dist(i, i + mNumIntPtsR)); }
+        if (t_ind + 1 < mNumIntPtsT) { h = std::min(h, dist(i, i + mNumIntPtsR * mNumIntPtsS)); }
+      }
+    }
+  }
+  return h;
+
 }
 
 
@@ -433,12 +606,13 @@ bool Hexahedra<ConcreteHex>::attachReceiver(std::unique_ptr<Receiver> &receiver,
   PetscReal x1 = receiver->LocX();
   PetscReal x2 = receiver->LocY();
   PetscReal x3 = receiver->LocZ();
-  if (ConcreteHex::checkHull(x1, x2, x3, mVtxCrd)) {
+  if (ConcreteHex::checkBoundingBox(x1, x2, x3, mVtxCrd) && ConcreteHex::checkHull(x1, x2, x3, mVtxCrd)) {
     if (!finalize) { return true; }
     RealVec3 ref_loc = ConcreteHex::inverseCoordinateTransform(x1, x2, x3, mVtxCrd);
     receiver->SetRefLocR(ref_loc(0));
     receiver->SetRefLocS(ref_loc(1));
     receiver->SetRefLocT(ref_loc(2));
+    mRecWeights.push_back(interpolateLagrangePolynomials(ref_loc(0), ref_loc(1), ref_loc(2), mPlyOrd));
     mRec.push_back(std::move(receiver));
     return true;
   }
@@ -451,7 +625,7 @@ bool Hexahedra<ConcreteHex>::attachSource(std::unique_ptr<Source> &source, const
   PetscReal x1 = source->LocX();
   PetscReal x2 = source->LocY();
   PetscReal x3 = source->LocZ();
-  if (ConcreteHex::checkHull(x1, x2, x3, mVtxCrd)) {
+  if (ConcreteHex::checkBoundingBox(x1, x2, x3, mVtxCrd) && ConcreteHex::checkHull(x1, x2, x3, mVtxCrd)) {
     if (!finalize) { return true; }
     RealVec3 ref_loc = ConcreteHex::inverseCoordinateTransform(x1, x2, x3, mVtxCrd);
     source->SetLocR(ref_loc(0));
@@ -467,26 +641,20 @@ template <typename ConcreteHex>
 RealVec Hexahedra<ConcreteHex>::getDeltaFunctionCoefficients(const Eigen::Ref<RealVec>& pnt) {
 
   PetscReal r = pnt(0), s = pnt(1), t = pnt(2);
-  RealMat3x3 invJ;
-  mParWork = interpolateLagrangePolynomials(r, s, t, mPlyOrd);
+  RealVec coef = interpolateLagrangePolynomials(r, s, t, mPlyOrd);
+  const RealMat jac = mRef->mVtxDer * mVtxCrd;
   for (PetscInt t_ind = 0; t_ind < mNumIntPtsT; t_ind++) {
     for (PetscInt s_ind = 0; s_ind < mNumIntPtsS; s_ind++) {
       for (PetscInt r_ind = 0; r_ind < mNumIntPtsR; r_ind++) {
 
-
-        PetscReal ri = mIntCrdR(r_ind);
-        PetscReal si = mIntCrdS(s_ind);
-        PetscReal ti = mIntCrdT(t_ind);
-
-        PetscReal detJac;
-        ConcreteHex::inverseJacobianAtPoint(ri, si, ti, mVtxCrd, detJac, invJ);
-        mParWork(r_ind + s_ind * mNumIntPtsR + t_ind*mNumIntPtsR*mNumIntPtsS) /=
-          (mIntWgtR(r_ind) * mIntWgtS(s_ind) * mIntWgtT(t_ind)  * detJac);
+        const PetscInt index = r_ind + s_ind * mNumIntPtsR + t_ind * mNumIntPtsR * mNumIntPtsS;
+        const PetscReal detJac = RealMat3x3(jac.middleRows<3>(mNumDim * index)).determinant();
+        coef(index) /= (mRef->mIntWgtR(r_ind) * mRef->mIntWgtS(s_ind) * mRef->mIntWgtT(t_ind) * detJac);
 
       }
     }
   }
-  return mParWork;
+  return coef;
 }
 
   
@@ -494,95 +662,38 @@ template <typename ConcreteHex>
 RealVec Hexahedra<ConcreteHex>::interpolateLagrangePolynomials(const PetscReal r,
                                                                const PetscReal s,
                                                                const PetscReal t,
-                                                               const PetscInt order)
-
-{
-
+                                                               const PetscInt order) {
   if (order > mMaxOrder) { throw std::runtime_error("Polynomial order not supported"); }
-  PetscInt n_points = (order + 1) * (order + 1) * (order + 1);
-  RealVec gll_coeffs(n_points);
-  if (order == 1) {
-    interpolate_order1_hex(r, s, t, gll_coeffs.data());
-  } else if (order == 2) {
-    interpolate_order2_hex(r, s, t, gll_coeffs.data());
-  } else if (order == 3) {
-    interpolate_order3_hex(r, s, t, gll_coeffs.data());
-  } else if (order == 4) {
-    interpolate_order4_hex(r, s, t, gll_coeffs.data());
-  } else if (order == 5) {
-    interpolate_order5_hex(r, s, t, gll_coeffs.data());
-  } else if (order == 6) {
-    interpolate_order6_hex(r, s, t, gll_coeffs.data());
-  } else if (order == 7) {
-    interpolate_order7_hex(r, s, t, gll_coeffs.data());
-  }
-#if HEX_MAX_ORDER > 7  
-  else if (order == 8) {
-    interpolate_order8_hex(r, s, t, gll_coeffs.data());
-  } else if (order == 9) {
-    interpolate_order9_hex(r, s, t, gll_coeffs.data());
-  }
-#endif
-  else {
-    ERROR() << "Order " << order << " not supported for hex";
-  }
-
-  return gll_coeffs;
-  
+  const RealVec pts = Gll::Points(order);
+  return Gll::TensorProduct(Gll::Lagrange(pts, r), Gll::Lagrange(pts, s), Gll::Lagrange(pts, t));
 }
 
 template <typename ConcreteHex>
-RealMat  Hexahedra<ConcreteHex>::setupGradientOperator(const PetscInt order) {
-
+RealMat Hexahedra<ConcreteHex>::setupGradientOperator(const PetscInt order) {
   if (order > mMaxOrder) { throw std::runtime_error("Polynomial order not supported"); }
-  auto rn = GllPointsForOrder(order);
-  PetscInt num_pts_r = rn.size();
-  PetscInt num_pts_s = rn.size();
-  PetscReal r = rn(0);
-  PetscReal s = rn(0);
-  
-  RealMat  grad(num_pts_s, num_pts_r);
-  RealMat test(num_pts_r, num_pts_s);
-  for (PetscInt i=0; i<num_pts_r; i++) {
-    PetscReal r = rn[i];
-    if (order == 1) {
-      interpolate_eps_derivative_order1_square(s, test.data());
-    } else if (order == 2) {
-      interpolate_eps_derivative_order2_square(r, s, test.data());
-    } else if (order == 3) {
-      interpolate_eps_derivative_order3_square(r, s, test.data());
-    } else if (order == 4) {
-      interpolate_eps_derivative_order4_square(r, s, test.data());
-    } else if (order == 5) {
-      interpolate_eps_derivative_order5_square(r, s, test.data());
-    } else if (order == 6) {
-      interpolate_eps_derivative_order6_square(r, s, test.data());
-    } else if (order == 7) {
-      interpolate_eps_derivative_order7_square(r, s, test.data());
-    }
-#if HEX_MAX_ORDER > 7    
-    else if (order == 8) {
-      interpolate_eps_derivative_order8_square(r, s, test.data());
-    } else if (order == 9) {
-      interpolate_eps_derivative_order9_square(r, s, test.data());
-    }
-#endif
-    else {
-      ERROR() << "Order " << order << " not supported for hex";
-    }
-    grad.row(i) = test.col(0);
-  }
-  
-  return grad;
+  return Gll::DerivativeMatrix(Gll::Points(order));
 }
 
 template <typename ConcreteHex>
-RealMat  Hexahedra<ConcreteHex>::computeGradient(const Ref<const RealVec> &field) {
+Eigen::Map<RealMat> Hexahedra<ConcreteHex>::computeGradient(const Ref<const RealVec> &field) {
+
+  // Gradient in the reference element, with the (fixed size) kernel for this order.
+  Eigen::Map<RealMat> grad = Scratch::Matrix(Scratch::ShapeGrad, mNumIntPnt, mNumDim);
+
+  // Affine elements transform all points with one product.
+  if (mAffine) {
+    Eigen::Map<RealMat> ref_grad = Scratch::Matrix(Scratch::ShapeTemp, mNumIntPnt, mNumDim);
+    mRefGradKernel(mRef->mGrd.data(), field.data(), ref_grad.data());
+    grad.noalias() = ref_grad * mGeo->mInvJac[0].transpose();
+    return grad;
+  }
+
+  mRefGradKernel(mRef->mGrd.data(), field.data(), grad.data());
 
   RealMat3x3 invJac;
   RealVec3 refGrad;
 
-  // Loop over all GLL points.
+  // Transform to physical coordinates at all GLL points.
   for (PetscInt t_ind = 0; t_ind < mNumIntPtsT; t_ind++) {
     for (PetscInt s_ind = 0; s_ind < mNumIntPtsS; s_ind++) {
       for (PetscInt r_ind = 0; r_ind < mNumIntPtsR; r_ind++) {
@@ -590,69 +701,28 @@ RealMat  Hexahedra<ConcreteHex>::computeGradient(const Ref<const RealVec> &field
         // gll index.
         PetscInt index = r_ind + s_ind * mNumIntPtsR + t_ind * mNumIntPtsR * mNumIntPtsS;
 
-        // (r,s,t) coordinates for this point.
-        PetscReal r = mIntCrdR(r_ind);
-        PetscReal s = mIntCrdS(s_ind);
-        PetscReal t = mIntCrdT(t_ind);
-
-        // Optimized gradient for tensorized GLL basis.
         PetscReal detJ;
-        ConcreteHex::inverseJacobianAtPoint(r, s, t, mVtxCrd, detJ, invJac);
-        
-        // mGradWork.row(index) = invJac * (refGrad <<
-        //                                  mGrd.row(r_ind).dot(rVectorStride(field,s_ind,t_ind,
-        //                                                                    mNumIntPtsR,mNumIntPtsS,mNumIntPtsT)),
-        //                                  mGrd.row(s_ind).dot(sVectorStride(field, r_ind, t_ind,
-        //                                                                    mNumIntPtsR,mNumIntPtsS,mNumIntPtsT)),
-        //                                  mGrd.row(t_ind).dot(tVectorStride(field, r_ind, s_ind,
-        //                                                                    mNumIntPtsR,mNumIntPtsS,mNumIntPtsT))).finished();
-        
-        // loop by hand is 10 us faster (27 -> 17)
-        refGrad.setZero(3);
-        for(PetscInt i=0;i<mNumIntPtsR;i++) {
-          refGrad(0) += mGrd(r_ind,i)*field(i + s_ind * mNumIntPtsR + t_ind * mNumIntPtsR * mNumIntPtsS);
-          refGrad(1) += mGrd(s_ind,i)*field(r_ind + i * mNumIntPtsR + t_ind * mNumIntPtsR * mNumIntPtsS);
-          refGrad(2) += mGrd(t_ind,i)*field(r_ind + s_ind * mNumIntPtsR + i * mNumIntPtsR * mNumIntPtsS);
-        }
-        mGradWork.row(index) = invJac * refGrad;
+        jacobianAtIntPnt(r_ind, s_ind, t_ind, detJ, invJac);
+        refGrad = grad.row(index).transpose();
+        grad.row(index) = invJac * refGrad;
 
       }
     }
   }
 
-//  std::cout << "JACOBIAN\n\n";
-//  std::cout << invJac << std::endl;
-//  std::cout << "FIELD\n\n";
-//  std::cout << field << std::endl;
-//  std::cout << "DERIVATIVE\n\n";
-//  std::cout << mGradWork << std::endl;
-
-  return mGradWork;
+  return grad;
 
 }
 
 template <typename ConcreteHex>
 RealVec Hexahedra<ConcreteHex>::ParAtIntPts(const std::string &par) {
 
-  // Loop over all GLL points.
-  for (PetscInt t_ind = 0; t_ind < mNumIntPtsT; t_ind++) {
-    for (PetscInt s_ind = 0; s_ind < mNumIntPtsS; s_ind++) {
-      for (PetscInt r_ind = 0; r_ind < mNumIntPtsR; r_ind++) {
-
-        // gll index.
-        PetscInt index = r_ind + s_ind * mNumIntPtsR + t_ind * mNumIntPtsR * mNumIntPtsS;
-
-        // (r,s,t) coordinates for this point.
-        PetscReal r = mIntCrdR(r_ind);
-        PetscReal s = mIntCrdS(s_ind);
-        PetscReal t = mIntCrdT(t_ind);
-
-        mParWork(index) = ConcreteHex::interpolateAtPoint(r,s,t).dot(mPar[par]);
-      }
-    }
-  }
+  auto cached = mParIntPts.find(par);
+  const RealVec &values = cached != mParIntPts.end() ? cached->second : mPar[par];
+  if (values.size() == 1) { return RealVec::Constant(mNumIntPnt, values(0)); }
+  if (cached != mParIntPts.end()) { return values; }
+  return mRef->mVtxInt * values;
 
-  return mParWork;
 }
 
 template <typename ConcreteHex>
@@ -668,14 +738,9 @@ RealVec Hexahedra<ConcreteHex>::applyTestAndIntegrate(const Ref<const RealVec> &
 
         // gll index.
         PetscInt index = r_ind + s_ind * mNumIntPtsR + t_ind * mNumIntPtsR * mNumIntPtsS;
-        
-        // (r,s) coordinate at this point.
-        PetscReal r = mIntCrdR(r_ind);
-        PetscReal s = mIntCrdS(s_ind);
-        PetscReal t = mIntCrdT(t_ind);
 
-        ConcreteHex::inverseJacobianAtPoint(r,s,t,mVtxCrd, detJac, invJac);
-        result(index) = f(index) * detJac * mIntWgtR(r_ind) * mIntWgtS(s_ind) * mIntWgtS(t_ind);
+        jacobianAtIntPnt(r_ind, s_ind, t_ind, detJac, invJac);
+        result(index) = f(index) * detJac * mRef->mIntWgtR(r_ind) * mRef->mIntWgtS(s_ind) * mRef->mIntWgtS(t_ind);
 
       }
     }
@@ -686,101 +751,416 @@ RealVec Hexahedra<ConcreteHex>::applyTestAndIntegrate(const Ref<const RealVec> &
 }
 
 template <typename ConcreteHex>
-RealVec Hexahedra<ConcreteHex>::applyGradTestAndIntegrate(const Ref<const RealMat > &f) {
+Eigen::Map<RealVec> Hexahedra<ConcreteHex>::applyGradTestAndIntegrate(const Ref<const RealMat > &f) {
 
   // computes the rotatation into x-y-z, which would normally happen later with more terms.
+  // The determinant is folded in here as well.
+  Eigen::Map<RealMat> flux = Scratch::Matrix(Scratch::ShapeFlux, mNumIntPnt, mNumDim);
+  Eigen::Map<RealVec> stiff = Scratch::Vector(Scratch::ShapeStiff, mNumIntPnt);
+  PetscReal detJac;
   RealMat3x3 invJac;
   RealVec3 fi;
-  RealMat  fxyz(f.rows(),3);
-  for (PetscInt t_ind = 0; t_ind < mNumIntPtsT; t_ind++) {
-    for (PetscInt s_ind = 0; s_ind < mNumIntPtsS; s_ind++) {
-      for (PetscInt r_ind = 0; r_ind < mNumIntPtsR; r_ind++) {
+  if (mAffine) {
+    // Each row is (detJac * invJac^T * f_i)^T = f_i^T * detJac * invJac.
+    invJac = mGeo->mDetJac(0) * mGeo->mInvJac[0];
+    flux.noalias() = f * invJac;
+  } else {
+    for (PetscInt t_ind = 0; t_ind < mNumIntPtsT; t_ind++) {
+      for (PetscInt s_ind = 0; s_ind < mNumIntPtsS; s_ind++) {
+        for (PetscInt r_ind = 0; r_ind < mNumIntPtsR; r_ind++) {
+
+          // gll index.
+          PetscInt index = r_ind + s_ind * mNumIntPtsR + t_ind * mNumIntPtsR * mNumIntPtsS;
+          jacobianAtIntPnt(r_ind, s_ind, t_ind, detJac, invJac);
+          fi << f(index,0),f(index,1),f(index,2);
+          flux.row(index) = (detJac * invJac.transpose() * fi).transpose();
 
-        // gll index.
-        PetscReal r = mIntCrdR(r_ind), s = mIntCrdS(s_ind), t = mIntCrdT(t_ind);
-        PetscInt index = r_ind + s_ind * mNumIntPtsR + t_ind * mNumIntPtsR * mNumIntPtsS;
-        ConcreteHex::inverseJacobianAtPoint(r, s, t, mVtxCrd, mDetJac(index), invJac);
-        fi << f(index,0),f(index,1),f(index,2);
-        fi = invJac.transpose()*fi;
-
-        fxyz(index,0) = fi[0];
-        fxyz(index,1) = fi[1];
-        fxyz(index,2) = fi[2];
-        
+        }
       }
     }
   }
 
+  // Integrate against the reference gradient of the test functions.
+  mGradTestKernel(mRef->mGrd.data(), mRef->mIntWgtR.data(), flux.data(), stiff.data());
+
+  return stiff;
+
+}
+
+template <typename ConcreteHex>
+std::shared_ptr<const HexGeometry> Hexahedra<ConcreteHex>::SharedGeometry(
+    const std::shared_ptr<const HexGeometry> &geo) {
+
+  /* Hash the geometry rounded to a fraction of its scale (the largest values). Same geometries differ by
+   * rounding only, far below that fraction, so that they only fall into different buckets if a value lies
+   * right at a boundary between two fractions (and then just keep their own records). */
+  const PetscReal tol = 1e-10, fraction = 1e-8;
+  PetscReal det_scale = geo->mDetJac.cwiseAbs().maxCoeff(), inv_scale = 0;
+  for (auto &inv: geo->mInvJac) { inv_scale = std::max(inv_scale, inv.cwiseAbs().maxCoeff()); }
+  if (!(det_scale > 0) || !(inv_scale > 0)) { return geo; }
+  unsigned long long key = 1469598103934665603ULL;
+  auto mix = [&](const PetscReal value, const PetscReal scale) {
+    key = (key ^ static_cast<unsigned long long>(std::llround(value / (fraction * scale)))) * 1099511628211ULL;
+  };
+  for (PetscInt i = 0; i < geo->mDetJac.size(); i++) {
+    mix(geo->mDetJac(i), det_scale);
+    for (PetscInt k = 0; k < 9; k++) { mix(geo->mInvJac[i].data()[k], inv_scale); }
+  }
+
+  /* Elements are set up serially, so the registry needs no locking. It does not keep the records alive, they
+   * are released with the last element holding them. */
+  static std::unordered_map<unsigned long long, std::vector<std::weak_ptr<const HexGeometry>>> registry;
+  auto &bucket = registry[key];
+  for (auto entry = bucket.begin(); entry != bucket.end();) {
+    std::shared_ptr<const HexGeometry> other = entry->lock();
+    if (!other) { entry = bucket.erase(entry); continue; }
+    bool same = other->mDetJac.size() == geo->mDetJac.size() && other->mDetJac.isApprox(geo->mDetJac, tol);
+    for (PetscInt i = 0; same && i < geo->mDetJac.size(); i++) {
+      same = other->mInvJac[i].isApprox(geo->mInvJac[i], tol);
+    }
+    if (same) { return other; }
+    ++entry;
+  }
+  bucket.push_back(geo);
+  return geo;
+
+}
+
+template <typename ConcreteHex>
+void Hexahedra<ConcreteHex>::precomputeConstants() {
+
+  /* The face geometry follows the vertices. */
+  mFaceDofs.assign(6, std::vector<PetscInt>());
+  mFaceWgt.assign(6, RealVec());
+  mFaceNrm.assign(6, RealVec3::Zero());
+
+
+  /* The Jacobians at all points, as one product with the tabulated geometry derivatives. The vertices are taken
+   * relative to the first, so that translates on a grid have the very same Jacobians (see SharedGeometry). */
+  const HexVtx relative = mVtxCrd.rowwise() - mVtxCrd.row(0);
+  const RealMat jac = mRef->mVtxDer * relative;
+  RealVec det_jac(mNumIntPnt);
+  std::vector<RealMat3x3> inv_jac(mNumIntPnt);
+  for (PetscInt i = 0; i < mNumIntPnt; i++) {
+    const RealMat3x3 jac_i = jac.middleRows<3>(mNumDim * i);
+    det_jac(i) = jac_i.determinant(); inv_jac[i] = jac_i.inverse();
+  }
+
+  /* Parallelepipeds have the same Jacobian everywhere, so only one is kept (even with
+   * --low-memory-geometry), and the kernels transform all points at once. */
+  const PetscReal tol = 1e-10;
+  mAffine = true;
+  for (PetscInt i = 1; i < mNumIntPnt && mAffine; i++) {
+    mAffine = inv_jac[i].isApprox(inv_jac[0], tol) &&
+        std::abs(det_jac(i) - det_jac(0)) <= tol * std::abs(det_jac(0));
+  }
+
+  std::shared_ptr<HexGeometry> geo;
+  if (mAffine) {
+    geo.reset(new HexGeometry);
+    geo->mDetJac = det_jac.head(1); geo->mInvJac.assign(1, inv_jac[0]);
+  } else if (mPrecomputeGeometry) {
+    geo.reset(new HexGeometry);
+    geo->mDetJac.swap(det_jac); geo->mInvJac.swap(inv_jac);
+  }
+  mGeo = geo && mShareGeometry ? SharedGeometry(geo) : geo;
+
+}
+
+template <typename ConcreteHex>
+void Hexahedra<ConcreteHex>::interleaveGeometry(const PetscInt lane, const PetscInt num_lanes, PetscReal *geo) {
 
+  PetscReal detJac;
+  RealMat3x3 invJac;
   for (PetscInt t_ind = 0; t_ind < mNumIntPtsT; t_ind++) {
     for (PetscInt s_ind = 0; s_ind < mNumIntPtsS; s_ind++) {
       for (PetscInt r_ind = 0; r_ind < mNumIntPtsR; r_ind++) {
+        PetscInt index = r_ind + s_ind * mNumIntPtsR + t_ind * mNumIntPtsR * mNumIntPtsS;
+        jacobianAtIntPnt(r_ind, s_ind, t_ind, detJac, invJac);
+        for (PetscInt k = 0; k < 9; k++) { geo[num_lanes * (10 * index + k) + lane] = invJac.data()[k]; }
+        geo[num_lanes * (10 * index + 9) + lane] = detJac;
+      }
+    }
+  }
 
-        // map reference gradient (lr,ls,lt) to this element (lx,ly,lz)
-        auto lr = mGrd.col(r_ind);
-        auto ls = mGrd.col(s_ind);
-        auto lt = mGrd.col(t_ind);
+}
 
-        PetscInt index = r_ind + s_ind * mNumIntPtsR + t_ind * mNumIntPtsR * mNumIntPtsS;
+template <typename ConcreteHex>
+template <int L>
+void Hexahedra<ConcreteHex>::scalarStiffnessLanes(const PetscReal *geo, const PetscReal *coef, const PetscReal *u,
+                                                  PetscReal *out, PetscReal *work) {
+
+  const PetscReal *grd = mRef->mGrd.data(), *wgt = mRef->mIntWgtR.data();
+  if (mPlyOrd == 1) {
+    scalarStiffnessLanesKernel<2, L>(grd, wgt, geo, coef, u, out, work);
+  } else if (mPlyOrd == 2) {
+    scalarStiffnessLanesKernel<3, L>(grd, wgt, geo, coef, u, out, work);
+  } else if (mPlyOrd == 3) {
+    scalarStiffnessLanesKernel<4, L>(grd, wgt, geo, coef, u, out, work);
+  } else if (mPlyOrd == 4) {
+    scalarStiffnessLanesKernel<5, L>(grd, wgt, geo, coef, u, out, work);
+  } else if (mPlyOrd == 5) {
+    scalarStiffnessLanesKernel<6, L>(grd, wgt, geo, coef, u, out, work);
+  } else if (mPlyOrd == 6) {
+    scalarStiffnessLanesKernel<7, L>(grd, wgt, geo, coef, u, out, work);
+  } else if (mPlyOrd == 7) {
+    scalarStiffnessLanesKernel<8, L>(grd, wgt, geo, coef, u, out, work);
+  } else if (mPlyOrd == 8) {
+    scalarStiffnessLanesKernel<9, L>(grd, wgt, geo, coef, u, out, work);
+  } else if (mPlyOrd == 9) {
+    scalarStiffnessLanesKernel<10, L>(grd, wgt, geo, coef, u, out, work);
+  } else if (mPlyOrd == 10) {
+    scalarStiffnessLanesKernel<11, L>(grd, wgt, geo, coef, u, out, work);
+  }
 
-        PetscReal dphi_r_dfx = 0;
-        PetscReal dphi_s_dfy = 0;
-        PetscReal dphi_t_dfz = 0;
-
-        for(PetscInt i=0;i<mNumIntPtsR;i++) {
-          
-          PetscInt r_index = i + s_ind * mNumIntPtsR + t_ind * mNumIntPtsR * mNumIntPtsS;
-          PetscInt s_index = r_ind + i * mNumIntPtsR + t_ind * mNumIntPtsR * mNumIntPtsS;
-          PetscInt t_index = r_ind + s_ind * mNumIntPtsR + i * mNumIntPtsR * mNumIntPtsS;
-          
-          dphi_r_dfx += mDetJac[r_index] * fxyz(r_index,0) * lr[i] * mIntWgtR[i];
-          dphi_s_dfy += mDetJac[s_index] * fxyz(s_index,1) * ls[i] * mIntWgtR[i];
-          dphi_t_dfz += mDetJac[t_index] * fxyz(t_index,2) * lt[i] * mIntWgtR[i];
-        
+}
+
+template <typename ConcreteHex>
+template <int N, int L>
+void Hexahedra<ConcreteHex>::scalarStiffnessLanesKernel(
+    const PetscReal *grd, const PetscReal *wgt, const PetscReal *geo, const PetscReal *coef,
+    const PetscReal *u, PetscReal *out, PetscReal *work) {
+
+  const int N2 = N * N, N3 = N * N * N;
+  PetscReal *fr = work, *fs = work + L * N3, *ft = work + 2 * L * N3;
+
+  /* Reference gradient, stress, and the flux rotated back to the reference element (with detJ). */
+  for (int t_ind = 0; t_ind < N; t_ind++) {
+    for (int s_ind = 0; s_ind < N; s_ind++) {
+      for (int r_ind = 0; r_ind < N; r_ind++) {
+
+        PetscReal dr[L] = {0}, ds[L] = {0}, dt[L] = {0};
+        for (int i = 0; i < N; i++) {
+          const PetscReal gr = grd[r_ind + i * N], gs = grd[s_ind + i * N], gt = grd[t_ind + i * N];
+          const PetscReal *ur = u + L * (i + s_ind * N + t_ind * N2);
+          const PetscReal *us = u + L * (r_ind + i * N + t_ind * N2);
+          const PetscReal *ut = u + L * (r_ind + s_ind * N + i * N2);
+          for (int l = 0; l < L; l++) { dr[l] += gr * ur[l]; ds[l] += gs * us[l]; dt[l] += gt * ut[l]; }
+        }
+
+        const int index = r_ind + s_ind * N + t_ind * N2;
+        const PetscReal *g = geo + L * 10 * index;
+        for (int l = 0; l < L; l++) {
+          // grad u = invJac * (du/dr, du/ds, du/dt).
+          PetscReal gx = g[L * 0 + l] * dr[l] + g[L * 3 + l] * ds[l] + g[L * 6 + l] * dt[l];
+          PetscReal gy = g[L * 1 + l] * dr[l] + g[L * 4 + l] * ds[l] + g[L * 7 + l] * dt[l];
+          PetscReal gz = g[L * 2 + l] * dr[l] + g[L * 5 + l] * ds[l] + g[L * 8 + l] * dt[l];
+          // flux = detJac * invJac^T * (coef * grad u).
+          PetscReal c = coef[L * index + l] * g[L * 9 + l];
+          fr[L * index + l] = c * (g[L * 0 + l] * gx + g[L * 1 + l] * gy + g[L * 2 + l] * gz);
+          fs[L * index + l] = c * (g[L * 3 + l] * gx + g[L * 4 + l] * gy + g[L * 5 + l] * gz);
+          ft[L * index + l] = c * (g[L * 6 + l] * gx + g[L * 7 + l] * gy + g[L * 8 + l] * gz);
+        }
+
+      }
+    }
+  }
+
+  /* Integrate against the reference gradient of the test functions. */
+  for (int t_ind = 0; t_ind < N; t_ind++) {
+    for (int s_ind = 0; s_ind < N; s_ind++) {
+      for (int r_ind = 0; r_ind < N; r_ind++) {
+
+        PetscReal dphi_r_dfx[L] = {0}, dphi_s_dfy[L] = {0}, dphi_t_dfz[L] = {0};
+        for (int i = 0; i < N; i++) {
+          const PetscReal cr = grd[i + r_ind * N] * wgt[i];
+          const PetscReal cs = grd[i + s_ind * N] * wgt[i];
+          const PetscReal ct = grd[i + t_ind * N] * wgt[i];
+          const PetscReal *pr = fr + L * (i + s_ind * N + t_ind * N2);
+          const PetscReal *ps = fs + L * (r_ind + i * N + t_ind * N2);
+          const PetscReal *pt = ft + L * (r_ind + s_ind * N + i * N2);
+          for (int l = 0; l < L; l++) {
+            dphi_r_dfx[l] += cr * pr[l]; dphi_s_dfy[l] += cs * ps[l]; dphi_t_dfz[l] += ct * pt[l];
+          }
         }
-        dphi_r_dfx *= mIntWgtR(s_ind) * mIntWgtR(t_ind);
-        dphi_s_dfy *= mIntWgtR(r_ind) * mIntWgtR(t_ind);
-        dphi_t_dfz *= mIntWgtR(r_ind) * mIntWgtR(s_ind);
-        
-        mStiffWork(index) = dphi_r_dfx + dphi_s_dfy + dphi_t_dfz;
-        
-                
+
+        const int index = r_ind + s_ind * N + t_ind * N2;
+        for (int l = 0; l < L; l++) {
+          out[L * index + l] = dphi_r_dfx[l] * wgt[s_ind] * wgt[t_ind] +
+                               dphi_s_dfy[l] * wgt[r_ind] * wgt[t_ind] +
+                               dphi_t_dfz[l] * wgt[r_ind] * wgt[s_ind];
+        }
+
       }
     }
   }
 
-  return mStiffWork;
-
-}
-
-//template <typename ConcreteHex>
-//void Hexahedra<ConcreteHex>::precomputeConstants() {
-//
-//  PetscInt num_pts = mNumIntPtsR*mNumIntPtsS*mNumIntPtsT;
-//  mDetJac.resize(num_pts);
-//  mInvJac.resize(num_pts);
-//  RealMat3x3 invJac;
-//  // Loop over all GLL points.
-//  for (PetscInt t_ind = 0; t_ind < mNumIntPtsT; t_ind++) {
-//    for (PetscInt s_ind = 0; s_ind < mNumIntPtsS; s_ind++) {
-//      for (PetscInt r_ind = 0; r_ind < mNumIntPtsR; r_ind++) {
-//
-//        // gll index.
-//        PetscInt index = r_ind + s_ind * mNumIntPtsR + t_ind * mNumIntPtsR * mNumIntPtsS;
-//
-//        // (r,s,t) coordinates for this point.
-//        PetscReal r = mIntCrdR(r_ind);
-//        PetscReal s = mIntCrdS(s_ind);
-//        PetscReal t = mIntCrdT(t_ind);
-//
-//        // Optimized gradient for tensorized GLL basis.
-//        ConcreteHex::inverseJacobianAtPoint(r, s, t, mVtxCrd, mDetJac(index), invJac);
-//        mInvJac[index] = invJac;
-//      }
-//    }
-//  }
-//}
+}
+
+template <typename ConcreteHex>
+Eigen::Map<RealMat> Hexahedra<ConcreteHex>::elasticStiffness(const Ref<const RealMat> &u,
+                                                             const PetscReal *const *coef,
+                                                             const ElasticSymmetry symmetry, const bool constant) {
+
+  Eigen::Map<RealMat> stiff = Scratch::Matrix(Scratch::ShapeStiff, mNumIntPnt, mNumDim);
+  PetscReal *work = Scratch::Matrix(Scratch::ShapeFlux, mNumIntPnt, 9).data();
+  const PetscReal *ud = u.data();
+  const PetscInt ldu = u.outerStride();
+  if (mPlyOrd == 1) {
+    constant ? elasticStiffnessOfSymmetry<2, true>(symmetry, coef, ud, ldu, stiff.data(), work) :
+               elasticStiffnessOfSymmetry<2, false>(symmetry, coef, ud, ldu, stiff.data(), work);
+  } else if (mPlyOrd == 2) {
+    constant ? elasticStiffnessOfSymmetry<3, true>(symmetry, coef, ud, ldu, stiff.data(), work) :
+               elasticStiffnessOfSymmetry<3, false>(symmetry, coef, ud, ldu, stiff.data(), work);
+  } else if (mPlyOrd == 3) {
+    constant ? elasticStiffnessOfSymmetry<4, true>(symmetry, coef, ud, ldu, stiff.data(), work) :
+               elasticStiffnessOfSymmetry<4, false>(symmetry, coef, ud, ldu, stiff.data(), work);
+  } else if (mPlyOrd == 4) {
+    constant ? elasticStiffnessOfSymmetry<5, true>(symmetry, coef, ud, ldu, stiff.data(), work) :
+               elasticStiffnessOfSymmetry<5, false>(symmetry, coef, ud, ldu, stiff.data(), work);
+  } else if (mPlyOrd == 5) {
+    constant ? elasticStiffnessOfSymmetry<6, true>(symmetry, coef, ud, ldu, stiff.data(), work) :
+               elasticStiffnessOfSymmetry<6, false>(symmetry, coef, ud, ldu, stiff.data(), work);
+  } else if (mPlyOrd == 6) {
+    constant ? elasticStiffnessOfSymmetry<7, true>(symmetry, coef, ud, ldu, stiff.data(), work) :
+               elasticStiffnessOfSymmetry<7, false>(symmetry, coef, ud, ldu, stiff.data(), work);
+  } else if (mPlyOrd == 7) {
+    constant ? elasticStiffnessOfSymmetry<8, true>(symmetry, coef, ud, ldu, stiff.data(), work) :
+               elasticStiffnessOfSymmetry<8, false>(symmetry, coef, ud, ldu, stiff.data(), work);
+  } else if (mPlyOrd == 8) {
+    constant ? elasticStiffnessOfSymmetry<9, true>(symmetry, coef, ud, ldu, stiff.data(), work) :
+               elasticStiffnessOfSymmetry<9, false>(symmetry, coef, ud, ldu, stiff.data(), work);
+  } else if (mPlyOrd == 9) {
+    constant ? elasticStiffnessOfSymmetry<10, true>(symmetry, coef, ud, ldu, stiff.data(), work) :
+               elasticStiffnessOfSymmetry<10, false>(symmetry, coef, ud, ldu, stiff.data(), work);
+  } else if (mPlyOrd == 10) {
+    constant ? elasticStiffnessOfSymmetry<11, true>(symmetry, coef, ud, ldu, stiff.data(), work) :
+               elasticStiffnessOfSymmetry<11, false>(symmetry, coef, ud, ldu, stiff.data(), work);
+  }
+
+  return stiff;
+
+}
+
+template <typename ConcreteHex>
+template <int N, bool Constant>
+void Hexahedra<ConcreteHex>::elasticStiffnessOfSymmetry(const ElasticSymmetry symmetry, const PetscReal *const *coef,
+                                                        const PetscReal *u, const PetscInt ldu, PetscReal *out,
+                                                        PetscReal *work) {
+  switch (symmetry) {
+    case ElasticSymmetry::ISOTROPIC:
+      elasticStiffnessKernel<N, 0, Constant>(coef, u, ldu, out, work);
+      break;
+    case ElasticSymmetry::ORTHOTROPIC:
+      elasticStiffnessKernel<N, ElasticSymmetryMask(ElasticSymmetry::ORTHOTROPIC), Constant>(coef, u, ldu, out, work);
+      break;
+    case ElasticSymmetry::MONOCLINIC_X:
+      elasticStiffnessKernel<N, ElasticSymmetryMask(ElasticSymmetry::MONOCLINIC_X), Constant>(coef, u, ldu, out, work);
+      break;
+    case ElasticSymmetry::MONOCLINIC_Y:
+      elasticStiffnessKernel<N, ElasticSymmetryMask(ElasticSymmetry::MONOCLINIC_Y), Constant>(coef, u, ldu, out, work);
+      break;
+    case ElasticSymmetry::TRICLINIC:
+      elasticStiffnessKernel<N, ElasticSymmetryMask(ElasticSymmetry::TRICLINIC), Constant>(coef, u, ldu, out, work);
+      break;
+  }
+}
+
+template <typename ConcreteHex>
+template <int N, int Mask, bool Constant>
+void Hexahedra<ConcreteHex>::elasticStiffnessKernel(const PetscReal *const *coef, const PetscReal *u,
+                                                    const PetscInt ldu, PetscReal *out, PetscReal *work) {
+
+  const int N2 = N * N, N3 = N * N * N;
+  const PetscReal *grd = mRef->mGrd.data(), *wgt = mRef->mIntWgtR.data();
+
+  /* Reference gradient of all components, stress, and the flux of each component rotated back to
+   * the reference element (with detJ). work holds the flux of component c along k at
+   * work[(3 * c + k) * N3 + index]. */
+  PetscReal detJac;
+  RealMat3x3 invJac;
+  for (int t_ind = 0; t_ind < N; t_ind++) {
+    for (int s_ind = 0; s_ind < N; s_ind++) {
+      for (int r_ind = 0; r_ind < N; r_ind++) {
+
+        // du_c / d(r, s, t).
+        PetscReal ref[3][3] = {{0}};
+        for (int i = 0; i < N; i++) {
+          const PetscReal gr = grd[r_ind + i * N], gs = grd[s_ind + i * N], gt = grd[t_ind + i * N];
+          const int ir = i + s_ind * N + t_ind * N2, is = r_ind + i * N + t_ind * N2,
+              it = r_ind + s_ind * N + i * N2;
+          for (int c = 0; c < 3; c++) {
+            const PetscReal *uc = u + c * ldu;
+            ref[c][0] += gr * uc[ir]; ref[c][1] += gs * uc[is]; ref[c][2] += gt * uc[it];
+          }
+        }
+
+        // du_c / dx_d = invJac * du_c / d(r, s, t).
+        const int index = r_ind + s_ind * N + t_ind * N2;
+        jacobianAtIntPnt(r_ind, s_ind, t_ind, detJac, invJac);
+        PetscReal g[3][3];
+        for (int c = 0; c < 3; c++) {
+          for (int d = 0; d < 3; d++) {
+            g[c][d] = invJac(d, 0) * ref[c][0] + invJac(d, 1) * ref[c][1] + invJac(d, 2) * ref[c][2];
+          }
+        }
+
+        // Voigt stress (as in Elastic3D::computeStress), from the strain with the engineering shear.
+        const PetscReal eps[6] = {g[0][0], g[1][1], g[2][2], g[1][2] + g[2][1], g[0][2] + g[2][0],
+                                  g[0][1] + g[1][0]};
+        const int at = Constant ? 0 : index;
+        PetscReal s[6] = {0};
+        if (!Mask) {
+          const PetscReal mu = coef[1][at], lambda_div = coef[0][at] * (eps[0] + eps[1] + eps[2]);
+          for (int i = 0; i < 3; i++) { s[i] = lambda_div + 2 * mu * eps[i]; s[i + 3] = mu * eps[i + 3]; }
+        } else {
+          /* The loops unroll, so the coefficients outside the mask drop out at compile time. */
+          for (int i = 0; i < 6; i++) {
+            for (int j = i; j < 6; j++) {
+              if (!(Mask & (1 << VoigtIndex(i, j)))) { continue; }
+              const PetscReal c = coef[VoigtIndex(i, j)][at];
+              s[i] += c * eps[j];
+              if (j != i) { s[j] += c * eps[i]; }
+            }
+          }
+        }
+        const PetscReal sigma[3][3] = {{s[0], s[5], s[4]}, {s[5], s[1], s[3]}, {s[4], s[3], s[2]}};
+
+        // flux = detJac * invJac^T * sigma_c*.
+        for (int c = 0; c < 3; c++) {
+          for (int k = 0; k < 3; k++) {
+            work[(3 * c + k) * N3 + index] = detJac * (invJac(0, k) * sigma[c][0] + invJac(1, k) * sigma[c][1] +
+                                                       invJac(2, k) * sigma[c][2]);
+          }
+        }
+
+      }
+    }
+  }
+
+  /* Integrate all components against the reference gradient of the test functions. */
+  for (int t_ind = 0; t_ind < N; t_ind++) {
+    for (int s_ind = 0; s_ind < N; s_ind++) {
+      for (int r_ind = 0; r_ind < N; r_ind++) {
+
+        PetscReal dphi[3][3] = {{0}};
+        for (int i = 0; i < N; i++) {
+          const PetscReal cr = grd[i + r_ind * N] * wgt[i];
+          const PetscReal cs = grd[i + s_ind * N] * wgt[i];
+          const PetscReal ct = grd[i + t_ind * N] * wgt[i];
+          const int ir = i + s_ind * N + t_ind * N2, is = r_ind + i * N + t_ind * N2,
+              it = r_ind + s_ind * N + i * N2;
+          for (int c = 0; c < 3; c++) {
+            const PetscReal *fc = work + 3 * c * N3;
+            dphi[c][0] += cr * fc[ir]; dphi[c][1] += cs * fc[N3 + is]; dphi[c][2] += ct * fc[2 * N3 + it];
+          }
+        }
+
+        const int index = r_ind + s_ind * N + t_ind * N2;
+        for (int c = 0; c < 3; c++) {
+          out[c * N3 + index] = dphi[c][0] * wgt[s_ind] * wgt[t_ind] +
+                                dphi[c][1] * wgt[r_ind] * wgt[t_ind] +
+                                dphi[c][2] * wgt[r_ind] * wgt[s_ind];
+        }
+
+      }
+    }
+  }
+
+}
 
 // Instantiate base case.
 template class Hexahedra<HexP1>;
+template void Hexahedra<HexP1>::scalarStiffnessLanes<ELEMENT_SIMD_LANES>(
+    const PetscReal *, const PetscReal *, const PetscReal *, PetscReal *, PetscReal *);
 
@@ -1,111 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-#include "Element/HyperCube/Autogen/order3_square.h"
-#include <math.h>
-
-void interpolate_order3_square(double epsilon, double eta, double *out_5520632088669242493) {
-
-   out_5520632088669242493[0] = 0.390625*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958);
-   out_5520632088669242493[1] = -0.873464053710856*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958);
-   out_5520632088669242493[2] = 0.873464053710855*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958);
-   out_5520632088669242493[3] = -0.390625*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958);
-   out_5520632088669242493[4] = -0.873464053710855*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 1.0);
-   out_5520632088669242493[5] = 1.953125*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 1.0);
-   out_5520632088669242493[6] = -1.953125*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 1.0);
-   out_5520632088669242493[7] = 0.873464053710855*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 1.0);
-   out_5520632088669242493[8] = 0.873464053710855*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_5520632088669242493[9] = -1.953125*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_5520632088669242493[10] = 1.953125*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_5520632088669242493[11] = -0.873464053710855*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_5520632088669242493[12] = -0.390625*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 0.447213595499958)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_5520632088669242493[13] = 0.873464053710856*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_5520632088669242493[14] = -0.873464053710855*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_5520632088669242493[15] = 0.390625*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958)*(eta + 1.0);
-
-}
-
-void interpolate_eps_derivative_order3_square(double epsilon, double eta, double *out_1735109083759235119) {
-
-   out_1735109083759235119[0] = 0.390625*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958) + 0.390625*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958) + 0.390625*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958);
-   out_1735109083759235119[1] = -0.873464053710856*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958) - 0.873464053710856*(epsilon - 1.0)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958) - 0.873464053710856*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958);
-   out_1735109083759235119[2] = 0.873464053710855*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958) + 0.873464053710855*(epsilon - 1.0)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958) + 0.873464053710855*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958);
-   out_1735109083759235119[3] = -0.390625*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958) - 0.390625*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958) - 0.390625*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958);
-   out_1735109083759235119[4] = -0.873464053710855*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 1.0) - 0.873464053710855*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 1.0) - 0.873464053710855*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 1.0);
-   out_1735109083759235119[5] = 1.953125*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 1.0) + 1.953125*(epsilon - 1.0)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 1.0) + 1.953125*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 1.0);
-   out_1735109083759235119[6] = -1.953125*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 1.0) - 1.953125*(epsilon - 1.0)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 1.0) - 1.953125*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 1.0);
-   out_1735109083759235119[7] = 0.873464053710855*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 1.0) + 0.873464053710855*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 1.0) + 0.873464053710855*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958)*(eta + 1.0);
-   out_1735109083759235119[8] = 0.873464053710855*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(eta - 1.0)*(eta + 0.447213595499958)*(eta + 1.0) + 0.873464053710855*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta + 0.447213595499958)*(eta + 1.0) + 0.873464053710855*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_1735109083759235119[9] = -1.953125*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(eta - 1.0)*(eta + 0.447213595499958)*(eta + 1.0) - 1.953125*(epsilon - 1.0)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.447213595499958)*(eta + 1.0) - 1.953125*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_1735109083759235119[10] = 1.953125*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta + 0.447213595499958)*(eta + 1.0) + 1.953125*(epsilon - 1.0)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.447213595499958)*(eta + 1.0) + 1.953125*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_1735109083759235119[11] = -0.873464053710855*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta + 0.447213595499958)*(eta + 1.0) - 0.873464053710855*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.447213595499958)*(eta + 1.0) - 0.873464053710855*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_1735109083759235119[12] = -0.390625*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(eta - 0.447213595499958)*(eta + 0.447213595499958)*(eta + 1.0) - 0.390625*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(eta - 0.447213595499958)*(eta + 0.447213595499958)*(eta + 1.0) - 0.390625*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 0.447213595499958)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_1735109083759235119[13] = 0.873464053710856*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(eta - 0.447213595499958)*(eta + 0.447213595499958)*(eta + 1.0) + 0.873464053710856*(epsilon - 1.0)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958)*(eta + 1.0) + 0.873464053710856*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_1735109083759235119[14] = -0.873464053710855*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(eta - 0.447213595499958)*(eta + 0.447213595499958)*(eta + 1.0) - 0.873464053710855*(epsilon - 1.0)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958)*(eta + 1.0) - 0.873464053710855*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_1735109083759235119[15] = 0.390625*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 0.447213595499958)*(eta + 0.447213595499958)*(eta + 1.0) + 0.390625*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958)*(eta + 1.0) + 0.390625*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958)*(eta + 1.0);
-
-}
-
-void interpolate_eta_derivative_order3_square(double epsilon, double eta, double *out_7408361074971146125) {
-
-   out_7408361074971146125[0] = 0.390625*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta - 0.447213595499958) + 0.390625*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta + 0.447213595499958) + 0.390625*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 0.447213595499958)*(eta + 0.447213595499958);
-   out_7408361074971146125[1] = -0.873464053710856*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958) - 0.873464053710856*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.447213595499958) - 0.873464053710856*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958);
-   out_7408361074971146125[2] = 0.873464053710855*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958) + 0.873464053710855*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.447213595499958) + 0.873464053710855*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958);
-   out_7408361074971146125[3] = -0.390625*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958) - 0.390625*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.447213595499958) - 0.390625*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958);
-   out_7408361074971146125[4] = -0.873464053710855*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta - 0.447213595499958) - 0.873464053710855*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta + 1.0) - 0.873464053710855*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 0.447213595499958)*(eta + 1.0);
-   out_7408361074971146125[5] = 1.953125*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958) + 1.953125*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta + 1.0) + 1.953125*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 1.0);
-   out_7408361074971146125[6] = -1.953125*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958) - 1.953125*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta + 1.0) - 1.953125*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 1.0);
-   out_7408361074971146125[7] = 0.873464053710855*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.447213595499958) + 0.873464053710855*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta + 1.0) + 0.873464053710855*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 1.0);
-   out_7408361074971146125[8] = 0.873464053710855*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta + 0.447213595499958) + 0.873464053710855*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 1.0)*(eta + 1.0) + 0.873464053710855*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_7408361074971146125[9] = -1.953125*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.447213595499958) - 1.953125*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta + 1.0) - 1.953125*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_7408361074971146125[10] = 1.953125*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.447213595499958) + 1.953125*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta + 1.0) + 1.953125*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_7408361074971146125[11] = -0.873464053710855*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.447213595499958) - 0.873464053710855*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 1.0)*(eta + 1.0) - 0.873464053710855*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_7408361074971146125[12] = -0.390625*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 0.447213595499958)*(eta + 0.447213595499958) - 0.390625*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta - 0.447213595499958)*(eta + 1.0) - 0.390625*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_7408361074971146125[13] = 0.873464053710856*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958) + 0.873464053710856*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 1.0) + 0.873464053710856*(epsilon - 1.0)*(epsilon - 0.447213595499958)*(epsilon + 1.0)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_7408361074971146125[14] = -0.873464053710855*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958) - 0.873464053710855*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 1.0) - 0.873464053710855*(epsilon - 1.0)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta + 0.447213595499958)*(eta + 1.0);
-   out_7408361074971146125[15] = 0.390625*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 0.447213595499958) + 0.390625*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta - 0.447213595499958)*(eta + 1.0) + 0.390625*(epsilon - 0.447213595499958)*(epsilon + 0.447213595499958)*(epsilon + 1.0)*(eta + 0.447213595499958)*(eta + 1.0);
-
-}
-
-void closure_mapping_order3_square(int *out_1434872603480458915) {
-
-   out_1434872603480458915[0] = 5;
-   out_1434872603480458915[1] = 6;
-   out_1434872603480458915[2] = 9;
-   out_1434872603480458915[3] = 10;
-   out_1434872603480458915[4] = 1;
-   out_1434872603480458915[5] = 2;
-   out_1434872603480458915[6] = 7;
-   out_1434872603480458915[7] = 11;
-   out_1434872603480458915[8] = 14;
-   out_1434872603480458915[9] = 13;
-   out_1434872603480458915[10] = 8;
-   out_1434872603480458915[11] = 4;
-   out_1434872603480458915[12] = 0;
-   out_1434872603480458915[13] = 3;
-   out_1434872603480458915[14] = 15;
-   out_1434872603480458915[15] = 12;
-
-}
-
-void gll_weights_order3_square(double *out_8586666373437537841) {
-
-   out_8586666373437537841[0] = 0.166666666666667;
-   out_8586666373437537841[1] = 0.833333333333333;
-   out_8586666373437537841[2] = 0.833333333333333;
-   out_8586666373437537841[3] = 0.166666666666667;
-
-}
-
-void gll_coordinates_order3_square(double *out_6407435751412178427) {
-
-   out_6407435751412178427[0] = -1.0;
-   out_6407435751412178427[1] = -0.447213595499958;
-   out_6407435751412178427[2] = 0.447213595499958;
-   out_6407435751412178427[3] = 1.0;
-
-}
@@ -1,149 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-#include "Element/HyperCube/Autogen/order4_square.h"
-#include <math.h>
-
-void interpolate_order4_square(double epsilon, double eta, double *out_5590410397267881018) {
-
-   out_5590410397267881018[0] = 0.765625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977);
-   out_5590410397267881018[1] = -1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977);
-   out_5590410397267881018[2] = 2.04166666666667*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977);
-   out_5590410397267881018[3] = -1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977);
-   out_5590410397267881018[4] = 0.765625*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977);
-   out_5590410397267881018[5] = -1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0);
-   out_5590410397267881018[6] = 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0);
-   out_5590410397267881018[7] = -4.76388888888889*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0);
-   out_5590410397267881018[8] = 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0);
-   out_5590410397267881018[9] = -1.78645833333333*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0);
-   out_5590410397267881018[10] = 2.04166666666667*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_5590410397267881018[11] = -4.76388888888889*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_5590410397267881018[12] = 5.44444444444445*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_5590410397267881018[13] = -4.76388888888889*epsilon*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_5590410397267881018[14] = 2.04166666666667*epsilon*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_5590410397267881018[15] = -1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_5590410397267881018[16] = 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_5590410397267881018[17] = -4.76388888888889*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_5590410397267881018[18] = 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_5590410397267881018[19] = -1.78645833333333*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_5590410397267881018[20] = 0.765625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_5590410397267881018[21] = -1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_5590410397267881018[22] = 2.04166666666667*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_5590410397267881018[23] = -1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_5590410397267881018[24] = 0.765625*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-
-}
-
-void interpolate_eps_derivative_order4_square(double epsilon, double eta, double *out_9048464668387216643) {
-
-   out_9048464668387216643[0] = 0.765625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) + 0.765625*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) + 0.765625*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) + 0.765625*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977);
-   out_9048464668387216643[1] = -1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) - 1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) - 1.78645833333333*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) - 1.78645833333333*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977);
-   out_9048464668387216643[2] = 2.04166666666667*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) + 2.04166666666667*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) + 2.04166666666667*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) + 2.04166666666667*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977);
-   out_9048464668387216643[3] = -1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) - 1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) - 1.78645833333333*epsilon*eta*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) - 1.78645833333333*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977);
-   out_9048464668387216643[4] = 0.765625*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) + 0.765625*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) + 0.765625*epsilon*eta*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) + 0.765625*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977);
-   out_9048464668387216643[5] = -1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) - 1.78645833333333*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0);
-   out_9048464668387216643[6] = 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) + 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) + 4.16840277777778*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) + 4.16840277777778*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0);
-   out_9048464668387216643[7] = -4.76388888888889*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) - 4.76388888888889*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) - 4.76388888888889*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) - 4.76388888888889*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0);
-   out_9048464668387216643[8] = 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) + 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) + 4.16840277777778*epsilon*eta*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) + 4.16840277777778*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0);
-   out_9048464668387216643[9] = -1.78645833333333*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*eta*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) - 1.78645833333333*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0);
-   out_9048464668387216643[10] = 2.04166666666667*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) + 2.04166666666667*epsilon*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) + 2.04166666666667*epsilon*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) + 2.04166666666667*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_9048464668387216643[11] = -4.76388888888889*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) - 4.76388888888889*epsilon*(epsilon - 1.0)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) - 4.76388888888889*epsilon*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) - 4.76388888888889*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_9048464668387216643[12] = 5.44444444444445*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) + 5.44444444444445*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) + 5.44444444444445*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) + 5.44444444444445*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_9048464668387216643[13] = -4.76388888888889*epsilon*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) - 4.76388888888889*epsilon*(epsilon - 1.0)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) - 4.76388888888889*epsilon*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) - 4.76388888888889*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_9048464668387216643[14] = 2.04166666666667*epsilon*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) + 2.04166666666667*epsilon*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) + 2.04166666666667*epsilon*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) + 2.04166666666667*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_9048464668387216643[15] = -1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) - 1.78645833333333*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_9048464668387216643[16] = 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) + 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) + 4.16840277777778*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) + 4.16840277777778*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_9048464668387216643[17] = -4.76388888888889*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) - 4.76388888888889*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) - 4.76388888888889*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) - 4.76388888888889*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_9048464668387216643[18] = 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) + 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) + 4.16840277777778*epsilon*eta*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) + 4.16840277777778*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_9048464668387216643[19] = -1.78645833333333*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*eta*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) - 1.78645833333333*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_9048464668387216643[20] = 0.765625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) + 0.765625*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) + 0.765625*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) + 0.765625*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_9048464668387216643[21] = -1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) - 1.78645833333333*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_9048464668387216643[22] = 2.04166666666667*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) + 2.04166666666667*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) + 2.04166666666667*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) + 2.04166666666667*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_9048464668387216643[23] = -1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*eta*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) - 1.78645833333333*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_9048464668387216643[24] = 0.765625*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) + 0.765625*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) + 0.765625*epsilon*eta*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) + 0.765625*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-
-}
-
-void interpolate_eta_derivative_order4_square(double epsilon, double eta, double *out_6330729362090964521) {
-
-   out_6330729362090964521[0] = 0.765625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977) + 0.765625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta + 0.654653670707977) + 0.765625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 0.654653670707977)*(eta + 0.654653670707977) + 0.765625*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977);
-   out_6330729362090964521[1] = -1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977) - 1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977) - 1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) - 1.78645833333333*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977);
-   out_6330729362090964521[2] = 2.04166666666667*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977) + 2.04166666666667*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977) + 2.04166666666667*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) + 2.04166666666667*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977);
-   out_6330729362090964521[3] = -1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977) - 1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977) - 1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) - 1.78645833333333*epsilon*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977);
-   out_6330729362090964521[4] = 0.765625*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977) + 0.765625*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977) + 0.765625*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) + 0.765625*epsilon*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977);
-   out_6330729362090964521[5] = -1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977) - 1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta + 1.0) - 1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0);
-   out_6330729362090964521[6] = 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977) + 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 1.0) + 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 1.0) + 4.16840277777778*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0);
-   out_6330729362090964521[7] = -4.76388888888889*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977) - 4.76388888888889*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 1.0) - 4.76388888888889*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 1.0) - 4.76388888888889*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0);
-   out_6330729362090964521[8] = 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977) + 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 1.0) + 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 1.0) + 4.16840277777778*epsilon*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0);
-   out_6330729362090964521[9] = -1.78645833333333*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977) - 1.78645833333333*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 1.0) - 1.78645833333333*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0);
-   out_6330729362090964521[10] = 2.04166666666667*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) + 2.04166666666667*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) + 2.04166666666667*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) + 2.04166666666667*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_6330729362090964521[11] = -4.76388888888889*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) - 4.76388888888889*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) - 4.76388888888889*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) - 4.76388888888889*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_6330729362090964521[12] = 5.44444444444445*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) + 5.44444444444445*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) + 5.44444444444445*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) + 5.44444444444445*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_6330729362090964521[13] = -4.76388888888889*epsilon*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) - 4.76388888888889*epsilon*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) - 4.76388888888889*epsilon*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) - 4.76388888888889*epsilon*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_6330729362090964521[14] = 2.04166666666667*epsilon*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) + 2.04166666666667*epsilon*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.654653670707977)*(eta + 1.0) + 2.04166666666667*epsilon*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0) + 2.04166666666667*epsilon*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_6330729362090964521[15] = -1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta + 0.654653670707977) - 1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta + 1.0) - 1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_6330729362090964521[16] = 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977) + 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 1.0) + 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta + 0.654653670707977)*(eta + 1.0) + 4.16840277777778*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_6330729362090964521[17] = -4.76388888888889*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977) - 4.76388888888889*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 1.0) - 4.76388888888889*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta + 0.654653670707977)*(eta + 1.0) - 4.76388888888889*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_6330729362090964521[18] = 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977) + 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 1.0) + 4.16840277777778*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta + 0.654653670707977)*(eta + 1.0) + 4.16840277777778*epsilon*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_6330729362090964521[19] = -1.78645833333333*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977) - 1.78645833333333*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 1.0) - 1.78645833333333*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta + 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_6330729362090964521[20] = 0.765625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 0.654653670707977)*(eta + 0.654653670707977) + 0.765625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 0.654653670707977)*(eta + 1.0) + 0.765625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0) + 0.765625*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_6330729362090964521[21] = -1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) - 1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta + 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_6330729362090964521[22] = 2.04166666666667*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) + 2.04166666666667*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 1.0) + 2.04166666666667*eta*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta + 0.654653670707977)*(eta + 1.0) + 2.04166666666667*(epsilon - 1.0)*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_6330729362090964521[23] = -1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) - 1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta + 0.654653670707977)*(eta + 1.0) - 1.78645833333333*epsilon*(epsilon - 1.0)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-   out_6330729362090964521[24] = 0.765625*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977) + 0.765625*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 1.0) + 0.765625*epsilon*eta*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta + 0.654653670707977)*(eta + 1.0) + 0.765625*epsilon*(epsilon - 0.654653670707977)*(epsilon + 0.654653670707977)*(epsilon + 1.0)*(eta - 0.654653670707977)*(eta + 0.654653670707977)*(eta + 1.0);
-
-}
-
-void closure_mapping_order4_square(int *out_2138521137306367256) {
-
-   out_2138521137306367256[0] = 6;
-   out_2138521137306367256[1] = 7;
-   out_2138521137306367256[2] = 8;
-   out_2138521137306367256[3] = 11;
-   out_2138521137306367256[4] = 12;
-   out_2138521137306367256[5] = 13;
-   out_2138521137306367256[6] = 16;
-   out_2138521137306367256[7] = 17;
-   out_2138521137306367256[8] = 18;
-   out_2138521137306367256[9] = 1;
-   out_2138521137306367256[10] = 2;
-   out_2138521137306367256[11] = 3;
-   out_2138521137306367256[12] = 9;
-   out_2138521137306367256[13] = 14;
-   out_2138521137306367256[14] = 19;
-   out_2138521137306367256[15] = 23;
-   out_2138521137306367256[16] = 22;
-   out_2138521137306367256[17] = 21;
-   out_2138521137306367256[18] = 15;
-   out_2138521137306367256[19] = 10;
-   out_2138521137306367256[20] = 5;
-   out_2138521137306367256[21] = 0;
-   out_2138521137306367256[22] = 4;
-   out_2138521137306367256[23] = 24;
-   out_2138521137306367256[24] = 20;
-
-}
-
-void gll_weights_order4_square(double *out_9021652956210223773) {
-
-   out_9021652956210223773[0] = 0.1;
-   out_9021652956210223773[1] = 0.544444444444445;
-   out_9021652956210223773[2] = 0.711111111111111;
-   out_9021652956210223773[3] = 0.544444444444445;
-   out_9021652956210223773[4] = 0.1;
-
-}
-
-void gll_coordinates_order4_square(double *out_3496294405507664450) {
-
-   out_3496294405507664450[0] = -1.0;
-   out_3496294405507664450[1] = -0.654653670707977;
-   out_3496294405507664450[2] = 0.0;
-   out_3496294405507664450[3] = 0.654653670707977;
-   out_3496294405507664450[4] = 1.0;
-
-}
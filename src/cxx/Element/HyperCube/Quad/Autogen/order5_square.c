@@ -1,195 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-#include "Element/HyperCube/Autogen/order5_square.h"
-#include <math.h>
-
-void interpolate_order5_square(double epsilon, double eta, double *out_4953907929813173491) {
-
-   out_4953907929813173491[0] = 1.72265625*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465);
-   out_4953907929813173491[1] = -4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465);
-   out_4953907929813173491[2] = 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465);
-   out_4953907929813173491[3] = -4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465);
-   out_4953907929813173491[4] = 4.10452426479039*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465);
-   out_4953907929813173491[5] = -1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465);
-   out_4953907929813173491[6] = -4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0);
-   out_4953907929813173491[7] = 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0);
-   out_4953907929813173491[8] = -11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0);
-   out_4953907929813173491[9] = 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0);
-   out_4953907929813173491[10] = -9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0);
-   out_4953907929813173491[11] = 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0);
-   out_4953907929813173491[12] = 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[13] = -11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[14] = 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[15] = -14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[16] = 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[17] = -4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[18] = -4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[19] = 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[20] = -14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[21] = 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[22] = -11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[23] = 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[24] = 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[25] = -9.77973373402444*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[26] = 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[27] = -11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[28] = 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[29] = -4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[30] = -1.72265625*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[31] = 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[32] = -4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[33] = 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[34] = -4.10452426479039*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_4953907929813173491[35] = 1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-
-}
-
-void interpolate_eps_derivative_order5_square(double epsilon, double eta, double *out_8747288793387336531) {
-
-   out_8747288793387336531[0] = 1.72265625*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 1.72265625*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 1.72265625*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 1.72265625*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465);
-   out_8747288793387336531[1] = -4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465);
-   out_8747288793387336531[2] = 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465);
-   out_8747288793387336531[3] = -4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 4.96975898198734*(epsilon - 1.0)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465);
-   out_8747288793387336531[4] = 4.10452426479039*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 4.10452426479039*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 4.10452426479039*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 4.10452426479039*(epsilon - 1.0)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 4.10452426479039*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465);
-   out_8747288793387336531[5] = -1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 1.72265625*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 1.72265625*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465);
-   out_8747288793387336531[6] = -4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0);
-   out_8747288793387336531[7] = 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 9.77973373402444*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0);
-   out_8747288793387336531[8] = -11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 11.8413039930207*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0);
-   out_8747288793387336531[9] = 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 11.8413039930207*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0);
-   out_8747288793387336531[10] = -9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 9.77973373402444*(epsilon - 1.0)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 9.77973373402444*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0);
-   out_8747288793387336531[11] = 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 4.10452426479038*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0);
-   out_8747288793387336531[12] = 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[13] = -11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 11.8413039930207*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[14] = 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 14.3374537659756*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[15] = -14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 14.3374537659756*(epsilon - 1.0)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 14.3374537659756*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[16] = 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 11.8413039930207*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[17] = -4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.96975898198734*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[18] = -4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[19] = 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 11.8413039930207*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[20] = -14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 14.3374537659756*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[21] = 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 14.3374537659756*(epsilon - 1.0)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 14.3374537659756*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[22] = -11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 11.8413039930207*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[23] = 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.96975898198734*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[24] = 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[25] = -9.77973373402444*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 9.77973373402444*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[26] = 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 11.8413039930207*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[27] = -11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 11.8413039930207*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[28] = 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 9.77973373402444*(epsilon - 1.0)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 9.77973373402444*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[29] = -4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.10452426479038*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[30] = -1.72265625*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 1.72265625*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 1.72265625*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 1.72265625*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[31] = 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[32] = -4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[33] = 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.96975898198734*(epsilon - 1.0)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[34] = -4.10452426479039*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.10452426479039*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.10452426479039*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.10452426479039*(epsilon - 1.0)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.10452426479039*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_8747288793387336531[35] = 1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 1.72265625*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 1.72265625*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-
-}
-
-void interpolate_eta_derivative_order5_square(double epsilon, double eta, double *out_3919865154438395407) {
-
-   out_3919865154438395407[0] = 1.72265625*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645) + 1.72265625*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465) + 1.72265625*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 1.72265625*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 1.72265625*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465);
-   out_3919865154438395407[1] = -4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645) - 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465) - 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465);
-   out_3919865154438395407[2] = 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465);
-   out_3919865154438395407[3] = -4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465);
-   out_3919865154438395407[4] = 4.10452426479039*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645) + 4.10452426479039*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465) + 4.10452426479039*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 4.10452426479039*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 4.10452426479039*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465);
-   out_3919865154438395407[5] = -1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645) - 1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465) - 1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465);
-   out_3919865154438395407[6] = -4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645) - 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 1.0) - 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 1.0) - 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0);
-   out_3919865154438395407[7] = 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645) + 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 1.0) + 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 1.0) + 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0);
-   out_3919865154438395407[8] = -11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0);
-   out_3919865154438395407[9] = 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0);
-   out_3919865154438395407[10] = -9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645) - 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 1.0) - 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 1.0) - 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0);
-   out_3919865154438395407[11] = 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645) + 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 1.0) + 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 1.0) + 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0);
-   out_3919865154438395407[12] = 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 1.0) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.765055323929465)*(eta + 1.0) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[13] = -11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.765055323929465)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[14] = 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465) + 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 1.0) + 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.765055323929465)*(eta + 1.0) + 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[15] = -14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465) - 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 1.0) - 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.765055323929465)*(eta + 1.0) - 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[16] = 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.765055323929465)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[17] = -4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465) - 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 1.0) - 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.765055323929465)*(eta + 1.0) - 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[18] = -4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 1.0) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.765055323929465)*(eta + 1.0) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[19] = 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.765055323929465)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[20] = -14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 1.0) - 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.765055323929465)*(eta + 1.0) - 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[21] = 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 1.0) + 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.765055323929465)*(eta + 1.0) + 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 14.3374537659756*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[22] = -11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.765055323929465)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[23] = 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 1.0) + 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.765055323929465)*(eta + 0.765055323929465)*(eta + 1.0) + 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.96975898198734*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[24] = 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 1.0)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[25] = -9.77973373402444*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[26] = 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[27] = -11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 11.8413039930207*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[28] = 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 9.77973373402444*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[29] = -4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.10452426479038*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[30] = -1.72265625*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 1.72265625*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 1.72265625*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 1.72265625*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 1.72265625*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[31] = 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.10452426479038*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[32] = -4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[33] = 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 4.96975898198734*(epsilon - 1.0)*(epsilon - 0.765055323929465)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[34] = -4.10452426479039*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) - 4.10452426479039*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) - 4.10452426479039*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.10452426479039*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) - 4.10452426479039*(epsilon - 1.0)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-   out_3919865154438395407[35] = 1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465) + 1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 1.0) + 1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta - 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.765055323929465)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0) + 1.72265625*(epsilon - 0.765055323929465)*(epsilon - 0.285231516480645)*(epsilon + 0.285231516480645)*(epsilon + 0.765055323929465)*(epsilon + 1.0)*(eta - 0.285231516480645)*(eta + 0.285231516480645)*(eta + 0.765055323929465)*(eta + 1.0);
-
-}
-
-void closure_mapping_order5_square(int *out_3462185086303802983) {
-
-   out_3462185086303802983[0] = 7;
-   out_3462185086303802983[1] = 8;
-   out_3462185086303802983[2] = 9;
-   out_3462185086303802983[3] = 10;
-   out_3462185086303802983[4] = 13;
-   out_3462185086303802983[5] = 14;
-   out_3462185086303802983[6] = 15;
-   out_3462185086303802983[7] = 16;
-   out_3462185086303802983[8] = 19;
-   out_3462185086303802983[9] = 20;
-   out_3462185086303802983[10] = 21;
-   out_3462185086303802983[11] = 22;
-   out_3462185086303802983[12] = 25;
-   out_3462185086303802983[13] = 26;
-   out_3462185086303802983[14] = 27;
-   out_3462185086303802983[15] = 28;
-   out_3462185086303802983[16] = 1;
-   out_3462185086303802983[17] = 2;
-   out_3462185086303802983[18] = 3;
-   out_3462185086303802983[19] = 4;
-   out_3462185086303802983[20] = 11;
-   out_3462185086303802983[21] = 17;
-   out_3462185086303802983[22] = 23;
-   out_3462185086303802983[23] = 29;
-   out_3462185086303802983[24] = 34;
-   out_3462185086303802983[25] = 33;
-   out_3462185086303802983[26] = 32;
-   out_3462185086303802983[27] = 31;
-   out_3462185086303802983[28] = 24;
-   out_3462185086303802983[29] = 18;
-   out_3462185086303802983[30] = 12;
-   out_3462185086303802983[31] = 6;
-   out_3462185086303802983[32] = 0;
-   out_3462185086303802983[33] = 5;
-   out_3462185086303802983[34] = 35;
-   out_3462185086303802983[35] = 30;
-
-}
-
-void gll_weights_order5_square(double *out_6934682480549297959) {
-
-   out_6934682480549297959[0] = 0.0666666666666667;
-   out_6934682480549297959[1] = 0.378474956297847;
-   out_6934682480549297959[2] = 0.554858377035486;
-   out_6934682480549297959[3] = 0.554858377035486;
-   out_6934682480549297959[4] = 0.378474956297847;
-   out_6934682480549297959[5] = 0.0666666666666667;
-
-}
-
-void gll_coordinates_order5_square(double *out_3001728889501436902) {
-
-   out_3001728889501436902[0] = -1.0;
-   out_3001728889501436902[1] = -0.765055323929465;
-   out_3001728889501436902[2] = -0.285231516480645;
-   out_3001728889501436902[3] = 0.285231516480645;
-   out_3001728889501436902[4] = 0.765055323929465;
-   out_3001728889501436902[5] = 1.0;
-
-}
@@ -1,249 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-#include "Element/HyperCube/Autogen/order6_square.h"
-#include <math.h>
-
-void interpolate_order6_square(double epsilon, double eta, double *out_3210054076336248177) {
-
-   out_3210054076336248177[0] = 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_3210054076336248177[1] = -10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_3210054076336248177[2] = 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_3210054076336248177[3] = -13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_3210054076336248177[4] = 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_3210054076336248177[5] = -10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_3210054076336248177[6] = 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_3210054076336248177[7] = -10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_3210054076336248177[8] = 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_3210054076336248177[9] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_3210054076336248177[10] = 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_3210054076336248177[11] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_3210054076336248177[12] = 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_3210054076336248177[13] = -10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_3210054076336248177[14] = 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[15] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[16] = 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[17] = -40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[18] = 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[19] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[20] = 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[21] = -13.6125*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[22] = 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[23] = -40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[24] = 43.56*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[25] = -40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[26] = 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[27] = -13.6125*epsilon*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[28] = 12.8088875188043*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[29] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[30] = 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[31] = -40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[32] = 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[33] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[34] = 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[35] = -10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[36] = 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[37] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[38] = 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[39] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[40] = 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[41] = -10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[42] = 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[43] = -10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[44] = 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[45] = -13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[46] = 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[47] = -10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_3210054076336248177[48] = 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-
-}
-
-void interpolate_eps_derivative_order6_square(double epsilon, double eta, double *out_5582450715052588863) {
-
-   out_5582450715052588863[0] = 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_5582450715052588863[1] = -10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_5582450715052588863[2] = 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_5582450715052588863[3] = -13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 13.6125*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 13.6125*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_5582450715052588863[4] = 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_5582450715052588863[5] = -10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*eta*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_5582450715052588863[6] = 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*epsilon*eta*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_5582450715052588863[7] = -10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_5582450715052588863[8] = 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 24.7294331137174*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_5582450715052588863[9] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_5582450715052588863[10] = 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 32.8209400601739*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_5582450715052588863[11] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_5582450715052588863[12] = 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 24.7294331137174*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_5582450715052588863[13] = -10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_5582450715052588863[14] = 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[15] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[16] = 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[17] = -40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[18] = 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[19] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[20] = 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[21] = -13.6125*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*epsilon*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*epsilon*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[22] = 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*epsilon*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[23] = -40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*epsilon*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[24] = 43.56*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 43.56*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 43.56*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 43.56*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 43.56*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 43.56*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[25] = -40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*epsilon*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[26] = 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*epsilon*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[27] = -13.6125*epsilon*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*epsilon*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*epsilon*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*epsilon*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*epsilon*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[28] = 12.8088875188043*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188043*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188043*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188043*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188043*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188043*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[29] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[30] = 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[31] = -40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[32] = 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[33] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[34] = 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[35] = -10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[36] = 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 24.7294331137174*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[37] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[38] = 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[39] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[40] = 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 24.7294331137174*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[41] = -10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[42] = 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 4.25390625*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[43] = -10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[44] = 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[45] = -13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[46] = 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[47] = -10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_5582450715052588863[48] = 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 4.25390625*epsilon*eta*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 4.25390625*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-
-}
-
-void interpolate_eta_derivative_order6_square(double epsilon, double eta, double *out_2514256276583579295) {
-
-   out_2514256276583579295[0] = 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714) + 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_2514256276583579295[1] = -10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_2514256276583579295[2] = 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_2514256276583579295[3] = -13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714) - 13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567) - 13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 13.6125*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_2514256276583579295[4] = 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_2514256276583579295[5] = -10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_2514256276583579295[6] = 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714) + 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*epsilon*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567);
-   out_2514256276583579295[7] = -10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_2514256276583579295[8] = 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 24.7294331137174*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_2514256276583579295[9] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_2514256276583579295[10] = 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714) + 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 1.0) + 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 1.0) + 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 32.8209400601739*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_2514256276583579295[11] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_2514256276583579295[12] = 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 24.7294331137174*epsilon*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_2514256276583579295[13] = -10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714) - 10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0);
-   out_2514256276583579295[14] = 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[15] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[16] = 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[17] = -40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567) - 40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 1.0) - 40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[18] = 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[19] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[20] = 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[21] = -13.6125*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 13.6125*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 13.6125*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[22] = 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[23] = -40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[24] = 43.56*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 43.56*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 43.56*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 43.56*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 43.56*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 43.56*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[25] = -40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[26] = 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*epsilon*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[27] = -13.6125*epsilon*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 13.6125*epsilon*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 13.6125*epsilon*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*epsilon*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*epsilon*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*epsilon*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[28] = 12.8088875188043*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188043*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 1.0) + 12.8088875188043*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188043*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188043*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188043*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[29] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[30] = 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[31] = -40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 1.0) - 40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 40.9884400601739*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[32] = 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 38.5686918862826*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[33] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[34] = 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[35] = -10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[36] = 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 24.7294331137174*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[37] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[38] = 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 32.8209400601739*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[39] = -30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 30.883359375*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[40] = 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 24.7294331137174*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 24.7294331137174*epsilon*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[41] = -10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[42] = 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 4.25390625*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 4.25390625*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[43] = -10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[44] = 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[45] = -13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 13.6125*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[46] = 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 12.8088875188044*epsilon*(epsilon - 1.0)*(epsilon - 0.830223896278567)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[47] = -10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) - 10.2565437688044*epsilon*(epsilon - 1.0)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-   out_2514256276583579295[48] = 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567) + 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 1.0) + 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 4.25390625*epsilon*eta*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0) + 4.25390625*epsilon*(epsilon - 0.830223896278567)*(epsilon - 0.468848793470714)*(epsilon + 0.468848793470714)*(epsilon + 0.830223896278567)*(epsilon + 1.0)*(eta - 0.830223896278567)*(eta - 0.468848793470714)*(eta + 0.468848793470714)*(eta + 0.830223896278567)*(eta + 1.0);
-
-}
-
-void closure_mapping_order6_square(int *out_4288441802878156186) {
-
-   out_4288441802878156186[0] = 8;
-   out_4288441802878156186[1] = 9;
-   out_4288441802878156186[2] = 10;
-   out_4288441802878156186[3] = 11;
-   out_4288441802878156186[4] = 12;
-   out_4288441802878156186[5] = 15;
-   out_4288441802878156186[6] = 16;
-   out_4288441802878156186[7] = 17;
-   out_4288441802878156186[8] = 18;
-   out_4288441802878156186[9] = 19;
-   out_4288441802878156186[10] = 22;
-   out_4288441802878156186[11] = 23;
-   out_4288441802878156186[12] = 24;
-   out_4288441802878156186[13] = 25;
-   out_4288441802878156186[14] = 26;
-   out_4288441802878156186[15] = 29;
-   out_4288441802878156186[16] = 30;
-   out_4288441802878156186[17] = 31;
-   out_4288441802878156186[18] = 32;
-   out_4288441802878156186[19] = 33;
-   out_4288441802878156186[20] = 36;
-   out_4288441802878156186[21] = 37;
-   out_4288441802878156186[22] = 38;
-   out_4288441802878156186[23] = 39;
-   out_4288441802878156186[24] = 40;
-   out_4288441802878156186[25] = 1;
-   out_4288441802878156186[26] = 2;
-   out_4288441802878156186[27] = 3;
-   out_4288441802878156186[28] = 4;
-   out_4288441802878156186[29] = 5;
-   out_4288441802878156186[30] = 13;
-   out_4288441802878156186[31] = 20;
-   out_4288441802878156186[32] = 27;
-   out_4288441802878156186[33] = 34;
-   out_4288441802878156186[34] = 41;
-   out_4288441802878156186[35] = 47;
-   out_4288441802878156186[36] = 46;
-   out_4288441802878156186[37] = 45;
-   out_4288441802878156186[38] = 44;
-   out_4288441802878156186[39] = 43;
-   out_4288441802878156186[40] = 35;
-   out_4288441802878156186[41] = 28;
-   out_4288441802878156186[42] = 21;
-   out_4288441802878156186[43] = 14;
-   out_4288441802878156186[44] = 7;
-   out_4288441802878156186[45] = 0;
-   out_4288441802878156186[46] = 6;
-   out_4288441802878156186[47] = 48;
-   out_4288441802878156186[48] = 42;
-
-}
-
-void gll_weights_order6_square(double *out_4731757004545806116) {
-
-   out_4731757004545806116[0] = 0.0476190476190476;
-   out_4731757004545806116[1] = 0.276826047361565;
-   out_4731757004545806116[2] = 0.431745381209863;
-   out_4731757004545806116[3] = 0.487619047619048;
-   out_4731757004545806116[4] = 0.431745381209863;
-   out_4731757004545806116[5] = 0.276826047361565;
-   out_4731757004545806116[6] = 0.0476190476190476;
-
-}
-
-void gll_coordinates_order6_square(double *out_5275473663835076437) {
-
-   out_5275473663835076437[0] = -1.0;
-   out_5275473663835076437[1] = -0.830223896278567;
-   out_5275473663835076437[2] = -0.468848793470714;
-   out_5275473663835076437[3] = 0.0;
-   out_5275473663835076437[4] = 0.468848793470714;
-   out_5275473663835076437[5] = 0.830223896278567;
-   out_5275473663835076437[6] = 1.0;
-
-}
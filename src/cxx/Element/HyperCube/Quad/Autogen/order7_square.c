@@ -1,311 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-#include "Element/HyperCube/Autogen/order7_square.h"
-#include <math.h>
-
-void interpolate_order7_square(double epsilon, double eta, double *out_917917640078739063) {
-
-   out_917917640078739063[0] = 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_917917640078739063[1] = -27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_917917640078739063[2] = 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_917917640078739063[3] = -38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_917917640078739063[4] = 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_917917640078739063[5] = -34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_917917640078739063[6] = 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_917917640078739063[7] = -11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_917917640078739063[8] = -27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_917917640078739063[9] = 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_917917640078739063[10] = -84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_917917640078739063[11] = 92.721315538985*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_917917640078739063[12] = -92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_917917640078739063[13] = 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_917917640078739063[14] = -66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_917917640078739063[15] = 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_917917640078739063[16] = 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[17] = -84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[18] = 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[19] = -117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[20] = 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[21] = -107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[22] = 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[23] = -34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[24] = -38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[25] = 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[26] = -117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[27] = 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[28] = -129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[29] = 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[30] = -92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[31] = 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[32] = 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[33] = -92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[34] = 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[35] = -129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[36] = 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[37] = -117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[38] = 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[39] = -38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[40] = -34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[41] = 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[42] = -107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[43] = 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[44] = -117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[45] = 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[46] = -84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[47] = 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[48] = 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[49] = -66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[50] = 84.322719802219*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[51] = -92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[52] = 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[53] = -84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[54] = 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[55] = -27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[56] = -11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[57] = 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[58] = -34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[59] = 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[60] = -38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[61] = 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[62] = -27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_917917640078739063[63] = 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-
-}
-
-void interpolate_eps_derivative_order7_square(double epsilon, double eta, double *out_7517406232432299947) {
-
-   out_7517406232432299947[0] = 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_7517406232432299947[1] = -27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_7517406232432299947[2] = 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_7517406232432299947[3] = -38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_7517406232432299947[4] = 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_7517406232432299947[5] = -34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_7517406232432299947[6] = 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 27.2841409853977*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_7517406232432299947[7] = -11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 11.2329711914062*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_7517406232432299947[8] = -27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_7517406232432299947[9] = 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 66.2713663754946*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_7517406232432299947[10] = -84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 84.3227198022191*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_7517406232432299947[11] = 92.721315538985*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 92.721315538985*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 92.721315538985*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 92.721315538985*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 92.721315538985*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 92.721315538985*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 92.721315538985*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_7517406232432299947[12] = -92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 92.7213155389851*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_7517406232432299947[13] = 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 84.3227198022191*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_7517406232432299947[14] = -66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 66.2713663754946*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_7517406232432299947[15] = 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 27.2841409853977*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_7517406232432299947[16] = 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[17] = -84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[18] = 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[19] = -117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[20] = 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[21] = -107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[22] = 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[23] = -34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[24] = -38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[25] = 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[26] = -117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[27] = 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[28] = -129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[29] = 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[30] = -92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[31] = 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[32] = 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[33] = -92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[34] = 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[35] = -129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[36] = 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[37] = -117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[38] = 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[39] = -38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[40] = -34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[41] = 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[42] = -107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[43] = 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[44] = -117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[45] = 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[46] = -84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[47] = 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[48] = 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[49] = -66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 66.2713663754946*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[50] = 84.322719802219*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 84.322719802219*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 84.322719802219*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 84.322719802219*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 84.322719802219*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 84.322719802219*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 84.322719802219*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[51] = -92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[52] = 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[53] = -84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[54] = 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 66.2713663754946*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[55] = -27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[56] = -11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[57] = 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[58] = -34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[59] = 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[60] = -38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[61] = 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[62] = -27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_7517406232432299947[63] = 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 11.2329711914062*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-
-}
-
-void interpolate_eta_derivative_order7_square(double epsilon, double eta, double *out_4617504037014595993) {
-
-   out_4617504037014595993[0] = 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142) + 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607) + 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_4617504037014595993[1] = -27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_4617504037014595993[2] = 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_4617504037014595993[3] = -38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_4617504037014595993[4] = 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_4617504037014595993[5] = -34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_4617504037014595993[6] = 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_4617504037014595993[7] = -11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142) - 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607) - 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607);
-   out_4617504037014595993[8] = -27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_4617504037014595993[9] = 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_4617504037014595993[10] = -84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_4617504037014595993[11] = 92.721315538985*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142) + 92.721315538985*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 1.0) + 92.721315538985*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 92.721315538985*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 92.721315538985*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 92.721315538985*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 92.721315538985*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_4617504037014595993[12] = -92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_4617504037014595993[13] = 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_4617504037014595993[14] = -66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_4617504037014595993[15] = 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142) + 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 1.0) + 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0);
-   out_4617504037014595993[16] = 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[17] = -84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[18] = 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[19] = -117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[20] = 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[21] = -107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[22] = 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[23] = -34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607) - 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 1.0) - 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[24] = -38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[25] = 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[26] = -117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[27] = 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[28] = -129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[29] = 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[30] = -92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[31] = 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[32] = 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[33] = -92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[34] = 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[35] = -129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[36] = 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 129.727857225214*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[37] = -117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[38] = 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[39] = -38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[40] = -34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.871740148509607)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[41] = 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[42] = -107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[43] = 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[44] = -117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 117.977249263085*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[45] = 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 107.29099856726*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[46] = -84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[47] = 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.871740148509607)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[48] = 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 1.0)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[49] = -66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[50] = 84.322719802219*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 84.322719802219*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 84.322719802219*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 84.322719802219*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 84.322719802219*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 84.322719802219*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 84.322719802219*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[51] = -92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[52] = 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 92.7213155389851*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[53] = -84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 84.3227198022191*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[54] = 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 66.2713663754946*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[55] = -27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[56] = -11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 11.2329711914062*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[57] = 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[58] = -34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[59] = 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[60] = -38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 38.1736726414121*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[61] = 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 34.7159429657793*(epsilon - 1.0)*(epsilon - 0.871740148509607)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[62] = -27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) - 27.2841409853977*(epsilon - 1.0)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-   out_4617504037014595993[63] = 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607) + 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 1.0) + 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.871740148509607)*(eta + 1.0) + 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.591700181433142)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.871740148509607)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0) + 11.2329711914062*(epsilon - 0.871740148509607)*(epsilon - 0.591700181433142)*(epsilon - 0.209299217902479)*(epsilon + 0.209299217902479)*(epsilon + 0.591700181433142)*(epsilon + 0.871740148509607)*(epsilon + 1.0)*(eta - 0.591700181433142)*(eta - 0.209299217902479)*(eta + 0.209299217902479)*(eta + 0.591700181433142)*(eta + 0.871740148509607)*(eta + 1.0);
-
-}
-
-void closure_mapping_order7_square(int *out_2018592701291190525) {
-
-   out_2018592701291190525[0] = 9;
-   out_2018592701291190525[1] = 10;
-   out_2018592701291190525[2] = 11;
-   out_2018592701291190525[3] = 12;
-   out_2018592701291190525[4] = 13;
-   out_2018592701291190525[5] = 14;
-   out_2018592701291190525[6] = 17;
-   out_2018592701291190525[7] = 18;
-   out_2018592701291190525[8] = 19;
-   out_2018592701291190525[9] = 20;
-   out_2018592701291190525[10] = 21;
-   out_2018592701291190525[11] = 22;
-   out_2018592701291190525[12] = 25;
-   out_2018592701291190525[13] = 26;
-   out_2018592701291190525[14] = 27;
-   out_2018592701291190525[15] = 28;
-   out_2018592701291190525[16] = 29;
-   out_2018592701291190525[17] = 30;
-   out_2018592701291190525[18] = 33;
-   out_2018592701291190525[19] = 34;
-   out_2018592701291190525[20] = 35;
-   out_2018592701291190525[21] = 36;
-   out_2018592701291190525[22] = 37;
-   out_2018592701291190525[23] = 38;
-   out_2018592701291190525[24] = 41;
-   out_2018592701291190525[25] = 42;
-   out_2018592701291190525[26] = 43;
-   out_2018592701291190525[27] = 44;
-   out_2018592701291190525[28] = 45;
-   out_2018592701291190525[29] = 46;
-   out_2018592701291190525[30] = 49;
-   out_2018592701291190525[31] = 50;
-   out_2018592701291190525[32] = 51;
-   out_2018592701291190525[33] = 52;
-   out_2018592701291190525[34] = 53;
-   out_2018592701291190525[35] = 54;
-   out_2018592701291190525[36] = 1;
-   out_2018592701291190525[37] = 2;
-   out_2018592701291190525[38] = 3;
-   out_2018592701291190525[39] = 4;
-   out_2018592701291190525[40] = 5;
-   out_2018592701291190525[41] = 6;
-   out_2018592701291190525[42] = 15;
-   out_2018592701291190525[43] = 23;
-   out_2018592701291190525[44] = 31;
-   out_2018592701291190525[45] = 39;
-   out_2018592701291190525[46] = 47;
-   out_2018592701291190525[47] = 55;
-   out_2018592701291190525[48] = 62;
-   out_2018592701291190525[49] = 61;
-   out_2018592701291190525[50] = 60;
-   out_2018592701291190525[51] = 59;
-   out_2018592701291190525[52] = 58;
-   out_2018592701291190525[53] = 57;
-   out_2018592701291190525[54] = 48;
-   out_2018592701291190525[55] = 40;
-   out_2018592701291190525[56] = 32;
-   out_2018592701291190525[57] = 24;
-   out_2018592701291190525[58] = 16;
-   out_2018592701291190525[59] = 8;
-   out_2018592701291190525[60] = 0;
-   out_2018592701291190525[61] = 7;
-   out_2018592701291190525[62] = 63;
-   out_2018592701291190525[63] = 56;
-
-}
-
-void gll_weights_order7_square(double *out_6230800783185834179) {
-
-   out_6230800783185834179[0] = 0.0357142857142857;
-   out_6230800783185834179[1] = 0.210704227143503;
-   out_6230800783185834179[2] = 0.341122692483503;
-   out_6230800783185834179[3] = 0.412458794658704;
-   out_6230800783185834179[4] = 0.412458794658704;
-   out_6230800783185834179[5] = 0.341122692483503;
-   out_6230800783185834179[6] = 0.210704227143503;
-   out_6230800783185834179[7] = 0.0357142857142857;
-
-}
-
-void gll_coordinates_order7_square(double *out_8428424020652233511) {
-
-   out_8428424020652233511[0] = -1.0;
-   out_8428424020652233511[1] = -0.871740148509607;
-   out_8428424020652233511[2] = -0.591700181433142;
-   out_8428424020652233511[3] = -0.209299217902479;
-   out_8428424020652233511[4] = 0.209299217902479;
-   out_8428424020652233511[5] = 0.591700181433142;
-   out_8428424020652233511[6] = 0.871740148509607;
-   out_8428424020652233511[7] = 1.0;
-
-}
@@ -1,381 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-#include "Element/HyperCube/Autogen/order8_square.h"
-#include <math.h>
-
-void interpolate_order8_square(double epsilon, double eta, double *out_5857460273485771890) {
-
-   out_5857460273485771890[0] = 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_5857460273485771890[1] = -76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_5857460273485771890[2] = 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_5857460273485771890[3] = -110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_5857460273485771890[4] = 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_5857460273485771890[5] = -110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_5857460273485771890[6] = 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_5857460273485771890[7] = -76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_5857460273485771890[8] = 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_5857460273485771890[9] = -76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_5857460273485771890[10] = 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_5857460273485771890[11] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_5857460273485771890[12] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_5857460273485771890[13] = -278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_5857460273485771890[14] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_5857460273485771890[15] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_5857460273485771890[16] = 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_5857460273485771890[17] = -76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_5857460273485771890[18] = 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[19] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[20] = 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[21] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[22] = 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[23] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[24] = 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[25] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[26] = 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[27] = -110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[28] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[29] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[30] = 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[31] = -402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[32] = 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[33] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[34] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[35] = -110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[36] = 114.112723214286*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[37] = -278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[38] = 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[39] = -402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[40] = 417.326530612245*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[41] = -402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[42] = 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[43] = -278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[44] = 114.112723214286*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[45] = -110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[46] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[47] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[48] = 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[49] = -402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[50] = 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[51] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[52] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[53] = -110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[54] = 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[55] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[56] = 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[57] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[58] = 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[59] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[60] = 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[61] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[62] = 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[63] = -76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[64] = 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[65] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[66] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[67] = -278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[68] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[69] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[70] = 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[71] = -76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[72] = 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[73] = -76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[74] = 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[75] = -110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[76] = 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[77] = -110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[78] = 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[79] = -76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_5857460273485771890[80] = 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-
-}
-
-void interpolate_eps_derivative_order8_square(double epsilon, double eta, double *out_3539342882259231955) {
-
-   out_3539342882259231955[0] = 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_3539342882259231955[1] = -76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_3539342882259231955[2] = 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_3539342882259231955[3] = -110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_3539342882259231955[4] = 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 114.112723214286*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_3539342882259231955[5] = -110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_3539342882259231955[6] = 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_3539342882259231955[7] = -76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_3539342882259231955[8] = 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_3539342882259231955[9] = -76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964877*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_3539342882259231955[10] = 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_3539342882259231955[11] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_3539342882259231955[12] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_3539342882259231955[13] = -278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_3539342882259231955[14] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_3539342882259231955[15] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_3539342882259231955[16] = 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_3539342882259231955[17] = -76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964878*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_3539342882259231955[18] = 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[19] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[20] = 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[21] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[22] = 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[23] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[24] = 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[25] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[26] = 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[27] = -110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[28] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[29] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[30] = 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[31] = -402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[32] = 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[33] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[34] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[35] = -110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[36] = 114.112723214286*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[37] = -278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[38] = 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[39] = -402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[40] = 417.326530612245*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 417.326530612245*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 417.326530612245*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 417.326530612245*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 417.326530612245*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 417.326530612245*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 417.326530612245*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 417.326530612245*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[41] = -402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[42] = 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[43] = -278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[44] = 114.112723214286*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[45] = -110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[46] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[47] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[48] = 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[49] = -402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[50] = 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[51] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[52] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[53] = -110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[54] = 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[55] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[56] = 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[57] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[58] = 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[59] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[60] = 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[61] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[62] = 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[63] = -76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[64] = 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[65] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[66] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[67] = -278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[68] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[69] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[70] = 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[71] = -76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964878*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[72] = 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[73] = -76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[74] = 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[75] = -110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[76] = 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[77] = -110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[78] = 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[79] = -76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_3539342882259231955[80] = 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-
-}
-
-void interpolate_eta_derivative_order8_square(double epsilon, double eta, double *out_1604135558802125817) {
-
-   out_1604135558802125817[0] = 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_1604135558802125817[1] = -76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_1604135558802125817[2] = 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_1604135558802125817[3] = -110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_1604135558802125817[4] = 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 114.112723214286*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_1604135558802125817[5] = -110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_1604135558802125817[6] = 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_1604135558802125817[7] = -76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_1604135558802125817[8] = 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146);
-   out_1604135558802125817[9] = -76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964877*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_1604135558802125817[10] = 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_1604135558802125817[11] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_1604135558802125817[12] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_1604135558802125817[13] = -278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 278.534010867155*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_1604135558802125817[14] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_1604135558802125817[15] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_1604135558802125817[16] = 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_1604135558802125817[17] = -76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964878*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0);
-   out_1604135558802125817[18] = 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[19] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[20] = 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[21] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[22] = 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[23] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[24] = 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[25] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[26] = 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[27] = -110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[28] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[29] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[30] = 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[31] = -402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[32] = 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[33] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[34] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[35] = -110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[36] = 114.112723214286*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 114.112723214286*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[37] = -278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[38] = 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[39] = -402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[40] = 417.326530612245*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 417.326530612245*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 417.326530612245*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 417.326530612245*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 417.326530612245*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 417.326530612245*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 417.326530612245*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 417.326530612245*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[41] = -402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[42] = 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[43] = -278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[44] = 114.112723214286*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 114.112723214286*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[45] = -110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[46] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[47] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[48] = 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[49] = -402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 402.98801804995*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[50] = 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 389.142148364199*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[51] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[52] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[53] = -110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[54] = 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[55] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[56] = 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[57] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[58] = 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 358.746040396697*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[59] = -346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 346.420237387348*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[60] = 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 308.388544844008*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[61] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[62] = 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[63] = -76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[64] = 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[65] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[66] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[67] = -278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 278.534010867155*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[68] = 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 268.964134233657*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[69] = -239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 239.43594807598*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[70] = 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 185.900462872389*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[71] = -76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964878*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964878*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[72] = 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[73] = -76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[74] = 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[75] = -110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[76] = 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 114.112723214286*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[77] = -110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 110.192036185533*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[78] = 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 98.0946204209718*epsilon*(epsilon - 1.0)*(epsilon - 0.89975799541146)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[79] = -76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*eta*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) - 76.1616435964877*epsilon*(epsilon - 1.0)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-   out_1604135558802125817[80] = 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*eta*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0) + 31.2026977539062*epsilon*(epsilon - 0.89975799541146)*(epsilon - 0.677186279510738)*(epsilon - 0.363117463826178)*(epsilon + 0.363117463826178)*(epsilon + 0.677186279510738)*(epsilon + 0.89975799541146)*(epsilon + 1.0)*(eta - 0.89975799541146)*(eta - 0.677186279510738)*(eta - 0.363117463826178)*(eta + 0.363117463826178)*(eta + 0.677186279510738)*(eta + 0.89975799541146)*(eta + 1.0);
-
-}
-
-void closure_mapping_order8_square(int *out_1888811593364008808) {
-
-   out_1888811593364008808[0] = 10;
-   out_1888811593364008808[1] = 11;
-   out_1888811593364008808[2] = 12;
-   out_1888811593364008808[3] = 13;
-   out_1888811593364008808[4] = 14;
-   out_1888811593364008808[5] = 15;
-   out_1888811593364008808[6] = 16;
-   out_1888811593364008808[7] = 19;
-   out_1888811593364008808[8] = 20;
-   out_1888811593364008808[9] = 21;
-   out_1888811593364008808[10] = 22;
-   out_1888811593364008808[11] = 23;
-   out_1888811593364008808[12] = 24;
-   out_1888811593364008808[13] = 25;
-   out_1888811593364008808[14] = 28;
-   out_1888811593364008808[15] = 29;
-   out_1888811593364008808[16] = 30;
-   out_1888811593364008808[17] = 31;
-   out_1888811593364008808[18] = 32;
-   out_1888811593364008808[19] = 33;
-   out_1888811593364008808[20] = 34;
-   out_1888811593364008808[21] = 37;
-   out_1888811593364008808[22] = 38;
-   out_1888811593364008808[23] = 39;
-   out_1888811593364008808[24] = 40;
-   out_1888811593364008808[25] = 41;
-   out_1888811593364008808[26] = 42;
-   out_1888811593364008808[27] = 43;
-   out_1888811593364008808[28] = 46;
-   out_1888811593364008808[29] = 47;
-   out_1888811593364008808[30] = 48;
-   out_1888811593364008808[31] = 49;
-   out_1888811593364008808[32] = 50;
-   out_1888811593364008808[33] = 51;
-   out_1888811593364008808[34] = 52;
-   out_1888811593364008808[35] = 55;
-   out_1888811593364008808[36] = 56;
-   out_1888811593364008808[37] = 57;
-   out_1888811593364008808[38] = 58;
-   out_1888811593364008808[39] = 59;
-   out_1888811593364008808[40] = 60;
-   out_1888811593364008808[41] = 61;
-   out_1888811593364008808[42] = 64;
-   out_1888811593364008808[43] = 65;
-   out_1888811593364008808[44] = 66;
-   out_1888811593364008808[45] = 67;
-   out_1888811593364008808[46] = 68;
-   out_1888811593364008808[47] = 69;
-   out_1888811593364008808[48] = 70;
-   out_1888811593364008808[49] = 1;
-   out_1888811593364008808[50] = 2;
-   out_1888811593364008808[51] = 3;
-   out_1888811593364008808[52] = 4;
-   out_1888811593364008808[53] = 5;
-   out_1888811593364008808[54] = 6;
-   out_1888811593364008808[55] = 7;
-   out_1888811593364008808[56] = 17;
-   out_1888811593364008808[57] = 26;
-   out_1888811593364008808[58] = 35;
-   out_1888811593364008808[59] = 44;
-   out_1888811593364008808[60] = 53;
-   out_1888811593364008808[61] = 62;
-   out_1888811593364008808[62] = 71;
-   out_1888811593364008808[63] = 79;
-   out_1888811593364008808[64] = 78;
-   out_1888811593364008808[65] = 77;
-   out_1888811593364008808[66] = 76;
-   out_1888811593364008808[67] = 75;
-   out_1888811593364008808[68] = 74;
-   out_1888811593364008808[69] = 73;
-   out_1888811593364008808[70] = 63;
-   out_1888811593364008808[71] = 54;
-   out_1888811593364008808[72] = 45;
-   out_1888811593364008808[73] = 36;
-   out_1888811593364008808[74] = 27;
-   out_1888811593364008808[75] = 18;
-   out_1888811593364008808[76] = 9;
-   out_1888811593364008808[77] = 0;
-   out_1888811593364008808[78] = 8;
-   out_1888811593364008808[79] = 80;
-   out_1888811593364008808[80] = 72;
-
-}
-
-void gll_weights_order8_square(double *out_3995493972137613764) {
-
-   out_3995493972137613764[0] = 0.0277777777777778;
-   out_3995493972137613764[1] = 0.165495361560806;
-   out_3995493972137613764[2] = 0.274538712500162;
-   out_3995493972137613764[3] = 0.346428510973046;
-   out_3995493972137613764[4] = 0.371519274376417;
-   out_3995493972137613764[5] = 0.346428510973046;
-   out_3995493972137613764[6] = 0.274538712500162;
-   out_3995493972137613764[7] = 0.165495361560806;
-   out_3995493972137613764[8] = 0.0277777777777778;
-
-}
-
-void gll_coordinates_order8_square(double *out_4420238649482325602) {
-
-   out_4420238649482325602[0] = -1.0;
-   out_4420238649482325602[1] = -0.89975799541146;
-   out_4420238649482325602[2] = -0.677186279510738;
-   out_4420238649482325602[3] = -0.363117463826178;
-   out_4420238649482325602[4] = 0.0;
-   out_4420238649482325602[5] = 0.363117463826178;
-   out_4420238649482325602[6] = 0.677186279510738;
-   out_4420238649482325602[7] = 0.89975799541146;
-   out_4420238649482325602[8] = 1.0;
-
-}
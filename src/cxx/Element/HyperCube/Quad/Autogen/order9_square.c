@@ -1,459 +0,0 @@
-/******************************************************************************
- *                     Code generated with sympy 0.7.6.1                      *
- *                                                                            *
- *              See http://www.sympy.org/ for more information.               *
- *                                                                            *
- *                       This file is part of 'project'                       *
- ******************************************************************************/
-#include <Element/HyperCube/Autogen/order9_square.h>
-#include <math.h>
-
-void interpolate_order9_square(double epsilon, double eta, double *out_5708876025817303321) {
-
-   out_5708876025817303321[0] = 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_5708876025817303321[1] = -220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_5708876025817303321[2] = 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_5708876025817303321[3] = -326.903378732421*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_5708876025817303321[4] = 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_5708876025817303321[5] = -346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_5708876025817303321[6] = 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_5708876025817303321[7] = -286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_5708876025817303321[8] = 220.862039175551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_5708876025817303321[9] = -90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_5708876025817303321[10] = -220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_5708876025817303321[11] = 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_5708876025817303321[12] = -702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_5708876025817303321[13] = 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_5708876025817303321[14] = -847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_5708876025817303321[15] = 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_5708876025817303321[16] = -800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_5708876025817303321[17] = 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_5708876025817303321[18] = -540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_5708876025817303321[19] = 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_5708876025817303321[20] = 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[21] = -702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[22] = 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[23] = -1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[24] = 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[25] = -1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[26] = 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[27] = -912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[28] = 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[29] = -286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[30] = -326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[31] = 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[32] = -1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[33] = 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[34] = -1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[35] = 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[36] = -1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[37] = 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[38] = -800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[39] = 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[40] = 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[41] = -847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[42] = 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[43] = -1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[44] = 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[45] = -1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[46] = 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[47] = -1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[48] = 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[49] = -346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[50] = -346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[51] = 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[52] = -1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[53] = 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[54] = -1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[55] = 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[56] = -1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[57] = 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[58] = -847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[59] = 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[60] = 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[61] = -800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[62] = 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[63] = -1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[64] = 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[65] = -1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[66] = 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[67] = -1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[68] = 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[69] = -326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[70] = -286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[71] = 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[72] = -912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[73] = 1039.94435805362*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[74] = -1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[75] = 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[76] = -1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[77] = 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[78] = -702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[79] = 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[80] = 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[81] = -540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[82] = 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[83] = -800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[84] = 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[85] = -847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[86] = 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[87] = -702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[88] = 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[89] = -220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[90] = -90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[91] = 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[92] = -286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[93] = 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[94] = -346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[95] = 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[96] = -326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[97] = 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[98] = -220.86203917555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_5708876025817303321[99] = 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-
-}
-
-void interpolate_eps_derivative_order9_square(double epsilon, double eta, double *out_7338201687422862883) {
-
-   out_7338201687422862883[0] = 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7338201687422862883[1] = -220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 220.862039175551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7338201687422862883[2] = 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7338201687422862883[3] = -326.903378732421*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 326.903378732421*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 326.903378732421*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 326.903378732421*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 326.903378732421*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 326.903378732421*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 326.903378732421*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 326.903378732421*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 326.903378732421*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7338201687422862883[4] = 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7338201687422862883[5] = -346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7338201687422862883[6] = 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7338201687422862883[7] = -286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7338201687422862883[8] = 220.862039175551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 220.862039175551*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7338201687422862883[9] = -90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 90.1757965087891*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7338201687422862883[10] = -220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7338201687422862883[11] = 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 540.943825697486*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7338201687422862883[12] = -702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 702.605866110773*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7338201687422862883[13] = 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 800.664364890667*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7338201687422862883[14] = -847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 847.92872606555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7338201687422862883[15] = 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 847.92872606555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7338201687422862883[16] = -800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 800.664364890667*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7338201687422862883[17] = 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 702.605866110772*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7338201687422862883[18] = -540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 540.943825697486*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7338201687422862883[19] = 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 220.86203917555*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7338201687422862883[20] = 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[21] = -702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[22] = 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[23] = -1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[24] = 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[25] = -1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[26] = 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[27] = -912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[28] = 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[29] = -286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[30] = -326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[31] = 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[32] = -1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[33] = 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[34] = -1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[35] = 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[36] = -1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[37] = 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[38] = -800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[39] = 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[40] = 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[41] = -847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[42] = 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[43] = -1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[44] = 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[45] = -1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[46] = 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[47] = -1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[48] = 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[49] = -346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[50] = -346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[51] = 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.92872606555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[52] = -1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[53] = 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[54] = -1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[55] = 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[56] = -1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[57] = 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[58] = -847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[59] = 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.200952146729*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[60] = 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[61] = -800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[62] = 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[63] = -1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[64] = 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[65] = -1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[66] = 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[67] = -1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[68] = 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[69] = -326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[70] = -286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[71] = 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110772*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[72] = -912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[73] = 1039.94435805362*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805362*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805362*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805362*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805362*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805362*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805362*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805362*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805362*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[74] = -1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[75] = 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[76] = -1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[77] = 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[78] = -702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[79] = 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[80] = 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[81] = -540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 540.943825697486*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[82] = 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[83] = -800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[84] = 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[85] = -847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.92872606555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[86] = 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[87] = -702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110772*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110772*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[88] = 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 540.943825697486*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[89] = -220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.862039175551*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[90] = -90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[91] = 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.86203917555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[92] = -286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[93] = 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[94] = -346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[95] = 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[96] = -326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[97] = 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[98] = -220.86203917555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.86203917555*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7338201687422862883[99] = 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 90.1757965087891*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-
-}
-
-void interpolate_eta_derivative_order9_square(double epsilon, double eta, double *out_7489494862605754493) {
-
-   out_7489494862605754493[0] = 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) + 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) + 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7489494862605754493[1] = -220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) - 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) - 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7489494862605754493[2] = 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7489494862605754493[3] = -326.903378732421*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) - 326.903378732421*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) - 326.903378732421*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 326.903378732421*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 326.903378732421*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 326.903378732421*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 326.903378732421*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 326.903378732421*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 326.903378732421*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7489494862605754493[4] = 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7489494862605754493[5] = -346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7489494862605754493[6] = 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7489494862605754493[7] = -286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7489494862605754493[8] = 220.862039175551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7489494862605754493[9] = -90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) - 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) - 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459);
-   out_7489494862605754493[10] = -220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7489494862605754493[11] = 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7489494862605754493[12] = -702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7489494862605754493[13] = 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7489494862605754493[14] = -847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7489494862605754493[15] = 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7489494862605754493[16] = -800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7489494862605754493[17] = 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7489494862605754493[18] = -540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7489494862605754493[19] = 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505) + 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) + 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) + 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 220.86203917555*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0);
-   out_7489494862605754493[20] = 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[21] = -702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[22] = 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[23] = -1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[24] = 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[25] = -1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[26] = 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[27] = -912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[28] = 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[29] = -286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459) - 286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 1.0) - 286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[30] = -326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[31] = 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[32] = -1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[33] = 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[34] = -1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[35] = 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[36] = -1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[37] = 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[38] = -800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[39] = 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 1.0) + 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[40] = 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[41] = -847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[42] = 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[43] = -1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[44] = 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[45] = -1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[46] = 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[47] = -1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[48] = 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[49] = -346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[50] = -346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.200952146729*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[51] = 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[52] = -1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[53] = 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[54] = -1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[55] = 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1329.12714838754*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[56] = -1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[57] = 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[58] = -847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.928726065551*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[59] = 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.200952146729*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[60] = 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[61] = -800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[62] = 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[63] = -1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[64] = 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[65] = -1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1255.0403252176*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[66] = 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1185.08317269209*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[67] = -1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[68] = 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[69] = -326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[70] = -286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[71] = 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[72] = -912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[73] = 1039.94435805362*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 1039.94435805362*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 1039.94435805362*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805362*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805362*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805362*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805362*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805362*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1039.94435805362*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[74] = -1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[75] = 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 1101.33375902632*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[76] = -1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 1039.94435805361*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[77] = 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 912.580899609597*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[78] = -702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110773*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[79] = 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.919533908166459)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[80] = 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.862039175551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[81] = -540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 540.943825697486*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[82] = 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 702.605866110773*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[83] = -800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[84] = 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 847.928726065551*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[85] = -847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 847.92872606555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[86] = 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 800.664364890667*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[87] = -702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 702.605866110772*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[88] = 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 540.943825697486*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[89] = -220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 1.0)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.862039175551*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[90] = -90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 90.1757965087891*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[91] = 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 220.86203917555*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[92] = -286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 286.867058933233*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[93] = 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[94] = -346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[95] = 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 346.20095214673*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[96] = -326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 326.90337873242*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[97] = 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 286.867058933232*(epsilon - 1.0)*(epsilon - 0.919533908166459)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[98] = -220.86203917555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) - 220.86203917555*(epsilon - 1.0)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-   out_7489494862605754493[99] = 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459) + 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 1.0) + 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.919533908166459)*(eta + 1.0) + 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.738773865105505)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.919533908166459)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0) + 90.1757965087891*(epsilon - 0.919533908166459)*(epsilon - 0.738773865105505)*(epsilon - 0.477924949810444)*(epsilon - 0.165278957666387)*(epsilon + 0.165278957666387)*(epsilon + 0.477924949810444)*(epsilon + 0.738773865105505)*(epsilon + 0.919533908166459)*(epsilon + 1.0)*(eta - 0.738773865105505)*(eta - 0.477924949810444)*(eta - 0.165278957666387)*(eta + 0.165278957666387)*(eta + 0.477924949810444)*(eta + 0.738773865105505)*(eta + 0.919533908166459)*(eta + 1.0);
-
-}
-
-void closure_mapping_order9_square(int *out_88682657526787489) {
-
-   out_88682657526787489[0] = 11;
-   out_88682657526787489[1] = 12;
-   out_88682657526787489[2] = 13;
-   out_88682657526787489[3] = 14;
-   out_88682657526787489[4] = 15;
-   out_88682657526787489[5] = 16;
-   out_88682657526787489[6] = 17;
-   out_88682657526787489[7] = 18;
-   out_88682657526787489[8] = 21;
-   out_88682657526787489[9] = 22;
-   out_88682657526787489[10] = 23;
-   out_88682657526787489[11] = 24;
-   out_88682657526787489[12] = 25;
-   out_88682657526787489[13] = 26;
-   out_88682657526787489[14] = 27;
-   out_88682657526787489[15] = 28;
-   out_88682657526787489[16] = 31;
-   out_88682657526787489[17] = 32;
-   out_88682657526787489[18] = 33;
-   out_88682657526787489[19] = 34;
-   out_88682657526787489[20] = 35;
-   out_88682657526787489[21] = 36;
-   out_88682657526787489[22] = 37;
-   out_88682657526787489[23] = 38;
-   out_88682657526787489[24] = 41;
-   out_88682657526787489[25] = 42;
-   out_88682657526787489[26] = 43;
-   out_88682657526787489[27] = 44;
-   out_88682657526787489[28] = 45;
-   out_88682657526787489[29] = 46;
-   out_88682657526787489[30] = 47;
-   out_88682657526787489[31] = 48;
-   out_88682657526787489[32] = 51;
-   out_88682657526787489[33] = 52;
-   out_88682657526787489[34] = 53;
-   out_88682657526787489[35] = 54;
-   out_88682657526787489[36] = 55;
-   out_88682657526787489[37] = 56;
-   out_88682657526787489[38] = 57;
-   out_88682657526787489[39] = 58;
-   out_88682657526787489[40] = 61;
-   out_88682657526787489[41] = 62;
-   out_88682657526787489[42] = 63;
-   out_88682657526787489[43] = 64;
-   out_88682657526787489[44] = 65;
-   out_88682657526787489[45] = 66;
-   out_88682657526787489[46] = 67;
-   out_88682657526787489[47] = 68;
-   out_88682657526787489[48] = 71;
-   out_88682657526787489[49] = 72;
-   out_88682657526787489[50] = 73;
-   out_88682657526787489[51] = 74;
-   out_88682657526787489[52] = 75;
-   out_88682657526787489[53] = 76;
-   out_88682657526787489[54] = 77;
-   out_88682657526787489[55] = 78;
-   out_88682657526787489[56] = 81;
-   out_88682657526787489[57] = 82;
-   out_88682657526787489[58] = 83;
-   out_88682657526787489[59] = 84;
-   out_88682657526787489[60] = 85;
-   out_88682657526787489[61] = 86;
-   out_88682657526787489[62] = 87;
-   out_88682657526787489[63] = 88;
-   out_88682657526787489[64] = 1;
-   out_88682657526787489[65] = 2;
-   out_88682657526787489[66] = 3;
-   out_88682657526787489[67] = 4;
-   out_88682657526787489[68] = 5;
-   out_88682657526787489[69] = 6;
-   out_88682657526787489[70] = 7;
-   out_88682657526787489[71] = 8;
-   out_88682657526787489[72] = 19;
-   out_88682657526787489[73] = 29;
-   out_88682657526787489[74] = 39;
-   out_88682657526787489[75] = 49;
-   out_88682657526787489[76] = 59;
-   out_88682657526787489[77] = 69;
-   out_88682657526787489[78] = 79;
-   out_88682657526787489[79] = 89;
-   out_88682657526787489[80] = 98;
-   out_88682657526787489[81] = 97;
-   out_88682657526787489[82] = 96;
-   out_88682657526787489[83] = 95;
-   out_88682657526787489[84] = 94;
-   out_88682657526787489[85] = 93;
-   out_88682657526787489[86] = 92;
-   out_88682657526787489[87] = 91;
-   out_88682657526787489[88] = 80;
-   out_88682657526787489[89] = 70;
-   out_88682657526787489[90] = 60;
-   out_88682657526787489[91] = 50;
-   out_88682657526787489[92] = 40;
-   out_88682657526787489[93] = 30;
-   out_88682657526787489[94] = 20;
-   out_88682657526787489[95] = 10;
-   out_88682657526787489[96] = 0;
-   out_88682657526787489[97] = 9;
-   out_88682657526787489[98] = 99;
-   out_88682657526787489[99] = 90;
-
-}
-
-void gll_weights_order9_square(double *out_3469424585499671537) {
-
-   out_3469424585499671537[0] = 0.0222222222222222;
-   out_3469424585499671537[1] = 0.13330599085106;
-   out_3469424585499671537[2] = 0.224889342063122;
-   out_3469424585499671537[3] = 0.292042683679682;
-   out_3469424585499671537[4] = 0.327539761183897;
-   out_3469424585499671537[5] = 0.327539761183897;
-   out_3469424585499671537[6] = 0.292042683679682;
-   out_3469424585499671537[7] = 0.224889342063122;
-   out_3469424585499671537[8] = 0.13330599085106;
-   out_3469424585499671537[9] = 0.0222222222222222;
-
-}
-
-void gll_coordinates_order9_square(double *out_7097320842538396498) {
-
-   out_7097320842538396498[0] = -1.0;
-   out_7097320842538396498[1] = -0.919533908166459;
-   out_7097320842538396498[2] = -0.738773865105505;
-   out_7097320842538396498[3] = -0.477924949810444;
-   out_7097320842538396498[4] = -0.165278957666387;
-   out_7097320842538396498[5] = 0.165278957666387;
-   out_7097320842538396498[6] = 0.477924949810444;
-   out_7097320842538396498[7] = 0.738773865105505;
-   out_7097320842538396498[8] = 0.919533908166459;
-   out_7097320842538396498[9] = 1.0;
-
-}
@@ -1,14 +1,16 @@
+#include <cmath>
+#include <limits>
 #include <Mesh/Mesh.h>
 #include <Source/Source.h>
 #include <Utilities/Options.h>
+#include <Utilities/Scratch.h>
+#include <Utilities/SmallGemm.h>
 #include <Model/ExodusModel.h>
 #include <Receiver/Receiver.h>
 #include <Element/HyperCube/TensorQuad.h>
 #include <Element/HyperCube/QuadP1.h>
 
-extern "C" {
-#include <Element/HyperCube/Autogen/quad_autogen.h>
-}
+#include <Element/HyperCube/Gll.h>
 
 using namespace Eigen;
 
@@ -23,158 +25,245 @@ TensorQuad<ConcreteShape>::TensorQuad(std::unique_ptr<Options> const &options) {
 
 
   mPlyOrd = options->PolynomialOrder();
+  mModElm = -1;
   mNumDofVtx = 1;
   mNumDofEdg = mPlyOrd - 1;
   mNumDofFac = (mPlyOrd - 1) * (mPlyOrd - 1);
   mNumDofVol = 0;
 
-  mGrd = TensorQuad<ConcreteShape>::setupGradientOperator(mPlyOrd);
-  mIntCrdR = TensorQuad<ConcreteShape>::GllPointsForOrder(mPlyOrd);
-  mIntCrdS = TensorQuad<ConcreteShape>::GllPointsForOrder(mPlyOrd);
-  mIntWgtR = TensorQuad<ConcreteShape>::GllIntegrationWeightsForOrder(mPlyOrd);
-  mIntWgtS = TensorQuad<ConcreteShape>::GllIntegrationWeightsForOrder(mPlyOrd);
+  /* Integration points and gradient operator (shared by all elements of this order). */
+  mRef = ReferenceForOrder(mPlyOrd);
 
-  mNumIntPtsS = mIntCrdS.size();
-  mNumIntPtsR = mIntWgtR.size();
+  mNumIntPtsS = mRef->mIntCrdS.size();
+  mNumIntPtsR = mRef->mIntWgtR.size();
   mNumIntPnt = mNumIntPtsS * mNumIntPtsR;
-  /* Identity closure for tensor basis. */
-  mClsMap = IntVec::LinSpaced(mNumIntPnt, 0, mNumIntPnt - 1);
+
+  /* Store the Jacobians (set up with the vertices), unless memory is tight. */
+  mPrecomputeGeometry = !options->LowMemoryGeometry();
+  mAffine = false;
 
   mDetJac.setZero(mNumIntPnt);
-  mParWork.setZero(mNumIntPnt);
-  mStiffWork.setZero(mNumIntPnt);
-  mGradWork.setZero(mNumIntPnt, mNumDim);
+
+  /* Integrals over r dr dz, with the reference chosen once the element knows whether it lies on the axis. */
+  mAxisymmetric = options->Axisymmetric();
+  mAxiEdg = -1;
+
+  /* Select the tensor kernels for this order (N = order + 1 points per dimension). */
+  const bool small_gemm = options->SmallGemm();
+  if (mPlyOrd == 1) { selectKernels<2>(small_gemm); }
+  else if (mPlyOrd == 2) { selectKernels<3>(small_gemm); }
+  else if (mPlyOrd == 3) { selectKernels<4>(small_gemm); }
+  else if (mPlyOrd == 4) { selectKernels<5>(small_gemm); }
+  else if (mPlyOrd == 5) { selectKernels<6>(small_gemm); }
+  else if (mPlyOrd == 6) { selectKernels<7>(small_gemm); }
+  else if (mPlyOrd == 7) { selectKernels<8>(small_gemm); }
+  else if (mPlyOrd == 8) { selectKernels<9>(small_gemm); }
+  else if (mPlyOrd == 9) { selectKernels<10>(small_gemm); }
+  else if (mPlyOrd == 10) { selectKernels<11>(small_gemm); }
+
+}
+
+template<typename ConcreteShape>
+std::shared_ptr<const QuadReference> TensorQuad<ConcreteShape>::ReferenceForOrder(const PetscInt order,
+                                                                                 const PetscInt axis_edge) {
+
+  /* Elements are set up serially, so the cache needs no locking. */
+  static std::map<std::pair<PetscInt, PetscInt>, std::shared_ptr<const QuadReference>> references;
+  const auto key = std::make_pair(order, axis_edge);
+  if (references.count(key)) { return references[key]; }
+
+  std::shared_ptr<QuadReference> ref(new QuadReference);
+  ref->mIntCrdR = TensorQuad<ConcreteShape>::GllPointsForOrder(order);
+  ref->mIntCrdS = TensorQuad<ConcreteShape>::GllPointsForOrder(order);
+  ref->mIntWgtR = TensorQuad<ConcreteShape>::GllIntegrationWeightsForOrder(order);
+  ref->mIntWgtS = TensorQuad<ConcreteShape>::GllIntegrationWeightsForOrder(order);
+
+  /* Across the axis (r = -1 for edge 3, s = -1 for edge 0, and mirrored for edges 1 and 2), the GLJ points of
+   * the weight (1 + x), whose quadrature does not vanish on the axis. */
+  const PetscInt num_pts = ref->mIntCrdR.size();
+  RealVec ratio_r = RealVec::Ones(num_pts), ratio_s = RealVec::Ones(num_pts);
+  if (axis_edge >= 0) {
+    RealVec glj = Gll::JacobiPoints(order), glj_wgt = Gll::JacobiWeights(order);
+    if (axis_edge == 1 || axis_edge == 2) { glj = -glj.reverse().eval(); glj_wgt = glj_wgt.reverse().eval(); }
+    const bool across_r = axis_edge == 1 || axis_edge == 3;
+    (across_r ? ref->mIntCrdR : ref->mIntCrdS) = glj;
+    (across_r ? ratio_r : ratio_s) = glj_wgt.cwiseQuotient(ref->mIntWgtR);
+    ref->mWgtRatio = Gll::TensorProduct(ratio_r, ratio_s);
+  }
+  ref->mGrdR = Gll::DerivativeMatrix(ref->mIntCrdR);
+  ref->mGrdS = Gll::DerivativeMatrix(ref->mIntCrdS);
+
+  /* Identity closure for tensor basis. */
+  PetscInt num_int_pnt = ref->mIntCrdR.size() * ref->mIntCrdS.size();
+  ref->mClsMap = IntVec::LinSpaced(num_int_pnt, 0, num_int_pnt - 1);
+
+  /* Vertex interpolation and geometry derivatives at the GLL points, the same for all elements. */
+  const PetscInt num_pts_r = ref->mIntCrdR.size();
+  ref->mVtxInt.resize(num_int_pnt, mNumVtx);
+  ref->mVtxDer.resize(mNumDim * num_int_pnt, mNumVtx);
+  for (PetscInt s_ind = 0; s_ind < ref->mIntCrdS.size(); s_ind++) {
+    for (PetscInt r_ind = 0; r_ind < num_pts_r; r_ind++) {
+      const PetscInt index = r_ind + s_ind * num_pts_r;
+      const PetscReal r = ref->mIntCrdR(r_ind), s = ref->mIntCrdS(s_ind);
+      ref->mVtxInt.row(index) = ConcreteShape::interpolateAtPoint(r, s).transpose();
+      ref->mVtxDer.template middleRows<2>(mNumDim * index) = ConcreteShape::shapeDerivativesAtPoint(r, s);
+    }
+  }
+
+  references[key] = ref;
+  return ref;
+
+}
+
+template<typename ConcreteShape>
+template<int N>
+void TensorQuad<ConcreteShape>::referenceGradientKernel(const PetscReal *grd_r, const PetscReal *grd_s,
+                                                        const PetscReal *field, PetscReal *grad) {
+
+  const int N2 = N * N;
+  for (int s_ind = 0; s_ind < N; s_ind++) {
+    for (int r_ind = 0; r_ind < N; r_ind++) {
+      PetscReal dr = 0, ds = 0;
+      for (int i = 0; i < N; i++) {
+        dr += grd_r[r_ind + i * N] * field[i + s_ind * N];
+        ds += grd_s[s_ind + i * N] * field[r_ind + i * N];
+      }
+      grad[r_ind + s_ind * N] = dr; grad[r_ind + s_ind * N + N2] = ds;
+    }
+  }
+
+}
+
+template<typename ConcreteShape>
+template<int N>
+void TensorQuad<ConcreteShape>::gradTestAndIntegrateKernel(const PetscReal *grd_r, const PetscReal *grd_s,
+                                                           const PetscReal *wgt, const PetscReal *flux,
+                                                           PetscReal *out) {
+
+  const int N2 = N * N;
+  const PetscReal *fx = flux, *fy = flux + N2;
+  for (int s_ind = 0; s_ind < N; s_ind++) {
+    for (int r_ind = 0; r_ind < N; r_ind++) {
+      PetscReal xr = 0, xs = 0, yr = 0, ys = 0;
+      for (int i = 0; i < N; i++) {
+        PetscInt r_index = i + s_ind * N;
+        PetscInt s_index = r_ind + i * N;
+        xr += fx[r_index] * grd_r[i + r_ind * N] * wgt[i];
+        xs += fx[s_index] * grd_s[i + s_ind * N] * wgt[i];
+        yr += fy[r_index] * grd_r[i + r_ind * N] * wgt[i];
+        ys += fy[s_index] * grd_s[i + s_ind * N] * wgt[i];
+      }
+      PetscInt index = r_ind + s_ind * N;
+      out[index] = xr * wgt[s_ind]; out[index + N2] = xs * wgt[r_ind];
+      out[index + 2 * N2] = yr * wgt[s_ind]; out[index + 3 * N2] = ys * wgt[r_ind];
+    }
+  }
+
+}
+
+template<typename ConcreteShape>
+template<int N>
+void TensorQuad<ConcreteShape>::selectKernels(const bool small_gemm) {
+  if (small_gemm) {
+    mRefGradKernel = &referenceGradientGemmKernel<N>; mGradTestKernel = &gradTestAndIntegrateGemmKernel<N>;
+  } else {
+    mRefGradKernel = &referenceGradientKernel<N>; mGradTestKernel = &gradTestAndIntegrateKernel<N>;
+  }
+}
+
+template<typename ConcreteShape>
+template<int N>
+void TensorQuad<ConcreteShape>::referenceGradientGemmKernel(const PetscReal *grd_r, const PetscReal *grd_s,
+                                                            const PetscReal *field, PetscReal *grad) {
+
+  static const SmallGemm product(N, N, N);
+  PetscReal grd_s_t[N * N];
+  for (int i = 0; i < N; i++) {
+    for (int j = 0; j < N; j++) { grd_s_t[i + j * N] = grd_s[j + i * N]; }
+  }
+  product(grd_r, field, grad);
+  product(field, grd_s_t, grad + N * N);
+
+}
+
+template<typename ConcreteShape>
+template<int N>
+void TensorQuad<ConcreteShape>::gradTestAndIntegrateGemmKernel(const PetscReal *grd_r, const PetscReal *grd_s,
+                                                               const PetscReal *wgt, const PetscReal *flux,
+                                                               PetscReal *out) {
+
+  const int N2 = N * N;
+  static const SmallGemm product(N, N, N);
+
+  /* The weighted derivatives along s (grd_s(i, s) * wgt(i)), and the transpose of those along r. */
+  PetscReal grd_r_t[N * N], grd_s_wgt[N * N];
+  for (int j = 0; j < N; j++) {
+    for (int i = 0; i < N; i++) {
+      grd_r_t[j + i * N] = grd_r[i + j * N] * wgt[i]; grd_s_wgt[i + j * N] = grd_s[i + j * N] * wgt[i];
+    }
+  }
+  const PetscReal *fx = flux, *fy = flux + N2;
+  product(grd_r_t, fx, out); product(fx, grd_s_wgt, out + N2);
+  product(grd_r_t, fy, out + 2 * N2); product(fy, grd_s_wgt, out + 3 * N2);
+
+  /* The weight of the other direction. */
+  for (int s_ind = 0; s_ind < N; s_ind++) {
+    for (int r_ind = 0; r_ind < N; r_ind++) {
+      const int index = r_ind + s_ind * N;
+      out[index] *= wgt[s_ind]; out[index + N2] *= wgt[r_ind];
+      out[index + 2 * N2] *= wgt[s_ind]; out[index + 3 * N2] *= wgt[r_ind];
+    }
+  }
 
 }
 
 template<typename ConcreteShape>
 RealVec TensorQuad<ConcreteShape>::GllPointsForOrder(const PetscInt order) {
   if (order > mMaxOrder) { throw std::runtime_error("Polynomial order not supported"); }
-  RealVec gll_points(order + 1);
-  if (order == 1) {
-    gll_coordinates_order1_square(gll_points.data());
-  } else if (order == 2) {
-    gll_coordinates_order2_square(gll_points.data());
-  } else if (order == 3) {
-    gll_coordinates_order3_square(gll_points.data());
-  } else if (order == 4) {
-    gll_coordinates_order4_square(gll_points.data());
-  } else if (order == 5) {
-    gll_coordinates_order5_square(gll_points.data());
-  } else if (order == 6) {
-    gll_coordinates_order6_square(gll_points.data());
-  } else if (order == 7) {
-    gll_coordinates_order7_square(gll_points.data());
-  } else if (order == 8) {
-    gll_coordinates_order8_square(gll_points.data());
-  } else if (order == 9) {
-    gll_coordinates_order9_square(gll_points.data());
-  } else if (order == 10) {
-    gll_coordinates_order10_square(gll_points.data());
-  }
-  return gll_points;
+  return Gll::Points(order);
 }
 
 template<typename ConcreteShape>
 RealVec TensorQuad<ConcreteShape>::GllIntegrationWeightsForOrder(const PetscInt order) {
   if (order > mMaxOrder) { throw std::runtime_error("Polynomial order not supported"); }
-  RealVec integration_weights(order + 1);
-  if (order == 1) {
-    gll_weights_order1_square(integration_weights.data());
-  } else if (order == 2) {
-    gll_weights_order2_square(integration_weights.data());
-  } else if (order == 3) {
-    gll_weights_order3_square(integration_weights.data());
-  } else if (order == 4) {
-    gll_weights_order4_square(integration_weights.data());
-  } else if (order == 5) {
-    gll_weights_order5_square(integration_weights.data());
-  } else if (order == 6) {
-    gll_weights_order6_square(integration_weights.data());
-  } else if (order == 7) {
-    gll_weights_order7_square(integration_weights.data());
-  } else if (order == 8) {
-    gll_weights_order8_square(integration_weights.data());
-  } else if (order == 9) {
-    gll_weights_order9_square(integration_weights.data());
-  } else if (order == 10) {
-    gll_weights_order10_square(integration_weights.data());
-  }
-  return integration_weights;
+  return Gll::Weights(order);
 }
 
 template<typename ConcreteShape>
 RealMat TensorQuad<ConcreteShape>::setupGradientOperator(const PetscInt order) {
-
   if (order > mMaxOrder) { throw std::runtime_error("Polynomial order not supported"); }
-  PetscInt num_pts_r = TensorQuad<ConcreteShape>::GllPointsForOrder(order).size();
-  PetscInt num_pts_s = TensorQuad<ConcreteShape>::GllPointsForOrder(order).size();
-  PetscReal eta = TensorQuad<ConcreteShape>::GllPointsForOrder(order)(0);
-
-  RealMat grad(num_pts_s, num_pts_r);
-  RealMat test(num_pts_s, num_pts_r);
-  for (PetscInt i = 0; i < num_pts_r; i++) {
-    PetscReal eps = TensorQuad<ConcreteShape>::GllPointsForOrder(order)(i);
-    if (order == 1) {
-      interpolate_eps_derivative_order1_square(eta, test.data());
-    } else if (order == 2) {
-      interpolate_eps_derivative_order2_square(eps, eta, test.data());
-    } else if (order == 3) {
-      interpolate_eps_derivative_order3_square(eps, eta, test.data());
-    } else if (order == 4) {
-      interpolate_eps_derivative_order4_square(eps, eta, test.data());
-    } else if (order == 5) {
-      interpolate_eps_derivative_order5_square(eps, eta, test.data());
-    } else if (order == 6) {
-      interpolate_eps_derivative_order6_square(eps, eta, test.data());
-    } else if (order == 7) {
-      interpolate_eps_derivative_order7_square(eps, eta, test.data());
-    } else if (order == 8) {
-      interpolate_eps_derivative_order8_square(eps, eta, test.data());
-    } else if (order == 9) {
-      interpolate_eps_derivative_order9_square(eps, eta, test.data());
-    } else if (order == 10) {
-      interpolate_eps_derivative_order10_square(eps, eta, test.data());
-    }
-    grad.row(i) = test.col(0);
-  }
-  return grad;
+  return Gll::DerivativeMatrix(Gll::Points(order));
 }
 
 template<typename ConcreteShape>
 RealVec TensorQuad<ConcreteShape>::interpolateLagrangePolynomials(const PetscReal r,
                                                                   const PetscReal s,
                                                                   const PetscInt order) {
-
   if (order > mMaxOrder) { throw std::runtime_error("Polynomial order not supported"); }
-  PetscInt n_points = (order + 1) * (order + 1);
-  RealVec gll_coeffs(n_points);
-  if (order == 1) {
-    interpolate_order1_square(r, s, gll_coeffs.data());
-  } else if (order == 2) {
-    interpolate_order2_square(r, s, gll_coeffs.data());
-  } else if (order == 3) {
-    interpolate_order3_square(r, s, gll_coeffs.data());
-  } else if (order == 4) {
-    interpolate_order4_square(r, s, gll_coeffs.data());
-  } else if (order == 5) {
-    interpolate_order5_square(r, s, gll_coeffs.data());
-  } else if (order == 6) {
-    interpolate_order6_square(r, s, gll_coeffs.data());
-  } else if (order == 7) {
-    interpolate_order7_square(r, s, gll_coeffs.data());
-  } else if (order == 8) {
-    interpolate_order8_square(r, s, gll_coeffs.data());
-  } else if (order == 9) {
-    interpolate_order9_square(r, s, gll_coeffs.data());
-  } else if (order == 10) {
-    interpolate_order10_square(r, s, gll_coeffs.data());
-  }
-  return gll_coeffs;
+  const RealVec pts = Gll::Points(order);
+  return Gll::TensorProduct(Gll::Lagrange(pts, r), Gll::Lagrange(pts, s));
+}
+
+template<typename ConcreteShape>
+RealVec TensorQuad<ConcreteShape>::lagrangeAtPoint(const PetscReal r, const PetscReal s) const {
+  return Gll::TensorProduct(Gll::Lagrange(mRef->mIntCrdR, r), Gll::Lagrange(mRef->mIntCrdS, s));
 }
 
 template<typename ConcreteShape>
-RealMat TensorQuad<ConcreteShape>::computeGradient(const Ref<const RealVec> &field) {
+Eigen::Map<RealMat> TensorQuad<ConcreteShape>::computeGradient(const Ref<const RealVec> &field) {
+
+  // compute gradient in the reference quad, with the (fixed size) kernel for this order.
+  Eigen::Map<RealMat> grad = Scratch::Matrix(Scratch::ShapeGrad, mNumIntPnt, mNumDim);
+
+  // Affine elements transform all points with one product.
+  if (mAffine) {
+    Eigen::Map<RealMat> ref_grad = Scratch::Matrix(Scratch::ShapeTemp, mNumIntPnt, mNumDim);
+    mRefGradKernel(mRef->mGrdR.data(), mRef->mGrdS.data(), field.data(), ref_grad.data());
+    grad.noalias() = ref_grad * mInvJac[0].transpose();
+    return grad;
+  }
+
+  mRefGradKernel(mRef->mGrdR.data(), mRef->mGrdS.data(), field.data(), grad.data());
 
   RealVec2 refGrad;
   RealMat2x2 invJac;
@@ -186,70 +275,149 @@ RealMat TensorQuad<ConcreteShape>::computeGradient(const Ref<const RealVec> &fie
       // gll index.
       PetscInt index = r_ind + s_ind * mNumIntPtsR;
 
-      // (r,s) coordinates for this point.
-      PetscReal r = mIntCrdR(r_ind);
-      PetscReal s = mIntCrdS(s_ind);
-
       // inverse jacobian at this point.
-      ConcreteShape::inverseJacobianAtPoint(r, s, mVtxCrd, mDetJac(index), invJac);
-
-      // compute gradient in the reference quad.
-      refGrad.setZero(2);
-      for (int i = 0; i < mNumIntPtsR; i++) {
-        refGrad(0) += mGrd(r_ind, i) * field(i + s_ind * mNumIntPtsR);
-        refGrad(1) += mGrd(s_ind, i) * field(r_ind + i * mNumIntPtsR);
-      }
+      jacobianAtIntPnt(r_ind, s_ind, mDetJac(index), invJac);
 
       // transform gradient to physical coordinates.
-      mGradWork.row(index).noalias() = invJac * refGrad;
+      refGrad = grad.row(index).transpose();
+      grad.row(index).noalias() = invJac * refGrad;
     }
   }
 
-  return mGradWork;
+  return grad;
 
 }
 
 template<typename ConcreteShape>
 void TensorQuad<ConcreteShape>::attachVertexCoordinates(std::unique_ptr<Mesh> const &mesh) {
 
-  Vec coordinates_local;
-  PetscInt coordinate_buffer_size;
-  PetscSection coordinate_section;
-  PetscReal *coordinates_buffer = NULL;
-
-  DMGetCoordinatesLocal(mesh->DistributedMesh(), &coordinates_local);
-  DMGetCoordinateSection(mesh->DistributedMesh(), &coordinate_section);
-  DMPlexVecGetClosure(mesh->DistributedMesh(), coordinate_section, coordinates_local,
-                      mElmNum, &coordinate_buffer_size, &coordinates_buffer);
-  std::vector<PetscReal> coordinates_element(coordinates_buffer,
-                                             coordinates_buffer + coordinate_buffer_size);
-  DMPlexVecRestoreClosure(mesh->DistributedMesh(), coordinate_section, coordinates_local,
-                          mElmNum, &coordinate_buffer_size, &coordinates_buffer);
-
-  // Get all coordinates.
-  for (PetscInt i = 0; i < mNumVtx; i++) {
-    mVtxCrd(i, 0) = coordinates_element[mNumDim * i + 0];
-    mVtxCrd(i, 1) = coordinates_element[mNumDim * i + 1];
-  }
+  // Coordinates were extracted for all elements when the mesh was distributed.
+  mVtxCrd = mesh->ElementVertexCoordinates(mElmNum);
 
   // Save edge maps.
   mEdgMap = mesh->EdgeNumbers(mElmNum);
 
   // Save element center
-  mElmCtr << mVtxCrd.col(0).mean(), mVtxCrd.col(1).mean();
+  mElmCtr = mesh->ElementCenters().row(mElmNum).transpose();
+  mModElm = mesh->ModelElement(mElmNum);
+
+  precomputeConstants();
+
+}
+
+template<typename ConcreteShape>
+void TensorQuad<ConcreteShape>::precomputeConstants() {
+
+  /* An element on the axis has a reference of its own, which the Jacobians are taken at. */
+  if (mAxisymmetric) { precomputeAxisymmetry(); }
+
+  /* The Jacobians at all points, as one product with the tabulated geometry derivatives. */
+  const RealMat jac = mRef->mVtxDer * mVtxCrd;
+  mDetJac.resize(mNumIntPnt);
+  mInvJac.resize(mNumIntPnt);
+  for (PetscInt i = 0; i < mNumIntPnt; i++) {
+    const RealMat2x2 jac_i = jac.middleRows<2>(mNumDim * i);
+    mDetJac(i) = jac_i.determinant(); mInvJac[i] = jac_i.inverse();
+  }
+
+  /* Parallelograms have the same Jacobian everywhere, so only one is kept (even with
+   * --low-memory-geometry), and the kernels transform all points at once. */
+  const PetscReal tol = 1e-10;
+  mAffine = true;
+  for (PetscInt i = 1; i < mNumIntPnt && mAffine; i++) {
+    mAffine = mInvJac[i].isApprox(mInvJac[0], tol) &&
+        std::abs(mDetJac(i) - mDetJac(0)) <= tol * std::abs(mDetJac(0));
+  }
+
+  if (mAffine) {
+    mDetJac.conservativeResize(1); mInvJac.resize(1);
+  } else if (!mPrecomputeGeometry) {
+    mInvJac.clear();
+  }
+
+}
+
+template<typename ConcreteShape>
+void TensorQuad<ConcreteShape>::precomputeAxisymmetry() {
+
+  /* The axis is x = 0, with the mesh on the side of positive x. */
+  const PetscReal tol = 1e-8 * (mVtxCrd.colwise().maxCoeff() - mVtxCrd.colwise().minCoeff()).norm();
+  if (mVtxCrd.col(0).minCoeff() < -tol) {
+    throw std::runtime_error("Element " + std::to_string(mElmNum) + " has a vertex at negative x. An "
+                             "axisymmetric mesh must lie at x >= 0, with the axis at x = 0.");
+  }
+  mAxiEdg = -1;
+  for (PetscInt i = 0; i < mNumVtx; i++) {
+    if (std::abs(mVtxCrd(i, 0)) <= tol && std::abs(mVtxCrd((i + 1) % mNumVtx, 0)) <= tol) { mAxiEdg = i; }
+  }
+  mRef = ReferenceForOrder(mPlyOrd, mAxiEdg);
+
+  /* Radius of each point, and the factor of its quadrature weight. The radius over the reference distance from
+   * the axis, t, tends to the derivative of the radius across the axis on it. */
+  const RealMat jac = mRef->mVtxDer * mVtxCrd;
+  mAxiRad = (mRef->mVtxInt * mVtxCrd).col(0);
+  mAxiWgt = mAxiRad;
+  for (PetscInt s_ind = 0; s_ind < mNumIntPtsS; s_ind++) {
+    for (PetscInt r_ind = 0; r_ind < mNumIntPtsR; r_ind++) {
+      const PetscInt index = r_ind + s_ind * mNumIntPtsR;
+      if (std::abs(mAxiRad(index)) <= tol) { mAxiRad(index) = 0; mAxiWgt(index) = 0; }
+      if (mAxiEdg < 0) { continue; }
+      const bool across_r = mAxiEdg == 1 || mAxiEdg == 3;
+      const PetscReal x = across_r ? mRef->mIntCrdR(r_ind) : mRef->mIntCrdS(s_ind);
+      const PetscReal t = mAxiEdg == 0 || mAxiEdg == 3 ? 1 + x : 1 - x;
+      const PetscReal radius_over_t = t > 1e-12 ? mAxiRad(index) / t :
+          std::abs(jac(mNumDim * index + (across_r ? 0 : 1), 0));
+      mAxiWgt(index) = radius_over_t * mRef->mWgtRatio(index);
+    }
+  }
 
 }
 
 template<typename ConcreteShape>
 void TensorQuad<ConcreteShape>::attachMaterialProperties(std::unique_ptr<ExodusModel> const &model,
                                                          std::string parameter) {
+  /* Use the material sampled at the integration points by an earlier run, if there is one. */
+  const PetscReal *cached = mModElm >= 0 ?
+      model->CachedParameterAtIntPts(mModElm, parameter, mNumIntPnt) : NULL;
+  if (cached) { mParIntPts[parameter] = Eigen::Map<const RealVec>(cached, mNumIntPnt); return; }
+  mParIntPts.erase(parameter);
+
   RealVec4 material_at_vertices;
   for (int i = 0; i < mNumVtx; i++) {
-    material_at_vertices(i) = model->getElementalMaterialParameterAtVertex(mElmCtr, parameter, i);
+    material_at_vertices(i) = mModElm >= 0 ?
+        model->getElementalMaterialParameterAtVertex(mModElm, parameter, i) :
+        model->getElementalMaterialParameterAtVertex(mElmCtr, parameter, i);
   }
   mPar[parameter] = material_at_vertices;
 }
 
+template<typename ConcreteShape>
+double TensorQuad<ConcreteShape>::CFL_constant() {
+  return 0.5; // conservative for GLL spacing, orders 1-10
+}
+
+template<typename ConcreteShape>
+double TensorQuad<ConcreteShape>::estimatedElementRadius() {
+
+  RealVec x, z;
+  std::tie(x, z) = buildNodalPoints();
+
+  // smallest distance between neighbouring points along r and s
+  double h = std::numeric_limits<double>::max();
+  for (PetscInt s_ind = 0; s_ind < mNumIntPtsS; s_ind++) {
+    for (PetscInt r_ind = 0; r_ind < mNumIntPtsR; r_ind++) {
+      PetscInt i = r_ind + s_ind * mNumIntPtsR;
+      if (r_ind + 1 < mNumIntPtsR) { h = std::min(h, std::hypot(x(i + 1) - x(i), z(i + 1) - z(i))); }
+      if (s_ind + 1 < mNumIntPtsS) {
+        PetscInt j = i + mNumIntPtsR;
+        h = std::min(h, std::hypot(x(j) - x(i), z(j) - z(i)));
+      }
+    }
+  }
+  return h;
+
+}
+
 template<typename ConcreteShape>
 bool TensorQuad<ConcreteShape>::attachReceiver(std::unique_ptr<Receiver> &receiver,
                                                const bool finalize) {
@@ -261,6 +429,7 @@ bool TensorQuad<ConcreteShape>::attachReceiver(std::unique_ptr<Receiver> &receiv
     RealVec2 ref_loc = ConcreteShape::inverseCoordinateTransform(x1, x2, mVtxCrd);
     receiver->SetRefLocR(ref_loc(0));
     receiver->SetRefLocS(ref_loc(1));
+    mRecWeights.push_back(lagrangeAtPoint(ref_loc(0), ref_loc(1)));
     mRec.push_back(std::move(receiver));
     return true;
   }
@@ -272,6 +441,11 @@ bool TensorQuad<ConcreteShape>::attachSource(std::unique_ptr<Source> &source, co
   if (!source) { return false; }
   PetscReal x1 = source->LocX();
   PetscReal x2 = source->LocY();
+  /* A source on the axis goes to an element with an edge on it, whose quadrature does not vanish there. */
+  if (mAxisymmetric && mAxiEdg < 0 && mAxiRad.minCoeff() == 0 &&
+      std::abs(x1) <= 1e-8 * (mVtxCrd.colwise().maxCoeff() - mVtxCrd.colwise().minCoeff()).norm()) {
+    return false;
+  }
   if (ConcreteShape::checkHull(x1, x2, mVtxCrd)) {
     if (!finalize) { return true; }
     RealVec2 ref_loc = ConcreteShape::inverseCoordinateTransform(x1, x2, mVtxCrd);
@@ -287,44 +461,52 @@ template<typename ConcreteShape>
 RealVec TensorQuad<ConcreteShape>::getDeltaFunctionCoefficients(const Eigen::Ref<RealVec>& pnt) {
 
   PetscReal r = pnt(0), s = pnt(1);
-  RealMat2x2 _;
-  mParWork = interpolateLagrangePolynomials(r, s, mPlyOrd);
+  RealVec coef = lagrangeAtPoint(r, s);
+  const RealMat jac = mRef->mVtxDer * mVtxCrd;
   for (PetscInt s_ind = 0; s_ind < mNumIntPtsS; s_ind++) {
     for (PetscInt r_ind = 0; r_ind < mNumIntPtsR; r_ind++) {
 
-      PetscReal ri = mIntCrdR(r_ind);
-      PetscReal si = mIntCrdS(s_ind);
-
-      PetscReal detJac;
-      ConcreteShape::inverseJacobianAtPoint(ri, si, mVtxCrd, detJac, _);
+      const PetscInt index = r_ind + s_ind * mNumIntPtsR;
+      const PetscReal detJac = RealMat2x2(jac.middleRows<2>(mNumDim * index)).determinant();
+      coef(index) /= (mRef->mIntWgtR(r_ind) * mRef->mIntWgtS(s_ind) * detJac);
 
-      mParWork(r_ind + s_ind * mNumIntPtsR) /= (mIntWgtR(r_ind) * mIntWgtS(s_ind) * detJac);
+      /* A point source in 3D, i.e. over 2 pi r dr dz, of which the quadrature holds the r dr dz. */
+      if (mAxisymmetric) { coef(index) = mAxiWgt(index) ? coef(index) / (2 * M_PI * mAxiWgt(index)) : 0; }
 
     }
   }
-  return mParWork;
+  return coef;
 }
 
 template<typename ConcreteShape>
-RealVec TensorQuad<ConcreteShape>::ParAtIntPts(const std::string &par) {
+RealVec TensorQuad<ConcreteShape>::getHoopDeltaFunctionCoefficients(const Eigen::Ref<RealVec>& pnt) {
 
-  for (PetscInt s_ind = 0; s_ind < mNumIntPtsS; s_ind++) {
-    for (PetscInt r_ind = 0; r_ind < mNumIntPtsR; r_ind++) {
+  const PetscReal r = pnt(0), s = pnt(1);
+  const PetscReal radius = ConcreteShape::interpolateAtPoint(r, s).dot(mVtxCrd.col(0));
+  const PetscReal tol = 1e-8 * (mVtxCrd.colwise().maxCoeff() - mVtxCrd.colwise().minCoeff()).norm();
+  if (radius > tol) { return lagrangeAtPoint(r, s) / (2 * M_PI * radius); }
 
-      PetscReal r = mIntCrdR(r_ind);
-      PetscReal s = mIntCrdS(s_ind);
-      mParWork(r_ind + s_ind * mNumIntPtsR) =
-          ConcreteShape::interpolateAtPoint(r, s).dot(mPar[par]);
+  /* On the axis, the limit of phi / r, the derivative along x. */
+  const RealVec2 jac_x = (ConcreteShape::shapeDerivativesAtPoint(r, s) * mVtxCrd).inverse().row(0).transpose();
+  const RealVec dr = Gll::TensorProduct(Gll::LagrangeDerivative(mRef->mIntCrdR, r), Gll::Lagrange(mRef->mIntCrdS, s));
+  const RealVec ds = Gll::TensorProduct(Gll::Lagrange(mRef->mIntCrdR, r), Gll::LagrangeDerivative(mRef->mIntCrdS, s));
+  return (jac_x(0) * dr + jac_x(1) * ds) / (2 * M_PI);
 
-    }
-  }
+}
+
+template<typename ConcreteShape>
+RealVec TensorQuad<ConcreteShape>::ParAtIntPts(const std::string &par) {
+
+  auto cached = mParIntPts.find(par);
+  if (cached != mParIntPts.end()) { return cached->second; }
+  return mRef->mVtxInt * mPar[par];
 
-  return mParWork;
 }
 
 template<typename ConcreteShape>
 RealVec TensorQuad<ConcreteShape>::applyTestAndIntegrate(const Ref<const RealVec> &f) {
 
+  RealVec result(mNumIntPnt);
   RealMat2x2 invJac;
   for (PetscInt s_ind = 0; s_ind < mNumIntPtsS; s_ind++) {
     for (PetscInt r_ind = 0; r_ind < mNumIntPtsR; r_ind++) {
@@ -332,23 +514,64 @@ RealVec TensorQuad<ConcreteShape>::applyTestAndIntegrate(const Ref<const RealVec
       // gll index.
       PetscInt index = r_ind + s_ind * mNumIntPtsR;
 
-      // (r,s) coordinate at this point.
-      PetscReal r = mIntCrdR(r_ind);
-      PetscReal s = mIntCrdS(s_ind);
-
       PetscReal detJac;
-      ConcreteShape::inverseJacobianAtPoint(r, s, mVtxCrd, detJac, invJac);
-      mParWork(index) = f(index) * detJac * mIntWgtR(r_ind) * mIntWgtS(s_ind);
+      jacobianAtIntPnt(r_ind, s_ind, detJac, invJac);
+      result(index) = f(index) * detJac * mRef->mIntWgtR(r_ind) * mRef->mIntWgtS(s_ind);
 
     }
   }
+  if (mAxisymmetric) { result.array() *= mAxiWgt.array(); }
+
+  return result;
+
+}
 
-  return mParWork;
+template<typename ConcreteShape>
+Eigen::Map<RealVec> TensorQuad<ConcreteShape>::applyTestOverRadiusAndIntegrate(const Ref<const RealVec> &f) {
+
+  Eigen::Map<RealVec> result = Scratch::Vector(Scratch::ShapeStiff, mNumIntPnt);
+  RealMat2x2 invJac;
+  for (PetscInt s_ind = 0; s_ind < mNumIntPtsS; s_ind++) {
+    for (PetscInt r_ind = 0; r_ind < mNumIntPtsR; r_ind++) {
+      PetscInt index = r_ind + s_ind * mNumIntPtsR;
+      PetscReal detJac;
+      jacobianAtIntPnt(r_ind, s_ind, detJac, invJac);
+      result(index) = mAxiRad(index) == 0 ? 0 : f(index) * detJac * mRef->mIntWgtR(r_ind) *
+          mRef->mIntWgtS(s_ind) * mAxiWgt(index) / mAxiRad(index);
+    }
+  }
+  return result;
 
 }
 
 template<typename ConcreteShape>
-RealVec TensorQuad<ConcreteShape>::applyGradTestAndIntegrate(const Ref<const RealMat> &f) {
+Eigen::Map<RealVec> TensorQuad<ConcreteShape>::applyGradTestAndIntegrate(const Ref<const RealMat> &f) {
+
+  // Note we already have detJac at the relevant points.
+  Eigen::Map<RealMat> flux = Scratch::Matrix(Scratch::ShapeFlux, mNumIntPnt, mNumDim);
+  if (mAffine) {
+    flux = mDetJac(0) * f;
+  } else {
+    flux.col(0) = mDetJac.cwiseProduct(f.col(0));
+    flux.col(1) = mDetJac.cwiseProduct(f.col(1));
+  }
+  if (mAxisymmetric) {
+    flux.col(0).array() *= mAxiWgt.array();
+    flux.col(1).array() *= mAxiWgt.array();
+  }
+
+  // Integrate against the tensor basis, with the (fixed size) kernel for this order.
+  Eigen::Map<RealMat> grad_test = Scratch::Matrix(Scratch::ShapeTemp, mNumIntPnt, 2 * mNumDim);
+  mGradTestKernel(mRef->mGrdR.data(), mRef->mGrdS.data(), mRef->mIntWgtR.data(), flux.data(), grad_test.data());
+
+  Eigen::Map<RealVec> stiff = Scratch::Vector(Scratch::ShapeStiff, mNumIntPnt);
+
+  // Affine elements transform all points with one product.
+  if (mAffine) {
+    stiff.noalias() = grad_test.leftCols<2>() * mInvJac[0].row(0).transpose();
+    stiff.noalias() += grad_test.rightCols<2>() * mInvJac[0].row(1).transpose();
+    return stiff;
+  }
 
   RealMat2x2 invJac;
   RealVec2 dphi_rs_dfx, dphi_rs_dfy;
@@ -357,42 +580,21 @@ RealVec TensorQuad<ConcreteShape>::applyGradTestAndIntegrate(const Ref<const Rea
   for (PetscInt s_ind = 0; s_ind < mNumIntPtsS; s_ind++) {
     for (PetscInt r_ind = 0; r_ind < mNumIntPtsR; r_ind++) {
 
-      // Reset derivatives for this point.
-      dphi_rs_dfx.setZero(); dphi_rs_dfy.setZero();
-
-      // Get reference coordinates.
-      PetscReal r = mIntCrdR(r_ind);
-      PetscReal s = mIntCrdS(s_ind);
-
-      // Loop over the tensor basis. Note we already have detJac at the relevant points.
-      for (PetscInt i = 0; i < mNumIntPtsR; i++) {
-        PetscInt r_index = i + s_ind * mNumIntPtsR;
-        PetscInt s_index = r_ind + i * mNumIntPtsR;
-        dphi_rs_dfx(0) += mDetJac(r_index) * f(r_index, 0) * mGrd(i, r_ind) * mIntWgtR(i);
-        dphi_rs_dfx(1) += mDetJac(s_index) * f(s_index, 0) * mGrd(i, s_ind) * mIntWgtS(i);
-        dphi_rs_dfy(0) += mDetJac(r_index) * f(r_index, 1) * mGrd(i, r_ind) * mIntWgtR(i);
-        dphi_rs_dfy(1) += mDetJac(s_index) * f(s_index, 1) * mGrd(i, s_ind) * mIntWgtS(i);
-      }
-
-      // Multiply by relevant integration weights.
-      dphi_rs_dfx(0) *= mIntWgtS(s_ind);
-      dphi_rs_dfx(1) *= mIntWgtR(r_ind);
-      dphi_rs_dfy(0) *= mIntWgtS(s_ind);
-      dphi_rs_dfy(1) *= mIntWgtR(r_ind);
+      PetscInt index = r_ind + s_ind * mNumIntPtsR;
+      dphi_rs_dfx << grad_test(index, 0), grad_test(index, 1);
+      dphi_rs_dfy << grad_test(index, 2), grad_test(index, 3);
 
       // Get the inverse Jacobain again at this point.
       PetscReal _;
-      ConcreteShape::inverseJacobianAtPoint(r, s, mVtxCrd, _, invJac);
+      jacobianAtIntPnt(r_ind, s_ind, _, invJac);
 
-      // Optimization opportunity.
       // Transform the quantities to physical coordinates.
-      PetscInt index = r_ind + s_ind * mNumIntPtsR;
-      mStiffWork(index)  = invJac.row(0).dot(dphi_rs_dfx) + invJac.row(1).dot(dphi_rs_dfy);
+      stiff(index)  = invJac.row(0).dot(dphi_rs_dfx) + invJac.row(1).dot(dphi_rs_dfy);
 
     }
   }
 
-  return mStiffWork;
+  return stiff;
 
 }
 
@@ -476,13 +678,14 @@ template<typename ConcreteShape>
 RealVec TensorQuad<ConcreteShape>::applyTestAndIntegrateEdge(const Eigen::Ref<const RealVec> &f,
                                                              const PetscInt edg) {
 
-  mParWork.setZero();
+  RealVec result = RealVec::Zero(mNumIntPnt);
 
   // get edge vertices.
-  PetscInt start, stride;
+  PetscInt start, stride, edg_vtx = 0;
   PetscReal x0, x1, y0, y1;
   for (PetscInt i = 0; i < mNumVtx; i++) {
     if (mEdgMap[i] == edg) {
+      edg_vtx = i;
       x0 = mVtxCrd(i, 0);
       x1 = mVtxCrd((i + 1) % mNumVtx, 0);
       y0 = mVtxCrd(i, 1);
@@ -510,10 +713,16 @@ RealVec TensorQuad<ConcreteShape>::applyTestAndIntegrateEdge(const Eigen::Ref<co
 
   // compute coefficients.
   for (PetscInt i = start, j = 0; j < mNumIntPtsR; i += stride, j++) {
-    mParWork(i) = f(i) * d * mIntWgtR(j);
+    result(i) = f(i) * d * mRef->mIntWgtR(j);
+  }
+
+  /* Over r ds. Along an edge which crosses the axis, its points are GLJ points, as in the interior. */
+  if (mAxisymmetric) {
+    const bool across_axis = mAxiEdg >= 0 && edg_vtx % 2 != mAxiEdg % 2;
+    result.array() *= across_axis ? mAxiWgt.array() : mAxiRad.array();
   }
 
-  return mParWork;
+  return result;
 
 }
 
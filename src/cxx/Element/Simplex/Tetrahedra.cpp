@@ -4,6 +4,7 @@
 #include <Model/ExodusModel.h>
 #include <Utilities/Options.h>
 #include <Utilities/Logging.h>
+#include <Utilities/Scratch.h>
 #include <Element/Simplex/TetP1.h>
 #include <Element/Simplex/Tetrahedra.h>
 
@@ -48,6 +49,8 @@ template <typename ConcreteShape>
 Matrix<double,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor> Tetrahedra<ConcreteShape>::mGradientPhi_ds_t;
 template <typename ConcreteShape>
 Matrix<double,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor> Tetrahedra<ConcreteShape>::mGradientPhi_dt_t;
+template <typename ConcreteShape>
+MatrixXd Tetrahedra<ConcreteShape>::mGradientPhi_drst;
 
 // Gets vertex ids from PETSc element closure
 std::vector<int> getVertsFromPoint(int point, int numVerts, DM &distributed_mesh) {
@@ -120,6 +123,7 @@ Tetrahedra<ConcreteShape>::Tetrahedra(std::unique_ptr<Options> const &options) {
 
   // Basic properties.
   mPlyOrd = options->PolynomialOrder();
+  mModElm = -1;
   if(mPlyOrd == 3) {
     // total number of nodes
     mNumIntPnt = 50;
@@ -141,6 +145,7 @@ Tetrahedra<ConcreteShape>::Tetrahedra(std::unique_ptr<Options> const &options) {
           
   setupGradientOperator();
 
+  mReferenceStiffness = options->SimplexReferenceStiffness();
   mParWork.setZero(mNumIntPnt);
   mStiffWork.setZero(mNumIntPnt);
   mGradWork.setZero(mNumIntPnt, mNumDim);
@@ -153,38 +158,23 @@ Tetrahedra<ConcreteShape>::Tetrahedra(std::unique_ptr<Options> const &options) {
 template <typename ConcreteShape>
 void Tetrahedra<ConcreteShape>::attachVertexCoordinates(std::unique_ptr<Mesh> const &mesh) {
 
-  mClsMap = ClosureMapping(3, 3, mesh->DistributedMesh());
+  mClsMap = ClosureMapping(3, 3, mesh->DistributedMesh()).template cast<PetscInt>();
 
-  Vec coordinates_local;
-  PetscInt coordinate_buffer_size;
-  PetscSection coordinate_section;
-  PetscReal *coordinates_buffer = NULL;
-
-  DMGetCoordinatesLocal(mesh->DistributedMesh(), &coordinates_local);
-  DMGetCoordinateSection(mesh->DistributedMesh(), &coordinate_section);
-  DMPlexVecGetClosure(mesh->DistributedMesh(), coordinate_section, coordinates_local, mElmNum,
-                      &coordinate_buffer_size, &coordinates_buffer);
-  std::vector<PetscReal> coordinates_element(coordinates_buffer, coordinates_buffer+coordinate_buffer_size);
-  DMPlexVecRestoreClosure(mesh->DistributedMesh(), coordinate_section, coordinates_local, mElmNum,
-                          &coordinate_buffer_size, &coordinates_buffer);
-    
-  for (int i = 0; i < mNumVtx; i++) {        
-    mVtxCrd(i,0) = coordinates_element[mNumDim*i+0];
-    mVtxCrd(i,1) = coordinates_element[mNumDim*i+1];
-    mVtxCrd(i,2) = coordinates_element[mNumDim*i+2];
-  }
+  // Coordinates were extracted for all elements when the mesh was distributed.
+  mVtxCrd = mesh->ElementVertexCoordinates(mElmNum);
 
   // Save element center
-  mElmCtr <<
-    mVtxCrd.col(0).mean(),
-    mVtxCrd.col(1).mean(),
-    mVtxCrd.col(2).mean();
+  mElmCtr = mesh->ElementCenters().row(mElmNum).transpose();
+  mModElm = mesh->ModelElement(mElmNum);
 
 }
 
 template <typename ConcreteShape>
 VectorXd Tetrahedra<ConcreteShape>::ParAtIntPts(const std::string &par) {
 
+  auto cached = mParIntPts.find(par);
+  if (cached != mParIntPts.end()) { return cached->second; }
+
   // interpolate velocity at all nodes
   for(int i=0;i<mNumIntPnt;i++) {
     auto r = mIntegrationCoordinates_r[i];
@@ -199,10 +189,18 @@ VectorXd Tetrahedra<ConcreteShape>::ParAtIntPts(const std::string &par) {
 template <typename ConcreteShape>
 void Tetrahedra<ConcreteShape>::attachMaterialProperties(std::unique_ptr<ExodusModel> const &model, std::string parameter_name) {
 
+  /* Use the material sampled at the integration points by an earlier run, if there is one. */
+  const PetscReal *cached = mModElm >= 0 ?
+      model->CachedParameterAtIntPts(mModElm, parameter_name, mNumIntPnt) : NULL;
+  if (cached) { mParIntPts[parameter_name] = Eigen::Map<const RealVec>(cached, mNumIntPnt); return; }
+  mParIntPts.erase(parameter_name);
+
   Vector4d material_at_vertices;
 
   for (auto i = 0; i < mNumVtx; i++) {
-    material_at_vertices(i) = model->getElementalMaterialParameterAtVertex(mElmCtr, parameter_name, i);
+    material_at_vertices(i) = mModElm >= 0 ?
+        model->getElementalMaterialParameterAtVertex(mModElm, parameter_name, i) :
+        model->getElementalMaterialParameterAtVertex(mElmCtr, parameter_name, i);
   }
   
   mPar[parameter_name] = material_at_vertices;
@@ -234,9 +232,19 @@ bool Tetrahedra<ConcreteShape>::attachSource(std::unique_ptr<Source> &source, co
 template <typename ConcreteShape>
 MatrixXd Tetrahedra<ConcreteShape>::computeGradient(const Ref<const VectorXd>& field) {
 
+  if (mPlyOrd == 3) { gradientKernel<50>(field); return mGradWork; }
+
   Vector3d phyGrad;
   Vector3d refGrad;
 
+  if (mReferenceStiffness) {
+    /* Reference gradient (one column per direction), mapped by the (constant) inverse Jacobian. */
+    Eigen::Map<RealMat> ref_grad = Scratch::Matrix(Scratch::ShapeTemp, mNumIntPnt, mNumDim);
+    Eigen::Map<RealVec>(ref_grad.data(), mNumDim * mNumIntPnt).noalias() = mGradientPhi_drst.transpose()*field;
+    mGradWork.noalias() = ref_grad * mInvJacT;
+    return mGradWork;
+  }
+
   mGradWork.col(0) = mGradientPhi_dx*field;
   mGradWork.col(1) = mGradientPhi_dy*field;
   mGradWork.col(2) = mGradientPhi_dz*field;
@@ -246,31 +254,52 @@ MatrixXd Tetrahedra<ConcreteShape>::computeGradient(const Ref<const VectorXd>& f
 
 template <typename ConcreteShape>
 VectorXd Tetrahedra<ConcreteShape>::applyGradTestAndIntegrate(const Ref<const MatrixXd>& f) {
-  Vector3d refGrad;
-  Vector3d phyGrad;
+  if (mPlyOrd == 3) { gradTestAndIntegrateKernel<50>(f); return mStiffWork; }
 
-  for(int i=0;i<mNumIntPnt;i++) {
-    refGrad << f(i,0), f(i,1), f(i,2);
-    phyGrad = mInvJacT * refGrad;
-    mGradWork(i,0) = phyGrad(0);
-    mGradWork(i,1) = phyGrad(1);
-    mGradWork(i,2) = phyGrad(2);
-  }
+  /* Rows of f mapped by the inverse Jacobian, and weighted, against all reference derivatives at once. */
+  Eigen::Map<RealMat> flux = Scratch::Matrix(Scratch::ShapeTemp, mNumIntPnt, mNumDim);
+  flux.noalias() = mIntegrationWeights.asDiagonal() * (f.leftCols(mNumDim) * mInvJac);
+  mStiffWork.noalias() = mGradientPhi_drst * Eigen::Map<const RealVec>(flux.data(), mNumDim * mNumIntPnt);
+  mStiffWork *= mDetJac;
+  return mStiffWork;
   
-  for(int i=0;i<mNumIntPnt;i++) {
+}
 
-    mStiffWork(i) = 0;
-    for(int j=0;j<mNumIntPnt;j++) {
-      mStiffWork(i) +=
-        mIntegrationWeights[j] * (mGradWork(j,0) * mGradientPhi_dr(i,j) +
-                                  mGradWork(j,1) * mGradientPhi_ds(i,j) +
-                                  mGradWork(j,2) * mGradientPhi_dt(i,j));
-    }
+template <typename ConcreteShape>
+template <int N>
+void Tetrahedra<ConcreteShape>::gradientKernel(const Ref<const VectorXd>& field) {
 
-    mStiffWork(i) *= mDetJac;
+  Map<Matrix<double,N,3>> grad(mGradWork.data());
+  if (mReferenceStiffness) {
+    /* Reference gradient (one column per direction), mapped by the (constant) inverse Jacobian. */
+    Map<const Matrix<double,N,3*N>> drst(mGradientPhi_drst.data());
+    Matrix<double,N,3> ref_grad;
+    Map<Matrix<double,3*N,1>>(ref_grad.data()).noalias() = drst.transpose() * field.template head<N>();
+    grad.noalias() = ref_grad * mInvJacT;
+    return;
   }
-  return mStiffWork;
-  
+
+  Map<const Matrix<double,N,N>> dx(mGradientPhi_dx.data()), dy(mGradientPhi_dy.data()), dz(mGradientPhi_dz.data());
+  grad.col(0).noalias() = dx * field.template head<N>();
+  grad.col(1).noalias() = dy * field.template head<N>();
+  grad.col(2).noalias() = dz * field.template head<N>();
+
+}
+
+template <typename ConcreteShape>
+template <int N>
+void Tetrahedra<ConcreteShape>::gradTestAndIntegrateKernel(const Ref<const MatrixXd>& f) {
+
+  Map<const Matrix<double,N,3*N>> drst(mGradientPhi_drst.data());
+  Map<const Matrix<double,N,1>> wgt(mIntegrationWeights.data());
+  Map<Matrix<double,N,1>> stiff(mStiffWork.data());
+
+  /* Rows of f mapped by the inverse Jacobian (f_j^T invJ = (invJ^T f_j)^T), and weighted. The three directions
+   * are stacked, so that the derivatives of the test functions are applied by one product. */
+  Matrix<double,N,3> flux = wgt.asDiagonal() * (f.template topLeftCorner<N,3>() * mInvJac);
+  stiff.noalias() = drst * Map<const Matrix<double,3*N,1>>(flux.data());
+  stiff *= mDetJac;
+
 }
 
 template <typename ConcreteShape>
@@ -338,7 +367,12 @@ void Tetrahedra<ConcreteShape>::precomputeElementTerms()
  {
    std::tie(mInvJac,mDetJac) = ConcreteShape::inverseJacobian(mVtxCrd);
    mInvJacT = mInvJac.transpose();
-   mElementStiffnessMatrix = buildStiffnessMatrix(ParAtIntPts("VP"));    
+   if (mReferenceStiffness) {
+     mInvJacT_x_invJac = mInvJacT * mInvJac;
+   } else {
+     /* Only the physical derivative operators are kept. */
+     buildStiffnessMatrix(ParAtIntPts("VP"));
+   }
  }
 
 template <typename ConcreteShape>
@@ -379,10 +413,6 @@ MatrixXd Tetrahedra<ConcreteShape>::buildStiffnessMatrix(const Ref<const VectorX
   mGradientPhi_dy.resize(mNumIntPnt,mNumIntPnt);
   mGradientPhi_dz.resize(mNumIntPnt,mNumIntPnt);
 
-  mWiDPhi_x.resize(mNumIntPnt,mNumIntPnt);
-  mWiDPhi_y.resize(mNumIntPnt,mNumIntPnt);
-  mWiDPhi_z.resize(mNumIntPnt,mNumIntPnt);
-
   // Stiffness Matrix
   // Dx = rx*Dr + sx*Ds + tx*Dt;
   // Dy = ry*Dr + sy*Ds + ty*Dt;
@@ -407,18 +437,10 @@ MatrixXd Tetrahedra<ConcreteShape>::buildStiffnessMatrix(const Ref<const VectorX
      dtdz*mGradientPhi_dt).transpose();
   
   // Me*Dx, Me*Dy, Me*Dz
-  RealVec wi_vp2 = mIntegrationWeights * vp2;
-  mWiDPhi_x = (wi_vp2).asDiagonal() * mGradientPhi_dx;
-  mWiDPhi_y = (wi_vp2).asDiagonal() * mGradientPhi_dy;
-  mWiDPhi_z = (wi_vp2).asDiagonal() * mGradientPhi_dz;
-  
-  // for(int i=0;i<mNumIntPnt;i++) {
-  //   mWiDPhi_x.row(i) = mGradientPhi_dx.row(i)*mIntegrationWeights[i];
-  //   mWiDPhi_y.row(i) = mGradientPhi_dy.row(i)*mIntegrationWeights[i];
-  //   mWiDPhi_z.row(i) = mGradientPhi_dz.row(i)*mIntegrationWeights[i];
-  // }
-    
-  elementStiffnessMatrix = (detJ*mGradientPhi_dx.transpose()*mWiDPhi_x) + (detJ*mGradientPhi_dy.transpose()*mWiDPhi_y) + (detJ*mGradientPhi_dz.transpose()*mWiDPhi_z);
+  RealVec wi_vp2 = mIntegrationWeights.array() * vp2.array();
+  elementStiffnessMatrix = detJ * (mGradientPhi_dx.transpose() * wi_vp2.asDiagonal() * mGradientPhi_dx +
+                                   mGradientPhi_dy.transpose() * wi_vp2.asDiagonal() * mGradientPhi_dy +
+                                   mGradientPhi_dz.transpose() * wi_vp2.asDiagonal() * mGradientPhi_dz);
   
   // build transpose as well
   // mGradientPhi_dx_t = mGradientPhi_dx.transpose();
@@ -440,6 +462,8 @@ void Tetrahedra<ConcreteShape>::setupGradientOperator() {
     dphi_dr_rstn_p3_tetrahedra(mGradientPhi_dr.data());
     dphi_ds_rstn_p3_tetrahedra(mGradientPhi_ds.data());
     dphi_dt_rstn_p3_tetrahedra(mGradientPhi_dt.data());
+    mGradientPhi_drst.resize(mNumIntPnt,3*mNumIntPnt);
+    mGradientPhi_drst << mGradientPhi_dr, mGradientPhi_ds, mGradientPhi_dt;
   } else {        
     std::cerr << "NOT implemented yet!\n";
     MPI::COMM_WORLD.Abort(-1);
@@ -494,12 +518,12 @@ VectorXd Tetrahedra<ConcreteShape>::applyTestAndIntegrate(const Ref<const Vector
 template <typename ConcreteShape>
 void Tetrahedra<ConcreteShape>::setBoundaryConditions(std::unique_ptr<Mesh> const &mesh) {
   mBndElm = false;
-  for (auto &keys: mesh ->BoundaryElementFaces()) {
-    auto boundary_name = keys.first;
-    auto element_in_boundary = keys.second;
-    if (element_in_boundary.find(mElmNum) != element_in_boundary.end()) {
+  /* The boundaries are looked up in place, not copied for every element. */
+  for (auto &keys: mesh->BoundaryElementFaces()) {
+    auto faces = keys.second.find(mElmNum);
+    if (faces != keys.second.end()) {
       mBndElm = true;
-      mBnd[boundary_name] = element_in_boundary[mElmNum];
+      mBnd[keys.first] = faces->second;
     }
   }
 }
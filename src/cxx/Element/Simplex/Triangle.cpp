@@ -6,6 +6,8 @@
 #include <Element/Simplex/TriP1.h>
 #include <Element/Simplex/Triangle.h>
 #include <Utilities/Logging.h>
+#include <Utilities/Scratch.h>
+#include <Element/ElementBatch.h>
 
 extern "C" {
 #include <Element/Simplex/Autogen/p3_triangle.h>
@@ -77,6 +79,7 @@ Triangle<ConcreteShape>::Triangle(std::unique_ptr<Options> const &options) {
 
   // Basic properties.
   mPlyOrd = options->PolynomialOrder();
+  mModElm = -1;
   if(mPlyOrd == 3) {
     mNumIntPnt = 12;
     mNumDofEdg = 2;
@@ -96,10 +99,12 @@ Triangle<ConcreteShape>::Triangle(std::unique_ptr<Options> const &options) {
     Triangle<ConcreteShape>::QuadraturePoints(options->PolynomialOrder());
   mIntegrationWeights = Triangle<ConcreteShape>::QuadratureIntegrationWeight(options->PolynomialOrder());
         
-  mClsMap = Triangle<ConcreteShape>::ClosureMapping(options->PolynomialOrder(), mNumDim);
+  mClsMap = Triangle<ConcreteShape>::ClosureMapping(options->PolynomialOrder(), mNumDim).cast<PetscInt>();
   setupGradientOperator();
 
   mDetJac = 0;
+  mReferenceStiffness = options->SimplexReferenceStiffness();
+  mRefStiffCoef.setZero();
   mParWork.setZero(mNumIntPnt);
   mStiffWork.setZero(mNumIntPnt);
   mGradWork.setZero(mNumIntPnt, mNumDim);
@@ -109,28 +114,12 @@ Triangle<ConcreteShape>::Triangle(std::unique_ptr<Options> const &options) {
 template <typename ConcreteShape>
 void Triangle<ConcreteShape>::attachVertexCoordinates(std::unique_ptr<Mesh> const &mesh) {
 
-  Vec coordinates_local;
-  PetscInt coordinate_buffer_size;
-  PetscSection coordinate_section;
-  PetscReal *coordinates_buffer = NULL;
-
-  DMGetCoordinatesLocal(mesh->DistributedMesh(), &coordinates_local);
-  DMGetCoordinateSection(mesh->DistributedMesh(), &coordinate_section);
-  DMPlexVecGetClosure(mesh->DistributedMesh(), coordinate_section, coordinates_local, mElmNum,
-                      &coordinate_buffer_size, &coordinates_buffer);
-  std::vector<PetscReal> coordinates_element(coordinates_buffer, coordinates_buffer+coordinate_buffer_size);
-  DMPlexVecRestoreClosure(mesh->DistributedMesh(), coordinate_section, coordinates_local, mElmNum,
-                          &coordinate_buffer_size, &coordinates_buffer);
-    
-  for (int i = 0; i < mNumVtx; i++) {        
-    mVtxCrd(i,0) = coordinates_element[mNumDim*i+0];
-    mVtxCrd(i,1) = coordinates_element[mNumDim*i+1];
-  }
+  // Coordinates were extracted for all elements when the mesh was distributed.
+  mVtxCrd = mesh->ElementVertexCoordinates(mElmNum);
 
   // Save element center
-  mElmCtr <<
-    mVtxCrd.col(0).mean(),
-    mVtxCrd.col(1).mean();
+  mElmCtr = mesh->ElementCenters().row(mElmNum).transpose();
+  mModElm = mesh->ModelElement(mElmNum);
 }
 
 template <typename ConcreteShape>
@@ -165,10 +154,18 @@ double Triangle<ConcreteShape>::estimatedElementRadius() {
 template <typename ConcreteShape>
 void Triangle<ConcreteShape>::attachMaterialProperties(std::unique_ptr<ExodusModel> const &model, std::string parameter_name) {
 
+  /* Use the material sampled at the integration points by an earlier run, if there is one. */
+  const PetscReal *cached = mModElm >= 0 ?
+      model->CachedParameterAtIntPts(mModElm, parameter_name, mNumIntPnt) : NULL;
+  if (cached) { mParIntPts[parameter_name] = Eigen::Map<const RealVec>(cached, mNumIntPnt); return; }
+  mParIntPts.erase(parameter_name);
+
   Vector3d material_at_vertices;
 
   for (auto i = 0; i < mNumVtx; i++) {
-    material_at_vertices(i) = model->getElementalMaterialParameterAtVertex(mElmCtr, parameter_name, i);
+    material_at_vertices(i) = mModElm >= 0 ?
+        model->getElementalMaterialParameterAtVertex(mModElm, parameter_name, i) :
+        model->getElementalMaterialParameterAtVertex(mElmCtr, parameter_name, i);
   }
   mPar[parameter_name] = material_at_vertices;
 }
@@ -321,6 +318,8 @@ std::vector<PetscInt> Triangle<ConcreteShape>::getDofsOnFace(const PetscInt face
 
 template <typename ConcreteShape>
 VectorXd Triangle<ConcreteShape>::applyGradTestAndIntegrate(const Ref<const MatrixXd>& f) {
+  if (mPlyOrd == 3) { gradTestAndIntegrateKernel<12>(f); return mStiffWork; }
+
   Vector2d refGrad;
   Vector2d phyGrad;
 
@@ -345,6 +344,22 @@ VectorXd Triangle<ConcreteShape>::applyGradTestAndIntegrate(const Ref<const Matr
   return mStiffWork;
 }
 
+template <typename ConcreteShape>
+template <int N>
+void Triangle<ConcreteShape>::gradTestAndIntegrateKernel(const Ref<const MatrixXd>& f) {
+
+  Map<const Matrix<double,N,N>> dr(mGradientPhi_dr.data()), ds(mGradientPhi_ds.data());
+  Map<const Matrix<double,N,1>> wgt(mIntegrationWeights.data());
+  Map<Matrix<double,N,1>> stiff(mStiffWork.data());
+
+  /* Rows of f mapped by the inverse Jacobian (f_j^T invJ = (invJ^T f_j)^T), and weighted. */
+  Matrix<double,N,2> flux = wgt.asDiagonal() * (f.template topLeftCorner<N,2>() * mInvJac);
+  stiff.noalias() = dr * flux.col(0);
+  stiff.noalias() += ds * flux.col(1);
+  stiff *= mDetJac;
+
+}
+
 template <typename ConcreteShape>
 VectorXd Triangle<ConcreteShape>::applyTestAndIntegrate(const Ref<const VectorXd> &f) {
 
@@ -358,12 +373,148 @@ template <typename ConcreteShape>
 void Triangle<ConcreteShape>::precomputeElementTerms() {
   std::tie(mInvJac,mDetJac) = ConcreteShape::inverseJacobian(mVtxCrd);
   mInvJacT = mInvJac.transpose();
-  mElementStiffnessMatrix = buildStiffnessMatrix(ParAtIntPts("VP"));
+  if (mReferenceStiffness) {
+    /* The metric is constant on the (affine) element, so only three coefficients are needed. The
+     * material is applied from the GLL points by the physics (see applyReferenceStiffness). */
+    mInvJacT_x_invJac = mInvJacT * mInvJac;
+    mRefStiffCoef << mDetJac * mInvJacT_x_invJac(0,0), mDetJac * mInvJacT_x_invJac(0,1),
+      mDetJac * mInvJacT_x_invJac(1,1);
+  } else {
+    mElementStiffnessMatrix = buildStiffnessMatrix(ParAtIntPts("VP"));
+  }
+}
+
+template <typename ConcreteShape>
+Eigen::Map<RealVec> Triangle<ConcreteShape>::applyReferenceStiffness(const Ref<const RealVec>& u,
+                                                                     const Ref<const RealVec>& coef) {
+
+  if (mPlyOrd == 3) {
+    Eigen::Map<RealVec> stiff = Scratch::Vector(Scratch::ShapeStiff, mNumIntPnt);
+    referenceStiffnessKernel<12>(u, coef, stiff);
+    return stiff;
+  }
+
+  // Reference gradient (D_r^T u, D_s^T u).
+  Eigen::Map<RealMat> grad = Scratch::Matrix(Scratch::ShapeGrad, mNumIntPnt, mNumDim);
+  grad.col(0).noalias() = mGradientPhi_dr.transpose() * u;
+  grad.col(1).noalias() = mGradientPhi_ds.transpose() * u;
+
+  // Contract with the metric, and weight.
+  Eigen::Map<RealMat> flux = Scratch::Matrix(Scratch::ShapeFlux, mNumIntPnt, mNumDim);
+  RealVec wc = mIntegrationWeights.array() * coef.array();
+  flux.col(0) = wc.array() * (mRefStiffCoef(0) * grad.col(0) + mRefStiffCoef(1) * grad.col(1)).array();
+  flux.col(1) = wc.array() * (mRefStiffCoef(1) * grad.col(0) + mRefStiffCoef(2) * grad.col(1)).array();
+
+  // Apply the derivatives of the test functions.
+  Eigen::Map<RealVec> stiff = Scratch::Vector(Scratch::ShapeStiff, mNumIntPnt);
+  stiff.noalias() = mGradientPhi_dr * flux.col(0);
+  stiff.noalias() += mGradientPhi_ds * flux.col(1);
+  return stiff;
+
+}
+
+template <typename ConcreteShape>
+template <int N>
+void Triangle<ConcreteShape>::referenceStiffnessKernel(const Ref<const RealVec>& u, const Ref<const RealVec>& coef,
+                                                       Eigen::Map<RealVec> &stiff) {
+
+  Map<const Matrix<double,N,N>> dr(mGradientPhi_dr.data()), ds(mGradientPhi_ds.data());
+  Map<const Matrix<double,N,1>> wgt(mIntegrationWeights.data());
+
+  // Reference gradient, contracted with the metric and weighted.
+  Matrix<double,N,1> gr, gs, wc;
+  gr.noalias() = dr.transpose() * u.template head<N>();
+  gs.noalias() = ds.transpose() * u.template head<N>();
+  wc = wgt.cwiseProduct(coef.template head<N>());
+  Matrix<double,N,1> fr = wc.cwiseProduct(mRefStiffCoef(0) * gr + mRefStiffCoef(1) * gs);
+  Matrix<double,N,1> fs = wc.cwiseProduct(mRefStiffCoef(1) * gr + mRefStiffCoef(2) * gs);
+
+  // Apply the derivatives of the test functions.
+  stiff.template head<N>().noalias() = dr * fr;
+  stiff.template head<N>().noalias() += ds * fs;
+
+}
+
+template <typename ConcreteShape>
+template <int L>
+void Triangle<ConcreteShape>::referenceStiffnessLanes(const PetscReal *geo, const PetscReal *coef,
+                                                      const PetscReal *u, PetscReal *out, PetscReal *work) {
+
+  if (mPlyOrd == 3) { referenceStiffnessLanesKernel<12, L>(geo, coef, u, out, work); return; }
+
+  typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> LaneMat;
+  const PetscInt n = mNumIntPnt;
+  Eigen::Map<const LaneMat> ul(u, n, L), cl(coef, n, L);
+  Eigen::Map<LaneMat> rl(work, n, L), sl(work + n * L, n, L), outl(out, n, L);
+
+  // Reference gradient of all lanes.
+  rl.noalias() = mGradientPhi_dr.transpose() * ul;
+  sl.noalias() = mGradientPhi_ds.transpose() * ul;
+
+  // Contract with the metric of each lane, and weight (in place).
+  for (PetscInt i = 0; i < n; i++) {
+    for (int l = 0; l < L; l++) {
+      const PetscReal wc = mIntegrationWeights(i) * cl(i, l);
+      const PetscReal r = rl(i, l), s = sl(i, l);
+      rl(i, l) = wc * (geo[3 * l + 0] * r + geo[3 * l + 1] * s);
+      sl(i, l) = wc * (geo[3 * l + 1] * r + geo[3 * l + 2] * s);
+    }
+  }
+
+  // Derivatives of the test functions.
+  outl.noalias() = mGradientPhi_dr * rl;
+  outl.noalias() += mGradientPhi_ds * sl;
+
+}
+
+template <typename ConcreteShape>
+template <int N, int L>
+void Triangle<ConcreteShape>::referenceStiffnessLanesKernel(const PetscReal *geo, const PetscReal *coef,
+                                                            const PetscReal *u, PetscReal *out, PetscReal *work) {
+
+  typedef Eigen::Matrix<double, N, L, Eigen::RowMajor> LaneMat;
+  Map<const Matrix<double,N,N>> dr(mGradientPhi_dr.data()), ds(mGradientPhi_ds.data());
+  Eigen::Map<const LaneMat> ul(u), cl(coef);
+  Eigen::Map<LaneMat> rl(work), sl(work + N * L), outl(out);
+
+  // Reference gradient of all lanes.
+  rl.noalias() = dr.transpose() * ul;
+  sl.noalias() = ds.transpose() * ul;
+
+  // Contract with the metric of each lane, and weight (in place).
+  for (int i = 0; i < N; i++) {
+    for (int l = 0; l < L; l++) {
+      const PetscReal wc = mIntegrationWeights(i) * cl(i, l);
+      const PetscReal r = rl(i, l), s = sl(i, l);
+      rl(i, l) = wc * (geo[3 * l + 0] * r + geo[3 * l + 1] * s);
+      sl(i, l) = wc * (geo[3 * l + 1] * r + geo[3 * l + 2] * s);
+    }
+  }
+
+  // Derivatives of the test functions.
+  outl.noalias() = dr * rl;
+  outl.noalias() += ds * sl;
+
+}
+
+template <typename ConcreteShape>
+template <int N>
+void Triangle<ConcreteShape>::gradientKernel(const Ref<const VectorXd>& field) {
+
+  Map<const Matrix<double,N,N>> dr(mGradientPhi_dr.data()), ds(mGradientPhi_ds.data());
+  Matrix<double,N,2> ref_grad;
+  ref_grad.col(0).noalias() = dr.transpose() * field.template head<N>();
+  ref_grad.col(1).noalias() = ds.transpose() * field.template head<N>();
+  /* Each row is (invJ ref_grad_i)^T. */
+  mGradWork.template topLeftCorner<N,2>().noalias() = ref_grad * mInvJac.transpose();
+
 }
 
 template <typename ConcreteShape>
 MatrixXd Triangle<ConcreteShape>::computeGradient(const Ref<const VectorXd>& field) {
 
+  if (mPlyOrd == 3) { gradientKernel<12>(field); return mGradWork; }
+
   Vector2d phyGrad;
   Vector2d refGrad;
   
@@ -388,12 +539,12 @@ MatrixXd Triangle<ConcreteShape>::computeGradient(const Ref<const VectorXd>& fie
 template <typename ConcreteShape>
 void Triangle<ConcreteShape>::setBoundaryConditions(std::unique_ptr<Mesh> const &mesh) {
   mBndElm = false;
-  for (auto &keys: mesh ->BoundaryElementFaces()) {
-    auto boundary_name = keys.first;
-    auto element_in_boundary = keys.second;
-    if (element_in_boundary.find(mElmNum) != element_in_boundary.end()) {
+  /* The boundaries are looked up in place, not copied for every element. */
+  for (auto &keys: mesh->BoundaryElementFaces()) {
+    auto faces = keys.second.find(mElmNum);
+    if (faces != keys.second.end()) {
       mBndElm = true;
-      mBnd[boundary_name] = element_in_boundary[mElmNum];
+      mBnd[keys.first] = faces->second;
     }
   }
 }
@@ -407,6 +558,9 @@ VectorXd Triangle<ConcreteShape>::getDeltaFunctionCoefficients(const Eigen::Ref<
 template <typename ConcreteShape>
 VectorXd Triangle<ConcreteShape>::ParAtIntPts(const std::string &par) {
 
+  auto cached = mParIntPts.find(par);
+  if (cached != mParIntPts.end()) { return cached->second; }
+
   // interpolate velocity at all nodes
   for(int i=0;i<mNumIntPnt;i++) {
     auto r = mIntegrationCoordinates_r[i];
@@ -448,3 +602,5 @@ VectorXd Triangle<ConcreteShape>::ParAtIntPts(const std::string &par) {
 
 // Instantiate combinatorical cases.
 template class Triangle<TriP1>;
+template void Triangle<TriP1>::referenceStiffnessLanes<ELEMENT_SIMD_LANES>(
+    const PetscReal *, const PetscReal *, const PetscReal *, PetscReal *, PetscReal *);
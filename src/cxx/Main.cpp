@@ -1,6 +1,7 @@
 #include <vector>
 #include <memory>
 #include <iostream>
+#include <string>
 
 #include <petsc.h>
 #include <salvus.h>
@@ -9,70 +10,81 @@ INIT_LOGGING_STATE();
 
 int main(int argc, char *argv[]) {
 
+  /* Receiver output from a background thread (--async-output) needs MPI to allow calls from any thread.
+   * PETSc only asks for the default, so MPI is initialized here first, and finalized after PETSc. */
+  bool async_output = false;
+  for (int i = 1; i < argc; i++) { if (std::string(argv[i]) == "--async-output") { async_output = true; } }
+  if (async_output) {
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+  }
+
   try {
 
     /* Initialize PETSc, MPI, and command line args. */
     PetscInitialize(&argc, &argv, NULL, NULL);
 
+    Profiler::Register();
+
     /* Parse command line options. */
     std::unique_ptr<Options> options(new Options);
     options->setOptions();
+    if (options->Profile()) { Profiler::Enable(options->NumThreads()); }
+    if (options->ProfileCounters()) { Profiler::EnableCounters(); }
+    if (!options->TraceFile().empty()) { Profiler::EnableTrace(options->TraceFile()); }
+
+    /* Read the mesh and model, and set up elements and global dofs, once. */
+    std::unique_ptr<Simulation> simulation(new Simulation(options));
+
+    /* With --rebalance-steps, the elements are timed on the first shot, and set up again on a partition which
+     * balances their measured cost. */
+    if (options->RebalanceSteps()) {
+      std::unique_ptr<Options> first;
+      if (!options->ShotFiles().empty()) { first = Simulation::ShotOptions(argc, argv, options->ShotFiles().front()); }
+      if (simulation->rebalance(first ? first : options)) {
+        simulation.reset();
+        simulation.reset(new Simulation(options));
+      }
+    }
 
-    /* Use options to allocate simulation components. */
-    std::unique_ptr<Mesh> mesh(Mesh::Factory(options));
-    std::unique_ptr<Problem> problem(Problem::Factory(options));
-    std::unique_ptr<ExodusModel> model(new ExodusModel(options));
-
-    /* Initialize relevant components and perform parallel decomposition. */
-    mesh->read();
-    model->read();
-
-    /* Attach physics. Use this to inform the element generation. */
-    mesh->setupTopology(model, options);
-
-    /* Use mesh topology to generate our master list of elements. */
-    auto elements = problem->initializeElements(mesh, model, options);
-
-    /* Use elements to inform the global DOF layout. */
-    mesh->setupGlobalDof(elements[0], options);
-
-    auto fields = problem->initializeGlobalDofs(elements, mesh);
-
-    /* Compute solution in time. */
-    /* TODO: Make this something like problem->solve()? */
-    PetscReal time = 0;
-    PetscInt time_idx = 0;
-    while (time < options->Duration()) {
-
-      /* Sum up all forces. */
-      std::tie(elements, fields) = problem->assembleIntoGlobalDof(
-          std::move(elements), std::move(fields), time, time_idx,
-          mesh->DistributedMesh(), mesh->MeshSection(), options);
-
-      /* Apply inverse mass matrix. */
-      fields = problem->applyInverseMassMatrix(std::move(fields));
-
-      /* Advance time. */
-      std::tie(fields, time) = problem->takeTimeStep(
-          std::move(fields), time, options);
-
-      time_idx++;
-
-      problem->saveSolution(
-          time, options->MovieFields(), fields, mesh->DistributedMesh());
-
-      if (!PetscGlobalRank) { std::cout << "TIME: " << time << '\r'; std::cout.flush(); }
-
+    /* Run the shot on the command line, or each shot file in turn on the same elements. A gradient runs the
+     * adjoint of the shot on the command line, with the adjoint sources of its own shot file, or those of its
+     * misfit against the observed data (of each shot file in turn). */
+    if (options->DryRun()) {
+      simulation->dryRun(options);
+    } else if (!options->AdjointShotFile().empty()) {
+      simulation->runAdjoint(options, Simulation::ShotOptions(argc, argv, options->AdjointShotFile()));
+    } else if (!options->ObservedDataFile().empty()) {
+      if (options->ShotFiles().empty()) { simulation->runGradient(options); }
+      for (auto &file: options->ShotFiles()) {
+        LOG() << "Running the gradient of shot " << file << ".";
+        simulation->runGradient(Simulation::ShotOptions(argc, argv, file));
+      }
+    } else if (options->Reciprocal()) {
+      simulation->runReciprocal(options);
+    } else if (options->ShotFiles().empty()) {
+      simulation->run(options);
+    } else {
+      for (auto &file: options->ShotFiles()) {
+        LOG() << "Running shot " << file << ".";
+        simulation->run(Simulation::ShotOptions(argc, argv, file));
+      }
     }
+
+    /* Time per phase (with --profile), and the trace of all ranks (with --trace-file). */
+    Profiler::summary();
+    Profiler::writeTrace();
   }
 
   /* TODO: Better MPI error handling. */
   catch (std::runtime_error &e) {
     LOG() << e.what();
     PetscFinalize();
+    if (async_output) { MPI_Finalize(); }
     exit(1);
   }
 
   PetscFinalize();
+  if (async_output) { MPI_Finalize(); }
 
 }
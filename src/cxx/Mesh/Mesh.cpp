@@ -1,5 +1,13 @@
 #include <petscviewerhdf5.h>
 #include <stdexcept>
+#include <numeric>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <array>
+#include <random>
+#include <map>
+#include <cctype>
 
 #include <mpi.h>
 #include <fstream>
@@ -8,6 +16,8 @@
 #include <Utilities/Options.h>
 #include <Utilities/Utilities.h>
 #include <Utilities/Logging.h>
+#include <Utilities/Memory.h>
+#include <Utilities/Profiler.h>
 #include <petscdmplex.h>
 #include <Utilities/Types.h>
 
@@ -22,6 +32,10 @@ Mesh::Mesh(const std::unique_ptr<Options> &options) {
   mDistributedMesh = NULL;
   mMeshSection = NULL;
   mNumDim = 0;
+  mExodusCells = false;
+  mOverlap = options->HaloOverlap();
+  mHierarchical = options->HierarchicalPartitioning();
+  mNodeOrder = options->NodeOrder();
 }
 
 std::unique_ptr<Mesh> Mesh::Factory(const std::unique_ptr<Options> &options) {
@@ -33,27 +47,216 @@ void Mesh::read(int dim, int numCells, int numVerts, int numVertsPerElem,
 
   // Class variables.
   mDistributedMesh = NULL;
+  mExodusCells = false;
   DM dm = NULL;
   PetscBool interpolate_edges = PETSC_TRUE;
   
   DMPlexCreateFromCellList(PETSC_COMM_WORLD, dim, numCells, numVerts, numVertsPerElem,
                            interpolate_edges, cells, dim, vertex_coords,&dm);
+  PetscPartitioner partitioner; DMPlexGetPartitioner(dm, &partitioner);
+  PetscPartitionerSetFromOptions(partitioner);
   
-  DMPlexDistribute(dm, 0, NULL, &mDistributedMesh);
+  distribute(dm);
+}
+
+void Mesh::readBox(unique_ptr<Options> const &options) {
 
-  // We don't need the serial mesh anymore.
+  const std::vector<PetscInt> n = options->BoxElements();
+  const std::vector<PetscReal> extent = options->BoxExtent();
+  const PetscInt dim = n.size();
+  if (dim != 2 && dim != 3) { throw std::runtime_error("A box mesh needs 2 or 3 dimensions."); }
+  const bool simplex = options->BoxSimplex();
+
+  /* As for an exodus mesh, all cells are built on the first rank, and distributed from there. */
+  PetscInt rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+  std::vector<int> cells;
+  std::vector<double> coords;
+  PetscInt num_verts = 0, num_cells = 0, verts_per_cell = dim == 2 ? (simplex ? 3 : 4) : (simplex ? 4 : 8);
+  if (!rank) {
+
+    std::array<PetscInt, 3> nv = {{1, 1, 1}};
+    for (PetscInt d = 0; d < dim; d++) { nv[d] = n[d] + 1; }
+    num_verts = nv[0] * nv[1] * nv[2];
+    auto vtx = [&](const PetscInt i, const PetscInt j, const PetscInt k) { return i + nv[0] * (j + nv[1] * k); };
+
+    /* Vertices, of which those inside the box are perturbed. */
+    std::mt19937 generator(options->BoxSeed());
+    std::uniform_real_distribution<double> shift(-options->BoxPerturbation(), options->BoxPerturbation());
+    coords.resize(num_verts * dim);
+    for (PetscInt k = 0; k < nv[2]; k++) {
+      for (PetscInt j = 0; j < nv[1]; j++) {
+        for (PetscInt i = 0; i < nv[0]; i++) {
+          const std::array<PetscInt, 3> idx = {{i, j, k}};
+          bool interior = true;
+          for (PetscInt d = 0; d < dim; d++) { interior = interior && idx[d] > 0 && idx[d] < n[d]; }
+          for (PetscInt d = 0; d < dim; d++) {
+            const double offset = interior && options->BoxPerturbation() ? shift(generator) : 0;
+            coords[vtx(i, j, k) * dim + d] = extent[d] * (idx[d] + offset) / n[d];
+          }
+        }
+      }
+    }
+
+    /* Corners of a quad (counter clockwise) and of a hexahedron (bottom face oriented inwards), and their split
+     * into simplices. All cells are split alike, so the triangles and tetrahedra (Kuhn's triangulation, around
+     * the diagonal from corner 0 to the opposite one) of neighbouring cells conform. */
+    typedef std::array<PetscInt, 3> Corner;
+    const std::vector<Corner> quad = {{{0, 0, 0}}, {{1, 0, 0}}, {{1, 1, 0}}, {{0, 1, 0}}};
+    const std::vector<Corner> hex = {{{0, 0, 0}}, {{0, 1, 0}}, {{1, 1, 0}}, {{1, 0, 0}},
+                                     {{0, 0, 1}}, {{1, 0, 1}}, {{1, 1, 1}}, {{0, 1, 1}}};
+    std::vector<std::vector<Corner>> shapes;
+    if (!simplex) {
+      shapes.push_back(dim == 2 ? quad : hex);
+    } else if (dim == 2) {
+      shapes = {{quad[0], quad[1], quad[2]}, {quad[0], quad[2], quad[3]}};
+    } else {
+      std::array<PetscInt, 3> axes = {{0, 1, 2}};
+      do {
+        std::vector<Corner> tet(1, Corner{{0, 0, 0}});
+        for (auto axis: axes) { Corner c = tet.back(); c[axis] = 1; tet.push_back(c); }
+        /* Orient as the reference tetrahedron: the first face, seen from the last vertex, runs clockwise. */
+        Eigen::Matrix3d edges;
+        for (PetscInt e = 0; e < 3; e++) {
+          for (PetscInt d = 0; d < 3; d++) { edges(e, d) = tet[e + 1][d] - tet[0][d]; }
+        }
+        if (edges.determinant() > 0) { std::swap(tet[1], tet[2]); }
+        shapes.push_back(tet);
+      } while (std::next_permutation(axes.begin(), axes.end()));
+    }
+
+    for (PetscInt k = 0; k < nv[2] - (dim == 3); k++) {
+      for (PetscInt j = 0; j < nv[1] - 1; j++) {
+        for (PetscInt i = 0; i < nv[0] - 1; i++) {
+          for (auto &shape: shapes) {
+            for (auto &c: shape) { cells.push_back(vtx(i + c[0], j + c[1], k + c[2])); }
+          }
+        }
+      }
+    }
+    num_cells = cells.size() / verts_per_cell;
+    LOG() << "Built a box mesh of " << num_cells << " " << (simplex ? "simplices" : "elements") << " and "
+          << num_verts << " vertices.";
+
+  }
+
+  read(dim, num_cells, num_verts, verts_per_cell, cells.data(), coords.data());
+
+}
+
+void Mesh::distribute(DM dm, PetscSF *migration) {
+
+  Profiler::Scope scope(Profiler::Distribute);
+  mDistributedMesh = NULL;
+  PetscSF sf = NULL;
+  DMPlexDistribute(dm, mOverlap, &sf, &mDistributedMesh);
+
+  /* We don't need the serial mesh anymore if we're in parallel. */
   if (mDistributedMesh) { DMDestroy(&dm); }
-    // mDistributedMesh == NULL when only 1 proc is used.
+  /* mDistributedMesh == NULL when only 1 proc is used. */
   else { mDistributedMesh = dm; }
 
   DMGetDimension(mDistributedMesh, &mNumDim);
+  // Get number of elements (duh.)
   DMPlexGetDepthStratum(mDistributedMesh, mNumDim, NULL, &mNumberElementsLocal);
+
+  /* The serial cells of an exodus mesh are numbered as in the file, so the migration tells which model
+   * element each local cell is. */
+  mElmModelIdx.clear();
+  if (mExodusCells) {
+    mElmModelIdx.resize(mNumberElementsLocal);
+    for (PetscInt i = 0; i < mNumberElementsLocal; i++) { mElmModelIdx[i] = i; }
+    if (sf) {
+      PetscInt num_leaves; const PetscInt *leaf_loc; const PetscSFNode *leaf_rmt;
+      PetscSFGetGraph(sf, NULL, &num_leaves, &leaf_loc, &leaf_rmt);
+      for (PetscInt i = 0; i < num_leaves; i++) {
+        const PetscInt p = leaf_loc ? leaf_loc[i] : i;
+        if (p < mNumberElementsLocal) { mElmModelIdx[p] = leaf_rmt[i].index; }
+      }
+    }
+  }
+
+  /* With overlapping cells, which cells of a rank are its own, and their number across ranks. */
+  mElmGlbNum.clear();
+  if (mOverlap) {
+    IS numbering; DMPlexGetCellNumbering(mDistributedMesh, &numbering);
+    const PetscInt *num; ISGetIndices(numbering, &num);
+    mElmGlbNum.assign(num, num + mNumberElementsLocal);
+    ISRestoreIndices(numbering, &num);
+  }
+  if (migration) { *migration = sf; }
+  else if (sf) { PetscSFDestroy(&sf); }
+
+  extractElementCoordinates();
+
 }
 
-void Mesh::read() {
+void Mesh::extractElementCoordinates() {
+
+  Vec coord;
+  DMGetCoordinatesLocal(mDistributedMesh, &coord);
+  PetscSection coord_section;
+  DMGetCoordinateSection(mDistributedMesh, &coord_section);
+
+  mElmVtx.clear(); mElmVtxOff.assign(1, 0);
+  mElmFace.clear(); mElmFaceNbr.clear(); mElmFaceOff.assign(1, 0);
+  mElmCls.clear(); mElmClsOff.assign(1, 0);
+  mElmCtr.setZero(mNumberElementsLocal, mNumDim);
+  for (PetscInt e = 0; e < mNumberElementsLocal; e++) {
+    PetscInt coord_buf_size;
+    PetscReal *coord_buf = NULL;
+    DMPlexVecGetClosure(mDistributedMesh, coord_section, coord, e, &coord_buf_size, &coord_buf);
+    mElmVtx.insert(mElmVtx.end(), coord_buf, coord_buf + coord_buf_size);
+    DMPlexVecRestoreClosure(mDistributedMesh, coord_section, coord, e, &coord_buf_size, &coord_buf);
+    mElmVtxOff.push_back(mElmVtx.size());
+    mElmCtr.row(e) = ElementVertexCoordinates(e).colwise().mean();
+
+    /* Faces in cone order, each with the other cell of its support. */
+    PetscInt csize; DMPlexGetConeSize(mDistributedMesh, e, &csize);
+    const PetscInt *cone; DMPlexGetCone(mDistributedMesh, e, &cone);
+    for (PetscInt i = 0; i < csize; i++) {
+      PetscInt ssize; DMPlexGetSupportSize(mDistributedMesh, cone[i], &ssize);
+      const PetscInt *supp; DMPlexGetSupport(mDistributedMesh, cone[i], &supp);
+      PetscInt nbr = -1;
+      for (PetscInt j = 0; j < ssize; j++) { if (supp[j] != e) { nbr = supp[j]; } }
+      mElmFace.push_back(cone[i]); mElmFaceNbr.push_back(nbr);
+    }
+    mElmFaceOff.push_back(mElmFace.size());
+
+    /* The closure, with its orientations. */
+    PetscInt num_closure, *pts_closure = NULL;
+    DMPlexGetTransitiveClosure(mDistributedMesh, e, PETSC_TRUE, &num_closure, &pts_closure);
+    mElmCls.insert(mElmCls.end(), pts_closure, pts_closure + 2 * num_closure);
+    DMPlexRestoreTransitiveClosure(mDistributedMesh, e, PETSC_TRUE, &num_closure, &pts_closure);
+    mElmClsOff.push_back(mElmCls.size());
+  }
+
+}
+
+void Mesh::read(const std::function<void()> &loaded) {
+
+  /* Read mesh. The partitioner may be chosen at runtime (e.g. -petscpartitioner_type parmetis), which
+   * partitions in parallel when the mesh was read in chunks. */
+  DM dm = load();
+  if (loaded) { loaded(); }
+  PetscPartitioner partitioner; DMPlexGetPartitioner(dm, &partitioner);
+  PetscPartitionerSetFromOptions(partitioner);
+
+  /* Distribute mesh. */
+  distribute(dm);
+
+}
+
+bool Mesh::isParallelMeshFile(const std::string &filename) {
+  const std::string ext = ".h5";
+  return filename.size() > ext.size() && filename.compare(filename.size() - ext.size(), ext.size(), ext) == 0;
+}
+
+DM Mesh::load() {
 
   // Class variables.
   mDistributedMesh = NULL;
+  mElmVtx.clear(); mElmVtxOff.clear(); mElmFace.clear(); mElmFaceNbr.clear(); mElmFaceOff.clear();
+  mElmCls.clear(); mElmClsOff.clear();
 
   // check if file exists
   PetscInt rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
@@ -69,19 +272,401 @@ void Mesh::read() {
   DM dm = NULL;
   PetscBool interpolate_edges = PETSC_TRUE;
 
-  /* Read exodus file. */
-  DMPlexCreateExodusFromFile(PETSC_COMM_WORLD, mExodusFileName.c_str(), interpolate_edges, &dm);
+  if (isParallelMeshFile(mExodusFileName)) {
+    /* DMPlex HDF5 file (see save). Every rank reads a contiguous chunk of the cells, so the full mesh
+     * is never held by a single rank, and the distribution below starts from these chunks. */
+    PetscViewer viewer;
+    PetscViewerHDF5Open(PETSC_COMM_WORLD, mExodusFileName.c_str(), FILE_MODE_READ, &viewer);
+    DMCreate(PETSC_COMM_WORLD, &dm);
+    DMSetType(dm, DMPLEX);
+    DMLoad(dm, viewer);
+    PetscViewerDestroy(&viewer);
+    mExodusCells = false;
+  } else {
+    /* Read exodus file. The whole mesh is built on the first rank. */
+    DMPlexCreateExodusFromFile(PETSC_COMM_WORLD, mExodusFileName.c_str(), interpolate_edges, &dm);
+    mExodusCells = true;
+  }
+  return dm;
 
-  /* Distribute mesh. */
-  DMPlexDistribute(dm, 0, NULL, &mDistributedMesh);
+}
 
-  /* We don't need the serial mesh anymore if we're in parallel. */
-  if (mDistributedMesh) { DMDestroy(&dm); }
-  else { mDistributedMesh = dm; }
+void Mesh::save(const std::string &filename) {
 
-  DMGetDimension(mDistributedMesh, &mNumDim);
-  // Get number of elements (duh.)
-  DMPlexGetDepthStratum(mDistributedMesh, mNumDim, NULL, &mNumberElementsLocal);
+  PetscViewer viewer;
+  PetscViewerHDF5Open(PETSC_COMM_WORLD, filename.c_str(), FILE_MODE_WRITE, &viewer);
+  DMView(mDistributedMesh, viewer);
+  PetscViewerDestroy(&viewer);
+
+}
+
+/**
+ * Recursive coordinate bisection: split cells [beg, end) into num_parts parts of about equal weight (or of weight
+ * in proportion to the capacity of each part, if given), numbered from first_part, by cutting along the longest
+ * extent of their centers.
+ */
+static void bisectCells(const RealMat &ctr, const std::vector<PetscReal> &weight,
+                        std::vector<PetscInt>::iterator beg, std::vector<PetscInt>::iterator end,
+                        const PetscInt first_part, const PetscInt num_parts, std::vector<PetscInt> &part,
+                        const std::vector<PetscReal> &capacity = std::vector<PetscReal>()) {
+
+  if (num_parts == 1 || end - beg < 2) {
+    for (auto c = beg; c != end; c++) { part[*c] = first_part; }
+    return;
+  }
+
+  /* Longest extent of the cell centers. */
+  PetscInt axis = 0; PetscReal extent = -1;
+  for (PetscInt d = 0; d < ctr.cols(); d++) {
+    PetscReal lo = ctr(*beg, d), hi = ctr(*beg, d);
+    for (auto c = beg; c != end; c++) { lo = std::min(lo, ctr(*c, d)); hi = std::max(hi, ctr(*c, d)); }
+    if (hi - lo > extent) { extent = hi - lo; axis = d; }
+  }
+  std::sort(beg, end, [&](PetscInt a, PetscInt b) { return ctr(a, axis) < ctr(b, axis); });
+
+  /* Cut where the lower parts receive their share of the weight. */
+  const PetscInt num_lower = num_parts / 2;
+  PetscReal share = static_cast<PetscReal>(num_lower) / num_parts;
+  if (!capacity.empty()) {
+    auto first = capacity.begin() + first_part;
+    share = std::accumulate(first, first + num_lower, 0.0) / std::accumulate(first, first + num_parts, 0.0);
+  }
+  PetscReal total = 0, lower = 0;
+  for (auto c = beg; c != end; c++) { total += weight[*c]; }
+  auto cut = beg;
+  while (cut != end - 1 && lower + 0.5 * weight[*cut] < total * share) { lower += weight[*cut++]; }
+  if (cut == beg) { cut++; }
+
+  bisectCells(ctr, weight, beg, cut, first_part, num_lower, part, capacity);
+  bisectCells(ctr, weight, cut, end, first_part + num_lower, num_parts - num_lower, part, capacity);
+
+}
+
+/* Order of two host names with their numbers compared by value, so that node9 comes before node10. */
+static bool hostNameLess(const std::string &a, const std::string &b) {
+  size_t i = 0, j = 0;
+  while (i < a.size() && j < b.size()) {
+    if (std::isdigit(a[i]) && std::isdigit(b[j])) {
+      size_t ei = i, ej = j;
+      while (ei < a.size() && std::isdigit(a[ei])) { ei++; }
+      while (ej < b.size() && std::isdigit(b[ej])) { ej++; }
+      const std::string na = a.substr(i, ei - i), nb = b.substr(j, ej - j);
+      const size_t za = na.find_first_not_of('0'), zb = nb.find_first_not_of('0');
+      const std::string va = za == std::string::npos ? "" : na.substr(za);
+      const std::string vb = zb == std::string::npos ? "" : nb.substr(zb);
+      if (va.size() != vb.size()) { return va.size() < vb.size(); }
+      if (va != vb) { return va < vb; }
+      i = ei; j = ej;
+    } else {
+      if (a[i] != b[j]) { return a[i] < b[j]; }
+      i++; j++;
+    }
+  }
+  return a.size() - i < b.size() - j;
+}
+
+std::vector<std::vector<PetscInt>> Mesh::nodeRanks() const {
+
+  PetscMPIInt rank, size; MPI_Comm_rank(PETSC_COMM_WORLD, &rank); MPI_Comm_size(PETSC_COMM_WORLD, &size);
+  MPI_Comm node; MPI_Comm_split_type(PETSC_COMM_WORLD, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &node);
+  PetscMPIInt first = rank; MPI_Allreduce(MPI_IN_PLACE, &first, 1, MPI_INT, MPI_MIN, node);
+  MPI_Comm_free(&node);
+  std::vector<PetscMPIInt> first_of(size);
+  MPI_Allgather(&first, 1, MPI_INT, first_of.data(), 1, MPI_INT, PETSC_COMM_WORLD);
+
+  /* The host name of every rank, to order the nodes by, if asked to. */
+  std::vector<char> names(mNodeOrder == "hostname" ? size * MPI_MAX_PROCESSOR_NAME : 0);
+  if (!names.empty()) {
+    char name[MPI_MAX_PROCESSOR_NAME] = {0}; int len; MPI_Get_processor_name(name, &len);
+    MPI_Allgather(name, MPI_MAX_PROCESSOR_NAME, MPI_CHAR, names.data(), MPI_MAX_PROCESSOR_NAME, MPI_CHAR,
+                  PETSC_COMM_WORLD);
+  }
+  auto host = [&](const PetscInt r) { return std::string(names.data() + r * MPI_MAX_PROCESSOR_NAME); };
+
+  std::map<PetscMPIInt, std::vector<PetscInt>> ranks_of;
+  for (PetscMPIInt r = 0; r < size; r++) { ranks_of[first_of[r]].push_back(r); }
+  std::vector<std::vector<PetscInt>> nodes;
+  for (auto &n: ranks_of) { nodes.push_back(n.second); }
+  if (!names.empty()) {
+    std::stable_sort(nodes.begin(), nodes.end(), [&](const std::vector<PetscInt> &a, const std::vector<PetscInt> &b) {
+      return hostNameLess(host(a.front()), host(b.front()));
+    });
+  }
+  return nodes;
+
+}
+
+void Mesh::partitionCells(const RealMat &ctr, const std::vector<PetscReal> &weight,
+                          const std::vector<std::vector<PetscInt>> &nodes, std::vector<PetscInt> &part) const {
+
+  PetscInt num_ranks = 0; for (auto &n: nodes) { num_ranks += n.size(); }
+  const PetscInt num_cells = weight.size();
+  std::vector<PetscInt> cells(num_cells); part.assign(num_cells, 0);
+  for (PetscInt i = 0; i < num_cells; i++) { cells[i] = i; }
+  if (!mHierarchical || nodes.size() < 2) {
+    bisectCells(ctr, weight, cells.begin(), cells.end(), 0, num_ranks, part);
+    return;
+  }
+
+  /* First onto the nodes, each taking a share of the weight in proportion to its ranks, then within each node
+   * onto its ranks. Neighbouring parts of the first bisection are neighbours in the order of the nodes. */
+  std::vector<PetscReal> capacity;
+  for (auto &n: nodes) { capacity.push_back(n.size()); }
+  std::vector<PetscInt> node_part(num_cells);
+  bisectCells(ctr, weight, cells.begin(), cells.end(), 0, nodes.size(), node_part, capacity);
+  std::vector<std::vector<PetscInt>> node_cells(nodes.size());
+  for (PetscInt i = 0; i < num_cells; i++) { node_cells[node_part[i]].push_back(i); }
+  std::vector<PetscInt> rank_part(num_cells);
+  std::vector<PetscReal> node_cost(nodes.size(), 0);
+  for (size_t k = 0; k < nodes.size(); k++) {
+    bisectCells(ctr, weight, node_cells[k].begin(), node_cells[k].end(), 0, nodes[k].size(), rank_part);
+    for (auto c: node_cells[k]) { part[c] = nodes[k][rank_part[c]]; node_cost[k] += weight[c] / nodes[k].size(); }
+  }
+
+  if (num_cells) {
+    const PetscReal mean = std::accumulate(weight.begin(), weight.end(), 0.0) / num_ranks;
+    LOG() << "Hierarchical partitioning over " << nodes.size() << " nodes: max/mean cost per rank of a node "
+          << *std::max_element(node_cost.begin(), node_cost.end()) / mean;
+  }
+
+}
+
+void Mesh::weightedPartition(DM dm, unique_ptr<ExodusModel> const &model, unique_ptr<Options> const &options,
+                             std::vector<PetscInt> &sizes, std::vector<PetscInt> &points) {
+
+  PetscInt num_ranks; MPI_Comm_size(PETSC_COMM_WORLD, &num_ranks);
+
+  /* Estimate the cost of each (serial) cell from its physics, through the coordinate queries on mDistributedMesh. */
+  mDistributedMesh = dm;
+  DMGetDimension(dm, &mNumDim);
+  PetscInt num_cells; DMPlexGetDepthStratum(dm, mNumDim, NULL, &num_cells);
+  RealMat ctr(num_cells, mNumDim);
+  std::vector<std::string> type(num_cells);
+  for (PetscInt i = 0; i < num_cells; i++) {
+    RealMat vtx = getElementCoordinateClosure(i);
+    for (PetscInt j = 0; j < mNumDim; j++) { ctr(i, j) = vtx.col(j).mean(); }
+    /* The serial cells of an exodus mesh are the model elements. */
+    type[i] = model->getElementType(i);
+  }
+  mDistributedMesh = NULL;
+  std::vector<PetscReal> weight(num_cells);
+  for (PetscInt i = 0; i < num_cells; i++) {
+    auto cost = options->ElementCosts().find(type[i]);
+    if (cost == options->ElementCosts().end()) {
+      throw std::runtime_error("No element cost given for physics '" + type[i] + "'. Set --element-costs.");
+    }
+    /* Cells sharing a face with a different physics also compute the coupling terms. */
+    bool coupled = false;
+    PetscInt num_faces; const PetscInt *faces = NULL;
+    DMPlexGetConeSize(dm, i, &num_faces); DMPlexGetCone(dm, i, &faces);
+    for (PetscInt j = 0; j < num_faces && !coupled; j++) {
+      PetscInt num_supp; const PetscInt *supp = NULL;
+      DMPlexGetSupportSize(dm, faces[j], &num_supp); DMPlexGetSupport(dm, faces[j], &supp);
+      for (PetscInt k = 0; k < num_supp; k++) { if (type[supp[k]] != type[i]) { coupled = true; } }
+    }
+    weight[i] = cost->second * (coupled ? 1 + options->CouplingCost() : 1);
+  }
+
+  /* Assign the cells to ranks. */
+  std::vector<PetscInt> part;
+  partitionCells(ctr, weight, nodeRanks(), part);
+  sizes.assign(num_ranks, 0); points.clear();
+  std::vector<PetscReal> rank_cost(num_ranks, 0);
+  for (PetscInt i = 0; i < num_cells; i++) { sizes[part[i]]++; rank_cost[part[i]] += weight[i]; }
+  for (PetscInt r = 0; r < num_ranks; r++) {
+    for (PetscInt i = 0; i < num_cells; i++) { if (part[i] == r) { points.push_back(i); } }
+  }
+  if (num_cells) {
+    PetscReal mean = std::accumulate(rank_cost.begin(), rank_cost.end(), 0.0) / num_ranks;
+    LOG() << "Weighted partitioning: max/mean rank cost "
+          << *std::max_element(rank_cost.begin(), rank_cost.end()) / mean;
+  }
+
+}
+
+/* Write a partition in the layout of the shell partitioner, keyed by the mesh file contents and the number of
+ * ranks (see Mesh::readPartitionCache). */
+static void writePartitionFile(const std::string &filename, const unsigned long long hash, const PetscInt num_cells,
+                               const std::vector<PetscInt> &sizes, const std::vector<PetscInt> &points) {
+  const PetscInt num_ranks = sizes.size();
+  std::ofstream f(filename.c_str(), std::ios::binary);
+  f.write(reinterpret_cast<const char*>(&hash), sizeof(hash));
+  f.write(reinterpret_cast<const char*>(&num_ranks), sizeof(num_ranks));
+  f.write(reinterpret_cast<const char*>(&num_cells), sizeof(num_cells));
+  f.write(reinterpret_cast<const char*>(sizes.data()), num_ranks * sizeof(PetscInt));
+  f.write(reinterpret_cast<const char*>(points.data()), num_cells * sizeof(PetscInt));
+  if (!f) { LOG() << "Warning: could not write partition cache '" << filename << "'."; }
+}
+
+bool Mesh::readPartitionCache(const std::string &filename, const PetscInt num_cells,
+                              std::vector<PetscInt> &sizes, std::vector<PetscInt> &points) {
+
+  /* Only the first rank holds (serial) cells, and reads the cache. */
+  PetscInt rank, num_ranks; MPI_Comm_rank(PETSC_COMM_WORLD, &rank); MPI_Comm_size(PETSC_COMM_WORLD, &num_ranks);
+  PetscInt hit = 0;
+  sizes.assign(num_ranks, 0); points.clear();
+  if (rank == 0) {
+    std::ifstream f(filename.c_str(), std::ios::binary);
+    unsigned long long hash; PetscInt ranks, cells;
+    if (f.read(reinterpret_cast<char*>(&hash), sizeof(hash)) &&
+        f.read(reinterpret_cast<char*>(&ranks), sizeof(ranks)) &&
+        f.read(reinterpret_cast<char*>(&cells), sizeof(cells)) &&
+        hash == utilities::hashFile(mExodusFileName) && ranks == num_ranks && cells == num_cells) {
+      points.resize(num_cells);
+      hit = f.read(reinterpret_cast<char*>(sizes.data()), num_ranks * sizeof(PetscInt)) &&
+          f.read(reinterpret_cast<char*>(points.data()), num_cells * sizeof(PetscInt));
+    }
+    if (!hit) { sizes.assign(num_ranks, 0); points.clear(); }
+  }
+  MPI_Bcast(&hit, 1, MPIU_INT, 0, PETSC_COMM_WORLD);
+  return hit;
+
+}
+
+void Mesh::writePartitionCache(const std::string &filename, const PetscInt num_cells, PetscSF migration) {
+
+  PetscInt rank, num_ranks; MPI_Comm_rank(PETSC_COMM_WORLD, &rank); MPI_Comm_size(PETSC_COMM_WORLD, &num_ranks);
+
+  /* Serial number of each cell now held by this rank. Without migration (one rank) nothing moved. */
+  std::vector<PetscInt> mine;
+  if (migration) {
+    PetscInt num_roots, num_leaves; const PetscInt *local; const PetscSFNode *remote;
+    PetscSFGetGraph(migration, &num_roots, &num_leaves, &local, &remote);
+    for (PetscInt i = 0; i < num_leaves; i++) {
+      const PetscInt p = local ? local[i] : i;
+      if (p < mNumberElementsLocal && ElementOwned(p)) { mine.push_back(remote[i].index); }
+    }
+  } else {
+    for (PetscInt i = 0; i < num_cells; i++) { mine.push_back(i); }
+  }
+
+  /* Collect the partition on the first rank, in the layout of the shell partitioner. */
+  PetscInt num_mine = mine.size();
+  std::vector<PetscInt> sizes(num_ranks), offsets(num_ranks, 0), points;
+  MPI_Gather(&num_mine, 1, MPIU_INT, sizes.data(), 1, MPIU_INT, 0, PETSC_COMM_WORLD);
+  if (rank == 0) {
+    std::partial_sum(sizes.begin(), sizes.end() - 1, offsets.begin() + 1);
+    points.resize(num_cells);
+  }
+  MPI_Gatherv(mine.data(), num_mine, MPIU_INT, points.data(), sizes.data(), offsets.data(), MPIU_INT, 0,
+              PETSC_COMM_WORLD);
+
+  if (rank == 0) { writePartitionFile(filename, utilities::hashFile(mExodusFileName), num_cells, sizes, points); }
+
+}
+
+bool Mesh::writeBalancedPartition(const std::string &filename, const std::vector<PetscReal> &costs) {
+
+  int exodus = mExodusCells;
+  MPI_Allreduce(MPI_IN_PLACE, &exodus, 1, MPI_INT, MPI_MIN, PETSC_COMM_WORLD);
+  if (!exodus) { return false; }
+
+  /* Serial number, center and cost of each cell of this rank (not the overlapping ones), collected on the first
+   * rank. */
+  PetscInt rank, num_ranks; MPI_Comm_rank(PETSC_COMM_WORLD, &rank); MPI_Comm_size(PETSC_COMM_WORLD, &num_ranks);
+  std::vector<PetscInt> mine;
+  for (PetscInt e = 0; e < mNumberElementsLocal; e++) { if (ElementOwned(e)) { mine.push_back(e); } }
+  PetscInt num_mine = mine.size();
+  std::vector<PetscInt> counts(num_ranks), offsets(num_ranks, 0);
+  std::vector<PetscInt> crd_counts(num_ranks), crd_offsets(num_ranks, 0);
+  MPI_Gather(&num_mine, 1, MPIU_INT, counts.data(), 1, MPIU_INT, 0, PETSC_COMM_WORLD);
+  PetscInt num_cells = 0;
+  if (rank == 0) {
+    std::partial_sum(counts.begin(), counts.end() - 1, offsets.begin() + 1);
+    num_cells = std::accumulate(counts.begin(), counts.end(), 0);
+    for (PetscInt r = 0; r < num_ranks; r++) {
+      crd_counts[r] = counts[r] * mNumDim; crd_offsets[r] = offsets[r] * mNumDim;
+    }
+  }
+  std::vector<PetscInt> my_cell(num_mine);
+  std::vector<PetscReal> my_ctr(num_mine * mNumDim), my_cost(num_mine);
+  for (PetscInt i = 0; i < num_mine; i++) {
+    const PetscInt e = mine[i];
+    my_cell[i] = mElmModelIdx[e];
+    for (PetscInt d = 0; d < mNumDim; d++) { my_ctr[i * mNumDim + d] = mElmCtr(e, d); }
+    my_cost[i] = e < costs.size() ? costs[e] : 0;
+  }
+  std::vector<PetscInt> cell(num_cells);
+  std::vector<PetscReal> all_ctr(num_cells * mNumDim), all_cost(num_cells);
+  MPI_Gatherv(my_cell.data(), num_mine, MPIU_INT, cell.data(), counts.data(), offsets.data(), MPIU_INT, 0,
+              PETSC_COMM_WORLD);
+  MPI_Gatherv(my_ctr.data(), num_mine * mNumDim, MPIU_REAL, all_ctr.data(), crd_counts.data(), crd_offsets.data(),
+              MPIU_REAL, 0, PETSC_COMM_WORLD);
+  MPI_Gatherv(my_cost.data(), num_mine, MPIU_REAL, all_cost.data(), counts.data(), offsets.data(), MPIU_REAL, 0,
+              PETSC_COMM_WORLD);
+  const std::vector<std::vector<PetscInt>> nodes = nodeRanks();
+  if (rank) { return true; }
+
+  /* Every cell has some weight, so that cells whose batch took no measurable time are still spread out. */
+  RealMat ctr(num_cells, mNumDim);
+  std::vector<PetscReal> weight(num_cells);
+  const PetscReal mean = num_cells ? std::accumulate(all_cost.begin(), all_cost.end(), 0.0) / num_cells : 0;
+  for (PetscInt k = 0; k < num_cells; k++) {
+    for (PetscInt d = 0; d < mNumDim; d++) { ctr(cell[k], d) = all_ctr[k * mNumDim + d]; }
+    weight[cell[k]] = std::max(all_cost[k], 1e-3 * mean);
+  }
+
+  /* Assign the cells to ranks, and compare the cost of the fullest rank with that of the current partition. */
+  std::vector<PetscInt> part;
+  partitionCells(ctr, weight, nodes, part);
+  std::vector<PetscInt> sizes(num_ranks, 0), points;
+  std::vector<PetscReal> before(num_ranks, 0), after(num_ranks, 0);
+  for (PetscInt r = 0; r < num_ranks; r++) {
+    for (PetscInt k = offsets[r]; k < offsets[r] + counts[r]; k++) { before[r] += weight[cell[k]]; }
+  }
+  for (PetscInt i = 0; i < num_cells; i++) { sizes[part[i]]++; after[part[i]] += weight[i]; }
+  for (PetscInt r = 0; r < num_ranks; r++) {
+    for (PetscInt i = 0; i < num_cells; i++) { if (part[i] == r) { points.push_back(i); } }
+  }
+  const PetscReal rank_mean = std::accumulate(weight.begin(), weight.end(), 0.0) / num_ranks;
+  if (rank_mean > 0) {
+    LOG() << "Rebalanced partition: max/mean rank cost " << *std::max_element(after.begin(), after.end()) / rank_mean
+          << " (measured " << *std::max_element(before.begin(), before.end()) / rank_mean << ").";
+  }
+  writePartitionFile(filename, utilities::hashFile(mExodusFileName), num_cells, sizes, points);
+  return true;
+
+}
+
+void Mesh::read(unique_ptr<ExodusModel> const &model, unique_ptr<Options> const &options) {
+
+  std::string cache = options->PartitionCacheFile();
+  if (!cache.empty() && isParallelMeshFile(mExodusFileName)) {
+    LOG() << "Warning: --partition-cache-file is only used with exodus mesh files.";
+    cache.clear();
+  }
+  if (!options->WeightedPartitioning() && cache.empty()) { return read(); }
+  if (isParallelMeshFile(mExodusFileName)) {
+    throw std::runtime_error("--weighted-partitioning requires an exodus mesh file, as the cells are "
+                                 "weighted and bisected on a single rank.");
+  }
+  PetscInt num_ranks; MPI_Comm_size(PETSC_COMM_WORLD, &num_ranks);
+
+  /* Read exodus file. All cells end up on the first rank. */
+  DM dm = load();
+  PetscInt dim; DMGetDimension(dm, &dim);
+  PetscInt num_cells; DMPlexGetDepthStratum(dm, dim, NULL, &num_cells);
+
+  /* A cached partition (of this mesh, on as many ranks) replaces the partitioner. Otherwise the cells are
+   * partitioned by cost, or by the PETSc partitioner. */
+  std::vector<PetscInt> sizes, points;
+  PetscPartitioner partitioner; DMPlexGetPartitioner(dm, &partitioner);
+  const bool cached = !cache.empty() && readPartitionCache(cache, num_cells, sizes, points);
+  if (!cached && options->WeightedPartitioning()) { weightedPartition(dm, model, options, sizes, points); }
+  if (cached || options->WeightedPartitioning()) {
+    PetscPartitionerSetType(partitioner, PETSCPARTITIONERSHELL);
+    PetscPartitionerShellSetPartition(partitioner, num_ranks, sizes.data(), points.data());
+  } else {
+    PetscPartitionerSetFromOptions(partitioner);
+  }
+
+  /* Distribute mesh, and remember where the cells went. */
+  PetscSF migration = NULL;
+  distribute(dm, cached || cache.empty() ? NULL : &migration);
+  if (!cached && !cache.empty()) {
+    writePartitionCache(cache, num_cells, migration);
+    if (migration) { PetscSFDestroy(&migration); }
+  }
 
 }
 
@@ -283,12 +868,16 @@ void Mesh::setupTopology(const unique_ptr<ExodusModel> &model,
   /* Ensure mesh was read. */
   if (!mNumDim) { throw std::runtime_error("Mesh appears to have zero dimensions. Have you called read()?"); }
 
-  /* Find all the mesh boundaries. */
+  /* Find all the mesh boundaries. Membership is also flagged per point, so it can be queried
+   * in constant time below (and through OnSideSet). */
   DMLabel label; DMGetLabel(mDistributedMesh, "Face Sets", &label);
-  PetscInt boundary_size = 0;
+  PetscInt boundary_size = 0, chart_end;
+  DMPlexGetChart(mDistributedMesh, &mChartStart, &chart_end);
+  mSideSetPts.clear();
   // label==NULL when there are no side sets, so there are no labeled boundaries
   if (label) {
     DMLabelGetNumValues(label, &boundary_size);
+    mSideSetPts.assign(boundary_size, std::vector<bool>(chart_end - mChartStart, false));
     IS idIS; DMLabelGetValueIS(label, &idIS);
     const PetscInt *ids; ISGetIndices(idIS, &ids);
     for (PetscInt i = 0; i < boundary_size; i++) {
@@ -298,26 +887,67 @@ void Mesh::setupTopology(const unique_ptr<ExodusModel> &model,
       /* Tuple describing boundary set i for face j. */
       for (PetscInt j = 0; j < numFaces; j++) {
           mBndPts.insert(std::tie(i, faces[j]));
+          mSideSetPts[i][faces[j] - mChartStart] = true;
         /* We need to walk down the graph and apply boundaries to all points. */
         PetscInt num_closure, *val_closure = NULL;
         DMPlexGetTransitiveClosure(mDistributedMesh, faces[j], PETSC_TRUE,
                                    &num_closure, &val_closure);
         for (PetscInt k = 0; k < 2 * num_closure; k += 2) {
           mBndPts.insert(std::tie(i, val_closure[k]));
+          mSideSetPts[i][val_closure[k] - mChartStart] = true;
         }
         DMPlexRestoreTransitiveClosure(mDistributedMesh, faces[j], PETSC_TRUE,
                                        &num_closure, &val_closure);
         }
+      ISRestoreIndices(pointIs, &faces); ISDestroy(&pointIs);
     }
+    ISRestoreIndices(idIS, &ids); ISDestroy(&idIS);
   }
 
+  /* Which side sets are labeled as homogeneous dirichlet or absorbing (looked up once, not per point). An
+   * injection boundary absorbs the outgoing waves, so it is an absorbing one too. */
+  std::vector<bool> homo_dirichlet(boundary_size, false), absorbing(boundary_size, false);
+  std::vector<bool> injecting(boundary_size, false);
+  {
+    auto hd = options->HomogeneousDirichlet();
+    auto ab = options->AbsorbingBoundaries();
+    auto in = options->InjectionBoundaries();
+    for (PetscInt k = 0; k < boundary_size; k++) {
+      homo_dirichlet[k] = std::find(hd.begin(), hd.end(), model->SideSetName(k)) != hd.end();
+      injecting[k] = std::find(in.begin(), in.end(), model->SideSetName(k)) != in.end();
+      absorbing[k] = injecting[k] || std::find(ab.begin(), ab.end(), model->SideSetName(k)) != ab.end();
+    }
+  }
+  mAbsSideSets.clear();
+  for (PetscInt k = 0; k < boundary_size; k++) { if (absorbing[k]) { mAbsSideSets.push_back(k); } }
+  mPeriodicSideSets.clear();
+  {
+    auto side_set = [&](const std::string &name) {
+      for (PetscInt k = 0; k < boundary_size; k++) { if (model->SideSetName(k) == name) { return k; } }
+      return static_cast<PetscInt>(-1);
+    };
+    auto pb = options->PeriodicBoundaries();
+    for (size_t i = 0; i + 1 < pb.size(); i += 2) {
+      mPeriodicSideSets.push_back(std::make_pair(side_set(pb[i]), side_set(pb[i + 1])));
+    }
+  }
+
+  /* Depth strata, to tell vertices, edges and faces apart in the element closures. */
+  std::vector<PetscInt> depth_beg(mNumDim), depth_end(mNumDim);
+  for (PetscInt d = 0; d < mNumDim; d++) {
+    DMPlexGetDepthStratum(mDistributedMesh, d, &depth_beg[d], &depth_end[d]);
+  }
+  mElmBndEntities.assign(mNumberElementsLocal, std::vector<std::tuple<PetscInt,PetscInt>>());
+  mElmAbsFaces.assign(mNumberElementsLocal, std::vector<PetscInt>());
+  mElmInjFaces.assign(mNumberElementsLocal, std::vector<PetscInt>());
+
   /* Walk through the mesh and extract element types. */
   for (PetscInt i = 0; i < mNumberElementsLocal; i++) {
 
     /* Get and save the type of element i. */
-    RealMat vtx = getElementCoordinateClosure(i); RealVec ctr(vtx.cols());
-    for (PetscInt j = 0; j < mNumDim; j++) { ctr(j) = vtx.col(j).mean(); }
-    std::string type = model->getElementType(ctr); mPointFields[i].insert(type);
+    RealVec ctr = mElmCtr.row(i).transpose();
+    std::string type = ModelElement(i) >= 0 ? model->getElementType(ModelElement(i)) : model->getElementType(ctr);
+    mPointFields[i].insert(type);
 
     /* Add the type of element i to all mesh points connected via the Hasse graph. */
     PetscInt num_pts; const PetscInt *pts = NULL;
@@ -327,26 +957,37 @@ void Mesh::setupTopology(const unique_ptr<ExodusModel> &model,
       /* insert this element type... */
       mPointFields[pts[j]].insert(type);
       /* for all mesh boundaries... */
+      bool absorbing_face = false;
       for (PetscInt k = 0; k < boundary_size; k++) {
         /* if this particular mesh point is on boundary set k... */
-        if (std::find(mBndPts.begin(), mBndPts.end(), std::tie(k,pts[j]))
-            != mBndPts.end()) {
-          /* if boundary set k is labeled as homogeneous dirichlet... */
-          auto hd = options->HomogeneousDirichlet();
-          if (std::find(hd.begin(), hd.end(), model->SideSetName(k)) != hd.end()) {
-            mPointFields[pts[j]].insert("boundary_homo_dirichlet");
-            /* If we're on a boundary, it's important to the entire graph. */
-            PetscInt num_closure; PetscInt *pts_closure = NULL;
-            DMPlexGetTransitiveClosure(mDistributedMesh, pts[j], PETSC_TRUE, &num_closure,
-                                       &pts_closure);
-            /* Remember closure includes orientations (k += 2) */
-            for (PetscInt l = 0; l < 2 * num_closure; l += 2) {
-              mPointFields[pts_closure[l]].insert("boundary_homo_dirichlet");
-            }
-            DMPlexRestoreTransitiveClosure(mDistributedMesh, pts[j], PETSC_TRUE, &num_closure,
-                                           &pts_closure);
+        if (OnSideSet(pts[j], k)) {
+          /* an absorbing face only absorbs once, even if it lies on several such side sets. */
+          if (absorbing[k] && !absorbing_face) {
+            mPointFields[pts[j]].insert("boundary_absorbing");
+            mElmAbsFaces[i].push_back(j);
+            absorbing_face = true;
+          }
+          if (injecting[k] && (mElmInjFaces[i].empty() || mElmInjFaces[i].back() != j)) {
+            mElmInjFaces[i].push_back(j);
+          }
+          /* A homogeneous dirichlet face marks its whole closure, which the side set flags hold already
+           * (see below). Otherwise, default to free surface... insert nothing. */
+        }
+      }
+    }
+
+    /* List the closure entities of element i which lie on any side set, by depth and by their
+     * index among the closure points of that depth (see BoundaryEntities). */
+    if (boundary_size) {
+      PetscInt num_closure; const PetscInt *pts_closure = ElementClosure(i, num_closure);
+      for (PetscInt d = 0; d < mNumDim; d++) {
+        for (PetscInt l = 0, local = 0; l < 2 * num_closure; l += 2) {
+          const PetscInt p = pts_closure[l];
+          if (p < depth_beg[d] || p >= depth_end[d]) continue;
+          for (PetscInt k = 0; k < boundary_size; k++) {
+            if (OnSideSet(p, k)) { mElmBndEntities[i].push_back(std::make_tuple(d, local)); break; }
           }
-          /* default to free surface... insert nothing. */
+          local++;
         }
       }
     }
@@ -356,6 +997,149 @@ void Mesh::setupTopology(const unique_ptr<ExodusModel> &model,
 
   }
 
+  /* If we're on a homogeneous dirichlet boundary, it's important to the entire graph: the faces of the side set,
+   * and all points of their closures. */
+  for (PetscInt k = 0; k < boundary_size; k++) {
+    if (!homo_dirichlet[k]) { continue; }
+    for (PetscInt p = 0; p < static_cast<PetscInt>(mSideSetPts[k].size()); p++) {
+      if (mSideSetPts[k][p]) { mPointFields[p + mChartStart].insert("boundary_homo_dirichlet"); }
+    }
+  }
+
+  /* Type of each element, now that the fields of its neighbours (its coupling) are known. All elements share
+   * the shape of the first (see checkSingleShape). */
+  checkSingleShape();
+  mElmTypeCode.resize(mNumberElementsLocal);
+  const std::string shape = mNumberElementsLocal ? baseElementType() : "";
+  for (PetscInt i = 0; i < mNumberElementsLocal; i++) {
+    mElmTypeCode[i] = Element::TypeCode(shape, ElementFields(i), TotalCouplingFields(i), options->Attenuation());
+  }
+
+  /* Order in which the elements (and their dofs, see setupGlobalDof) are laid out. */
+  mElmOrder.resize(mNumberElementsLocal);
+  for (PetscInt i = 0; i < mNumberElementsLocal; i++) { mElmOrder[i] = i; }
+  if (options->ReorderElements()) {
+    std::vector<unsigned long long> key = hilbertKeys(mElmCtr);
+    std::stable_sort(mElmOrder.begin(), mElmOrder.end(), [&](PetscInt a, PetscInt b) { return key[a] < key[b]; });
+  }
+
+  /* Choose the polynomial order from the model: the lowest one resolving the slowest wavelength everywhere.
+   * The dofs are laid out conformingly for a single order, so only the maximum over all elements is kept (and
+   * the mean, to show how much the slowest elements cost). */
+  if (options->MaxFrequency() > 0) {
+    std::map<std::string,std::vector<PetscInt>> elms_of_type;
+    for (PetscInt i = 0; i < mNumberElementsLocal; i++) { elms_of_type[*mPointFields[i].begin()].push_back(i); }
+    std::vector<PetscReal> speed(mNumberElementsLocal);
+    for (auto &type: elms_of_type) {
+      auto type_speed = minimumWaveSpeeds(model, type.second, type.first);
+      for (PetscInt k = 0; k < type.second.size(); k++) { speed[type.second[k]] = type_speed[k]; }
+    }
+    PetscInt max_ord = 1, sum_ord = 0, num_elm = 0;
+    for (PetscInt i = 0; i < mNumberElementsLocal; i++) {
+      auto vtx = ElementVertexCoordinates(i);
+      PetscReal size = (vtx.colwise().maxCoeff() - vtx.colwise().minCoeff()).maxCoeff();
+      const PetscInt ord = resolvingPolynomialOrder(size, speed[i], options->MaxFrequency(),
+                                                    options->PointsPerWavelength());
+      max_ord = std::max(max_ord, ord);
+      if (ElementOwned(i)) { sum_ord += ord; num_elm++; }
+    }
+    MPI_Allreduce(MPI_IN_PLACE, &max_ord, 1, MPIU_INT, MPI_MAX, PETSC_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, &sum_ord, 1, MPIU_INT, MPI_SUM, PETSC_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, &num_elm, 1, MPIU_INT, MPI_SUM, PETSC_COMM_WORLD);
+    if (max_ord > options->PolynomialOrder()) {
+      LOG() << "Warning: polynomial order " << options->PolynomialOrder() << " does not resolve "
+            << options->MaxFrequency() << " Hz everywhere (order " << max_ord << " would).";
+    } else {
+      LOG() << "Resolving " << options->MaxFrequency() << " Hz with polynomial order " << max_ord
+            << " (mean required order " << static_cast<PetscReal>(sum_ord) / num_elm << ").";
+      options->SetPolynomialOrder(max_ord);
+    }
+  }
+
+}
+
+std::vector<PetscReal> Mesh::minimumWaveSpeeds(unique_ptr<ExodusModel> const &model,
+                                              const std::vector<PetscInt> &elms, const std::string &type) {
+
+  std::vector<std::string> names;
+  if (type == "fluid") {
+    names = {"VP"};
+  } else if (type == "2delastic") {
+    names = {"C55", "RHO"};
+  } else if (type == "3delastic") {
+    names = {"VSV", "VSH"};
+  } else {
+    throw std::runtime_error("Wave speed of physics " + type + " is not known.");
+  }
+
+  /* Query the parameters of all elements at once. */
+  const PetscInt num_elm = elms.size(), num_par = names.size();
+  PetscInt num_vtx = 0;
+  Eigen::MatrixXd ctr(num_elm, mNumDim);
+  std::vector<PetscInt> mod_elm(num_elm);
+  for (PetscInt k = 0; k < num_elm; k++) {
+    num_vtx = std::max(num_vtx, (mElmVtxOff[elms[k] + 1] - mElmVtxOff[elms[k]]) / mNumDim);
+    ctr.row(k) = mElmCtr.row(elms[k]); mod_elm[k] = ModelElement(elms[k]);
+  }
+  std::vector<PetscReal> par;
+  model->getElementalMaterialParameters(ctr, mod_elm, names, num_vtx, par);
+
+  std::vector<PetscReal> speed(num_elm, std::numeric_limits<PetscReal>::max());
+  for (PetscInt k = 0; k < num_elm; k++) {
+    const PetscInt elm_vtx = (mElmVtxOff[elms[k] + 1] - mElmVtxOff[elms[k]]) / mNumDim;
+    for (PetscInt v = 0; v < elm_vtx; v++) {
+      const PetscReal *p = par.data() + (k * num_vtx + v) * num_par;
+      speed[k] = std::min(speed[k], type == "fluid" ? p[0] :
+                                    type == "2delastic" ? std::sqrt(p[0] / p[1]) : std::min(p[0], p[1]));
+    }
+  }
+  return speed;
+
+}
+
+PetscInt Mesh::resolvingPolynomialOrder(const PetscReal size, const PetscReal wave_speed,
+                                        const PetscReal max_frequency, const PetscReal points_per_wavelength) {
+  PetscReal wavelength = wave_speed / max_frequency;
+  return std::max<PetscInt>(1, static_cast<PetscInt>(std::ceil(points_per_wavelength * size / wavelength - 1e-10)));
+}
+
+std::vector<unsigned long long> Mesh::hilbertKeys(const Eigen::Ref<const Eigen::MatrixXd> &pts) {
+
+  /* Quantize the points to as many bits per dimension as fit the key. */
+  const PetscInt n = pts.cols();
+  const int bits = 63 / std::max<PetscInt>(n, 1);
+  std::vector<unsigned long long> key(pts.rows(), 0);
+  if (!pts.rows()) { return key; }
+  RealVec lo = pts.colwise().minCoeff().transpose(), hi = pts.colwise().maxCoeff().transpose();
+  const PetscReal scale = ((1ULL << bits) - 1) / std::max((hi - lo).maxCoeff(), 1e-300);
+
+  std::vector<unsigned long long> x(n);
+  for (PetscInt p = 0; p < pts.rows(); p++) {
+
+    for (PetscInt d = 0; d < n; d++) { x[d] = static_cast<unsigned long long>((pts(p, d) - lo(d)) * scale); }
+
+    /* Axes to transposed Hilbert index (J. Skilling, "Programming the Hilbert curve", 2004). */
+    const unsigned long long m = 1ULL << (bits - 1);
+    for (unsigned long long q = m; q > 1; q >>= 1) {
+      const unsigned long long r = q - 1;
+      for (PetscInt d = 0; d < n; d++) {
+        if (x[d] & q) { x[0] ^= r; }
+        else { const unsigned long long t = (x[0] ^ x[d]) & r; x[0] ^= t; x[d] ^= t; }
+      }
+    }
+    for (PetscInt d = 1; d < n; d++) { x[d] ^= x[d - 1]; }
+    unsigned long long t = 0;
+    for (unsigned long long q = m; q > 1; q >>= 1) { if (x[n - 1] & q) { t ^= q - 1; } }
+    for (PetscInt d = 0; d < n; d++) { x[d] ^= t; }
+
+    /* Interleave the bits, most significant first. */
+    for (int b = bits - 1; b >= 0; b--) {
+      for (PetscInt d = 0; d < n; d++) { key[p] = (key[p] << 1) | ((x[d] >> b) & 1); }
+    }
+
+  }
+  return key;
+
 }
 
 void Mesh::setupGlobalDof(unique_ptr<Element> const &element,
@@ -370,15 +1154,30 @@ void Mesh::setupGlobalDof(unique_ptr<Element> const &element,
   /* Use the information extracted above to inform the global DOF layout. */
   PetscInt num_bc = 0;
   PetscInt poly_order = options->PolynomialOrder();
-  /* Note here we are treating each field component as a separate vector (for now).
+  /* By default we are treating each field component as a separate vector. With
+   * --interleaved-components, the components of (pure) vector physics are instead stored
+   * together in a block vector, so that a single closure holds all components.
    * mMeshFields.size(); */
   PetscInt num_fields = 1;
+  mNumComponents = 1;
+  if (options->InterleavedComponents()) {
+    if (mMeshFields.size() != 1 || numFieldPerPhysics(*mMeshFields.begin()) != mNumDim) {
+      throw std::runtime_error("Interleaved components are only supported for meshes with a single "
+                                   "vector physics (i.e. 2delastic or 3delastic).");
+    }
+    mNumComponents = mNumDim;
+  }
+  /* With --simultaneous-shots, each component of the (scalar) field is instead one shot. */
+  if (options->SimultaneousShots() > 1) {
+    if (mMeshFields.size() != 1 || *mMeshFields.begin() != "fluid") {
+      throw std::runtime_error("Simultaneous shots are only supported for meshes with a single "
+                                   "scalar physics (i.e. fluid).");
+    }
+    mNumComponents = options->SimultaneousShots();
+  }
   PetscInt *num_comps; PetscMalloc1(num_fields, &num_comps);
   {
-    /* Note here that we are allocating each field component as a separate vector.
-     * This may change in the future.
-     * for (auto &f: mMeshFields) { num_comps[i++] = numFieldPerPhysics(f); } */
-    for(int i=0; i<num_fields; i++) { num_comps[i] = 1; }
+    for(int i=0; i<num_fields; i++) { num_comps[i] = mNumComponents; }
   }
   PetscInt *num_dof; PetscMalloc1(num_fields * (mNumDim + 1), &num_dof);
 
@@ -423,9 +1222,28 @@ void Mesh::setupGlobalDof(unique_ptr<Element> const &element,
   }
 
   
+  /* Number the mesh points (and so the dofs) in the order in which the elements first touch them, so that
+   * the closures of neighbouring elements stay close in the local vectors. */
+  IS perm = NULL;
+  if (options->ReorderElements()) {
+    PetscInt p_start, p_end; DMPlexGetChart(mDistributedMesh, &p_start, &p_end);
+    std::vector<bool> seen(p_end - p_start, false);
+    std::vector<PetscInt> order; order.reserve(p_end - p_start);
+    for (auto e: mElmOrder) {
+      PetscInt num_closure; const PetscInt *pts_closure = ElementClosure(e, num_closure);
+      for (PetscInt l = 0; l < 2 * num_closure; l += 2) {
+        const PetscInt p = pts_closure[l] - p_start;
+        if (!seen[p]) { seen[p] = true; order.push_back(p); }
+      }
+    }
+    for (PetscInt p = 0; p < p_end - p_start; p++) { if (!seen[p]) { order.push_back(p); } }
+    ISCreateGeneral(PETSC_COMM_SELF, order.size(), order.data(), PETSC_COPY_VALUES, &perm);
+  }
+
   /* Allocate the section. */
   DMPlexCreateSection(mDistributedMesh, mNumDim, num_fields, num_comps, num_dof,
-                      num_bc, NULL, NULL, NULL, NULL, &mMeshSection);
+                      num_bc, NULL, NULL, NULL, perm, &mMeshSection);
+  if (perm) { ISDestroy(&perm); }
   
   /* Attach some meta-information to the section. */
 //  {
@@ -433,8 +1251,9 @@ void Mesh::setupGlobalDof(unique_ptr<Element> const &element,
 //    for (auto &f: mMeshFields) { PetscSectionSetFieldName(mMeshSection, i++, f.c_str()); }
 //  }
 
-  /* Attach the section to our DM */
+  /* Attach the section to our DM, whose vectors (and so the fields) are of --vec-type. */
   DMSetDefaultSection(mDistributedMesh, mMeshSection);
+  DMSetVecType(mDistributedMesh, options->FieldVecType().c_str());
 
   /* Fix orientation of edges and surfaces when rotated compared to neighboring element */
   FixOrientation(mDistributedMesh, mMeshSection, num_comps, num_fields, poly_order, mNumDim,this->baseElementType());
@@ -451,24 +1270,18 @@ void Mesh::setupGlobalDof(unique_ptr<Element> const &element,
   PetscFree(num_comps);
 }
 
-std::vector<PetscInt> Mesh::EdgeNumbers(const PetscInt elm) {
+std::vector<PetscInt> Mesh::EdgeNumbers(const PetscInt elm) const {
 
-  std::vector<PetscInt> edges;
-  /* Step up one level in the graph (reduce dim). */
-  PetscInt csize; DMPlexGetConeSize(mDistributedMesh, elm, &csize);
-  const PetscInt *cone; DMPlexGetCone(mDistributedMesh, elm, &cone);
-  for (PetscInt i = 0; i < csize; i++) { edges.push_back(cone[i]); }
-  return edges;
+  /* One level up in the graph (reduce dim), as extracted with the coordinates. */
+  return std::vector<PetscInt>(mElmFace.begin() + mElmFaceOff[elm], mElmFace.begin() + mElmFaceOff[elm + 1]);
 
 }
 
 PetscInt Mesh::GetNeighbouringElement(const PetscInt interface, const PetscInt this_elm) const {
 
   PetscInt neighbour = -1;
-  PetscInt ssize; DMPlexGetSupportSize(mDistributedMesh, interface, &ssize);
-  const PetscInt *supp; DMPlexGetSupport(mDistributedMesh, interface, &supp);
-  for (PetscInt i = 0; i < ssize; i++) {
-    if (supp[i] != this_elm) { neighbour = supp[i]; }
+  for (PetscInt i = mElmFaceOff[this_elm]; i < mElmFaceOff[this_elm + 1]; i++) {
+    if (mElmFace[i] == interface) { neighbour = mElmFaceNbr[i]; }
   }
   if (neighbour == -1) { throw std::runtime_error(
         "Element " + std::to_string(this_elm) + " has no neighbour on face "
@@ -478,49 +1291,46 @@ PetscInt Mesh::GetNeighbouringElement(const PetscInt interface, const PetscInt t
 }
 
 std::vector<std::tuple<PetscInt,std::vector<std::string>>> Mesh::CouplingFields(
-    const PetscInt elm) {
+    const PetscInt elm) const {
 
   std::vector<std::tuple<PetscInt,std::vector<std::string>>> couple;
-  /* Step one level up in graph (reduce dim). */
-  PetscInt csize; DMPlexGetConeSize(mDistributedMesh, elm, &csize);
-  const PetscInt *cone; DMPlexGetCone(mDistributedMesh, elm, &cone);
   /*---------------------------------------------------------------------------
                     Get physics of neighbouring element.
    *--------------------------------------------------------------------------*/
-  for (PetscInt i = 0; i < csize; i++) {
-    /* Step through the support of each point (increase dim to element). */
-    PetscInt ssize; DMPlexGetSupportSize(mDistributedMesh, cone[i], &ssize);
-    const PetscInt *supp; DMPlexGetSupport(mDistributedMesh, cone[i], &supp);
-    for (PetscInt j = 0; j < ssize; j++) {
-      /* Get fields on this element, but skip parent element. */
-      std::vector<std::string> fields;
-      if (supp[j] == elm) { continue; }
-      for (auto &f: mPointFields[supp[j]]) { fields.push_back(f); }
-      couple.push_back(std::make_tuple(cone[i], fields));
-    }
+  for (PetscInt i = mElmFaceOff[elm]; i < mElmFaceOff[elm + 1]; i++) {
+    /* The element across each face (increase dim to element), if there is one. */
+    if (mElmFaceNbr[i] < 0) { continue; }
+    std::vector<std::string> fields;
+    auto nbr = mPointFields.find(mElmFaceNbr[i]);
+    if (nbr != mPointFields.end()) { fields.assign(nbr->second.begin(), nbr->second.end()); }
+    couple.push_back(std::make_tuple(mElmFace[i], fields));
   }
   return couple;
 }
 
-std::vector<std::string> Mesh::TotalCouplingFields(const PetscInt elm) {
+std::vector<std::string> Mesh::TotalCouplingFields(const PetscInt elm) const {
 
   std::set<std::string> coupling_fields;
-  PetscInt num_pts; PetscInt *pts = NULL;
-  DMPlexGetTransitiveClosure(mDistributedMesh, elm, PETSC_TRUE, &num_pts, &pts);
+  PetscInt num_pts; const PetscInt *pts = ElementClosure(elm, num_pts);
+  auto own = mPointFields.find(elm);
   for (PetscInt i = 0; i < 2*num_pts; i += 2) {
-    for (auto &f: mPointFields[pts[i]]) {
-      if (mPointFields[elm].find(f) == mPointFields[elm].end()) {
+    auto point = mPointFields.find(pts[i]);
+    if (point == mPointFields.end()) { continue; }
+    for (auto &f: point->second) {
+      if (own == mPointFields.end() || own->second.find(f) == own->second.end()) {
         coupling_fields.insert(f);
       }
     }
   }
-  DMPlexRestoreTransitiveClosure(mDistributedMesh, elm, PETSC_TRUE, &num_pts, &pts);
   return std::vector<std::string> (coupling_fields.begin(), coupling_fields.end());
 
 }
 
 Eigen::MatrixXd Mesh::getElementCoordinateClosure(PetscInt elem_num) {
 
+  /* Local elements of the distributed mesh were extracted already. */
+  if (elem_num < static_cast<PetscInt>(mElmVtxOff.size()) - 1) { return ElementVertexCoordinates(elem_num); }
+
   Vec coord;
   DMGetCoordinatesLocal(mDistributedMesh, &coord);
   PetscSection coord_section;
@@ -557,19 +1367,99 @@ PetscInt Mesh::numFieldPerPhysics(std::string physics) {
 }
 
 std::string Mesh::baseElementType() {
+  return ElementShape(getElementCoordinateClosure(0).rows());
+}
+
+std::string Mesh::ElementShape(const PetscInt num_vtx) const {
   std::string type;
-  RealMat vtx = getElementCoordinateClosure(0);
-  if (vtx.rows() == 3) {
+  if (num_vtx == 3) {
     type = "tri";
-  } else if (vtx.rows() == 4 && mNumDim == 2) {
+  } else if (num_vtx == 4 && mNumDim == 2) {
     type = "quad";
-  } else if (vtx.rows() == 4 && mNumDim == 3) {
+  } else if (num_vtx == 4 && mNumDim == 3) {
     type = "tet";
-  } else if (vtx.rows() == 8 && mNumDim == 3) {
+  } else if (num_vtx == 8 && mNumDim == 3) {
     type = "hex";
   } else {
-    ERROR() << "Element type not detected: vtx.rows()=" << vtx.rows() << " and dim = " << mNumDim;
+    ERROR() << "Element type not detected: vtx.rows()=" << num_vtx << " and dim = " << mNumDim;
   }
   return type;
 }
 
+void Mesh::checkSingleShape() const {
+
+  /* The number of vertices of the elements, over all ranks (those without elements do not count). */
+  PetscInt range[2] = {-std::numeric_limits<PetscInt>::max(), -std::numeric_limits<PetscInt>::max()};
+  for (PetscInt e = 0; e < mNumberElementsLocal; e++) {
+    const PetscInt num_vtx = (mElmVtxOff[e + 1] - mElmVtxOff[e]) / mNumDim;
+    range[0] = std::max(range[0], -num_vtx); range[1] = std::max(range[1], num_vtx);
+  }
+  MPI_Allreduce(MPI_IN_PLACE, range, 2, MPIU_INT, MPI_MAX, PETSC_COMM_WORLD);
+  if (range[1] < 0 || -range[0] == range[1]) { return; }
+
+  /* One dof layout fits all elements only if they agree on the dofs of every shared point. The edge nodes of the
+   * (order 3) triangles are not at the GLL points of the quads, and the quadrilateral faces of hexahedra can not
+   * be shared with tetrahedra (which would need pyramids in between). */
+  throw std::runtime_error("The mesh mixes " + ElementShape(-range[0]) + " and " + ElementShape(range[1]) +
+                           " elements, which do not conform at their interfaces. Meshes must be of a single "
+                           "element shape.");
+
+}
+
+std::vector<PetscInt> Mesh::AbsorbingPoints() const {
+  std::vector<PetscInt> pts;
+  const PetscInt num_pts = mSideSetPts.empty() ? 0 : mSideSetPts.front().size();
+  for (PetscInt p = 0; p < num_pts; p++) {
+    for (auto k: mAbsSideSets) { if (mSideSetPts[k][p]) { pts.push_back(p + mChartStart); break; } }
+  }
+  return pts;
+}
+
+std::vector<PetscInt> Mesh::HomogeneousDirichletPoints() const {
+  std::vector<PetscInt> pts;
+  for (auto &p: mPointFields) {
+    if (p.second.count("boundary_homo_dirichlet")) { pts.push_back(p.first); }
+  }
+  return pts;
+}
+
+size_t Mesh::MemoryBytes() const {
+  return Memory::bytes(mBndPts) + Memory::bytes(mSideSetPts) + Memory::bytes(mElmBndEntities) +
+      Memory::bytes(mElmInjFaces) + Memory::bytes(mPeriodicSideSets) +
+      Memory::bytes(mElmAbsFaces) + Memory::bytes(mAbsSideSets) + Memory::bytes(mElmOrder) + Memory::bytes(mElmTypeCode) + Memory::bytes(mElmVtx) + Memory::bytes(mElmVtxOff) +
+      Memory::bytes(mElmFace) + Memory::bytes(mElmFaceNbr) + Memory::bytes(mElmFaceOff) +
+      Memory::bytes(mElmCls) + Memory::bytes(mElmClsOff) +
+      Memory::bytes(mElmCtr) + Memory::bytes(mElmModelIdx) + Memory::bytes(mMeshFields) +
+      Memory::bytes(mElmGlbNum) + Memory::bytes(mElmFields) + Memory::bytes(mPointFields) + Memory::bytes(mGlobalFields) +
+      Memory::bytes(mBoundaryIds) + Memory::bytes(mBoundaryElementFaces);
+}
+
+size_t Mesh::PetscBytes() const {
+
+  if (!mDistributedMesh) { return 0; }
+
+  /* Each point has a size and offset for its cone and its support, and each cone entry an orientation. */
+  PetscInt p_start, p_end, num_cone = 0, num_support = 0;
+  DMPlexGetChart(mDistributedMesh, &p_start, &p_end);
+  for (PetscInt p = p_start; p < p_end; p++) {
+    PetscInt size;
+    DMPlexGetConeSize(mDistributedMesh, p, &size); num_cone += size;
+    DMPlexGetSupportSize(mDistributedMesh, p, &size); num_support += size;
+  }
+  size_t bytes = sizeof(PetscInt) * (4 * (p_end - p_start) + 2 * num_cone + num_support);
+
+  Vec coordinates; PetscInt num_crd = 0;
+  DMGetCoordinatesLocal(mDistributedMesh, &coordinates);
+  if (coordinates) { VecGetLocalSize(coordinates, &num_crd); }
+  bytes += sizeof(PetscScalar) * num_crd;
+
+  /* The section holds a dof count and an offset per point, in total and per field. */
+  if (mMeshSection) {
+    PetscInt num_fields, s_start, s_end;
+    PetscSectionGetNumFields(mMeshSection, &num_fields);
+    PetscSectionGetChart(mMeshSection, &s_start, &s_end);
+    bytes += sizeof(PetscInt) * 2 * (num_fields + 1) * (s_end - s_start);
+  }
+  return bytes;
+
+}
@@ -3,30 +3,38 @@
 #include <Utilities/Utilities.h>
 #include <Utilities/Logging.h>
 #include <Utilities/Types.h>
+#include <Utilities/Memory.h>
+#include <hdf5.h>
 #include <algorithm>
 #include <fstream>
+#include <utility>
 #include <stdio.h>
 
 ExodusModel::ExodusModel(std::unique_ptr<Options> const &options) {
-  mNodalKdTree = NULL;
-  mElementalKdTree = NULL;
   mExodusId = 0;
   mExodusFileName = options->ModelFile();
   mNumberInfo=0;
+  mDistributed = options->DistributeModel();
+  mNodeShared = options->NodeSharedModel();
+  mLocalized = false;
+  mMaterialCacheFile = options->MaterialCacheFile();
+  mModelHash = 0;
+  mNumberModelElements = 0;
 }
 
 ExodusModel::ExodusModel() {
-  mNodalKdTree = NULL;
-  mElementalKdTree = NULL;
   mExodusId = 0;
   mNumberInfo = 0;
+  mDistributed = false;
+  mNodeShared = false;
+  mLocalized = false;
+  mModelHash = 0;
+  mNumberModelElements = 0;
 }
 
 ExodusModel::~ExodusModel() {
   int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
   if (!rank && mExodusId) { ex_close(mExodusId); }
-  if (mElementalKdTree) { kd_free(mElementalKdTree); }
-  if (mNodalKdTree) { kd_free(mNodalKdTree); }
 }
 
 
@@ -35,22 +43,30 @@ void ExodusModel::setExodusFilename(const std::string filename) {
 } 
 
 void ExodusModel::read() {
+  readFile();
+  broadcastFile();
+}
+
+void ExodusModel::readFile() {
 
   /* Read the model from rank 0. */
+  if (PetscGlobalRank) { return; }
+  if (mExodusFileName.empty() ) { throw std::runtime_error("Error opening exodus model. No filename specified."); }
+  getInitialization();
+  readConnectivity();
+  readCoordinates();
+  readGlobalVariables();
+  readElementalVariables();
+  readNodalVariables();
+  readSideSets();
+  readInfo();
+
+}
+
+void ExodusModel::broadcastFile() {
+
   int root = 0;
   int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
-  if (!rank)
-  {
-    if (mExodusFileName.empty() ) { throw std::runtime_error("Error opening exodus model. No filename specified."); }
-    getInitialization();
-    readConnectivity();
-    readCoordinates();
-    readGlobalVariables();
-    readElementalVariables();
-    readNodalVariables();
-    readSideSets();
-    readInfo();
-  }
 
   /* Broadcast all scalars. */
   mNumberElements = utilities::broadcastNumberFromRank(mNumberElements, root);
@@ -60,29 +76,252 @@ void ExodusModel::read() {
   mNumberDimension = utilities::broadcastNumberFromRank(mNumberDimension, root);
   mNumberElementBlocks = utilities::broadcastNumberFromRank(mNumberElementBlocks, root);
 
-  /* Broadcast all vectors. */
-  mNodalX = utilities::broadcastNumberVecFromRank(mNodalX, root);
-  mNodalY = utilities::broadcastNumberVecFromRank(mNodalY, root);
+  /* Broadcast all (small) vectors. */
   mSideSetNames = utilities::broadcastStringVecFromRank(mSideSetNames, root);
-  mElementalVariables = utilities::broadcastNumberVecFromRank(mElementalVariables, root);
-  mElementConnectivity = utilities::broadcastNumberVecFromRank(mElementConnectivity, root);
   mElementalVariableNames = utilities::broadcastStringVecFromRank(mElementalVariableNames, root);
+  mElementalVariableIndex.clear();
+  for (PetscInt i = 0; i < mElementalVariableNames.size(); i++) {
+    mElementalVariableIndex[mElementalVariableNames[i]] = i;
+  }
   mVerticesPerElementPerBlock = utilities::broadcastNumberVecFromRank(mVerticesPerElementPerBlock, root);
 
-  /* Broadcast dimension specific components. */
-  if (mNumberDimension > 2) {
-    mNodalZ = utilities::broadcastNumberVecFromRank(mNodalZ, root);
+  /* Material sampled at the integration points by an earlier run on this model. */
+  mNumberModelElements = mNumberElements;
+  if (!mMaterialCacheFile.empty()) {
+    mModelHash = rank == root ? utilities::hashFile(mExodusFileName) : 0;
+    MPI_Bcast(&mModelHash, 1, MPI_UNSIGNED_LONG_LONG, root, PETSC_COMM_WORLD);
+    if (mMaterialCache.open(mMaterialCacheFile, mModelHash, mNumberModelElements)) {
+      LOG() << "Reading the material at the integration points from " << mMaterialCacheFile << ".";
+    }
+  }
+
+  /* A distributed model is only held by the first rank, until the other ranks get their part in localize. */
+  if (mDistributed && rank != root) { return; }
+
+  /* Broadcast all vectors scaling with the model size (once per node if shared). */
+  if (!mDistributed) {
+    mNodalX.broadcast(root, mNodeShared);
+    mNodalY.broadcast(root, mNodeShared);
+    mElementalVariables.broadcast(root, mNodeShared);
+    mElementConnectivity.broadcast(root, mNodeShared);
+
+    /* Broadcast dimension specific components. */
+    if (mNumberDimension > 2) {
+      mNodalZ.broadcast(root, mNodeShared);
+    }
+  }
+
+  /* Element tree labels elements by centroid. Nodal tree labels elements by vertex. Shared trees are only
+   * built once, and broadcast. */
+  if (mNodeShared && !mDistributed) {
+    if (rank == root) { createElementalKdTree(); createNodalKdTree(); }
+    mElementalKdTree.broadcast(root, mNodeShared);
+    mNodalKdTree.broadcast(root, mNodeShared);
+  } else {
+    createElementalKdTree();
+    createNodalKdTree();
+  }
+
+}
+
+void ExodusModel::setHomogeneous(const PetscInt dim, const std::string &physics,
+                                 const std::map<std::string,PetscReal> &material) {
+
+  if (physics != "fluid" && physics != "elastic") {
+    throw std::runtime_error("Unknown physics '" + physics + "' of a homogeneous model. Currently we support "
+                                 "[ fluid, elastic ]");
   }
+  auto given = [&](const std::string &name, const PetscReal value) {
+    auto entry = material.find(name);
+    return entry == material.end() ? value : entry->second;
+  };
+
+  /* The isotropic medium in all parameterizations the physics read. */
+  const PetscReal vp = given("VP", 1.0), vs = given("VS", 0.5), rho = given("RHO", 1.0);
+  std::map<std::string,PetscReal> par = {
+      {"VP", vp}, {"VS", vs}, {"RHO", rho}, {"VPV", vp}, {"VPH", vp}, {"VSV", vs}, {"VSH", vs}, {"ETA", 1.0},
+      {"C11", rho * vp * vp}, {"C33", rho * vp * vp}, {"C13", rho * (vp * vp - 2 * vs * vs)},
+      {"C55", rho * vs * vs}};
+  for (auto &p: material) { par[p.first] = p.second; }
+
+  /* A single element, at the origin, with the same value at each of its vertices. */
+  mExodusFileName = "(homogeneous model)";
+  mNumberDimension = dim;
+  mNumberElements = mNumberModelElements = 1;
+  mNumberVertices = 1;
+  mNumberSideSets = mNumberNodeSets = 0;
+  mNumberElementBlocks = 1;
+  mVerticesPerElementPerBlock.assign(1, 1);
+  mElementConnectivity.assign(std::vector<PetscInt>(1, 1));
+  mNodalX.assign(std::vector<PetscReal>(1, 0));
+  mNodalY.assign(std::vector<PetscReal>(1, 0));
+  if (dim > 2) { mNodalZ.assign(std::vector<PetscReal>(1, 0)); }
+  mSideSetNames.clear();
+
+  const PetscInt num_vtx = dim == 3 ? 8 : 4;
+  std::vector<PetscReal> values;
+  mElementalVariableNames.clear();
+  for (auto &p: par) {
+    for (PetscInt v = 0; v < num_vtx; v++) {
+      mElementalVariableNames.push_back(p.first + "_" + std::to_string(v));
+      values.push_back(p.second);
+    }
+  }
+  mElementalVariableNames.push_back("fluid");
+  values.push_back(physics == "fluid" ? 1 : 0);
+  mElementalVariableIndex.clear();
+  for (PetscInt i = 0; i < mElementalVariableNames.size(); i++) {
+    mElementalVariableIndex[mElementalVariableNames[i]] = i;
+  }
+  mElementalVariables.assign(values);
 
-  /* Element tree labels elements by centroid. Nodal tree labels elements by vertex. */
   createElementalKdTree();
   createNodalKdTree();
 
 }
 
+void ExodusModel::localize(const Eigen::Ref<const Eigen::MatrixXd> &centers, const std::vector<PetscInt> &elements) {
+
+  int root = 0;
+  int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+  int size; MPI_Comm_size(PETSC_COMM_WORLD, &size);
+  if (mLocalized) { throw std::runtime_error("Exodus model has already been localized."); }
+  if (centers.cols() != mNumberDimension) {
+    throw std::runtime_error("Element centers do not match the model dimension.");
+  }
+  if (!elements.empty() && elements.size() != centers.rows()) {
+    throw std::runtime_error("Model elements do not match the element centers.");
+  }
+  int by_index = !elements.empty() || !centers.rows();
+  MPI_Allreduce(MPI_IN_PLACE, &by_index, 1, MPI_INT, MPI_MIN, PETSC_COMM_WORLD);
+
+  /* Gather all element centers on the first rank. */
+  int num_elm = centers.rows(), num_var = mElementalVariableNames.size();
+  std::vector<int> num_elm_rank(size), dsp(size, 0);
+  MPI_Gather(&num_elm, 1, MPI_INT, num_elm_rank.data(), 1, MPI_INT, root, PETSC_COMM_WORLD);
+  for (int r = 1; r < size; r++) { dsp[r] = dsp[r - 1] + num_elm_rank[r - 1]; }
+  const int num_elm_all = dsp[size - 1] + num_elm_rank[size - 1];
+  std::vector<int> ctr_cnt(size), ctr_dsp(size), var_cnt(size), var_dsp(size);
+  for (int r = 0; r < size; r++) {
+    ctr_cnt[r] = num_elm_rank[r] * mNumberDimension; ctr_dsp[r] = dsp[r] * mNumberDimension;
+    var_cnt[r] = num_elm_rank[r] * num_var; var_dsp[r] = dsp[r] * num_var;
+  }
+  std::vector<PetscReal> ctr(num_elm * mNumberDimension), ctr_all(rank == root ? num_elm_all * mNumberDimension : 0);
+  for (int i = 0; i < num_elm; i++) {
+    for (int d = 0; d < mNumberDimension; d++) { ctr[i * mNumberDimension + d] = centers(i, d); }
+  }
+  MPI_Gatherv(ctr.data(), ctr.size(), MPI_DOUBLE, ctr_all.data(), ctr_cnt.data(), ctr_dsp.data(), MPI_DOUBLE,
+              root, PETSC_COMM_WORLD);
+  std::vector<PetscInt> elm_all(rank == root && by_index ? num_elm_all : 0);
+  if (by_index) {
+    MPI_Gatherv(elements.data(), num_elm, MPIU_INT, elm_all.data(), num_elm_rank.data(), dsp.data(), MPIU_INT,
+                root, PETSC_COMM_WORLD);
+  }
+
+  /* Look up the parameters of every element, and send each rank those of its own elements. */
+  std::vector<PetscReal> var_all(rank == root ? num_elm_all * num_var : 0), var(num_elm * num_var);
+  if (rank == root) {
+    std::vector<PetscInt> index(num_elm_all);
+    if (by_index) { for (int i = 0; i < num_elm_all; i++) { index[i] = elementSlot(elm_all[i]); } }
+    else { mElementalKdTree.nearest(ctr_all.data(), num_elm_all, index.data()); }
+    for (int i = 0; i < num_elm_all; i++) {
+      for (int v = 0; v < num_var; v++) { var_all[i * num_var + v] = mElementalVariables[v * mNumberElements + index[i]]; }
+    }
+  }
+  MPI_Scatterv(var_all.data(), var_cnt.data(), var_dsp.data(), MPI_DOUBLE, var.data(), var.size(), MPI_DOUBLE,
+               root, PETSC_COMM_WORLD);
+
+  /* Keep the local parameters only, in the usual (per variable) layout. */
+  mNumberElements = num_elm;
+  std::vector<PetscReal> local_var(num_var * num_elm);
+  for (int i = 0; i < num_elm; i++) {
+    for (int v = 0; v < num_var; v++) { local_var[v * num_elm + i] = var[i * num_var + v]; }
+  }
+  mElementalVariables.assign(std::move(local_var));
+  mElementConnectivity.clear();
+  mLocalSlot.clear();
+  mLocalElements.clear();
+  if (by_index) {
+    for (int i = 0; i < num_elm; i++) { mLocalSlot[elements[i]] = i; }
+    mLocalElements = elements;
+  }
+
+  /* The elemental tree now holds the local element centers. */
+  mElementalKdTree.build(mNumberDimension, ctr.data(), num_elm);
+  mLocalized = true;
+  for (auto &member: mMembers) { member->localize(centers, elements); }
+
+}
+
+
+void ExodusModel::addMember(const std::string &filename) {
+
+  if (mLocalized) { throw std::runtime_error("Ensemble members must be added before the model is localized."); }
+  std::unique_ptr<ExodusModel> member(new ExodusModel());
+  member->setExodusFilename(filename);
+  member->mDistributed = mDistributed;
+  member->mNodeShared = mNodeShared;
+  member->read();
+
+  /* The elements are looked up by the same index or center in all members. */
+  if (member->mNumberElements != mNumberElements || member->mNumberDimension != mNumberDimension) {
+    throw std::runtime_error("The ensemble model '" + filename + "' holds " + std::to_string(member->mNumberElements) +
+                             " elements in " + std::to_string(member->mNumberDimension) + "D, but the model " +
+                             std::to_string(mNumberElements) + " in " + std::to_string(mNumberDimension) + "D.");
+  }
+  mMembers.push_back(std::move(member));
+
+}
+
+void ExodusModel::addNodalVariable(const std::string &name, const std::vector<PetscReal> &points,
+                                   const std::vector<PetscReal> &values) {
+
+  if (mLocalized) { throw std::runtime_error("A localized exodus model can not be written."); }
+  if (points.size() != values.size() * mNumberDimension) {
+    throw std::runtime_error("Nodal variable " + name + " needs a point per value.");
+  }
+
+  /* Gather the values on rank 0, which holds the model. */
+  int root = 0;
+  int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+  int size; MPI_Comm_size(PETSC_COMM_WORLD, &size);
+  int num = values.size();
+  std::vector<int> nums(size), offsets(size, 0), pnt_nums(size), pnt_offsets(size, 0);
+  MPI_Gather(&num, 1, MPI_INT, nums.data(), 1, MPI_INT, root, PETSC_COMM_WORLD);
+  for (int r = 0; r < size; r++) {
+    pnt_nums[r] = nums[r] * mNumberDimension;
+    if (r) { offsets[r] = offsets[r - 1] + nums[r - 1]; pnt_offsets[r] = offsets[r] * mNumberDimension; }
+  }
+  const int total = rank == root ? offsets.back() + nums.back() : 0;
+  std::vector<PetscReal> all_points(std::max(total * mNumberDimension, 1)), all_values(std::max(total, 1));
+  MPI_Gatherv(points.data(), points.size(), MPI_DOUBLE, all_points.data(), pnt_nums.data(), pnt_offsets.data(),
+              MPI_DOUBLE, root, PETSC_COMM_WORLD);
+  MPI_Gatherv(values.data(), num, MPI_DOUBLE, all_values.data(), nums.data(), offsets.data(), MPI_DOUBLE, root,
+              PETSC_COMM_WORLD);
+  if (rank != root) { return; }
+
+  std::vector<PetscInt> vertex(total);
+  if (total) { mNodalKdTree.nearest(all_points.data(), total, vertex.data()); }
+  std::vector<PetscReal> sum(mNumberVertices, 0), count(mNumberVertices, 0);
+  for (PetscInt i = 0; i < total; i++) { sum[vertex[i]] += all_values[i]; count[vertex[i]]++; }
+  for (PetscInt i = 0; i < mNumberVertices; i++) { if (count[i]) { sum[i] /= count[i]; } }
+
+  auto existing = std::find(mNodalVariableNames.begin(), mNodalVariableNames.end(), name);
+  if (existing != mNodalVariableNames.end()) {
+    std::copy(sum.begin(), sum.end(),
+              mNodalVariables.begin() + (existing - mNodalVariableNames.begin()) * mNumberVertices);
+  } else {
+    mNodalVariableNames.push_back(name);
+    mNodalVariables.insert(mNodalVariables.end(), sum.begin(), sum.end());
+    mNumberNodalVariables = mNodalVariableNames.size();
+  }
+
+}
 
 void ExodusModel::write(const std::string filename) {
 
+  if (mLocalized) { throw std::runtime_error("A localized exodus model can not be written."); }
+
   /* Read the model from rank 0. */
   int root = 0;
   int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
@@ -175,6 +414,78 @@ void ExodusModel::write(const std::string filename) {
   }
 }
 
+void ExodusModel::writeHdf5(const std::string filename,
+                            const std::map<std::string,std::vector<PetscReal>> &fields) {
+
+  int root = 0;
+  int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+  int size; MPI_Comm_size(PETSC_COMM_WORLD, &size);
+
+  /* Rows of this rank. A distributed model is only held by the first rank until it is localized. */
+  PetscInt beg = 0, num = mNumberElements;
+  if (!mLocalized) {
+    if (mDistributed) { num = rank == root ? mNumberElements : 0; }
+    else { beg = rank * mNumberElements / size; num = (rank + 1) * mNumberElements / size - beg; }
+  }
+  for (auto &field: fields) {
+    if (field.second.size() < beg + num) {
+      throw std::runtime_error("Field " + field.first + " does not match the elements of the model.");
+    }
+  }
+
+  /* Offset of the rows in the file. */
+  long num_row = num, off_row = 0, num_all = 0;
+  MPI_Exscan(&num_row, &off_row, 1, MPI_LONG, MPI_SUM, PETSC_COMM_WORLD);
+  if (!rank) { off_row = 0; }
+  MPI_Allreduce(&num_row, &num_all, 1, MPI_LONG, MPI_SUM, PETSC_COMM_WORLD);
+
+  std::vector<PetscInt> elements(num, -1);
+  if (!mLocalized) { for (PetscInt i = 0; i < num; i++) { elements[i] = beg + i; } }
+  else if (!mLocalElements.empty()) { elements = mLocalElements; }
+
+  hid_t plist_id = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fapl_mpio(plist_id, PETSC_COMM_WORLD, MPI_INFO_NULL);
+  hid_t file_id = H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, plist_id);
+  H5Pclose(plist_id);
+  if (file_id < 0) { throw std::runtime_error("Error opening HDF5 model file '" + filename + "'."); }
+  H5LTset_attribute_string(file_id, "/", "exodus_file", mExodusFileName.c_str());
+
+  /* Every rank writes its own rows of each dataset, collectively. */
+  hsize_t n_all = num_all, n = num, off = off_row;
+  auto write_rows = [&](const std::string &name, hid_t type, const void *data) {
+    hid_t filespace = H5Screate_simple(1, &n_all, NULL);
+    hid_t dset_id = H5Dcreate(file_id, name.c_str(), type, filespace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    H5Sselect_hyperslab(filespace, H5S_SELECT_SET, &off, NULL, &n, NULL);
+    hid_t memspace = H5Screate_simple(1, &n, NULL);
+    hid_t xfer_id = H5Pcreate(H5P_DATASET_XFER);
+    H5Pset_dxpl_mpio(xfer_id, H5FD_MPIO_COLLECTIVE);
+    H5Dwrite(dset_id, type, memspace, filespace, xfer_id, data);
+    H5Pclose(xfer_id);
+    H5Sclose(memspace);
+    H5Sclose(filespace);
+    H5Dclose(dset_id);
+  };
+
+  std::vector<long long> model_element(elements.begin(), elements.end());
+  write_rows("/model_element", H5T_NATIVE_LLONG, model_element.data());
+  H5Gclose(H5Gcreate(file_id, "/elemental", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT));
+  for (size_t v = 0; v < mElementalVariableNames.size(); v++) {
+    const PetscReal *values = num ? mElementalVariables.data() + v * mNumberElements + beg : NULL;
+    write_rows("/elemental/" + mElementalVariableNames[v], H5T_NATIVE_DOUBLE, values);
+  }
+
+  /* The names of the additional fields are the same on all ranks, so the datasets are created in the same
+   * order everywhere. */
+  if (!fields.empty()) {
+    H5Gclose(H5Gcreate(file_id, "/fields", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT));
+    for (auto &field: fields) {
+      write_rows("/fields/" + field.first, H5T_NATIVE_DOUBLE, field.second.data() + beg);
+    }
+  }
+  H5Fclose(file_id);
+
+}
+
 void ExodusModel::exodusError(const int retval, std::string func_name) {
 
   if (retval < 0) {
@@ -189,18 +500,18 @@ void ExodusModel::exodusError(const int retval, std::string func_name) {
 
 void ExodusModel::readCoordinates() {
 
-  mNodalX.resize(mNumberVertices);
-  mNodalY.resize(mNumberVertices);
-  if (mNumberDimension == 3) { mNodalZ.resize(mNumberVertices); }
+  std::vector<PetscReal> x(mNumberVertices), y(mNumberVertices), z;
+  if (mNumberDimension == 3) { z.resize(mNumberVertices); }
   if (mNumberDimension == 2) {
     exodusError(ex_get_coord(
-        mExodusId, mNodalX.data(), mNodalY.data(), NULL),
+        mExodusId, x.data(), y.data(), NULL),
                 "ex_get_coord");
   } else {
     exodusError(ex_get_coord(
-        mExodusId, mNodalX.data(), mNodalY.data(), mNodalZ.data()),
+        mExodusId, x.data(), y.data(), z.data()),
                 "ex_get_coord");
   }
+  mNodalX.assign(std::move(x)); mNodalY.assign(std::move(y)); mNodalZ.assign(std::move(z));
 
 }
 
@@ -237,76 +548,33 @@ void ExodusModel::getInitialization() {
 
 void ExodusModel::createNodalKdTree() {
 
-  // Need to keep the index arrays allocated.
-  mNodalKdTreeData.resize(mNodalX.size());
-
-  // Create.
-  if (mNumberDimension == 2) {
-    mNodalKdTree = kd_create(2);
-    for (auto i = 0; i < mNumberVertices; i++) {
-      mNodalKdTreeData[i] = i;
-      kd_insert(mNodalKdTree, std::vector<double> {mNodalX[i], mNodalY[i]}.data(), &mNodalKdTreeData[i]);
-    }
-  } else {
-    mNodalKdTree = kd_create(3);
-    for (auto i = 0; i < mNumberVertices; i++) {
-      mNodalKdTreeData[i] = i;
-      kd_insert(mNodalKdTree, std::vector<double> {mNodalX[i], mNodalY[i], mNodalZ[i]}.data(),
-                &mNodalKdTreeData[i]);
-    }
+  std::vector<PetscReal> pts(mNumberVertices * mNumberDimension);
+  for (auto i = 0; i < mNumberVertices; i++) {
+    pts[i * mNumberDimension + 0] = mNodalX[i];
+    pts[i * mNumberDimension + 1] = mNodalY[i];
+    if (mNumberDimension == 3) { pts[i * mNumberDimension + 2] = mNodalZ[i]; }
   }
+  mNodalKdTree.build(mNumberDimension, pts.data(), mNumberVertices);
 
 }
 
 
 void ExodusModel::createElementalKdTree() {
 
-  // Need to keep the index arrays allocated.
-  mElementalKdTreeData.resize(mNumberElements);
-
   // TODO: Multiple blocks?
   int num_vertex_per_elem = mVerticesPerElementPerBlock[0]; // first block
 
-  if (mNumberDimension == 2) {
-    mElementalKdTree = kd_create(2);
-    for (auto i = 0; i < mNumberElements; i++) {
-
-      // Calculate element centers.
-      double avg_x = 0, avg_y = 0;
-      for (auto j = num_vertex_per_elem * i; j < num_vertex_per_elem * (i + 1); j++) {
-        avg_x += mNodalX[mElementConnectivity[j] - 1];
-        avg_y += mNodalY[mElementConnectivity[j] - 1];
-      }
-
-      // Insert centers into tree.
-      mElementalKdTreeData[i] = i;
-      kd_insert(mElementalKdTree, std::vector<double> {
-                    avg_x / (double) num_vertex_per_elem, avg_y / (double) num_vertex_per_elem}.data(),
-                &mElementalKdTreeData[i]);
-    }
-
-  } else if (mNumberDimension == 3) {
-    mElementalKdTree = kd_create(3);
-    for (auto i = 0; i < mNumberElements; i++) {
-
-      // Calculate element centers.
-      double avg_x = 0, avg_y = 0, avg_z = 0;
-      for (auto j = num_vertex_per_elem * i; j < num_vertex_per_elem * (i + 1); j++) {
-        avg_x += mNodalX[mElementConnectivity[j] - 1];
-        avg_y += mNodalY[mElementConnectivity[j] - 1];
-        avg_z += mNodalZ[mElementConnectivity[j] - 1];
-      }
-
-      // Insert centers into tree.
-      mElementalKdTreeData[i] = i;
-      kd_insert(mElementalKdTree,
-                std::vector<double> {
-                    avg_x / (double) num_vertex_per_elem,
-                    avg_y / (double) num_vertex_per_elem,
-                    avg_z / (double) num_vertex_per_elem}.data(),
-                &mElementalKdTreeData[i]);
+  // Calculate element centers.
+  std::vector<PetscReal> ctr(mNumberElements * mNumberDimension, 0);
+  for (auto i = 0; i < mNumberElements; i++) {
+    for (auto j = num_vertex_per_elem * i; j < num_vertex_per_elem * (i + 1); j++) {
+      ctr[i * mNumberDimension + 0] += mNodalX[mElementConnectivity[j] - 1];
+      ctr[i * mNumberDimension + 1] += mNodalY[mElementConnectivity[j] - 1];
+      if (mNumberDimension == 3) { ctr[i * mNumberDimension + 2] += mNodalZ[mElementConnectivity[j] - 1]; }
     }
   }
+  for (auto &c: ctr) { c /= num_vertex_per_elem; }
+  mElementalKdTree.build(mNumberDimension, ctr.data(), mNumberElements);
 
 }
 
@@ -362,12 +630,13 @@ void ExodusModel::readElementalVariables() {
                   "ex_get_variable_names");
       for (auto i = 0; i < mNumberElementalVariables; i++) { mElementalVariableNames.push_back(std::string(nm[i])); }
 
-      std::vector<double> buffer(mNumberElements);
+      std::vector<double> buffer(mNumberElements), variables;
       for (auto i = 0; i < mNumberElementalVariables; i++) {
         exodusError(ex_get_var(mExodusId, 1, EX_ELEM_BLOCK, (i + 1), 1, mNumberElements, buffer.data()),
                     "ex_get_var " + mElementalVariableNames[i]);
-        mElementalVariables.insert(mElementalVariables.end(), buffer.begin(), buffer.end());
+        variables.insert(variables.end(), buffer.begin(), buffer.end());
       }
+      mElementalVariables.assign(std::move(variables));
     } catch (salvus_warning &e) {
       LOG() << "Reading elemental variables in file " + mExodusFileName + " raised a warning. \n"
           "This usually is not a problem, and just means the elemental variables were not defined in "
@@ -395,9 +664,7 @@ PetscReal ExodusModel::getNodalParameterAtNode(const Eigen::Ref<const RealVec>&
   }
 
   // Get spatial index.
-  kdres *set = kd_nearest(mNodalKdTree, point.data());
-  auto spatial_index = *(int *) kd_res_item_data(set);
-  kd_res_free(set);
+  auto spatial_index = mNodalKdTree.nearest(point.data());
 
   // Get parameter index.
   int i = 0;
@@ -414,8 +681,9 @@ PetscReal ExodusModel::getNodalParameterAtNode(const Eigen::Ref<const RealVec>&
 void ExodusModel::readConnectivity() {
 
   int block_id = 0;
-  mElementConnectivity.resize(mVerticesPerElementPerBlock[block_id] * mNumberElements);
-  exodusError(ex_get_elem_conn(mExodusId, mElementBlockIds[block_id], mElementConnectivity.data()), "ex_get_elem_conn");
+  std::vector<PetscInt> connectivity(mVerticesPerElementPerBlock[block_id] * mNumberElements);
+  exodusError(ex_get_elem_conn(mExodusId, mElementBlockIds[block_id], connectivity.data()), "ex_get_elem_conn");
+  mElementConnectivity.assign(std::move(connectivity));
 
 }
 
@@ -430,54 +698,163 @@ PetscScalar ExodusModel::getElementalMaterialParameterAtVertex(const Eigen::Ref<
             "Perhaps you meant to try a nodal parameter?" );
   }
 
+  if (mElementalKdTree.empty()) {
+    throw std::runtime_error("The distributed exodus model must be localized before it is queried.");
+  }
+
   // Get elemental spatial index.
-  auto *set = kd_nearest(mElementalKdTree, elem_center.data());
-  auto spatial_index = *(int *) kd_res_item_data(set);
-  kd_res_free(set);
+  auto spatial_index = mElementalKdTree.nearest(elem_center.data());
+
+  return elementalParameter(spatial_index, parameter_name, vertex_num);
+}
 
+PetscScalar ExodusModel::getElementalMaterialParameterAtVertex(const PetscInt elem_num,
+                                                               std::string parameter_name,
+                                                               const PetscInt vertex_num) const {
+
+  if (!mElementalVariables.size()) {
+    throw std::runtime_error(
+        "You've tried to query a elemental parameter, but none are defined. "
+            "Perhaps you meant to try a nodal parameter?" );
+  }
+
+  return elementalParameter(elementSlot(elem_num), parameter_name, vertex_num);
+}
+
+PetscInt ExodusModel::elementSlot(const PetscInt elem_num) const {
+
+  /* A localized model stores its elements in the order they were localized in. */
+  if (mLocalized) {
+    auto slot = mLocalSlot.find(elem_num);
+    if (slot == mLocalSlot.end()) {
+      throw std::runtime_error("Element " + std::to_string(elem_num) + " is not held by the localized model.");
+    }
+    return slot->second;
+  }
+  if (elem_num < 0 || elem_num >= mNumberElements) {
+    throw std::runtime_error("Element " + std::to_string(elem_num) + " is not in exodus file " + mExodusFileName);
+  }
+  return elem_num;
+
+}
+
+PetscScalar ExodusModel::elementalParameter(const PetscInt spatial_index, std::string parameter_name,
+                                            const PetscInt vertex_num) const {
+  return mElementalVariables[elementalColumn(parameter_name, vertex_num, true) * mNumberElements + spatial_index];
+}
+
+PetscInt ExodusModel::elementalColumn(std::string parameter_name, const PetscInt vertex_num,
+                                      const bool warn) const {
 
   /* We can change the requested parameter name in some cases. Still should eventuall change. */
-  try {
-    if ((std::find(mElementalVariableNames.begin(), mElementalVariableNames.end(), parameter_name + "_0") ==
-        mElementalVariableNames.end())) {
-      if ((parameter_name == "VP") && (std::find(
-          mElementalVariableNames.begin(), mElementalVariableNames.end(), "VPV_0")
-          != mElementalVariableNames.end())) {
-        parameter_name = "VPV";
-        throw salvus_warning("Isotropic VP requested, but can only find anisotropic VP. Using VPV!");
-      } else if ((parameter_name == "VPV") && (std::find(
-          mElementalVariableNames.begin(), mElementalVariableNames.end(), "VP_0")
-          != mElementalVariableNames.end())) {
-        parameter_name = "VP";
-        throw salvus_warning("Anisotropic VPV requested, but can only find isotropic VP. Using VP!");
-      } else {
-        throw std::runtime_error("Requested parameter " + parameter_name + " which is not stored as an "
-            "elemental variable in file " + mExodusFileName);
-      }
+  auto stored = [&](const std::string &name) { return mElementalVariableIndex.count(name + "_0") > 0; };
+  if (!stored(parameter_name)) {
+    if (parameter_name == "VP" && stored("VPV")) {
+      parameter_name = "VPV";
+      if (warn) { LOG() << "Isotropic VP requested, but can only find anisotropic VP. Using VPV!"; }
+    } else if (parameter_name == "VPV" && stored("VP")) {
+      parameter_name = "VP";
+      if (warn) { LOG() << "Anisotropic VPV requested, but can only find isotropic VP. Using VP!"; }
+    } else {
+      throw std::runtime_error("Requested parameter " + parameter_name + " which is not stored as an "
+          "elemental variable in file " + mExodusFileName);
     }
-  } catch (salvus_warning &e) {
-    LOG() << e.what();
   }
 
   /* By the time we get here, we know that the parameter exists. */
-  PetscInt parameter_index = 0; PetscInt i = 0;
-  std::string full_name = parameter_name + "_" + std::to_string(vertex_num);
-  for (auto &name: mElementalVariableNames) {
-    if (name == full_name) { parameter_index = i; }
-    i++;
+  auto column = mElementalVariableIndex.find(parameter_name + "_" + std::to_string(vertex_num));
+  return column != mElementalVariableIndex.end() ? column->second : 0;
+
+}
+
+void ExodusModel::getElementalMaterialParameters(const Eigen::Ref<const Eigen::MatrixXd> &centers,
+                                                 const std::vector<PetscInt> &elements,
+                                                 const std::vector<std::string> &parameter_names,
+                                                 const PetscInt num_vtx, std::vector<PetscReal> &values) const {
+
+  if (!mElementalVariables.size()) {
+    throw std::runtime_error(
+        "You've tried to query a elemental parameter, but none are defined. "
+            "Perhaps you meant to try a nodal parameter?" );
+  }
+  if (!elements.empty() && elements.size() != centers.rows()) {
+    throw std::runtime_error("Model elements do not match the element centers.");
+  }
+
+  /* Resolve the names once (warning once per parameter), in the order of the output. */
+  const PetscInt num_par = parameter_names.size(), num_col = num_vtx * num_par;
+  std::vector<PetscInt> column(num_col);
+  for (PetscInt v = 0; v < num_vtx; v++) {
+    for (PetscInt p = 0; p < num_par; p++) {
+      column[v * num_par + p] = elementalColumn(parameter_names[p], v, v == 0);
+    }
+  }
+
+  /* Slot of every element. Those without a model element are searched for together. */
+  const PetscInt num_elm = centers.rows();
+  std::vector<PetscInt> slot(num_elm), search;
+  std::vector<PetscReal> search_ctr;
+  for (PetscInt i = 0; i < num_elm; i++) {
+    if (!elements.empty() && elements[i] >= 0) { slot[i] = elementSlot(elements[i]); continue; }
+    search.push_back(i);
+    for (PetscInt d = 0; d < centers.cols(); d++) { search_ctr.push_back(centers(i, d)); }
+  }
+  if (!search.empty()) {
+    if (mElementalKdTree.empty()) {
+      throw std::runtime_error("The distributed exodus model must be localized before it is queried.");
+    }
+    assert(centers.cols() == mNumberDimension);
+    std::vector<PetscInt> found(search.size());
+    mElementalKdTree.nearest(search_ctr.data(), search.size(), found.data());
+    for (PetscInt k = 0; k < search.size(); k++) { slot[search[k]] = found[k]; }
   }
 
-  return mElementalVariables[parameter_index * mNumberElements + spatial_index];
+  values.resize(num_elm * num_col);
+  for (PetscInt i = 0; i < num_elm; i++) {
+    for (PetscInt c = 0; c < num_col; c++) {
+      values[i * num_col + c] = mElementalVariables[column[c] * mNumberElements + slot[i]];
+    }
+  }
+
+}
+
+const PetscReal *ExodusModel::CachedParameterAtIntPts(const PetscInt elem_num, const std::string &parameter_name,
+                                                      const PetscInt num_pnt) const {
+  if (!HasMaterialCache(num_pnt)) { return NULL; }
+  return mMaterialCache.parameter(elem_num, parameter_name);
+}
+
+bool ExodusModel::HasMaterialCache(const PetscInt num_pnt) const {
+  return !mMaterialCache.empty() && mMaterialCache.NumPnt() == num_pnt;
+}
+
+void ExodusModel::writeMaterialCache(const PetscInt num_pnt, const std::vector<PetscInt> &elements,
+                                     const std::vector<std::string> &names, const std::vector<PetscReal> &values) {
+  if (mMaterialCacheFile.empty()) { throw std::runtime_error("No material cache file was specified."); }
+  mMaterialCache.close();
+  MaterialCache::write(mMaterialCacheFile, mModelHash, mNumberModelElements, num_pnt, elements, names, values);
+  LOG() << "Wrote the material at the integration points to " << mMaterialCacheFile << ".";
 }
 
 std::string ExodusModel::getElementType(const Eigen::VectorXd &elem_center) {
 
   assert(elem_center.size() == mNumberDimension);
 
+  if (mElementalKdTree.empty()) {
+    throw std::runtime_error("The distributed exodus model must be localized before it is queried.");
+  }
+
   // Get spatial element index.
-  auto *set = kd_nearest(mElementalKdTree, elem_center.data());
-  auto spatial_index = *(int *) kd_res_item_data(set);
-  kd_res_free(set);
+  auto spatial_index = mElementalKdTree.nearest(elem_center.data());
+
+  return elementType(spatial_index);
+}
+
+std::string ExodusModel::getElementType(const PetscInt elem_num) {
+  return elementType(elementSlot(elem_num));
+}
+
+std::string ExodusModel::elementType(const PetscInt spatial_index) const {
 
   auto iterator = std::find(
       mElementalVariableNames.begin(),
@@ -543,6 +920,17 @@ std::string ExodusModel::SideSetName(const PetscInt side_set_num) {
 
 }
 
+size_t ExodusModel::MemoryBytes() const {
+  size_t bytes = Memory::bytes(mElementBlockIds) + mElementConnectivity.Bytes() +
+      Memory::bytes(mVerticesPerElementPerBlock) + Memory::bytes(mElementalVariableNames) +
+      mElementalVariables.Bytes() + Memory::bytes(mElementalVariableIndex) +
+      Memory::bytes(mNodalVariables) + Memory::bytes(mNodalVariableNames) + Memory::bytes(mGlobalVariables) +
+      Memory::bytes(mGlobalVariableNames) + Memory::bytes(mInfo) + mNodalX.Bytes() + mNodalY.Bytes() +
+      mNodalZ.Bytes() + Memory::bytes(mSideSetNames) + Memory::bytes(mLocalSlot) + Memory::bytes(mLocalElements);
+  for (auto &member: mMembers) { bytes += member->MemoryBytes(); }
+  return bytes;
+}
+
 void ExodusModel::readGlobalVariables() {
 
   // Get variables names.
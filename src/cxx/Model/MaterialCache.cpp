@@ -0,0 +1,173 @@
+#include <Model/MaterialCache.h>
+#include <Utilities/Utilities.h>
+#include <Utilities/Logging.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+  const char magic[8] = {'S', 'L', 'V', 'S', 'M', 'A', 'T', '1'};
+  const size_t name_length = 64, alignment = 4096;
+
+  struct Header {
+    char magic[8];
+    unsigned long long hash;
+    long long real_size, num_elm, num_pnt, num_par;
+  };
+
+  size_t align(const size_t size) { return (size + alignment - 1) / alignment * alignment; }
+  size_t dataOffset(const long long num_par) { return align(sizeof(Header) + num_par * name_length); }
+  size_t blockSize(const long long num_elm, const long long num_pnt) {
+    return align(num_elm * num_pnt * sizeof(PetscReal));
+  }
+
+}
+
+MaterialCache::~MaterialCache() { close(); }
+
+void MaterialCache::close() {
+  if (mMap) { munmap(mMap, mMapSize); }
+  mMap = NULL; mMapSize = 0; mNumElm = 0; mNumPnt = 0; mBlock.clear();
+}
+
+bool MaterialCache::open(const std::string &filename, const unsigned long long model_hash,
+                         const PetscInt num_elm) {
+
+  close();
+
+  /* Map the file, and keep it if the header matches this model. */
+  int hit = 0;
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  struct stat st;
+  if (fd >= 0 && !fstat(fd, &st) && st.st_size >= static_cast<off_t>(sizeof(Header))) {
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (map != MAP_FAILED) {
+      const Header *h = static_cast<const Header*>(map);
+      hit = !std::memcmp(h->magic, magic, sizeof(magic)) && h->hash == model_hash &&
+          h->real_size == sizeof(PetscReal) && h->num_elm == num_elm && h->num_par >= 0 &&
+          static_cast<size_t>(st.st_size) >= dataOffset(h->num_par) + h->num_par * blockSize(h->num_elm, h->num_pnt);
+      if (hit) {
+        mMap = map; mMapSize = st.st_size; mNumElm = h->num_elm; mNumPnt = h->num_pnt;
+        const char *names = static_cast<const char*>(map) + sizeof(Header);
+        const char *data = static_cast<const char*>(map) + dataOffset(h->num_par);
+        for (long long p = 0; p < h->num_par; p++) {
+          std::string name(names + p * name_length, strnlen(names + p * name_length, name_length));
+          mBlock[name] = reinterpret_cast<const PetscReal*>(data + p * blockSize(mNumElm, mNumPnt));
+        }
+      } else {
+        munmap(map, st.st_size);
+      }
+    }
+  }
+  if (fd >= 0) { ::close(fd); }
+
+  /* Use the cache on all ranks, or on none. */
+  MPI_Allreduce(MPI_IN_PLACE, &hit, 1, MPI_INT, MPI_MIN, PETSC_COMM_WORLD);
+  if (!hit) { close(); }
+  return hit;
+
+}
+
+const PetscReal *MaterialCache::parameter(const PetscInt elm, const std::string &name) const {
+
+  auto block = mBlock.find(name);
+  if (block == mBlock.end() || elm < 0 || elm >= mNumElm) { return NULL; }
+  const PetscReal *values = block->second + elm * mNumPnt;
+  return std::isnan(values[0]) ? NULL : values;
+
+}
+
+void MaterialCache::write(const std::string &filename, const unsigned long long model_hash,
+                          const PetscInt num_elm, const PetscInt num_pnt, const std::vector<PetscInt> &elements,
+                          const std::vector<std::string> &names, const std::vector<PetscReal> &values) {
+
+  int root = 0;
+  int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+  int size; MPI_Comm_size(PETSC_COMM_WORLD, &size);
+  for (auto &name: names) {
+    if (name.size() >= name_length) { throw std::runtime_error("Parameter name " + name + " is too long to cache."); }
+  }
+
+  /* Collect the parameter names of all ranks (one per line). */
+  std::string my_names;
+  for (auto &name: names) { my_names += name + "\n"; }
+  int num_chr = my_names.size();
+  std::vector<int> num_chr_rank(size), chr_dsp(size, 0);
+  MPI_Gather(&num_chr, 1, MPI_INT, num_chr_rank.data(), 1, MPI_INT, root, PETSC_COMM_WORLD);
+  if (rank == root) { std::partial_sum(num_chr_rank.begin(), num_chr_rank.end() - 1, chr_dsp.begin() + 1); }
+  std::vector<char> all_chr(rank == root ? chr_dsp[size - 1] + num_chr_rank[size - 1] : 0);
+  MPI_Gatherv(&my_names[0], num_chr, MPI_CHAR, all_chr.data(), num_chr_rank.data(), chr_dsp.data(), MPI_CHAR,
+              root, PETSC_COMM_WORLD);
+  std::vector<std::string> all_names;
+  if (rank == root) {
+    std::set<std::string> unique;
+    std::stringstream all(std::string(all_chr.begin(), all_chr.end()));
+    for (std::string name; std::getline(all, name);) { unique.insert(name); }
+    all_names.assign(unique.begin(), unique.end());
+  }
+  all_names = utilities::broadcastStringVecFromRank(all_names, root);
+
+  /* Lay out this rank's values by the common parameters. */
+  const PetscInt num_par = all_names.size(), num_mine = elements.size();
+  std::vector<PetscReal> mine(num_mine * num_par * num_pnt, std::numeric_limits<PetscReal>::quiet_NaN());
+  for (PetscInt p = 0; p < names.size(); p++) {
+    PetscInt q = std::find(all_names.begin(), all_names.end(), names[p]) - all_names.begin();
+    for (PetscInt i = 0; i < num_mine; i++) {
+      std::copy(values.begin() + (i * names.size() + p) * num_pnt,
+                values.begin() + (i * names.size() + p + 1) * num_pnt, mine.begin() + (i * num_par + q) * num_pnt);
+    }
+  }
+
+  /* Collect all elements on the first rank. */
+  int num_elm_mine = num_mine;
+  std::vector<int> num_elm_rank(size), elm_dsp(size, 0), val_cnt(size), val_dsp(size);
+  MPI_Gather(&num_elm_mine, 1, MPI_INT, num_elm_rank.data(), 1, MPI_INT, root, PETSC_COMM_WORLD);
+  if (rank == root) { std::partial_sum(num_elm_rank.begin(), num_elm_rank.end() - 1, elm_dsp.begin() + 1); }
+  for (int r = 0; r < size; r++) {
+    val_cnt[r] = num_elm_rank[r] * num_par * num_pnt; val_dsp[r] = elm_dsp[r] * num_par * num_pnt;
+  }
+  const int num_elm_all = rank == root ? elm_dsp[size - 1] + num_elm_rank[size - 1] : 0;
+  std::vector<PetscInt> elm_all(num_elm_all);
+  std::vector<PetscReal> val_all(num_elm_all * num_par * num_pnt);
+  MPI_Gatherv(elements.data(), num_elm_mine, MPIU_INT, elm_all.data(), num_elm_rank.data(), elm_dsp.data(),
+              MPIU_INT, root, PETSC_COMM_WORLD);
+  MPI_Gatherv(mine.data(), mine.size(), MPIU_REAL, val_all.data(), val_cnt.data(), val_dsp.data(), MPIU_REAL,
+              root, PETSC_COMM_WORLD);
+  if (rank != root) { return; }
+
+  /* Header, names, and one (page aligned) block per parameter. */
+  std::ofstream f(filename.c_str(), std::ios::binary);
+  Header h;
+  std::memcpy(h.magic, magic, sizeof(magic));
+  h.hash = model_hash; h.real_size = sizeof(PetscReal); h.num_elm = num_elm; h.num_pnt = num_pnt; h.num_par = num_par;
+  f.write(reinterpret_cast<const char*>(&h), sizeof(h));
+  for (auto &name: all_names) {
+    std::vector<char> padded(name_length, 0); std::copy(name.begin(), name.end(), padded.begin());
+    f.write(padded.data(), name_length);
+  }
+  std::vector<char> padding(alignment, 0);
+  f.write(padding.data(), dataOffset(num_par) - sizeof(Header) - num_par * name_length);
+  std::vector<PetscReal> block(blockSize(num_elm, num_pnt) / sizeof(PetscReal));
+  for (PetscInt p = 0; p < num_par; p++) {
+    std::fill(block.begin(), block.end(), std::numeric_limits<PetscReal>::quiet_NaN());
+    for (PetscInt i = 0; i < num_elm_all; i++) {
+      if (elm_all[i] < 0 || elm_all[i] >= num_elm) { continue; }
+      std::copy(val_all.begin() + (i * num_par + p) * num_pnt, val_all.begin() + (i * num_par + p + 1) * num_pnt,
+                block.begin() + elm_all[i] * num_pnt);
+    }
+    f.write(reinterpret_cast<const char*>(block.data()), block.size() * sizeof(PetscReal));
+  }
+  if (!f) { LOG() << "Warning: could not write material cache '" << filename << "'."; }
+
+}
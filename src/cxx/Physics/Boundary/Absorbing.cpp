@@ -0,0 +1,174 @@
+#include <Mesh/Mesh.h>
+#include <Model/ExodusModel.h>
+#include <Physics/Absorbing.h>
+#include <Source/Injection.h>
+#include <Utilities/Options.h>
+#include <Utilities/Types.h>
+#include <Utilities/Scratch.h>
+
+using namespace Eigen;
+
+/* Nodal points of a shape, one row per dof. */
+static RealMat nodalPoints(const std::tuple<RealVec, RealVec> &pts) {
+  RealMat p(std::get<0>(pts).size(), 2);
+  p << std::get<0>(pts), std::get<1>(pts);
+  return p;
+}
+static RealMat nodalPoints(const std::tuple<RealVec, RealVec, RealVec> &pts) {
+  RealMat p(std::get<0>(pts).size(), 3);
+  p << std::get<0>(pts), std::get<1>(pts), std::get<2>(pts);
+  return p;
+}
+
+template <typename BasePhysics>
+Absorbing<BasePhysics>::Absorbing(std::unique_ptr<Options> const &options): BasePhysics(options) { }
+
+template <typename BasePhysics>
+const std::vector<FieldId> &Absorbing<BasePhysics>::PullElementalFields() const {
+  static const std::vector<FieldId> pull = [](const std::vector<FieldId> &base) {
+    /* The velocity of u, ux, ... is v, vx, ... */
+    std::vector<FieldId> fields(base);
+    for (auto f: base) { fields.push_back(FieldIdFromName("v" + std::string(FieldName(f)).substr(1))); }
+    return fields;
+  }(BasePhysics::PullElementalFields());
+  return pull;
+}
+
+template <typename BasePhysics>
+void Absorbing<BasePhysics>::setBoundaryConditions(std::unique_ptr<Mesh> const &mesh) {
+  mFaces = mesh->AbsorbingFaces(BasePhysics::ElmNum());
+  mInjFaces = mesh->InjectionFaces(BasePhysics::ElmNum());
+  mFaceArgs.clear();
+  std::vector<PetscInt> edges = mesh->EdgeNumbers(BasePhysics::ElmNum());
+  for (auto f: mFaces) { mFaceArgs.push_back(BasePhysics::NumDim() == 2 ? edges[f] : f); }
+  BasePhysics::setBoundaryConditions(mesh);
+}
+
+template <typename BasePhysics>
+void Absorbing<BasePhysics>::attachMaterialProperties(std::unique_ptr<ExodusModel> const &model) {
+
+  BasePhysics::attachMaterialProperties(model);
+
+  /* Density and wave speeds at the integration points (the scalar equation has unit density). */
+  const PetscInt num_dim = BasePhysics::NumDim(), num_pnt = BasePhysics::NumIntPnt();
+  const PetscInt num_fields = BasePhysics::PullElementalFields().size();
+  RealVec rho, vp, vs;
+  if (num_fields == 1) {
+    vp = BasePhysics::ParAtIntPts("VP"); vs = vp; rho = RealVec::Ones(num_pnt);
+  } else if (num_dim == 2) {
+    rho = BasePhysics::ParAtIntPts("RHO");
+    vp = (BasePhysics::ParAtIntPts("C11").array() / rho.array()).sqrt();
+    vs = (BasePhysics::ParAtIntPts("C55").array() / rho.array()).sqrt();
+  } else {
+    rho = BasePhysics::ParAtIntPts("RHO");
+    vp = BasePhysics::ParAtIntPts("VPV"); vs = BasePhysics::ParAtIntPts("VSV");
+  }
+
+  /* The dofs of each face, with the normal of the plane through them (pointing away from the element center),
+   * and their weights in the face integral. */
+  const RealMat pts = nodalPoints(BasePhysics::buildNodalPoints());
+  const RealVec ctr = pts.colwise().mean().transpose();
+  mAbsDofs.clear(); mInjAbs.clear(); mInjRows.clear();
+  std::vector<RealVec> normals;
+  std::vector<PetscReal> wgt_p, wgt_s, wgt_inj;
+  for (PetscInt i = 0; i < mFaces.size(); i++) {
+
+    std::vector<PetscInt> dofs = num_dim == 2 ? BasePhysics::getDofsOnEdge(mFaces[i]) :
+                                                BasePhysics::getDofsOnFace(mFaces[i]);
+    RealVec wgt = BasePhysics::applyTestAndIntegrateEdge(RealVec::Ones(num_pnt), mFaceArgs[i]);
+    RealMat face(dofs.size(), num_dim);
+    for (PetscInt j = 0; j < dofs.size(); j++) { face.row(j) = pts.row(dofs[j]); }
+    const RealVec face_ctr = face.colwise().mean().transpose();
+    RealMat centered = face.rowwise() - face_ctr.transpose();
+    SelfAdjointEigenSolver<RealMat> eig(centered.transpose() * centered);
+    RealVec n = eig.eigenvectors().col(0);
+    if (n.dot(face_ctr - ctr) < 0) { n = -n; }
+
+    const bool injecting = std::find(mInjFaces.begin(), mInjFaces.end(), mFaces[i]) != mInjFaces.end();
+    for (auto d: dofs) {
+      if (injecting) {
+        const RealVec x = pts.row(d).transpose();
+        mInjAbs.push_back(mAbsDofs.size());
+        mInjRows.push_back(Injection::Lookup(x.data()));
+        wgt_inj.push_back(wgt(d));
+      }
+      mAbsDofs.push_back(d);
+      normals.push_back(n);
+      wgt_p.push_back(wgt(d) * rho(d) * vp(d));
+      wgt_s.push_back(wgt(d) * rho(d) * vs(d));
+    }
+
+  }
+  mAbsNormals.resize(mAbsDofs.size(), num_dim);
+  mAbsWgtP.resize(mAbsDofs.size()); mAbsWgtS.resize(mAbsDofs.size());
+  for (PetscInt k = 0; k < mAbsDofs.size(); k++) {
+    mAbsNormals.row(k) = normals[k].transpose();
+    mAbsWgtP(k) = wgt_p[k]; mAbsWgtS(k) = wgt_s[k];
+  }
+  mInjWgt = Map<RealVec>(wgt_inj.data(), wgt_inj.size());
+  if (!mInjAbs.empty() && Injection::NumComponents() != num_fields) {
+    throw std::runtime_error("The injection file gives " + std::to_string(Injection::NumComponents()) +
+                             " components per point, but element " + std::to_string(BasePhysics::ElmNum()) +
+                             " on an injection boundary has " + std::to_string(num_fields) + " fields.");
+  }
+
+}
+
+template <typename BasePhysics>
+Eigen::Map<MatrixXd> Absorbing<BasePhysics>::computeSurfaceIntegral(const Ref<const MatrixXd> &u) {
+
+  Eigen::Map<MatrixXd> rval = BasePhysics::computeSurfaceIntegral(u);
+
+  /* Velocities follow the fields of BasePhysics. */
+  const PetscInt num_fields = BasePhysics::PullElementalFields().size();
+  if (num_fields == 1) {
+    for (PetscInt k = 0; k < mAbsDofs.size(); k++) { rval(mAbsDofs[k], 0) -= mAbsWgtP(k) * u(mAbsDofs[k], 1); }
+    for (PetscInt i = 0; i < mInjAbs.size(); i++) {
+      const PetscInt k = mInjAbs[i];
+      rval(mAbsDofs[k], 0) += mInjWgt(i) * Injection::Traction(mInjRows[i])[0] +
+          mAbsWgtP(k) * Injection::Velocity(mInjRows[i])[0];
+    }
+    return rval;
+  }
+
+  for (PetscInt k = 0; k < mAbsDofs.size(); k++) {
+    const PetscInt d = mAbsDofs[k];
+    PetscReal vn = 0;
+    for (PetscInt c = 0; c < num_fields; c++) { vn += mAbsNormals(k, c) * u(d, num_fields + c); }
+    for (PetscInt c = 0; c < num_fields; c++) {
+      const PetscReal v_normal = vn * mAbsNormals(k, c);
+      rval(d, c) -= mAbsWgtP(k) * v_normal + mAbsWgtS(k) * (u(d, num_fields + c) - v_normal);
+    }
+  }
+
+  /* The incident traction, and the impedance times the incident velocity, which the absorbing term above
+   * takes off again, so that only the scattered waves are absorbed. */
+  for (PetscInt i = 0; i < mInjAbs.size(); i++) {
+    const PetscInt k = mInjAbs[i], d = mAbsDofs[k];
+    const PetscReal *v = Injection::Velocity(mInjRows[i]), *t = Injection::Traction(mInjRows[i]);
+    PetscReal vn = 0;
+    for (PetscInt c = 0; c < num_fields; c++) { vn += mAbsNormals(k, c) * v[c]; }
+    for (PetscInt c = 0; c < num_fields; c++) {
+      const PetscReal v_normal = vn * mAbsNormals(k, c);
+      rval(d, c) += mInjWgt(i) * t[c] + mAbsWgtP(k) * v_normal + mAbsWgtS(k) * (v[c] - v_normal);
+    }
+  }
+  return rval;
+
+}
+
+#include <Physics/Scalar.h>
+#include <Physics/Elastic2D.h>
+#include <Physics/Elastic3D.h>
+#include <Physics/Attenuating.h>
+#include <Element/HyperCube/TensorQuad.h>
+#include <Element/HyperCube/QuadP1.h>
+#include <Element/HyperCube/Hexahedra.h>
+#include <Element/HyperCube/HexP1.h>
+template class Absorbing<Scalar<TensorQuad<QuadP1>>>;
+template class Absorbing<Elastic2D<TensorQuad<QuadP1>>>;
+template class Absorbing<Scalar<Hexahedra<HexP1>>>;
+template class Absorbing<Elastic3D<Hexahedra<HexP1>>>;
+template class Absorbing<Attenuating<Scalar<TensorQuad<QuadP1>>>>;
+template class Absorbing<Attenuating<Scalar<Hexahedra<HexP1>>>>;
+template class Absorbing<Attenuating<Elastic3D<Hexahedra<HexP1>>>>;
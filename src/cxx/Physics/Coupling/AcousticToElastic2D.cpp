@@ -1,6 +1,7 @@
 #include <Model/ExodusModel.h>
 #include <Physics/AcousticElastic2D.h>
 #include <Utilities/Options.h>
+#include <Utilities/Scratch.h>
 #include <Mesh/Mesh.h>
 
 using namespace Eigen;
@@ -10,8 +11,9 @@ AcousticToElastic2D<BasePhysics>::AcousticToElastic2D(std::unique_ptr<Options> c
 }
 
 template <typename BasePhysics>
-std::vector<std::string> AcousticToElastic2D<BasePhysics>::PullElementalFields() const {
-  return {"ux", "uy", "v"};
+const std::vector<FieldId> &AcousticToElastic2D<BasePhysics>::PullElementalFields() const {
+  static const std::vector<FieldId> pull {FieldId::ux, FieldId::uy, FieldId::v};
+  return pull;
 }
 
 template <typename BasePhysics>
@@ -24,7 +26,8 @@ void AcousticToElastic2D<BasePhysics>::setBoundaryConditions(std::unique_ptr<Mes
   }
   for (auto e: mEdg) {
     mNbr.push_back(mesh->GetNeighbouringElement(e, BasePhysics::ElmNum()));
-    mNbrCtr.push_back(mesh->getElementCoordinateClosure(mNbr.back()).colwise().mean());
+    mNbrCtr.push_back(mesh->ElementCenters().row(mNbr.back()).transpose());
+    mNbrModElm.push_back(mesh->ModelElement(mNbr.back()));
   }
   BasePhysics::setBoundaryConditions(mesh);
 }
@@ -32,10 +35,12 @@ void AcousticToElastic2D<BasePhysics>::setBoundaryConditions(std::unique_ptr<Mes
 template <typename BasePhysics>
 void AcousticToElastic2D<BasePhysics>::attachMaterialProperties(std::unique_ptr<ExodusModel> const &model) {
 
-  for (auto ctr: mNbrCtr) {
+  mRho_0.clear();
+  for (PetscInt n = 0; n < mNbrCtr.size(); n++) {
     double rho_0 = 0;
     for (int i = 0; i < BasePhysics::NumVtx(); i++) {
-      rho_0 += model->getElementalMaterialParameterAtVertex(ctr, "RHO", i);
+      rho_0 += mNbrModElm[n] >= 0 ? model->getElementalMaterialParameterAtVertex(mNbrModElm[n], "RHO", i) :
+                                    model->getElementalMaterialParameterAtVertex(mNbrCtr[n], "RHO", i);
     }
     mRho_0.push_back(rho_0 / BasePhysics::NumVtx());
   }
@@ -43,19 +48,28 @@ void AcousticToElastic2D<BasePhysics>::attachMaterialProperties(std::unique_ptr<
   // call parent.
   BasePhysics::attachMaterialProperties(model);
 
+  /* Precompute the edge integrals, with the density of the neighbour. */
+  mCpl.clear();
+  for (PetscInt i = 0; i < mEdg.size(); i++) {
+    const PetscInt e = mEdg[i];
+    mCpl.addFace(BasePhysics::NumIntPnt(),
+                 [this, e](const VectorXd &f) -> VectorXd { return this->applyTestAndIntegrateEdge(f, e); },
+                 BasePhysics::getEdgeNormal(e), mRho_0[i]);
+  }
+
 }
 
 template <typename BasePhysics>
-Eigen::MatrixXd AcousticToElastic2D<BasePhysics>::computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd> &u) {
+Eigen::Map<Eigen::MatrixXd> AcousticToElastic2D<BasePhysics>::computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd> &u) {
 
   // col0->ux, col1->uy, col2->potential.
-  Eigen::MatrixXd rval = Eigen::MatrixXd::Zero(BasePhysics::NumIntPnt(), 2);
-  for (int i = 0; i < mEdg.size(); i++) {
-    rval.col(0) += mRho_0[i] * BasePhysics::applyTestAndIntegrateEdge(u.col(2), mEdg[i]);
-    rval.col(1) += mRho_0[i] * BasePhysics::applyTestAndIntegrateEdge(u.col(2), mEdg[i]);
-  }
+  Eigen::Map<Eigen::MatrixXd> rval = Scratch::Matrix(Scratch::PhysicsSurface, BasePhysics::NumIntPnt(), 2);
+  rval.setZero();
+  mCpl.apply(u.col(2), rval.col(0));
+  rval.col(0) *= -1;
+  rval.col(1) = rval.col(0);
 
-  return -1 * rval;
+  return rval;
 
 }
 
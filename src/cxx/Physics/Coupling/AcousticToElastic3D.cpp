@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <Model/ExodusModel.h>
+#include <Physics/AcousticElastic3D.h>
+#include <Utilities/Options.h>
+#include <Utilities/Scratch.h>
+#include <Mesh/Mesh.h>
+
+using namespace Eigen;
+
+template <typename BasePhysics>
+AcousticToElastic3D<BasePhysics>::AcousticToElastic3D(std::unique_ptr<Options> const &options): BasePhysics(options) {
+}
+
+template <typename BasePhysics>
+const std::vector<FieldId> &AcousticToElastic3D<BasePhysics>::PullElementalFields() const {
+  static const std::vector<FieldId> pull {FieldId::ux, FieldId::uy, FieldId::uz, FieldId::v};
+  return pull;
+}
+
+template <typename BasePhysics>
+void AcousticToElastic3D<BasePhysics>::setBoundaryConditions(std::unique_ptr<Mesh> const &mesh) {
+
+  /* The coupled faces by their index in the cone, which is the face number of the shape. */
+  const std::vector<PetscInt> faces = mesh->EdgeNumbers(BasePhysics::ElmNum());
+  mFace.clear(); mNbr.clear(); mNbrCtr.clear(); mNbrModElm.clear();
+  for (auto tup: mesh->CouplingFields(BasePhysics::ElmNum())) {
+    const std::vector<std::string> &fields = std::get<1>(tup);
+    if (std::find(fields.begin(), fields.end(), "fluid") == fields.end()) { continue; }
+    mFace.push_back(std::find(faces.begin(), faces.end(), std::get<0>(tup)) - faces.begin());
+    mNbr.push_back(mesh->GetNeighbouringElement(std::get<0>(tup), BasePhysics::ElmNum()));
+    mNbrCtr.push_back(mesh->ElementCenters().row(mNbr.back()).transpose());
+    mNbrModElm.push_back(mesh->ModelElement(mNbr.back()));
+  }
+  BasePhysics::setBoundaryConditions(mesh);
+
+}
+
+template <typename BasePhysics>
+void AcousticToElastic3D<BasePhysics>::attachMaterialProperties(std::unique_ptr<ExodusModel> const &model) {
+
+  mRho_0.clear();
+  for (PetscInt n = 0; n < mNbrCtr.size(); n++) {
+    double rho_0 = 0;
+    for (int i = 0; i < BasePhysics::NumVtx(); i++) {
+      rho_0 += mNbrModElm[n] >= 0 ? model->getElementalMaterialParameterAtVertex(mNbrModElm[n], "RHO", i) :
+                                    model->getElementalMaterialParameterAtVertex(mNbrCtr[n], "RHO", i);
+    }
+    mRho_0.push_back(rho_0 / BasePhysics::NumVtx());
+  }
+
+  // call parent.
+  BasePhysics::attachMaterialProperties(model);
+
+  /* Precompute the face integrals, with the outward normals and the density of the neighbour. */
+  mCpl.clear();
+  for (PetscInt i = 0; i < mFace.size(); i++) {
+    const PetscInt f = mFace[i];
+    mCpl.addFace(BasePhysics::NumIntPnt(),
+                 [this, f](const VectorXd &g) -> VectorXd { return this->applyTestAndIntegrateEdge(g, f); },
+                 BasePhysics::getFaceNormal(f), mRho_0[i]);
+  }
+
+}
+
+template <typename BasePhysics>
+Eigen::Map<Eigen::MatrixXd> AcousticToElastic3D<BasePhysics>::computeSurfaceIntegral(
+    const Eigen::Ref<const Eigen::MatrixXd> &u) {
+
+  // col0->ux, col1->uy, col2->uz, col3->potential.
+  Eigen::Map<Eigen::MatrixXd> rval = Scratch::Matrix(Scratch::PhysicsSurface, BasePhysics::NumIntPnt(), 3);
+  rval.setZero();
+  mCpl.applyAlongNormal(u.col(3), rval);
+  rval *= -1;
+
+  return rval;
+
+}
+
+#include <Physics/Elastic3D.h>
+#include <Element/HyperCube/Hexahedra.h>
+#include <Element/HyperCube/HexP1.h>
+template class AcousticToElastic3D<Elastic3D<Hexahedra<HexP1>>>;
@@ -1,6 +1,7 @@
 #include <Model/ExodusModel.h>
 #include <Mesh/Mesh.h>
 #include <Utilities/Options.h>
+#include <Utilities/Scratch.h>
 #include <Physics/ElasticAcoustic2D.h>
 
 using namespace Eigen;
@@ -9,8 +10,9 @@ template <typename BasePhysics>
 ElasticToAcoustic2D<BasePhysics>::ElasticToAcoustic2D(std::unique_ptr<Options> const &options): BasePhysics(options) { }
 
 template <typename BasePhysics>
-std::vector<std::string> ElasticToAcoustic2D<BasePhysics>::PullElementalFields() const {
-  return {"u", "vx", "vy"};
+const std::vector<FieldId> &ElasticToAcoustic2D<BasePhysics>::PullElementalFields() const {
+  static const std::vector<FieldId> pull {FieldId::u, FieldId::vx, FieldId::vy};
+  return pull;
 }
 
 template <typename BasePhysics>
@@ -18,23 +20,26 @@ void ElasticToAcoustic2D<BasePhysics>::setBoundaryConditions(std::unique_ptr<Mes
   for (auto e: mesh->CouplingFields(BasePhysics::ElmNum())) {
     mEdg.push_back(std::get<0>(e));
     mNbr.push_back(mesh->GetNeighbouringElement(mEdg.back(), BasePhysics::ElmNum()));
-    mNbrCtr.push_back(mesh->getElementCoordinateClosure(mNbr.back()).colwise().mean());
+    mNbrCtr.push_back(mesh->ElementCenters().row(mNbr.back()).transpose());
   }
   BasePhysics::setBoundaryConditions(mesh);
+
+  /* Precompute the edge integrals (the vertices are attached by now). */
+  mCpl.clear();
+  for (auto e: mEdg) {
+    mCpl.addFace(BasePhysics::NumIntPnt(),
+                 [this, e](const VectorXd &f) -> VectorXd { return this->applyTestAndIntegrateEdge(f, e); },
+                 BasePhysics::getEdgeNormal(e));
+  }
 }
 
 template <typename BasePhysics>
-MatrixXd ElasticToAcoustic2D<BasePhysics>::computeSurfaceIntegral(const Ref<const MatrixXd> &u) {
+Eigen::Map<MatrixXd> ElasticToAcoustic2D<BasePhysics>::computeSurfaceIntegral(const Ref<const MatrixXd> &u) {
 
   // col0->potential, col1->ux, col2->uy.
-  MatrixXd rval = Eigen::MatrixXd::Zero(BasePhysics::NumIntPnt(), 1);
-
-  Vector2d n;
-  for (auto e: mEdg) {
-    n = BasePhysics::getEdgeNormal(e);
-    VectorXd transform = u.rightCols(2) * n;
-    rval += BasePhysics::applyTestAndIntegrateEdge(transform, e);
-  }
+  Eigen::Map<MatrixXd> rval = Scratch::Matrix(Scratch::PhysicsSurface, BasePhysics::NumIntPnt(), 1);
+  rval.setZero();
+  mCpl.applyNormal(u.rightCols(2), rval.col(0));
 
   return rval;
 
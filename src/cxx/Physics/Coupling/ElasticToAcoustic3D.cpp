@@ -0,0 +1,59 @@
+#include <algorithm>
+#include <Model/ExodusModel.h>
+#include <Mesh/Mesh.h>
+#include <Utilities/Options.h>
+#include <Utilities/Scratch.h>
+#include <Physics/ElasticAcoustic3D.h>
+
+using namespace Eigen;
+
+template <typename BasePhysics>
+ElasticToAcoustic3D<BasePhysics>::ElasticToAcoustic3D(std::unique_ptr<Options> const &options): BasePhysics(options) { }
+
+template <typename BasePhysics>
+const std::vector<FieldId> &ElasticToAcoustic3D<BasePhysics>::PullElementalFields() const {
+  static const std::vector<FieldId> pull {FieldId::u, FieldId::vx, FieldId::vy, FieldId::vz};
+  return pull;
+}
+
+template <typename BasePhysics>
+void ElasticToAcoustic3D<BasePhysics>::setBoundaryConditions(std::unique_ptr<Mesh> const &mesh) {
+
+  /* The coupled faces by their index in the cone, which is the face number of the shape. */
+  const std::vector<PetscInt> faces = mesh->EdgeNumbers(BasePhysics::ElmNum());
+  mFace.clear(); mNbr.clear(); mNbrCtr.clear();
+  for (auto tup: mesh->CouplingFields(BasePhysics::ElmNum())) {
+    const std::vector<std::string> &fields = std::get<1>(tup);
+    if (std::find(fields.begin(), fields.end(), "3delastic") == fields.end()) { continue; }
+    mFace.push_back(std::find(faces.begin(), faces.end(), std::get<0>(tup)) - faces.begin());
+    mNbr.push_back(mesh->GetNeighbouringElement(std::get<0>(tup), BasePhysics::ElmNum()));
+    mNbrCtr.push_back(mesh->ElementCenters().row(mNbr.back()).transpose());
+  }
+  BasePhysics::setBoundaryConditions(mesh);
+
+  /* Precompute the face integrals (the vertices are attached by now). */
+  mCpl.clear();
+  for (auto f: mFace) {
+    mCpl.addFace(BasePhysics::NumIntPnt(),
+                 [this, f](const VectorXd &g) -> VectorXd { return this->applyTestAndIntegrateEdge(g, f); },
+                 BasePhysics::getFaceNormal(f));
+  }
+
+}
+
+template <typename BasePhysics>
+Eigen::Map<MatrixXd> ElasticToAcoustic3D<BasePhysics>::computeSurfaceIntegral(const Ref<const MatrixXd> &u) {
+
+  // col0->potential, col1->vx, col2->vy, col3->vz.
+  Eigen::Map<MatrixXd> rval = Scratch::Matrix(Scratch::PhysicsSurface, BasePhysics::NumIntPnt(), 1);
+  rval.setZero();
+  mCpl.applyNormal(u.rightCols(3), rval.col(0));
+
+  return rval;
+
+}
+
+#include <Physics/Scalar.h>
+#include <Element/HyperCube/Hexahedra.h>
+#include <Element/HyperCube/HexP1.h>
+template class ElasticToAcoustic3D<Scalar<Hexahedra<HexP1>>>;
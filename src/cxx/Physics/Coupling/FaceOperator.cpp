@@ -0,0 +1,69 @@
+#include <Physics/FaceOperator.h>
+#include <Utilities/Scratch.h>
+
+using namespace Eigen;
+
+void FaceOperator::clear() {
+  mDofs.clear(); mOps.clear(); mNormals.clear(); mScales.clear();
+}
+
+void FaceOperator::addFace(const PetscInt num_pnt, const Integral &integral, const VectorXd &normal,
+                           const PetscReal scale) {
+
+  /* The dofs of the face are those with a weight. */
+  VectorXd wgt = integral(VectorXd::Ones(num_pnt));
+  std::vector<PetscInt> dofs;
+  for (PetscInt i = 0; i < num_pnt; i++) { if (wgt(i) != 0) { dofs.push_back(i); } }
+
+  /* One column per face dof. */
+  MatrixXd op(dofs.size(), dofs.size());
+  VectorXd unit = VectorXd::Zero(num_pnt);
+  for (PetscInt j = 0; j < dofs.size(); j++) {
+    unit(dofs[j]) = 1;
+    VectorXd col = integral(unit);
+    for (PetscInt i = 0; i < dofs.size(); i++) { op(i, j) = col(dofs[i]); }
+    unit(dofs[j]) = 0;
+  }
+
+  mDofs.push_back(dofs);
+  mOps.push_back(op);
+  mNormals.push_back(normal);
+  mScales.push_back(scale);
+
+}
+
+/* The face values and their integrals are gathered into the scratch arena, so that applying allocates nothing. */
+void FaceOperator::apply(const Ref<const VectorXd> &f, Ref<VectorXd> out) const {
+  for (PetscInt k = 0; k < mDofs.size(); k++) {
+    const std::vector<PetscInt> &dofs = mDofs[k];
+    auto work = Scratch::Matrix(Scratch::FaceTemp, dofs.size(), 2);
+    auto g = work.col(0), h = work.col(1);
+    for (PetscInt i = 0; i < dofs.size(); i++) { g(i) = f(dofs[i]); }
+    h.noalias() = mOps[k] * g;
+    for (PetscInt i = 0; i < dofs.size(); i++) { out(dofs[i]) += mScales[k] * h(i); }
+  }
+}
+
+void FaceOperator::applyNormal(const Ref<const MatrixXd> &u, Ref<VectorXd> out) const {
+  for (PetscInt k = 0; k < mDofs.size(); k++) {
+    const std::vector<PetscInt> &dofs = mDofs[k];
+    auto work = Scratch::Matrix(Scratch::FaceTemp, dofs.size(), 2);
+    auto g = work.col(0), h = work.col(1);
+    for (PetscInt i = 0; i < dofs.size(); i++) { g(i) = u.row(dofs[i]).dot(mNormals[k]); }
+    h.noalias() = mOps[k] * g;
+    for (PetscInt i = 0; i < dofs.size(); i++) { out(dofs[i]) += mScales[k] * h(i); }
+  }
+}
+
+void FaceOperator::applyAlongNormal(const Ref<const VectorXd> &f, Ref<MatrixXd> out) const {
+  for (PetscInt k = 0; k < mDofs.size(); k++) {
+    const std::vector<PetscInt> &dofs = mDofs[k];
+    auto work = Scratch::Matrix(Scratch::FaceTemp, dofs.size(), 2);
+    auto g = work.col(0), h = work.col(1);
+    for (PetscInt i = 0; i < dofs.size(); i++) { g(i) = f(dofs[i]); }
+    h.noalias() = mOps[k] * g;
+    for (PetscInt d = 0; d < mNormals[k].size(); d++) {
+      for (PetscInt i = 0; i < dofs.size(); i++) { out(dofs[i], d) += mScales[k] * mNormals[k](d) * h(i); }
+    }
+  }
+}
@@ -0,0 +1,204 @@
+#include <Model/ExodusModel.h>
+#include <Physics/Attenuating.h>
+#include <Utilities/Options.h>
+#include <Utilities/Types.h>
+#include <Utilities/Scratch.h>
+
+using namespace Eigen;
+
+template <typename BasePhysics>
+Attenuating<BasePhysics>::Attenuating(std::unique_ptr<Options> const &options): BasePhysics(options) {
+
+  if (!options->Attenuation()) {
+    throw std::runtime_error("Attenuating elements need --attenuation and --attenuation-band.");
+  }
+  mNumMech = 1 << BasePhysics::NumDim();
+  RelaxationMechanisms(options->AttenuationBand()[0], options->AttenuationBand()[1], mNumMech, mTau, mUnitWgt);
+  mDecay.setOnes(mNumMech);
+  mMaxStiffening = 1;
+
+}
+
+template <typename BasePhysics>
+void Attenuating<BasePhysics>::RelaxationMechanisms(const PetscReal f_min, const PetscReal f_max,
+                                                    const PetscInt num_mech, VectorXd &tau, VectorXd &wgt) {
+
+  /* Relaxation frequencies spread over the band, and 1/Q of each mechanism at frequencies across it. */
+  const PetscInt num_freq = 20 * num_mech;
+  tau.resize(num_mech);
+  for (PetscInt l = 0; l < num_mech; l++) {
+    const PetscReal f = num_mech > 1 ? f_min * std::pow(f_max / f_min, l / (num_mech - 1.0)) :
+                                       std::sqrt(f_min * f_max);
+    tau(l) = 1 / (2 * M_PI * f);
+  }
+  MatrixXd a(num_freq, num_mech);
+  for (PetscInt k = 0; k < num_freq; k++) {
+    const PetscReal w = 2 * M_PI * f_min * std::pow(f_max / f_min, k / (num_freq - 1.0));
+    for (PetscInt l = 0; l < num_mech; l++) { a(k, l) = w * tau(l) / (1 + w * w * tau(l) * tau(l)); }
+  }
+  const VectorXd b = VectorXd::Ones(num_freq);
+
+  /* Non-negative least squares (Lawson & Hanson), as negative weights would amplify at their points. */
+  const PetscReal tol = 1e-12;
+  wgt.setZero(num_mech);
+  std::vector<bool> active(num_mech, false);
+  VectorXd grad = a.transpose() * (b - a * wgt);
+  for (PetscInt it = 0; it < 3 * num_mech; it++) {
+    PetscInt best = -1;
+    for (PetscInt l = 0; l < num_mech; l++) {
+      if (!active[l] && grad(l) > tol && (best < 0 || grad(l) > grad(best))) { best = l; }
+    }
+    if (best < 0) { break; }
+    active[best] = true;
+    while (true) {
+      /* Least squares on the active mechanisms. */
+      std::vector<PetscInt> idx;
+      for (PetscInt l = 0; l < num_mech; l++) { if (active[l]) { idx.push_back(l); } }
+      MatrixXd a_act(num_freq, idx.size());
+      for (PetscInt j = 0; j < idx.size(); j++) { a_act.col(j) = a.col(idx[j]); }
+      VectorXd z_act = a_act.colPivHouseholderQr().solve(b);
+      VectorXd z = VectorXd::Zero(num_mech);
+      for (PetscInt j = 0; j < idx.size(); j++) { z(idx[j]) = z_act(j); }
+      if (z_act.minCoeff() > 0) { wgt = z; break; }
+      /* Step towards it, until the first weight reaches zero, and drop that mechanism. */
+      PetscReal alpha = 1;
+      for (auto l: idx) { if (z(l) <= 0) { alpha = std::min(alpha, wgt(l) / (wgt(l) - z(l))); } }
+      wgt += alpha * (z - wgt);
+      for (auto l: idx) { if (wgt(l) <= tol) { active[l] = false; wgt(l) = 0; } }
+    }
+    grad = a.transpose() * (b - a * wgt);
+  }
+
+}
+
+template <typename BasePhysics>
+void Attenuating<BasePhysics>::attachMaterialProperties(std::unique_ptr<ExodusModel> const &model) {
+
+  BasePhysics::attachMaterialProperties(model);
+  const PetscInt num_pnt = BasePhysics::NumIntPnt(), num_dim = BasePhysics::NumDim();
+  const bool scalar = BasePhysics::PullElementalFields().size() == 1;
+
+  /* Moduli at the reference frequency (the scalar equation has unit density). */
+  BasePhysics::attachMaterialProperties(model, "QKAPPA");
+  ArrayXd kappa, mu, q_kappa = BasePhysics::ParAtIntPts("QKAPPA").array(), q_mu;
+  if (scalar) {
+    kappa = BasePhysics::ParAtIntPts("VP").array().square();
+    mu.setZero(num_pnt); q_mu.setOnes(num_pnt);
+  } else {
+    const PetscReal tol = 1e-12;
+    if (!BasePhysics::ParAtIntPts("VPV").isApprox(BasePhysics::ParAtIntPts("VPH"), tol) ||
+        !BasePhysics::ParAtIntPts("VSV").isApprox(BasePhysics::ParAtIntPts("VSH"), tol) ||
+        !BasePhysics::ParAtIntPts("ETA").isApprox(RealVec::Ones(num_pnt), tol)) {
+      throw std::runtime_error("Attenuation is only supported for isotropic elements (element " +
+                               std::to_string(BasePhysics::ElmNum()) + ").");
+    }
+    BasePhysics::attachMaterialProperties(model, "QMU");
+    const ArrayXd rho = BasePhysics::ParAtIntPts("RHO").array();
+    mu = rho * BasePhysics::ParAtIntPts("VSV").array().square();
+    kappa = rho * BasePhysics::ParAtIntPts("VPV").array().square() - 4.0 / 3.0 * mu;
+    q_mu = BasePhysics::ParAtIntPts("QMU").array();
+  }
+  if (q_kappa.minCoeff() <= 0 || q_mu.minCoeff() <= 0) {
+    throw std::runtime_error("Quality factors must be positive (element " + std::to_string(BasePhysics::ElmNum()) +
+                             ").");
+  }
+
+  /* Unrelaxed moduli, from the relaxation of all mechanisms at the center of the band. */
+  const PetscReal w_ref = 1 / std::sqrt(mTau(0) * mTau(mNumMech - 1));
+  PetscReal relax = 0;
+  for (PetscInt l = 0; l < mNumMech; l++) { relax += mUnitWgt(l) / (1 + w_ref * w_ref * mTau(l) * mTau(l)); }
+  if (relax >= q_kappa.minCoeff() || relax >= q_mu.minCoeff()) {
+    throw std::runtime_error("Quality factors below " + std::to_string(relax) + " can not be modelled over "
+                             "--attenuation-band (element " + std::to_string(BasePhysics::ElmNum()) + ").");
+  }
+  const ArrayXd stiff_kappa = 1 / (1 - relax / q_kappa), stiff_mu = 1 / (1 - relax / q_mu);
+  mKappa = kappa * stiff_kappa; mMu = mu * stiff_mu;
+  mMaxStiffening = std::max(stiff_kappa.maxCoeff(), scalar ? 1.0 : stiff_mu.maxCoeff());
+
+  /* Mechanisms take turns in a 2 x 2 (x 2) pattern over the tensor basis, with num_mech times their weight. */
+  const PetscInt n = BasePhysics::PlyOrd() + 1;
+  mMech.resize(num_pnt); mWgtKappa.resize(num_pnt); mWgtMu.resize(num_pnt);
+  for (PetscInt p = 0; p < num_pnt; p++) {
+    mMech[p] = (p % n) % 2 + 2 * ((p / n) % n % 2) + (num_dim == 3 ? 4 * ((p / (n * n)) % 2) : 0);
+    mWgtKappa(p) = mNumMech * mUnitWgt(mMech[p]) / q_kappa(p);
+    mWgtMu(p) = mNumMech * mUnitWgt(mMech[p]) / q_mu(p);
+  }
+  if (scalar) { mMu.resize(0); mWgtMu.resize(0); }
+  mMem.setZero(num_pnt, scalar ? num_dim : 7);
+
+}
+
+template <typename BasePhysics>
+void Attenuating<BasePhysics>::SetTimeStep(const PetscReal dt) {
+  for (PetscInt l = 0; l < mNumMech; l++) { mDecay(l) = std::exp(-dt / mTau(l)); }
+  BasePhysics::SetTimeStep(dt);
+}
+
+template <typename BasePhysics>
+double Attenuating<BasePhysics>::CFL_estimate() {
+  return BasePhysics::CFL_estimate() / std::sqrt(mMaxStiffening);
+}
+
+template <typename BasePhysics>
+Eigen::Map<MatrixXd> Attenuating<BasePhysics>::computeStiffnessTerm(const Ref<const MatrixXd> &u) {
+
+  const PetscInt num_pnt = BasePhysics::NumIntPnt(), num_dim = BasePhysics::NumDim();
+  const PetscInt num_fields = BasePhysics::PullElementalFields().size();
+  Eigen::Map<MatrixXd> stiff = Scratch::Matrix(Scratch::PhysicsStiff, num_pnt, num_fields);
+
+  /* Scalar: stress kappa_u (grad u - zeta). */
+  if (num_fields == 1) {
+    Eigen::Map<MatrixXd> grad = BasePhysics::computeGradient(u.col(0));
+    Eigen::Map<MatrixXd> stress = Scratch::Matrix(Scratch::PhysicsStress, num_pnt, num_dim);
+    for (PetscInt p = 0; p < num_pnt; p++) {
+      const PetscReal a = mDecay(mMech[p]), b = (1 - a) * mWgtKappa(p);
+      for (PetscInt d = 0; d < num_dim; d++) {
+        stress(p, d) = mKappa(p) * (grad(p, d) - mMem(p, d));
+        mMem(p, d) = a * mMem(p, d) + b * grad(p, d);
+      }
+    }
+    stiff.col(0) = BasePhysics::applyGradTestAndIntegrate(stress);
+    return stiff;
+  }
+
+  /* Elastic: the gradient of each component, one after the other (du_i/dx_j in column 3 i + j). */
+  Eigen::Map<MatrixXd> grad = Scratch::Matrix(Scratch::PhysicsStrain, num_pnt, 9);
+  for (PetscInt i = 0; i < 3; i++) { grad.middleCols(3 * i, 3) = BasePhysics::computeGradient(u.col(i)); }
+
+  /* Stress kappa_u (tr eps - zeta_0) I + 2 mu_u (dev eps - zeta_dev), by rows (as the gradient). */
+  Eigen::Map<MatrixXd> stress = Scratch::Matrix(Scratch::PhysicsStress, num_pnt, 9);
+  const PetscInt voigt[3][3] = {{0, 5, 4}, {5, 1, 3}, {4, 3, 2}};
+  for (PetscInt p = 0; p < num_pnt; p++) {
+    const PetscReal a = mDecay(mMech[p]), b_kappa = (1 - a) * mWgtKappa(p), b_mu = (1 - a) * mWgtMu(p);
+    const PetscReal tr = grad(p, 0) + grad(p, 4) + grad(p, 8);
+    PetscReal dev[6] = {grad(p, 0) - tr / 3, grad(p, 4) - tr / 3, grad(p, 8) - tr / 3,
+                        0.5 * (grad(p, 5) + grad(p, 7)), 0.5 * (grad(p, 2) + grad(p, 6)),
+                        0.5 * (grad(p, 1) + grad(p, 3))};
+    const PetscReal pressure = mKappa(p) * (tr - mMem(p, 0));
+    mMem(p, 0) = a * mMem(p, 0) + b_kappa * tr;
+    PetscReal sig[6];
+    for (PetscInt k = 0; k < 6; k++) {
+      sig[k] = 2 * mMu(p) * (dev[k] - mMem(p, 1 + k)) + (k < 3 ? pressure : 0);
+      mMem(p, 1 + k) = a * mMem(p, 1 + k) + b_mu * dev[k];
+    }
+    for (PetscInt i = 0; i < 3; i++) {
+      for (PetscInt j = 0; j < 3; j++) { stress(p, 3 * i + j) = sig[voigt[i][j]]; }
+    }
+  }
+
+  for (PetscInt i = 0; i < 3; i++) {
+    stiff.col(i) = BasePhysics::applyGradTestAndIntegrate(stress.middleCols(3 * i, 3));
+  }
+  return stiff;
+
+}
+
+#include <Physics/Scalar.h>
+#include <Physics/Elastic3D.h>
+#include <Element/HyperCube/TensorQuad.h>
+#include <Element/HyperCube/QuadP1.h>
+#include <Element/HyperCube/Hexahedra.h>
+#include <Element/HyperCube/HexP1.h>
+template class Attenuating<Scalar<TensorQuad<QuadP1>>>;
+template class Attenuating<Scalar<Hexahedra<HexP1>>>;
+template class Attenuating<Elastic3D<Hexahedra<HexP1>>>;
@@ -3,25 +3,22 @@
 #include <Model/ExodusModel.h>
 #include <Physics/Elastic2D.h>
 #include <Source/Source.h>
+#include <Receiver/Receiver.h>
 #include <Utilities/Types.h>
+#include <Utilities/Scratch.h>
 
 using namespace Eigen;
 
 template <typename Element>
 Elastic2D<Element>::Elastic2D(std::unique_ptr<Options> const &options): Element(options) {
 
-  int num_grad_cmps = 3;
-
-  // Allocate all work arrays.
+  // Allocate the stiffness (work arrays are borrowed from the scratch arena in the time loop).
   mc11.setZero(Element::NumIntPnt());
   mc12.setZero(Element::NumIntPnt());
   mc13.setZero(Element::NumIntPnt());
   mc22.setZero(Element::NumIntPnt());
   mc23.setZero(Element::NumIntPnt());
   mc33.setZero(Element::NumIntPnt());
-  mStiff.setZero(Element::NumIntPnt(), Element::NumDim());
-  mStress.setZero(Element::NumIntPnt(), num_grad_cmps);
-  mStrain.setZero(Element::NumIntPnt(), num_grad_cmps+1);
 
 }
 
@@ -34,13 +31,35 @@ void Elastic2D<Element>::attachMaterialProperties(std::unique_ptr<ExodusModel> c
   Element::attachMaterialProperties(model, "C33");
 //  Element::attachMaterialProperties(model, "C23");
   Element::attachMaterialProperties(model, "C55");
+
+  /* Interpolate the stiffness once, as it does not change during a run. */
+  /* TODO: PROPER CONVETION!!!! */
+  /* mc13 & mc23 are currently zero */
+  mc11 = Element::ParAtIntPts("C11");
+  mc12 = Element::ParAtIntPts("C13");
+  mc22 = Element::ParAtIntPts("C33");
+  mc33 = Element::ParAtIntPts("C55");
 }
 
 template <typename Element>
-std::vector<std::string> Elastic2D<Element>::PullElementalFields() const { return { "ux", "uy"}; }
+double Elastic2D<Element>::CFL_estimate() {
+  // fastest (p) wave speed over both axes.
+  RealVec c = mc11.cwiseMax(mc22);
+  double vp_max = (c.array() / Element::ParAtIntPts("RHO").array()).sqrt().maxCoeff();
+  return Element::CFL_constant() * Element::estimatedElementRadius() / vp_max;
+}
 
 template <typename Element>
-std::vector<std::string> Elastic2D<Element>::PushElementalFields() const { return { "ax", "ay"}; }
+const std::vector<FieldId> &Elastic2D<Element>::PullElementalFields() const {
+  static const std::vector<FieldId> pull {FieldId::ux, FieldId::uy};
+  return pull;
+}
+
+template <typename Element>
+const std::vector<FieldId> &Elastic2D<Element>::PushElementalFields() const {
+  static const std::vector<FieldId> push {FieldId::ax, FieldId::ay};
+  return push;
+}
 
 template <typename Element>
 MatrixXd Elastic2D<Element>::assembleElementMassMatrix() {
@@ -50,17 +69,10 @@ MatrixXd Elastic2D<Element>::assembleElementMassMatrix() {
 }
 
 template <typename Element>
-MatrixXd Elastic2D<Element>::computeStress(const Eigen::Ref<const Eigen::MatrixXd> &strain) {
+Eigen::Map<MatrixXd> Elastic2D<Element>::computeStress(const Eigen::Ref<const Eigen::MatrixXd> &strain) {
 
-  /* TODO: PROPER CONVETION!!!! */
-  /* mc13 & mc23 are currently zero */
-  mc11 = Element::ParAtIntPts("C11");
-  mc12 = Element::ParAtIntPts("C13");
-  mc22 = Element::ParAtIntPts("C33");
-  mc33 = Element::ParAtIntPts("C55");
-
-  Matrix<double,Dynamic,3> stress(Element::NumIntPnt(), 3);
-  VectorXd uxy_plus_uyx = strain.col(1) + strain.col(2);
+  Eigen::Map<MatrixXd> stress = Scratch::Matrix(Scratch::PhysicsStress, Element::NumIntPnt(), 3);
+  const auto uxy_plus_uyx = strain.col(1) + strain.col(2);
 
   stress.col(0) =
     mc11.array().cwiseProduct(strain.col(0).array()) +
@@ -82,47 +94,180 @@ MatrixXd Elastic2D<Element>::computeStress(const Eigen::Ref<const Eigen::MatrixX
 }
 
 template <typename Element>
-MatrixXd Elastic2D<Element>::computeStiffnessTerm(const Eigen::MatrixXd &u) {
+Eigen::Map<MatrixXd> Elastic2D<Element>::computeStiffnessTerm(const Eigen::Ref<const Eigen::MatrixXd> &u) {
 
   // strain ux_x, ux_y, uy_x, uy_y.
+  Eigen::Map<MatrixXd> strain = Scratch::Matrix(Scratch::PhysicsStrain, Element::NumIntPnt(), 4);
   EIGEN_ASM_COMMENT("BEGIN_GRADIENT");
-  mStrain.leftCols<2>()  = Element::computeGradient(u.col(0));
+  strain.leftCols<2>()  = Element::computeGradient(u.col(0));
   EIGEN_ASM_COMMENT("END_GRADIENT");
-  mStrain.rightCols<2>() = Element::computeGradient(u.col(1));
+  strain.rightCols<2>() = Element::computeGradient(u.col(1));
 
   // compute stress from strain.
-  mStress = computeStress(mStrain);
+  Eigen::Map<MatrixXd> stress = computeStress(strain);
 
-  // temporary matrix to hold directional stresses.
-  Matrix<double,Dynamic,2> temp_stress(Element::NumIntPnt(), 2);
+  // temporary matrix to hold directional stresses (and the hoop stress, if axisymmetric).
+  Eigen::Map<MatrixXd> temp_stress = Scratch::Matrix(Scratch::PhysicsTemp, Element::NumIntPnt(), 3);
+
+  /* The hoop strain u_r / r, which tends to du_r/dr on the axis, and the hoop stress. C_r_phi = C11 - 2 C55
+   * holds for a medium which is isotropic in the plane normal to the axis. */
+  const bool axisymmetric = Element::Axisymmetric();
+  if (axisymmetric) {
+    const RealVec &rad = Element::AxisRadius();
+    temp_stress.col(2) = (rad.array() > 0).select(u.col(0).array() / rad.array(), strain.col(0).array());
+    const ArrayXd c_rp = mc11.array() - 2 * mc33.array(), hoop = temp_stress.col(2).array();
+    temp_stress.col(2) = (c_rp * strain.col(0).array() + mc12.array() * strain.col(3).array() +
+                          mc11.array() * hoop).matrix();
+    stress.col(0).array() += c_rp * hoop;
+    stress.col(1).array() += mc12.array() * hoop;
+  }
 
   // compute stiffness.
-  temp_stress.col(0) = mStress.col(0); temp_stress.col(1) = mStress.col(2);
-  mStiff.col(0) = Element::applyGradTestAndIntegrate(temp_stress);
-  temp_stress.col(0) = mStress.col(2); temp_stress.col(1) = mStress.col(1);
-  mStiff.col(1) = Element::applyGradTestAndIntegrate(temp_stress);
+  Eigen::Map<MatrixXd> stiff = Scratch::Matrix(Scratch::PhysicsStiff, Element::NumIntPnt(), Element::NumDim());
+  temp_stress.col(0) = stress.col(0); temp_stress.col(1) = stress.col(2);
+  stiff.col(0) = Element::applyGradTestAndIntegrate(temp_stress.leftCols<2>());
+  if (axisymmetric) { stiff.col(0) += Element::applyTestOverRadiusAndIntegrate(temp_stress.col(2)); }
+  temp_stress.col(0) = stress.col(2); temp_stress.col(1) = stress.col(1);
+  stiff.col(1) = Element::applyGradTestAndIntegrate(temp_stress.leftCols<2>());
+
+  /* The radial displacement vanishes on the axis. */
+  if (axisymmetric) { stiff.col(0) = (Element::AxisRadius().array() > 0).select(stiff.col(0).array(), 0); }
 
-  return mStiff;
+  return stiff;
 
 }
 
 template <typename Element>
-MatrixXd Elastic2D<Element>::computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd> &u) {
-  return Eigen::MatrixXd::Zero(Element::NumIntPnt(), Element::NumDim());
+MatrixXd Elastic2D<Element>::computeKernels(const Eigen::Ref<const Eigen::MatrixXd> &u,
+                                            const Eigen::Ref<const Eigen::MatrixXd> &u_adj) {
+
+  // strain ux_x, ux_y, uy_x, uy_y of both fields.
+  MatrixXd strain(Element::NumIntPnt(), 4), strain_adj(Element::NumIntPnt(), 4);
+  strain.leftCols<2>() = Element::computeGradient(u.col(0));
+  strain.rightCols<2>() = Element::computeGradient(u.col(1));
+  strain_adj.leftCols<2>() = Element::computeGradient(u_adj.col(0));
+  strain_adj.rightCols<2>() = Element::computeGradient(u_adj.col(1));
+
+  // C11 (mc11), C13 (mc12), C33 (mc22) and C55 (mc33), as in computeStress.
+  const ArrayXd shear = (strain.col(1) + strain.col(2)).array();
+  const ArrayXd shear_adj = (strain_adj.col(1) + strain_adj.col(2)).array();
+  MatrixXd kernels(Element::NumIntPnt(), 4);
+  kernels.col(0) = mc11.array() * strain_adj.col(0).array() * strain.col(0).array();
+  kernels.col(1) = mc12.array() * (strain_adj.col(0).array() * strain.col(3).array() +
+                                   strain_adj.col(3).array() * strain.col(0).array());
+  kernels.col(2) = mc22.array() * strain_adj.col(3).array() * strain.col(3).array();
+  kernels.col(3) = mc33.array() * shear_adj * shear;
+  return kernels;
+
+}
+
+template <typename Element>
+Eigen::Map<MatrixXd> Elastic2D<Element>::computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd> &u) {
+  Eigen::Map<MatrixXd> rval = Scratch::Matrix(Scratch::PhysicsSurface, Element::NumIntPnt(), Element::NumDim());
+  rval.setZero();
+  return rval;
+}
+
+template <typename Element>
+bool Elastic2D<Element>::attachSource(std::unique_ptr<Source> &source, const bool finalize) {
+  bool found = Element::attachSource(source, finalize);
+  if (found && finalize) {
+    RealVec2 pnt (Element::Sources().back()->LocR(), Element::Sources().back()->LocS());
+    RealVec delta = Element::getDeltaFunctionCoefficients(pnt);
+    const PetscInt n = Element::NumIntPnt(), d = Element::NumDim(), col = mSrcMat.cols();
+    auto &src = Element::Sources().back();
+    if (src->IsMomentTensor()) {
+      /* -div(M delta), integrated by parts: row i of the (symmetric) moment tensor against the gradient of the
+       * test functions gives component i of the force. */
+      RealMat m = src->MomentTensor(d);
+      mSrcMat.conservativeResizeLike(RealMat::Zero(n * d, col + 1));
+      for (PetscInt i = 0; i < d; i++) {
+        mSrcMat.col(col).segment(i * n, n) = Element::applyGradTestAndIntegrate(delta * m.row(i));
+      }
+      /* And M_phi_phi (taken as M_rr, for a source on the axis) against the hoop strain of the test functions. */
+      if (Element::Axisymmetric()) {
+        mSrcMat.col(col).segment(0, n) += m(0, 0) * Element::getHoopDeltaFunctionCoefficients(pnt);
+      }
+    } else {
+      if (src->GetNumComponents() != d) {
+        throw std::runtime_error("A point force in an elastic element needs one component per dimension "
+                                 "(source " + std::to_string(src->Num()) + ").");
+      }
+      mSrcMat.conservativeResizeLike(RealMat::Zero(n * d, col + d));
+      RealVec coef = Element::applyTestAndIntegrate(delta);
+      for (PetscInt i = 0; i < d; i++) { mSrcMat.col(col + i).segment(i * n, n) = coef; }
+    }
+    mSrcStf.setZero(mSrcMat.cols());
+  }
+  return found;
+}
+
+template <typename Element>
+bool Elastic2D<Element>::attachReceiver(std::unique_ptr<Receiver> &receiver, const bool finalize) {
+  bool found = Element::attachReceiver(receiver, finalize);
+  if (found && finalize) {
+    std::vector<std::string> fields;
+    for (auto &f: Elastic2D<Element>::PullElementalFields()) { fields.push_back(FieldName(f)); }
+    for (auto &name: receiver->GradientFields(Element::NumDim())) { fields.push_back(name); }
+    Element::Receivers().back()->registerFields(fields);
+  }
+  return found;
+}
+
+template <typename Element>
+void Elastic2D<Element>::recordField(const Ref<const MatrixXd> &u) {
+  // Only the fields of this physics, which come first in any coupled element.
+  const PetscInt num_fields = Elastic2D<Element>::PullElementalFields().size();
+  for (PetscInt i = 0; i < Element::Receivers().size(); i++) {
+    for (PetscInt f = 0; f < num_fields; f++) {
+      Element::Receivers()[i]->record(Element::ReceiverWeights()[i].dot(u.col(f)), f);
+    }
+  }
+
+  /* The strain, stress and rotation after the displacement, for the receivers which record them (see
+   * Receiver::GradientFields), from the gradient of this element (du_i/dx_j in column 2 i + j). */
+  bool gradient = false, stress = false;
+  for (auto &rec: Element::Receivers()) {
+    gradient = gradient || rec->RecordsGradient(); stress = stress || rec->RecordsStress();
+  }
+  if (!gradient) { return; }
+  Eigen::Map<MatrixXd> grad = Scratch::Matrix(Scratch::PhysicsStrain, Element::NumIntPnt(), 4);
+  grad.leftCols<2>() = Element::computeGradient(u.col(0));
+  grad.rightCols<2>() = Element::computeGradient(u.col(1));
+
+  /* The stress at the integration points (xx, yy, xy), which computeStress takes from the gradient. */
+  Eigen::Map<MatrixXd> sigma = stress ? computeStress(grad) : Scratch::Matrix(Scratch::PhysicsStress, 0, 3);
+
+  for (PetscInt i = 0; i < Element::Receivers().size(); i++) {
+    auto &rec = Element::Receivers()[i];
+    if (!rec->RecordsGradient()) { continue; }
+    const RealVec grad_rec = grad.transpose() * Element::ReceiverWeights()[i];
+    PetscInt f = num_fields;
+    if (rec->RecordsStrain()) {
+      rec->record(grad_rec(0), f++); rec->record(grad_rec(3), f++);
+      rec->record(0.5 * (grad_rec(1) + grad_rec(2)), f++);
+    }
+    if (rec->RecordsStress()) {
+      const RealVec sigma_rec = sigma.transpose() * Element::ReceiverWeights()[i];
+      for (PetscInt k = 0; k < 3; k++) { rec->record(sigma_rec(k), f++); }
+    }
+    if (rec->RecordsRotation()) { rec->record(0.5 * (grad_rec(2) - grad_rec(1)), f++); }
+  }
 }
 
 template <typename Element>
-MatrixXd Elastic2D<Element>::computeSourceTerm(const double time, const PetscInt time_idx) {
-  RealMat s = RealMat::Zero(Element::NumIntPnt(), Element::NumDim());
-  for (auto &source : Element::Sources()) {
-    //switch ()
-    RealVec2 pnt (source->LocR(), source->LocS());
-    //s.col(0) += (source->fire(time, time_idx) * Element::getDeltaFunctionCoefficients(pnt));
-    s += (Element::getDeltaFunctionCoefficients(pnt) * source->fire(time, time_idx).transpose() );
+Eigen::Map<MatrixXd> Elastic2D<Element>::computeSourceTerm(const double time, const PetscInt time_idx) {
+  Eigen::Map<MatrixXd> s = Scratch::Matrix(Scratch::PhysicsSource, Element::NumIntPnt(), Element::NumDim());
+  if (!mSrcStf.size()) { s.setZero(); return s; }
+  /* The time functions of all sources, then one product with their precomputed forces. */
+  PetscInt off = 0;
+  for (auto &src: Element::Sources()) {
+    auto f = src->fire(time, time_idx);
+    mSrcStf.segment(off, f.size()) = f;
+    off += f.size();
   }
-  // This should be replaced by a single call for vector-valued problems
-  s.col(0) = Element::applyTestAndIntegrate(s.col(0));
-  s.col(1) = Element::applyTestAndIntegrate(s.col(1));
+  Map<VectorXd>(s.data(), s.size()).noalias() = mSrcMat * mSrcStf;
+  if (Element::Axisymmetric()) { s.col(0) = (Element::AxisRadius().array() > 0).select(s.col(0).array(), 0); }
   return s;
 }
 
@@ -3,29 +3,29 @@
 #include <Model/ExodusModel.h>
 #include <Physics/Elastic3D.h>
 #include <Source/Source.h>
+#include <Receiver/Receiver.h>
 #include <Utilities/Types.h>
 #include <Utilities/Logging.h>
+#include <Utilities/Scratch.h>
+#include <Utilities/Utilities.h>
+#include <algorithm>
+#include <string>
 
 using namespace Eigen;
 
+/* Model parameter of a Voigt coefficient (C11, C12, ..., C66). */
+static std::string voigtName(const int i, const int j) {
+  return "C" + std::to_string(std::min(i, j) + 1) + std::to_string(std::max(i, j) + 1);
+}
+
 template <typename Element>
 Elastic3D<Element>::Elastic3D(std::unique_ptr<Options> const &options): Element(options) {
 
-  int num_stress_cmp = 6;
-  int num_strain_cmp = 9;
+  mSymmetry = ElasticSymmetry::ORTHOTROPIC; mConstant = false;
   mRho.setZero(Element::NumIntPnt());
-  mc11.setZero(Element::NumIntPnt());
-  mc12.setZero(Element::NumIntPnt());
-  mc13.setZero(Element::NumIntPnt());
-  mc22.setZero(Element::NumIntPnt());
-  mc23.setZero(Element::NumIntPnt());
-  mc33.setZero(Element::NumIntPnt());
-  mc44.setZero(Element::NumIntPnt());
-  mc55.setZero(Element::NumIntPnt());
-  mc66.setZero(Element::NumIntPnt());
-//  mStiff.setZero(Element::NumIntPnt(), Element::NumDim());
-//  mStress.setZero(Element::NumIntPnt(), num_stress_cmp);
-//  mStress.setZero(Element::NumIntPnt(), num_strain_cmp);
+  for (PetscInt k = 0; k < mC.size(); k++) {
+    if (ElasticSymmetryMask(mSymmetry) & (1 << k)) { mC[k].setZero(Element::NumIntPnt()); }
+  }
 
 }
 
@@ -33,31 +33,96 @@ template <typename Element>
 void Elastic3D<Element>::attachMaterialProperties(std::unique_ptr<ExodusModel> const &model) {
 
   Element::attachMaterialProperties(model, "RHO");
-  Element::attachMaterialProperties(model, "VPV");
-  Element::attachMaterialProperties(model, "VPH");
-  Element::attachMaterialProperties(model, "VSV");
-  Element::attachMaterialProperties(model, "VSH");
-  Element::attachMaterialProperties(model, "ETA");
-
   mRho = Element::ParAtIntPts("RHO");
-  mc11 = mRho * Element::ParAtIntPts("VPH").array().pow(2);
-  mc22 = mRho * Element::ParAtIntPts("VPH").array().pow(2);
-  mc33 = mRho * Element::ParAtIntPts("VPV").array().pow(2);
-  mc44 = mRho * Element::ParAtIntPts("VSV").array().pow(2);
-  mc55 = mRho * Element::ParAtIntPts("VSV").array().pow(2);
-  mc66 = mRho * Element::ParAtIntPts("VSH").array().pow(2);
 
-  mc12 = mc11 - 2 * mc66;
-  mc13 = Element::ParAtIntPts("ETA").array() * (mc11 - 2 * mc44).array();
-  mc23 = Element::ParAtIntPts("ETA").array() * (mc11 - 2 * mc44).array();
+  /* A model of general anisotropy gives the 21 coefficients C11, ..., C66. Otherwise, the medium is VTI. */
+  bool general = true;
+  for (PetscInt i = 0; i < 6; i++) {
+    for (PetscInt j = i; j < 6; j++) { general = general && model->HasElementalParameter(voigtName(i, j)); }
+  }
+  if (general) {
+    for (PetscInt i = 0; i < 6; i++) {
+      for (PetscInt j = i; j < 6; j++) {
+        Element::attachMaterialProperties(model, voigtName(i, j));
+        mC[VoigtIndex(i, j)] = Element::ParAtIntPts(voigtName(i, j));
+      }
+    }
+  } else {
+    for (auto name: {"VPV", "VPH", "VSV", "VSH", "ETA"}) { Element::attachMaterialProperties(model, name); }
+    for (auto &c: mC) { c.setZero(Element::NumIntPnt()); }
+    auto c = [&](const int i, const int j) -> ArrayXd& { return mC[VoigtIndex(i - 1, j - 1)]; };
+    c(1, 1) = mRho * Element::ParAtIntPts("VPH").array().pow(2);
+    c(2, 2) = mRho * Element::ParAtIntPts("VPH").array().pow(2);
+    c(3, 3) = mRho * Element::ParAtIntPts("VPV").array().pow(2);
+    c(4, 4) = mRho * Element::ParAtIntPts("VSV").array().pow(2);
+    c(5, 5) = mRho * Element::ParAtIntPts("VSV").array().pow(2);
+    c(6, 6) = mRho * Element::ParAtIntPts("VSH").array().pow(2);
+
+    c(1, 2) = c(1, 1) - 2 * c(6, 6);
+    c(1, 3) = Element::ParAtIntPts("ETA").array() * (c(1, 1) - 2 * c(4, 4)).array();
+    c(2, 3) = Element::ParAtIntPts("ETA").array() * (c(1, 1) - 2 * c(4, 4)).array();
+  }
+
+  /* The cheapest symmetry class which holds all coefficients that are not zero (relative to the diagonal), so
+   * that the stress kernel only sums those. */
+  const PetscReal tol = 1e-12;
+  PetscReal scale = 0;
+  for (PetscInt i = 0; i < 6; i++) { scale = std::max(scale, mC[VoigtIndex(i, i)].abs().maxCoeff()); }
+  int nonzero = 0;
+  for (PetscInt k = 0; k < mC.size(); k++) {
+    if (mC[k].abs().maxCoeff() > tol * scale) { nonzero |= 1 << k; }
+  }
+  mSymmetry = ElasticSymmetry::TRICLINIC;
+  for (auto symmetry: {ElasticSymmetry::MONOCLINIC_Y, ElasticSymmetry::MONOCLINIC_X, ElasticSymmetry::ORTHOTROPIC}) {
+    if (!(nonzero & ~ElasticSymmetryMask(symmetry))) { mSymmetry = symmetry; }
+  }
+
+  /* Most elements of most models are isotropic. Those only keep lambda and mu, and use the cheapest
+   * stress kernel. */
+  auto same = [&](const int i, const int j, const int k, const int l) {
+    return mC[VoigtIndex(i - 1, j - 1)].isApprox(mC[VoigtIndex(k - 1, l - 1)], tol);
+  };
+  if (mSymmetry == ElasticSymmetry::ORTHOTROPIC && same(1, 1, 2, 2) && same(1, 1, 3, 3) && same(1, 2, 1, 3) &&
+      same(1, 2, 2, 3) && same(4, 4, 6, 6) && same(5, 5, 6, 6) &&
+      mC[VoigtIndex(0, 1)].isApprox(mC[VoigtIndex(0, 0)] - 2 * mC[VoigtIndex(5, 5)], tol)) {
+    mSymmetry = ElasticSymmetry::ISOTROPIC;
+    mLambda = mC[VoigtIndex(0, 1)]; mMu = mC[VoigtIndex(5, 5)];
+  }
+  const int mask = Isotropic() ? 0 : ElasticSymmetryMask(mSymmetry);
+  for (PetscInt k = 0; k < mC.size(); k++) {
+    if (!(mask & (1 << k))) { mC[k].resize(0); }
+  }
+
+  /* Blocky and layered models are mostly constant within an element, which then keeps a single value of each
+   * parameter. */
+  mConstant = utilities::isConstant(mRho) && utilities::isConstant(mLambda) && utilities::isConstant(mMu);
+  for (auto &c: mC) { mConstant = mConstant && utilities::isConstant(c); }
+  if (mConstant) {
+    for (auto par: {&mRho, &mLambda, &mMu}) { if (par->size()) { par->conservativeResize(1); } }
+    for (auto &c: mC) { if (c.size()) { c.conservativeResize(1); } }
+  }
 
 }
 
 template <typename Element>
-std::vector<std::string> Elastic3D<Element>::PullElementalFields() const { return {"ux", "uy", "uz"}; }
+double Elastic3D<Element>::CFL_estimate() {
+  // fastest (p) wave speed over all axes.
+  double vp_max = Isotropic() ? ((mLambda + 2 * mMu) / mRho).sqrt().maxCoeff() :
+      (mC[VoigtIndex(0, 0)].max(mC[VoigtIndex(1, 1)]).max(mC[VoigtIndex(2, 2)]) / mRho).sqrt().maxCoeff();
+  return Element::CFL_constant() * Element::estimatedElementRadius() / vp_max;
+}
 
 template <typename Element>
-std::vector<std::string> Elastic3D<Element>::PushElementalFields() const { return {"ax", "ay", "az"}; }
+const std::vector<FieldId> &Elastic3D<Element>::PullElementalFields() const {
+  static const std::vector<FieldId> pull {FieldId::ux, FieldId::uy, FieldId::uz};
+  return pull;
+}
+
+template <typename Element>
+const std::vector<FieldId> &Elastic3D<Element>::PushElementalFields() const {
+  static const std::vector<FieldId> push {FieldId::ax, FieldId::ay, FieldId::az};
+  return push;
+}
 
 template <typename Element>
 MatrixXd Elastic3D<Element>::assembleElementMassMatrix() {
@@ -67,68 +132,192 @@ MatrixXd Elastic3D<Element>::assembleElementMassMatrix() {
 }
 
 template <typename Element>
-MatrixXd Elastic3D<Element>::computeStiffnessTerm(const Eigen::MatrixXd &u) {
+Eigen::Map<MatrixXd> Elastic3D<Element>::computeStiffnessTerm(const Eigen::Ref<const Eigen::MatrixXd> &u) {
+
+  /* Gradient, stress (see computeStress) and integration in one sweep over the element, through the kernel
+   * of its symmetry class. */
+  if (Isotropic()) {
+    const PetscReal *coef[] = {mLambda.data(), mMu.data()};
+    return Element::elasticStiffness(u, coef, mSymmetry, mConstant);
+  }
+  const PetscReal *coef[21];
+  for (PetscInt k = 0; k < mC.size(); k++) { coef[k] = mC[k].size() ? mC[k].data() : NULL; }
+  return Element::elasticStiffness(u, coef, mSymmetry, mConstant);
+
+}
 
-  MatrixXd grad_ux = Element::computeGradient(u.col(0));
-  MatrixXd grad_uy = Element::computeGradient(u.col(1));
-  MatrixXd grad_uz = Element::computeGradient(u.col(2));
+template <typename Element>
+Eigen::Map<MatrixXd> Elastic3D<Element>::computeStress(const Eigen::Ref<const Eigen::MatrixXd> &strain) {
 
-  ArrayXd strain(Element::NumIntPnt(),6);
-  strain.col(0) = grad_ux.col(0);
-  strain.col(1) = grad_uy.col(1);
-  strain.col(2) = grad_uz.col(2);
-  strain.col(3) = grad_uy.col(2) + grad_uz.col(1);
-  strain.col(4) = grad_ux.col(2) + grad_uz.col(0);
-  strain.col(5) = grad_ux.col(1) + grad_uy.col(0);
+  Eigen::Map<MatrixXd> stress = Scratch::Matrix(Scratch::PhysicsStress, Element::NumIntPnt(), 6);
+  if (Isotropic()) {
+    const ArrayXd lambda = atIntPts(mLambda), mu = atIntPts(mMu);
+    const auto lambda_div = lambda * (strain.col(0) + strain.col(1) + strain.col(2)).array();
+    for (PetscInt i = 0; i < 3; i++) { stress.col(i) = lambda_div + 2 * mu * strain.col(i).array(); }
+    for (PetscInt i = 3; i < 6; i++) { stress.col(i) = mu * strain.col(i).array(); }
+    return stress;
+  }
+  stress.setZero();
+  for (PetscInt i = 0; i < 6; i++) {
+    for (PetscInt j = i; j < 6; j++) {
+      if (!mC[VoigtIndex(i, j)].size()) { continue; }
+      const ArrayXd c = atIntPts(mC[VoigtIndex(i, j)]);
+      stress.col(i).array() += c * strain.col(j).array();
+      if (j != i) { stress.col(j).array() += c * strain.col(i).array(); }
+    }
+  }
 
-  /*    0,    1,    2,    3,    4,    5 */
-  /* s_xx, s_yy, s_zz, s_yz, s_xz, s_xy */
-  Array<double,Dynamic,6> stress = computeStress(strain);
-  Matrix<double,Dynamic,3> stress_col(Element::NumIntPnt(), 3), stiff(Element::NumIntPnt(), 3);
+  return stress;
 
-  // sigma_x* -> ux
-  stress_col.col(0) = stress.col(0); stress_col.col(1) = stress.col(5); stress_col.col(2) = stress.col(4);
-  stiff.col(0) = Element::applyGradTestAndIntegrate(stress_col);
+}
 
-  // sigma_y* -> uy
-  stress_col.col(0) = stress.col(5); stress_col.col(1) = stress.col(1); stress_col.col(2) = stress.col(3);
-  stiff.col(1) = Element::applyGradTestAndIntegrate(stress_col);
+template <typename Element>
+MatrixXd Elastic3D<Element>::computeKernels(const Eigen::Ref<const Eigen::MatrixXd> &u,
+                                            const Eigen::Ref<const Eigen::MatrixXd> &u_adj) {
 
-  // sigma_z* -> uz
-  stress_col.col(0) = stress.col(4); stress_col.col(1) = stress.col(3); stress_col.col(2) = stress.col(2);
-  stiff.col(2) = Element::applyGradTestAndIntegrate(stress_col);
+  /* The gradient of each component of both fields (du_i/dx_j in column 3 i + j). */
+  const PetscInt num_pnt = Element::NumIntPnt();
+  MatrixXd grad(num_pnt, 9), grad_adj(num_pnt, 9);
+  for (PetscInt i = 0; i < 3; i++) {
+    grad.middleCols(3 * i, 3) = Element::computeGradient(u.col(i));
+    grad_adj.middleCols(3 * i, 3) = Element::computeGradient(u_adj.col(i));
+  }
 
-  return stiff;
+  const ArrayXd p_modulus = atIntPts(Isotropic() ? (mLambda + 2 * mMu).eval() : mC[VoigtIndex(2, 2)]);
+  const ArrayXd s_modulus = atIntPts(Isotropic() ? mMu : mC[VoigtIndex(3, 3)]);
+  MatrixXd kernels(num_pnt, 2);
+  for (PetscInt p = 0; p < num_pnt; p++) {
+    const PetscReal div = grad(p, 0) + grad(p, 4) + grad(p, 8);
+    const PetscReal div_adj = grad_adj(p, 0) + grad_adj(p, 4) + grad_adj(p, 8);
+    PetscReal eps_eps = 0;
+    for (PetscInt i = 0; i < 3; i++) {
+      for (PetscInt j = 0; j < 3; j++) {
+        eps_eps += 0.25 * (grad(p, 3 * i + j) + grad(p, 3 * j + i)) *
+            (grad_adj(p, 3 * i + j) + grad_adj(p, 3 * j + i));
+      }
+    }
+    kernels(p, 0) = 2 * p_modulus(p) * div_adj * div;
+    kernels(p, 1) = 4 * s_modulus(p) * (eps_eps - div_adj * div);
+  }
+  return kernels;
 
 }
 
 template <typename Element>
-Array<double,Dynamic,6> Elastic3D<Element>::computeStress(const Eigen::Ref<const Eigen::ArrayXd> &strain) {
-
-  Matrix<double,Dynamic,6> stress(Element::NumIntPnt(),6);
-  stress.col(0) = mc11 * strain.col(0) + mc12 * strain.col(1) + mc13 * strain.col(2);
-  stress.col(1) = mc12 * strain.col(0) + mc22 * strain.col(1) + mc23 * strain.col(2);
-  stress.col(2) = mc13 * strain.col(0) + mc23 * strain.col(1) + mc33 * strain.col(2);
-  stress.col(3) = mc44 * strain.col(3);
-  stress.col(4) = mc55 * strain.col(4);
-  stress.col(5) = mc66 * strain.col(5);
+Eigen::Map<MatrixXd> Elastic3D<Element>::computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd> &u) {
+  Eigen::Map<MatrixXd> rval = Scratch::Matrix(Scratch::PhysicsSurface, Element::NumIntPnt(), Element::NumDim());
+  rval.setZero();
+  return rval;
+}
 
-  return stress;
+template <typename Element>
+bool Elastic3D<Element>::attachSource(std::unique_ptr<Source> &source, const bool finalize) {
+  bool found = Element::attachSource(source, finalize);
+  if (found && finalize) {
+    RealVec3 pnt(Element::Sources().back()->LocR(), Element::Sources().back()->LocS(),
+                 Element::Sources().back()->LocT());
+    RealVec delta = Element::getDeltaFunctionCoefficients(pnt);
+    const PetscInt n = Element::NumIntPnt(), d = Element::NumDim(), col = mSrcMat.cols();
+    auto &src = Element::Sources().back();
+    if (src->IsMomentTensor()) {
+      /* -div(M delta), integrated by parts: row i of the (symmetric) moment tensor against the gradient of the
+       * test functions gives component i of the force. */
+      RealMat m = src->MomentTensor(d);
+      mSrcMat.conservativeResizeLike(RealMat::Zero(n * d, col + 1));
+      for (PetscInt i = 0; i < d; i++) {
+        mSrcMat.col(col).segment(i * n, n) = Element::applyGradTestAndIntegrate(delta * m.row(i));
+      }
+    } else {
+      if (src->GetNumComponents() != d) {
+        throw std::runtime_error("A point force in an elastic element needs one component per dimension "
+                                 "(source " + std::to_string(src->Num()) + ").");
+      }
+      mSrcMat.conservativeResizeLike(RealMat::Zero(n * d, col + d));
+      RealVec coef = Element::applyTestAndIntegrate(delta);
+      for (PetscInt i = 0; i < d; i++) { mSrcMat.col(col + i).segment(i * n, n) = coef; }
+    }
+    mSrcStf.setZero(mSrcMat.cols());
+  }
+  return found;
+}
 
+template <typename Element>
+bool Elastic3D<Element>::attachReceiver(std::unique_ptr<Receiver> &receiver, const bool finalize) {
+  bool found = Element::attachReceiver(receiver, finalize);
+  if (found && finalize) {
+    std::vector<std::string> fields;
+    for (auto &f: Elastic3D<Element>::PullElementalFields()) { fields.push_back(FieldName(f)); }
+    for (auto &name: receiver->GradientFields(Element::NumDim())) { fields.push_back(name); }
+    Element::Receivers().back()->registerFields(fields);
+  }
+  return found;
 }
 
 template <typename Element>
-MatrixXd Elastic3D<Element>::computeSurfaceIntegral(const Eigen::Ref<const Eigen::MatrixXd> &u) {
-  return MatrixXd::Zero(Element::NumIntPnt(), Element::NumDim());
+void Elastic3D<Element>::recordField(const Ref<const MatrixXd> &u) {
+  // Only the fields of this physics, which come first in any coupled element.
+  const PetscInt num_fields = Elastic3D<Element>::PullElementalFields().size();
+  for (PetscInt i = 0; i < Element::Receivers().size(); i++) {
+    for (PetscInt f = 0; f < num_fields; f++) {
+      Element::Receivers()[i]->record(Element::ReceiverWeights()[i].dot(u.col(f)), f);
+    }
+  }
+
+  /* The strain, stress and rotation after the displacement, for the receivers which record them (see
+   * Receiver::GradientFields), from the gradient of this element (du_i/dx_j in column 3 i + j). */
+  bool gradient = false, stress = false;
+  for (auto &rec: Element::Receivers()) {
+    gradient = gradient || rec->RecordsGradient(); stress = stress || rec->RecordsStress();
+  }
+  if (!gradient) { return; }
+  Eigen::Map<MatrixXd> grad = Scratch::Matrix(Scratch::PhysicsStrain, Element::NumIntPnt(), 9);
+  for (PetscInt i = 0; i < 3; i++) { grad.middleCols(3 * i, 3) = Element::computeGradient(u.col(i)); }
+
+  /* The stress at the integration points, from the strain in Voigt order (with the engineering shear strain). */
+  auto voigt_stress = [&]() {
+    Eigen::Map<MatrixXd> eps = Scratch::Matrix(Scratch::PhysicsTemp, Element::NumIntPnt(), 6);
+    eps.col(0) = grad.col(0); eps.col(1) = grad.col(4); eps.col(2) = grad.col(8);
+    eps.col(3) = grad.col(5) + grad.col(7); eps.col(4) = grad.col(2) + grad.col(6);
+    eps.col(5) = grad.col(1) + grad.col(3);
+    return computeStress(eps);
+  };
+  Eigen::Map<MatrixXd> sigma = stress ? voigt_stress() : Scratch::Matrix(Scratch::PhysicsStress, 0, 6);
+
+  for (PetscInt i = 0; i < Element::Receivers().size(); i++) {
+    auto &rec = Element::Receivers()[i];
+    if (!rec->RecordsGradient()) { continue; }
+    const RealVec grad_rec = grad.transpose() * Element::ReceiverWeights()[i];
+    PetscInt f = num_fields;
+    if (rec->RecordsStrain()) {
+      rec->record(grad_rec(0), f++); rec->record(grad_rec(4), f++); rec->record(grad_rec(8), f++);
+      rec->record(0.5 * (grad_rec(5) + grad_rec(7)), f++);
+      rec->record(0.5 * (grad_rec(2) + grad_rec(6)), f++);
+      rec->record(0.5 * (grad_rec(1) + grad_rec(3)), f++);
+    }
+    if (rec->RecordsStress()) {
+      const RealVec sigma_rec = sigma.transpose() * Element::ReceiverWeights()[i];
+      for (PetscInt k = 0; k < 6; k++) { rec->record(sigma_rec(k), f++); }
+    }
+    if (rec->RecordsRotation()) {
+      rec->record(0.5 * (grad_rec(7) - grad_rec(5)), f++);
+      rec->record(0.5 * (grad_rec(2) - grad_rec(6)), f++);
+      rec->record(0.5 * (grad_rec(3) - grad_rec(1)), f++);
+    }
+  }
 }
 
 template <typename Element>
-MatrixXd Elastic3D<Element>::computeSourceTerm(const double time, const PetscInt time_idx) {
-  MatrixXd s = MatrixXd::Zero(Element::NumIntPnt(), Element::NumDim());
-  for (auto &source : Element::Sources()) {
-    RealVec3 pnt(source->LocR(), source->LocS(), source->LocT());
-    s += (Element::getDeltaFunctionCoefficients(pnt) * source->fire(time, time_idx).transpose() );
+Eigen::Map<MatrixXd> Elastic3D<Element>::computeSourceTerm(const double time, const PetscInt time_idx) {
+  Eigen::Map<MatrixXd> s = Scratch::Matrix(Scratch::PhysicsSource, Element::NumIntPnt(), Element::NumDim());
+  if (!mSrcStf.size()) { s.setZero(); return s; }
+  /* The time functions of all sources, then one product with their precomputed forces. */
+  PetscInt off = 0;
+  for (auto &src: Element::Sources()) {
+    auto f = src->fire(time, time_idx);
+    mSrcStf.segment(off, f.size()) = f;
+    off += f.size();
   }
+  Map<VectorXd>(s.data(), s.size()).noalias() = mSrcMat * mSrcStf;
   return s;
 }
 
@@ -1,8 +1,14 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
 #include <Mesh/Mesh.h>
 #include <Source/Source.h>
+#include <Receiver/Receiver.h>
 #include <Physics/Scalar.h>
 #include <Utilities/Options.h>
 #include <Utilities/Logging.h>
+#include <Utilities/Scratch.h>
+#include <Utilities/Utilities.h>
 #include <Model/ExodusModel.h>
 
 using namespace Eigen;
@@ -10,25 +16,89 @@ using namespace Eigen;
 template <typename Element>
 Scalar<Element>::Scalar(std::unique_ptr<Options> const &options): Element(options) {
 
-  // Allocate all work arrays.
+  // Work arrays are borrowed from the scratch arena in the time loop.
   mVpSquared.setZero(Element::NumIntPnt());
-  mStiff.setZero(Element::NumIntPnt());
-  mSource.setZero(Element::NumIntPnt());
-  mStress.setZero(Element::NumIntPnt(), Element::NumDim());
-  mStrain.setZero(Element::NumIntPnt(), Element::NumDim());
+  mMember = 0;
+
+  // One column of forcing per shot (see --simultaneous-shots).
+  mNumShots = options->SimultaneousShots();
+
+  // Simplices have dense operators of their own.
+  mDenseStiffness = options->DenseElementStiffness() && Element::TensorBasis();
+  mSingleStiffness = mDenseStiffness && options->MixedPrecision();
 
 }
 
 template <typename Element>
 void Scalar<Element>::attachMaterialProperties(std::unique_ptr<ExodusModel> const &model) {
   Element::attachMaterialProperties(model, "VP");
+
+  /* The (square) of the velocity at each integration point does not change during a run. Kept once if it is
+   * constant within the element. */
+  mVpSquared = Element::ParAtIntPts("VP").array().pow(2);
+  if (utilities::isConstant(mVpSquared.array())) { mVpSquared.conservativeResize(1); }
+
+  /* The other members of an ensemble are sampled the same way, after which the parameter of the element is that of
+   * the first member again. Only the sum-factorized stiffness term reads the velocity in the time loop. */
+  mMemberVpSquared.clear(); mMember = 0;
+  if (model->NumMembers() == 1) { return; }
+  if (!Element::TensorBasis() || mDenseStiffness) {
+    throw std::runtime_error("--ensemble-model-files needs a mesh of quads or hexes, without "
+                             "--dense-element-stiffness.");
+  }
+  for (PetscInt m = 1; m < model->NumMembers(); m++) {
+    Element::attachMaterialProperties(model->Member(m), "VP");
+    mMemberVpSquared.push_back(Element::ParAtIntPts("VP").array().pow(2));
+    if (utilities::isConstant(mMemberVpSquared.back().array())) { mMemberVpSquared.back().conservativeResize(1); }
+  }
+  Element::attachMaterialProperties(model, "VP");
 }
 
 template <typename Element>
-std::vector<std::string> Scalar<Element>::PullElementalFields() const { return { "u" }; }
+void Scalar<Element>::precomputeElementTerms() {
+
+  Element::precomputeElementTerms();
+  if (!mDenseStiffness) { return; }
+
+  /* Apply the sum-factorized stiffness term to each basis function in turn. */
+  const PetscInt num_pnt = Element::NumIntPnt();
+  mDenseStiffness = false;
+  mStiffMat.resize(num_pnt, num_pnt);
+  RealMat basis = RealMat::Zero(num_pnt, 1);
+  for (PetscInt j = 0; j < num_pnt; j++) {
+    basis(j, 0) = 1;
+    mStiffMat.col(j) = computeStiffnessTerm(basis).col(0);
+    basis(j, 0) = 0;
+  }
+  mDenseStiffness = true;
+
+  /* Rounded once, and applied to the field rounded to single precision. */
+  if (mSingleStiffness) {
+    mStiffMatSingle = mStiffMat.cast<float>();
+    RealMat().swap(mStiffMat);
+  }
+
+}
 
 template <typename Element>
-std::vector<std::string> Scalar<Element>::PushElementalFields() const { return { "a" }; }
+double Scalar<Element>::CFL_estimate() {
+  double vp_squared_max = mVpSquared.maxCoeff();
+  for (auto &vp_squared: mMemberVpSquared) { vp_squared_max = std::max(vp_squared_max, vp_squared.maxCoeff()); }
+  double vp_max = std::sqrt(vp_squared_max);
+  return Element::CFL_constant() * Element::estimatedElementRadius() / vp_max;
+}
+
+template <typename Element>
+const std::vector<FieldId> &Scalar<Element>::PullElementalFields() const {
+  static const std::vector<FieldId> pull {FieldId::u};
+  return pull;
+}
+
+template <typename Element>
+const std::vector<FieldId> &Scalar<Element>::PushElementalFields() const {
+  static const std::vector<FieldId> push {FieldId::a};
+  return push;
+}
 
 template <typename Element>
 RealMat Scalar<Element>::assembleElementMassMatrix() {
@@ -39,52 +109,159 @@ RealMat Scalar<Element>::assembleElementMassMatrix() {
 }
 
 template <typename Element>
-RealMat Scalar<Element>::computeStress(const Ref<const RealMat> &strain) {
-
-  // Interpolate the (square) of the velocity at each integration point.
-  mVpSquared = Element::ParAtIntPts("VP").array().pow(2);
+Eigen::Map<RealMat> Scalar<Element>::computeStress(const Ref<const RealMat> &strain) {
 
   // Calculate sigma_ux and sigma_uy.
-  mStress.col(0) = mVpSquared.array().cwiseProduct(strain.col(0).array());
-  mStress.col(1) = mVpSquared.array().cwiseProduct(strain.col(1).array());
+  Eigen::Map<RealMat> stress = Scratch::Matrix(Scratch::PhysicsStress, Element::NumIntPnt(), Element::NumDim());
+  const RealVec &vp_squared = VpSquared();
+  if (vp_squared.size() == 1) { stress = vp_squared(0) * strain.leftCols(Element::NumDim()); return stress; }
+  stress.col(0) = vp_squared.array().cwiseProduct(strain.col(0).array());
+  stress.col(1) = vp_squared.array().cwiseProduct(strain.col(1).array());
   if (Element::NumDim() == 3) {
-    mStress.col(2) = mVpSquared.array().cwiseProduct(strain.col(2).array());
+    stress.col(2) = vp_squared.array().cwiseProduct(strain.col(2).array());
   }
-  return mStress;
+  return stress;
 
 }
 
 template <typename Element>
-RealMat Scalar<Element>::computeStiffnessTerm(const Ref<const RealMat>& u) {
-  
-  // Calculate gradient from displacement.
-  mStrain = Element::computeGradient(u.col(0));
+Eigen::Map<RealMat> Scalar<Element>::computeStiffnessTerm(const Ref<const RealMat>& u) {
 
-  // Stress from strain.
-  mStress = computeStress(mStrain);
+  if (mDenseStiffness) {
+    Eigen::Map<RealMat> stiff = Scratch::Matrix(Scratch::PhysicsStiff, Element::NumIntPnt(), 1);
+    applyDenseStiffness(u.col(0), stiff.col(0));
+    return stiff;
+  }
+
+  // Calculate gradient from displacement, and stress from strain. The gradient is only read
+  // once, so it stays in the shape's scratch buffer.
+  Eigen::Map<RealMat> stress = computeStress(Element::computeGradient(u.col(0)));
 
   // Complete application of K->u.
-  mStiff = Element::applyGradTestAndIntegrate(mStress);
+  Eigen::Map<RealMat> stiff = Scratch::Matrix(Scratch::PhysicsStiff, Element::NumIntPnt(), 1);
+  stiff.col(0) = Element::applyGradTestAndIntegrate(stress);
 
-  return mStiff;
+  return stiff;
 
 }
 
 template <typename Element>
-RealMat Scalar<Element>::computeSurfaceIntegral(const Ref<const RealMat> &u) {
-  return RealMat::Zero(Element::NumIntPnt(), 1);
+template <int L>
+PetscInt Scalar<Element>::LaneGeometrySize(const Scalar<Element> *elm) {
+  // Inverse Jacobian and its determinant, 10 values per point.
+  return elm->mDenseStiffness ? 0 : 10 * L * elm->NumIntPnt();
+}
+
+template <typename Element>
+template <int L>
+void Scalar<Element>::packLaneGeometry(Scalar<Element> *const *elms, PetscReal *geo) {
+  for (PetscInt l = 0; l < L; l++) { elms[l]->interleaveGeometry(l, L, geo); }
+}
+
+template <typename Element>
+template <int L>
+void Scalar<Element>::packLaneMaterial(Scalar<Element> *const *elms, PetscReal *coef) {
+  const PetscInt num_pnt = elms[0]->NumIntPnt();
+  for (PetscInt l = 0; l < L; l++) {
+    for (PetscInt i = 0; i < num_pnt; i++) { coef[L * i + l] = elms[l]->VpSquared(i); }
+  }
+}
+
+template <typename Element>
+template <int L>
+void Scalar<Element>::computeStiffnessTermLanes(Scalar<Element> *const *elms, const PetscReal *geo,
+                                                const PetscReal *coef, const PetscReal *u, PetscReal *stiff,
+                                                std::vector<PetscReal> &work) {
+
+  // The mode is the same on all elements. Dense matrices are applied lane by lane.
+  const PetscInt num_pnt = elms[0]->NumIntPnt();
+  if (elms[0]->mDenseStiffness) {
+    typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> LaneMat;
+    Eigen::Map<const LaneMat> ul(u, num_pnt, L);
+    Eigen::Map<LaneMat> sl(stiff, num_pnt, L);
+    for (PetscInt l = 0; l < L; l++) { elms[l]->applyDenseStiffness(ul.col(l), sl.col(l)); }
+    return;
+  }
+
+  // Kernel scratch (3 values per point). Gradient, stress, and grad-test, all lanes in lockstep.
+  work.resize(3 * L * num_pnt);
+  elms[0]->template scalarStiffnessLanes<L>(geo, coef, u, stiff, work.data());
+
+}
+
+template <typename Element>
+Eigen::Map<RealMat> Scalar<Element>::computeSurfaceIntegral(const Ref<const RealMat> &u) {
+  Eigen::Map<RealMat> rval = Scratch::Matrix(Scratch::PhysicsSurface, Element::NumIntPnt(), 1);
+  rval.setZero();
+  return rval;
+}
+
+template <typename Element>
+RealMat Scalar<Element>::computeKernels(const Ref<const RealMat> &u, const Ref<const RealMat> &u_adj) {
+
+  /* The forward gradient is copied out of the scratch arena, before the adjoint one takes its place. */
+  RealMat grad = Element::computeGradient(u.col(0));
+  const auto grad_adj = Element::computeGradient(u_adj.col(0));
+  RealMat kernels(Element::NumIntPnt(), 1);
+  kernels.col(0) = (grad.array() * grad_adj.array()).rowwise().sum();
+  for (PetscInt i = 0; i < kernels.rows(); i++) { kernels(i, 0) *= 2 * VpSquared(i); }
+  return kernels;
+
+}
+
+template <typename Element>
+bool Scalar<Element>::attachSource(std::unique_ptr<Source> &source, const bool finalize) {
+  bool found = Element::attachSource(source, finalize);
+  if (found && finalize) {
+    RealVec pnt(Element::NumDim());
+    pnt(0) = Element::Sources().back()->LocR();
+    pnt(1) = Element::Sources().back()->LocS();
+    if (Element::NumDim() == 3) { pnt(2) = Element::Sources().back()->LocT(); }
+    mSrcCoef.push_back(Element::applyTestAndIntegrate(Element::getDeltaFunctionCoefficients(pnt)));
+  }
+  return found;
+}
+
+template <typename Element>
+bool Scalar<Element>::attachReceiver(std::unique_ptr<Receiver> &receiver, const bool finalize) {
+  bool found = Element::attachReceiver(receiver, finalize);
+  if (found && finalize) {
+    std::vector<std::string> fields;
+    for (auto &f: Scalar<Element>::PullElementalFields()) { fields.push_back(FieldName(f)); }
+
+    /* Then those of the other members of an ensemble, i.e. u_1, u_2, ... */
+    const PetscInt num_fields = fields.size();
+    for (PetscInt m = 1; m <= mMemberVpSquared.size(); m++) {
+      for (PetscInt f = 0; f < num_fields; f++) { fields.push_back(fields[f] + "_" + std::to_string(m)); }
+    }
+    Element::Receivers().back()->registerFields(fields);
+  }
+  return found;
+}
+
+template <typename Element>
+void Scalar<Element>::recordField(const Ref<const MatrixXd> &u) {
+  // Only the fields of this physics, which come first in any coupled element.
+  const PetscInt num_fields = Scalar<Element>::PullElementalFields().size();
+  for (PetscInt i = 0; i < Element::Receivers().size(); i++) {
+    for (PetscInt f = 0; f < num_fields; f++) {
+      Element::Receivers()[i]->record(Element::ReceiverWeights()[i].dot(u.col(f)), mMember * num_fields + f);
+    }
+  }
 }
 
 template <typename Element>
-MatrixXd Scalar<Element>::computeSourceTerm(const double time, const PetscInt time_idx) {
-  mSource.setZero();
-  for (auto &source : Element::Sources()) {
-    RealVec pnt;
-    if (Element::NumDim() == 2) { pnt.resize(2); pnt << source->LocR(), source->LocS(); }
-    if (Element::NumDim() == 3) { pnt.resize(3); pnt << source->LocR(), source->LocS(), source->LocT(); }
-    mSource += (Element::getDeltaFunctionCoefficients(pnt) * source->fire(time, time_idx));
+Eigen::Map<RealMat> Scalar<Element>::computeSourceTerm(const double time, const PetscInt time_idx) {
+  /* A scalar source has a single component, so its forcing is a scaled copy of its coefficients. The sources of
+   * an ensemble drive every member. */
+  Eigen::Map<RealMat> source = Scratch::Matrix(Scratch::PhysicsSource, Element::NumIntPnt(), mNumShots);
+  source.setZero();
+  for (PetscInt i = 0; i < mSrcCoef.size(); i++) {
+    const PetscReal amplitude = Element::Sources()[i]->fire(time, time_idx)(0);
+    if (mMemberVpSquared.empty()) { source.col(Element::Sources()[i]->Shot()) += mSrcCoef[i] * amplitude; }
+    else { source.colwise() += mSrcCoef[i] * amplitude; }
   }
-  return Element::applyTestAndIntegrate(mSource);
+  return source;
 }
 
 #include <Element/HyperCube/TensorQuad.h>
@@ -93,6 +270,7 @@ MatrixXd Scalar<Element>::computeSourceTerm(const double time, const PetscInt ti
 #include <Element/Simplex/Tetrahedra.h>
 #include <Element/HyperCube/HexP1.h>
 #include <Element/HyperCube/QuadP1.h>
+#include <Element/ElementBatch.h>
 #include <Element/Simplex/TriP1.h>
 #include <Element/Simplex/TetP1.h>
 
@@ -100,3 +278,11 @@ template class Scalar<TensorQuad<QuadP1>>;
 template class Scalar<Hexahedra<HexP1>>;
 template class Scalar<Triangle<TriP1>>;
 template class Scalar<Tetrahedra<TetP1>>;
+template PetscInt Scalar<Hexahedra<HexP1>>::LaneGeometrySize<ELEMENT_SIMD_LANES>(const Scalar<Hexahedra<HexP1>> *);
+template void Scalar<Hexahedra<HexP1>>::packLaneGeometry<ELEMENT_SIMD_LANES>(
+    Scalar<Hexahedra<HexP1>> *const *, PetscReal *);
+template void Scalar<Hexahedra<HexP1>>::packLaneMaterial<ELEMENT_SIMD_LANES>(
+    Scalar<Hexahedra<HexP1>> *const *, PetscReal *);
+template void Scalar<Hexahedra<HexP1>>::computeStiffnessTermLanes<ELEMENT_SIMD_LANES>(
+    Scalar<Hexahedra<HexP1>> *const *, const PetscReal *, const PetscReal *, const PetscReal *, PetscReal *,
+    std::vector<PetscReal> &);
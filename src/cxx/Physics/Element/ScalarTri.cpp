@@ -4,20 +4,86 @@
 #include <Physics/ScalarTri.h>
 #include <Utilities/Options.h>
 #include <Utilities/Logging.h>
+#include <Utilities/Scratch.h>
 #include <Model/ExodusModel.h>
 
 using namespace Eigen;
 
 template <typename Element>
-RealMat ScalarTri<Element>::computeStiffnessTerm(const Ref<const RealMat>& u) {
-  
-  mStiff = Element::StiffnessMatrix()*u.col(0);
-  return mStiff;
+Eigen::Map<RealMat> ScalarTri<Element>::computeStiffnessTerm(const Ref<const RealMat>& u) {
+
+  Eigen::Map<RealMat> stiff = Scratch::Matrix(Scratch::PhysicsStiff, Element::NumIntPnt(), 1);
+  if (Element::ReferenceStiffness() && Element::VpSquared().size() == 1) {
+    Eigen::Map<RealVec> vp_squared = Scratch::Vector(Scratch::PhysicsTemp, Element::NumIntPnt());
+    vp_squared.setConstant(Element::VpSquared()(0));
+    stiff.col(0) = Element::applyReferenceStiffness(u.col(0), vp_squared);
+  } else if (Element::ReferenceStiffness()) {
+    stiff.col(0) = Element::applyReferenceStiffness(u.col(0), Element::VpSquared());
+  } else {
+    stiff.col(0).noalias() = Element::StiffnessMatrix()*u.col(0);
+  }
+  return stiff;
+
+}
+
+template <typename Element>
+template <int L>
+PetscInt ScalarTri<Element>::LaneGeometrySize(const ScalarTri<Element> *elm) {
+  return elm->ReferenceStiffness() ? 3 * L : 0;
+}
+
+template <typename Element>
+template <int L>
+void ScalarTri<Element>::packLaneGeometry(ScalarTri<Element> *const *elms, PetscReal *geo) {
+  for (PetscInt l = 0; l < L; l++) {
+    for (PetscInt k = 0; k < 3; k++) { geo[3 * l + k] = elms[l]->ReferenceStiffnessCoefficients()(k); }
+  }
+}
+
+template <typename Element>
+template <int L>
+void ScalarTri<Element>::packLaneMaterial(ScalarTri<Element> *const *elms, PetscReal *coef) {
+  const PetscInt num_pnt = elms[0]->NumIntPnt();
+  for (PetscInt l = 0; l < L; l++) {
+    for (PetscInt i = 0; i < num_pnt; i++) { coef[L * i + l] = elms[l]->VpSquared(i); }
+  }
+}
+
+template <typename Element>
+template <int L>
+void ScalarTri<Element>::computeStiffnessTermLanes(ScalarTri<Element> *const *elms, const PetscReal *geo,
+                                                   const PetscReal *coef, const PetscReal *u, PetscReal *stiff,
+                                                   std::vector<PetscReal> &work) {
+
+  typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> LaneMat;
+  const PetscInt num_pnt = elms[0]->NumIntPnt();
+
+  // The mode is the same on all elements. Dense matrices are applied lane by lane.
+  if (!elms[0]->ReferenceStiffness()) {
+    Eigen::Map<const LaneMat> ul(u, num_pnt, L);
+    Eigen::Map<LaneMat> sl(stiff, num_pnt, L);
+    for (PetscInt l = 0; l < L; l++) { sl.col(l).noalias() = elms[l]->StiffnessMatrix() * ul.col(l); }
+    return;
+  }
+
+  // Kernel scratch (2 values per point).
+  work.resize(2 * L * num_pnt);
+  elms[0]->template referenceStiffnessLanes<L>(geo, coef, u, stiff, work.data());
 
 }
 
 #include <Element/Simplex/Triangle.h>
 #include <Element/Simplex/TriP1.h>
+#include <Element/ElementBatch.h>
 
 template class ScalarTri<Scalar<Triangle<TriP1>>>;
+template PetscInt ScalarTri<Scalar<Triangle<TriP1>>>::LaneGeometrySize<ELEMENT_SIMD_LANES>(
+    const ScalarTri<Scalar<Triangle<TriP1>>> *);
+template void ScalarTri<Scalar<Triangle<TriP1>>>::packLaneGeometry<ELEMENT_SIMD_LANES>(
+    ScalarTri<Scalar<Triangle<TriP1>>> *const *, PetscReal *);
+template void ScalarTri<Scalar<Triangle<TriP1>>>::packLaneMaterial<ELEMENT_SIMD_LANES>(
+    ScalarTri<Scalar<Triangle<TriP1>>> *const *, PetscReal *);
+template void ScalarTri<Scalar<Triangle<TriP1>>>::computeStiffnessTermLanes<ELEMENT_SIMD_LANES>(
+    ScalarTri<Scalar<Triangle<TriP1>>> *const *, const PetscReal *, const PetscReal *, const PetscReal *,
+    PetscReal *, std::vector<PetscReal> &);
 
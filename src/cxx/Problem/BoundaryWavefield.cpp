@@ -0,0 +1,49 @@
+#include <Mesh/Mesh.h>
+#include <Problem/BoundaryWavefield.h>
+#include <Problem/Checkpoints.h>
+#include <Problem/Problem.h>
+#include <Utilities/Logging.h>
+#include <Utilities/Options.h>
+#include <stdexcept>
+
+BoundaryWavefield::BoundaryWavefield(std::unique_ptr<Mesh> const &mesh, std::unique_ptr<Options> const &options,
+                                     FieldDict &fields) {
+
+  mFields = Checkpoints::StateFields(fields);
+  mDofs = Problem::OwnedDofs(mesh, mesh->AbsorbingPoints());
+  mStates.assign(options->NumTimeSteps() * mFields.size() * mDofs.size(), 0);
+
+  unsigned long long num = mDofs.size();
+  MPI_Allreduce(MPI_IN_PLACE, &num, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, PETSC_COMM_WORLD);
+  LOG() << "Recording the forward wavefield on " << num << " absorbing boundary dofs ("
+        << mStates.size() * sizeof(PetscScalar) / (1024.0 * 1024.0) << " MB on this rank).";
+
+}
+
+void BoundaryWavefield::record(const PetscInt time_idx, FieldDict &fields) {
+
+  if (time_idx < 0 || mStates.size() < (time_idx + 1) * mFields.size() * mDofs.size()) {
+    throw std::runtime_error("Step " + std::to_string(time_idx) + " lies beyond the boundary wavefield.");
+  }
+  PetscScalar *state = mStates.data() + time_idx * mFields.size() * mDofs.size();
+  for (auto &name: mFields) {
+    const PetscScalar *val; VecGetArrayRead(fields[name]->mGlb, &val);
+    for (auto d: mDofs) { *state++ = val[d]; }
+    VecRestoreArrayRead(fields[name]->mGlb, &val);
+  }
+
+}
+
+void BoundaryWavefield::impose(const PetscInt time_idx, FieldDict &fields) {
+
+  if (time_idx < 0 || mStates.size() < (time_idx + 1) * mFields.size() * mDofs.size()) {
+    throw std::runtime_error("Step " + std::to_string(time_idx) + " lies beyond the boundary wavefield.");
+  }
+  const PetscScalar *state = mStates.data() + time_idx * mFields.size() * mDofs.size();
+  for (auto &name: mFields) {
+    PetscScalar *val; VecGetArray(fields[name]->mGlb, &val);
+    for (auto d: mDofs) { val[d] = *state++; }
+    VecRestoreArray(fields[name]->mGlb, &val);
+  }
+
+}
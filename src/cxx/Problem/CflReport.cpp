@@ -0,0 +1,124 @@
+#include <Problem/CflReport.h>
+#include <Problem/Problem.h>
+#include <Mesh/Mesh.h>
+#include <Utilities/Logging.h>
+#include <Utilities/Options.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+void CflReport::report(ElemVec const &elements, std::unique_ptr<Mesh> const &mesh,
+                       std::unique_ptr<Options> const &options) {
+
+  int rank, size;
+  MPI_Comm_rank(PETSC_COMM_WORLD, &rank); MPI_Comm_size(PETSC_COMM_WORLD, &size);
+  const PetscReal scale = Problem::TimeStepScale(options);
+  const bool file = !options->CflReportFile().empty();
+
+  /* Stable time step and location of the elements owned by this rank. */
+  std::vector<Entry> entries;
+  std::string lines;
+  char line[256];
+  for (auto &elm: elements) {
+    if (!mesh->ElementOwned(elm->Num())) { continue; }
+    Entry entry;
+    entry.dt = scale * elm->CFL_estimate();
+    const Eigen::VectorXd centre = elm->VtxCrd().colwise().mean();
+    for (PetscInt d = 0; d < 3; d++) { entry.centre[d] = d < centre.size() ? centre(d) : 0; }
+    entry.global = mesh->ElementGlobalNumber(elm->Num()); entry.rank = rank; entry.local = elm->Num();
+    std::strncpy(entry.type, elm->Name().c_str(), sizeof(entry.type) - 1);
+    entry.type[sizeof(entry.type) - 1] = '\0';
+    entries.push_back(entry);
+    if (file) {
+      std::snprintf(line, sizeof(line), "%d,%d,%d,%.9e,%.9e,%.9e,%.9e,%s\n", static_cast<int>(entry.global), rank,
+                    static_cast<int>(entry.local), entry.centre[0], entry.centre[1], entry.centre[2], entry.dt,
+                    entry.type);
+      lines += line;
+    }
+  }
+  if (file) { write(options->CflReportFile(), lines); }
+
+  /* Histogram in powers of two of the smallest step over all ranks. */
+  PetscReal dt_min = std::numeric_limits<PetscReal>::max();
+  for (auto &entry: entries) { dt_min = std::min(dt_min, entry.dt); }
+  MPI_Allreduce(MPI_IN_PLACE, &dt_min, 1, MPIU_REAL, MPI_MIN, PETSC_COMM_WORLD);
+  std::vector<PetscInt> bins(NumBins, 0);
+  for (auto &entry: entries) {
+    const PetscInt bin = std::isfinite(entry.dt) ? static_cast<PetscInt>(std::floor(std::log2(entry.dt / dt_min))) : 0;
+    bins[std::min(std::max<PetscInt>(bin, 0), NumBins - 1)]++;
+  }
+  MPI_Allreduce(MPI_IN_PLACE, bins.data(), NumBins, MPIU_INT, MPI_SUM, PETSC_COMM_WORLD);
+  PetscInt total = 0;
+  for (auto n: bins) { total += n; }
+  if (!total) { return; }
+  LOG() << "Stable time steps of the " << total << " elements (smallest " << dt_min << "):";
+  for (PetscInt b = 0; b < NumBins; b++) {
+    if (b < NumBins - 1) {
+      std::snprintf(line, sizeof(line), "  [%10.4e, %10.4e) %10d %6.2f %%", dt_min * (1 << b), dt_min * (2 << b),
+                    static_cast<int>(bins[b]), 100.0 * bins[b] / total);
+    } else {
+      std::snprintf(line, sizeof(line), "  [%10.4e,        ...) %10d %6.2f %%", dt_min * (1 << b),
+                    static_cast<int>(bins[b]), 100.0 * bins[b] / total);
+    }
+    LOG() << line;
+  }
+  if (!options->CflReport()) { return; }
+
+  /* The smallest steps of each rank, of which the first rank keeps the smallest overall. */
+  const size_t num = std::min<size_t>(options->CflReport(), entries.size());
+  auto smaller = [](const Entry &a, const Entry &b) { return a.dt < b.dt; };
+  std::partial_sort(entries.begin(), entries.begin() + num, entries.end(), smaller);
+  int bytes = num * sizeof(Entry);
+  std::vector<int> counts(rank ? 0 : size), offsets(rank ? 0 : size);
+  MPI_Gather(&bytes, 1, MPI_INT, counts.data(), 1, MPI_INT, 0, PETSC_COMM_WORLD);
+  std::vector<Entry> all;
+  if (!rank) {
+    for (int r = 1; r < size; r++) { offsets[r] = offsets[r - 1] + counts[r - 1]; }
+    all.resize((offsets[size - 1] + counts[size - 1]) / sizeof(Entry));
+  }
+  MPI_Gatherv(entries.data(), bytes, MPI_BYTE, all.data(), counts.data(), offsets.data(), MPI_BYTE, 0,
+              PETSC_COMM_WORLD);
+  if (rank) { return; }
+
+  std::sort(all.begin(), all.end(), smaller);
+  all.resize(std::min<size_t>(options->CflReport(), all.size()));
+  LOG() << "Elements with the smallest stable time step:";
+  std::snprintf(line, sizeof(line), "  %12s %10s %6s %8s %12s %12s %12s  %s",
+                "dt", "Global", "Rank", "Local", "x", "y", "z", "Type");
+  LOG() << line;
+  for (auto &entry: all) {
+    std::snprintf(line, sizeof(line), "  %12.4e %10d %6d %8d %12.4e %12.4e %12.4e  %s", entry.dt,
+                  static_cast<int>(entry.global), static_cast<int>(entry.rank), static_cast<int>(entry.local),
+                  entry.centre[0], entry.centre[1], entry.centre[2], entry.type);
+    LOG() << line;
+  }
+
+}
+
+void CflReport::write(const std::string &file, const std::string &lines) {
+
+  int rank, size;
+  MPI_Comm_rank(PETSC_COMM_WORLD, &rank); MPI_Comm_size(PETSC_COMM_WORLD, &size);
+  int length = lines.size();
+  std::vector<int> lengths(rank ? 0 : size), offsets(rank ? 0 : size);
+  MPI_Gather(&length, 1, MPI_INT, lengths.data(), 1, MPI_INT, 0, PETSC_COMM_WORLD);
+  std::string all;
+  if (!rank) {
+    for (int r = 1; r < size; r++) { offsets[r] = offsets[r - 1] + lengths[r - 1]; }
+    all.resize(offsets[size - 1] + lengths[size - 1]);
+  }
+  MPI_Gatherv(&lines[0], length, MPI_CHAR, &all[0], lengths.data(), offsets.data(), MPI_CHAR, 0,
+              PETSC_COMM_WORLD);
+  if (rank) { return; }
+
+  /* Only the first rank knows, so a file which can not be written does not stop the run. */
+  std::ofstream out(file);
+  if (!out) { LOG() << "Warning: could not open the CFL report file " << file << "."; return; }
+  out << "global,rank,local,x,y,z,dt,type\n" << all;
+  LOG() << "Wrote the stable time step of every element to " << file << ".";
+
+}
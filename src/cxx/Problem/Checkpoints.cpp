@@ -0,0 +1,174 @@
+#include <Problem/Checkpoints.h>
+#include <Utilities/Compression.h>
+#include <Utilities/Options.h>
+#include <Utilities/Logging.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+double Checkpoints::ReversibleSteps(const PetscInt num_slots, const PetscInt num_times) {
+  double beta = 1;
+  for (PetscInt i = 1; i <= num_slots; i++) { beta = beta * (num_times + i) / i; }
+  return beta;
+}
+
+/* Deliver the states last, ..., first, from the current state first, which is held by checkpoint num_total -
+ * num_slots. Each level stores a state in the next checkpoint, reverses the steps after it with one
+ * checkpoint less, and then those before it with the same checkpoints. The split is the largest which the
+ * fewer checkpoints reverse with as few recomputations as all steps need. */
+static void reverse(const PetscInt first, const PetscInt last, const PetscInt num_slots, const PetscInt num_total,
+                    std::vector<Checkpoints::Step> &schedule) {
+
+  const PetscInt slot = num_total - num_slots, num_steps = last - first;
+  if (!num_steps) { schedule.push_back({Checkpoints::Deliver, first}); return; }
+
+  /* A single checkpoint: recompute each state from it. */
+  if (num_slots == 1) {
+    for (PetscInt j = last; j >= first; j--) {
+      if (j != last) { schedule.push_back({Checkpoints::Restore, slot}); }
+      if (j != first) { schedule.push_back({Checkpoints::Advance, j}); }
+      schedule.push_back({Checkpoints::Deliver, j});
+    }
+    return;
+  }
+
+  PetscInt num_times = 1;
+  while (Checkpoints::ReversibleSteps(num_slots, num_times) < num_steps) { num_times++; }
+  const PetscInt tail = static_cast<PetscInt>(
+      std::min<double>(Checkpoints::ReversibleSteps(num_slots - 1, num_times), num_steps - 1));
+  const PetscInt split = last - tail;
+
+  schedule.push_back({Checkpoints::Advance, split});
+  schedule.push_back({Checkpoints::Store, slot + 1});
+  reverse(split, last, num_slots - 1, num_total, schedule);
+  schedule.push_back({Checkpoints::Restore, slot});
+  reverse(first, split - 1, num_slots, num_total, schedule);
+
+}
+
+std::vector<Checkpoints::Step> Checkpoints::Schedule(const PetscInt num_steps, const PetscInt num_slots) {
+  if (num_slots < 1) { throw std::runtime_error("Reversing a run takes at least one checkpoint."); }
+  std::vector<Step> schedule {{Store, 0}};
+  reverse(0, num_steps, num_slots, num_slots, schedule);
+  return schedule;
+}
+
+std::vector<std::string> Checkpoints::StateFields(FieldDict &fields) {
+  /* All fields but the inverse mass, and the accelerations which are summed anew each step. */
+  std::vector<std::string> state;
+  for (auto &name: fields.Names()) {
+    if (name == "mi" || name == "a" || name == "ax" || name == "ay" || name == "az") { continue; }
+    state.push_back(name);
+  }
+  return state;
+}
+
+Checkpoints::Checkpoints(std::unique_ptr<Options> const &options, FieldDict &fields) {
+
+  /* Each field of a state is a block of its own, compressed with --checkpoint-tolerance (if given). */
+  mTolerance = options->CheckpointTolerance();
+  mSize = 0;
+  mFields = StateFields(fields);
+  for (auto &name: mFields) {
+    PetscInt size; VecGetLocalSize(fields[name]->mGlb, &size);
+    mFieldSizes.push_back(size);
+    mSize += mTolerance ? Compression::Bytes(size, mTolerance) : size * sizeof(PetscScalar);
+  }
+
+  /* The same number of checkpoints on all ranks, as many as fit on the fullest. */
+  const double bytes = std::max<double>(mSize, 1);
+  long long num_memory = static_cast<long long>(options->CheckpointMemory() * 1024 * 1024 / bytes);
+  MPI_Allreduce(MPI_IN_PLACE, &num_memory, 1, MPI_LONG_LONG, MPI_MIN, PETSC_COMM_WORLD);
+  mNumDisk = options->CheckpointDiskSlots();
+
+  /* More than one per state is of no use. */
+  const PetscInt num_states = options->NumTimeSteps() + 1;
+  num_memory = std::min<long long>(num_memory, num_states);
+  mNumDisk = std::min<PetscInt>(mNumDisk, num_states - num_memory);
+  if (num_memory + mNumDisk < 1) {
+    throw std::runtime_error("Not a single checkpoint of " + std::to_string(bytes / (1024 * 1024)) +
+                             " MB fits into --checkpoint-memory. Give more, or --checkpoint-disk-slots.");
+  }
+  mMemory.assign(num_memory, std::vector<unsigned char>(mSize));
+  mTimeIdx.assign(NumSlots(), -1); mTime.assign(NumSlots(), 0);
+
+  if (mNumDisk) {
+    int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+    mDiskFile = options->CheckpointDir() + "/checkpoints." + std::to_string(rank) + ".bin";
+    mDisk.open(mDiskFile, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!mDisk) { throw std::runtime_error("Can't open checkpoint file '" + mDiskFile + "'."); }
+  }
+
+  LOG() << "Reversing " << options->NumTimeSteps() << " steps with " << num_memory
+        << " checkpoints in memory and " << mNumDisk << " on disk.";
+  if (mTolerance) {
+    LOG() << "Checkpoints are compressed to " << Compression::Bits(mTolerance) << " bits per value.";
+  }
+
+}
+
+Checkpoints::~Checkpoints() {
+  if (mDisk.is_open()) { mDisk.close(); std::remove(mDiskFile.c_str()); }
+}
+
+void Checkpoints::store(const PetscInt slot, const PetscInt time_idx, const PetscReal time, FieldDict &fields) {
+
+  std::vector<unsigned char> buf;
+  unsigned char *state;
+  if (slot < mNumDisk) { buf.resize(mSize); state = buf.data(); } else { state = mMemory[slot - mNumDisk].data(); }
+
+  for (size_t i = 0; i < mFields.size(); i++) {
+    const size_t size = mFieldSizes[i];
+    const PetscScalar *val; VecGetArrayRead(fields[mFields[i]]->mGlb, &val);
+    if (mTolerance) {
+      Compression::compress(val, size, mTolerance, state);
+      state += Compression::Bytes(size, mTolerance);
+    } else {
+      std::memcpy(state, val, size * sizeof(PetscScalar));
+      state += size * sizeof(PetscScalar);
+    }
+    VecRestoreArrayRead(fields[mFields[i]]->mGlb, &val);
+  }
+
+  if (slot < mNumDisk) {
+    mDisk.seekp(static_cast<std::streamoff>(slot) * mSize);
+    mDisk.write(reinterpret_cast<const char *>(buf.data()), mSize);
+    if (!mDisk) { throw std::runtime_error("Can't write checkpoint file '" + mDiskFile + "'."); }
+  }
+  mTimeIdx[slot] = time_idx; mTime[slot] = time;
+
+}
+
+void Checkpoints::restore(const PetscInt slot, PetscInt &time_idx, PetscReal &time, FieldDict &fields) {
+
+  if (mTimeIdx[slot] < 0) { throw std::runtime_error("Checkpoint " + std::to_string(slot) + " was not stored."); }
+
+  std::vector<unsigned char> buf;
+  const unsigned char *state;
+  if (slot < mNumDisk) {
+    buf.resize(mSize);
+    mDisk.seekg(static_cast<std::streamoff>(slot) * mSize);
+    mDisk.read(reinterpret_cast<char *>(buf.data()), mSize);
+    if (!mDisk) { throw std::runtime_error("Can't read checkpoint file '" + mDiskFile + "'."); }
+    state = buf.data();
+  } else {
+    state = mMemory[slot - mNumDisk].data();
+  }
+
+  for (size_t i = 0; i < mFields.size(); i++) {
+    const size_t size = mFieldSizes[i];
+    PetscScalar *val; VecGetArray(fields[mFields[i]]->mGlb, &val);
+    if (mTolerance) {
+      Compression::decompress(state, size, mTolerance, val);
+      state += Compression::Bytes(size, mTolerance);
+    } else {
+      std::memcpy(val, state, size * sizeof(PetscScalar));
+      state += size * sizeof(PetscScalar);
+    }
+    VecRestoreArray(fields[mFields[i]]->mGlb, &val);
+  }
+  time_idx = mTimeIdx[slot]; time = mTime[slot];
+  fields.SetFromRest(time_idx == 0);
+
+}
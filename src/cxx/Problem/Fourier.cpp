@@ -0,0 +1,105 @@
+#include <Problem/Fourier.h>
+#include <Problem/Movie.h>
+#include <Utilities/Options.h>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+Fourier::Fourier(std::unique_ptr<Options> const &shot) {
+
+  mFrequencies = shot->DftFrequencies(); mRegion = shot->DftRegion(); mFields = shot->DftFields();
+  mEvery = shot->DftEvery(); mTimeStep = shot->TimeStep();
+  mNumDim = 0; mNumComponents = 1;
+
+  /* The transform samples the fields every M dt. */
+  const PetscReal nyquist = 1 / (2 * mEvery * mTimeStep);
+  for (auto f: mFrequencies) {
+    if (f >= nyquist) {
+      throw std::runtime_error("--dft-frequencies must lie below the Nyquist frequency " + std::to_string(nyquist) +
+                               " of the sampling (1 / (2 --dft-every --time-step)).");
+    }
+  }
+
+}
+
+void Fourier::setup(ElemVec const &elements, DM PETScDM, PetscSection PETScSection, FieldDict &fields) {
+
+  /* The displacement of the physics, unless the fields are given. */
+  if (mFields.empty()) {
+    for (auto f: {"u", "ux", "uy", "uz"}) { if (fields.count(f)) { mFields.push_back(f); } }
+  }
+  for (auto &f: mFields) {
+    if (!fields.count(f)) { throw std::runtime_error("--dft-fields holds " + f + ", which is not registered."); }
+  }
+
+  DMGetDimension(PETScDM, &mNumDim);
+  PetscSectionGetFieldComponents(PETScSection, 0, &mNumComponents);
+  Movie::SelectDofs(elements, PETScDM, PETScSection, {}, 0, mRegion, mDofs, mCoordinates);
+
+  const PetscInt num_rows = mDofs.size() * mNumComponents;
+  mReal.assign(mFields.size(), RealMat::Zero(num_rows, mFrequencies.size()));
+  mImag.assign(mFields.size(), RealMat::Zero(num_rows, mFrequencies.size()));
+
+}
+
+void Fourier::accumulate(const PetscInt time_idx, const PetscReal time, FieldDict &fields) {
+
+  if (!Due(time_idx)) { return; }
+
+  /* Weights of this sample, exp(-2 pi i f t) M dt. */
+  const PetscReal dt = mEvery * mTimeStep;
+  RealVec cos_wgt(mFrequencies.size()), sin_wgt(mFrequencies.size());
+  for (size_t k = 0; k < mFrequencies.size(); k++) {
+    cos_wgt(k) = std::cos(2 * M_PI * mFrequencies[k] * time) * dt;
+    sin_wgt(k) = -std::sin(2 * M_PI * mFrequencies[k] * time) * dt;
+  }
+
+  /* One rank one update per field, on the selected dofs. */
+  RealVec buf(mDofs.size() * mNumComponents);
+  for (size_t i = 0; i < mFields.size(); i++) {
+    const PetscScalar *val; VecGetArrayRead(fields[mFields[i]]->mGlb, &val);
+    for (size_t j = 0; j < mDofs.size(); j++) {
+      for (PetscInt c = 0; c < mNumComponents; c++) { buf(j * mNumComponents + c) = val[mDofs[j] + c]; }
+    }
+    VecRestoreArrayRead(fields[mFields[i]]->mGlb, &val);
+    mReal[i].noalias() += buf * cos_wgt.transpose();
+    mImag[i].noalias() += buf * sin_wgt.transpose();
+  }
+
+}
+
+size_t Fourier::index(const std::string &field) const {
+  auto it = std::find(mFields.begin(), mFields.end(), field);
+  if (it == mFields.end()) { throw std::runtime_error("Field " + field + " is not transformed."); }
+  return it - mFields.begin();
+}
+
+void Fourier::write(const std::string &file) {
+
+  /* Rows of each rank, in rank order. */
+  unsigned long long num = mDofs.size(), offset = 0, total = 0;
+  MPI_Exscan(&num, &offset, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, PETSC_COMM_WORLD);
+  MPI_Allreduce(&num, &total, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, PETSC_COMM_WORLD);
+  int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+  const hsize_t row = rank ? offset : 0, nd = mNumDim, nc = mNumComponents, nf = mFrequencies.size();
+
+  hid_t plist_id = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fapl_mpio(plist_id, PETSC_COMM_WORLD, MPI_INFO_NULL);
+  hid_t file_id = H5Fcreate(file.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, plist_id);
+  H5Pclose(plist_id);
+
+  Movie::WriteRows(file_id, "/coordinates", {total, nd}, {row, 0}, {num, nd}, mCoordinates);
+  Movie::WriteRows(file_id, "/frequencies", {nf}, {0}, {nf},
+            rank ? std::vector<double>() : std::vector<double>(mFrequencies.begin(), mFrequencies.end()));
+
+  /* Frequency major, as the frames of a movie: the columns of the transforms. */
+  for (size_t i = 0; i < mFields.size(); i++) {
+    for (auto part: {std::make_pair("_real", &mReal[i]), std::make_pair("_imag", &mImag[i])}) {
+      std::vector<double> buf(part.second->data(), part.second->data() + part.second->size());
+      Movie::WriteRows(file_id, "/" + mFields[i] + part.first, {nf, total, nc}, {0, row, 0}, {nf, num, nc}, buf);
+    }
+  }
+
+  H5Fclose(file_id);
+
+}
@@ -0,0 +1,441 @@
+#include <Problem/HaloExchange.h>
+#include <Problem/HaloWire.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <set>
+#include <tuple>
+#include <utility>
+
+HaloExchange::HaloExchange(DM PETScDM, const PetscInt width, const Precision precision, const bool node_aware) {
+
+  mWidth = width; mPrecision = precision; mNodeAware = node_aware;
+  PetscMPIInt rank, size;
+  MPI_Comm_rank(PETSC_COMM_WORLD, &rank); MPI_Comm_size(PETSC_COMM_WORLD, &size);
+
+  /* The section's star forest has a leaf for every local dof, pointing at its owner's global dof. */
+  PetscSF sf; DMGetDefaultSF(PETScDM, &sf);
+  PetscInt num_roots, num_leaves; const PetscInt *leaf_loc; const PetscSFNode *leaf_rmt;
+  PetscSFGetGraph(sf, &num_roots, &num_leaves, &leaf_loc, &leaf_rmt);
+  CheckLocalIndex(std::max(num_roots, num_leaves), "dofs");
+
+  /* Split the leaves into owned dofs, and ghosts grouped by owner (ordered by the owner's index, which is the
+   * order in which the owner packs them). */
+  std::map<PetscMPIInt, std::vector<std::pair<PetscInt,PetscInt>>> ghosts;
+  for (PetscInt i = 0; i < num_leaves; i++) {
+    const PetscInt loc = leaf_loc ? leaf_loc[i] : i;
+    if (leaf_rmt[i].rank == rank) { mSelfLoc.push_back(loc); mSelfGlb.push_back(leaf_rmt[i].index); }
+    else { ghosts[leaf_rmt[i].rank].push_back(std::make_pair(leaf_rmt[i].index, loc)); }
+  }
+  std::vector<PetscMPIInt> num_ghost(size, 0), num_owned(size, 0);
+  std::vector<PetscInt> ghost_glb;
+  mGhostOff.assign(1, 0);
+  for (auto &g: ghosts) {
+    std::sort(g.second.begin(), g.second.end());
+    mGhostRank.push_back(g.first); num_ghost[g.first] = g.second.size();
+    for (auto &p: g.second) { ghost_glb.push_back(p.first); mGhostLoc.push_back(p.second); }
+    mGhostOff.push_back(mGhostLoc.size());
+  }
+
+  /* Tell the owners which of their dofs we ghost. This is only done once, so the all-to-all is fine. */
+  MPI_Alltoall(num_ghost.data(), 1, MPI_INT, num_owned.data(), 1, MPI_INT, PETSC_COMM_WORLD);
+  std::vector<PetscMPIInt> ghost_dsp(size, 0), owned_dsp(size, 0);
+  for (PetscMPIInt r = 1; r < size; r++) {
+    ghost_dsp[r] = ghost_dsp[r - 1] + num_ghost[r - 1]; owned_dsp[r] = owned_dsp[r - 1] + num_owned[r - 1];
+  }
+  std::vector<PetscInt> owned_glb(size ? owned_dsp[size - 1] + num_owned[size - 1] : 0);
+  MPI_Alltoallv(ghost_glb.data(), num_ghost.data(), ghost_dsp.data(), MPIU_INT,
+                owned_glb.data(), num_owned.data(), owned_dsp.data(), MPIU_INT, PETSC_COMM_WORLD);
+  mOwnedOff.assign(1, 0);
+  for (PetscMPIInt r = 0; r < size; r++) {
+    if (!num_owned[r]) continue;
+    mOwnedRank.push_back(r);
+    mOwnedGlb.insert(mOwnedGlb.end(), owned_glb.begin() + owned_dsp[r],
+                     owned_glb.begin() + owned_dsp[r] + num_owned[r]);
+    mOwnedOff.push_back(mOwnedGlb.size());
+  }
+
+  /* Every owned dof is also a local one. */
+  std::vector<PetscInt> glb_to_loc(num_roots, -1);
+  for (PetscInt i = 0; i < mSelfLoc.size(); i++) { glb_to_loc[mSelfGlb[i]] = mSelfLoc[i]; }
+  for (auto glb: mOwnedGlb) { mOwnedLoc.push_back(glb_to_loc[glb]); }
+  const size_t num_neighbours = mOwnedRank.size() + mGhostRank.size();
+  mSentBytes.assign(num_neighbours, 0); mRecvBytes.assign(num_neighbours, 0); mWaitSeconds.assign(num_neighbours, 0);
+
+  /* The buffers, with a segment of segmentBytes per neighbour. Node aware, they live in the window of the node
+   * instead. Halves (and their scales) travel as bytes. */
+  MPI_Datatype type = mPrecision == Single ? MPI_FLOAT : mPrecision == Half ? MPI_BYTE : MPIU_SCALAR;
+  const size_t unit = mPrecision == Single ? sizeof(float) : mPrecision == Half ? 1 : sizeof(PetscScalar);
+  if (mNodeAware) { setupNodeAware(type, unit); return; }
+  size_t owned_bytes = 0, ghost_bytes = 0;
+  for (PetscInt r = 0; r < mOwnedRank.size(); r++) { owned_bytes += segmentBytes(mOwnedOff[r + 1] - mOwnedOff[r]); }
+  for (PetscInt r = 0; r < mGhostRank.size(); r++) { ghost_bytes += segmentBytes(mGhostOff[r + 1] - mGhostOff[r]); }
+  mOwnedBuf.resize((owned_bytes + sizeof(PetscScalar) - 1) / sizeof(PetscScalar));
+  mGhostBuf.resize((ghost_bytes + sizeof(PetscScalar) - 1) / sizeof(PetscScalar));
+  char *owned_buf = reinterpret_cast<char *>(mOwnedBuf.data());
+  char *ghost_buf = reinterpret_cast<char *>(mGhostBuf.data());
+
+  /* Register the requests, once, on buffers which are never reallocated. Each message is received where the
+   * other side reads it from, in both directions, so both sets of buffers are the same. */
+  const PetscMPIInt scatter_tag = 0, gather_tag = 1;
+  for (PetscInt r = 0; r < mOwnedRank.size(); r++) {
+    char *buf = owned_buf; owned_buf += segmentBytes(mOwnedOff[r + 1] - mOwnedOff[r]);
+    PetscMPIInt cnt = segmentBytes(mOwnedOff[r + 1] - mOwnedOff[r]) / unit;
+    mScatterReq.emplace_back(); mGatherReq.emplace_back();
+    MPI_Send_init(buf, cnt, type, mOwnedRank[r], scatter_tag, PETSC_COMM_WORLD, &mScatterReq.back());
+    MPI_Recv_init(buf, cnt, type, mOwnedRank[r], gather_tag, PETSC_COMM_WORLD, &mGatherReq.back());
+    for (auto p: {0, 1}) { mOwnedSeg[p].push_back(buf); mGatherIn[p].push_back(buf); }
+  }
+  for (PetscInt r = 0; r < mGhostRank.size(); r++) {
+    char *buf = ghost_buf; ghost_buf += segmentBytes(mGhostOff[r + 1] - mGhostOff[r]);
+    PetscMPIInt cnt = segmentBytes(mGhostOff[r + 1] - mGhostOff[r]) / unit;
+    mScatterReq.emplace_back(); mGatherReq.emplace_back();
+    MPI_Recv_init(buf, cnt, type, mGhostRank[r], scatter_tag, PETSC_COMM_WORLD, &mScatterReq.back());
+    MPI_Send_init(buf, cnt, type, mGhostRank[r], gather_tag, PETSC_COMM_WORLD, &mGatherReq.back());
+    for (auto p: {0, 1}) { mGhostSeg[p].push_back(buf); mScatterIn[p].push_back(buf); }
+  }
+
+}
+
+size_t HaloExchange::segmentBytes(const PetscInt num) const {
+  if (mPrecision == Half) { return HalfWire::bytes(num, mWidth); }
+  if (mPrecision == Single) { return PlainWire<float>::bytes(num, mWidth); }
+  return PlainWire<PetscScalar>::bytes(num, mWidth);
+}
+
+void HaloExchange::setupNodeAware(MPI_Datatype type, const size_t unit) {
+
+  PetscMPIInt rank, size;
+  MPI_Comm_rank(PETSC_COMM_WORLD, &rank); MPI_Comm_size(PETSC_COMM_WORLD, &size);
+  MPI_Comm_split_type(PETSC_COMM_WORLD, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &mNode);
+  PetscMPIInt node_rank, node_size; MPI_Comm_rank(mNode, &node_rank); MPI_Comm_size(mNode, &node_size);
+
+  /* The node of every rank, named by its first rank, and the ranks of each node (in rank order). */
+  PetscMPIInt node = rank; MPI_Allreduce(MPI_IN_PLACE, &node, 1, MPI_INT, MPI_MIN, mNode);
+  std::vector<PetscMPIInt> node_of(size);
+  MPI_Allgather(&node, 1, MPI_INT, node_of.data(), 1, MPI_INT, PETSC_COMM_WORLD);
+  std::map<PetscMPIInt, std::vector<PetscMPIInt>> ranks_on;
+  for (PetscMPIInt r = 0; r < size; r++) { ranks_on[node_of[r]].push_back(r); }
+  const std::vector<PetscMPIInt> &mine = ranks_on[node];
+
+  /* The neighbours of all ranks of the node, as (rank, number of dofs), owned ones first. */
+  std::vector<PetscMPIInt> lists;
+  for (PetscInt r = 0; r < mOwnedRank.size(); r++) {
+    lists.push_back(mOwnedRank[r]); lists.push_back(mOwnedOff[r + 1] - mOwnedOff[r]);
+  }
+  for (PetscInt r = 0; r < mGhostRank.size(); r++) {
+    lists.push_back(mGhostRank[r]); lists.push_back(mGhostOff[r + 1] - mGhostOff[r]);
+  }
+  PetscMPIInt counts[2] = {static_cast<PetscMPIInt>(mOwnedRank.size()), static_cast<PetscMPIInt>(mGhostRank.size())};
+  std::vector<PetscMPIInt> all_counts(2 * node_size), lens(node_size), dsp(node_size, 0);
+  MPI_Allgather(counts, 2, MPI_INT, all_counts.data(), 2, MPI_INT, mNode);
+  for (PetscMPIInt j = 0; j < node_size; j++) {
+    lens[j] = 2 * (all_counts[2 * j] + all_counts[2 * j + 1]);
+    if (j) { dsp[j] = dsp[j - 1] + lens[j - 1]; }
+  }
+  std::vector<PetscMPIInt> all_lists(dsp[node_size - 1] + lens[node_size - 1]);
+  MPI_Allgatherv(lists.data(), lists.size(), MPI_INT, all_lists.data(), lens.data(), dsp.data(), MPI_INT, mNode);
+
+  /* Each rank's two sets of buffers, one after the other: its owned and its ghost buffer, each with the segment
+   * of every neighbour in rank order (as above), at these byte offsets into the window. */
+  std::vector<std::map<PetscMPIInt, MPI_Aint>> owned_at(node_size), ghost_at(node_size);
+  std::vector<MPI_Aint> set_bytes(node_size);
+  MPI_Aint total = 0;
+  for (PetscMPIInt j = 0; j < node_size; j++) {
+    const PetscMPIInt *list = all_lists.data() + dsp[j];
+    MPI_Aint at = total;
+    for (PetscMPIInt k = 0; k < all_counts[2 * j] + all_counts[2 * j + 1]; k++) {
+      (k < all_counts[2 * j] ? owned_at : ghost_at)[j][list[2 * k]] = at;
+      at += segmentBytes(list[2 * k + 1]);
+    }
+    set_bytes[j] = at - total; total += 2 * set_bytes[j];
+  }
+
+  /* The window, allocated by the first rank of the node, and seen by all at the same base. */
+  char *base; MPI_Aint seg_size; int disp_unit;
+  MPI_Win_allocate_shared(node_rank ? 0 : total, 1, MPI_INFO_NULL, mNode, &base, &mWin);
+  MPI_Win_shared_query(mWin, 0, &seg_size, &disp_unit, &base);
+  MPI_Win_fence(0, mWin);
+
+  /* Our own segments, and where to read those sent to us: from a neighbour's buffer on the node, or from our
+   * own, where the message from its node arrives. */
+  auto local = [&](const PetscMPIInt r) { return std::find(mine.begin(), mine.end(), r) - mine.begin(); };
+  for (PetscInt p: {0, 1}) {
+    for (PetscInt r = 0; r < mOwnedRank.size(); r++) {
+      mOwnedSeg[p].push_back(base + owned_at[node_rank][mOwnedRank[r]] + p * set_bytes[node_rank]);
+      const bool near = node_of[mOwnedRank[r]] == node;
+      const PetscMPIInt j = near ? local(mOwnedRank[r]) : node_rank;
+      mGatherIn[p].push_back(near ? base + ghost_at[j][rank] + p * set_bytes[j] : mOwnedSeg[p].back());
+    }
+    for (PetscInt r = 0; r < mGhostRank.size(); r++) {
+      mGhostSeg[p].push_back(base + ghost_at[node_rank][mGhostRank[r]] + p * set_bytes[node_rank]);
+      const bool near = node_of[mGhostRank[r]] == node;
+      const PetscMPIInt j = near ? local(mGhostRank[r]) : node_rank;
+      mScatterIn[p].push_back(near ? base + owned_at[j][rank] + p * set_bytes[j] : mGhostSeg[p].back());
+    }
+  }
+
+  /* One message per direction between two nodes, holding the segments of all pairs of their ranks ordered by
+   * (sender, receiver), on both sides. Those from and to another node are sent and received by the rank of the
+   * node picked by the number of that node. */
+  std::set<PetscMPIInt> others;
+  for (size_t k = 0; k < all_lists.size(); k += 2) {
+    if (node_of[all_lists[k]] != node) { others.insert(node_of[all_lists[k]]); }
+  }
+  typedef std::vector<std::tuple<PetscMPIInt, PetscMPIInt, MPI_Aint, PetscMPIInt>> Segments;
+  auto message = [&](Segments &segs, const bool send, const PetscMPIInt peer, const PetscMPIInt tag,
+                     std::vector<MPI_Request> &req) {
+    /* Both sides see the same segments, so an empty message is skipped on both. */
+    if (segs.empty()) { return; }
+    std::sort(segs.begin(), segs.end());
+    std::vector<int> len; std::vector<MPI_Aint> at;
+    for (auto &seg: segs) { at.push_back(std::get<2>(seg)); len.push_back(segmentBytes(std::get<3>(seg)) / unit); }
+    MPI_Datatype indexed;
+    MPI_Type_create_hindexed(segs.size(), len.data(), at.data(), type, &indexed);
+    MPI_Type_commit(&indexed); mNodeTypes.push_back(indexed);
+    req.emplace_back();
+    if (send) { MPI_Send_init(base, 1, indexed, peer, tag, PETSC_COMM_WORLD, &req.back()); }
+    else { MPI_Recv_init(base, 1, indexed, peer, tag, PETSC_COMM_WORLD, &req.back()); }
+  };
+  const PetscMPIInt scatter_tag = 2, gather_tag = 3;
+  for (auto other: others) {
+    const std::vector<PetscMPIInt> &theirs = ranks_on[other];
+    if (mine[other % node_size] != rank) { continue; }
+    const PetscMPIInt peer = theirs[node % theirs.size()];
+    for (PetscInt p: {0, 1}) {
+      /* (sender, receiver, offset, number of dofs) of each segment, for the scatter (the owned buffers out, the
+       * ghost ones in) and the gather (the other way around). */
+      Segments owned_out, ghost_in, ghost_out, owned_in;
+      for (PetscMPIInt j = 0; j < node_size; j++) {
+        const PetscMPIInt *list = all_lists.data() + dsp[j];
+        for (PetscMPIInt k = 0; k < all_counts[2 * j] + all_counts[2 * j + 1]; k++) {
+          const PetscMPIInt r = list[2 * k], num = list[2 * k + 1];
+          if (node_of[r] != other) { continue; }
+          if (k < all_counts[2 * j]) {
+            const MPI_Aint at = owned_at[j][r] + p * set_bytes[j];
+            owned_out.push_back(std::make_tuple(mine[j], r, at, num));
+            owned_in.push_back(std::make_tuple(r, mine[j], at, num));
+          } else {
+            const MPI_Aint at = ghost_at[j][r] + p * set_bytes[j];
+            ghost_out.push_back(std::make_tuple(mine[j], r, at, num));
+            ghost_in.push_back(std::make_tuple(r, mine[j], at, num));
+          }
+        }
+      }
+      message(owned_out, true, peer, scatter_tag, mNodeScatterReq[p]);
+      message(ghost_in, false, peer, scatter_tag, mNodeScatterReq[p]);
+      message(ghost_out, true, peer, gather_tag, mNodeGatherReq[p]);
+      message(owned_in, false, peer, gather_tag, mNodeGatherReq[p]);
+    }
+  }
+
+}
+
+HaloExchange::~HaloExchange() {
+  for (auto &req: mScatterReq) { MPI_Request_free(&req); }
+  for (auto &req: mGatherReq) { MPI_Request_free(&req); }
+  for (PetscInt p: {0, 1}) {
+    for (auto &req: mNodeScatterReq[p]) { MPI_Request_free(&req); }
+    for (auto &req: mNodeGatherReq[p]) { MPI_Request_free(&req); }
+  }
+  for (auto &type: mNodeTypes) { MPI_Type_free(&type); }
+  if (mWin != MPI_WIN_NULL) { MPI_Win_free(&mWin); }
+  if (mNode != MPI_COMM_NULL) { MPI_Comm_free(&mNode); }
+}
+
+std::vector<PetscMPIInt> HaloExchange::Neighbours() const {
+  std::set<PetscMPIInt> ranks(mOwnedRank.begin(), mOwnedRank.end());
+  ranks.insert(mGhostRank.begin(), mGhostRank.end());
+  return std::vector<PetscMPIInt>(ranks.begin(), ranks.end());
+}
+
+PetscInt HaloExchange::NumShared() const {
+  return std::set<PetscInt>(mOwnedLoc.begin(), mOwnedLoc.end()).size();
+}
+
+void HaloExchange::traffic(std::vector<double> &sent, std::vector<double> &received,
+                           std::vector<double> &waited) const {
+  const std::vector<PetscMPIInt> ranks = Neighbours();
+  sent.assign(ranks.size(), 0); received.assign(ranks.size(), 0); waited.assign(ranks.size(), 0);
+  for (size_t k = 0; k < mSentBytes.size(); k++) {
+    const PetscMPIInt r = k < mOwnedRank.size() ? mOwnedRank[k] : mGhostRank[k - mOwnedRank.size()];
+    const size_t n = std::lower_bound(ranks.begin(), ranks.end(), r) - ranks.begin();
+    sent[n] += mSentBytes[k]; received[n] += mRecvBytes[k]; waited[n] += mWaitSeconds[k];
+  }
+}
+
+void HaloExchange::start(const bool scatter) {
+  /* The owners send their segments in a scatter, and the ghosts theirs in a gather. */
+  const size_t num_owned = mOwnedRank.size();
+  for (size_t r = 0; r < num_owned; r++) {
+    (scatter ? mSentBytes : mRecvBytes)[r] += segmentBytes(mOwnedOff[r + 1] - mOwnedOff[r]);
+  }
+  for (size_t r = 0; r < mGhostRank.size(); r++) {
+    (scatter ? mRecvBytes : mSentBytes)[num_owned + r] += segmentBytes(mGhostOff[r + 1] - mGhostOff[r]);
+  }
+  if (!mNodeAware) { auto &req = scatter ? mScatterReq : mGatherReq; MPI_Startall(req.size(), req.data()); return; }
+  /* Everything of the node is packed before any of it is read or sent. */
+  MPI_Win_fence(0, mWin);
+  auto &req = scatter ? mNodeScatterReq[mParity] : mNodeGatherReq[mParity];
+  MPI_Startall(req.size(), req.data());
+}
+
+void HaloExchange::finish(const bool scatter) {
+  if (!mNodeAware) {
+    auto &req = scatter ? mScatterReq : mGatherReq;
+    if (!mTimeWaits) { MPI_Waitall(req.size(), req.data(), MPI_STATUSES_IGNORE); return; }
+    /* One by one, each neighbour taking the time until its messages completed. Completed requests turn inactive,
+     * which MPI_Waitany skips. */
+    const auto begin = std::chrono::steady_clock::now();
+    for (size_t k = 0; k < req.size(); k++) {
+      int done; MPI_Waitany(req.size(), req.data(), &done, MPI_STATUS_IGNORE);
+      if (done == MPI_UNDEFINED) { break; }
+      mWaitSeconds[done] += std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    }
+    return;
+  }
+  /* The messages of the node are received by several of its ranks, and all of them read them. */
+  auto &req = scatter ? mNodeScatterReq[mParity] : mNodeGatherReq[mParity];
+  MPI_Waitall(req.size(), req.data(), MPI_STATUSES_IGNORE);
+  MPI_Win_fence(0, mWin);
+}
+
+/* Call an exchange on the buffers of our precision. */
+#define SALVUS_HALO_AS(call, ...) \
+  switch (mPrecision) { \
+    case Single: call<PlainWire<float>>(__VA_ARGS__); break; \
+    case Half: call<HalfWire>(__VA_ARGS__); break; \
+    default: call<PlainWire<PetscScalar>>(__VA_ARGS__); \
+  }
+
+void HaloExchange::scatter(const std::vector<const PetscScalar*> &glb, const std::vector<PetscScalar*> &loc) {
+  SALVUS_HALO_AS(scatterAs, glb, loc);
+}
+
+void HaloExchange::gatherBegin(const std::vector<const PetscScalar*> &loc, const std::vector<PetscScalar*> &glb) {
+  SALVUS_HALO_AS(gatherBeginAs, loc, glb, true);
+}
+
+void HaloExchange::gatherEnd(const std::vector<PetscScalar*> &glb) {
+  SALVUS_HALO_AS(gatherEndAs, glb);
+}
+
+void HaloExchange::reduceBegin(const std::vector<PetscScalar*> &loc) {
+  /* The same as a gather, without the copy of our own dofs. */
+  const std::vector<const PetscScalar*> read(loc.begin(), loc.end());
+  std::vector<PetscScalar*> none;
+  SALVUS_HALO_AS(gatherBeginAs, read, none, false);
+}
+
+void HaloExchange::reduceEnd(const std::vector<PetscScalar*> &loc) {
+  SALVUS_HALO_AS(reduceEndAs, loc);
+}
+
+void HaloExchange::refresh(const std::vector<PetscScalar*> &loc) {
+  SALVUS_HALO_AS(refreshAs, loc);
+}
+
+#undef SALVUS_HALO_AS
+
+void HaloExchange::copyOwned(const std::vector<const PetscScalar*> &loc, const std::vector<PetscScalar*> &glb) {
+  for (PetscInt i = 0; i < mSelfLoc.size(); i++) {
+    for (size_t f = 0; f < loc.size(); f++) { glb[f][mSelfGlb[i]] = loc[f][mSelfLoc[i]]; }
+  }
+}
+
+template <typename T>
+void HaloExchange::scatterAs(const std::vector<const PetscScalar*> &glb, const std::vector<PetscScalar*> &loc) {
+
+  /* Pack the owned dofs ghosted elsewhere, and send them off. */
+  next();
+  for (PetscInt r = 0; r < mOwnedRank.size(); r++) {
+    const LocalInt *glb_idx = mOwnedGlb.data() + mOwnedOff[r];
+    T::pack(mOwnedSeg[mParity][r], mOwnedOff[r + 1] - mOwnedOff[r], mWidth,
+            [&](const PetscInt i, const PetscInt f) { return glb[f][glb_idx[i]]; });
+  }
+  start(true);
+
+  /* Copy our own dofs in the meantime. */
+  for (PetscInt i = 0; i < mSelfLoc.size(); i++) {
+    for (PetscInt f = 0; f < mWidth; f++) { loc[f][mSelfLoc[i]] = glb[f][mSelfGlb[i]]; }
+  }
+
+  /* Unpack the ghosts. */
+  finish(true);
+  for (PetscInt r = 0; r < mGhostRank.size(); r++) {
+    const LocalInt *loc_idx = mGhostLoc.data() + mGhostOff[r];
+    T::unpack(mScatterIn[mParity][r], mGhostOff[r + 1] - mGhostOff[r], mWidth,
+              [&](const PetscInt i, const PetscInt f, const PetscScalar v) { loc[f][loc_idx[i]] = v; });
+  }
+
+}
+
+template <typename T>
+void HaloExchange::gatherBeginAs(const std::vector<const PetscScalar*> &loc, const std::vector<PetscScalar*> &glb,
+                                 const bool add_self) {
+
+  /* Pack the contributions to ghosts, and send them to their owners. */
+  next();
+  for (PetscInt r = 0; r < mGhostRank.size(); r++) {
+    const LocalInt *loc_idx = mGhostLoc.data() + mGhostOff[r];
+    T::pack(mGhostSeg[mParity][r], mGhostOff[r + 1] - mGhostOff[r], mWidth,
+            [&](const PetscInt i, const PetscInt f) { return loc[f][loc_idx[i]]; });
+  }
+  start(false);
+
+  /* Add the contributions to our own dofs. */
+  if (!add_self) { return; }
+  for (PetscInt i = 0; i < mSelfLoc.size(); i++) {
+    for (PetscInt f = 0; f < mWidth; f++) { glb[f][mSelfGlb[i]] += loc[f][mSelfLoc[i]]; }
+  }
+
+}
+
+template <typename T>
+void HaloExchange::gatherEndAs(const std::vector<PetscScalar*> &glb) {
+
+  /* Add what the other ranks contributed to our dofs. A dof ghosted by several ranks appears once per rank. */
+  finish(false);
+  for (PetscInt r = 0; r < mOwnedRank.size(); r++) {
+    const LocalInt *glb_idx = mOwnedGlb.data() + mOwnedOff[r];
+    T::unpack(mGatherIn[mParity][r], mOwnedOff[r + 1] - mOwnedOff[r], mWidth,
+              [&](const PetscInt i, const PetscInt f, const PetscScalar v) { glb[f][glb_idx[i]] += v; });
+  }
+
+}
+
+template <typename T>
+void HaloExchange::reduceEndAs(const std::vector<PetscScalar*> &loc) {
+
+  /* Add what the other ranks contributed to our dofs. */
+  finish(false);
+  for (PetscInt r = 0; r < mOwnedRank.size(); r++) {
+    const LocalInt *loc_idx = mOwnedLoc.data() + mOwnedOff[r];
+    T::unpack(mGatherIn[mParity][r], mOwnedOff[r + 1] - mOwnedOff[r], mWidth,
+              [&](const PetscInt i, const PetscInt f, const PetscScalar v) { loc[f][loc_idx[i]] += v; });
+  }
+
+  /* Send the sums back to the ghosts. */
+  refreshAs<T>(loc);
+
+}
+
+template <typename T>
+void HaloExchange::refreshAs(const std::vector<PetscScalar*> &loc) {
+
+  next();
+  for (PetscInt r = 0; r < mOwnedRank.size(); r++) {
+    const LocalInt *loc_idx = mOwnedLoc.data() + mOwnedOff[r];
+    T::pack(mOwnedSeg[mParity][r], mOwnedOff[r + 1] - mOwnedOff[r], mWidth,
+            [&](const PetscInt i, const PetscInt f) { return loc[f][loc_idx[i]]; });
+  }
+  start(true);
+  finish(true);
+  for (PetscInt r = 0; r < mGhostRank.size(); r++) {
+    const LocalInt *loc_idx = mGhostLoc.data() + mGhostOff[r];
+    T::unpack(mScatterIn[mParity][r], mGhostOff[r + 1] - mGhostOff[r], mWidth,
+              [&](const PetscInt i, const PetscInt f, const PetscScalar v) { loc[f][loc_idx[i]] = v; });
+  }
+
+}
@@ -0,0 +1,245 @@
+#include <Problem/HangingNodes.h>
+#include <Element/Element.h>
+#include <Mesh/Mesh.h>
+#include <Utilities/Logging.h>
+#include <Utilities/StaticKdTree.h>
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <stdexcept>
+
+std::unique_ptr<HangingNodes> HangingNodes::Build(ElemVec const &elements, std::unique_ptr<Mesh> const &mesh) {
+
+  int rank, size;
+  MPI_Comm_rank(PETSC_COMM_WORLD, &rank); MPI_Comm_size(PETSC_COMM_WORLD, &size);
+  DM dm = mesh->DistributedMesh();
+  const PetscInt dim = mesh->NumberDimensions();
+  const PetscInt nc = mesh->NumberComponents();
+  if (!elements.empty() && elements[0]->Name().find("Quad") == std::string::npos &&
+      elements[0]->Name().find("Hex") == std::string::npos) {
+    throw std::runtime_error("--hanging-nodes requires a mesh of quads or hexes, not " +
+                             elements[0]->Name() + ".");
+  }
+
+  /* Global (block) index of every element's dofs, pulled through the closure as in the assembly plan. */
+  Vec glb, loc; DMGetGlobalVector(dm, &glb); DMGetLocalVector(dm, &loc);
+  PetscInt start, num_glb; VecGetOwnershipRange(glb, &start, NULL); VecGetLocalSize(glb, &num_glb);
+  PetscScalar *val; VecGetArray(glb, &val);
+  for (PetscInt i = 0; i < num_glb; i++) { val[i] = start + i; }
+  VecRestoreArray(glb, &val);
+  DMGlobalToLocalBegin(dm, glb, INSERT_VALUES, loc);
+  DMGlobalToLocalEnd(dm, glb, INSERT_VALUES, loc);
+  std::vector<std::vector<PetscInt>> elm_dof(elements.size());
+  for (size_t e = 0; e < elements.size(); e++) {
+    const auto &closure = elements[e]->ClsMap();
+    PetscScalar *cls = NULL; PetscInt csize;
+    DMPlexVecGetClosure(dm, mesh->MeshSection(), loc, elements[e]->Num(), &csize, &cls);
+    elm_dof[e].resize(closure.size());
+    for (PetscInt i = 0; i < closure.size(); i++) {
+      elm_dof[e][closure(i)] = static_cast<PetscInt> (PetscRealPart(cls[i * nc]) + 0.5) / nc;
+    }
+    DMPlexVecRestoreClosure(dm, mesh->MeshSection(), loc, elements[e]->Num(), NULL, &cls);
+  }
+  DMRestoreLocalVector(dm, &loc);
+
+  /* Faces of the local elements without a neighbour, which are not on a side set. This includes the faces on
+   * the boundary of the partition, which simply find no larger face to hang on. */
+  Vec coord; DMGetCoordinatesLocal(dm, &coord);
+  PetscSection coord_section; DMGetCoordinateSection(dm, &coord_section);
+  std::vector<Face> faces;
+  for (size_t e = 0; e < elements.size(); e++) {
+    PetscInt csize; DMPlexGetConeSize(dm, elements[e]->Num(), &csize);
+    const PetscInt *cone; DMPlexGetCone(dm, elements[e]->Num(), &cone);
+    for (PetscInt i = 0; i < csize; i++) {
+      PetscInt ssize; DMPlexGetSupportSize(dm, cone[i], &ssize);
+      if (ssize != 1) { continue; }
+      bool side_set = false;
+      for (PetscInt s = 0; s < mesh->NumberSideSets(); s++) { side_set |= mesh->OnSideSet(cone[i], s); }
+      if (side_set) { continue; }
+
+      PetscInt num_crd; PetscReal *crd = NULL;
+      DMPlexVecGetClosure(dm, coord_section, coord, cone[i], &num_crd, &crd);
+      Face face; face.rank = rank; face.element = e;
+      for (PetscInt d = 0; d < 3; d++) {
+        face.min[d] = face.max[d] = face.centre[d] = face.normal[d] = 0;
+        if (d >= dim) { continue; }
+        face.min[d] = crd[d]; face.max[d] = crd[d];
+        for (PetscInt v = 0; v < num_crd / dim; v++) {
+          face.min[d] = std::min(face.min[d], crd[v * dim + d]);
+          face.max[d] = std::max(face.max[d], crd[v * dim + d]);
+          face.centre[d] += crd[v * dim + d] / (num_crd / dim);
+        }
+      }
+      /* Normal of the edge, or of the face through its first three vertices. */
+      double a[3] = {0, 0, 0}, b[3] = {0, 0, 0};
+      for (PetscInt d = 0; d < dim; d++) {
+        a[d] = crd[dim + d] - crd[d]; b[d] = dim == 3 ? crd[2 * dim + d] - crd[d] : 0;
+      }
+      DMPlexVecRestoreClosure(dm, coord_section, coord, cone[i], &num_crd, &crd);
+      if (dim == 2) { face.normal[0] = -a[1]; face.normal[1] = a[0]; }
+      else {
+        face.normal[0] = a[1] * b[2] - a[2] * b[1];
+        face.normal[1] = a[2] * b[0] - a[0] * b[2];
+        face.normal[2] = a[0] * b[1] - a[1] * b[0];
+      }
+      const double norm = std::sqrt(face.normal[0] * face.normal[0] + face.normal[1] * face.normal[1] +
+                                    face.normal[2] * face.normal[2]);
+      face.size = 0;
+      for (PetscInt d = 0; d < 3; d++) {
+        face.normal[d] /= norm; face.size += (face.max[d] - face.min[d]) * (face.max[d] - face.min[d]);
+      }
+      face.size = std::sqrt(face.size);
+      faces.push_back(face);
+    }
+  }
+
+  /* All candidate faces, from all ranks. These are only the faces on the surface of the partitions. */
+  int num_bytes = faces.size() * sizeof(Face);
+  std::vector<int> lens(size), dsp(size, 0);
+  MPI_Allgather(&num_bytes, 1, MPI_INT, lens.data(), 1, MPI_INT, PETSC_COMM_WORLD);
+  for (int r = 1; r < size; r++) { dsp[r] = dsp[r - 1] + lens[r - 1]; }
+  std::vector<Face> all((dsp[size - 1] + lens[size - 1]) / sizeof(Face));
+  MPI_Allgatherv(faces.data(), num_bytes, MPI_BYTE, all.data(), lens.data(), dsp.data(), MPI_BYTE,
+                 PETSC_COMM_WORLD);
+
+  /* Match each fine face of this rank to the coarse face it lies on: a face at least 1.5 times as large, in
+   * whose plane the fine face lies, and whose bounding box holds it. The fine face's centre is within half a
+   * diagonal of the coarse one's. */
+  std::vector<PetscReal> centres;
+  for (auto &f: faces) { centres.insert(centres.end(), f.centre, f.centre + 3); }
+  StaticKdTree tree;
+  if (!faces.empty()) { tree.build(3, centres.data(), faces.size()); }
+  auto plane = [](const Face &g, const double *x) {
+    double dist = 0;
+    for (PetscInt d = 0; d < 3; d++) { dist += (x[d] - g.centre[d]) * g.normal[d]; }
+    return std::abs(dist);
+  };
+  std::vector<std::set<std::pair<PetscInt, PetscInt>>> sent(size);
+  std::vector<std::vector<Node>> send(size);
+  std::vector<PetscInt> found;
+  for (auto &g: all) {
+    if (faces.empty()) { break; }
+    const double tol = 1e-6 * g.size;
+    tree.within(g.centre, 0.5 * g.size + tol, found);
+    for (auto i: found) {
+      const Face &f = faces[i];
+      if (1.5 * f.size > g.size || plane(g, f.centre) > tol) { continue; }
+      bool inside = true;
+      for (PetscInt d = 0; d < 3; d++) { inside &= f.min[d] > g.min[d] - tol && f.max[d] < g.max[d] + tol; }
+      if (!inside) { continue; }
+
+      /* The nodes of the fine element on the fine face hang on the coarse element. */
+      const Eigen::MatrixXd nodes = elements[f.element]->NodalCoordinates();
+      for (PetscInt n = 0; n < nodes.rows(); n++) {
+        Node node;
+        for (PetscInt d = 0; d < 3; d++) { node.x[d] = d < dim ? nodes(n, d) : 0; }
+        bool on_face = plane(g, node.x) < tol;
+        for (PetscInt d = 0; d < 3; d++) { on_face &= node.x[d] > f.min[d] - tol && node.x[d] < f.max[d] + tol; }
+        if (!on_face) { continue; }
+        node.dof = elm_dof[f.element][n]; node.element = g.element;
+        if (sent[g.rank].insert(std::make_pair(node.element, node.dof)).second) { send[g.rank].push_back(node); }
+      }
+    }
+  }
+
+  /* Send the hanging nodes to the ranks of their coarse elements. This is only done once, so the all-to-all
+   * is fine. */
+  std::vector<int> num_send(size), num_recv(size), send_dsp(size, 0), recv_dsp(size, 0);
+  std::vector<Node> send_buf;
+  for (int r = 0; r < size; r++) {
+    num_send[r] = send[r].size() * sizeof(Node);
+    send_buf.insert(send_buf.end(), send[r].begin(), send[r].end());
+  }
+  MPI_Alltoall(num_send.data(), 1, MPI_INT, num_recv.data(), 1, MPI_INT, PETSC_COMM_WORLD);
+  for (int r = 1; r < size; r++) {
+    send_dsp[r] = send_dsp[r - 1] + num_send[r - 1]; recv_dsp[r] = recv_dsp[r - 1] + num_recv[r - 1];
+  }
+  std::vector<Node> recv_buf((recv_dsp[size - 1] + num_recv[size - 1]) / sizeof(Node));
+  MPI_Alltoallv(send_buf.data(), num_send.data(), send_dsp.data(), MPI_BYTE,
+                recv_buf.data(), num_recv.data(), recv_dsp.data(), MPI_BYTE, PETSC_COMM_WORLD);
+
+  /* The weights of each hanging node are the coarse element's basis at its location. A node at a dof of the
+   * coarse element (i.e. on a shared vertex) does not hang. Several coarse faces may hold the same node (on
+   * their shared edge), with the same weights, so the rows are inserted rather than added. */
+  std::unique_ptr<HangingNodes> hanging(new HangingNodes());
+  MatCreateAIJ(PETSC_COMM_WORLD, num_glb, num_glb, PETSC_DETERMINE, PETSC_DETERMINE, 0, NULL, 0, NULL,
+               &hanging->mWeights);
+  MatSetOption(hanging->mWeights, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);
+  std::vector<PetscInt> cols; std::vector<PetscScalar> vals;
+  for (auto &node: recv_buf) {
+    const std::vector<PetscInt> &masters = elm_dof[node.element];
+    if (std::find(masters.begin(), masters.end(), node.dof) != masters.end()) { continue; }
+    const Eigen::Map<const Eigen::VectorXd> x(node.x, dim);
+    const Eigen::MatrixXd w = elements[node.element]->interpolateFieldAtPoint(x);
+    if (std::abs(w.sum() - 1) > 1e-6) {
+      throw std::runtime_error("The weights of a hanging node of element " +
+                               std::to_string(elements[node.element]->Num()) + " do not sum to one.");
+    }
+    for (PetscInt c = 0; c < nc; c++) {
+      cols.clear(); vals.clear();
+      for (PetscInt m = 0; m < w.size(); m++) {
+        if (std::abs(w(m)) > 1e-10) { cols.push_back(masters[m] * nc + c); vals.push_back(w(m)); }
+      }
+      PetscInt row = node.dof * nc + c;
+      MatSetValues(hanging->mWeights, 1, &row, cols.size(), cols.data(), vals.data(), INSERT_VALUES);
+    }
+  }
+  MatAssemblyBegin(hanging->mWeights, MAT_FINAL_ASSEMBLY);
+  MatAssemblyEnd(hanging->mWeights, MAT_FINAL_ASSEMBLY);
+
+  /* The hanging dofs of this rank are the owned rows with any weight. */
+  PetscInt row_start, row_end; MatGetOwnershipRange(hanging->mWeights, &row_start, &row_end);
+  for (PetscInt r = row_start; r < row_end; r++) {
+    PetscInt ncols; MatGetRow(hanging->mWeights, r, &ncols, NULL, NULL);
+    if (ncols) { hanging->mHanging.push_back(r - row_start); }
+    MatRestoreRow(hanging->mWeights, r, &ncols, NULL, NULL);
+  }
+  DMRestoreGlobalVector(dm, &glb);
+  PetscInt num_hanging = hanging->mHanging.size() / nc;
+  MPI_Allreduce(&num_hanging, &hanging->mNumHanging, 1, MPIU_INT, MPI_SUM, PETSC_COMM_WORLD);
+  if (!hanging->mNumHanging) {
+    LOG() << "No hanging nodes in the mesh.";
+    return nullptr;
+  }
+  MatCreateVecs(hanging->mWeights, NULL, &hanging->mWork);
+  LOG() << "Constrained " << hanging->mNumHanging << " hanging nodes.";
+  return hanging;
+
+}
+
+HangingNodes::~HangingNodes() {
+  if (mWeights) { MatDestroy(&mWeights); }
+  if (mWork) { VecDestroy(&mWork); }
+}
+
+void HangingNodes::constrain(Vec u) {
+
+  /* u_s = sum_m w_sm u_m, with the other dofs left alone. */
+  MatMult(mWeights, u, mWork);
+  PetscScalar *val; const PetscScalar *w;
+  VecGetArray(u, &val); VecGetArrayRead(mWork, &w);
+  for (auto s: mHanging) { val[s] = w[s]; }
+  VecRestoreArray(u, &val); VecRestoreArrayRead(mWork, &w);
+
+}
+
+void HangingNodes::distribute(Vec f) {
+
+  /* f_m += sum_s w_sm f_s, then f_s = 0. */
+  MatMultTranspose(mWeights, f, mWork);
+  VecAXPY(f, 1, mWork);
+  PetscScalar *val; VecGetArray(f, &val);
+  for (auto s: mHanging) { val[s] = 0; }
+  VecRestoreArray(f, &val);
+
+}
+
+void HangingNodes::lumpMass(Vec m) {
+
+  /* The weights of a node sum to one, so the row sums of P^T M P are P^T m. */
+  distribute(m);
+  PetscScalar *val; VecGetArray(m, &val);
+  for (auto s: mHanging) { val[s] = 1; }
+  VecRestoreArray(m, &val);
+
+}
@@ -0,0 +1,130 @@
+#include <Problem/Monitor.h>
+#include <Mesh/Mesh.h>
+#include <Utilities/Options.h>
+#include <Utilities/Logging.h>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <mpi.h>
+
+/* Displacement, velocity and acceleration of each field advanced by the time stepper. */
+static const FieldId displacement[] {FieldId::u, FieldId::ux, FieldId::uy, FieldId::uz};
+static const FieldId velocity[]     {FieldId::v, FieldId::vx, FieldId::vy, FieldId::vz};
+static const FieldId acceleration[] {FieldId::a, FieldId::ax, FieldId::ay, FieldId::az};
+
+Monitor::Monitor(std::unique_ptr<Options> const &shot) {
+  mEvery = shot->EnergyCheckEvery();
+  mGrowth = shot->EnergyGrowth();
+  mLastEnergy = 0; mNumGrowing = 0;
+}
+
+bool Monitor::localEnergy(FieldDict &fields, PetscReal &kinetic, PetscReal &strain) {
+
+  kinetic = 0; strain = 0;
+  const PetscScalar *mi; VecGetArrayRead(fields[FieldId::mi]->mGlb, &mi);
+  for (PetscInt i = 0; i < 4; i++) {
+    if (!fields.count(displacement[i])) { continue; }
+    PetscInt size; VecGetLocalSize(fields[displacement[i]]->mGlb, &size);
+    const PetscScalar *u, *a;
+    VecGetArrayRead(fields[displacement[i]]->mGlb, &u);
+    VecGetArrayRead(fields[acceleration[i]]->mGlb, &a);
+    for (PetscInt j = 0; j < size; j++) { strain -= 0.5 * u[j] * a[j]; }
+    VecRestoreArrayRead(fields[acceleration[i]]->mGlb, &a);
+    VecRestoreArrayRead(fields[displacement[i]]->mGlb, &u);
+
+    /* The leapfrog scheme keeps no velocity, and its energy is that of the strain alone. */
+    if (!fields.count(velocity[i])) { continue; }
+    const PetscScalar *v; VecGetArrayRead(fields[velocity[i]]->mGlb, &v);
+    for (PetscInt j = 0; j < size; j++) { kinetic += 0.5 * v[j] * v[j] / mi[j]; }
+    VecRestoreArrayRead(fields[velocity[i]]->mGlb, &v);
+  }
+  VecRestoreArrayRead(fields[FieldId::mi]->mGlb, &mi);
+
+  /* A NaN or Inf anywhere carries over into the sums. */
+  return std::isfinite(kinetic) && std::isfinite(strain);
+
+}
+
+void Monitor::check(const PetscInt time_idx, const PetscReal time, FieldDict &fields, ElemVec const &elements,
+                    std::unique_ptr<Mesh> const &mesh) {
+
+  if (!Due(time_idx)) { return; }
+
+  /* Energy of all ranks, and the largest of a single rank (infinite if it holds non-finite values). */
+  PetscReal kinetic, strain;
+  const bool finite = localEnergy(fields, kinetic, strain);
+  const PetscReal local = finite ? kinetic + std::abs(strain) : std::numeric_limits<PetscReal>::infinity();
+  PetscReal sum[2] = {finite ? kinetic : 0, finite ? strain : 0}, global[2];
+  MPI_Allreduce(sum, global, 2, MPIU_REAL, MPI_SUM, PETSC_COMM_WORLD);
+  PetscReal worst; MPI_Allreduce(&local, &worst, 1, MPIU_REAL, MPI_MAX, PETSC_COMM_WORLD);
+  DEBUG() << "Energy at time " << time << ": kinetic " << global[0] << ", strain (estimate) " << global[1];
+
+  if (!std::isfinite(worst)) { abort(time, local, "a field is not finite", fields, elements, mesh); }
+
+  /* Sustained growth, measured from the first check with any energy. */
+  const PetscReal energy = global[0] + std::abs(global[1]);
+  mNumGrowing = mLastEnergy > 0 && energy > mGrowth * mLastEnergy ? mNumGrowing + 1 : 0;
+  mLastEnergy = energy;
+  if (mNumGrowing >= mGrowthChecks) {
+    std::ostringstream reason;
+    reason << "the energy grew by more than " << mGrowth << " at " << mNumGrowing << " consecutive checks, to "
+           << energy;
+    abort(time, local, reason.str(), fields, elements, mesh);
+  }
+
+}
+
+void Monitor::abort(const PetscReal time, const PetscReal score, const std::string &reason, FieldDict &fields,
+                    ElemVec const &elements, std::unique_ptr<Mesh> const &mesh) {
+
+  /* The rank with the largest energy. */
+  struct { double value; int rank; } mine = {score, PetscGlobalRank}, worst;
+  MPI_Allreduce(&mine, &worst, 1, MPI_DOUBLE_INT, MPI_MAXLOC, PETSC_COMM_WORLD);
+
+  /* Its element with the largest (or a non-finite) displacement, from the local displacement vectors. */
+  for (PetscInt i = 0; i < 4; i++) {
+    if (!fields.count(displacement[i])) { continue; }
+    DMGlobalToLocalBegin(mesh->DistributedMesh(), fields[displacement[i]]->mGlb, INSERT_VALUES,
+                         fields[displacement[i]]->mLoc);
+    DMGlobalToLocalEnd(mesh->DistributedMesh(), fields[displacement[i]]->mGlb, INSERT_VALUES,
+                       fields[displacement[i]]->mLoc);
+  }
+  /* Element number, and the lower and upper corner of its vertices. */
+  double blame[7] = {-1, 0, 0, 0, 0, 0, 0};
+  if (worst.rank == PetscGlobalRank) {
+    double largest = -1;
+    for (auto &elm: elements) {
+      double elm_score = 0;
+      for (PetscInt i = 0; i < 4; i++) {
+        if (!fields.count(displacement[i])) { continue; }
+        PetscScalar *val = NULL; PetscInt size;
+        DMPlexVecGetClosure(mesh->DistributedMesh(), mesh->MeshSection(), fields[displacement[i]]->mLoc,
+                            elm->Num(), &size, &val);
+        for (PetscInt j = 0; j < size; j++) { elm_score += val[j] * val[j]; }
+        DMPlexVecRestoreClosure(mesh->DistributedMesh(), mesh->MeshSection(), fields[displacement[i]]->mLoc,
+                                elm->Num(), &size, &val);
+      }
+      if (!std::isfinite(elm_score)) { elm_score = std::numeric_limits<double>::infinity(); }
+      if (elm_score <= largest) { continue; }
+      largest = elm_score;
+      const auto vtx = elm->VtxCrd();
+      blame[0] = elm->Num();
+      for (PetscInt d = 0; d < vtx.cols(); d++) {
+        blame[1 + d] = vtx.col(d).minCoeff(); blame[4 + d] = vtx.col(d).maxCoeff();
+      }
+    }
+  }
+  MPI_Bcast(blame, 7, MPI_DOUBLE, worst.rank, PETSC_COMM_WORLD);
+
+  std::ostringstream os;
+  os << "Error. The run went unstable at time " << time << ": " << reason << ". The largest energy is on rank "
+     << worst.rank;
+  if (blame[0] >= 0) {
+    os << ", around element " << static_cast<PetscInt>(blame[0]) << " of that rank, within ("
+       << blame[1] << ", " << blame[2] << ", " << blame[3] << ") - (" << blame[4] << ", " << blame[5] << ", "
+       << blame[6] << ")";
+  }
+  os << ". Check the time step (--time-step) and the quality of the mesh there.";
+  throw std::runtime_error(os.str());
+
+}
@@ -0,0 +1,371 @@
+#include <Problem/Movie.h>
+#include <Mesh/Mesh.h>
+#include <Model/ExodusModel.h>
+#include <Element/Element.h>
+#include <Utilities/Options.h>
+#include <Utilities/Compression.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+bool Movie::Selective(std::unique_ptr<Options> const &options) {
+  return !options->MovieRegion().empty() || !options->MovieSideSet().empty() || options->MovieVerticesOnly() ||
+      options->MoviePrecision() != "double" || options->MovieTolerance() > 0;
+}
+
+Movie::Movie(std::unique_ptr<Options> const &options, std::unique_ptr<Mesh> const &mesh,
+             std::unique_ptr<ExodusModel> const &model) {
+
+  mNumDim = mesh->NumberDimensions(); mNumComponents = 1;
+  mRegion = options->MovieRegion();
+  mTolerance = options->MovieTolerance();
+  mSetUp = false; mNumSelected = 0; mOffset = 0; mNumFrames = 0;
+
+  /* Points which may hold movie dofs. */
+  DM dm = mesh->DistributedMesh();
+  PetscInt p_end; DMPlexGetChart(dm, &mChartStart, &p_end);
+  mPoints.assign(p_end - mChartStart, true);
+  if (options->MovieVerticesOnly()) {
+    PetscInt v_start, v_end; DMPlexGetDepthStratum(dm, 0, &v_start, &v_end);
+    for (PetscInt p = mChartStart; p < p_end; p++) { mPoints[p - mChartStart] = p >= v_start && p < v_end; }
+  }
+  if (!options->MovieSideSet().empty()) {
+    PetscInt side_set = -1;
+    for (PetscInt k = 0; k < mesh->NumberSideSets(); k++) {
+      if (model->SideSetName(k) == options->MovieSideSet()) { side_set = k; }
+    }
+    if (side_set < 0) {
+      throw std::runtime_error("--movie-side-set " + options->MovieSideSet() + " is not a side set of the mesh.");
+    }
+    for (PetscInt p = mChartStart; p < p_end; p++) {
+      mPoints[p - mChartStart] = mPoints[p - mChartStart] && mesh->OnSideSet(p, side_set);
+    }
+  }
+
+  /* Samples are converted to the file's precision on write. HDF5 has no predefined half, so it is laid out as
+   * IEEE 754 binary16 (sign bit 15, 5 exponent bits from 10, 10 mantissa bits from 0). Compressed frames hold
+   * the levels of their grid, in the smallest unsigned integer which fits them. */
+  if (mTolerance) {
+    const int bits = Compression::Bits(mTolerance);
+    mType = H5Tcopy(bits <= 8 ? H5T_NATIVE_UINT8 : bits <= 16 ? H5T_NATIVE_UINT16 : H5T_NATIVE_UINT32);
+  } else if (options->MoviePrecision() == "half") {
+    mType = H5Tcopy(H5T_IEEE_F32LE);
+    H5Tset_fields(mType, 15, 10, 5, 0, 10);
+    H5Tset_precision(mType, 16);
+    H5Tset_ebias(mType, 15);
+    H5Tset_size(mType, 2);
+  } else {
+    mType = H5Tcopy(options->MoviePrecision() == "float" ? H5T_NATIVE_FLOAT : H5T_NATIVE_DOUBLE);
+  }
+
+  /* A resumed run appends to the movie of the run before (see Restart), from the frames it had written. */
+  hid_t plist_id = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fapl_mpio(plist_id, PETSC_COMM_WORLD, MPI_INFO_NULL);
+  mResume = !options->RestartFrom().empty();
+  mFileId = mResume ? H5Fopen(options->MovieFile().c_str(), H5F_ACC_RDWR, plist_id) :
+                      H5Fcreate(options->MovieFile().c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, plist_id);
+  H5Pclose(plist_id);
+  if (mFileId < 0) {
+    H5Tclose(mType);
+    throw std::runtime_error("Can't open movie file '" + options->MovieFile() + "' to resume it.");
+  }
+  if (mResume) { mTimeSet = H5Dopen(mFileId, "/time", H5P_DEFAULT); return; }
+
+  /* Time of each frame. */
+  hsize_t dims = 0, max_dims = H5S_UNLIMITED, chunk = 1024;
+  hid_t filespace = H5Screate_simple(1, &dims, &max_dims);
+  hid_t dcpl_id = H5Pcreate(H5P_DATASET_CREATE);
+  H5Pset_chunk(dcpl_id, 1, &chunk);
+  mTimeSet = H5Dcreate(mFileId, "/time", H5T_NATIVE_DOUBLE, filespace, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+  H5Pclose(dcpl_id);
+  H5Sclose(filespace);
+
+}
+
+Movie::~Movie() {
+  for (auto &set: mSets) { H5Dclose(set.second); }
+  for (auto &set: mGridSets) { H5Dclose(set.second); }
+  H5Dclose(mTimeSet);
+  H5Tclose(mType);
+  H5Fclose(mFileId);
+}
+
+void Movie::SelectDofs(ElemVec const &elements, DM PETScDM, PetscSection PETScSection,
+                       const std::vector<bool> &points, const PetscInt chart_start,
+                       const std::vector<PetscReal> &region, std::vector<PetscInt> &dofs,
+                       std::vector<PetscReal> &coordinates) {
+
+  PetscInt num_dim, num_components; DMGetDimension(PETScDM, &num_dim);
+  PetscSectionGetFieldComponents(PETScSection, 0, &num_components);
+
+  /* Coordinates of every local dof, inserted through the element closures (as the fields are). Salvus
+   * ordering: field(closure(i)) = petscField(i). */
+  std::vector<Vec> crd(num_dim);
+  for (auto &vec: crd) { DMGetLocalVector(PETScDM, &vec); VecSet(vec, 0); }
+  for (auto &elm: elements) {
+    Eigen::MatrixXd pts = elm->NodalCoordinates();
+    const auto &closure = elm->ClsMap();
+    RealVec val(closure.size() * num_components);
+    for (PetscInt d = 0; d < num_dim; d++) {
+      for (PetscInt i = 0; i < closure.size(); i++) {
+        val.segment(i * num_components, num_components).setConstant(pts(closure(i), d));
+      }
+      DMPlexVecSetClosure(PETScDM, PETScSection, crd[d], elm->Num(), val.data(), INSERT_VALUES);
+    }
+  }
+
+  /* Owned dofs of the selected points, within the region. */
+  PetscSection glb_section; DMGetDefaultGlobalSection(PETScDM, &glb_section);
+  Vec glb; DMGetGlobalVector(PETScDM, &glb);
+  PetscInt glb_start; VecGetOwnershipRange(glb, &glb_start, NULL);
+  DMRestoreGlobalVector(PETScDM, &glb);
+  std::vector<const PetscScalar*> x(num_dim);
+  for (PetscInt d = 0; d < num_dim; d++) { VecGetArrayRead(crd[d], &x[d]); }
+  dofs.clear(); coordinates.clear();
+  PetscInt p_start, p_end; PetscSectionGetChart(PETScSection, &p_start, &p_end);
+  for (PetscInt p = p_start; p < p_end; p++) {
+    if (!points.empty() && !points[p - chart_start]) { continue; }
+    PetscInt dof, off, glb_off;
+    PetscSectionGetDof(PETScSection, p, &dof);
+    PetscSectionGetOffset(PETScSection, p, &off);
+    PetscSectionGetOffset(glb_section, p, &glb_off);
+    if (glb_off < 0) { continue; }
+    for (PetscInt i = 0; i < dof; i += num_components) {
+      bool inside = true;
+      for (PetscInt d = 0; d < num_dim && !region.empty(); d++) {
+        PetscReal v = PetscRealPart(x[d][off + i]);
+        inside = inside && v >= region[2 * d] && v <= region[2 * d + 1];
+      }
+      if (!inside) { continue; }
+      dofs.push_back(glb_off - glb_start + i);
+      for (PetscInt d = 0; d < num_dim; d++) { coordinates.push_back(PetscRealPart(x[d][off + i])); }
+    }
+  }
+  for (PetscInt d = 0; d < num_dim; d++) {
+    VecRestoreArrayRead(crd[d], &x[d]);
+    DMRestoreLocalVector(PETScDM, &crd[d]);
+  }
+
+}
+
+void Movie::setup(ElemVec const &elements, DM PETScDM, PetscSection PETScSection) {
+
+  PetscSectionGetFieldComponents(PETScSection, 0, &mNumComponents);
+  std::vector<PetscReal> coordinates;
+  SelectDofs(elements, PETScDM, PETScSection, mPoints, mChartStart, mRegion, mDofs, coordinates);
+
+  /* Rows of each rank, in rank order. */
+  unsigned long long num = mDofs.size(), offset = 0, total = 0;
+  MPI_Exscan(&num, &offset, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, PETSC_COMM_WORLD);
+  MPI_Allreduce(&num, &total, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, PETSC_COMM_WORLD);
+  int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+  mOffset = rank ? offset : 0; mNumSelected = total;
+  if (!mNumSelected) { throw std::runtime_error("The movie region and side set hold no dofs."); }
+  if (mResume) { mSetUp = true; return; }
+
+  /* Coordinates of the selected dofs. */
+  hsize_t dims[2] = {mNumSelected, static_cast<hsize_t>(mNumDim)};
+  hid_t filespace = H5Screate_simple(2, dims, NULL);
+  hid_t set = H5Dcreate(mFileId, "/coordinates", H5T_NATIVE_DOUBLE, filespace,
+                        H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  hsize_t start[2] = {mOffset, 0}, count[2] = {mDofs.size(), static_cast<hsize_t>(mNumDim)};
+  hsize_t mem_size = std::max<hsize_t>(coordinates.size(), 1);
+  hid_t memspace = H5Screate_simple(1, &mem_size, NULL);
+  if (mDofs.empty()) {
+    H5Sselect_none(filespace); H5Sselect_none(memspace);
+    coordinates.push_back(0);
+  } else {
+    H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, NULL, count, NULL);
+  }
+  hid_t plist_id = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
+  H5Dwrite(set, H5T_NATIVE_DOUBLE, memspace, filespace, plist_id, coordinates.data());
+  H5Pclose(plist_id);
+  H5Sclose(memspace);
+  H5Sclose(filespace);
+  H5Dclose(set);
+
+  mSetUp = true;
+
+}
+
+template <typename T>
+static void writeRows(hid_t file_id, const std::string &name, const std::vector<hsize_t> &dims,
+                      const std::vector<hsize_t> &start, const std::vector<hsize_t> &count,
+                      std::vector<T> buf, hid_t type) {
+  hid_t filespace = H5Screate_simple(dims.size(), dims.data(), NULL);
+  hid_t set = H5Dcreate(file_id, name.c_str(), type, filespace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  hsize_t mem_size = std::max<hsize_t>(buf.size(), 1);
+  hid_t memspace = H5Screate_simple(1, &mem_size, NULL);
+  if (buf.empty()) {
+    H5Sselect_none(filespace); H5Sselect_none(memspace);
+    buf.push_back(0);
+  } else {
+    H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start.data(), NULL, count.data(), NULL);
+  }
+  hid_t plist_id = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
+  H5Dwrite(set, type, memspace, filespace, plist_id, buf.data());
+  H5Pclose(plist_id);
+  H5Sclose(memspace);
+  H5Sclose(filespace);
+  H5Dclose(set);
+}
+
+void Movie::WriteRows(hid_t file_id, const std::string &name, const std::vector<hsize_t> &dims,
+                      const std::vector<hsize_t> &start, const std::vector<hsize_t> &count,
+                      std::vector<double> buf) {
+  writeRows(file_id, name, dims, start, count, std::move(buf), H5T_NATIVE_DOUBLE);
+}
+
+void Movie::WriteRows(hid_t file_id, const std::string &name, const std::vector<hsize_t> &dims,
+                      const std::vector<hsize_t> &start, const std::vector<hsize_t> &count,
+                      std::vector<float> buf) {
+  writeRows(file_id, name, dims, start, count, std::move(buf), H5T_NATIVE_FLOAT);
+}
+
+hid_t Movie::fieldSet(const std::string &field) {
+
+  if (mSets.count(field)) { return mSets[field]; }
+
+  /* The datasets of a resumed movie, from the frames written before. */
+  const std::string name = "/" + field;
+  if (mResume && H5Lexists(mFileId, name.c_str(), H5P_DEFAULT) > 0) {
+    hid_t set = H5Dopen(mFileId, name.c_str(), H5P_DEFAULT);
+    hsize_t nc = mNumComponents, dims[3] = {mNumFrames, mNumSelected, nc};
+    H5Dset_extent(set, dims);
+    if (mTolerance) {
+      hsize_t grid_dims[2] = {mNumFrames, 2};
+      mGridSets[field] = H5Dopen(mFileId, (name + "_grid").c_str(), H5P_DEFAULT);
+      H5Dset_extent(mGridSets[field], grid_dims);
+    }
+    return mSets[field] = set;
+  }
+
+  /* One chunk per frame and block of dofs, so that a frame is written to whole chunks. */
+  hsize_t nc = mNumComponents;
+  hsize_t dims[3] = {0, mNumSelected, nc}, max_dims[3] = {H5S_UNLIMITED, mNumSelected, nc};
+  hsize_t chunk[3] = {1, std::min<hsize_t>(mNumSelected, 1 << 16), nc};
+  hid_t filespace = H5Screate_simple(3, dims, max_dims);
+  hid_t dcpl_id = H5Pcreate(H5P_DATASET_CREATE);
+  H5Pset_chunk(dcpl_id, 3, chunk);
+  hid_t set = H5Dcreate(mFileId, ("/" + field).c_str(), mType, filespace, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+  H5Pclose(dcpl_id);
+  H5Sclose(filespace);
+
+  /* The lowest level and step of each compressed frame. */
+  if (mTolerance) {
+    hsize_t grid_dims[2] = {0, 2}, grid_max_dims[2] = {H5S_UNLIMITED, 2}, grid_chunk[2] = {512, 2};
+    filespace = H5Screate_simple(2, grid_dims, grid_max_dims);
+    dcpl_id = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(dcpl_id, 2, grid_chunk);
+    mGridSets[field] = H5Dcreate(mFileId, ("/" + field + "_grid").c_str(), H5T_NATIVE_DOUBLE, filespace,
+                                 H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    H5Pclose(dcpl_id);
+    H5Sclose(filespace);
+  }
+  return mSets[field] = set;
+
+}
+
+void Movie::SetNumFrames(const hsize_t num) {
+  mNumFrames = num;
+  H5Dset_extent(mTimeSet, &mNumFrames);
+}
+
+void Movie::flush() { H5Fflush(mFileId, H5F_SCOPE_GLOBAL); }
+
+void Movie::write(const PetscReal time, const std::vector<std::string> &save_fields, FieldDict &fields) {
+
+  if (!mSetUp) { throw std::runtime_error("Movie::setup must be called before writing frames."); }
+
+  hid_t plist_id = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
+  std::vector<PetscScalar> buf(std::max<size_t>(mDofs.size() * mNumComponents, 1));
+  std::vector<uint32_t> levels(mTolerance ? buf.size() : 0);
+  hsize_t mem_size = buf.size();
+  int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+
+  for (auto &f: save_fields) {
+
+    /* Selected dofs of this rank, with their components. */
+    const PetscScalar *val; VecGetArrayRead(fields[f]->mGlb, &val);
+    for (size_t i = 0; i < mDofs.size(); i++) {
+      for (PetscInt c = 0; c < mNumComponents; c++) { buf[i * mNumComponents + c] = val[mDofs[i] + c]; }
+    }
+    VecRestoreArrayRead(fields[f]->mGlb, &val);
+
+    /* A compressed frame shares its grid across the ranks: the lowest value and largest magnitude of all. */
+    double grid[2] = {0, 1};
+    if (mTolerance) {
+      const size_t num = mDofs.size() * mNumComponents;
+      double ext[2] = {-std::numeric_limits<double>::max(), 0};
+      for (size_t i = 0; i < num; i++) {
+        ext[0] = std::max<double>(ext[0], -buf[i]); ext[1] = std::max<double>(ext[1], std::abs(buf[i]));
+      }
+      MPI_Allreduce(MPI_IN_PLACE, ext, 2, MPI_DOUBLE, MPI_MAX, PETSC_COMM_WORLD);
+      grid[0] = -ext[0]; grid[1] = Compression::Step(ext[1], mTolerance);
+      for (size_t i = 0; i < num; i++) { levels[i] = Compression::Level(buf[i], grid[0], grid[1]); }
+    }
+
+    /* Append the frame. */
+    hid_t set = fieldSet(f);
+    hsize_t dims[3] = {mNumFrames + 1, mNumSelected, static_cast<hsize_t>(mNumComponents)};
+    H5Dset_extent(set, dims);
+    hid_t filespace = H5Dget_space(set);
+    hid_t memspace = H5Screate_simple(1, &mem_size, NULL);
+    if (mDofs.empty()) {
+      H5Sselect_none(filespace); H5Sselect_none(memspace);
+    } else {
+      hsize_t start[3] = {mNumFrames, mOffset, 0};
+      hsize_t count[3] = {1, mDofs.size(), static_cast<hsize_t>(mNumComponents)};
+      H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, NULL, count, NULL);
+    }
+    if (mTolerance) {
+      H5Dwrite(set, H5T_NATIVE_UINT32, memspace, filespace, plist_id, levels.data());
+    } else {
+      H5Dwrite(set, H5T_NATIVE_DOUBLE, memspace, filespace, plist_id, buf.data());
+    }
+    H5Sclose(memspace);
+    H5Sclose(filespace);
+
+    /* The first rank appends the grid of a compressed frame. */
+    if (mTolerance) {
+      hid_t grid_set = mGridSets[f];
+      hsize_t grid_dims[2] = {mNumFrames + 1, 2}, grid_start[2] = {mNumFrames, 0}, grid_count[2] = {1, 2};
+      hsize_t two = 2;
+      H5Dset_extent(grid_set, grid_dims);
+      filespace = H5Dget_space(grid_set);
+      memspace = H5Screate_simple(1, &two, NULL);
+      if (rank) {
+        H5Sselect_none(filespace); H5Sselect_none(memspace);
+      } else {
+        H5Sselect_hyperslab(filespace, H5S_SELECT_SET, grid_start, NULL, grid_count, NULL);
+      }
+      H5Dwrite(grid_set, H5T_NATIVE_DOUBLE, memspace, filespace, plist_id, grid);
+      H5Sclose(memspace);
+      H5Sclose(filespace);
+    }
+
+  }
+
+  /* The first rank writes the time. */
+  hsize_t dims = mNumFrames + 1, one = 1;
+  H5Dset_extent(mTimeSet, &dims);
+  hid_t filespace = H5Dget_space(mTimeSet);
+  hid_t memspace = H5Screate_simple(1, &one, NULL);
+  if (rank) {
+    H5Sselect_none(filespace); H5Sselect_none(memspace);
+  } else {
+    H5Sselect_hyperslab(filespace, H5S_SELECT_SET, &mNumFrames, NULL, &one, NULL);
+  }
+  double t = time;
+  H5Dwrite(mTimeSet, H5T_NATIVE_DOUBLE, memspace, filespace, plist_id, &t);
+  H5Sclose(memspace);
+  H5Sclose(filespace);
+  H5Pclose(plist_id);
+
+  mNumFrames++;
+
+}
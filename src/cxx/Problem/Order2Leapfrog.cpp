@@ -0,0 +1,162 @@
+#include <Mesh/Mesh.h>
+#include <Problem/Order2Leapfrog.h>
+#include <Utilities/Options.h>
+
+/* Displacement of the previous step, of this step, and acceleration of each component. */
+const static FieldId recognized_dsp_[] {FieldId::ux_, FieldId::uy_, FieldId::uz_, FieldId::u_};
+const static FieldId recognized_dsp[]  {FieldId::ux,  FieldId::uy,  FieldId::uz,  FieldId::u};
+const static FieldId recognized_acl[]  {FieldId::ax,  FieldId::ay,  FieldId::az,  FieldId::a};
+
+std::vector<std::string> Order2Leapfrog::physicsToFields(const std::set<std::string> &physics,
+                                                         const bool interleaved) {
+
+  std::vector<std::string> fields;
+  for (auto &phys: physics) {
+    if (phys == "fluid" || (interleaved && (phys == "2delastic" || phys == "3delastic"))) {
+      fields.insert(std::end(fields),
+        { "u", "u_", "a" });
+    } else if (phys == "2delastic") {
+      fields.insert(std::end(fields),
+        {"ux", "ux_", "ax",
+         "uy", "uy_", "ay" });
+    } else if (phys == "3delastic") {
+      fields.insert(std::end(fields),
+        {"ux", "ux_", "ax",
+         "uy", "uy_", "ay",
+         "uz", "uz_", "az" });
+    } else {
+      throw std::runtime_error("Physics not supported by Order2Leapfrog. "
+                                   "Choose [ fluid, 2delastic, 3delastic ]");
+    }
+  }
+
+  return fields;
+}
+
+FieldDict Order2Leapfrog::initializeGlobalDofs(ElemVec const &elements, std::unique_ptr<Mesh> &mesh) {
+
+  FieldDict fields;
+
+  /* Initialize vector which will hold diagonal mass matrix. */
+  fields.insert(std::unique_ptr<field> (new field("mi", mesh->DistributedMesh(), GhostedState())));
+  initializeHangingNodes(elements, mesh);
+  initializePeriodicBoundaries(elements, mesh);
+  assembleInverseMassMatrix(elements, mesh, fields);
+
+  /* Initialize global field vectors, with local ones for u and a (or all of them, for a ghosted state). */
+  if (mesh->AllFields().empty()) {
+    throw std::runtime_error("No global fields defined for leapfrog time stepper");
+  }
+  const std::set<FieldId> local = LocalFields(elements, mesh->NumberComponents());
+  for (auto &f: physicsToFields(mesh->AllFields(), mesh->NumberComponents() > 1)) {
+    fields.insert(std::unique_ptr<field> (new field(f, mesh->DistributedMesh(),
+                                                    GhostedState() || local.count(FieldIdFromName(f)))));
+  }
+
+  /* Absorbing boundaries and the fluid-solid couplings pull the velocity, which the scheme does not keep. */
+  for (auto &elm: elements) {
+    for (auto id: elm->PullElementalFields()) {
+      if (fields.count(id) || fields.count(BlockField(id))) { continue; }
+      throw std::runtime_error(std::string("The leapfrog time stepper does not keep field ") + FieldName(id) +
+                               ", which is pulled by an element (i.e. on an absorbing boundary or a fluid-solid "
+                               "interface). Use --time-stepping-scheme newmark instead.");
+    }
+  }
+
+  /* Precompute the element gather/scatter plan for the time loop. */
+  initializeAssemblyPlan(elements, mesh->DistributedMesh(), mesh->MeshSection(), mElementLevel);
+  initializeBoundaryDofs(mesh);
+
+  return fields;
+
+}
+
+std::tuple<FieldDict, PetscScalar> Order2Leapfrog::takeTimeStep(
+    FieldDict fields, PetscScalar time, std::unique_ptr<Options> const &options) {
+
+  /* A wavefield starts from rest, where the first step is that of Newmark (u_1 = u_0 + dt^2/2 a_0). Each
+   * wavefield (i.e. the forward and adjoint ones of a gradient) keeps whether it does. */
+  const PetscReal prv_factor = fields.FromRest() ? 0 : 1;
+  const PetscReal dsp_factor = fields.FromRest() ? (1.0/2.0) * (mDt * mDt) : mDt * mDt;
+  fields.SetFromRest(false);
+
+  /* A ghosted state is advanced on the local vectors, the ghosts along with the owned dofs. */
+  Vec field::*state = GhostedState() ? &field::mLoc : &field::mGlb;
+
+  if (mVecKernelUpdate) {
+    for (PetscInt i = 0; i < 4; i++) {
+      if (!fields.count(recognized_acl[i])) { continue; }
+      Vec a = (*fields[recognized_acl[i]]).*state;
+      if (mInverseMassPending) { VecPointwiseMult(a, a, (*fields[FieldId::mi]).*state); }
+      VecAXPBYPCZ((*fields[recognized_dsp_[i]]).*state, 1 + prv_factor, dsp_factor, -prv_factor,
+                  (*fields[recognized_dsp[i]]).*state, a);
+      swapFieldVectors(fields[recognized_dsp[i]], fields[recognized_dsp_[i]]);
+    }
+    mInverseMassPending = false;
+    time += mDt;
+    return std::tuple<FieldDict, PetscScalar> (std::move(fields), time);
+  }
+
+  const PetscScalar *mi = NULL;
+  if (mInverseMassPending) { VecGetArrayRead((*fields[FieldId::mi]).*state, &mi); }
+
+  /* The new displacement overwrites the previous one, after which the two swap. The filtered acceleration is
+   * kept, for rewindDisplacement. */
+  // a_n = M^-1 a_n
+  // u_{n+1} = 2*u_n - u_{n-1} + dt^2*a_n
+  for (PetscInt i = 0; i < 4; i++) {
+    if (!fields.count(recognized_acl[i])) { continue; }
+
+    PetscInt size; VecGetLocalSize((*fields[recognized_acl[i]]).*state, &size);
+    PetscScalar *a, *u_; const PetscScalar *u;
+    VecGetArray((*fields[recognized_acl[i]]).*state, &a);
+    VecGetArray((*fields[recognized_dsp_[i]]).*state, &u_);
+    VecGetArrayRead((*fields[recognized_dsp[i]]).*state, &u);
+    for (PetscInt j = 0; j < size; j++) {
+      if (mi) { a[j] *= mi[j]; }
+      u_[j] = (1 + prv_factor) * u[j] - prv_factor * u_[j] + dsp_factor * a[j];
+    }
+    VecRestoreArrayRead((*fields[recognized_dsp[i]]).*state, &u);
+    VecRestoreArray((*fields[recognized_dsp_[i]]).*state, &u_);
+    VecRestoreArray((*fields[recognized_acl[i]]).*state, &a);
+
+    swapFieldVectors(fields[recognized_dsp[i]], fields[recognized_dsp_[i]]);
+  }
+
+  if (mi) { VecRestoreArrayRead((*fields[FieldId::mi]).*state, &mi); }
+  mInverseMassPending = false;
+
+  time += mDt;
+  return std::tuple<FieldDict, PetscScalar> (std::move(fields), time);
+
+}
+
+FieldDict Order2Leapfrog::rewindDisplacement(FieldDict fields) {
+
+  /* The update of the last step, solved for the displacement before it. */
+  // u_{n-1} = 2*u_n - u_{n+1} + dt^2*a_n
+  for (PetscInt i = 0; i < 4; i++) {
+    if (!fields.count(recognized_acl[i])) { continue; }
+    VecAXPBYPCZ(fields[recognized_dsp[i]]->mGlb, 2, mDt * mDt, -1, fields[recognized_dsp_[i]]->mGlb,
+                fields[recognized_acl[i]]->mGlb);
+  }
+  return fields;
+
+}
+
+std::tuple<FieldDict, PetscScalar> Order2Leapfrog::takeTimeStepBack(
+    FieldDict fields, PetscScalar time, std::unique_ptr<Options> const &options) {
+
+  /* The rewound displacement is that of the step before, and u_n the current one again. */
+  for (PetscInt i = 0; i < 4; i++) {
+    if (!fields.count(recognized_acl[i])) { continue; }
+    Vec a = fields[recognized_acl[i]]->mGlb;
+    if (mInverseMassPending) { VecPointwiseMult(a, a, fields[FieldId::mi]->mGlb); }
+    swapFieldVectors(fields[recognized_dsp[i]], fields[recognized_dsp_[i]]);
+  }
+  mInverseMassPending = false;
+
+  time -= mDt;
+  return std::tuple<FieldDict, PetscScalar> (std::move(fields), time);
+
+}
@@ -1,14 +1,21 @@
 #include <Mesh/Mesh.h>
 #include <Problem/Order2Newmark.h>
 #include <Utilities/Logging.h>
+#include <Utilities/Profiler.h>
 #include <Utilities/Options.h>
 
+/* List of vectors to multiply. */
+const static FieldId recognized_acl_[] {FieldId::ax_, FieldId::ay_, FieldId::az_, FieldId::a_};
+const static FieldId recognized_acl[]  {FieldId::ax,  FieldId::ay,  FieldId::az,  FieldId::a};
+const static FieldId recognized_vel[]  {FieldId::vx,  FieldId::vy,  FieldId::vz,  FieldId::v};
+const static FieldId recognized_dsp[]  {FieldId::ux,  FieldId::uy,  FieldId::uz,  FieldId::u};
 
-std::vector<std::string> Order2Newmark::physicsToFields(const std::set<std::string> &physics) {
+std::vector<std::string> Order2Newmark::physicsToFields(const std::set<std::string> &physics,
+                                                        const bool interleaved) {
 
   std::vector<std::string> fields;
   for (auto &phys: physics) {
-    if (phys == "fluid") {
+    if (phys == "fluid" || (interleaved && (phys == "2delastic" || phys == "3delastic"))) {
       fields.insert(std::end(fields),
         { "u", "v", "a", "a_" });
     } else if (phys == "2delastic") {
@@ -35,32 +42,84 @@ FieldDict Order2Newmark::initializeGlobalDofs(ElemVec const &elements,
   FieldDict fields;
 
   /* Initialize vector which will hold diagonal mass matrix. */
-  fields.insert(std::pair<std::string, std::unique_ptr<field>>
-                    ("mi", std::unique_ptr<field> (new field("mi", mesh->DistributedMesh()))));
+  fields.insert(std::unique_ptr<field> (new field("mi", mesh->DistributedMesh(), GhostedState())));
+  initializeHangingNodes(elements, mesh);
+  initializePeriodicBoundaries(elements, mesh);
+  assembleInverseMassMatrix(elements, mesh, fields);
 
-  /* Sum mass matrix into local partition. */
-  for (auto &elm: elements) {
-    DMPlexVecSetClosure(mesh->DistributedMesh(), mesh->MeshSection(), fields["mi"]->mLoc,
-                        elm->Num(), elm->assembleElementMassMatrix().data(), ADD_VALUES);
+  /* Initialize global field vectors. Only the pulled u and pushed a are also held on the local partition,
+   * unless the whole state is. */
+  const std::set<FieldId> local = LocalFields(elements, mesh->NumberComponents());
+  if (!mesh->AllFields().empty()) {
+    for (auto &f: physicsToFields(mesh->AllFields(), mesh->NumberComponents() > 1)) {
+    fields.insert(std::unique_ptr<field> (new field(f, mesh->DistributedMesh(),
+                                                    GhostedState() || local.count(FieldIdFromName(f)))));
+    }
+  } else {
+    throw std::runtime_error("No global fields defined for newmark time stepper");
   }
 
-  /* Sum mass matrix into global partition. */
-  DMLocalToGlobalBegin(mesh->DistributedMesh(), fields["mi"]->mLoc, ADD_VALUES, fields["mi"]->mGlb);
-  DMLocalToGlobalEnd(mesh->DistributedMesh(), fields["mi"]->mLoc, ADD_VALUES, fields["mi"]->mGlb);
+  /* Precompute the element gather/scatter plan for the time loop. */
+  initializeAssemblyPlan(elements, mesh->DistributedMesh(), mesh->MeshSection(), mElementLevel);
+  initializeBoundaryDofs(mesh);
 
-  /* Take component wise inverse of mass "matrix". */
-  VecReciprocal(fields["mi"]->mLoc); VecReciprocal(fields["mi"]->mGlb);
+  return fields;
 
-  /* Initialize global field vectors. */
-  if (!mesh->AllFields().empty()) {
-    for (auto &f: physicsToFields(mesh->AllFields())) {
-    fields.insert(std::pair<std::string,std::unique_ptr<field>>
-                      (f, std::unique_ptr<field> (new field(f, mesh->DistributedMesh()))));
+}
+
+void Order2Newmark::assembleInverseMassMatrix(ElemVec const &elements, std::unique_ptr<Mesh> &mesh,
+                                              FieldDict &fields) {
+
+  Profiler::Scope scope(Profiler::MassMatrix);
+
+  /* Sum mass matrix into local partition, on a work vector unless the mass has a local vector of its own. With
+   * interleaved components, the same mass is repeated for each component. */
+  Vec loc = fields[FieldId::mi]->mLoc;
+  if (!loc) { DMGetLocalVector(mesh->DistributedMesh(), &loc); }
+  VecSet(loc, 0);
+  PetscInt num_comps = mesh->NumberComponents();
+  for (auto &elm: elements) {
+    RealVec mass = elm->assembleElementMassMatrix();
+    if (num_comps > 1) {
+      RealVec block(mass.size() * num_comps);
+      for (PetscInt i = 0; i < mass.size(); i++) { block.segment(i * num_comps, num_comps).setConstant(mass(i)); }
+      mass = block;
     }
-  } else {
-    throw std::runtime_error("No global fields defined for newmark time stepper");
+    DMPlexVecSetClosure(mesh->DistributedMesh(), mesh->MeshSection(), loc, elm->Num(), mass.data(), ADD_VALUES);
   }
 
+  /* Sum mass matrix into global partition. With overlapping cells, the owned dofs already hold the sum over all
+   * of their cells, which the overlap of other ranks would add again. */
+  const InsertMode mode = HaloOverlap() ? INSERT_VALUES : ADD_VALUES;
+  DMLocalToGlobalBegin(mesh->DistributedMesh(), loc, mode, fields[FieldId::mi]->mGlb);
+  DMLocalToGlobalEnd(mesh->DistributedMesh(), loc, mode, fields[FieldId::mi]->mGlb);
+  if (loc != fields[FieldId::mi]->mLoc) { DMRestoreLocalVector(mesh->DistributedMesh(), &loc); }
+
+  /* Lump the mass of the hanging nodes and periodic slaves onto their masters, and take component wise inverse of
+   * mass "matrix". The local vector takes the summed one, for a ghosted state. */
+  if (Hanging()) { Hanging()->lumpMass(fields[FieldId::mi]->mGlb); }
+  if (Periodic()) { Periodic()->lumpMass(fields[FieldId::mi]->mGlb); }
+  VecReciprocal(fields[FieldId::mi]->mGlb);
+  if (!fields[FieldId::mi]->mLoc) { return; }
+  DMGlobalToLocalBegin(mesh->DistributedMesh(), fields[FieldId::mi]->mGlb, INSERT_VALUES,
+                       fields[FieldId::mi]->mLoc);
+  DMGlobalToLocalEnd(mesh->DistributedMesh(), fields[FieldId::mi]->mGlb, INSERT_VALUES,
+                     fields[FieldId::mi]->mLoc);
+
+}
+
+FieldDict Order2Newmark::reinitializeGlobalDofs(ElemVec const &elements, std::unique_ptr<Mesh> &mesh,
+                                                FieldDict fields) {
+
+  /* Start again from rest, with the mass matrix of the new material. */
+  for (auto &name: fields.Names()) {
+    if (fields[name]->mLoc) { VecSet(fields[name]->mLoc, 0); }
+    VecSet(fields[name]->mGlb, 0);
+  }
+  fields.SetFromRest(true);
+  assembleInverseMassMatrix(elements, mesh, fields);
+  mInverseMassPending = false;
+
   return fields;
 
 }
@@ -68,15 +127,11 @@ FieldDict Order2Newmark::initializeGlobalDofs(ElemVec const &elements,
 FieldDict Order2Newmark::applyInverseMassMatrix(FieldDict fields) {
 
   /* Ensure there is an inverted diagonal mass matrix. */
-  assert(fields.find("mi") != fields.end());
+  assert(fields.count(FieldId::mi));
 
-  /* Multiply acceleration by inverse mass matrix (if a component exists) */
-  std::vector<std::string> recognized_acl {"ax", "ay", "ax", "a"};
-  for (auto &f: {"ax", "ay", "az", "a"}) {
-    if (fields.count(f)) {
-      VecPointwiseMult(fields[f]->mGlb, fields["mi"]->mGlb, fields[f]->mGlb);
-    } else { continue; }
-  }
+  /* The inverse mass is applied within the fused update in takeTimeStep, so that each vector
+   * is only streamed through memory once per step. */
+  mInverseMassPending = true;
 
   return fields;
 
@@ -89,30 +144,168 @@ std::tuple<FieldDict, PetscScalar> Order2Newmark::takeTimeStep(
   PetscReal acl_factor = (1.0/2.0) * mDt;
   PetscReal dsp_factor = (1.0/2.0) * (mDt * mDt);
 
-  /* List of vectors to multiply. */
-  const std::vector<std::string> recognized_acl_ {"ax_", "ay_", "ax_", "a_"};
-  const std::vector<std::string> recognized_acl  {"ax",  "ay",  "ax",  "a"};
-  const std::vector<std::string> recognized_vel  {"vx",  "vy",  "vx",  "v"};
-  const std::vector<std::string> recognized_dsp  {"ux",  "uy",  "ux",  "u"};
+  /* A ghosted state is advanced on the local vectors, the ghosts along with the owned dofs. */
+  Vec field::*state = GhostedState() ? &field::mLoc : &field::mGlb;
+
+  /* On device vectors, three vector operations per component instead of a host loop, which would copy the
+   * fields off the device and back each step. */
+  if (mVecKernelUpdate) {
+    for (PetscInt i = 0; i < 4; i++) {
+      if (!fields.count(recognized_acl[i])) { continue; }
+      Vec a = (*fields[recognized_acl[i]]).*state, v = (*fields[recognized_vel[i]]).*state;
+      if (mInverseMassPending) { VecPointwiseMult(a, a, (*fields[FieldId::mi]).*state); }
+      VecAXPBYPCZ(v, acl_factor, acl_factor, 1, a, (*fields[recognized_acl_[i]]).*state);
+      VecAXPBYPCZ((*fields[recognized_dsp[i]]).*state, mDt, dsp_factor, 1, v, a);
+      swapFieldVectors(fields[recognized_acl[i]], fields[recognized_acl_[i]]);
+    }
+    mInverseMassPending = false;
+    time += mDt;
+    return std::tuple<FieldDict, PetscScalar> (std::move(fields), time);
+  }
+
+  const PetscScalar *mi = NULL;
+  if (mInverseMassPending) { VecGetArrayRead((*fields[FieldId::mi]).*state, &mi); }
 
-  /* Advance all recognized fields. */
+  /* Advance all recognized fields, in a single pass over each component. */
+  // a_{n+1} = M^-1 a_{n+1}
   // v_{n+1} = v_n + 1/2*dt*a_{n+1} + 1/2*dt*a_n
-  // u_{n+1} = u_n + dt*v_n + dt^2/2*a_{n+1}
-  // a_n = a_{n+1}
-  for (PetscInt i = 0; i < recognized_acl.size(); i++) {
+  // u_{n+1} = u_n + dt*v_{n+1} + dt^2/2*a_{n+1}
+  for (PetscInt i = 0; i < 4; i++) {
     if (fields.count(recognized_acl[i])) {
-      VecAXPBYPCZ(fields[recognized_vel[i]]->mGlb, acl_factor, acl_factor, 1.0,
-                  fields[recognized_acl[i]]->mGlb, fields[recognized_acl_[i]]->mGlb);
-      VecAXPBYPCZ(fields[recognized_dsp[i]]->mGlb, mDt, dsp_factor, 1.0,
-                  fields[recognized_vel[i]]->mGlb, fields[recognized_acl[i]]->mGlb);
-      VecCopy(fields[recognized_acl[i]]->mGlb, fields[recognized_acl_[i]]->mGlb);
+
+      PetscInt size; VecGetLocalSize((*fields[recognized_acl[i]]).*state, &size);
+      PetscScalar *a, *a_, *v, *u;
+      VecGetArray((*fields[recognized_acl[i]]).*state, &a);
+      VecGetArray((*fields[recognized_acl_[i]]).*state, &a_);
+      VecGetArray((*fields[recognized_vel[i]]).*state, &v);
+      VecGetArray((*fields[recognized_dsp[i]]).*state, &u);
+
+      if (mi) {
+        for (PetscInt j = 0; j < size; j++) {
+          a[j] *= mi[j];
+          v[j] += acl_factor * (a[j] + a_[j]);
+          u[j] += mDt * v[j] + dsp_factor * a[j];
+        }
+      } else {
+        for (PetscInt j = 0; j < size; j++) {
+          v[j] += acl_factor * (a[j] + a_[j]);
+          u[j] += mDt * v[j] + dsp_factor * a[j];
+        }
+      }
+
+      VecRestoreArray((*fields[recognized_dsp[i]]).*state, &u);
+      VecRestoreArray((*fields[recognized_vel[i]]).*state, &v);
+      VecRestoreArray((*fields[recognized_acl_[i]]).*state, &a_);
+      VecRestoreArray((*fields[recognized_acl[i]]).*state, &a);
+
+      // a_n = a_{n+1}. The old a_n is no longer needed, and a_{n+1} is zeroed before the
+      // next assembly, so just rotate the buffers instead of copying.
+      swapFieldVectors(fields[recognized_acl[i]], fields[recognized_acl_[i]]);
+
     } else { continue; }
   }
-  
+
+  if (mi) { VecRestoreArrayRead((*fields[FieldId::mi]).*state, &mi); }
+  mInverseMassPending = false;
+
   time += mDt;
   return std::tuple<FieldDict, PetscScalar> (std::move(fields), time);
 
 }
+
+void Order2Newmark::prepareOutput(FieldDict &fields) {
+
+  /* The a buffer is zeroed before it is assembled into again, so it may just as well hold a copy. */
+  for (PetscInt i = 0; i < 4; i++) {
+    if (!fields.count(recognized_acl_[i])) { continue; }
+    VecCopy(fields[recognized_acl_[i]]->mGlb, fields[recognized_acl[i]]->mGlb);
+  }
+
+}
+
+FieldDict Order2Newmark::rewindDisplacement(FieldDict fields) {
+
+  /* From u_{n+1} = u_n + dt*v_n + dt^2/2*a_n and u_n = u_{n-1} + dt*v_n - dt^2/2*a_n. */
+  // u_{n-1} = u_{n+1} - 2*dt*v_n
+  for (PetscInt i = 0; i < 4; i++) {
+    if (!fields.count(recognized_acl[i])) { continue; }
+    VecAXPY(fields[recognized_dsp[i]]->mGlb, -2 * mDt, fields[recognized_vel[i]]->mGlb);
+  }
+  return fields;
+
+}
+
+std::tuple<FieldDict, PetscScalar> Order2Newmark::takeTimeStepBack(
+    FieldDict fields, PetscScalar time, std::unique_ptr<Options> const &options) {
+
+  PetscReal acl_factor = (1.0/2.0) * mDt;
+  PetscReal dsp_factor = (1.0/2.0) * (mDt * mDt);
+
+  if (mVecKernelUpdate) {
+    for (PetscInt i = 0; i < 4; i++) {
+      if (!fields.count(recognized_acl[i])) { continue; }
+      Vec a = fields[recognized_acl[i]]->mGlb, v = fields[recognized_vel[i]]->mGlb;
+      if (mInverseMassPending) { VecPointwiseMult(a, a, fields[FieldId::mi]->mGlb); }
+      VecAXPBYPCZ(v, -acl_factor, -acl_factor, 1, a, fields[recognized_acl_[i]]->mGlb);
+      VecAXPBYPCZ(fields[recognized_dsp[i]]->mGlb, mDt, dsp_factor, 1, v, a);
+      swapFieldVectors(fields[recognized_acl[i]], fields[recognized_acl_[i]]);
+    }
+    mInverseMassPending = false;
+    time -= mDt;
+    return std::tuple<FieldDict, PetscScalar> (std::move(fields), time);
+  }
+
+  const PetscScalar *mi = NULL;
+  if (mInverseMassPending) { VecGetArrayRead(fields[FieldId::mi]->mGlb, &mi); }
+
+  /* The forward update, solved for the old velocity, with the displacement rewound one step too far. */
+  // a_{n-1} = M^-1 a_{n-1}
+  // v_{n-1} = v_n - 1/2*dt*a_n - 1/2*dt*a_{n-1}
+  // u_n = u_{n-1} + dt*v_{n-1} + dt^2/2*a_{n-1}
+  for (PetscInt i = 0; i < 4; i++) {
+    if (!fields.count(recognized_acl[i])) { continue; }
+
+    PetscInt size; VecGetLocalSize(fields[recognized_acl[i]]->mGlb, &size);
+    PetscScalar *a, *a_, *v, *u;
+    VecGetArray(fields[recognized_acl[i]]->mGlb, &a);
+    VecGetArray(fields[recognized_acl_[i]]->mGlb, &a_);
+    VecGetArray(fields[recognized_vel[i]]->mGlb, &v);
+    VecGetArray(fields[recognized_dsp[i]]->mGlb, &u);
+    for (PetscInt j = 0; j < size; j++) {
+      if (mi) { a[j] *= mi[j]; }
+      v[j] -= acl_factor * (a[j] + a_[j]);
+      u[j] += mDt * v[j] + dsp_factor * a[j];
+    }
+    VecRestoreArray(fields[recognized_dsp[i]]->mGlb, &u);
+    VecRestoreArray(fields[recognized_vel[i]]->mGlb, &v);
+    VecRestoreArray(fields[recognized_acl_[i]]->mGlb, &a_);
+    VecRestoreArray(fields[recognized_acl[i]]->mGlb, &a);
+
+    swapFieldVectors(fields[recognized_acl[i]], fields[recognized_acl_[i]]);
+  }
+
+  if (mi) { VecRestoreArrayRead(fields[FieldId::mi]->mGlb, &mi); }
+  mInverseMassPending = false;
+
+  time -= mDt;
+  return std::tuple<FieldDict, PetscScalar> (std::move(fields), time);
+
+}
+
+void Order2Newmark::swapFieldVectors(std::unique_ptr<field> &a, std::unique_ptr<field> &b) {
+
+  /* A local vector which only one of them has is scratch for the assembly, and stays with its field. */
+  std::swap(a->mGlb, b->mGlb);
+  if (a->mLoc && b->mLoc) { std::swap(a->mLoc, b->mLoc); }
+
+  /* Keep output names attached to the right field. */
+  PetscObjectSetName((PetscObject) a->mGlb, a->mName.c_str());
+  PetscObjectSetName((PetscObject) b->mGlb, b->mName.c_str());
+
+}
+
 Order2Newmark::Order2Newmark(const std::unique_ptr<Options> &options) : Problem(options) {
   mDt = options->TimeStep();
+  mInverseMassPending = false;
+  mVecKernelUpdate = options->FieldVecType() != "standard";
 }
@@ -0,0 +1,196 @@
+#include <Mesh/Mesh.h>
+#include <Problem/Order2NewmarkLts.h>
+#include <Utilities/Logging.h>
+#include <Utilities/Options.h>
+
+/* Recognized displacement and acceleration fields, one per component. */
+const static FieldId recognized_dsp[] {FieldId::ux, FieldId::uy, FieldId::uz, FieldId::u};
+const static FieldId recognized_acl[] {FieldId::ax, FieldId::ay, FieldId::az, FieldId::a};
+
+Order2NewmarkLts::Order2NewmarkLts(const std::unique_ptr<Options> &options) : Order2Newmark(options) {
+  mMaxLevels = options->MaxTimeStepLevels();
+  mDM = nullptr;
+}
+
+Order2NewmarkLts::~Order2NewmarkLts() {
+  for (auto work: {&mState, &mStatePrev, &mFrozen, &mAcl}) {
+    for (PetscInt l = 1; l < work->size(); l++) {
+      for (auto c: mComps) { VecDestroy(&(*work)[l][c]); }
+    }
+  }
+}
+
+void Order2NewmarkLts::binElementLevels(ElemVec const &elements) {
+
+  /* Smallest level at which each element is stable. */
+  PetscInt num_unstable = 0;
+  std::vector<PetscInt> num_per_level(mMaxLevels, 0);
+  mElementLevel.clear();
+  for (auto &elm: elements) {
+    PetscReal dt_elm = elm->CFL_estimate();
+    PetscInt level = 0;
+    while (level < mMaxLevels - 1 && mDt / (1 << level) > dt_elm) { level++; }
+    if (mDt / (1 << level) > dt_elm) { num_unstable++; }
+    mElementLevel.push_back(level);
+    num_per_level[level]++;
+  }
+
+  MPI_Allreduce(MPI_IN_PLACE, &num_unstable, 1, MPIU_INT, MPI_SUM, PETSC_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, num_per_level.data(), mMaxLevels, MPIU_INT, MPI_SUM, PETSC_COMM_WORLD);
+  for (PetscInt l = 0; l < mMaxLevels; l++) {
+    if (num_per_level[l]) {
+      LOG() << "Time step level " << l << " (dt = " << mDt / (1 << l) << "): " << num_per_level[l]
+            << " elements.";
+    }
+  }
+  if (num_unstable) {
+    LOG() << "Warning: " << num_unstable << " elements exceed their CFL estimate on the finest time "
+        "step level. Increase --max-time-step-levels, or decrease --time-step.";
+  }
+
+}
+
+void Order2NewmarkLts::allocateWorkVectors(FieldDict &fields) {
+
+  for (auto work: {&mState, &mStatePrev, &mFrozen, &mAcl}) {
+    for (PetscInt l = 1; l < work->size(); l++) {
+      for (auto c: mComps) { VecDestroy(&(*work)[l][c]); }
+    }
+  }
+
+  mComps.clear();
+  for (PetscInt c = 0; c < 4; c++) { if (fields.count(recognized_acl[c])) { mComps.push_back(c); } }
+  for (auto work: {&mState, &mStatePrev, &mFrozen, &mAcl}) {
+    work->resize(NumLevels());
+    for (PetscInt l = 1; l < NumLevels(); l++) {
+      for (auto c: mComps) { VecDuplicate(fields[recognized_acl[c]]->mGlb, &(*work)[l][c]); }
+    }
+  }
+
+}
+
+FieldDict Order2NewmarkLts::initializeGlobalDofs(ElemVec const &elements,
+                                                 std::unique_ptr<Mesh> &mesh) {
+
+  binElementLevels(elements);
+
+  /* Set up fields and the (levelled) assembly plan. */
+  FieldDict fields = Order2Newmark::initializeGlobalDofs(elements, mesh);
+  mDM = mesh->DistributedMesh();
+
+  /* Work vectors for each sub-cycled level. */
+  allocateWorkVectors(fields);
+
+  return fields;
+
+}
+
+FieldDict Order2NewmarkLts::reinitializeGlobalDofs(ElemVec const &elements, std::unique_ptr<Mesh> &mesh,
+                                                   FieldDict fields) {
+
+  /* The new material may move elements to other levels, and then the dofs of the levels change too. */
+  std::vector<PetscInt> prev_level = mElementLevel;
+  binElementLevels(elements);
+  PetscInt changed = mElementLevel != prev_level;
+  MPI_Allreduce(MPI_IN_PLACE, &changed, 1, MPIU_INT, MPI_MAX, PETSC_COMM_WORLD);
+
+  fields = Order2Newmark::reinitializeGlobalDofs(elements, mesh, std::move(fields));
+  if (changed) {
+    initializeAssemblyPlan(elements, mesh->DistributedMesh(), mesh->MeshSection(), mElementLevel);
+    allocateWorkVectors(fields);
+  }
+
+  return fields;
+
+}
+
+std::tuple<FieldDict, PetscScalar> Order2NewmarkLts::takeTimeStep(
+    FieldDict fields, PetscScalar time, std::unique_ptr<Options> const &options) {
+
+  if (NumLevels() > 1) {
+
+    /* assembleIntoGlobalDof gave the (level 0) acceleration. Filter it here, as the finer
+     * levels need it before the Newmark update. */
+    if (mInverseMassPending) {
+      for (auto c: mComps) {
+        VecPointwiseMult(fields[recognized_acl[c]]->mGlb, fields[recognized_acl[c]]->mGlb,
+                         fields[FieldId::mi]->mGlb);
+      }
+      mInverseMassPending = false;
+    }
+
+    /* Level 0 is frozen over the whole step, while the finer levels are sub-cycled. */
+    std::array<Vec, 4> u, a;
+    for (auto c: mComps) {
+      u[c] = fields[recognized_dsp[c]]->mGlb;
+      a[c] = fields[recognized_acl[c]]->mGlb;
+    }
+    subCycle(1, u, a, mDt, a, fields, time);
+
+  }
+
+  /* Newmark update with the effective acceleration. */
+  return Order2Newmark::takeTimeStep(std::move(fields), time, options);
+
+}
+
+void Order2NewmarkLts::subCycle(const PetscInt level, std::array<Vec, 4> const &u,
+                                std::array<Vec, 4> const &z, const PetscReal dt,
+                                std::array<Vec, 4> const &acl, FieldDict &fields,
+                                const PetscReal time) {
+
+  std::array<Vec, 4> &w = mState[level], &w_ = mStatePrev[level], &zl = mFrozen[level], &al = mAcl[level];
+  const PetscReal h = dt / 2;
+
+  for (auto c: mComps) {
+    VecCopy(z[c], zl[c]);
+    VecCopy(u[c], w[c]);
+    VecCopy(u[c], w_[c]);
+  }
+
+  /* First sub-step. The state is symmetric in time about the start of the step. */
+  // w_1 = w_0 + h^2/2 a(w_0)
+  levelAcceleration(level, w, zl, h, al, fields, time);
+  for (auto c: mComps) { VecAXPY(w[c], 0.5 * h * h, al[c]); }
+
+  /* Second sub-step. */
+  // w_2 = 2 w_1 - w_0 + h^2 a(w_1)
+  levelAcceleration(level, w, zl, h, al, fields, time);
+  for (auto c: mComps) { VecAXPBYPCZ(w_[c], 2.0, h * h, -1.0, w[c], al[c]); }
+
+  /* Effective acceleration over the parent step, u_{n+1} - 2u_n + u_{n-1} = dt^2 a. */
+  // a = 2 (w_2 - u) / dt^2
+  for (auto c: mComps) {
+    VecWAXPY(acl[c], -1.0, u[c], w_[c]);
+    VecScale(acl[c], 2.0 / (dt * dt));
+  }
+
+}
+
+void Order2NewmarkLts::levelAcceleration(const PetscInt level, std::array<Vec, 4> const &u,
+                                         std::array<Vec, 4> const &z, const PetscReal dt,
+                                         std::array<Vec, 4> const &acl, FieldDict &fields,
+                                         const PetscReal time) {
+
+  /* Point the displacement and acceleration fields at the sub-step vectors, and assemble. */
+  std::array<Vec, 4> dsp_glb, acl_glb;
+  for (auto c: mComps) {
+    dsp_glb[c] = fields[recognized_dsp[c]]->mGlb; fields[recognized_dsp[c]]->mGlb = u[c];
+    acl_glb[c] = fields[recognized_acl[c]]->mGlb; fields[recognized_acl[c]]->mGlb = acl[c];
+  }
+  assembleLevel(fields, level, time, 0, mDM);
+  for (auto c: mComps) {
+    fields[recognized_dsp[c]]->mGlb = dsp_glb[c];
+    fields[recognized_acl[c]]->mGlb = acl_glb[c];
+  }
+
+  // a = z - M^-1 K_level u
+  for (auto c: mComps) {
+    VecPointwiseMult(acl[c], acl[c], fields[FieldId::mi]->mGlb);
+    VecAXPY(acl[c], 1.0, z[c]);
+  }
+
+  /* Finer levels are sub-cycled again. */
+  if (level + 1 < NumLevels()) { subCycle(level + 1, u, acl, dt, acl, fields, time); }
+
+}
@@ -0,0 +1,74 @@
+#include <Mesh/Mesh.h>
+#include <Problem/Order4Newmark.h>
+#include <Utilities/Options.h>
+
+/* Recognized displacement and acceleration fields, one per component. */
+const static FieldId recognized_dsp[] {FieldId::ux, FieldId::uy, FieldId::uz, FieldId::u};
+const static FieldId recognized_acl[] {FieldId::ax, FieldId::ay, FieldId::az, FieldId::a};
+
+Order4Newmark::Order4Newmark(const std::unique_ptr<Options> &options) : Order2Newmark(options) {
+  mDM = nullptr;
+  mShiftedGlb.fill(nullptr); mShiftedLoc.fill(nullptr);
+}
+
+Order4Newmark::~Order4Newmark() {
+  for (PetscInt c = 0; c < 4; c++) { VecDestroy(&mShiftedGlb[c]); VecDestroy(&mShiftedLoc[c]); }
+}
+
+FieldDict Order4Newmark::initializeGlobalDofs(ElemVec const &elements, std::unique_ptr<Mesh> &mesh) {
+
+  FieldDict fields = Order2Newmark::initializeGlobalDofs(elements, mesh);
+  mDM = mesh->DistributedMesh();
+
+  for (PetscInt c = 0; c < 4; c++) {
+    VecDestroy(&mShiftedGlb[c]); VecDestroy(&mShiftedLoc[c]);
+    if (!fields.count(recognized_acl[c])) { continue; }
+    VecDuplicate(fields[recognized_dsp[c]]->mGlb, &mShiftedGlb[c]);
+    VecDuplicate(fields[recognized_dsp[c]]->mLoc, &mShiftedLoc[c]);
+  }
+
+  return fields;
+
+}
+
+void Order4Newmark::correctAcceleration(FieldDict &fields, const PetscReal time, Vec field::*state) {
+
+  /* The displacement shifted by the filtered acceleration, in place of the displacement. A ghosted state has
+   * the same acceleration on all copies of a dof, so the shifted one is current on the ghosts too. */
+  // w = u_n + dt^2/12 M^-1 a_n
+  std::array<Vec, 4> &shifted = state == &field::mLoc ? mShiftedLoc : mShiftedGlb;
+  for (PetscInt c = 0; c < 4; c++) {
+    if (!fields.count(recognized_acl[c])) { continue; }
+    Vec a = (*fields[recognized_acl[c]]).*state;
+    if (mInverseMassPending) { VecPointwiseMult(a, a, (*fields[FieldId::mi]).*state); }
+    VecWAXPY(shifted[c], mDt * mDt / 12, a, (*fields[recognized_dsp[c]]).*state);
+    std::swap((*fields[recognized_dsp[c]]).*state, shifted[c]);
+  }
+
+  /* The same forces at the shifted displacement, which leaves M^-1 a = a_n + dt^2/12 A a_n. The receivers
+   * already recorded this step. */
+  assembleLevel(fields, ElementBatch::Unrecorded, time, LastTimeIndex(), mDM);
+  for (PetscInt c = 0; c < 4; c++) {
+    if (!fields.count(recognized_acl[c])) { continue; }
+    std::swap((*fields[recognized_dsp[c]]).*state, shifted[c]);
+  }
+  mInverseMassPending = true;
+
+}
+
+std::tuple<FieldDict, PetscScalar> Order4Newmark::takeTimeStep(
+    FieldDict fields, PetscScalar time, std::unique_ptr<Options> const &options) {
+
+  correctAcceleration(fields, time, GhostedState() ? &field::mLoc : &field::mGlb);
+  return Order2Newmark::takeTimeStep(std::move(fields), time, options);
+
+}
+
+std::tuple<FieldDict, PetscScalar> Order4Newmark::takeTimeStepBack(
+    FieldDict fields, PetscScalar time, std::unique_ptr<Options> const &options) {
+
+  /* The forward steps advanced with the corrected accelerations, so reversing them takes the same. */
+  correctAcceleration(fields, time, &field::mGlb);
+  return Order2Newmark::takeTimeStepBack(std::move(fields), time, options);
+
+}
@@ -0,0 +1,220 @@
+#include <Problem/PeriodicBoundaries.h>
+#include <Element/Element.h>
+#include <Mesh/Mesh.h>
+#include <Utilities/Logging.h>
+#include <Utilities/StaticKdTree.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <stdexcept>
+
+std::unique_ptr<PeriodicBoundaries> PeriodicBoundaries::Build(ElemVec const &elements,
+                                                              std::unique_ptr<Mesh> const &mesh) {
+
+  const std::vector<std::pair<PetscInt, PetscInt>> &pairs = mesh->PeriodicSideSets();
+  if (pairs.empty()) { return nullptr; }
+  if (pairs.size() > 32) { throw std::runtime_error("At most 32 pairs of --periodic-boundaries are supported."); }
+
+  int size; MPI_Comm_size(PETSC_COMM_WORLD, &size);
+  DM dm = mesh->DistributedMesh();
+  const PetscInt dim = mesh->NumberDimensions();
+  const PetscInt nc = mesh->NumberComponents();
+
+  /* Global (block) index of every element's dofs, pulled through the closure as in the assembly plan. */
+  Vec glb, loc; DMGetGlobalVector(dm, &glb); DMGetLocalVector(dm, &loc);
+  PetscInt start, num_glb; VecGetOwnershipRange(glb, &start, NULL); VecGetLocalSize(glb, &num_glb);
+  PetscScalar *val; VecGetArray(glb, &val);
+  for (PetscInt i = 0; i < num_glb; i++) { val[i] = start + i; }
+  VecRestoreArray(glb, &val);
+  DMGlobalToLocalBegin(dm, glb, INSERT_VALUES, loc);
+  DMGlobalToLocalEnd(dm, glb, INSERT_VALUES, loc);
+  DMRestoreGlobalVector(dm, &glb);
+
+  /* The nodes of the local elements on the faces of the periodic side sets. An element is convex, so its nodes
+   * in the plane of one of its faces are those on the face. */
+  Vec coord; DMGetCoordinatesLocal(dm, &coord);
+  PetscSection coord_section; DMGetCoordinateSection(dm, &coord_section);
+  std::map<PetscInt, Node> nodes;
+  for (size_t e = 0; e < elements.size(); e++) {
+    PetscInt csize; DMPlexGetConeSize(dm, elements[e]->Num(), &csize);
+    const PetscInt *cone; DMPlexGetCone(dm, elements[e]->Num(), &cone);
+    Eigen::MatrixXd pts;
+    std::vector<PetscInt> dof;
+    for (PetscInt i = 0; i < csize; i++) {
+      unsigned long long on = 0;
+      for (size_t p = 0; p < pairs.size(); p++) {
+        if (pairs[p].first >= 0 && mesh->OnSideSet(cone[i], pairs[p].first)) { on |= 1ULL << (2 * p); }
+        if (pairs[p].second >= 0 && mesh->OnSideSet(cone[i], pairs[p].second)) { on |= 1ULL << (2 * p + 1); }
+      }
+      if (!on) { continue; }
+
+      if (!pts.size()) {
+        pts = elements[e]->NodalCoordinates();
+        const auto &closure = elements[e]->ClsMap();
+        PetscScalar *cls = NULL; PetscInt num_cls;
+        DMPlexVecGetClosure(dm, mesh->MeshSection(), loc, elements[e]->Num(), &num_cls, &cls);
+        dof.resize(closure.size());
+        for (PetscInt j = 0; j < closure.size(); j++) {
+          dof[closure(j)] = static_cast<PetscInt> (PetscRealPart(cls[j * nc]) + 0.5) / nc;
+        }
+        DMPlexVecRestoreClosure(dm, mesh->MeshSection(), loc, elements[e]->Num(), NULL, &cls);
+      }
+
+      /* Normal of the edge, or of the face through its first three vertices. */
+      PetscInt num_crd; PetscReal *crd = NULL;
+      DMPlexVecGetClosure(dm, coord_section, coord, cone[i], &num_crd, &crd);
+      Eigen::Vector3d x0 = Eigen::Vector3d::Zero(), a = x0, b = x0, n;
+      for (PetscInt d = 0; d < dim; d++) {
+        x0(d) = crd[d]; a(d) = crd[dim + d] - crd[d]; b(d) = dim == 3 ? crd[2 * dim + d] - crd[d] : 0;
+      }
+      DMPlexVecRestoreClosure(dm, coord_section, coord, cone[i], &num_crd, &crd);
+      n = dim == 2 ? Eigen::Vector3d(-a(1), a(0), 0) : Eigen::Vector3d(a.cross(b));
+      const double tol = 1e-6 * a.norm();
+      n.normalize();
+
+      for (PetscInt j = 0; j < pts.rows(); j++) {
+        Eigen::Vector3d x = Eigen::Vector3d::Zero();
+        x.head(dim) = pts.row(j).transpose();
+        if (std::abs(n.dot(x - x0)) > tol) { continue; }
+        auto found = nodes.find(dof[j]);
+        if (found != nodes.end()) { found->second.on |= on; continue; }
+        Node &node = nodes[dof[j]];
+        for (PetscInt d = 0; d < 3; d++) { node.x[d] = x(d); }
+        node.dof = dof[j]; node.on = on;
+      }
+    }
+  }
+  DMRestoreLocalVector(dm, &loc);
+
+  /* The translation of each pair, from the bounding boxes of its side sets (over all ranks). */
+  const PetscInt num_pairs = pairs.size();
+  std::vector<double> lower(2 * num_pairs * 3, std::numeric_limits<double>::max());
+  for (auto &entry: nodes) {
+    const Node &node = entry.second;
+    for (PetscInt s = 0; s < 2 * num_pairs; s++) {
+      if (!(node.on >> s & 1)) { continue; }
+      for (PetscInt d = 0; d < 3; d++) { lower[3 * s + d] = std::min(lower[3 * s + d], node.x[d]); }
+    }
+  }
+  MPI_Allreduce(MPI_IN_PLACE, lower.data(), lower.size(), MPI_DOUBLE, MPI_MIN, PETSC_COMM_WORLD);
+  std::vector<Eigen::Vector3d> shift(num_pairs);
+  double tol = std::numeric_limits<double>::max();
+  for (PetscInt p = 0; p < num_pairs; p++) {
+    if (lower[6 * p] == std::numeric_limits<double>::max() || lower[6 * p + 3] == std::numeric_limits<double>::max()) {
+      throw std::runtime_error("Pair " + std::to_string(p) + " of --periodic-boundaries has a side set without "
+                               "any face in the mesh.");
+    }
+    for (PetscInt d = 0; d < 3; d++) { shift[p](d) = lower[6 * p + d] - lower[6 * p + 3 + d]; }
+    tol = std::min(tol, 1e-6 * shift[p].norm());
+  }
+
+  /* All nodes, from all ranks. These are only the nodes on the periodic side sets. */
+  std::vector<Node> mine;
+  for (auto &entry: nodes) { mine.push_back(entry.second); }
+  int num_bytes = mine.size() * sizeof(Node);
+  std::vector<int> lens(size), dsp(size, 0);
+  MPI_Allgather(&num_bytes, 1, MPI_INT, lens.data(), 1, MPI_INT, PETSC_COMM_WORLD);
+  for (int r = 1; r < size; r++) { dsp[r] = dsp[r - 1] + lens[r - 1]; }
+  std::vector<Node> all((dsp[size - 1] + lens[size - 1]) / sizeof(Node));
+  MPI_Allgatherv(mine.data(), num_bytes, MPI_BYTE, all.data(), lens.data(), dsp.data(), MPI_BYTE,
+                 PETSC_COMM_WORLD);
+  std::vector<PetscReal> locations;
+  for (auto &node: all) { locations.insert(locations.end(), node.x, node.x + 3); }
+  StaticKdTree tree;
+  tree.build(3, locations.data(), all.size());
+
+  /* The master of each local node on a slave side set: translate it onto the master side set of the pair, until
+   * it reaches a node on no slave side set. The same node may be held by several ranks (and elements), each with
+   * the side sets it knows of, so those of all copies are merged. */
+  std::unique_ptr<PeriodicBoundaries> periodic(new PeriodicBoundaries());
+  MatCreateAIJ(PETSC_COMM_WORLD, num_glb, num_glb, PETSC_DETERMINE, PETSC_DETERMINE, 0, NULL, 0, NULL,
+               &periodic->mMasters);
+  MatSetOption(periodic->mMasters, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);
+  std::vector<PetscInt> found;
+  const PetscScalar one = 1;
+  for (auto &node: mine) {
+    Eigen::Vector3d x(node.x[0], node.x[1], node.x[2]);
+    PetscInt master = node.dof;
+    for (PetscInt step = 0; ; step++) {
+      tree.within(x.data(), tol, found);
+      unsigned long long on = 0;
+      for (auto i: found) { on |= all[i].on; }
+      PetscInt p = 0;
+      while (p < num_pairs && !(on >> (2 * p + 1) & 1)) { p++; }
+      if (p == num_pairs) { break; }
+      if (step == num_pairs) {
+        throw std::runtime_error("The periodic side sets of --periodic-boundaries map a node back onto itself.");
+      }
+      x += shift[p];
+      tree.within(x.data(), tol, found);
+      if (found.empty()) {
+        throw std::runtime_error("The node at (" + std::to_string(node.x[0]) + ", " + std::to_string(node.x[1]) +
+                                 ", " + std::to_string(node.x[2]) + ") of a slave side set of --periodic-boundaries "
+                                 "has no node on its master side set. The meshes of the side sets must match.");
+      }
+      master = all[found[0]].dof;
+    }
+    if (master == node.dof) { continue; }
+    for (PetscInt c = 0; c < nc; c++) {
+      PetscInt row = node.dof * nc + c, col = master * nc + c;
+      MatSetValues(periodic->mMasters, 1, &row, 1, &col, &one, INSERT_VALUES);
+    }
+  }
+  MatAssemblyBegin(periodic->mMasters, MAT_FINAL_ASSEMBLY);
+  MatAssemblyEnd(periodic->mMasters, MAT_FINAL_ASSEMBLY);
+
+  /* The slave dofs of this rank are the owned rows with a master. */
+  PetscInt row_start, row_end; MatGetOwnershipRange(periodic->mMasters, &row_start, &row_end);
+  for (PetscInt r = row_start; r < row_end; r++) {
+    PetscInt ncols; MatGetRow(periodic->mMasters, r, &ncols, NULL, NULL);
+    if (ncols) { periodic->mSlaves.push_back(r - row_start); }
+    MatRestoreRow(periodic->mMasters, r, &ncols, NULL, NULL);
+  }
+  PetscInt num_slaves = periodic->mSlaves.size() / nc;
+  MPI_Allreduce(&num_slaves, &periodic->mNumSlaves, 1, MPIU_INT, MPI_SUM, PETSC_COMM_WORLD);
+  if (!periodic->mNumSlaves) {
+    throw std::runtime_error("The side sets of --periodic-boundaries hold no nodes to identify.");
+  }
+  MatCreateVecs(periodic->mMasters, NULL, &periodic->mWork);
+  LOG() << "Identified " << periodic->mNumSlaves << " periodic nodes with their masters.";
+  return periodic;
+
+}
+
+PeriodicBoundaries::~PeriodicBoundaries() {
+  if (mMasters) { MatDestroy(&mMasters); }
+  if (mWork) { VecDestroy(&mWork); }
+}
+
+void PeriodicBoundaries::constrain(Vec u) {
+
+  /* u_s = u_m, with the other dofs left alone. */
+  MatMult(mMasters, u, mWork);
+  PetscScalar *val; const PetscScalar *w;
+  VecGetArray(u, &val); VecGetArrayRead(mWork, &w);
+  for (auto s: mSlaves) { val[s] = w[s]; }
+  VecRestoreArray(u, &val); VecRestoreArrayRead(mWork, &w);
+
+}
+
+void PeriodicBoundaries::distribute(Vec f) {
+
+  /* f_m += f_s, then f_s = 0. */
+  MatMultTranspose(mMasters, f, mWork);
+  VecAXPY(f, 1, mWork);
+  PetscScalar *val; VecGetArray(f, &val);
+  for (auto s: mSlaves) { val[s] = 0; }
+  VecRestoreArray(f, &val);
+
+}
+
+void PeriodicBoundaries::lumpMass(Vec m) {
+
+  /* The mass of the identified node is the sum of those of its copies. */
+  distribute(m);
+  PetscScalar *val; VecGetArray(m, &val);
+  for (auto s: mSlaves) { val[s] = 1; }
+  VecRestoreArray(m, &val);
+
+}
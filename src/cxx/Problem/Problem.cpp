@@ -1,22 +1,82 @@
 #include <Problem/Problem.h>
 #include <Utilities/Options.h>
 #include <Utilities/Logging.h>
+#include <Utilities/Profiler.h>
+#include <Utilities/StaticKdTree.h>
+#include <Utilities/Pool.h>
+#include <Utilities/Scratch.h>
 #include <Problem/Order2Newmark.h>
+#include <Problem/Order2NewmarkLts.h>
+#include <Problem/Order4Newmark.h>
+#include <Problem/Order2Leapfrog.h>
+#include <Problem/StaticSolver.h>
+#include <Problem/Tuner.h>
+#include <Problem/CflReport.h>
+#include <Source/Injection.h>
 #include <Mesh/Mesh.h>
+#include <Model/ExodusModel.h>
+#include <exception>
 #include <stdexcept>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <typeindex>
+#include <typeinfo>
+#include <chrono>
+#include <sstream>
+#include <fstream>
+#include <numeric>
 #include <petscviewerhdf5.h>
 
 using namespace Eigen;
 
+Problem::Problem(const std::unique_ptr<Options> &options) {
+
+  /* Assume we're not going to save a movie. */
+  mViewer = nullptr; mOutputFrame = 0;
+
+  /* Threads used in the element loop. */
+  mNumThreads = options->NumThreads();
+  mWorkStealingChunk = options->WorkStealingChunk();
+  mElementTimingEvery = options->ElementTimingEvery();
+  mNumShots = options->SimultaneousShots();
+
+  /* Halo values sent as floats, or as halves. */
+  const std::string halo_precision = options->HaloPrecision();
+  mHaloPrecision = halo_precision == "half" ? HaloExchange::Half
+                 : halo_precision == "single" ? HaloExchange::Single : HaloExchange::Double;
+  mNodeHalo = options->NodeAwareHalo();
+  mTimeHaloWaits = !options->HaloReportFile().empty();
+  mGhostedState = options->GhostedState();
+  mHaloOverlap = options->HaloOverlap();
+  mUseHangingNodes = options->HangingNodes();
+  mActivityThreshold = options->ActivityMask() ? options->ActivityThreshold() : -1;
+
+}
+
 std::unique_ptr<Problem> Problem::Factory(std::unique_ptr<Options> const &options) {
 
   std::unique_ptr<Problem> problem;
-  std::string timestep_scheme = "newmark";
+  std::string timestep_scheme = options->MaxTimeStepLevels() > 1 ? "newmark_lts" : options->TimeSteppingScheme();
   try {
 
-    if (timestep_scheme == "newmark") {
+    if (options->StaticProblem()) {
+      return std::unique_ptr<Problem> (new StaticSolver(options));
+    }
+    else if (timestep_scheme == "newmark") {
       return std::unique_ptr<Problem> (new Order2Newmark(options));
     }
+    else if (timestep_scheme == "newmark_lts") {
+      return std::unique_ptr<Problem> (new Order2NewmarkLts(options));
+    }
+    else if (timestep_scheme == "newmark4") {
+      return std::unique_ptr<Problem> (new Order4Newmark(options));
+    }
+    else if (timestep_scheme == "leapfrog") {
+      return std::unique_ptr<Problem> (new Order2Leapfrog(options));
+    }
     else
     {
       throw std::runtime_error("Runtime Error. Problem type not defined.");
@@ -35,88 +95,346 @@ ElemVec Problem::initializeElements(unique_ptr<Mesh> const &mesh,
                                     unique_ptr<ExodusModel> const &model,
                                     unique_ptr<Options> const &options) {
 
-  /* MPI rank is important for source/receiver detection. */
-  int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
-
-  /* Define variables to test for source/receiver presence. */
-  bool true_attach = true;
-  bool trial_attach = false;
-
-  /* Create a vector of sources and receivers from user options. */
-  auto srcs = Source::Factory(options);
-  auto recs = Receiver::Factory(options);
+  /* Sources from file are sampled at every time step, so the time step must be known upfront. */
+  if (options->AutomaticTimeStep() && options->SourceType() == "file") {
+    throw std::runtime_error("Error. --time-step must be set when reading sources from file.");
+  }
 
-  /* Keep local track of srcs/recs on this partition. */
-  std::vector<PetscInt> srcs_this_partition(srcs.size(), 0);
-  std::vector<PetscInt> recs_this_partition(recs.size(), 0);
+  /* Choose the kernel variants before the elements are built with them. */
+  if (options->AutoTune()) { Tuner::tune(mesh, model, options); }
 
   /* All of our (polymorphic) elements will lie here. */
   ElemVec elements;
 
-  /* Allocate all elements. */
-  for (PetscInt i = 0; i < mesh->NumberElementsLocal(); i++)
+  /* Elements of the same physics and coupling are of the same type, so the first of each type reserves room
+   * for the others in its type's pool, first touched by the threads which will assemble them. */
+  std::vector<size_t> num_of_type(Element::NumTypeCodes(), 0);
+  for (auto i: mesh->ElementOrder()) { if (mesh->ElementTypeCode(i) >= 0) { num_of_type[mesh->ElementTypeCode(i)]++; } }
+  Pool::SetNumThreads(options->NumThreads());
+
+  /* Allocate all elements, in the order given by the mesh. The pools and the shared reference elements are
+   * filled here, so this is serial. */
+  for (auto i: mesh->ElementOrder())
   {
 
-    /* Push back an appropriate element based on the mesh. */
-    elements.push_back(Element::Factory(mesh->baseElementType(),
-                                        mesh->ElementFields(i),
-                                        mesh->TotalCouplingFields(i),
-                                        options));
+    /* Push back an appropriate element based on the mesh (an unsupported one is named by the error). */
+    const PetscInt type = mesh->ElementTypeCode(i);
+    elements.push_back(type >= 0 ? Element::Factory(type, options) :
+                       Element::Factory(mesh->baseElementType(), mesh->ElementFields(i),
+                                        mesh->TotalCouplingFields(i), options));
+    if (num_of_type[type]) { elements.back()->reserveSiblings(num_of_type[type] - 1); num_of_type[type] = 0; }
 
     /* Assign a (processor-specific) number to this element. */
     elements.back()->SetNum(i);
 
-    /* Attach vertex co-ordinates from mesh. */
-    elements.back()->attachVertexCoordinates(mesh);
+  }
 
-    /* Set any boundary conditions on this element. */
-    elements.back()->setBoundaryConditions(mesh);
+  /* Only the quads integrate over r dr dz (and the mesh is a single shape, see Mesh). */
+  if (options->Axisymmetric() && !elements.empty() &&
+      elements.front()->Name().find("TensorQuad") == std::string::npos) {
+    throw std::runtime_error("--axisymmetric needs a 2D mesh of quads, not of " + elements.front()->Name() + ".");
+  }
 
-    /* Attach material properties (velocity, Cij, etc...). */
-    elements.back()->attachMaterialProperties(model);
+  /* Which elements are this rank's own, and their global numbers, if other ranks' cells overlap. */
+  mElmOwned.clear(); mElmGlbNum.clear();
+  if (mHaloOverlap) {
+    for (PetscInt i = 0; i < mesh->NumberElementsLocal(); i++) {
+      mElmOwned.push_back(mesh->ElementOwned(i)); mElmGlbNum.push_back(mesh->ElementGlobalNumber(i));
+    }
+  }
 
-    /* Prepares stiffness matrix (if necessary (e.g., tets and tris)) */
-    elements.back()->precomputeElementTerms();
-    
-    /* Test for any sources. */
-    for (auto &src: srcs) {
-      if (srcs_this_partition[src->Num()]) continue; /* Already found. */
-      srcs_this_partition[src->Num()] =
-          elements.back()->attachSource(src, trial_attach)   ? rank : 0;
+  /* The points of the injection boundaries are looked up while their elements are set up. */
+  if (!options->InjectionBoundaries().empty()) { Injection::Open(options); }
+
+  /* The rest of the setup only reads the mesh (what was extracted when it was distributed) and the model, and
+   * writes the element itself, so the elements are set up concurrently. An exception leaves the loop through
+   * the first error, which is rethrown after it. */
+  Scratch::Reserve(options->NumThreads());
+  std::exception_ptr error;
+  #pragma omp parallel for num_threads(options->NumThreads()) schedule(static)
+  for (PetscInt e = 0; e < elements.size(); e++) {
+    try {
+
+      /* Attach vertex co-ordinates from mesh. */
+      elements[e]->attachVertexCoordinates(mesh);
+
+      /* Set any boundary conditions on this element. */
+      elements[e]->setBoundaryConditions(mesh);
+
+      /* Attach material properties (velocity, Cij, etc...). */
+      elements[e]->attachMaterialProperties(model);
+
+      /* Prepares stiffness matrix (if necessary (e.g., tets and tris)) */
+      elements[e]->precomputeElementTerms();
+
+    } catch (...) {
+      #pragma omp critical
+      { if (!error) { error = std::current_exception(); } }
     }
+  }
+  if (error) { std::rethrow_exception(error); }
+  if (Injection::Active()) { Injection::Finalize(); }
+
+  /* Keep the material at the integration points for later runs, unless it was just read. */
+  if (!options->MaterialCacheFile().empty()) {
+    PetscInt num_pnt = elements.empty() ? 0 : elements.front()->NumIntPnt();
+    MPI_Allreduce(MPI_IN_PLACE, &num_pnt, 1, MPIU_INT, MPI_MAX, PETSC_COMM_WORLD);
+    if (!model->HasMaterialCache(num_pnt)) {
+      std::set<std::string> all_names;
+      for (auto &elm: elements) {
+        for (auto &name: elm->MaterialParameterNames()) { all_names.insert(name); }
+      }
+      std::vector<std::string> names(all_names.begin(), all_names.end());
+      std::vector<PetscInt> model_elms;
+      std::vector<PetscReal> values;
+      for (auto &elm: elements) {
+        if (mesh->ModelElement(elm->Num()) < 0 || !mesh->ElementOwned(elm->Num())) continue;
+        model_elms.push_back(mesh->ModelElement(elm->Num()));
+        auto elm_names = elm->MaterialParameterNames();
+        for (auto &name: names) {
+          if (std::find(elm_names.begin(), elm_names.end(), name) == elm_names.end()) {
+            values.insert(values.end(), num_pnt, std::numeric_limits<PetscReal>::quiet_NaN());
+          } else {
+            Eigen::VectorXd par = elm->MaterialParameterAtIntPts(name);
+            values.insert(values.end(), par.data(), par.data() + num_pnt);
+          }
+        }
+      }
+      model->writeMaterialCache(num_pnt, model_elms, names, values);
+    }
+  }
 
-    /* Test for any receivers. */
-    for (auto &rec: recs) {
-      if (recs_this_partition[rec->Num()]) continue; /* Already found. */
-      recs_this_partition[rec->Num()] =
-          elements.back()->attachReceiver(rec, trial_attach) ? rank : 0;
+  /* Now that all material parameters are attached, check the time step against the CFL
+   * condition, or choose it if none was given. */
+  PetscReal dt_stable = stableTimeStep(elements, options);
+  if (options->AutomaticTimeStep()) {
+    if (!std::isfinite(dt_stable) || dt_stable <= 0) {
+      throw std::runtime_error("Error. Could not estimate a stable time step. Set --time-step.");
     }
+    options->SetTimeStep(dt_stable);
+    SetTimeStep(options->TimeStep());
+    LOG() << "Using a time step of " << options->TimeStep() << " (stable estimate " << dt_stable << ").";
+  } else if (options->TimeStep() > dt_stable) {
+    LOG() << "Warning: --time-step " << options->TimeStep() << " exceeds the estimated stable time step "
+          << dt_stable << ". The simulation may become unstable.";
+  }
+  if (options->CflReport() || !options->CflReportFile().empty()) { CflReport::report(elements, mesh, options); }
+
+  /* Sources and receivers. These come after the time step, which sizes the receiver storage. */
+  attachSourcesAndReceivers(elements, options);
+  if (mActivityThreshold >= 0) { initializeActivityMask(elements, mesh, options); }
+
+  /* If we want to save a solution, initialize this here. A selection of the dofs (or lower precision) needs
+   * a writer of our own, which picks the dofs once they are laid out (see initializeAssemblyPlan). */
+  if (options->SaveMovie() && Movie::Selective(options)) {
+    mMovie.reset(new Movie(options, mesh, model));
+  } else if (options->SaveMovie() && !options->RestartFrom().empty()) {
+    /* A resumed run appends its frames to the movie of the run before, which holds the mesh (see Restart). */
+    PetscViewerHDF5Open(PETSC_COMM_WORLD, options->MovieFile().c_str(), FILE_MODE_APPEND, &mViewer);
+    PetscViewerHDF5PushGroup(mViewer, "/");
+  } else if (options->SaveMovie()) {
+    PetscViewerHDF5Open(PETSC_COMM_WORLD, options->MovieFile().c_str(), FILE_MODE_WRITE, &mViewer);
+    PetscViewerHDF5PushGroup(mViewer, "/");
+    DMView(mesh->DistributedMesh(), mViewer);
+  }
+
+  /* Now all elements are complete. */
+  return elements;
+
+}
 
+/* Fastest wave speed in an element, from whichever of the velocities or moduli its model gives. */
+static PetscReal fastestWaveSpeed(std::unique_ptr<Element> const &elm) {
+  const std::vector<std::string> names = elm->MaterialParameterNames();
+  auto has = [&names](const std::string &name) { return std::find(names.begin(), names.end(), name) != names.end(); };
+  PetscReal v = 0;
+  for (auto name: {"VP", "VPV", "VPH"}) {
+    if (has(name)) { v = std::max(v, elm->MaterialParameterAtIntPts(name).maxCoeff()); }
+  }
+  if (has("RHO")) {
+    const Eigen::VectorXd rho = elm->MaterialParameterAtIntPts("RHO");
+    for (auto name: {"C11", "C22", "C33"}) {
+      if (!has(name)) continue;
+      v = std::max(v, std::sqrt((elm->MaterialParameterAtIntPts(name).array() / rho.array()).maxCoeff()));
+    }
   }
+  return v;
+}
 
-  /* Check sources and receivers across all parallel partitions. */
-  MPI_Allreduce(MPI_IN_PLACE, srcs_this_partition.data(), srcs_this_partition.size(),
-                MPIU_INT, MPI_MAX, PETSC_COMM_WORLD);
-  MPI_Allreduce(MPI_IN_PLACE, recs_this_partition.data(), recs_this_partition.size(),
-                MPIU_INT, MPI_MAX, PETSC_COMM_WORLD);
+void Problem::initializeActivityMask(ElemVec const &elements, std::unique_ptr<Mesh> const &mesh,
+                                     std::unique_ptr<Options> const &options) {
+
+  /* The incident wavefield enters through the faces of the injection boundaries, not through a neighbour. */
+  mAwakeElm.assign(mesh->NumberElementsLocal(), false);
+  for (auto &elm: elements) { mAwakeElm[elm->Num()] = !mesh->InjectionFaces(elm->Num()).empty(); }
+
+  mWakeTime.clear();
+  if (!options->ActivityArrival() || !options->NumberSources()) { return; }
 
-  /* Finish up adding parallel-aware sources and receivers. */
+  /* Nothing moves faster than the fastest wave of the whole model. */
+  PetscReal v_max = 0;
+  for (auto &elm: elements) { v_max = std::max(v_max, fastestWaveSpeed(elm)); }
+  MPI_Allreduce(MPI_IN_PLACE, &v_max, 1, MPIU_REAL, MPI_MAX, PETSC_COMM_WORLD);
+  if (!(v_max > 0)) { throw std::runtime_error("--activity-arrival needs a model with a wave speed."); }
+
+  /* The straight ray from the nearest source to the element's bounding sphere, at the fastest speed, with a
+   * margin for the numerical precursor of the discrete wave. */
+  const PetscReal margin = 0.8;
+  mWakeTime.assign(mesh->NumberElementsLocal(), 0);
   for (auto &elm: elements) {
+    const Eigen::MatrixXd vtx = elm->VtxCrd();
+    const Eigen::RowVectorXd centre = vtx.colwise().mean();
+    const PetscReal radius = (vtx.rowwise() - centre).rowwise().norm().maxCoeff();
+    PetscReal distance = std::numeric_limits<PetscReal>::max();
+    for (PetscInt i = 0; i < options->NumberSources(); i++) {
+      Eigen::RowVectorXd src(centre.size());
+      src(0) = options->SrcLocX()[i]; src(1) = options->SrcLocY()[i];
+      if (src.size() > 2) { src(2) = options->SrcLocZ()[i]; }
+      distance = std::min(distance, (src - centre).norm());
+    }
+    mWakeTime[elm->Num()] = std::max<PetscReal>(0, margin * (distance - radius) / v_max);
+  }
+
+}
+
+void Problem::attachSourcesAndReceivers(ElemVec const &elements, std::unique_ptr<Options> const &options,
+                                        const PetscInt wavefield) {
+
+  /* MPI rank is important for source/receiver detection. */
+  int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+
+  /* Define variables to test for source/receiver presence. */
+  bool true_attach = true;
+  bool trial_attach = false;
+
+  /* Index the elements by their centre. A point can only lie in an element whose centre is
+   * within the largest element radius, so each source or receiver is only tested against those
+   * elements, instead of all of them. */
+  const PetscInt dim = elements.empty() ? 0 : elements.front()->NumDim();
+  std::vector<PetscReal> centres(elements.size() * dim);
+  PetscReal radius = 0;
+  RowVectorXd lower = RowVectorXd::Constant(dim, std::numeric_limits<PetscReal>::max()), upper = -lower;
+  for (PetscInt e = 0; e < elements.size(); e++) {
+    const auto vtx = elements[e]->VtxCrd();
+    RowVectorXd ctr = vtx.colwise().mean();
+    Map<RowVectorXd>(centres.data() + e * dim, dim) = ctr;
+    radius = std::max(radius, (vtx.rowwise() - ctr).rowwise().norm().maxCoeff());
+    lower = lower.cwiseMin(vtx.colwise().minCoeff()); upper = upper.cwiseMax(vtx.colwise().maxCoeff());
+  }
+
+  /* Only the sources and receivers within the bounds of this partition (widened a little, for the tolerance of
+   * the hull test) are created, so that no rank holds all of them. A partition without elements takes none. */
+  std::vector<double> box(2 * std::max<PetscInt>(dim, 1), 0);
+  if (!elements.empty()) {
+    for (PetscInt d = 0; d < dim; d++) { box[d] = lower(d) - 0.01 * radius; box[dim + d] = upper(d) + 0.01 * radius; }
+  } else {
+    box[0] = 1; box[1] = -1;
+  }
+  auto srcs = Source::Factory(options, box);
+  auto recs = Receiver::Factory(options, box);
+  for (auto &src: srcs) { src->SetWavefield(wavefield); }
+
+  /* Keep local track of srcs/recs on this partition, and of the element holding each, by their number. */
+  std::vector<PetscInt> srcs_this_partition(options->NumberSources(), 0);
+  std::vector<PetscInt> recs_this_partition(options->NumberReceivers(), 0);
+  std::vector<PetscInt> srcs_element(options->NumberSources(), -1);
+  std::vector<PetscInt> recs_element(options->NumberReceivers(), -1);
+  StaticKdTree tree;
+  if (!elements.empty()) { tree.build(dim, centres.data(), elements.size()); }
+
+  /* Candidate elements of a point, in element order, so that the first element holding the point
+   * still takes it. The radius is widened a little, since the hull test has some tolerance. */
+  std::vector<PetscInt> candidates;
+  auto find = [&](const PetscReal x, const PetscReal y, const PetscReal z) -> std::vector<PetscInt>& {
+    const PetscReal pnt[3] = {x, y, z};
+    candidates.clear();
+    if (!tree.empty()) { tree.within(pnt, 1.01 * radius, candidates); }
+    std::sort(candidates.begin(), candidates.end());
+    return candidates;
+  };
+
+  /* Test for any sources. */
+  for (auto &src: srcs) {
+    for (auto e: find(src->LocX(), src->LocY(), dim == 3 ? src->LocZ() : 0)) {
+      if (elements[e]->attachSource(src, trial_attach)) {
+        srcs_this_partition[src->Num()] = rank; srcs_element[src->Num()] = e; break;
+      }
+    }
+  }
+
+  /* Test for any receivers. The overlapping cells of other ranks don't record, as their values go wrong
+   * between halo exchanges. */
+  for (auto &rec: recs) {
+    for (auto e: find(rec->LocX(), rec->LocY(), dim == 3 ? rec->LocZ() : 0)) {
+      if (!mElmOwned.empty() && !mElmOwned[elements[e]->Num()]) { continue; }
+      if (elements[e]->attachReceiver(rec, trial_attach)) {
+        recs_this_partition[rec->Num()] = rank; recs_element[rec->Num()] = e; break;
+      }
+    }
+  }
+
+  /* Check sources and receivers across all parallel partitions. With overlapping cells, a source goes to all
+   * ranks holding the element (of the lowest global number) which takes it, so that every copy of its dofs is
+   * forced alike. */
+  if (mElmGlbNum.empty()) {
+    MPI_Allreduce(MPI_IN_PLACE, srcs_this_partition.data(), srcs_this_partition.size(),
+                  MPIU_INT, MPI_MAX, PETSC_COMM_WORLD);
+  } else {
+    std::vector<PetscInt> srcs_global(options->NumberSources(), std::numeric_limits<PetscInt>::max());
     for (auto &src: srcs) {
-      if (!src) { continue; }
-      if (srcs_this_partition[src->Num()] == rank) { elm->attachSource(src, true_attach); }
+      for (auto e: find(src->LocX(), src->LocY(), dim == 3 ? src->LocZ() : 0)) {
+        const PetscInt g = mElmGlbNum[elements[e]->Num()];
+        if (g < srcs_global[src->Num()] && elements[e]->attachSource(src, trial_attach)) {
+          srcs_global[src->Num()] = g;
+        }
+      }
+    }
+    MPI_Allreduce(MPI_IN_PLACE, srcs_global.data(), srcs_global.size(), MPIU_INT, MPI_MIN, PETSC_COMM_WORLD);
+    for (auto &src: srcs) {
+      srcs_this_partition[src->Num()] = -1; srcs_element[src->Num()] = -1;
+      for (auto e: find(src->LocX(), src->LocY(), dim == 3 ? src->LocZ() : 0)) {
+        if (mElmGlbNum[elements[e]->Num()] == srcs_global[src->Num()]) {
+          srcs_this_partition[src->Num()] = rank; srcs_element[src->Num()] = e; break;
+        }
+      }
+    }
+  }
+  MPI_Allreduce(MPI_IN_PLACE, recs_this_partition.data(), recs_this_partition.size(),
+                MPIU_INT, MPI_MAX, PETSC_COMM_WORLD);
+
+  /* Finish up adding parallel-aware sources and receivers, to the element found above. */
+  std::vector<Source*> srcs_attached;
+  for (auto &src: srcs) {
+    const PetscInt e = srcs_element[src->Num()];
+    Source *ptr = src.get();
+    if (srcs_this_partition[src->Num()] == rank && e >= 0 && elements[e]->attachSource(src, true_attach)) {
+      srcs_attached.push_back(ptr);
     }
-    for (auto &rec: recs) {
-      if (!rec) { continue; }
-      if (recs_this_partition[rec->Num()] == rank) { elm->attachReceiver(rec, true_attach); }
+  }
+
+  /* Source time functions precomputed into one table, so that the time loop only looks them up. Only the sources
+   * on this partition load their data, a window of --source-window steps at a time (see Simulation::run). */
+  for (auto src: srcs_attached) { src->loadData(); }
+  Source::tabulate(srcs_attached, options->NumTimeSteps() + 1, options->TimeStep(), options->SourceWindow());
+  std::vector<Receiver*> recs_attached;
+  for (auto &rec: recs) {
+    const PetscInt e = recs_element[rec->Num()];
+    Receiver *ptr = rec.get();
+    if (recs_this_partition[rec->Num()] == rank && e >= 0 && elements[e]->attachReceiver(rec, true_attach)) {
+      recs_attached.push_back(ptr);
     }
   }
 
+  /* All samples of the receivers on this partition go into one block, allocated up front. It holds
+   * one (decimated) sample per time step (the last step may be rounded up), or those of one write. */
+  PetscInt num_steps = options->ReceiverWriteEvery() ? options->ReceiverWriteEvery() : options->NumTimeSteps() + 1;
+  Receiver::allocateStore(recs_attached, Receiver::StoreCapacityFor(recs_attached, num_steps));
+  Receiver::openOutput(options);
+
   /* Finally, go back and ensure that everything has been added as expected. */
   for (auto &src: srcs) {
     /* Was there a source that should have been added by this processor that wasn't? */
     if (src) {
-      src->loadData();
       if (srcs_this_partition[src->Num()] == rank) {
         throw std::runtime_error("Error. One or more sources were not added properly.");
       }
@@ -129,88 +447,532 @@ ElemVec Problem::initializeElements(unique_ptr<Mesh> const &mesh,
     }
   }
 
-  /* If we want to save a solution, initialize this here. */
-  if (options->SaveMovie()) {
-    PetscViewerHDF5Open(PETSC_COMM_WORLD, options->MovieFile().c_str(), FILE_MODE_WRITE, &mViewer);
-    PetscViewerHDF5PushGroup(mViewer, "/");
-    DMView(mesh->DistributedMesh(), mViewer);
+  /* An assembly plan which is already set up records which elements hold sources and receivers. */
+  for (auto &batch: mBatches) { batch->updateSourcesAndReceivers(); }
+
+}
+
+FieldDict Problem::updateModel(ElemVec const &elements, std::unique_ptr<Mesh> &mesh,
+                               std::unique_ptr<ExodusModel> const &model, std::unique_ptr<Options> const &options,
+                               FieldDict fields) {
+
+  /* Material, and all terms precomputed from it, including those the assembly plan holds. */
+  for (auto &elm: elements) {
+    elm->attachMaterialProperties(model);
+    elm->precomputeElementTerms();
   }
+  for (auto &batch: mBatches) { batch->updateMaterial(); }
 
-  /* Now all elements are complete. */
-  return elements;
+  /* The time step of the existing sources and receivers is kept. */
+  PetscReal dt_stable = stableTimeStep(elements, options);
+  if (options->TimeStep() > dt_stable) {
+    LOG() << "Warning: --time-step " << options->TimeStep() << " exceeds the estimated stable time step "
+          << dt_stable << " of the new model. The simulation may become unstable.";
+  }
+
+  return reinitializeGlobalDofs(elements, mesh, std::move(fields));
+
+}
+
+FieldDict Problem::resetFields(FieldDict fields) {
+
+  /* The (inverse) mass matrix is kept. */
+  for (auto &name: fields.Names()) {
+    if (FieldIdFromName(name) == FieldId::mi) continue;
+    if (fields[name]->mLoc) { VecSet(fields[name]->mLoc, 0); }
+    VecSet(fields[name]->mGlb, 0);
+  }
+  mStepsSinceRefresh = 0;
+  fields.SetFromRest(true);
+  return fields;
+
+}
+
+PetscReal Problem::stableTimeStep(ElemVec const &elements, std::unique_ptr<Options> const &options) {
+
+  /* Range of element-wise stable time steps, over all partitions. */
+  PetscReal dt_min = std::numeric_limits<PetscReal>::max(), dt_max = 0;
+  for (auto &elm: elements) {
+    PetscReal dt = elm->CFL_estimate();
+    dt_min = std::min(dt_min, dt); dt_max = std::max(dt_max, dt);
+  }
+  MPI_Allreduce(MPI_IN_PLACE, &dt_min, 1, MPIU_REAL, MPI_MIN, PETSC_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, &dt_max, 1, MPIU_REAL, MPI_MAX, PETSC_COMM_WORLD);
+
+  /* With local time stepping, the smallest elements may be put on the finest level. There is no
+   * point in going beyond the largest element's time step though. */
+  PetscReal dt = dt_min * (1 << (options->MaxTimeStepLevels() - 1));
+
+  return TimeStepScale(options) * std::min(dt, dt_max);
+
+}
 
+PetscReal Problem::TimeStepScale(std::unique_ptr<Options> const &options) {
+  /* The fourth order scheme is stable up to sqrt(3) times the leapfrog step (see Order4Newmark). */
+  const PetscReal scheme = options->TimeSteppingScheme() == "newmark4" ? std::sqrt(3.0) : 1.0;
+  return options->TimeStepSafetyFactor() * scheme;
 }
+
 std::tuple<ElemVec, FieldDict> Problem::assembleIntoGlobalDof(
     ElemVec elements, FieldDict fields, const PetscReal time, const PetscInt time_idx, 
     DM PETScDM, PetscSection PETScSection, std::unique_ptr<Options> const &options) {
 
-  /* Get some derived quantities. */
-  PetscInt maxLocalFields = 0;
-  PetscInt numDofPerElm = elements[0]->NumIntPnt();
-  std::set<std::string> pullFields, pushFields;
-  for (auto &elm: elements) {
-    PetscInt numLocalFields = elm->PullElementalFields().size();
-    maxLocalFields = numLocalFields > maxLocalFields ? numLocalFields : maxLocalFields;
-    for (auto &f: elm->PullElementalFields()) {
-      pullFields.insert(f);
+  /* Ensure the gather/scatter plan matches the current set of elements. */
+  if (mNumBatchedElements != elements.size()) {
+    throw std::runtime_error("Error. Assembly plan not initialized for this set of elements. "
+                                 "Call initializeAssemblyPlan after Mesh::setupGlobalDof.");
+  }
+
+  /* With local time stepping, only the coarsest level is assembled here. Finer levels are
+   * sub-cycled by the time stepper. */
+  mTimeIdx = time_idx;
+  assembleLevel(fields, mNumLevels > 1 ? 0 : ElementBatch::AllLevels, time, time_idx, PETScDM);
+
+  return std::tuple<ElemVec, FieldDict> (std::move(elements), std::move(fields));
+
+}
+
+void Problem::assembleLevel(FieldDict &fields, const PetscInt level, const PetscReal time,
+                            const PetscInt time_idx, DM PETScDM) {
+
+  /* Raw access to either the local or global vectors, with each field pointing at its component. */
+  auto storage = [this](const FieldId f) { return mNumComponents > 1 ? BlockField(f) : f; };
+  std::array<PetscScalar*, NumFieldIds> vecs, arrays; arrays.fill(nullptr);
+  auto getArrays = [&](Vec field::*which) {
+    for (auto &v: mAccessVecs) { VecGetArray((*fields[v]).*which, &vecs[static_cast<int>(v)]); }
+    for (auto &f: mAccessFields) {
+      arrays[static_cast<int>(f)] = vecs[static_cast<int>(storage(f))] +
+          (mNumComponents > 1 ? BlockComponent(f) : 0);
+    }
+  };
+  auto restoreArrays = [&](Vec field::*which) {
+    for (auto &v: mAccessVecs) { VecRestoreArray((*fields[v]).*which, &vecs[static_cast<int>(v)]); }
+  };
+
+  /* The incident wavefield of the injection boundaries at this time, which their elements read. */
+  if (Injection::Active()) { Injection::Advance(time); }
+
+  /* Every --element-timing-every steps, each element is timed (in all levels and stages of the step). */
+  const bool timed = mElementTimingEvery && !(time_idx % mElementTimingEvery);
+  if (timed && time_idx != mLastTimedStep) { mTimedSteps++; mLastTimedStep = time_idx; }
+  for (auto &batch: mBatches) { batch->timeElements(timed); }
+
+  /* Each batch and region, timed while measuring the element costs. */
+  auto assemble = [&](const ElementBatch::Region region) {
+    for (size_t b = 0; b < mBatches.size(); b++) {
+      auto start = std::chrono::steady_clock::now();
+      mBatches[b]->assemble(region, level, arrays, mNumComponents, time, time_idx);
+      if (level == 0 && mNumLevels > 1) { mBatches[b]->recordReceivers(region, arrays, mNumComponents); }
+      if (mMeasureCosts) {
+        mBatchSeconds[b][region] += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      }
+    }
+  };
+
+  /* A ghosted state is current on the local vectors, so nothing is pulled, and everything is assembled into
+   * them. The halo elements first, so that their contributions to the ghosts are sent to the owners while the
+   * interior elements are done. The owners send the sums back, which leaves the same acceleration on all
+   * copies of a dof, once per step. The sums always travel in double, so that the copies step alike.
+   * With overlapping cells, all cells around this rank's own dofs are here, so these are summed in full without
+   * any communication. Only the ghosts on the edge of the overlap go wrong, and the error moves in by a layer
+   * of cells per step, so the state of the ghosts is replaced by the owners' once all layers are used up. */
+  if (mGhostedState) {
+    if (!mPushHalo || mPushHalo->Width() != mPushVecs.size() || mPushHalo->WirePrecision() != HaloExchange::Double) {
+      mPushHalo.reset(newHalo(PETScDM, mPushVecs.size(), HaloExchange::Double));
+    }
+    if (mHaloOverlap && mStepsSinceRefresh >= mHaloOverlap) { refreshState(fields, PETScDM); }
+    for (auto &field: mPushVecs) { VecSet(fields[field]->mLoc, 0); }
+    getArrays(&field::mLoc);
+    auto &loc = mWriteArrays; loc.clear();
+    for (auto &field: mPushVecs) { loc.push_back(vecs[static_cast<int>(field)]); }
+    if (mHaloOverlap) {
+      assemble(ElementBatch::Halo);
+      assemble(ElementBatch::Interior);
+      mStepsSinceRefresh++;
+      for (auto a: loc) { for (auto i: mBndDofs) { a[i] = 0; } }
+      restoreArrays(&field::mLoc);
+      return;
     }
-    for (auto &f: elm->PushElementalFields()) {
-      pushFields.insert(f);
+    assemble(ElementBatch::Halo);
+    {
+      Profiler::Scope scope(Profiler::HaloExchange, "HaloPost");
+      mPushHalo->reduceBegin(loc);
+    }
+    assemble(ElementBatch::Interior);
+    {
+      Profiler::Scope scope(Profiler::HaloExchange, "HaloWait");
+      auto start = std::chrono::steady_clock::now();
+      mPushHalo->reduceEnd(loc);
+      mExchangeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
     }
+    for (auto a: loc) { for (auto i: mBndDofs) { a[i] = 0; } }
+    restoreArrays(&field::mLoc);
+    return;
   }
 
-  /* Matrices to hold computed field values */
-  RealMat u(numDofPerElm, maxLocalFields); /// input field
-  RealMat k(numDofPerElm, maxLocalFields); /// stiffness applied to u.  
-  RealMat s(numDofPerElm, maxLocalFields); /// surf/edg integral.
-  RealMat f(numDofPerElm, maxLocalFields); /// forcing.
-  RealMat a(numDofPerElm, maxLocalFields); /// final acceleration.
+  /* The hanging nodes take the values of their masters before they are gathered. */
+  if (mHangingNodes) {
+    for (auto &field: mPullVecs) { mHangingNodes->constrain(fields[field]->mGlb); }
+  }
+  if (mPeriodic) {
+    for (auto &field: mPullVecs) { mPeriodic->constrain(fields[field]->mGlb); }
+  }
 
   /* Get fields on local partitions. */
-  for (auto &field: pullFields) { checkOutField(field, PETScDM, fields); }
+  checkOutFields(mPullVecs, PETScDM, fields);
 
   /* Zero fields to which we will assemble. */
-  for (auto &field: pushFields) { zeroField(field, fields); }
+  for (auto &field: mPushVecs) { zeroField(field, fields); }
+
+  /* Halo elements first. These gather from and sum into the local partition. */
+  getArrays(&field::mLoc);
+  assemble(ElementBatch::Halo);
+  restoreArrays(&field::mLoc);
+
+  /* Start sending halo contributions to their owners. */
+  checkInFieldsBegin(mPushVecs, PETScDM, fields);
+
+  /* While that is in flight, do the interior elements. These only touch dofs owned by this
+   * partition, so they work directly on the global vectors. Since the halo exchange adds into
+   * the global vectors, the order in which the two contributions arrive does not matter. */
+  getArrays(&field::mGlb);
+  assemble(ElementBatch::Interior);
+  restoreArrays(&field::mGlb);
+
+  /* Finish the halo exchange. */
+  checkInFieldsEnd(mPushVecs, PETScDM, fields);
 
-  /* Loop over elements and compute integrals. */
+  /* Forces on the hanging nodes belong to their masters. */
+  if (mHangingNodes) {
+    for (auto &field: mPushVecs) { mHangingNodes->distribute(fields[field]->mGlb); }
+  }
+  if (mPeriodic) {
+    for (auto &field: mPushVecs) { mPeriodic->distribute(fields[field]->mGlb); }
+  }
+
+  /* No acceleration on homogeneous Dirichlet boundaries. */
+  if (!mBndDofs.empty()) {
+    for (auto &field: mPushVecs) {
+      PetscScalar *a; VecGetArray(fields[field]->mGlb, &a);
+      for (auto i: mBndDofs) { a[i] = 0; }
+      VecRestoreArray(fields[field]->mGlb, &a);
+    }
+  }
+
+}
+
+std::set<FieldId> Problem::LocalFields(ElemVec const &elements, const PetscInt num_comps) {
+  std::set<FieldId> local;
   for (auto &elm: elements) {
+    for (auto f: elm->PullElementalFields()) { local.insert(num_comps > 1 ? BlockField(f) : f); }
+    for (auto f: elm->PushElementalFields()) { local.insert(num_comps > 1 ? BlockField(f) : f); }
+  }
+  return local;
+}
+
+std::vector<PetscInt> Problem::OwnedDofs(std::unique_ptr<Mesh> const &mesh, std::vector<PetscInt> const &points) {
+
+  /* Flag all dofs of the points, and sum the flags onto the owners. */
+  DM dm = mesh->DistributedMesh();
+  Vec loc, glb; DMGetLocalVector(dm, &loc); DMGetGlobalVector(dm, &glb);
+  VecSet(loc, 0); VecSet(glb, 0);
+  PetscScalar *val; VecGetArray(loc, &val);
+  for (auto p: points) {
+    PetscInt dof, off;
+    PetscSectionGetDof(mesh->MeshSection(), p, &dof);
+    PetscSectionGetOffset(mesh->MeshSection(), p, &off);
+    for (PetscInt i = 0; i < dof; i++) { val[off + i] = 1; }
+  }
+  VecRestoreArray(loc, &val);
+  DMLocalToGlobalBegin(dm, loc, ADD_VALUES, glb);
+  DMLocalToGlobalEnd(dm, loc, ADD_VALUES, glb);
+
+  std::vector<PetscInt> dofs;
+  PetscInt size; VecGetLocalSize(glb, &size);
+  VecGetArray(glb, &val);
+  for (PetscInt i = 0; i < size; i++) {
+    if (PetscRealPart(val[i]) > 0) { dofs.push_back(i); }
+  }
+  VecRestoreArray(glb, &val);
+  DMRestoreLocalVector(dm, &loc); DMRestoreGlobalVector(dm, &glb);
+  return dofs;
+
+}
+
+void Problem::initializeBoundaryDofs(std::unique_ptr<Mesh> const &mesh) {
+
+  const std::vector<PetscInt> owned = OwnedDofs(mesh, mesh->HomogeneousDirichletPoints());
+  mBndDofs.assign(owned.begin(), owned.end());
+  if (!mGhostedState) { return; }
+
+  /* The same dofs in the local vectors, ghosts included, from the owners' flags. */
+  DM dm = mesh->DistributedMesh();
+  Vec loc, glb; DMGetLocalVector(dm, &loc); DMGetGlobalVector(dm, &glb);
+  VecSet(glb, 0);
+  PetscScalar *val; VecGetArray(glb, &val);
+  for (auto i: mBndDofs) { val[i] = 1; }
+  VecRestoreArray(glb, &val);
+  DMGlobalToLocalBegin(dm, glb, INSERT_VALUES, loc);
+  DMGlobalToLocalEnd(dm, glb, INSERT_VALUES, loc);
+  mBndDofs.clear();
+  PetscInt size; VecGetLocalSize(loc, &size);
+  CheckLocalIndex(size, "local dofs");
+  VecGetArray(loc, &val);
+  for (PetscInt i = 0; i < size; i++) {
+    if (PetscRealPart(val[i]) > 0) { mBndDofs.push_back(i); }
+  }
+  VecRestoreArray(loc, &val);
+  DMRestoreLocalVector(dm, &loc); DMRestoreGlobalVector(dm, &glb);
+
+}
+
+void Problem::initializeHangingNodes(ElemVec const &elements, std::unique_ptr<Mesh> const &mesh) {
+  mHangingNodes.reset();
+  if (mUseHangingNodes) { mHangingNodes = HangingNodes::Build(elements, mesh); }
+}
+
+void Problem::initializePeriodicBoundaries(ElemVec const &elements, std::unique_ptr<Mesh> const &mesh) {
+  mPeriodic = PeriodicBoundaries::Build(elements, mesh);
+}
+
+void Problem::updateGlobalState(FieldDict &fields, DM PETScDM) {
+
+  /* The constrained dofs are only set from their masters before the next assembly, so they still hold the
+   * values of the last step. Bring them up to date for the output. */
+  if (mHangingNodes || mPeriodic) {
+    for (auto &name: fields.Names()) {
+      if (FieldIdFromName(name) == FieldId::mi) { continue; }
+      if (mHangingNodes) { mHangingNodes->constrain(fields[name]->mGlb); }
+      if (mPeriodic) { mPeriodic->constrain(fields[name]->mGlb); }
+    }
+  }
+
+  if (!mGhostedState) { return; }
+  if (!mPushHalo) { mPushHalo.reset(newHalo(PETScDM, mPushVecs.size(), HaloExchange::Double)); }
+  auto &loc = mReadArrays; auto &glb = mWriteArrays; loc.clear(); glb.clear();
+  std::vector<FieldId> names;
+  for (auto &name: fields.Names()) {
+    if (FieldIdFromName(name) == FieldId::mi) { continue; }
+    names.push_back(FieldIdFromName(name));
+    loc.emplace_back(); VecGetArrayRead(fields[names.back()]->mLoc, &loc.back());
+    glb.emplace_back(); VecGetArray(fields[names.back()]->mGlb, &glb.back());
+  }
+  mPushHalo->copyOwned(loc, glb);
+  for (size_t f = 0; f < names.size(); f++) {
+    VecRestoreArrayRead(fields[names[f]]->mLoc, &loc[f]); VecRestoreArray(fields[names[f]]->mGlb, &glb[f]);
+  }
+
+}
+
+void Problem::updateLocalState(FieldDict &fields, DM PETScDM) {
+  if (!mGhostedState) { return; }
+  for (auto &name: fields.Names()) {
+    if (FieldIdFromName(name) == FieldId::mi) { continue; }
+    DMGlobalToLocalBegin(PETScDM, fields[name]->mGlb, INSERT_VALUES, fields[name]->mLoc);
+    DMGlobalToLocalEnd(PETScDM, fields[name]->mGlb, INSERT_VALUES, fields[name]->mLoc);
+  }
+  mStepsSinceRefresh = 0;
+}
+
+void Problem::refreshState(FieldDict &fields, DM PETScDM) {
 
-    /* Specific number of fields for this element. */
-    PetscInt NumPullFields = elm->PullElementalFields().size();
-    PetscInt NumPushFields = elm->PushElementalFields().size();
+  Profiler::Scope scope(Profiler::HaloExchange, "HaloRefresh");
+  auto start = std::chrono::steady_clock::now();
+  std::vector<FieldId> names;
+  for (auto &name: fields.Names()) {
+    const FieldId id = FieldIdFromName(name);
+    if (id != FieldId::mi && !mPushVecs.count(id)) { names.push_back(id); }
+  }
+  if (!mStateHalo || mStateHalo->Width() != names.size()) {
+    mStateHalo.reset(newHalo(PETScDM, names.size(), HaloExchange::Double));
+  }
+  auto &loc = mWriteArrays; loc.clear();
+  for (auto id: names) { loc.emplace_back(); VecGetArray(fields[id]->mLoc, &loc.back()); }
+  mStateHalo->refresh(loc);
+  for (size_t f = 0; f < names.size(); f++) { VecRestoreArray(fields[names[f]]->mLoc, &loc[f]); }
+  mStepsSinceRefresh = 0;
+  mExchangeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+}
+
+FieldDict Problem::rewindDisplacement(FieldDict fields) {
+  throw std::runtime_error("This time stepper can't step back in time.");
+}
+
+std::tuple<FieldDict, PetscScalar> Problem::takeTimeStepBack(
+    FieldDict fields, PetscScalar time, std::unique_ptr<Options> const &options) {
+  throw std::runtime_error("This time stepper can't step back in time.");
+}
+
+FieldDict Problem::solveStatic(FieldDict fields, const PetscReal time, DM PETScDM) {
+  throw std::runtime_error("This problem can't be solved statically.");
+}
+
+void Problem::initializeAssemblyPlan(ElemVec const &elements, DM PETScDM,
+                                     PetscSection PETScSection,
+                                     std::vector<PetscInt> const &elm_level) {
+
+  /* Fill a scratch local vector with its own indices. Pulling this vector through the closure
+   * tells us exactly where DMPlexVecGetClosure would have read from, including any
+   * orientation or spectral permutation attached to the section. */
+  Vec index; DMGetLocalVector(PETScDM, &index);
+  PetscSectionGetFieldComponents(PETScSection, 0, &mNumComponents);
+  if (mNumShots > 1 && mNumComponents != mNumShots) {
+    throw std::runtime_error("With simultaneous shots, the mesh section must hold one component per shot.");
+  }
+  PetscInt size; VecGetLocalSize(index, &size);
+  PetscScalar *ind; VecGetArray(index, &ind);
+  for (PetscInt i = 0; i < size; i++) { ind[i] = i; }
+  VecRestoreArray(index, &ind);
+
+  /* Map from local vector index to the local part of the global vector (or -1, if the dof is
+   * owned by another partition). */
+  PetscSection glb_section; DMGetDefaultGlobalSection(PETScDM, &glb_section);
+  Vec glb; DMGetGlobalVector(PETScDM, &glb);
+  PetscInt glb_start; VecGetOwnershipRange(glb, &glb_start, NULL);
+  DMRestoreGlobalVector(PETScDM, &glb);
+  std::vector<PetscInt> loc_to_glb(size, -1);
+  PetscInt p_start, p_end; PetscSectionGetChart(PETScSection, &p_start, &p_end);
+  for (PetscInt p = p_start; p < p_end; p++) {
+    PetscInt dof, off, glb_off;
+    PetscSectionGetDof(PETScSection, p, &dof);
+    PetscSectionGetOffset(PETScSection, p, &off);
+    PetscSectionGetOffset(glb_section, p, &glb_off);
+    if (glb_off < 0) continue;
+    for (PetscInt i = 0; i < dof; i++) {
+      loc_to_glb[off + i] = (glb_off - glb_start + i) / mNumComponents;
+    }
+  }
+
+  /* Local (block) indices of every element's dofs. */
+  std::vector<std::vector<PetscInt>> elm_idx(elements.size());
+  for (PetscInt e = 0; e < elements.size(); e++) {
+
+    /* Salvus ordering: field(closure(i)) = petscField(i). */
+    auto &elm = elements[e];
+    const auto &closure = elm->ClsMap();
+    PetscScalar *val = NULL; PetscInt csize;
+    DMPlexVecGetClosure(PETScDM, PETScSection, index, elm->Num(), &csize, &val);
+    if (csize != closure.size() * mNumComponents) {
+      DMPlexVecRestoreClosure(PETScDM, PETScSection, index, elm->Num(), NULL, &val);
+      DMRestoreLocalVector(PETScDM, &index);
+      throw std::runtime_error("Error. Closure size on element " + std::to_string(elm->Num()) +
+                                   " does not match the element closure mapping.");
+    }
+    /* Components are interleaved at each dof, so store the dof's block index. */
+    std::vector<PetscInt> &idx = elm_idx[e]; idx.resize(closure.size());
+    for (PetscInt i = 0; i < idx.size(); i++) {
+      idx[closure(i)] = static_cast<PetscInt> (PetscRealPart(val[i * mNumComponents])) / mNumComponents;
+    }
+    DMPlexVecRestoreClosure(PETScDM, PETScSection, index, elm->Num(), NULL, &val);
+
+  }
 
-    /* Get specific fields for this element. */
-    for (PetscInt i = 0; i < NumPullFields; i++) {
-      u.col(i) =
-          getFieldOnElement(elm->PullElementalFields()[i], elm->Num(), elm->ClsMap(),
-                            PETScDM, PETScSection, fields);
+  /* With local time stepping, each dof takes the finest level of all elements it touches,
+   * including those on other partitions. Levels are few, so just communicate an indicator of
+   * each level (from fine to coarse). */
+  mNumLevels = 1;
+  std::vector<PetscInt> dof_level;
+  if (!elm_level.empty()) {
+    PetscInt max_level = *std::max_element(elm_level.begin(), elm_level.end());
+    MPI_Allreduce(MPI_IN_PLACE, &max_level, 1, MPIU_INT, MPI_MAX, PETSC_COMM_WORLD);
+    mNumLevels = max_level + 1;
+    dof_level.assign(size / mNumComponents, 0);
+    Vec glb_ind; DMGetGlobalVector(PETScDM, &glb_ind);
+    for (PetscInt l = mNumLevels - 1; l > 0; l--) {
+      VecSet(index, 0); VecSet(glb_ind, 0);
+      VecGetArray(index, &ind);
+      for (PetscInt e = 0; e < elements.size(); e++) {
+        if (elm_level[e] < l) continue;
+        for (auto i: elm_idx[e]) { ind[i * mNumComponents] = 1; }
+      }
+      VecRestoreArray(index, &ind);
+      DMLocalToGlobalBegin(PETScDM, index, ADD_VALUES, glb_ind);
+      DMLocalToGlobalEnd(PETScDM, index, ADD_VALUES, glb_ind);
+      DMGlobalToLocalBegin(PETScDM, glb_ind, INSERT_VALUES, index);
+      DMGlobalToLocalEnd(PETScDM, glb_ind, INSERT_VALUES, index);
+      VecGetArray(index, &ind);
+      for (PetscInt i = 0; i < dof_level.size(); i++) {
+        if (!dof_level[i] && PetscRealPart(ind[i * mNumComponents]) > 0) { dof_level[i] = l; }
+      }
+      VecRestoreArray(index, &ind);
     }
+    DMRestoreGlobalVector(PETScDM, &glb_ind);
+  }
 
-    /* Compute stiffness. */
-    k.leftCols(NumPushFields) = elm->computeStiffnessTerm(u.leftCols(NumPullFields));
+  /* One batch per concrete element type and variant of its stiffness kernel. */
+  std::map<std::pair<std::type_index, PetscInt>, PetscInt> batch_of_type;
+  mBatches.clear(); mBatchNames.clear(); mNumBatchedElements = 0; mElmBatch.clear();
 
-    /* Compute surface integrals. */
-    s.leftCols(NumPushFields) = elm->computeSurfaceIntegral(u.leftCols(NumPullFields));
+  std::vector<PetscInt> glb_idx, lvl;
+  for (PetscInt e = 0; e < elements.size(); e++) {
 
-    /* Compute forcing. */
-    f.leftCols(NumPushFields) = elm->computeSourceTerm(time, time_idx);
+    auto &elm = elements[e];
+    std::vector<PetscInt> &idx = elm_idx[e];
+    PetscInt csize = idx.size();
 
-    /* Compute acceleration. */
-    a.leftCols(NumPushFields) = f.leftCols(NumPushFields).array() -
-        k.leftCols(NumPushFields).array() + s.leftCols(NumPushFields).array();
+    /* Time step levels of the element and its dofs. */
+    const PetscInt *lvl_ptr = NULL;
+    if (!dof_level.empty()) {
+      lvl.resize(csize);
+      for (PetscInt i = 0; i < csize; i++) { lvl[i] = dof_level[idx[i]]; }
+      lvl_ptr = lvl.data();
+    }
+    const PetscInt level = elm_level.empty() ? 0 : elm_level[e];
+
+    /* Add to the batch of this element's type, creating it if need be. */
+    const auto type = std::make_pair(std::type_index(typeid(*elm)), elm->StiffnessVariant());
+    if (!batch_of_type.count(type)) {
+      batch_of_type[type] = mBatches.size();
+      mBatches.push_back(elm->MakeBatch());
+      mBatchNames.push_back(elm->Name());
+    }
 
-    /* Assemble fields into local partition. */
-    for (PetscInt i = 0; i < NumPushFields; i++) {
-      addFieldOnElement(elm->PushElementalFields()[i], elm->Num(), elm->ClsMap(),
-                        a.col(i), PETScDM, PETScSection, fields);
+    /* Elements which only touch owned dofs are interior. They index the global vectors, unless the state is
+     * ghosted, which assembles everything into the local ones. */
+    glb_idx.resize(csize);
+    bool interior = true;
+    for (PetscInt i = 0; i < csize; i++) {
+      glb_idx[i] = loc_to_glb[idx[i] * mNumComponents];
+      interior = interior && (glb_idx[i] >= 0);
     }
+    const ElementBatch::Region region = interior ? ElementBatch::Interior : ElementBatch::Halo;
+    mBatches[batch_of_type[type]]->append(elm.get(), region, interior && !mGhostedState ? glb_idx.data() : idx.data(),
+                                          csize, lvl_ptr, level);
+    mElmBatch.resize(std::max<size_t>(mElmBatch.size(), elm->Num() + 1));
+    mElmBatch[elm->Num()] = std::make_pair(batch_of_type[type], region);
+    mNumBatchedElements++;
 
   }
 
-  /* Broadcast to global partitions. */
-  for (auto &field: pushFields) { checkInField(field, PETScDM, fields); }
+  /* Set up batches for (possibly threaded) assembly. */
+  for (auto &batch: mBatches) {
+    batch->setWorkStealing(mWorkStealingChunk);
+    batch->finalize(mNumThreads, mNumShots);
+  }
+  if (mActivityThreshold >= 0) {
+    for (auto &batch: mBatches) { batch->setActivityMask(mActivityThreshold, mWakeTime, mAwakeElm); }
+  }
 
-  return std::tuple<ElemVec, FieldDict> (std::move(elements), std::move(fields));
+  /* The fields required by all element types, and the vectors holding them. With interleaved components, all
+   * components of a field live in one block vector, so each of these is communicated only once. They are
+   * fixed with the plan, so that assembling does not build them anew each step. */
+  auto storage = [this](const FieldId f) { return mNumComponents > 1 ? BlockField(f) : f; };
+  std::set<FieldId> pull_fields, push_fields;
+  for (auto &batch: mBatches) {
+    pull_fields.insert(batch->PullElementalFields().begin(), batch->PullElementalFields().end());
+    push_fields.insert(batch->PushElementalFields().begin(), batch->PushElementalFields().end());
+  }
+  mPullVecs.clear(); mPushVecs.clear();
+  for (auto &field: pull_fields) { mPullVecs.insert(storage(field)); }
+  for (auto &field: push_fields) { mPushVecs.insert(storage(field)); }
+  mAccessVecs = mPullVecs; mAccessVecs.insert(mPushVecs.begin(), mPushVecs.end());
+  mAccessFields = pull_fields; mAccessFields.insert(push_fields.begin(), push_fields.end());
+
+  DMRestoreLocalVector(PETScDM, &index);
+
+  /* The dofs of a movie do not change with the plan, so they are selected once. */
+  if (mMovie && !mMovie->IsSetUp()) { mMovie->setup(elements, PETScDM, PETScSection); }
 
 }
 
@@ -218,25 +980,248 @@ void Problem::saveSolution(const PetscReal time, const std::vector<std::string>
                            FieldDict &fields, DM PetscDM) {
 
   /* Do nothing if we didn't set up a movie save. */
-  if (!mViewer) return;
+  if (!mViewer && !mMovie) return;
 
-  DMSetOutputSequenceNumber(PetscDM, mOutputFrame++, time);
+  /* Check to see if the fields we want to save make sense. */
   for (auto &f: save_fields) {
-
-    /* Check to see if the field we want to save makes sense. */
-    if (fields.find(f) == fields.end()) {
-      std::string regs = "{ "; for (auto &fn: fields) { regs += fn.first + " "; } regs += "}.";
+    if (!fields.count(f)) {
+      std::string regs = "{ "; for (auto &fn: fields.Names()) { regs += fn + " "; } regs += "}.";
       throw std::runtime_error("You are attempting to save field " + f + " which is not registered. "
           "Registered fields are " + regs);
     }
+  }
+
+  /* Else, save. */
+  if (mMovie) { mMovie->write(time, save_fields, fields); return; }
+  DMSetOutputSequenceNumber(PetscDM, mOutputFrame++, time);
+  for (auto &f: save_fields) { VecView(fields[f]->mGlb, mViewer); }
 
-    /* Else, save. */
-    VecView(fields[f]->mGlb, mViewer);
+}
+
+void Problem::MeasureCosts(const bool measure) {
+  if (measure) { mBatchSeconds.assign(mBatches.size(), {{0, 0}}); }
+  mMeasureCosts = measure;
+}
+
+std::vector<PetscReal> Problem::ElementCosts() const {
+  std::vector<PetscReal> costs(mElmBatch.size(), 0);
+  if (mBatchSeconds.size() != mBatches.size()) { return costs; }
+  for (size_t e = 0; e < mElmBatch.size(); e++) {
+    const PetscInt b = mElmBatch[e].first;
+    const ElementBatch::Region region = mElmBatch[e].second;
+    costs[e] = mBatchSeconds[b][region] / mBatches[b]->size(region);
+  }
+  return costs;
+}
+
+std::vector<PetscReal> Problem::ElementSeconds() const {
+  std::vector<double> seconds(mElmBatch.size(), 0);
+  for (auto &batch: mBatches) { batch->addElementSeconds(seconds); }
+  const double steps = std::max<PetscInt>(mTimedSteps, 1);
+  std::vector<PetscReal> per_step(seconds.size());
+  for (size_t e = 0; e < seconds.size(); e++) { per_step[e] = seconds[e] / steps; }
+  return per_step;
+}
+
+void Problem::reportElementTiming(DM PETScDM, const std::string &filename) {
+
+  const std::vector<PetscReal> seconds = ElementSeconds();
+  int rank, size;
+  MPI_Comm_rank(PETSC_COMM_WORLD, &rank); MPI_Comm_size(PETSC_COMM_WORLD, &size);
+
+  /* Seconds and elements of each type of this rank, as lines of text gathered on the first rank by name. */
+  std::map<std::string, std::pair<double, double>> local;
+  double rank_seconds = 0;
+  for (size_t e = 0; e < mElmBatch.size(); e++) {
+    auto &type = local[mBatchNames[mElmBatch[e].first]];
+    type.first += seconds[e]; type.second += 1; rank_seconds += seconds[e];
+  }
+  std::ostringstream lines;
+  lines.precision(17);
+  for (auto &type: local) { lines << type.first << "\t" << type.second.first << "\t" << type.second.second << "\n"; }
+  std::string text = lines.str();
+  int len = text.size();
+  std::vector<int> lens(size), offs(size + 1, 0);
+  MPI_Gather(&len, 1, MPI_INT, lens.data(), 1, MPI_INT, 0, PETSC_COMM_WORLD);
+  for (int r = 0; r < size; r++) { offs[r + 1] = offs[r] + lens[r]; }
+  std::vector<char> all(offs.back() + 1);
+  MPI_Gatherv(&text[0], len, MPI_CHAR, all.data(), lens.data(), offs.data(), MPI_CHAR, 0, PETSC_COMM_WORLD);
+  double max_seconds, sum_seconds;
+  MPI_Reduce(&rank_seconds, &max_seconds, 1, MPI_DOUBLE, MPI_MAX, 0, PETSC_COMM_WORLD);
+  MPI_Reduce(&rank_seconds, &sum_seconds, 1, MPI_DOUBLE, MPI_SUM, 0, PETSC_COMM_WORLD);
+
+  if (!rank) {
+    std::map<std::string, std::pair<double, double>> types;
+    std::istringstream in(std::string(all.data(), offs.back()));
+    std::string name, line;
+    while (std::getline(in, name, '\t') && std::getline(in, line)) {
+      std::istringstream values(line);
+      double s, n; values >> s >> n;
+      types[name].first += s; types[name].second += n;
+    }
+    std::vector<std::pair<std::string, std::pair<double, double>>> sorted(types.begin(), types.end());
+    std::sort(sorted.begin(), sorted.end(), [](const std::pair<std::string, std::pair<double, double>> &a,
+                                               const std::pair<std::string, std::pair<double, double>> &b) {
+      return a.second.first > b.second.first;
+    });
+    LOG() << "Element loop timed on " << mTimedSteps << " step(s): " << sum_seconds / size
+          << " seconds per step on average over the ranks, " << max_seconds << " on the slowest.";
+    for (auto &type: sorted) {
+      LOG() << "  " << type.first << ": " << type.second.second << " elements, "
+            << type.second.first / type.second.second << " seconds per element and step ("
+            << 100 * type.second.first / std::max(sum_seconds, 1e-300) << "% of the element loop).";
+    }
+  }
+
+  /* The seconds and rank of each cell, as cell fields of a clone of the DM with one dof per cell. */
+  if (!filename.empty()) {
+    DM cell_dm; DMClone(PETScDM, &cell_dm);
+    PetscInt p_start, p_end, c_start, c_end;
+    DMPlexGetChart(cell_dm, &p_start, &p_end);
+    DMPlexGetHeightStratum(cell_dm, 0, &c_start, &c_end);
+    PetscSection section;
+    PetscSectionCreate(PETSC_COMM_WORLD, &section);
+    PetscSectionSetChart(section, p_start, p_end);
+    for (PetscInt c = c_start; c < c_end; c++) { PetscSectionSetDof(section, c, 1); }
+    PetscSectionSetUp(section);
+    DMSetDefaultSection(cell_dm, section);
+    PetscViewer viewer;
+    PetscViewerHDF5Open(PETSC_COMM_WORLD, filename.c_str(), FILE_MODE_WRITE, &viewer);
+    DMView(cell_dm, viewer);
+    for (auto name: {"element_cost", "element_rank"}) {
+      Vec loc, glb;
+      DMGetLocalVector(cell_dm, &loc); DMCreateGlobalVector(cell_dm, &glb);
+      VecSet(loc, 0);
+      PetscScalar *val; VecGetArray(loc, &val);
+      for (PetscInt c = c_start; c < std::min<PetscInt>(c_end, seconds.size()); c++) {
+        PetscInt off; PetscSectionGetOffset(section, c, &off);
+        val[off] = std::string(name) == "element_cost" ? seconds[c] : rank;
+      }
+      VecRestoreArray(loc, &val);
+      DMLocalToGlobalBegin(cell_dm, loc, INSERT_VALUES, glb);
+      DMLocalToGlobalEnd(cell_dm, loc, INSERT_VALUES, glb);
+      DMRestoreLocalVector(cell_dm, &loc);
+      PetscObjectSetName((PetscObject) glb, name);
+      VecView(glb, viewer);
+      VecDestroy(&glb);
+    }
+    PetscViewerDestroy(&viewer);
+    PetscSectionDestroy(&section);
+    DMDestroy(&cell_dm);
+  }
+
+  /* Start anew, e.g. for the next shot. */
+  for (auto &batch: mBatches) { batch->clearElementSeconds(); }
+  mTimedSteps = 0; mLastTimedStep = -1;
+
+}
+
+HaloExchange *Problem::newHalo(DM PETScDM, const PetscInt width, const HaloExchange::Precision precision) const {
+  HaloExchange *halo = new HaloExchange(PETScDM, width, precision, mNodeHalo);
+  halo->timeWaits(mTimeHaloWaits);
+  return halo;
+}
+
+void Problem::reportHalo(DM PETScDM, const PetscInt num_steps, const std::string &filename) {
+
+  int rank, size;
+  MPI_Comm_rank(PETSC_COMM_WORLD, &rank); MPI_Comm_size(PETSC_COMM_WORLD, &size);
+  const double steps = std::max<PetscInt>(num_steps, 1);
+
+  /* The dofs shared with the neighbours, from an exchange of a single field (they are the same for all). */
+  HaloExchange dofs(PETScDM, 1, HaloExchange::Double, false);
+  const std::vector<PetscMPIInt> neighbours = dofs.Neighbours();
+
+  /* Bytes sent to each rank per step, and the seconds waited for it, by all exchanges set up so far. */
+  std::vector<double> sent_row(size, 0), wait_row(size, 0);
+  for (auto halo: {mPullHalo.get(), mPushHalo.get(), mStateHalo.get()}) {
+    if (!halo) { continue; }
+    std::vector<double> sent, received, waited;
+    halo->traffic(sent, received, waited);
+    const std::vector<PetscMPIInt> ranks = halo->Neighbours();
+    for (size_t n = 0; n < ranks.size(); n++) {
+      sent_row[ranks[n]] += sent[n] / steps; wait_row[ranks[n]] += waited[n] / steps;
+    }
+  }
+
+  /* Neighbours, dofs, and bytes sent, received and waited for per step of each rank, followed by the rows. */
+  std::vector<double> summary = {static_cast<double>(neighbours.size()), static_cast<double>(dofs.NumOwned()),
+                                 static_cast<double>(dofs.NumShared()), static_cast<double>(dofs.NumGhosts()),
+                                 std::accumulate(sent_row.begin(), sent_row.end(), 0.0), 0,
+                                 std::accumulate(wait_row.begin(), wait_row.end(), 0.0)};
+  std::vector<double> all_summary(rank ? 0 : size * summary.size());
+  std::vector<double> sent_matrix(rank ? 0 : size * size), wait_matrix(rank ? 0 : size * size);
+  MPI_Gather(summary.data(), summary.size(), MPI_DOUBLE, all_summary.data(), summary.size(), MPI_DOUBLE, 0,
+             PETSC_COMM_WORLD);
+  MPI_Gather(sent_row.data(), size, MPI_DOUBLE, sent_matrix.data(), size, MPI_DOUBLE, 0, PETSC_COMM_WORLD);
+  MPI_Gather(wait_row.data(), size, MPI_DOUBLE, wait_matrix.data(), size, MPI_DOUBLE, 0, PETSC_COMM_WORLD);
+  if (rank) { return; }
+
+  /* What each rank receives is what the others send it. */
+  const size_t ns = summary.size();
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) { all_summary[j * ns + 5] += sent_matrix[i * size + j]; }
+  }
+  double max_neighbours = 0, sum_neighbours = 0, max_bytes = 0, sum_bytes = 0, max_ratio = 0, max_wait = 0;
+  int wait_rank = 0, wait_for = 0;
+  for (int r = 0; r < size; r++) {
+    const double *s = &all_summary[r * ns];
+    max_neighbours = std::max(max_neighbours, s[0]); sum_neighbours += s[0];
+    max_bytes = std::max(max_bytes, std::max(s[4], s[5])); sum_bytes += s[4];
+    max_ratio = std::max(max_ratio, (s[2] + s[3]) / std::max(s[1], 1.0));
+    for (int j = 0; j < size; j++) {
+      if (wait_matrix[r * size + j] > max_wait) { max_wait = wait_matrix[r * size + j]; wait_rank = r; wait_for = j; }
+    }
+  }
+  LOG() << "Halo exchange over " << num_steps << " step(s): up to " << max_neighbours << " neighbours per rank ("
+        << sum_neighbours / size << " on average), up to " << max_bytes << " bytes sent or received by a rank per "
+        << "step (" << sum_bytes / size << " sent on average), up to " << max_ratio << " shared and ghost dofs per "
+        << "owned dof.";
+  if (max_wait > 0) {
+    LOG() << "  Longest wait: rank " << wait_rank << " for rank " << wait_for << ", " << max_wait
+          << " seconds per step.";
   }
 
+  if (filename.empty()) { return; }
+  /* Only the first rank knows, so a file which can not be written does not stop the run. */
+  std::ofstream out(filename);
+  if (!out) { LOG() << "Warning: could not open the halo report file " << filename << "."; return; }
+  out.precision(9);
+  out << "# Halo exchange of " << size << " ranks over " << num_steps << " step(s).\n";
+  out << "# rank neighbours owned_dofs shared_dofs ghost_dofs bytes_sent bytes_received wait_seconds "
+      << "(per step)\n";
+  for (int r = 0; r < size; r++) {
+    out << r;
+    for (size_t k = 0; k < ns; k++) { out << " " << all_summary[r * ns + k]; }
+    out << "\n";
+  }
+  out << "# Bytes sent per step by the rank of each row to the rank of each column.\n";
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) { out << (j ? " " : "") << sent_matrix[i * size + j]; }
+    out << "\n";
+  }
+  out << "# Seconds per step the rank of each row waited for the messages of the rank of each column.\n";
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) { out << (j ? " " : "") << wait_matrix[i * size + j]; }
+    out << "\n";
+  }
+  LOG() << "Wrote the halo traffic between all ranks to " << filename << ".";
+
 }
 
-void Problem::zeroField(const std::string &name, FieldDict &fields) {
+PetscInt Problem::OutputFrame() const { return mMovie ? mMovie->NumFrames() : mOutputFrame; }
+
+void Problem::SetOutputFrame(const PetscInt frame) {
+  mOutputFrame = frame;
+  if (mMovie) { mMovie->SetNumFrames(frame); }
+}
+
+void Problem::flushSolution() {
+  if (mMovie) { mMovie->flush(); }
+  if (mViewer) { PetscViewerFlush(mViewer); }
+}
+
+void Problem::zeroField(const FieldId name, FieldDict &fields) {
 
   /* Set both local and global vectors to zero. */
   PetscReal zero = 0.0;
@@ -245,10 +1230,10 @@ void Problem::zeroField(const std::string &name, FieldDict &fields) {
 
 }
 
-void Problem::checkInField(const std::string &name, DM PETScDM, FieldDict &fields) {
+void Problem::checkInField(const FieldId name, DM PETScDM, FieldDict &fields) {
 
   /* Ensure field is registered. */
-  assert(fields.find(name) != fields.end());
+  assert(fields.count(name));
 
   /* Assemble local -> global. */
   DMLocalToGlobalBegin(PETScDM, fields[name]->mLoc, ADD_VALUES, fields[name]->mGlb);
@@ -257,10 +1242,10 @@ void Problem::checkInField(const std::string &name, DM PETScDM, FieldDict &field
 }
 
 
-void Problem::checkOutField(const std::string &name, DM PETScDM, FieldDict &fields) {
+void Problem::checkOutField(const FieldId name, DM PETScDM, FieldDict &fields) {
 
   /* Ensure field is registered. */
-  assert(fields.find(name) != fields.end());
+  assert(fields.count(name));
 
   /* Broadcast global -> local. */
   DMGlobalToLocalBegin(PETScDM, fields[name]->mGlb, INSERT_VALUES, fields[name]->mLoc);
@@ -268,6 +1253,73 @@ void Problem::checkOutField(const std::string &name, DM PETScDM, FieldDict &fiel
 
 }
 
+void Problem::checkOutFields(const std::set<FieldId> &names, DM PETScDM, FieldDict &fields) {
+
+  Profiler::Scope scope(Profiler::HaloExchange, "HaloScatter");
+  auto start = std::chrono::steady_clock::now();
+
+  /* The communication pattern is extracted once, for as many fields as are exchanged. */
+  if (!mPullHalo || mPullHalo->Width() != names.size()) {
+    mPullHalo.reset(newHalo(PETScDM, names.size(), mHaloPrecision));
+  }
+
+  auto &glb = mReadArrays; auto &loc = mWriteArrays; glb.clear(); loc.clear();
+  for (auto &name: names) {
+    glb.emplace_back(); VecGetArrayRead(fields[name]->mGlb, &glb.back());
+    loc.emplace_back(); VecGetArray(fields[name]->mLoc, &loc.back());
+  }
+  mPullHalo->scatter(glb, loc);
+  PetscInt f = 0;
+  for (auto &name: names) {
+    VecRestoreArrayRead(fields[name]->mGlb, &glb[f]); VecRestoreArray(fields[name]->mLoc, &loc[f]); f++;
+  }
+  mExchangeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+}
+
+void Problem::checkInFieldsBegin(const std::set<FieldId> &names, DM PETScDM, FieldDict &fields) {
+
+  Profiler::Scope scope(Profiler::HaloExchange, "HaloPost");
+
+  if (!mPushHalo || mPushHalo->Width() != names.size()) {
+    mPushHalo.reset(newHalo(PETScDM, names.size(), mHaloPrecision));
+  }
+
+  auto &loc = mReadArrays; auto &glb = mWriteArrays; loc.clear(); glb.clear();
+  for (auto &name: names) {
+    loc.emplace_back(); VecGetArrayRead(fields[name]->mLoc, &loc.back());
+    glb.emplace_back(); VecGetArray(fields[name]->mGlb, &glb.back());
+  }
+  mPushHalo->gatherBegin(loc, glb);
+  PetscInt f = 0;
+  for (auto &name: names) {
+    VecRestoreArrayRead(fields[name]->mLoc, &loc[f]); VecRestoreArray(fields[name]->mGlb, &glb[f]); f++;
+  }
+
+}
+
+void Problem::checkInFieldsEnd(const std::set<FieldId> &names, DM PETScDM, FieldDict &fields) {
+
+  /* Includes the wait for the contributions of other ranks. */
+  Profiler::Scope scope(Profiler::HaloExchange, "HaloWait");
+  auto start = std::chrono::steady_clock::now();
+
+  auto &glb = mWriteArrays; glb.clear();
+  for (auto &name: names) { glb.emplace_back(); VecGetArray(fields[name]->mGlb, &glb.back()); }
+  mPushHalo->gatherEnd(glb);
+  PetscInt f = 0;
+  for (auto &name: names) { VecRestoreArray(fields[name]->mGlb, &glb[f++]); }
+  mExchangeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+}
+
+/* With interleaved components, a component field (i.e. ux) is stored inside its block field (u). */
+static FieldId storageOfField(const std::string &name, const PetscInt num_comps, PetscInt &comp) {
+  FieldId id = FieldIdFromName(name);
+  comp = num_comps > 1 ? BlockComponent(id) : 0;
+  return num_comps > 1 ? BlockField(id) : id;
+}
+
 void Problem::addFieldOnElement(const std::string &name,
                                 const PetscInt num,
                                 const Eigen::Ref<const IntVec> &closure,
@@ -276,9 +1328,11 @@ void Problem::addFieldOnElement(const std::string &name,
                                 PetscSection PETScSection,
                                 FieldDict &fields) {
 
-  RealVec val(closure.size());
-  for (PetscInt i = 0; i < closure.size(); i++) { val(i) = field(closure(i));   }
-  DMPlexVecSetClosure(PETScDM, PETScSection, fields[name]->mLoc,
+  PetscInt nc, comp; PetscSectionGetFieldComponents(PETScSection, 0, &nc);
+  FieldId id = storageOfField(name, nc, comp);
+  RealVec val = RealVec::Zero(closure.size() * nc);
+  for (PetscInt i = 0; i < closure.size(); i++) { val(i * nc + comp) = field(closure(i)); }
+  DMPlexVecSetClosure(PETScDM, PETScSection, fields[id]->mLoc,
                       num, val.data(), ADD_VALUES);
 
 }
@@ -290,12 +1344,29 @@ void Problem::insertElementalFieldIntoMesh(const std::string &name,
                                            DM PETScDM, PetscSection PETScSection,
                                            FieldDict &fields) {
 
-  RealVec val(closure.size());
-  for (PetscInt i = 0; i < closure.size(); i++) { val(i) = field(closure(i)); }
-  DMPlexVecSetClosure(PETScDM, PETScSection, fields[name]->mLoc,
+  PetscInt nc, comp; PetscSectionGetFieldComponents(PETScSection, 0, &nc);
+  FieldId id = storageOfField(name, nc, comp);
+
+  /* A field without a local vector goes through a work vector, current with the global one. */
+  Vec loc = fields[id]->mLoc;
+  if (!loc) {
+    DMGetLocalVector(PETScDM, &loc);
+    DMGlobalToLocalBegin(PETScDM, fields[id]->mGlb, INSERT_VALUES, loc);
+    DMGlobalToLocalEnd(PETScDM, fields[id]->mGlb, INSERT_VALUES, loc);
+  }
+
+  /* Keep the other components (if any) as they are. */
+  PetscScalar *cur = NULL; PetscInt size;
+  DMPlexVecGetClosure(PETScDM, PETScSection, loc, num, &size, &cur);
+  RealVec val = Eigen::Map<RealVec>(cur, size);
+  DMPlexVecRestoreClosure(PETScDM, PETScSection, loc, num, NULL, &cur);
+
+  for (PetscInt i = 0; i < closure.size(); i++) { val(i * nc + comp) = field(closure(i)); }
+  DMPlexVecSetClosure(PETScDM, PETScSection, loc,
                       num, val.data(), INSERT_VALUES);
-  DMLocalToGlobalBegin(PETScDM, fields[name]->mLoc, INSERT_VALUES, fields[name]->mGlb);
-  DMLocalToGlobalEnd(PETScDM, fields[name]->mLoc, INSERT_VALUES, fields[name]->mGlb);
+  DMLocalToGlobalBegin(PETScDM, loc, INSERT_VALUES, fields[id]->mGlb);
+  DMLocalToGlobalEnd(PETScDM, loc, INSERT_VALUES, fields[id]->mGlb);
+  if (loc != fields[id]->mLoc) { DMRestoreLocalVector(PETScDM, &loc); }
 
 }
 
@@ -306,14 +1377,26 @@ RealVec Problem::getFieldOnElement(const std::string &name,
                                    PetscSection PETScSection,
                                    FieldDict &fields) {
 
+  PetscInt nc, comp; PetscSectionGetFieldComponents(PETScSection, 0, &nc);
+  FieldId id = storageOfField(name, nc, comp);
+
   /* Initialize arrays to get global DOF values. RVO should apply. */
   PetscScalar *val = NULL;
   RealVec field(closure.size());
 
+  /* A field without a local vector is read through a work vector, current with the global one. */
+  Vec loc = fields[id]->mLoc;
+  if (!loc) {
+    DMGetLocalVector(PETScDM, &loc);
+    DMGlobalToLocalBegin(PETScDM, fields[id]->mGlb, INSERT_VALUES, loc);
+    DMGlobalToLocalEnd(PETScDM, fields[id]->mGlb, INSERT_VALUES, loc);
+  }
+
   /* Populate 'val' with field on element, in PETSc ordering. */
-  PetscInt size; DMPlexVecGetClosure(PETScDM, PETScSection, fields[name]->mLoc, num, &size, &val);
-  for (PetscInt i = 0; i < field.size(); i++) { field(closure(i)) = val[i]; }
-  DMPlexVecRestoreClosure(PETScDM, PETScSection, fields[name]->mLoc, num, NULL, &val);
+  PetscInt size; DMPlexVecGetClosure(PETScDM, PETScSection, loc, num, &size, &val);
+  for (PetscInt i = 0; i < field.size(); i++) { field(closure(i)) = val[i * nc + comp]; }
+  DMPlexVecRestoreClosure(PETScDM, PETScSection, loc, num, NULL, &val);
+  if (loc != fields[id]->mLoc) { DMRestoreLocalVector(PETScDM, &loc); }
 
   return field;
 
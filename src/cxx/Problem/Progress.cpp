@@ -0,0 +1,51 @@
+#include <Problem/Progress.h>
+#include <Utilities/Options.h>
+#include <Utilities/Logging.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <mpi.h>
+
+Progress::Progress(std::unique_ptr<Options> const &shot, const PetscInt num_dof) {
+  mDuration = shot->Duration();
+  mInterval = shot->ProgressInterval();
+  mEvery = shot->ProgressEvery();
+  mNumDof = num_dof;
+  mNextStep = mEvery ? mEvery : 1;
+  mLastStep = 0; mLastTime = 0; mLastExchange = 0;
+  mLastWall = clock::now();
+}
+
+void Progress::step(const PetscInt time_idx, const PetscReal time, const PetscReal exchange_seconds) {
+
+  if (time_idx < mNextStep || (!mEvery && !mInterval)) { return; }
+
+  /* Wall time (of the slowest rank), and the largest and mean work, since the last report. */
+  const double wall = std::chrono::duration<double>(clock::now() - mLastWall).count();
+  const double work = std::max(0.0, wall - (exchange_seconds - mLastExchange));
+  double red[2] = {wall, work}, max[2], sum;
+  MPI_Allreduce(red, max, 2, MPI_DOUBLE, MPI_MAX, PETSC_COMM_WORLD);
+  MPI_Allreduce(&work, &sum, 1, MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
+  int size; MPI_Comm_size(PETSC_COMM_WORLD, &size);
+
+  const PetscInt steps = time_idx - mLastStep;
+  const double steps_per_s = max[0] > 0 ? steps / max[0] : 0;
+  const double sim_per_s = max[0] > 0 ? (time - mLastTime) / max[0] : 0;
+  const bool calibration = !mEvery && !mLastStep;
+  if (!calibration) {
+    const double eta = sim_per_s > 0 ? std::max(0.0, mDuration - time) / sim_per_s : 0;
+    const double imbalance = sum > 0 ? max[1] * size / sum : 1;
+    char line[160];
+    std::snprintf(line, sizeof(line), "Progress: time %.4e of %.4e, step %d, %.3g steps/s, %.3e dof updates/s, "
+                  "%.0f s to go, imbalance %.2f", time, mDuration, static_cast<int>(time_idx), steps_per_s,
+                  steps_per_s * mNumDof, eta, imbalance);
+    LOG() << line;
+  }
+
+  /* Steps until the next report. */
+  if (mEvery) { mNextStep = time_idx + mEvery; }
+  else { mNextStep = time_idx + std::max<PetscInt>(1, std::lround(mInterval * steps_per_s)); }
+  mLastStep = time_idx; mLastTime = time; mLastExchange = exchange_seconds;
+  mLastWall = clock::now();
+
+}
@@ -0,0 +1,288 @@
+#include <Problem/RegularGrid.h>
+#include <Problem/Movie.h>
+#include <Element/Element.h>
+#include <Utilities/Logging.h>
+#include <Utilities/Options.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <set>
+#include <stdexcept>
+
+RegularGrid::RegularGrid(std::unique_ptr<Options> const &shot) {
+
+  mOrigin = shot->GridOrigin(); mSpacing = shot->GridSpacing(); mFields = shot->GridFields();
+  mEvery = shot->GridEvery(); mNumDim = shot->Dimension(); mNumComponents = 1;
+  const std::vector<PetscInt> shape = shot->GridShape();
+  for (PetscInt d = 0; d < 3; d++) { mShape[d] = d < mNumDim ? shape[d] : 1; }
+  mWeights = nullptr; mValues = nullptr; mNumInside = 0; mNumFrames = 0;
+
+  /* Each rank holds a block of lines along x, of about the same size. */
+  int rank, size;
+  MPI_Comm_rank(PETSC_COMM_WORLD, &rank); MPI_Comm_size(PETSC_COMM_WORLD, &size);
+  const hsize_t num_lines = mShape[1] * mShape[2];
+  for (int r = 0; r <= size; r++) { mFirstLine.push_back(num_lines * r / size); }
+
+  hid_t plist_id = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fapl_mpio(plist_id, PETSC_COMM_WORLD, MPI_INFO_NULL);
+  mFileId = H5Fcreate(shot->GridFile().c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, plist_id);
+  H5Pclose(plist_id);
+  if (mFileId < 0) { throw std::runtime_error("Can't create grid file '" + shot->GridFile() + "'."); }
+
+  const hsize_t nd = mNumDim;
+  Movie::WriteRows(mFileId, "/origin", {nd}, {0}, {nd},
+                   rank ? std::vector<double>() : std::vector<double>(mOrigin.begin(), mOrigin.end()));
+  Movie::WriteRows(mFileId, "/spacing", {nd}, {0}, {nd},
+                   rank ? std::vector<double>() : std::vector<double>(mSpacing.begin(), mSpacing.end()));
+
+  /* Time of each frame. */
+  hsize_t dims = 0, max_dims = H5S_UNLIMITED, chunk = 1024;
+  hid_t filespace = H5Screate_simple(1, &dims, &max_dims);
+  hid_t dcpl_id = H5Pcreate(H5P_DATASET_CREATE);
+  H5Pset_chunk(dcpl_id, 1, &chunk);
+  mTimeSet = H5Dcreate(mFileId, "/time", H5T_NATIVE_DOUBLE, filespace, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+  H5Pclose(dcpl_id);
+  H5Sclose(filespace);
+
+}
+
+RegularGrid::~RegularGrid() {
+  if (mWeights) { MatDestroy(&mWeights); }
+  if (mValues) { VecDestroy(&mValues); }
+  for (auto &set: mSets) { H5Dclose(set.second); }
+  H5Dclose(mTimeSet);
+  H5Fclose(mFileId);
+}
+
+int RegularGrid::lineRank(const hsize_t line) const {
+  return std::upper_bound(mFirstLine.begin(), mFirstLine.end(), line) - mFirstLine.begin() - 1;
+}
+
+void RegularGrid::setup(ElemVec const &elements, DM PETScDM, PetscSection PETScSection, FieldDict &fields) {
+
+  int rank, size;
+  MPI_Comm_rank(PETSC_COMM_WORLD, &rank); MPI_Comm_size(PETSC_COMM_WORLD, &size);
+  if (!elements.empty() && elements[0]->Name().find("Quad") == std::string::npos &&
+      elements[0]->Name().find("Hex") == std::string::npos) {
+    throw std::runtime_error("--grid-file requires a mesh of quads or hexes, not " + elements[0]->Name() + ".");
+  }
+
+  /* The displacement of the physics, unless the fields are given. */
+  if (mFields.empty()) {
+    for (auto f: {"u", "ux", "uy", "uz"}) { if (fields.count(f)) { mFields.push_back(f); } }
+  }
+  for (auto &f: mFields) {
+    if (!fields.count(f)) { throw std::runtime_error("--grid-fields holds " + f + ", which is not registered."); }
+  }
+  PetscSectionGetFieldComponents(PETScSection, 0, &mNumComponents);
+  const PetscInt nc = mNumComponents;
+
+  /* Global (block) index of every element's dofs, pulled through the closure as in the assembly plan. */
+  Vec glb, loc; DMGetGlobalVector(PETScDM, &glb); DMGetLocalVector(PETScDM, &loc);
+  PetscInt start, num_glb; VecGetOwnershipRange(glb, &start, NULL); VecGetLocalSize(glb, &num_glb);
+  PetscScalar *val; VecGetArray(glb, &val);
+  for (PetscInt i = 0; i < num_glb; i++) { val[i] = start + i; }
+  VecRestoreArray(glb, &val);
+  DMGlobalToLocalBegin(PETScDM, glb, INSERT_VALUES, loc);
+  DMGlobalToLocalEnd(PETScDM, glb, INSERT_VALUES, loc);
+  DMRestoreGlobalVector(PETScDM, &glb);
+  std::vector<std::vector<PetscInt>> elm_dof(elements.size());
+  PetscInt max_dofs = 0;
+  for (size_t e = 0; e < elements.size(); e++) {
+    const auto &closure = elements[e]->ClsMap();
+    PetscScalar *cls = NULL; PetscInt csize;
+    DMPlexVecGetClosure(PETScDM, PETScSection, loc, elements[e]->Num(), &csize, &cls);
+    elm_dof[e].resize(closure.size());
+    for (PetscInt i = 0; i < closure.size(); i++) {
+      elm_dof[e][closure(i)] = static_cast<PetscInt> (PetscRealPart(cls[i * nc]) + 0.5) / nc;
+    }
+    DMPlexVecRestoreClosure(PETScDM, PETScSection, loc, elements[e]->Num(), NULL, &cls);
+    max_dofs = std::max<PetscInt>(max_dofs, closure.size());
+  }
+  DMRestoreLocalVector(PETScDM, &loc);
+  MPI_Allreduce(MPI_IN_PLACE, &max_dofs, 1, MPIU_INT, MPI_MAX, PETSC_COMM_WORLD);
+
+  /* The grid points within the bounding box of each element are tested against the element itself. The
+   * weights of each point found are sent to the rank of its line, as the point, the number of weights, and a
+   * dof and weight each. */
+  const hsize_t nx = mShape[0], ny = mShape[1];
+  std::vector<std::vector<double>> send(size);
+  std::set<hsize_t> found;
+  Eigen::VectorXd x(mNumDim);
+  for (size_t e = 0; e < elements.size(); e++) {
+    const Eigen::MatrixXd nodes = elements[e]->NodalCoordinates();
+    hsize_t lo[3] = {0, 0, 0}, hi[3] = {1, 1, 1};
+    bool empty = false;
+    for (PetscInt d = 0; d < mNumDim; d++) {
+      const double a = (nodes.col(d).minCoeff() - mOrigin[d]) / mSpacing[d] - 1e-8;
+      const double b = (nodes.col(d).maxCoeff() - mOrigin[d]) / mSpacing[d] + 1e-8;
+      const double beg = std::max<double>(std::ceil(a), 0), end = std::min<double>(std::floor(b) + 1, mShape[d]);
+      if (beg >= end) { empty = true; break; }
+      lo[d] = beg; hi[d] = end;
+    }
+    if (empty) { continue; }
+    for (hsize_t k = lo[2]; k < hi[2]; k++) {
+      for (hsize_t j = lo[1]; j < hi[1]; j++) {
+        for (hsize_t i = lo[0]; i < hi[0]; i++) {
+          const hsize_t point = (k * ny + j) * nx + i, idx[3] = {i, j, k};
+          if (found.count(point)) { continue; }
+          for (PetscInt d = 0; d < mNumDim; d++) { x(d) = mOrigin[d] + idx[d] * mSpacing[d]; }
+          if (!elements[e]->containsPoint(x)) { continue; }
+          found.insert(point);
+          const Eigen::MatrixXd w = elements[e]->interpolateFieldAtPoint(x);
+          std::vector<double> &buf = send[lineRank(point / nx)];
+          buf.push_back(point); buf.push_back(0);
+          const size_t num = buf.size() - 1;
+          for (PetscInt m = 0; m < w.size(); m++) {
+            if (std::abs(w(m)) > 1e-10) { buf.push_back(elm_dof[e][m]); buf.push_back(w(m)); buf[num]++; }
+          }
+        }
+      }
+    }
+  }
+
+  /* This is only done once, so the all-to-all is fine. */
+  std::vector<int> num_send(size), num_recv(size), send_dsp(size, 0), recv_dsp(size, 0);
+  std::vector<double> send_buf;
+  for (int r = 0; r < size; r++) {
+    num_send[r] = send[r].size();
+    send_buf.insert(send_buf.end(), send[r].begin(), send[r].end());
+  }
+  MPI_Alltoall(num_send.data(), 1, MPI_INT, num_recv.data(), 1, MPI_INT, PETSC_COMM_WORLD);
+  for (int r = 1; r < size; r++) {
+    send_dsp[r] = send_dsp[r - 1] + num_send[r - 1]; recv_dsp[r] = recv_dsp[r - 1] + num_recv[r - 1];
+  }
+  std::vector<double> recv_buf(recv_dsp[size - 1] + num_recv[size - 1]);
+  MPI_Alltoallv(send_buf.data(), num_send.data(), send_dsp.data(), MPI_DOUBLE,
+                recv_buf.data(), num_recv.data(), recv_dsp.data(), MPI_DOUBLE, PETSC_COMM_WORLD);
+
+  /* One row per point of this rank's lines and component. The buffer is in rank order, so the first of several
+   * rows of a point is that of the lowest rank. */
+  const hsize_t first = mFirstLine[rank] * nx, num_points = (mFirstLine[rank + 1] - mFirstLine[rank]) * nx;
+  MatCreateAIJ(PETSC_COMM_WORLD, num_points * nc, num_glb, PETSC_DETERMINE, PETSC_DETERMINE, max_dofs, NULL,
+               max_dofs, NULL, &mWeights);
+  std::vector<bool> inside(num_points, false);
+  std::vector<PetscInt> cols; std::vector<PetscScalar> vals;
+  for (size_t i = 0; i < recv_buf.size(); ) {
+    const hsize_t point = recv_buf[i];
+    const size_t num = recv_buf[i + 1], beg = i + 2;
+    i = beg + 2 * num;
+    if (inside[point - first]) { continue; }
+    inside[point - first] = true;
+    for (PetscInt c = 0; c < nc; c++) {
+      cols.clear(); vals.clear();
+      for (size_t m = 0; m < num; m++) {
+        cols.push_back(static_cast<PetscInt> (recv_buf[beg + 2 * m]) * nc + c);
+        vals.push_back(recv_buf[beg + 2 * m + 1]);
+      }
+      PetscInt row = point * nc + c;
+      MatSetValues(mWeights, 1, &row, cols.size(), cols.data(), vals.data(), INSERT_VALUES);
+    }
+  }
+  MatAssemblyBegin(mWeights, MAT_FINAL_ASSEMBLY);
+  MatAssemblyEnd(mWeights, MAT_FINAL_ASSEMBLY);
+  MatCreateVecs(mWeights, NULL, &mValues);
+
+  mOutside.clear();
+  for (hsize_t p = 0; p < num_points; p++) { if (!inside[p]) { mOutside.push_back(p); } }
+  PetscInt num_inside = num_points - mOutside.size();
+  MPI_Allreduce(&num_inside, &mNumInside, 1, MPIU_INT, MPI_SUM, PETSC_COMM_WORLD);
+  LOG() << "Interpolating to " << mNumInside << " of " << nx * ny * mShape[2] << " grid points.";
+
+}
+
+hid_t RegularGrid::fieldSet(const std::string &field) {
+
+  if (mSets.count(field)) { return mSets[field]; }
+
+  /* Frame major, as the movie, in chunks of a few MB within a frame. */
+  const hsize_t nc = mNumComponents;
+  std::vector<hsize_t> dims = {0}, max_dims = {H5S_UNLIMITED}, chunk = {1};
+  for (PetscInt d = mNumDim - 1; d >= 0; d--) {
+    dims.push_back(mShape[d]); max_dims.push_back(mShape[d]);
+    chunk.push_back(std::min<hsize_t>(mShape[d], d ? 32 : 256));
+  }
+  dims.push_back(nc); max_dims.push_back(nc); chunk.push_back(nc);
+  hid_t filespace = H5Screate_simple(dims.size(), dims.data(), max_dims.data());
+  hid_t dcpl_id = H5Pcreate(H5P_DATASET_CREATE);
+  H5Pset_chunk(dcpl_id, chunk.size(), chunk.data());
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  H5Pset_fill_value(dcpl_id, H5T_NATIVE_DOUBLE, &nan);
+  hid_t set = H5Dcreate(mFileId, ("/" + field).c_str(), H5T_NATIVE_DOUBLE, filespace, H5P_DEFAULT, dcpl_id,
+                        H5P_DEFAULT);
+  H5Pclose(dcpl_id);
+  H5Sclose(filespace);
+  return mSets[field] = set;
+
+}
+
+void RegularGrid::write(const PetscReal time, FieldDict &fields) {
+
+  if (!mWeights) { throw std::runtime_error("RegularGrid::setup must be called before writing frames."); }
+
+  int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+  hid_t plist_id = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
+  const hsize_t nx = mShape[0], ny = mShape[1], nc = mNumComponents;
+  const hsize_t first = mFirstLine[rank], last = mFirstLine[rank + 1];
+  PetscInt num_vals; VecGetLocalSize(mValues, &num_vals);
+  hsize_t mem_size = std::max<PetscInt>(num_vals, 1);
+
+  for (auto &f: mFields) {
+
+    /* One product per field, with NaN outside the mesh. */
+    MatMult(mWeights, fields[f]->mGlb, mValues);
+    PetscScalar *val; VecGetArray(mValues, &val);
+    for (auto p: mOutside) {
+      for (hsize_t c = 0; c < nc; c++) { val[p * nc + c] = std::numeric_limits<double>::quiet_NaN(); }
+    }
+
+    /* Append the frame. This rank's lines are a part of a plane, whole planes, and a part of a plane (in 2D,
+     * the single plane). */
+    hid_t set = fieldSet(f);
+    std::vector<hsize_t> dims = {mNumFrames + 1};
+    for (PetscInt d = mNumDim - 1; d >= 0; d--) { dims.push_back(mShape[d]); }
+    dims.push_back(nc);
+    H5Dset_extent(set, dims.data());
+    hid_t filespace = H5Dget_space(set);
+    hid_t memspace = H5Screate_simple(1, &mem_size, NULL);
+    H5Sselect_none(filespace);
+    for (hsize_t l = first; l < last; ) {
+      const hsize_t k = l / ny, j = l % ny;
+      const hsize_t planes = j ? 0 : (last - l) / ny, lines = planes ? planes * ny : std::min(last - l, ny - j);
+      std::vector<hsize_t> start = {mNumFrames}, count = {1};
+      if (mNumDim == 3) { start.push_back(k); count.push_back(planes ? planes : 1); }
+      start.push_back(j); count.push_back(planes ? ny : lines);
+      start.push_back(0); count.push_back(nx);
+      start.push_back(0); count.push_back(nc);
+      H5Sselect_hyperslab(filespace, H5S_SELECT_OR, start.data(), NULL, count.data(), NULL);
+      l += lines;
+    }
+    const double zero = 0;
+    if (!num_vals) { H5Sselect_none(memspace); }
+    H5Dwrite(set, H5T_NATIVE_DOUBLE, memspace, filespace, plist_id, num_vals ? val : &zero);
+    H5Sclose(memspace);
+    H5Sclose(filespace);
+    VecRestoreArray(mValues, &val);
+
+  }
+
+  /* The first rank writes the time. */
+  hsize_t dims = mNumFrames + 1, one = 1;
+  H5Dset_extent(mTimeSet, &dims);
+  hid_t filespace = H5Dget_space(mTimeSet);
+  hid_t memspace = H5Screate_simple(1, &one, NULL);
+  if (rank) {
+    H5Sselect_none(filespace); H5Sselect_none(memspace);
+  } else {
+    H5Sselect_hyperslab(filespace, H5S_SELECT_SET, &mNumFrames, NULL, &one, NULL);
+  }
+  double t = time;
+  H5Dwrite(mTimeSet, H5T_NATIVE_DOUBLE, memspace, filespace, plist_id, &t);
+  H5Sclose(memspace);
+  H5Sclose(filespace);
+  H5Pclose(plist_id);
+
+  mNumFrames++;
+
+}
@@ -0,0 +1,247 @@
+#include <Problem/Restart.h>
+#include <Problem/Checkpoints.h>
+#include <Receiver/Receiver.h>
+#include <Utilities/Options.h>
+#include <Utilities/Logging.h>
+#include <hdf5.h>
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+
+/* Create a 1D dataset, and write one block of it (collective). Ranks without a block give none. */
+template <typename T>
+static void writeBlock(hid_t file_id, const std::string &name, const hsize_t size, const hsize_t start,
+                       const hsize_t count, const T *buf, hid_t type) {
+  hid_t filespace = H5Screate_simple(1, &size, NULL);
+  hid_t set = H5Dcreate(file_id, name.c_str(), type, filespace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  hsize_t mem_size = std::max<hsize_t>(count, 1);
+  hid_t memspace = H5Screate_simple(1, &mem_size, NULL);
+  T none = 0;
+  if (!count) {
+    H5Sselect_none(filespace); H5Sselect_none(memspace);
+    buf = &none;
+  } else {
+    H5Sselect_hyperslab(filespace, H5S_SELECT_SET, &start, NULL, &count, NULL);
+  }
+  hid_t plist_id = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
+  H5Dwrite(set, type, memspace, filespace, plist_id, buf);
+  H5Pclose(plist_id);
+  H5Sclose(memspace);
+  H5Sclose(filespace);
+  H5Dclose(set);
+}
+
+/* Read one block of a 1D dataset (collective). Returns false if the dataset is missing or too short. */
+template <typename T>
+static bool readBlock(hid_t file_id, const std::string &name, const hsize_t start, const hsize_t count, T *buf,
+                      hid_t type) {
+  if (H5Lexists(file_id, name.c_str(), H5P_DEFAULT) <= 0) { return false; }
+  hid_t set = H5Dopen(file_id, name.c_str(), H5P_DEFAULT);
+  hid_t filespace = H5Dget_space(set);
+  hsize_t size = 0;
+  H5Sget_simple_extent_dims(filespace, &size, NULL);
+  const bool fits = start + count <= size;
+  hsize_t mem_size = std::max<hsize_t>(count, 1);
+  hid_t memspace = H5Screate_simple(1, &mem_size, NULL);
+  T none = 0;
+  if (!count || !fits) {
+    H5Sselect_none(filespace); H5Sselect_none(memspace);
+  } else {
+    H5Sselect_hyperslab(filespace, H5S_SELECT_SET, &start, NULL, &count, NULL);
+  }
+  hid_t plist_id = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
+  H5Dread(set, type, memspace, filespace, plist_id, count && fits ? buf : &none);
+  H5Pclose(plist_id);
+  H5Sclose(memspace);
+  H5Sclose(filespace);
+  H5Dclose(set);
+  return fits;
+}
+
+/* Number of entries of a 1D dataset, or 0 if it is missing. */
+static hsize_t blockSize(hid_t file_id, const std::string &name) {
+  if (H5Lexists(file_id, name.c_str(), H5P_DEFAULT) <= 0) { return 0; }
+  hid_t set = H5Dopen(file_id, name.c_str(), H5P_DEFAULT);
+  hid_t filespace = H5Dget_space(set);
+  hsize_t size = 0;
+  H5Sget_simple_extent_dims(filespace, &size, NULL);
+  H5Sclose(filespace);
+  H5Dclose(set);
+  return size;
+}
+
+Restart::Restart(std::unique_ptr<Options> const &options, FieldDict &fields) {
+
+  mFields = Checkpoints::StateFields(fields);
+  for (auto &name: mFields) {
+    PetscInt start, end; VecGetOwnershipRange(fields[name]->mGlb, &start, &end);
+    mStarts.push_back(start); mSizes.push_back(end - start);
+  }
+
+  /* As for the receivers (see ReceiverHdf5::openStream), the writing thread has a communicator of its own. */
+  mComm = PETSC_COMM_WORLD;
+  if (options->AsyncOutput()) {
+    int level; MPI_Query_thread(&level);
+    if (level >= MPI_THREAD_MULTIPLE) {
+      MPI_Comm_dup(PETSC_COMM_WORLD, &mComm);
+      mWriter.reset(new AsyncWriter);
+    } else {
+      LOG() << "Warning: MPI was not initialized with MPI_THREAD_MULTIPLE. Restart files are written "
+               "synchronously.";
+    }
+  }
+
+}
+
+Restart::~Restart() {
+  mWriter.reset();
+  if (mComm != PETSC_COMM_WORLD) { MPI_Comm_free(&mComm); }
+}
+
+void Restart::wait() {
+  if (mWriter) { mWriter->wait(); }
+}
+
+void Restart::write(const std::string &file, const PetscInt time_idx, const PetscReal time,
+                    const PetscInt output_frame, FieldDict &fields) {
+
+  /* The receiver file must hold every sample up to here, before the thread of either writes again. */
+  wait();
+  Receiver::writeOutput();
+  Receiver::waitOutput();
+  Receiver::flushOutput();
+
+  /* Copy the state, which the time loop changes from the next step on. */
+  size_t total = 0;
+  for (auto size: mSizes) { total += size; }
+  mSnapshot.resize(total);
+  double *out = mSnapshot.data();
+  for (size_t i = 0; i < mFields.size(); i++) {
+    const PetscScalar *val; VecGetArrayRead(fields[mFields[i]]->mGlb, &val);
+    std::copy(val, val + mSizes[i], out);
+    VecRestoreArrayRead(fields[mFields[i]]->mGlb, &val);
+    out += mSizes[i];
+  }
+  std::vector<PetscInt> global_sizes;
+  for (auto &name: mFields) { PetscInt size; VecGetSize(fields[name]->mGlb, &size); global_sizes.push_back(size); }
+
+  /* Samples written of each receiver (each rank knows those of its own), and the filters of this rank's, which
+   * are laid out in rank order. */
+  std::vector<unsigned long long> written = Receiver::OutputWritten();
+  MPI_Allreduce(MPI_IN_PLACE, written.data(), written.size(), MPI_UNSIGNED_LONG_LONG, MPI_MAX, PETSC_COMM_WORLD);
+  std::vector<double> filters = Receiver::FilterState();
+  unsigned long long num_filters = filters.size(), filter_offset = 0, filter_total = 0;
+  MPI_Exscan(&num_filters, &filter_offset, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, PETSC_COMM_WORLD);
+  MPI_Allreduce(&num_filters, &filter_total, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, PETSC_COMM_WORLD);
+  int rank, size; MPI_Comm_rank(PETSC_COMM_WORLD, &rank); MPI_Comm_size(PETSC_COMM_WORLD, &size);
+  if (!rank) { filter_offset = 0; }
+
+  const std::string tmp = file + ".tmp";
+  const MPI_Comm comm = mComm;
+  const std::vector<std::string> names = mFields;
+  const std::vector<PetscInt> starts = mStarts, sizes = mSizes;
+  const double *snapshot = mSnapshot.data();
+  auto task = [=]() {
+
+    hid_t plist_id = H5Pcreate(H5P_FILE_ACCESS);
+    H5Pset_fapl_mpio(plist_id, comm, MPI_INFO_NULL);
+    hid_t file_id = H5Fcreate(tmp.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, plist_id);
+    H5Pclose(plist_id);
+
+    /* Each rank's part of the global vectors. */
+    const double *state = snapshot;
+    for (size_t i = 0; i < names.size(); i++) {
+      writeBlock(file_id, "/" + names[i], global_sizes[i], starts[i], sizes[i], state, H5T_NATIVE_DOUBLE);
+      state += sizes[i];
+    }
+    long long local = sizes.empty() ? 0 : sizes.front();
+    writeBlock(file_id, "/ownership", size, rank, 1, &local, H5T_NATIVE_LLONG);
+
+    /* The scalars and the samples written are the same on all ranks, and written by the first. */
+    const hsize_t first = rank ? 0 : 1;
+    long long steps[2] = {time_idx, output_frame};
+    double t = time;
+    writeBlock(file_id, "/time", 1, 0, first, &t, H5T_NATIVE_DOUBLE);
+    writeBlock(file_id, "/steps", 2, 0, 2 * first, steps, H5T_NATIVE_LLONG);
+    writeBlock(file_id, "/receiver_written", written.size(), 0, first * written.size(), written.data(),
+               H5T_NATIVE_ULLONG);
+    writeBlock(file_id, "/receiver_filters", filter_total, filter_offset, num_filters, filters.data(),
+               H5T_NATIVE_DOUBLE);
+    writeBlock(file_id, "/receiver_filter_sizes", size, rank, 1, &num_filters, H5T_NATIVE_ULLONG);
+    H5Fclose(file_id);
+
+    /* Only a complete file replaces the last one. */
+    MPI_Barrier(comm);
+    if (!rank && std::rename(tmp.c_str(), file.c_str())) {
+      LOG() << "Warning: can't move restart file '" << tmp << "' to '" << file << "'.";
+    }
+
+  };
+
+  if (mWriter) { mWriter->submit(task); } else { task(); }
+
+}
+
+void Restart::read(const std::string &file, PetscInt &time_idx, PetscReal &time, PetscInt &output_frame,
+                   FieldDict &fields) {
+
+  hid_t plist_id = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fapl_mpio(plist_id, PETSC_COMM_WORLD, MPI_INFO_NULL);
+  hid_t file_id = H5Fopen(file.c_str(), H5F_ACC_RDONLY, plist_id);
+  H5Pclose(plist_id);
+  if (file_id < 0) { throw std::runtime_error("Can't open restart file '" + file + "'."); }
+
+  /* The decomposition of the run which wrote the file. Every rank makes the same (collective) reads, and all
+   * fail together. */
+  int rank, size; MPI_Comm_rank(PETSC_COMM_WORLD, &rank); MPI_Comm_size(PETSC_COMM_WORLD, &size);
+  long long local = -1;
+  int bad = blockSize(file_id, "/ownership") != static_cast<hsize_t>(size);
+  if (!readBlock(file_id, "/ownership", rank, 1, &local, H5T_NATIVE_LLONG)) { bad = 1; }
+  if (local != (mSizes.empty() ? 0 : mSizes.front())) { bad = 1; }
+  for (size_t i = 0; i < mFields.size(); i++) {
+    PetscInt global; VecGetSize(fields[mFields[i]]->mGlb, &global);
+    if (blockSize(file_id, "/" + mFields[i]) != static_cast<hsize_t>(global)) { bad = 1; }
+  }
+  MPI_Allreduce(MPI_IN_PLACE, &bad, 1, MPI_INT, MPI_MAX, PETSC_COMM_WORLD);
+  if (bad) {
+    H5Fclose(file_id);
+    throw std::runtime_error("Restart file '" + file + "' was written with another mesh, physics or number of "
+                             "ranks. Resume with the mesh of the first run (--save-mesh-file) on as many ranks.");
+  }
+
+  for (size_t i = 0; i < mFields.size(); i++) {
+    std::vector<double> buf(mSizes[i]);
+    readBlock(file_id, "/" + mFields[i], mStarts[i], mSizes[i], buf.data(), H5T_NATIVE_DOUBLE);
+    PetscScalar *val; VecGetArray(fields[mFields[i]]->mGlb, &val);
+    std::copy(buf.begin(), buf.end(), val);
+    VecRestoreArray(fields[mFields[i]]->mGlb, &val);
+  }
+
+  long long steps[2] = {0, 0};
+  double t = 0;
+  readBlock(file_id, "/time", 0, 1, &t, H5T_NATIVE_DOUBLE);
+  readBlock(file_id, "/steps", 0, 2, steps, H5T_NATIVE_LLONG);
+  time = t; time_idx = steps[0]; output_frame = steps[1];
+  fields.SetFromRest(time_idx == 0);
+
+  /* Where the receiver output stands, which must be that of the same receivers. */
+  std::vector<unsigned long long> written = Receiver::OutputWritten();
+  unsigned long long num_filters = Receiver::FilterState().size(), filter_size = 0, filter_offset = 0;
+  readBlock(file_id, "/receiver_filter_sizes", rank, 1, &filter_size, H5T_NATIVE_ULLONG);
+  MPI_Exscan(&filter_size, &filter_offset, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, PETSC_COMM_WORLD);
+  if (!rank) { filter_offset = 0; }
+  std::vector<double> filters(num_filters);
+  bad = blockSize(file_id, "/receiver_written") != written.size() || filter_size != num_filters;
+  if (!readBlock(file_id, "/receiver_written", 0, written.size(), written.data(), H5T_NATIVE_ULLONG)) { bad = 1; }
+  if (!readBlock(file_id, "/receiver_filters", filter_offset, num_filters, filters.data(), H5T_NATIVE_DOUBLE)) {
+    bad = 1;
+  }
+  H5Fclose(file_id);
+  MPI_Allreduce(MPI_IN_PLACE, &bad, 1, MPI_INT, MPI_MAX, PETSC_COMM_WORLD);
+  if (bad) { throw std::runtime_error("Restart file '" + file + "' was written with other receivers."); }
+  Receiver::SetOutputWritten(written);
+  Receiver::SetFilterState(filters);
+
+}
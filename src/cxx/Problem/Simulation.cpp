@@ -0,0 +1,856 @@
+#include <Problem/Simulation.h>
+#include <Problem/Problem.h>
+#include <Problem/Progress.h>
+#include <Problem/Monitor.h>
+#include <Problem/Fourier.h>
+#include <Problem/RegularGrid.h>
+#include <Problem/Staging.h>
+#include <Problem/Checkpoints.h>
+#include <Problem/Restart.h>
+#include <Problem/BoundaryWavefield.h>
+#include <Problem/Movie.h>
+#include <Problem/StrainDatabase.h>
+#include <Mesh/Mesh.h>
+#include <Model/ExodusModel.h>
+#include <Receiver/Receiver.h>
+#include <Receiver/Misfit.h>
+#include <Source/Source.h>
+#include <Utilities/Options.h>
+#include <Utilities/Logging.h>
+#include <Utilities/Profiler.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <set>
+#include <thread>
+
+Simulation::Simulation(std::unique_ptr<Options> const &options) {
+
+  Profiler::PushStage(Profiler::Setup);
+
+  /* Use options to allocate simulation components. */
+  mMesh = Mesh::Factory(options);
+  mProblem = Problem::Factory(options);
+  mModel.reset(new ExodusModel(options));
+
+  /* Initialize relevant components and perform parallel decomposition. The model is read first when the
+   * decomposition is weighted by the physics of each element (or taken from a partition cache). */
+  const bool box = !options->BoxElements().empty();
+  {
+    Profiler::Scope scope(Profiler::MeshRead);
+    if (box) {
+      /* A synthetic box and homogeneous model, instead of the files. */
+      mModel->setHomogeneous(options->BoxElements().size(), options->BoxPhysics(), options->BoxMaterial());
+      mMesh->readBox(options);
+    } else if (options->OverlapSetup() && !options->WeightedPartitioning() && options->PartitionCacheFile().empty()) {
+      /* The partition does not depend on the model, so the first rank parses the model file on a second thread
+       * while the mesh is partitioned and distributed. It only starts once the mesh file is closed, as the
+       * exodus library is not thread safe, and all MPI calls stay on this thread. */
+      std::thread parse;
+      std::exception_ptr error;
+      try {
+        mMesh->read([&]() {
+          parse = std::thread([&]() {
+            try { mModel->readFile(); } catch (...) { error = std::current_exception(); }
+          });
+        });
+      } catch (...) {
+        if (parse.joinable()) { parse.join(); }
+        throw;
+      }
+      if (parse.joinable()) { parse.join(); }
+      if (error) { std::rethrow_exception(error); }
+      mModel->broadcastFile();
+    } else {
+      mModel->read();
+      mMesh->read(mModel, options);
+    }
+  }
+  if (!options->SaveMeshFile().empty()) { mMesh->save(options->SaveMeshFile()); }
+
+  /* The other members of an ensemble are read like the model, and localized with it. */
+  for (auto &file: options->EnsembleModelFiles()) {
+    Profiler::Scope scope(Profiler::MeshRead);
+    mModel->addMember(file);
+  }
+  if (options->DistributeModel() && !box) { mModel->localize(mMesh->ElementCenters(), mMesh->ModelElements()); }
+
+  /* Attach physics. Use this to inform the element generation. */
+  {
+    Profiler::Scope scope(Profiler::Topology);
+    mMesh->setupTopology(mModel, options);
+  }
+
+  /* Use mesh topology to generate our master list of elements. */
+  {
+    Profiler::Scope scope(Profiler::ElementInit);
+    mElements = mProblem->initializeElements(mMesh, mModel, options);
+  }
+  mTimeStep = options->TimeStep();
+
+  /* Use elements to inform the global DOF layout. */
+  mMesh->setupGlobalDof(mElements[0], options);
+
+  mFields = mProblem->initializeGlobalDofs(mElements, mMesh);
+
+  Profiler::PopStage();
+
+  mMemoryReport = options->MemoryReport();
+  if (mMemoryReport) { Memory::report("after setup", MemoryBytes()); }
+
+}
+
+/* Defined here, where the members are complete types. The fields and elements are released first. */
+Simulation::~Simulation() {}
+
+PetscInt Simulation::run(std::unique_ptr<Options> const &shot) {
+
+  /* The time step may only be rounded to the shot's duration, unless the shot sets its own. */
+  if (shot->AutomaticTimeStep()) { shot->SetTimeStep(mTimeStep); }
+  mProblem->SetTimeStep(shot->TimeStep());
+
+  /* Replace the sources and receivers of the previous shot, and start from rest. */
+  for (auto &elm: mElements) { elm->detachSourcesAndReceivers(); elm->SetTimeStep(shot->TimeStep()); }
+  mProblem->attachSourcesAndReceivers(mElements, shot);
+  mFields = mProblem->resetFields(std::move(mFields));
+
+  /* A static problem takes no steps, but a single solve under the loads at time zero. */
+  if (shot->StaticProblem()) {
+    Profiler::PushStage(Profiler::TimeLoop);
+    Source::advanceTable(0);
+    mFields = mProblem->solveStatic(std::move(mFields), 0, mMesh->DistributedMesh());
+    if (shot->SaveMovie()) { mProblem->saveSolution(0, shot->MovieFields(), mFields, mMesh->DistributedMesh()); }
+    {
+      Profiler::Scope scope(Profiler::Output);
+      Receiver::closeOutput();
+    }
+    Profiler::PopStage();
+    return 0;
+  }
+
+  /* Compute solution in time. */
+  Profiler::PushStage(Profiler::TimeLoop);
+  Progress progress(shot, NumGlobalDof());
+  Monitor monitor(shot);
+  std::unique_ptr<Fourier> dft;
+  if (!shot->DftFrequencies().empty()) {
+    dft.reset(new Fourier(shot));
+    dft->setup(mElements, mMesh->DistributedMesh(), mMesh->MeshSection(), mFields);
+  }
+  std::unique_ptr<RegularGrid> grid;
+  if (!shot->GridFile().empty()) {
+    grid.reset(new RegularGrid(shot));
+    grid->setup(mElements, mMesh->DistributedMesh(), mMesh->MeshSection(), mFields);
+  }
+  std::unique_ptr<Staging> staging;
+  if (!shot->StagingStream().empty()) {
+    staging.reset(new Staging(shot));
+    staging->setup(mElements, mMesh->DistributedMesh(), mMesh->MeshSection(), mFields);
+  }
+  PetscReal time = 0;
+  PetscInt time_idx = 0;
+
+  /* Restart files every --restart-every steps, or a run resumed from one (see Restart). The state of the
+   * attenuation, the local time stepping and the frequency domain wavefields is not in the fields. */
+  std::unique_ptr<Restart> restart;
+  if (shot->RestartEvery() || !shot->RestartFrom().empty()) {
+    if (shot->Attenuation() || shot->MaxTimeStepLevels() > 1 || dft || grid) {
+      throw std::runtime_error("Restart files do not support attenuation, local time stepping, frequency "
+                               "domain wavefields or regular grid output.");
+    }
+    restart.reset(new Restart(shot, mFields));
+  }
+  if (!shot->RestartFrom().empty()) {
+    PetscInt frame;
+    restart->read(shot->RestartFrom(), time_idx, time, frame, mFields);
+    mProblem->updateLocalState(mFields, mMesh->DistributedMesh());
+    mProblem->SetOutputFrame(frame);
+    LOG() << "Resuming " << shot->RestartFrom() << " from step " << time_idx << " (time " << time << ").";
+  }
+
+  /* Once the window of every receiver is complete, the later steps are of no use to a forward shot. Every rank
+   * holds the windows of all receivers, so all stop at the same step. A gradient measures the synthetics over
+   * the whole shot, and the frequency domain wavefields sum over all of it. */
+  PetscReal end_time = shot->Duration();
+  if (shot->ObservedDataFile().empty() && !dft) { end_time = shot->StopTime(); }
+  if (end_time < shot->Duration()) {
+    LOG() << "Stopping at time " << end_time << " of " << shot->Duration() << ", the end of the last receiver "
+          << "window.";
+  }
+
+  /* With a ghosted state, the global vectors are only brought up to date for the steps which read them. */
+  DM dm = mMesh->DistributedMesh();
+  while (time < end_time) {
+
+    /* Sum up all forces, once the source table holds this step. */
+    Source::advanceTable(time_idx);
+    std::tie(mElements, mFields) = mProblem->assembleIntoGlobalDof(
+        std::move(mElements), std::move(mFields), time, time_idx,
+        mMesh->DistributedMesh(), mMesh->MeshSection(), shot);
+
+    /* Abort an unstable run, while the acceleration still holds the forces. */
+    if (monitor.Due(time_idx)) { mProblem->updateGlobalState(mFields, dm); }
+    monitor.check(time_idx, time, mFields, mElements, mMesh);
+
+    /* Apply inverse mass matrix. */
+    {
+      Profiler::Scope scope(Profiler::InverseMass);
+      mFields = mProblem->applyInverseMassMatrix(std::move(mFields));
+    }
+
+    /* Advance time. */
+    {
+      Profiler::Scope scope(Profiler::TimeStep);
+      std::tie(mFields, time) = mProblem->takeTimeStep(std::move(mFields), time, shot);
+    }
+
+    time_idx++;
+    const bool movie_frame = shot->SaveMovie() && !(time_idx % shot->SaveFrameEvery());
+    const bool restart_file = shot->RestartEvery() && !(time_idx % shot->RestartEvery()) && time < end_time;
+    const bool grid_frame = grid && grid->Due(time_idx), staging_step = staging && staging->Due(time_idx);
+    if ((dft && dft->Due(time_idx)) || movie_frame || grid_frame || staging_step || restart_file ||
+        time >= end_time) {
+      mProblem->updateGlobalState(mFields, dm);
+      mProblem->prepareOutput(mFields);
+    }
+
+    /* Frequency domain wavefields, without output until the end of the shot. */
+    if (dft) {
+      Profiler::Scope scope(Profiler::Output, "Dft");
+      dft->accumulate(time_idx, time, mFields);
+    }
+
+    /* A movie frame every --save-frame-every steps. Its HDF5 output may not run alongside a receiver write. */
+    if (movie_frame) {
+      Profiler::Scope scope(Profiler::Output, "Movie");
+      if (restart) { restart->wait(); }
+      Receiver::waitOutput();
+      mProblem->saveSolution(time, shot->MovieFields(), mFields, mMesh->DistributedMesh());
+    }
+    if (grid_frame) {
+      Profiler::Scope scope(Profiler::Output, "Grid");
+      if (restart) { restart->wait(); }
+      Receiver::waitOutput();
+      grid->write(time, mFields);
+    }
+
+    /* A step of the stream, before the receiver samples of this step are written (and rewound). The engine
+     * communicates on the ranks' communicator, so not alongside a receiver write either. */
+    if (staging_step) {
+      Profiler::Scope scope(Profiler::Output, "Staging");
+      if (restart) { restart->wait(); }
+      Receiver::waitOutput();
+      staging->write(time, mFields);
+    }
+    if (shot->ReceiverWriteEvery() && !(time_idx % shot->ReceiverWriteEvery())) {
+      Profiler::Scope scope(Profiler::Output, "Receivers");
+      if (restart) { restart->wait(); }
+      Receiver::writeOutput();
+    }
+
+    /* A restart file, with the movie and receiver output up to here. There is none after the last step. */
+    if (restart_file) {
+      Profiler::Scope scope(Profiler::Output, "Restart");
+      mProblem->flushSolution();
+      restart->write(shot->RestartFile(), time_idx, time, mProblem->OutputFrame(), mFields);
+    }
+
+    progress.step(time_idx, time, mProblem->ExchangeSeconds());
+
+  }
+  if (mMemoryReport) { Memory::report("at the end of the shot", MemoryBytes()); }
+  if (shot->ElementTimingEvery()) { mProblem->reportElementTiming(dm, shot->ElementCostFile()); }
+  if (!shot->HaloReportFile().empty()) { mProblem->reportHalo(dm, time_idx, shot->HaloReportFile()); }
+
+  /* Remaining receiver samples, once the last restart file is written. */
+  {
+    Profiler::Scope scope(Profiler::Output);
+    restart.reset();
+    Receiver::closeOutput();
+    if (dft && !shot->DftFile().empty()) { dft->write(shot->DftFile()); }
+  }
+  Profiler::PopStage();
+  return time_idx;
+
+}
+
+bool Simulation::rebalance(std::unique_ptr<Options> const &shot) {
+
+  Profiler::PushStage(Profiler::Setup);
+  if (shot->AutomaticTimeStep()) { shot->SetTimeStep(mTimeStep); }
+  mProblem->SetTimeStep(shot->TimeStep());
+  for (auto &elm: mElements) { elm->detachSourcesAndReceivers(); elm->SetTimeStep(shot->TimeStep()); }
+  mProblem->attachSourcesAndReceivers(mElements, shot);
+  mFields = mProblem->resetFields(std::move(mFields));
+
+  /* The time steps of the shot, timed per batch of elements. Output is left to the run on the new partition. */
+  mProblem->MeasureCosts(true);
+  PetscReal time = 0;
+  const PetscInt num_steps = std::min(shot->RebalanceSteps(), shot->NumTimeSteps());
+  for (PetscInt time_idx = 0; time_idx < num_steps; time_idx++) {
+    Source::advanceTable(time_idx);
+    std::tie(mElements, mFields) = mProblem->assembleIntoGlobalDof(
+        std::move(mElements), std::move(mFields), time, time_idx,
+        mMesh->DistributedMesh(), mMesh->MeshSection(), shot);
+    mFields = mProblem->applyInverseMassMatrix(std::move(mFields));
+    std::tie(mFields, time) = mProblem->takeTimeStep(std::move(mFields), time, shot);
+  }
+  mProblem->MeasureCosts(false);
+  Receiver::closeOutput();
+
+  const bool written = mMesh->writeBalancedPartition(shot->PartitionCacheFile(), mProblem->ElementCosts());
+  if (!written) { LOG() << "Warning: --rebalance-steps needs an exodus mesh file. The partition is kept."; }
+  Profiler::PopStage();
+  return written;
+
+}
+
+void Simulation::dryRun(std::unique_ptr<Options> const &shot) {
+
+  if (shot->StaticProblem()) { throw std::runtime_error("--dry-run does not support static problems."); }
+  int size; MPI_Comm_size(PETSC_COMM_WORLD, &size);
+  const Memory::Bytes bytes = MemoryBytes();
+  if (!mMemoryReport) { Memory::report("after setup", bytes); }
+  double memory = 0;
+  for (auto b: bytes) { memory += b; }
+  MPI_Allreduce(MPI_IN_PLACE, &memory, 1, MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
+  if (shot->AutomaticTimeStep()) { shot->SetTimeStep(mTimeStep); }
+  mProblem->SetTimeStep(shot->TimeStep());
+  for (auto &elm: mElements) { elm->detachSourcesAndReceivers(); elm->SetTimeStep(shot->TimeStep()); }
+  mFields = mProblem->resetFields(std::move(mFields));
+
+  /* Elements and halo dofs (those received from other ranks) of this rank. */
+  double num_elm = 0, num_halo;
+  for (auto &elm: mElements) { if (mMesh->ElementOwned(elm->Num())) { num_elm++; } }
+  {
+    PetscSF sf; PetscInt num_roots, num_leaves; const PetscInt *leaves; const PetscSFNode *remote;
+    DMGetDefaultSF(mMesh->DistributedMesh(), &sf);
+    PetscSFGetGraph(sf, &num_roots, &num_leaves, &leaves, &remote);
+    num_halo = std::max<PetscInt>(num_leaves, 0);
+  }
+
+  /* A few steps (of a zero wavefield, which takes as long), after one to warm up the caches. */
+  auto step = [&](const PetscInt time_idx, PetscReal &time) {
+    std::tie(mElements, mFields) = mProblem->assembleIntoGlobalDof(
+        std::move(mElements), std::move(mFields), time, time_idx,
+        mMesh->DistributedMesh(), mMesh->MeshSection(), shot);
+    mFields = mProblem->applyInverseMassMatrix(std::move(mFields));
+    std::tie(mFields, time) = mProblem->takeTimeStep(std::move(mFields), time, shot);
+  };
+  PetscReal time = 0;
+  step(0, time);
+  MPI_Barrier(PETSC_COMM_WORLD);
+  const PetscReal exchange = mProblem->ExchangeSeconds();
+  const auto start = std::chrono::steady_clock::now();
+  for (PetscInt time_idx = 1; time_idx <= shot->DryRunSteps(); time_idx++) { step(time_idx, time); }
+  const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  mFields = mProblem->resetFields(std::move(mFields));
+
+  /* Per step: the wall time and exchange time of the slowest rank, and the compute time of all ranks. */
+  const double seconds = wall / shot->DryRunSteps();
+  const double compute = std::max(0.0, seconds - (mProblem->ExchangeSeconds() - exchange) / shot->DryRunSteps());
+  double local[4] = {seconds, compute, num_halo, seconds - compute}, max[4], sum[2], mine[2] = {compute, num_elm};
+  MPI_Allreduce(local, max, 4, MPI_DOUBLE, MPI_MAX, PETSC_COMM_WORLD);
+  MPI_Allreduce(mine, sum, 2, MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
+  const PetscInt num_threads = std::max<PetscInt>(shot->NumThreads(), 1);
+
+  LOG() << "Dry run on " << size << " rank(s) of " << num_threads << " thread(s): " << sum[1] << " elements, "
+        << NumGlobalDof() << " global dofs, up to " << max[2] << " halo dofs per rank.";
+  LOG() << "Seconds per step (" << shot->DryRunSteps() << " steps): " << max[0] << ", of which the slowest rank "
+        << "computes " << max[1] << " and spends up to " << max[3] << " in halo exchanges.";
+  if (shot->NumTimeSteps()) {
+    const double total = max[0] * shot->NumTimeSteps();
+    LOG() << "Predicted for " << shot->NumTimeSteps() << " steps of " << shot->TimeStep() << ": " << total
+          << " seconds, " << total * size * num_threads / 3600 << " core hours.";
+  } else {
+    LOG() << "No --duration was given, so the run time is not predicted.";
+  }
+
+  /* A step on P ranks: the compute time of all ranks, with the imbalance of this run, shared by P, and the
+   * exchange time of this run scaled with the halo of a partition. */
+  if (size < 2) {
+    LOG() << "A dry run on a single rank has no halo exchanges, so no number of ranks is suggested.";
+    return;
+  }
+  const double imbalance = max[1] / (sum[0] / size), dim = mMesh->NumberDimensions();
+  auto model = [&](const double ranks, double &efficiency) {
+    const double work = imbalance * sum[0] / ranks;
+    const double halo = max[3] * std::pow(size / ranks, (dim - 1) / dim);
+    efficiency = work / (work + halo);
+    return work + halo;
+  };
+  /* A single rank has no halo. */
+  double best = 1, best_seconds = sum[0], efficiency;
+  for (double ranks = 2; ranks <= sum[1]; ranks *= 2) {
+    const double step_seconds = model(ranks, efficiency);
+    if (efficiency < shot->TargetEfficiency()) { break; }
+    best = ranks; best_seconds = step_seconds;
+  }
+  model(size, efficiency);
+  LOG() << "Parallel efficiency on " << size << " rank(s): " << efficiency << ". The largest power of two of ranks "
+        << "at an efficiency of " << shot->TargetEfficiency() << " is " << best << ", at " << best_seconds
+        << " seconds per step.";
+  if (shot->NumTimeSteps()) {
+    const double total = best_seconds * shot->NumTimeSteps();
+    LOG() << "Predicted on " << best << " rank(s): " << total << " seconds, " << total * best * num_threads / 3600
+          << " core hours.";
+  }
+  LOG() << "Memory counted per rank on " << best << " rank(s): about " << memory / best / (1 << 20) << " MB.";
+
+}
+
+PetscInt Simulation::runAdjoint(std::unique_ptr<Options> const &forward, std::unique_ptr<Options> const &adjoint) {
+
+  /* The forward wavefield is recomputed, so it must not record again, and its state must be that of the fields. */
+  if (forward->NumberReceivers() || adjoint->NumberReceivers()) {
+    throw std::runtime_error("An adjoint run takes no receivers. Record the synthetics with a forward run.");
+  }
+  if (forward->Attenuation() || forward->MaxTimeStepLevels() > 1 || forward->SimultaneousShots() > 1 ||
+      mMesh->NumberComponents() > 1 || forward->GhostedState()) {
+    throw std::runtime_error("An adjoint run does not support attenuation, local time stepping, simultaneous "
+                             "shots, interleaved components or a ghosted state.");
+  }
+
+  /* Both wavefields step with the time step of the forward shot. */
+  if (forward->AutomaticTimeStep()) { forward->SetTimeStep(mTimeStep); }
+  adjoint->SetTimeStep(forward->TimeStep());
+  if (adjoint->NumTimeSteps() != forward->NumTimeSteps()) {
+    throw std::runtime_error("The adjoint shot must last as long as the forward shot.");
+  }
+  const PetscReal dt = forward->TimeStep();
+  const PetscInt num_steps = forward->NumTimeSteps();
+  mProblem->SetTimeStep(dt);
+
+  /* The sources of both wavefields, each of which only fires while its wavefield steps. The adjoint sources are
+   * attached first, so that the table holds those of the forward wavefield, which steps most. */
+  for (auto &elm: mElements) { elm->detachSourcesAndReceivers(); elm->SetTimeStep(dt); }
+  mProblem->attachSourcesAndReceivers(mElements, adjoint, Source::Adjoint);
+  mProblem->attachSourcesAndReceivers(mElements, forward, Source::Forward);
+  mFields = mProblem->resetFields(std::move(mFields));
+
+  /* The adjoint wavefield has fields of its own, with the same mass. */
+  FieldDict adj;
+  DM dm = mMesh->DistributedMesh();
+  for (auto &name: mFields.Names()) {
+    adj.insert(std::unique_ptr<field>(new field(name, dm, mFields[name]->mLoc != nullptr)));
+  }
+  VecCopy(mFields["mi"]->mGlb, adj["mi"]->mGlb);
+  if (adj["mi"]->mLoc) { VecCopy(mFields["mi"]->mLoc, adj["mi"]->mLoc); }
+
+  mStiffnessKernel = RealVec::Zero(mElements.size()); mMassKernel = RealVec::Zero(mElements.size());
+  mElementMass.clear();
+  for (auto &elm: mElements) { mElementMass.push_back(elm->assembleElementMassMatrix()); }
+  mPointKernelOffset.assign(1, 0);
+  for (auto &elm: mElements) {
+    mPointKernelOffset.push_back(mPointKernelOffset.back() + elm->NumIntPnt() * elm->KernelNames().size());
+  }
+  mPointKernels.assign(mPointKernelOffset.back(), 0);
+  const PetscInt every = forward->KernelEvery();
+
+  /* One step of either wavefield. */
+  auto step = [&](FieldDict fields, PetscReal &time, PetscInt &time_idx, std::unique_ptr<Options> const &shot,
+                  const PetscInt wavefield) -> FieldDict {
+    Source::SetActiveWavefield(wavefield);
+    if (wavefield == Source::Forward) { Source::advanceTable(time_idx); }
+    std::tie(mElements, fields) = mProblem->assembleIntoGlobalDof(
+        std::move(mElements), std::move(fields), time, time_idx, dm, mMesh->MeshSection(), shot);
+    fields = mProblem->applyInverseMassMatrix(std::move(fields));
+    std::tie(fields, time) = mProblem->takeTimeStep(std::move(fields), time, shot);
+    time_idx++;
+    Source::SetActiveWavefield(Source::Forward);
+    return fields;
+  };
+
+  /* One step back of the forward wavefield: rewind the displacement to the step before, and take the step
+   * backwards with the forces there. */
+  auto step_back = [&](FieldDict fields, PetscReal &time, PetscInt &time_idx) -> FieldDict {
+    fields = mProblem->rewindDisplacement(std::move(fields));
+    Source::advanceTable(time_idx - 2);
+    std::tie(mElements, fields) = mProblem->assembleIntoGlobalDof(
+        std::move(mElements), std::move(fields), time - 2 * dt, time_idx - 2, dm, mMesh->MeshSection(), forward);
+    fields = mProblem->applyInverseMassMatrix(std::move(fields));
+    std::tie(fields, time) = mProblem->takeTimeStepBack(std::move(fields), time, forward);
+    time_idx--;
+    return fields;
+  };
+
+  Profiler::PushStage(Profiler::TimeLoop);
+  PetscReal time = 0, adj_time = 0;
+  PetscInt time_idx = 0, adj_idx = 0, num_forward = 0;
+  if (forward->AdjointReconstruction() == "boundary") {
+
+    /* Run forward once, recording the boundary before each step, and then back alongside the adjoint. */
+    BoundaryWavefield boundary(mMesh, forward, mFields);
+    while (time_idx < num_steps) {
+      boundary.record(time_idx, mFields);
+      mFields = step(std::move(mFields), time, time_idx, forward, Source::Forward);
+      num_forward++;
+    }
+    while (true) {
+      accumulateKernels(adj, dt, adj_idx % every ? 0 : every * dt);
+      if (!time_idx) { break; }
+      adj = step(std::move(adj), adj_time, adj_idx, adjoint, Source::Adjoint);
+      if (time_idx > 1) {
+        mFields = step_back(std::move(mFields), time, time_idx);
+      } else {
+        /* The shot starts from rest. */
+        for (auto &name: Checkpoints::StateFields(mFields)) { VecSet(mFields[name]->mGlb, 0); }
+        mFields.SetFromRest(true);
+        time = 0; time_idx = 0;
+      }
+      boundary.impose(time_idx, mFields);
+    }
+
+  } else {
+
+    Checkpoints checkpoints(forward, mFields);
+    for (auto &action: Checkpoints::Schedule(num_steps, checkpoints.NumSlots())) {
+      switch (action.action) {
+        case Checkpoints::Advance:
+          while (time_idx < action.arg) {
+            mFields = step(std::move(mFields), time, time_idx, forward, Source::Forward);
+            num_forward++;
+          }
+          break;
+        case Checkpoints::Store:
+          checkpoints.store(action.arg, time_idx, time, mFields);
+          break;
+        case Checkpoints::Restore:
+          checkpoints.restore(action.arg, time_idx, time, mFields);
+          break;
+        case Checkpoints::Deliver:
+          /* The adjoint wavefield at T - t meets the forward one at t. */
+          accumulateKernels(adj, dt, adj_idx % every ? 0 : every * dt);
+          if (time_idx) { adj = step(std::move(adj), adj_time, adj_idx, adjoint, Source::Adjoint); }
+          break;
+      }
+    }
+
+  }
+  Profiler::PopStage();
+  LOG() << "The adjoint run took " << adj_idx << " steps, and " << num_forward << " forward steps ("
+        << static_cast<double>(num_forward) / std::max<PetscInt>(num_steps, 1) << " per step of the shot).";
+
+  writeKernels(forward);
+
+  /* The adjoint sources go with the run. */
+  for (auto &elm: mElements) { elm->detachSourcesAndReceivers(); }
+  return adj_idx;
+
+}
+
+PetscInt Simulation::runGradient(std::unique_ptr<Options> const &shot) {
+
+  /* The synthetics stay in the receiver store for the whole shot. */
+  std::unique_ptr<Options> forward(new Options(*shot));
+  forward->SetReceiverFileName("");
+  forward->SetReceiverWriteEvery(0);
+  run(forward);
+
+  if (!mMisfit || mMisfit->File() != forward->ObservedDataFile()) { mMisfit.reset(new Misfit(forward)); }
+  const double misfit = mMisfit->evaluate(Receiver::StoreReceivers(), forward->TimeStep(),
+                                          forward->NumTimeSteps());
+  LOG() << "Misfit (" << forward->MisfitType() << "): " << misfit;
+
+  /* One component per displacement field recorded. */
+  const PetscInt num_components = mFields.count("ux") ? forward->Dimension() : 1;
+  std::unique_ptr<Options> adjoint = forward->AdjointShot(num_components);
+  forward->ClearReceivers();
+  return runAdjoint(forward, adjoint);
+
+}
+
+PetscInt Simulation::runReciprocal(std::unique_ptr<Options> const &options) {
+
+  const PetscInt num_dim = options->Dimension(), num_src = options->NumberSources();
+  const PetscInt num_rec = options->NumberReceivers();
+  const std::vector<std::string> strain = Receiver::StrainNames(num_dim);
+  const std::vector<std::string> displacement = {"ux", "uy", "uz"};
+
+  /* One dataset per component of the seismograms (if there are sources), and the strain at the points of the
+   * database. */
+  hid_t file_id = -1;
+  std::vector<hid_t> sets;
+  const hsize_t num_samples = options->NumTimeSteps() + 1;
+  if (num_src) {
+    hid_t plist_id = H5Pcreate(H5P_FILE_ACCESS);
+    H5Pset_fapl_mpio(plist_id, PETSC_COMM_WORLD, MPI_INFO_NULL);
+    file_id = H5Fcreate(options->ReceiverFileName().c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, plist_id);
+    H5Pclose(plist_id);
+    if (file_id < 0) {
+      throw std::runtime_error("Can't create receiver file '" + options->ReceiverFileName() + "'.");
+    }
+    hsize_t dims[3] = {(hsize_t) num_src, (hsize_t) num_rec, num_samples};
+    for (PetscInt c = 0; c < num_dim; c++) {
+      hid_t filespace = H5Screate_simple(3, dims, NULL);
+      sets.push_back(H5Dcreate(file_id, ("/" + displacement[c]).c_str(), H5T_NATIVE_FLOAT, filespace, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT));
+      H5Sclose(filespace);
+    }
+  }
+  std::unique_ptr<StrainDatabase> database;
+  if (!options->SgtFile().empty()) { database.reset(new StrainDatabase(options)); }
+
+  PetscInt num_steps = 0;
+  for (PetscInt r = 0; r < num_rec; r++) {
+    for (PetscInt c = 0; c < num_dim; c++) {
+
+      LOG() << "Running the reciprocal shot of receiver " << options->RecNames()[r] << ", component "
+            << displacement[c] << ".";
+      num_steps += run(options->ReciprocalShot(r, c));
+      if (database) { database->write(r, c); }
+      if (!num_src) { continue; }
+
+      /* The seismogram of each source held by this rank, from the fields recorded at it: the strain against the
+       * moment tensor (twice for the off diagonal terms), or the displacement along the force. */
+      std::vector<hsize_t> rows;
+      std::vector<float> traces;
+      int missing = 0;
+      for (auto rec: Receiver::StoreReceivers()) {
+        const PetscInt s = rec->Num();
+        if (s >= num_src) { continue; }
+        const Eigen::VectorXd moment_tensor = options->SrcMomentTensor(s);
+        const bool force = !moment_tensor.size();
+        const Eigen::VectorXd weight = force ? options->SrcRickerDirection(s) : moment_tensor;
+        std::vector<float> trace(num_samples, 0);
+        for (PetscInt k = 0; k < weight.size(); k++) {
+          size_t num;
+          const float *samples = rec->Samples(force ? displacement[k] : strain[k], num);
+          if (!samples) { missing = 1; continue; }
+          const double w = options->SrcRickerAmplitude()[s] * weight(k) * (force || k < num_dim ? 1 : 2);
+          for (size_t i = 0; i < std::min<size_t>(num, num_samples); i++) { trace[i] += w * samples[i]; }
+        }
+        rows.push_back(s);
+        traces.insert(traces.end(), trace.begin(), trace.end());
+      }
+      MPI_Allreduce(MPI_IN_PLACE, &missing, 1, MPI_INT, MPI_MAX, PETSC_COMM_WORLD);
+      if (missing) { throw std::runtime_error("With --reciprocal, all sources must lie in elastic elements."); }
+
+      /* Row (source, receiver) of the sources on this rank, in one collective write. */
+      hid_t filespace = H5Dget_space(sets[c]);
+      H5Sselect_none(filespace);
+      for (auto s: rows) {
+        hsize_t start[3] = {s, (hsize_t) r, 0}, count[3] = {1, 1, num_samples};
+        H5Sselect_hyperslab(filespace, H5S_SELECT_OR, start, NULL, count, NULL);
+      }
+      hsize_t mem_size = std::max<hsize_t>(traces.size(), 1);
+      hid_t memspace = H5Screate_simple(1, &mem_size, NULL);
+      if (traces.empty()) { H5Sselect_none(memspace); traces.push_back(0); }
+      hid_t xfer_id = H5Pcreate(H5P_DATASET_XFER);
+      H5Pset_dxpl_mpio(xfer_id, H5FD_MPIO_COLLECTIVE);
+      H5Dwrite(sets[c], H5T_NATIVE_FLOAT, memspace, filespace, xfer_id, traces.data());
+      H5Pclose(xfer_id);
+      H5Sclose(memspace);
+      H5Sclose(filespace);
+
+    }
+  }
+
+  for (auto set: sets) { H5Dclose(set); }
+  if (file_id >= 0) { H5Fclose(file_id); }
+  return num_steps;
+
+}
+
+void Simulation::accumulateKernels(FieldDict &adjoint, const PetscReal dt, const PetscReal point_dt) {
+
+  /* Local vectors of the pulled fields of both wavefields, and of the forward acceleration (of the last step,
+   * after the inverse mass). */
+  DM dm = mMesh->DistributedMesh();
+  PetscSection section = mMesh->MeshSection();
+  auto acceleration = [this](const std::string &name) {
+    /* The leapfrog scheme keeps it in the acceleration itself. */
+    const std::string previous = "a" + name.substr(1) + "_";
+    return mFields.count(previous) ? previous : "a" + name.substr(1);
+  };
+  std::set<std::string> pulled;
+  for (auto &elm: mElements) { for (auto f: elm->PullElementalFields()) { pulled.insert(FieldName(f)); } }
+  for (auto &name: pulled) {
+    std::vector<field*> fields {mFields[name].get(), adjoint[name].get()};
+    if (name[0] == 'u') { fields.push_back(mFields[acceleration(name)].get()); }
+    for (auto f: fields) {
+      /* The previous acceleration is not gathered while stepping, and only given a local vector here. */
+      if (!f->mLoc) { DMCreateLocalVector(dm, &f->mLoc); }
+      DMGlobalToLocalBegin(dm, f->mGlb, INSERT_VALUES, f->mLoc);
+      DMGlobalToLocalEnd(dm, f->mGlb, INSERT_VALUES, f->mLoc);
+    }
+  }
+
+  /* An element's fields, in Salvus ordering: field(closure(i)) = petscField(i). */
+  auto closure = [&](Vec loc, Element *elm, Eigen::Ref<RealVec> out) {
+    PetscScalar *val = NULL; PetscInt size;
+    DMPlexVecGetClosure(dm, section, loc, elm->Num(), &size, &val);
+    const auto &map = elm->ClsMap();
+    for (PetscInt i = 0; i < map.size(); i++) { out(map(i)) = val[i]; }
+    DMPlexVecRestoreClosure(dm, section, loc, elm->Num(), &size, &val);
+  };
+
+  for (size_t e = 0; e < mElements.size(); e++) {
+    Element *elm = mElements[e].get();
+    const std::vector<FieldId> &fields = elm->PullElementalFields();
+    RealMat u(elm->NumIntPnt(), fields.size()), u_adj(elm->NumIntPnt(), fields.size());
+    for (size_t c = 0; c < fields.size(); c++) {
+      closure(mFields[fields[c]]->mLoc, elm, u.col(c));
+      closure(adjoint[fields[c]]->mLoc, elm, u_adj.col(c));
+    }
+
+    /* The element's own (displacement) fields come first. */
+    RealMat stiff = elm->computeStiffnessTerm(u);
+    RealVec acl(elm->NumIntPnt());
+    for (PetscInt c = 0; c < stiff.cols(); c++) {
+      mStiffnessKernel(e) -= dt * u_adj.col(c).dot(stiff.col(c));
+      closure(mFields[acceleration(FieldName(fields[c]))]->mLoc, elm, acl);
+      mMassKernel(e) -= dt * u_adj.col(c).dot(mElementMass[e].cwiseProduct(acl));
+    }
+
+    /* The kernels at the integration points, from the gradients of both fields. */
+    if (point_dt) {
+      const RealMat kernels = elm->computeKernels(u, u_adj);
+      float *point = mPointKernels.data() + mPointKernelOffset[e];
+      for (PetscInt i = 0; i < kernels.size(); i++) { point[i] -= point_dt * kernels.data()[i]; }
+    }
+  }
+
+}
+
+/* The union of the names on all ranks, sorted. */
+static std::vector<std::string> allNames(const std::set<std::string> &names) {
+  std::string joined;
+  for (auto &name: names) { joined += name + '\n'; }
+  int size; MPI_Comm_size(PETSC_COMM_WORLD, &size);
+  int len = joined.size();
+  std::vector<int> lens(size), offsets(size, 0);
+  MPI_Allgather(&len, 1, MPI_INT, lens.data(), 1, MPI_INT, PETSC_COMM_WORLD);
+  for (int r = 1; r < size; r++) { offsets[r] = offsets[r - 1] + lens[r - 1]; }
+  std::vector<char> all(offsets.back() + lens.back() + 1);
+  MPI_Allgatherv(&joined[0], len, MPI_CHAR, all.data(), lens.data(), offsets.data(), MPI_CHAR, PETSC_COMM_WORLD);
+  std::set<std::string> unique;
+  std::string name;
+  for (size_t i = 0; i + 1 < all.size(); i++) {
+    if (all[i] == '\n') { unique.insert(name); name.clear(); } else { name += all[i]; }
+  }
+  return std::vector<std::string>(unique.begin(), unique.end());
+}
+
+void Simulation::writeKernels(std::unique_ptr<Options> const &options) {
+
+  std::set<std::string> local;
+  for (auto &elm: mElements) { for (auto &name: elm->KernelNames()) { local.insert(name); } }
+  const std::vector<std::string> names = allNames(local);
+
+  /* A kernel at the integration points of each element, zero where the element has no such parameter. */
+  auto kernel = [&](const std::string &name, const PetscInt e) -> Eigen::VectorXf {
+    const std::vector<std::string> elm_names = mElements[e]->KernelNames();
+    const PetscInt k = std::find(elm_names.begin(), elm_names.end(), name) - elm_names.begin();
+    if (k == elm_names.size()) { return Eigen::VectorXf::Zero(mElements[e]->NumIntPnt()); }
+    return PointKernels(e).col(k);
+  };
+
+  /* The kernels of the local elements, with their centers, in rank order. */
+  if (!options->KernelFile().empty()) {
+    unsigned long long num = mElements.size(), offset = 0, total = 0;
+    unsigned long long num_pnt = 0, pnt_offset = 0, pnt_total = 0;
+    for (auto &elm: mElements) { num_pnt += elm->NumIntPnt(); }
+    MPI_Exscan(&num, &offset, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, PETSC_COMM_WORLD);
+    MPI_Allreduce(&num, &total, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, PETSC_COMM_WORLD);
+    MPI_Exscan(&num_pnt, &pnt_offset, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, PETSC_COMM_WORLD);
+    MPI_Allreduce(&num_pnt, &pnt_total, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, PETSC_COMM_WORLD);
+    int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+    const hsize_t row = rank ? offset : 0, pnt_row = rank ? pnt_offset : 0, nd = mMesh->NumberDimensions();
+    std::vector<double> centers;
+    std::vector<float> points;
+    for (auto &elm: mElements) {
+      RealVec ctr = elm->VtxCrd().colwise().mean().transpose();
+      centers.insert(centers.end(), ctr.data(), ctr.data() + ctr.size());
+      RealMat crd = elm->NodalCoordinates();
+      for (PetscInt i = 0; i < crd.rows(); i++) {
+        for (PetscInt d = 0; d < crd.cols(); d++) { points.push_back(crd(i, d)); }
+      }
+    }
+    hid_t plist_id = H5Pcreate(H5P_FILE_ACCESS);
+    H5Pset_fapl_mpio(plist_id, PETSC_COMM_WORLD, MPI_INFO_NULL);
+    hid_t file_id = H5Fcreate(options->KernelFile().c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, plist_id);
+    H5Pclose(plist_id);
+    Movie::WriteRows(file_id, "/centers", {total, nd}, {row, 0}, {num, nd}, centers);
+    Movie::WriteRows(file_id, "/stiffness", {total}, {row}, {num},
+                     std::vector<double>(mStiffnessKernel.data(), mStiffnessKernel.data() + num));
+    Movie::WriteRows(file_id, "/mass", {total}, {row}, {num},
+                     std::vector<double>(mMassKernel.data(), mMassKernel.data() + num));
+    H5Gclose(H5Gcreate(file_id, "/points", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT));
+    Movie::WriteRows(file_id, "/points/coordinates", {pnt_total, nd}, {pnt_row, 0}, {num_pnt, nd}, points);
+    for (auto &name: names) {
+      std::vector<float> values;
+      for (PetscInt e = 0; e < mElements.size(); e++) {
+        Eigen::VectorXf k = kernel(name, e);
+        values.insert(values.end(), k.data(), k.data() + k.size());
+      }
+      Movie::WriteRows(file_id, "/points/" + name, {pnt_total}, {pnt_row}, {num_pnt}, values);
+    }
+    H5Fclose(file_id);
+  }
+
+  /* The kernels at the vertices of the elements with the parameter, from the closest integration point of each,
+   * as nodal fields of the model. */
+  if (!options->KernelVertexFile().empty()) {
+    for (auto &name: names) {
+      std::vector<PetscReal> vertices, values;
+      for (PetscInt e = 0; e < mElements.size(); e++) {
+        const std::vector<std::string> elm_names = mElements[e]->KernelNames();
+        if (std::find(elm_names.begin(), elm_names.end(), name) == elm_names.end()) { continue; }
+        RealMat crd = mElements[e]->NodalCoordinates(), vtx = mElements[e]->VtxCrd();
+        Eigen::VectorXf k = kernel(name, e);
+        for (PetscInt v = 0; v < vtx.rows(); v++) {
+          PetscInt closest; (crd.rowwise() - vtx.row(v)).rowwise().squaredNorm().minCoeff(&closest);
+          for (PetscInt d = 0; d < vtx.cols(); d++) { vertices.push_back(vtx(v, d)); }
+          values.push_back(k(closest));
+        }
+      }
+      mModel->addNodalVariable("kernel_" + name, vertices, values);
+    }
+    mModel->write(options->KernelVertexFile());
+  }
+
+}
+
+PetscInt Simulation::NumGlobalDof() {
+  Vec glb; DMGetGlobalVector(mMesh->DistributedMesh(), &glb);
+  PetscInt size; VecGetSize(glb, &size);
+  DMRestoreGlobalVector(mMesh->DistributedMesh(), &glb);
+  return size;
+}
+
+Memory::Bytes Simulation::MemoryBytes() {
+
+  Memory::Bytes bytes; bytes.fill(0);
+  for (auto &elm: mElements) {
+    bytes[Memory::Elements] += elm->MemoryBytes() - elm->OperatorBytes();
+    bytes[Memory::Operators] += elm->OperatorBytes();
+  }
+  for (auto &name: mFields.Names()) {
+    PetscInt num_glb, num_loc = 0;
+    VecGetLocalSize(mFields[name]->mGlb, &num_glb);
+    if (mFields[name]->mLoc) { VecGetLocalSize(mFields[name]->mLoc, &num_loc); }
+    bytes[Memory::Fields] += sizeof(PetscScalar) * (num_glb + num_loc);
+  }
+  bytes[Memory::Model] = mModel->MemoryBytes();
+  bytes[Memory::KdTrees] = mModel->KdTreeBytes();
+  bytes[Memory::Receivers] = Receiver::BufferBytes();
+  bytes[Memory::Mesh] = mMesh->MemoryBytes();
+  bytes[Memory::PetscMesh] = mMesh->PetscBytes();
+  return bytes;
+
+}
+
+std::unique_ptr<Options> Simulation::ShotOptions(int argc, char **argv, const std::string &file) {
+
+  /* Start from the command line again, so that no option of an earlier shot is left over. */
+  PetscOptionsClear(NULL);
+  PetscOptionsInsert(NULL, &argc, &argv, NULL);
+  PetscOptionsInsertFile(PETSC_COMM_WORLD, NULL, file.c_str(), PETSC_TRUE);
+
+  std::unique_ptr<Options> options(new Options);
+  options->setOptions();
+  return options;
+
+}
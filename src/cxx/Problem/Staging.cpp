@@ -0,0 +1,146 @@
+#include <Problem/Staging.h>
+#include <Problem/Movie.h>
+#include <Element/Element.h>
+#include <Receiver/Receiver.h>
+#include <Utilities/Options.h>
+#include <algorithm>
+#include <stdexcept>
+
+bool Staging::Available() {
+#ifdef SALVUS_ADIOS2
+  return true;
+#else
+  return false;
+#endif
+}
+
+Staging::Staging(std::unique_ptr<Options> const &shot) {
+
+  mFields = shot->StagingFields(); mEvery = shot->StagingEvery();
+  mNumDim = shot->Dimension(); mNumComponents = 1; mNumReceivers = shot->NumberReceivers(); mNumSteps = 0;
+  mNumDofs = mDofOffset = mNumElements = mElementOffset = 0; mNumNodes = 0;
+
+#ifdef SALVUS_ADIOS2
+  mAdios.reset(new adios2::ADIOS(PETSC_COMM_WORLD));
+  mIo = mAdios->DeclareIO("salvus");
+  mIo.SetEngine(shot->StagingEngine());
+  mEngine = mIo.Open(shot->StagingStream(), adios2::Mode::Write);
+#else
+  throw std::runtime_error("--staging-stream requires salvus to be built with ADIOS2.");
+#endif
+
+}
+
+Staging::~Staging() {
+#ifdef SALVUS_ADIOS2
+  if (mEngine) { mEngine.Close(); }
+#endif
+}
+
+void Staging::setup(ElemVec const &elements, DM PETScDM, PetscSection PETScSection, FieldDict &fields) {
+
+  /* The displacement of the physics, unless the fields are given. */
+  if (mFields.empty()) {
+    for (auto f: {"u", "ux", "uy", "uz"}) { if (fields.count(f)) { mFields.push_back(f); } }
+  }
+  for (auto &f: mFields) {
+    if (!fields.count(f)) { throw std::runtime_error("--staging-fields holds " + f + ", which is not registered."); }
+  }
+  PetscSectionGetFieldComponents(PETScSection, 0, &mNumComponents);
+  const PetscInt nc = mNumComponents;
+  Movie::SelectDofs(elements, PETScDM, PETScSection, {}, 0, {}, mDofs, mCoordinates);
+
+  /* Rows of each rank, in rank order, and the elements alike. */
+  unsigned long long num[2] = {mDofs.size(), elements.size()}, offset[2] = {0, 0}, total[2];
+  MPI_Exscan(num, offset, 2, MPI_UNSIGNED_LONG_LONG, MPI_SUM, PETSC_COMM_WORLD);
+  MPI_Allreduce(num, total, 2, MPI_UNSIGNED_LONG_LONG, MPI_SUM, PETSC_COMM_WORLD);
+  int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+  mDofOffset = rank ? offset[0] : 0; mElementOffset = rank ? offset[1] : 0;
+  mNumDofs = total[0]; mNumElements = total[1];
+
+  /* The row of each dof, pulled through the element closures, as the global indices of the assembly plan. */
+  Vec glb, loc; DMGetGlobalVector(PETScDM, &glb); DMGetLocalVector(PETScDM, &loc);
+  PetscScalar *val; VecGetArray(glb, &val);
+  for (size_t i = 0; i < mDofs.size(); i++) {
+    for (PetscInt c = 0; c < nc; c++) { val[mDofs[i] + c] = mDofOffset + i; }
+  }
+  VecRestoreArray(glb, &val);
+  DMGlobalToLocalBegin(PETScDM, glb, INSERT_VALUES, loc);
+  DMGlobalToLocalEnd(PETScDM, glb, INSERT_VALUES, loc);
+  DMRestoreGlobalVector(PETScDM, &glb);
+  mNumNodes = 0;
+  for (auto &elm: elements) { mNumNodes = std::max<PetscInt>(mNumNodes, elm->ClsMap().size()); }
+  MPI_Allreduce(MPI_IN_PLACE, &mNumNodes, 1, MPIU_INT, MPI_MAX, PETSC_COMM_WORLD);
+  mConnectivity.assign(elements.size() * mNumNodes, -1);
+  for (size_t e = 0; e < elements.size(); e++) {
+    const auto &closure = elements[e]->ClsMap();
+    PetscScalar *cls = NULL; PetscInt csize;
+    DMPlexVecGetClosure(PETScDM, PETScSection, loc, elements[e]->Num(), &csize, &cls);
+    for (PetscInt i = 0; i < closure.size(); i++) {
+      mConnectivity[e * mNumNodes + closure(i)] = static_cast<int64_t> (PetscRealPart(cls[i * nc]) + 0.5);
+    }
+    DMPlexVecRestoreClosure(PETScDM, PETScSection, loc, elements[e]->Num(), NULL, &cls);
+  }
+  DMRestoreLocalVector(PETScDM, &loc);
+
+#ifdef SALVUS_ADIOS2
+  const size_t nd = mNumDim, nn = mNumNodes;
+  mIo.DefineVariable<double>("time");
+  mIo.DefineVariable<double>("coordinates", {mNumDofs, nd}, {mDofOffset, 0}, {mDofs.size(), nd});
+  mIo.DefineVariable<int64_t>("connectivity", {mNumElements, nn}, {mElementOffset, 0}, {elements.size(), nn});
+  for (auto &f: mFields) {
+    mIo.DefineVariable<double>(f, {mNumDofs, (size_t) nc}, {mDofOffset, 0}, {mDofs.size(), (size_t) nc});
+  }
+  mIo.DefineAttribute<int>("dimension", mNumDim);
+#endif
+
+}
+
+void Staging::write(const PetscReal time, FieldDict &fields) {
+
+#ifdef SALVUS_ADIOS2
+  int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+  const PetscInt nc = mNumComponents;
+  mEngine.BeginStep();
+  if (!rank) {
+    const double t = time;
+    mEngine.Put(mIo.InquireVariable<double>("time"), t, adios2::Mode::Sync);
+  }
+
+  /* The mesh, once. */
+  if (!mNumSteps && !mDofs.empty()) {
+    mEngine.Put(mIo.InquireVariable<double>("coordinates"), mCoordinates.data(), adios2::Mode::Sync);
+  }
+  if (!mNumSteps && !mConnectivity.empty()) {
+    mEngine.Put(mIo.InquireVariable<int64_t>("connectivity"), mConnectivity.data(), adios2::Mode::Sync);
+  }
+
+  /* Owned dofs of each field, with their components. */
+  std::vector<double> buf(mDofs.size() * nc);
+  for (auto &f: mFields) {
+    if (mDofs.empty()) { continue; }
+    const PetscScalar *val; VecGetArrayRead(fields[f]->mGlb, &val);
+    for (size_t i = 0; i < mDofs.size(); i++) {
+      for (PetscInt c = 0; c < nc; c++) { buf[i * nc + c] = PetscRealPart(val[mDofs[i] + c]); }
+    }
+    VecRestoreArrayRead(fields[f]->mGlb, &val);
+    mEngine.Put(mIo.InquireVariable<double>(f), buf.data(), adios2::Mode::Sync);
+  }
+
+  /* The latest sample of each receiver of this rank, one block each. Variables are defined by the ranks which
+   * hold a receiver recording them. */
+  for (auto rec: Receiver::StoreReceivers()) {
+    for (auto &f: rec->Fields()) {
+      size_t num; const float *samples = rec->Samples(f, num);
+      if (!num) { continue; }
+      adios2::Variable<float> var = mIo.InquireVariable<float>("receivers/" + f);
+      if (!var) { var = mIo.DefineVariable<float>("receivers/" + f, {(size_t) mNumReceivers}, {0}, {1}); }
+      var.SetSelection({{(size_t) rec->Num()}, {1}});
+      mEngine.Put(var, samples[num - 1], adios2::Mode::Sync);
+    }
+  }
+  mEngine.EndStep();
+#endif
+  mNumSteps++;
+
+}
@@ -0,0 +1,180 @@
+#include <Mesh/Mesh.h>
+#include <Problem/StaticSolver.h>
+#include <Utilities/Logging.h>
+#include <Utilities/Options.h>
+
+StaticSolver::StaticSolver(const std::unique_ptr<Options> &options) : Problem(options) {
+  mOperator = nullptr; mKsp = nullptr;
+  mLoad = nullptr; mDiagonal = nullptr; mSolution = nullptr; mWork = nullptr;
+  mFields = nullptr; mTime = 0; mDM = nullptr;
+  mTolerance = options->StaticTolerance();
+  mPreconditioner = options->StaticPreconditioner();
+}
+
+StaticSolver::~StaticSolver() {
+  KSPDestroy(&mKsp); MatDestroy(&mOperator);
+  VecDestroy(&mLoad); VecDestroy(&mDiagonal); VecDestroy(&mSolution); VecDestroy(&mWork);
+}
+
+FieldDict StaticSolver::initializeGlobalDofs(ElemVec const &elements, std::unique_ptr<Mesh> &mesh) {
+
+  /* A single displacement, and the forces summed from it. */
+  const bool interleaved = mesh->NumberComponents() > 1;
+  for (auto &phys: mesh->AllFields()) {
+    if (phys != "fluid" && !((phys == "2delastic" || phys == "3delastic") && interleaved)) {
+      throw std::runtime_error("A static problem needs a single displacement field, i.e. scalar physics, or "
+                               "vector physics with --interleaved-components (not " + phys + ").");
+    }
+  }
+  FieldDict fields;
+  const std::set<FieldId> local = LocalFields(elements, mesh->NumberComponents());
+  for (auto id: {FieldId::u, FieldId::a}) {
+    fields.insert(std::unique_ptr<field> (new field(FieldName(id), mesh->DistributedMesh(), local.count(id))));
+  }
+  for (auto &elm: elements) {
+    for (auto id: elm->PullElementalFields()) {
+      if ((interleaved ? BlockField(id) : id) == FieldId::u) { continue; }
+      throw std::runtime_error(std::string("A static problem has no field ") + FieldName(id) + ", which is pulled "
+                               "by an element (i.e. on an absorbing boundary or a fluid-solid interface).");
+    }
+  }
+
+  /* Precompute the element gather/scatter plan for the products. */
+  initializeAssemblyPlan(elements, mesh->DistributedMesh(), mesh->MeshSection());
+  initializeBoundaryDofs(mesh);
+
+  VecDuplicate(fields[FieldId::u]->mGlb, &mLoad); VecDuplicate(fields[FieldId::u]->mGlb, &mDiagonal);
+  VecDuplicate(fields[FieldId::u]->mGlb, &mSolution); VecDuplicate(fields[FieldId::u]->mGlb, &mWork);
+  assembleDiagonal(elements, mesh);
+
+  /* A shell of the global size, solved for by conjugate gradients. */
+  PetscInt num_loc, num_glb;
+  VecGetLocalSize(mLoad, &num_loc); VecGetSize(mLoad, &num_glb);
+  MatCreateShell(PETSC_COMM_WORLD, num_loc, num_loc, num_glb, num_glb, this, &mOperator);
+  MatShellSetOperation(mOperator, MATOP_MULT, (void (*)(void)) Apply);
+  MatShellSetOperation(mOperator, MATOP_GET_DIAGONAL, (void (*)(void)) GetDiagonal);
+  KSPCreate(PETSC_COMM_WORLD, &mKsp);
+  KSPSetOperators(mKsp, mOperator, mOperator);
+  KSPSetType(mKsp, KSPCG);
+  PC pc; KSPGetPC(mKsp, &pc);
+  PCSetType(pc, mPreconditioner == "jacobi" ? PCJACOBI : PCNONE);
+  KSPSetTolerances(mKsp, mTolerance, PETSC_DEFAULT, PETSC_DEFAULT, PETSC_DEFAULT);
+  KSPSetInitialGuessNonzero(mKsp, PETSC_TRUE);
+  KSPSetOptionsPrefix(mKsp, "static_");
+  KSPSetFromOptions(mKsp);
+
+  return fields;
+
+}
+
+FieldDict StaticSolver::reinitializeGlobalDofs(ElemVec const &elements, std::unique_ptr<Mesh> &mesh,
+                                               FieldDict fields) {
+
+  for (auto &name: fields.Names()) {
+    if (fields[name]->mLoc) { VecSet(fields[name]->mLoc, 0); }
+    VecSet(fields[name]->mGlb, 0);
+  }
+  assembleDiagonal(elements, mesh);
+  return fields;
+
+}
+
+void StaticSolver::assembleDiagonal(ElemVec const &elements, std::unique_ptr<Mesh> &mesh) {
+
+  /* Each dof of an element is probed on its own, which takes as many stiffness terms as the element has dofs,
+   * but only once. The diagonal is summed in PETSc ordering, with the components interleaved. */
+  DM dm = mesh->DistributedMesh();
+  const PetscInt num_comps = mesh->NumberComponents();
+  Vec loc; DMGetLocalVector(dm, &loc); VecSet(loc, 0);
+  for (auto &elm: elements) {
+    const IntVec &map = elm->ClsMap();
+    Eigen::MatrixXd unit = Eigen::MatrixXd::Zero(elm->NumIntPnt(), num_comps);
+    RealVec diag(map.size() * num_comps);
+    for (PetscInt c = 0; c < num_comps; c++) {
+      for (PetscInt i = 0; i < map.size(); i++) {
+        unit(map(i), c) = 1;
+        diag(i * num_comps + c) = elm->computeStiffnessTerm(unit)(map(i), c);
+        unit(map(i), c) = 0;
+      }
+    }
+    DMPlexVecSetClosure(dm, mesh->MeshSection(), loc, elm->Num(), diag.data(), ADD_VALUES);
+  }
+  VecSet(mDiagonal, 0);
+  DMLocalToGlobalBegin(dm, loc, ADD_VALUES, mDiagonal);
+  DMLocalToGlobalEnd(dm, loc, ADD_VALUES, mDiagonal);
+  DMRestoreLocalVector(dm, &loc);
+
+  PetscScalar *val; VecGetArray(mDiagonal, &val);
+  for (auto i: BoundaryDofs()) { val[i] = 1; }
+  VecRestoreArray(mDiagonal, &val);
+
+}
+
+void StaticSolver::applyStiffness(Vec x, Vec y) {
+
+  /* The forces at x, without its Dirichlet dofs, in place of the displacement. */
+  VecCopy(x, mWork);
+  PetscScalar *val; VecGetArray(mWork, &val);
+  for (auto i: BoundaryDofs()) { val[i] = 0; }
+  VecRestoreArray(mWork, &val);
+  std::swap((*mFields)[FieldId::u]->mGlb, mWork);
+  assembleLevel(*mFields, ElementBatch::Unrecorded, mTime, 0, mDM);
+  std::swap((*mFields)[FieldId::u]->mGlb, mWork);
+
+  // K x = a(0) - a(x)
+  VecWAXPY(y, -1, (*mFields)[FieldId::a]->mGlb, mLoad);
+
+  /* The forces are zeroed on the Dirichlet dofs, where the operator is the identity. */
+  const PetscScalar *in; VecGetArrayRead(x, &in);
+  PetscScalar *out; VecGetArray(y, &out);
+  for (auto i: BoundaryDofs()) { out[i] = in[i]; }
+  VecRestoreArray(y, &out);
+  VecRestoreArrayRead(x, &in);
+
+}
+
+PetscErrorCode StaticSolver::Apply(Mat op, Vec x, Vec y) {
+  void *ctx; MatShellGetContext(op, &ctx);
+  static_cast<StaticSolver*>(ctx)->applyStiffness(x, y);
+  return 0;
+}
+
+PetscErrorCode StaticSolver::GetDiagonal(Mat op, Vec diag) {
+  void *ctx; MatShellGetContext(op, &ctx);
+  VecCopy(static_cast<StaticSolver*>(ctx)->mDiagonal, diag);
+  return 0;
+}
+
+std::tuple<FieldDict, PetscScalar> StaticSolver::takeTimeStep(
+    FieldDict fields, PetscScalar time, std::unique_ptr<Options> const &options) {
+  throw std::runtime_error("A static problem is solved by solveStatic, not stepped through time.");
+}
+
+FieldDict StaticSolver::solveStatic(FieldDict fields, const PetscReal time, DM PETScDM) {
+
+  mFields = &fields; mTime = time; mDM = PETScDM;
+
+  /* The load, as the forces at rest. */
+  VecCopy(fields[FieldId::u]->mGlb, mSolution);
+  VecSet(fields[FieldId::u]->mGlb, 0);
+  assembleLevel(fields, ElementBatch::Unrecorded, time, 0, PETScDM);
+  VecCopy(fields[FieldId::a]->mGlb, mLoad);
+
+  KSPSolve(mKsp, mLoad, mSolution);
+  KSPConvergedReason reason; KSPGetConvergedReason(mKsp, &reason);
+  PetscInt iterations; KSPGetIterationNumber(mKsp, &iterations);
+  PetscReal residual; KSPGetResidualNorm(mKsp, &residual);
+  mFields = nullptr;
+  if (reason < 0) {
+    throw std::runtime_error("The static solve did not converge after " + std::to_string(iterations) +
+                             " iterations (KSP reason " + std::to_string(reason) + ").");
+  }
+  LOG() << "Static solve converged in " << iterations << " iterations, to a residual of " << residual << ".";
+
+  /* The forces at the solution, which also records it at the receivers. */
+  VecCopy(mSolution, fields[FieldId::u]->mGlb);
+  assembleLevel(fields, ElementBatch::AllLevels, time, 0, PETScDM);
+
+  return fields;
+
+}
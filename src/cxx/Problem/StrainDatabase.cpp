@@ -0,0 +1,163 @@
+#include <Problem/StrainDatabase.h>
+#include <Problem/Movie.h>
+#include <Receiver/Receiver.h>
+#include <Utilities/Options.h>
+#include <Utilities/Compression.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+#include "hdf5_hl.h"
+
+StrainDatabase::StrainDatabase(std::unique_ptr<Options> const &options) {
+
+  mNumDim = options->Dimension(); mFirst = options->NumberSources();
+  mNumPoints = options->NumberSgtPoints(); mNumStrain = Receiver::StrainNames(mNumDim).size();
+  mNumSamples = Receiver::NumOutputs(options->NumTimeSteps() + 1, options->SgtEvery());
+  mTolerance = options->SgtTolerance();
+  const hsize_t num_rec = options->NumberReceivers(), nd = mNumDim;
+
+  /* Quantised strain is held as the levels of its grid, in the smallest unsigned integer which fits them. */
+  if (mTolerance) {
+    const int bits = Compression::Bits(mTolerance);
+    mType = H5Tcopy(bits <= 8 ? H5T_NATIVE_UINT8 : bits <= 16 ? H5T_NATIVE_UINT16 : H5T_NATIVE_UINT32);
+  } else {
+    mType = H5Tcopy(H5T_NATIVE_FLOAT);
+  }
+
+  hid_t plist_id = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fapl_mpio(plist_id, PETSC_COMM_WORLD, MPI_INFO_NULL);
+  mFileId = H5Fcreate(options->SgtFile().c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, plist_id);
+  H5Pclose(plist_id);
+  if (mFileId < 0) {
+    H5Tclose(mType);
+    throw std::runtime_error("Can't create strain database '" + options->SgtFile() + "'.");
+  }
+
+  /* The points and receivers, written by the first rank. */
+  int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+  std::vector<double> points, receivers;
+  if (!rank) {
+    for (hsize_t p = 0; p < mNumPoints; p++) {
+      points.push_back(options->SgtLocX()[p]); points.push_back(options->SgtLocY()[p]);
+      if (mNumDim == 3) { points.push_back(options->SgtLocZ()[p]); }
+    }
+    for (hsize_t r = 0; r < num_rec; r++) {
+      receivers.push_back(options->RecLocX()[r]); receivers.push_back(options->RecLocY()[r]);
+      if (mNumDim == 3) { receivers.push_back(options->RecLocZ()[r]); }
+    }
+  }
+  Movie::WriteRows(mFileId, "/coordinates", {mNumPoints, nd}, {0, 0}, {mNumPoints, nd}, points);
+  Movie::WriteRows(mFileId, "/receivers", {num_rec, nd}, {0, 0}, {num_rec, nd}, receivers);
+
+  /* One chunk per shot and block of points, so that the traces of a point are read from a single chunk. */
+  hsize_t dims[5] = {num_rec, nd, mNumPoints, mNumStrain, mNumSamples};
+  hsize_t chunk[5] = {1, 1, std::min<hsize_t>(mNumPoints, 64), mNumStrain, std::min<hsize_t>(mNumSamples, 1024)};
+  hid_t filespace = H5Screate_simple(5, dims, NULL);
+  hid_t dcpl_id = H5Pcreate(H5P_DATASET_CREATE);
+  H5Pset_chunk(dcpl_id, 5, chunk);
+  mStrainSet = H5Dcreate(mFileId, "/strain", mType, filespace, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+  H5Pclose(dcpl_id);
+  H5Sclose(filespace);
+
+  /* The lowest level and step of each quantised trace. */
+  mGridSet = -1;
+  if (mTolerance) {
+    hsize_t grid_dims[5] = {num_rec, nd, mNumPoints, mNumStrain, 2};
+    filespace = H5Screate_simple(5, grid_dims, NULL);
+    mGridSet = H5Dcreate(mFileId, "/strain_grid", H5T_NATIVE_DOUBLE, filespace, H5P_DEFAULT, H5P_DEFAULT,
+                         H5P_DEFAULT);
+    H5Sclose(filespace);
+  }
+
+  /* The same on all ranks, as attributes are written collectively. */
+  const double dt = options->TimeStep() * options->SgtEvery();
+  const double center_freq = options->ReciprocalCenterFreq(), time_delay = options->ReciprocalTimeDelay();
+  H5LTset_attribute_double(mFileId, "/", "dt", &dt, 1);
+  H5LTset_attribute_double(mFileId, "/", "center_freq", &center_freq, 1);
+  H5LTset_attribute_double(mFileId, "/", "time_delay", &time_delay, 1);
+
+}
+
+StrainDatabase::~StrainDatabase() {
+  H5Dclose(mStrainSet);
+  if (mGridSet >= 0) { H5Dclose(mGridSet); }
+  H5Tclose(mType);
+  H5Fclose(mFileId);
+}
+
+void StrainDatabase::write(const PetscInt receiver, const PetscInt component) {
+
+  /* The points of this rank, ascending, as the selection of the write takes them. */
+  std::vector<Receiver*> recs;
+  for (auto rec: Receiver::StoreReceivers()) { if (rec->Num() >= mFirst) { recs.push_back(rec); } }
+  std::sort(recs.begin(), recs.end(), [](Receiver *a, Receiver *b) { return a->Num() < b->Num(); });
+
+  const std::vector<std::string> names = Receiver::StrainNames(mNumDim);
+  std::vector<hsize_t> points;
+  std::vector<float> values;
+  std::vector<uint32_t> levels;
+  std::vector<double> grid;
+  int missing = 0;
+  for (auto rec: recs) {
+    points.push_back(rec->Num() - mFirst);
+    for (auto &name: names) {
+      size_t num;
+      const float *samples = rec->Samples(name, num);
+      if (!samples) { missing = 1; num = 0; }
+      std::vector<float> trace(mNumSamples, 0);
+      std::copy(samples, samples + std::min<size_t>(num, mNumSamples), trace.begin());
+      if (!mTolerance) { values.insert(values.end(), trace.begin(), trace.end()); continue; }
+
+      /* Each trace on its own grid, as a frame of a compressed movie. */
+      double lowest = 0, max_abs = 0;
+      if (!trace.empty()) { lowest = *std::min_element(trace.begin(), trace.end()); }
+      for (auto v: trace) { max_abs = std::max<double>(max_abs, std::abs(v)); }
+      const double step = Compression::Step(max_abs, mTolerance);
+      grid.push_back(lowest); grid.push_back(step);
+      for (auto v: trace) { levels.push_back(Compression::Level(v, lowest, step)); }
+    }
+  }
+  MPI_Allreduce(MPI_IN_PLACE, &missing, 1, MPI_INT, MPI_MAX, PETSC_COMM_WORLD);
+  if (missing) { throw std::runtime_error("With --sgt-file, all points must lie in elastic elements."); }
+
+  if (mTolerance) {
+    writePoints(mStrainSet, receiver, component, points, mNumStrain, mNumSamples, H5T_NATIVE_UINT32,
+                levels.data());
+    writePoints(mGridSet, receiver, component, points, mNumStrain, 2, H5T_NATIVE_DOUBLE, grid.data());
+  } else {
+    writePoints(mStrainSet, receiver, component, points, mNumStrain, mNumSamples, H5T_NATIVE_FLOAT,
+                values.data());
+  }
+
+}
+
+void StrainDatabase::writePoints(hid_t set, const PetscInt receiver, const PetscInt component,
+                                 const std::vector<hsize_t> &points, const hsize_t num_strain,
+                                 const hsize_t num_cols, hid_t mem_type, const void *buf) {
+
+  /* One hyperslab per run of consecutive points. */
+  hid_t filespace = H5Dget_space(set);
+  H5Sselect_none(filespace);
+  for (size_t i = 0; i < points.size(); ) {
+    size_t j = i + 1;
+    while (j < points.size() && points[j] == points[j - 1] + 1) { j++; }
+    hsize_t start[5] = {(hsize_t) receiver, (hsize_t) component, points[i], 0, 0};
+    hsize_t count[5] = {1, 1, j - i, num_strain, num_cols};
+    H5Sselect_hyperslab(filespace, H5S_SELECT_OR, start, NULL, count, NULL);
+    i = j;
+  }
+  hsize_t mem_size = std::max<hsize_t>(points.size() * num_strain * num_cols, 1);
+  hid_t memspace = H5Screate_simple(1, &mem_size, NULL);
+  const double zero = 0;
+  if (points.empty()) { H5Sselect_none(memspace); buf = &zero; }
+  hid_t xfer_id = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(xfer_id, H5FD_MPIO_COLLECTIVE);
+  herr_t status = H5Dwrite(set, mem_type, memspace, filespace, xfer_id, buf);
+  H5Pclose(xfer_id);
+  H5Sclose(memspace);
+  H5Sclose(filespace);
+  if (status < 0) { throw std::runtime_error("Can't write the strain database."); }
+
+}
@@ -0,0 +1,170 @@
+#include <Problem/Tuner.h>
+#include <Element/Element.h>
+#include <Mesh/Mesh.h>
+#include <Model/ExodusModel.h>
+#include <Utilities/Options.h>
+#include <Utilities/Logging.h>
+#include <Utilities/SmallGemm.h>
+#include <Utilities/Types.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <thread>
+#include <mpi.h>
+
+std::string Tuner::Hardware() {
+
+  /* The first rank's processor stands for all. */
+  std::string name = "unknown";
+  char buffer[256] = {0};
+  if (!PetscGlobalRank) {
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+      if (line.compare(0, 10, "model name")) { continue; }
+      name = line.substr(line.find(':') + 2);
+      break;
+    }
+    name += " x" + std::to_string(std::thread::hardware_concurrency());
+    name.copy(buffer, sizeof(buffer) - 1);
+  }
+  MPI_Bcast(buffer, sizeof(buffer), MPI_CHAR, 0, PETSC_COMM_WORLD);
+  return std::string(buffer);
+
+}
+
+void Tuner::apply(const std::string &type, const Variant &variant, std::unique_ptr<Options> const &options) {
+  if (type == "tri" || type == "tet") { options->SetSimplexReferenceStiffness(variant.flag); }
+  else { options->SetLowMemoryGeometry(variant.flag); }
+  options->SetDenseElementStiffness(variant.dense);
+  options->SetSmallGemm(variant.gemm);
+}
+
+void Tuner::measure(std::unique_ptr<Mesh> const &mesh, std::unique_ptr<ExodusModel> const &model,
+                    std::unique_ptr<Options> const &options, double &seconds, double &megabytes) {
+
+  /* A sample of the local elements, built as in Problem::initializeElements. */
+  ElemVec sample;
+  const std::vector<PetscInt> &order = mesh->ElementOrder();
+  for (PetscInt i = 0; i < std::min<PetscInt>(order.size(), mSampleSize); i++) {
+    const PetscInt type = mesh->ElementTypeCode(order[i]);
+    sample.push_back(type >= 0 ? Element::Factory(type, options) :
+                     Element::Factory(mesh->baseElementType(), mesh->ElementFields(order[i]),
+                                      mesh->TotalCouplingFields(order[i]), options));
+    sample.back()->SetNum(order[i]);
+    sample.back()->attachVertexCoordinates(mesh);
+    sample.back()->setBoundaryConditions(mesh);
+    sample.back()->attachMaterialProperties(model);
+    sample.back()->precomputeElementTerms();
+  }
+
+  /* One call first, so that the scratch buffers are allocated. */
+  std::vector<Eigen::MatrixXd> u;
+  double bytes = 0;
+  volatile double sink = 0;
+  for (auto &elm: sample) {
+    u.push_back(Eigen::MatrixXd::Random(elm->NumIntPnt(), elm->PullElementalFields().size()));
+    sink = sink + elm->computeStiffnessTerm(u.back())(0, 0);
+    bytes += elm->MemoryBytes();
+  }
+  typedef std::chrono::steady_clock clock;
+  auto start = clock::now();
+  for (PetscInt it = 0; it < mIterations; it++) {
+    for (PetscInt e = 0; e < sample.size(); e++) { sink = sink + sample[e]->computeStiffnessTerm(u[e])(0, 0); }
+  }
+
+  /* Mean time per stiffness term over all ranks, and the memory of all elements of the largest rank. */
+  double local[2] = {std::chrono::duration<double>(clock::now() - start).count(),
+                     1.0 * mIterations * sample.size()}, global[2];
+  MPI_Allreduce(local, global, 2, MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
+  seconds = global[1] ? global[0] / global[1] : 0;
+  megabytes = sample.empty() ? 0 : bytes / sample.size() * mesh->NumberElementsLocal() / 1048576;
+  MPI_Allreduce(MPI_IN_PLACE, &megabytes, 1, MPI_DOUBLE, MPI_MAX, PETSC_COMM_WORLD);
+
+}
+
+std::string Tuner::readCache(const std::string &filename, const std::string &key) {
+  std::ifstream f(filename.c_str());
+  std::string line;
+  while (std::getline(f, line)) {
+    const size_t tab = line.rfind('\t');
+    if (tab != std::string::npos && line.substr(0, tab) == key) { return line.substr(tab + 1); }
+  }
+  return "";
+}
+
+void Tuner::writeCache(const std::string &filename, const std::string &key, const std::string &variant) {
+
+  /* Keep the choices of the other keys. */
+  std::vector<std::string> lines;
+  {
+    std::ifstream f(filename.c_str());
+    std::string line;
+    while (std::getline(f, line)) {
+      if (line.compare(0, key.size() + 1, key + "\t")) { lines.push_back(line); }
+    }
+  }
+  lines.push_back(key + "\t" + variant);
+  std::ofstream f(filename.c_str());
+  for (auto &line: lines) { f << line << "\n"; }
+  if (!f) { LOG() << "Warning: could not write tuning cache '" << filename << "'."; }
+
+}
+
+void Tuner::tune(std::unique_ptr<Mesh> const &mesh, std::unique_ptr<ExodusModel> const &model,
+                 std::unique_ptr<Options> const &options) {
+
+  const std::string type = mesh->baseElementType();
+  const bool simplex = type == "tri" || type == "tet";
+  std::vector<Variant> variants = simplex ?
+      std::vector<Variant>{{"dense-operators", PETSC_FALSE, PETSC_FALSE, PETSC_FALSE},
+                           {"reference-stiffness", PETSC_TRUE, PETSC_FALSE, PETSC_FALSE}} :
+      std::vector<Variant>{{"stored-geometry", PETSC_FALSE, PETSC_FALSE, PETSC_FALSE},
+                           {"recomputed-geometry", PETSC_TRUE, PETSC_FALSE, PETSC_FALSE}};
+  /* Dense matrices of tensor elements only pay off at low order. */
+  if (!simplex && options->PolynomialOrder() <= mMaxDenseOrder) {
+    variants.push_back({"dense-stiffness", PETSC_FALSE, PETSC_TRUE, PETSC_FALSE});
+  }
+  /* Generated small matrix products (the Eigen fallback is no match for the unrolled loops). */
+  if (!simplex && SmallGemm::Available()) {
+    variants.push_back({"small-gemm", PETSC_FALSE, PETSC_FALSE, PETSC_TRUE});
+  }
+  const std::string key = Hardware() + ";" + type + ";order " + std::to_string(options->PolynomialOrder());
+
+  /* A choice cached by an earlier run (read by the first rank, for all). */
+  char buffer[64] = {0};
+  if (!PetscGlobalRank && !options->AutoTuneFile().empty()) {
+    readCache(options->AutoTuneFile(), key).copy(buffer, sizeof(buffer) - 1);
+  }
+  MPI_Bcast(buffer, sizeof(buffer), MPI_CHAR, 0, PETSC_COMM_WORLD);
+  for (auto &v: variants) {
+    if (v.name != buffer) { continue; }
+    apply(type, v, options);
+    LOG() << "Using the " << v.name << " kernels (cached in " << options->AutoTuneFile() << ").";
+    return;
+  }
+
+  /* The fastest variant within the memory limit, or else the one which needs the least memory. */
+  PetscInt best = -1, smallest = 0;
+  std::vector<double> seconds(variants.size()), megabytes(variants.size());
+  for (PetscInt v = 0; v < variants.size(); v++) {
+    apply(type, variants[v], options);
+    measure(mesh, model, options, seconds[v], megabytes[v]);
+    LOG() << "Tuning " << type << " order " << options->PolynomialOrder() << ", " << variants[v].name << ": "
+          << 1e9 * seconds[v] << " ns per stiffness term, " << megabytes[v] << " MB of elements per rank";
+    if (megabytes[v] < megabytes[smallest]) { smallest = v; }
+    if (options->AutoTuneMemory() && megabytes[v] > options->AutoTuneMemory()) { continue; }
+    if (best < 0 || seconds[v] < seconds[best]) { best = v; }
+  }
+  if (best < 0) {
+    LOG() << "Warning: no kernel variant fits into --auto-tune-memory " << options->AutoTuneMemory()
+          << " MB. Using the smallest.";
+    best = smallest;
+  }
+  apply(type, variants[best], options);
+  LOG() << "Using the " << variants[best].name << " kernels.";
+  if (!PetscGlobalRank && !options->AutoTuneFile().empty()) {
+    writeCache(options->AutoTuneFile(), key, variants[best].name);
+  }
+
+}
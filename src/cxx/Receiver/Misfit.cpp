@@ -0,0 +1,234 @@
+#include <Receiver/Misfit.h>
+#include <Receiver/Receiver.h>
+#include <Source/AdjointSource.h>
+#include <Utilities/Options.h>
+#include <Utilities/Logging.h>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+
+#include "hdf5.h"
+
+Misfit::Misfit(std::unique_ptr<Options> const &options) {
+
+  mFile = options->ObservedDataFile();
+  const std::string type = options->MisfitType();
+  mType = type == "cc" ? CrossCorrelation : type == "tf-phase" ? TimeFrequencyPhase : L2;
+  mMaxFrequency = options->MisfitMaxFrequency();
+  mMaxShift = options->MisfitMaxShift();
+
+}
+
+std::vector<std::string> Misfit::MeasuredFields(const Receiver &receiver) {
+  std::vector<std::string> fields;
+  for (auto &f: receiver.Fields()) {
+    if (f == "u" || f == "ux" || f == "uy" || f == "uz") { fields.push_back(f); }
+  }
+  return fields;
+}
+
+void Misfit::load(const std::vector<Receiver*> &receivers) {
+
+  std::vector<Receiver*> missing;
+  for (auto rec: receivers) { if (!mObserved.count(rec->Num())) { missing.push_back(rec); } }
+  if (missing.empty()) { return; }
+
+  /* The rows of this rank's receivers, each read by itself. */
+  hid_t file = H5Fopen(mFile.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  if (file < 0) { throw std::runtime_error("Can't open the observed data file '" + mFile + "'."); }
+  std::map<std::string, hid_t> sets;
+  for (auto rec: missing) {
+    std::vector<std::vector<double>> &observed = mObserved[rec->Num()];
+    for (auto &f: MeasuredFields(*rec)) {
+      if (!sets.count(f)) { sets[f] = H5Dopen2(file, ("/" + f).c_str(), H5P_DEFAULT); }
+      const hid_t set = sets[f];
+      hsize_t dims[2] = {0, 0};
+      hid_t file_space = set < 0 ? -1 : H5Dget_space(set);
+      if (set < 0 || H5Sget_simple_extent_ndims(file_space) != 2) {
+        if (file_space >= 0) { H5Sclose(file_space); }
+        for (auto &s: sets) { if (s.second >= 0) { H5Dclose(s.second); } }
+        H5Fclose(file);
+        throw std::runtime_error("The observed data file '" + mFile + "' holds no dataset /" + f +
+                                 " of #receivers x #samples.");
+      }
+      H5Sget_simple_extent_dims(file_space, dims, NULL);
+      if (static_cast<hsize_t>(rec->Num()) >= dims[0]) {
+        H5Sclose(file_space);
+        for (auto &s: sets) { if (s.second >= 0) { H5Dclose(s.second); } }
+        H5Fclose(file);
+        throw std::runtime_error("The observed data file '" + mFile + "' holds no row of receiver " +
+                                 rec->Name() + ".");
+      }
+      hsize_t start[2] = {static_cast<hsize_t>(rec->Num()), 0}, count[2] = {1, dims[1]};
+      H5Sselect_hyperslab(file_space, H5S_SELECT_SET, start, NULL, count, NULL);
+      hid_t mem_space = H5Screate_simple(1, &dims[1], NULL);
+      observed.emplace_back(dims[1]);
+      H5Dread(set, H5T_NATIVE_DOUBLE, mem_space, file_space, H5P_DEFAULT, observed.back().data());
+      H5Sclose(mem_space); H5Sclose(file_space);
+    }
+  }
+  for (auto &s: sets) { H5Dclose(s.second); }
+  H5Fclose(file);
+
+}
+
+double Misfit::evaluate(const std::vector<Receiver*> &receivers, const PetscReal dt, const PetscInt num_steps) {
+
+  load(receivers);
+  AdjointSource::ClearTraces();
+  double local = 0;
+  for (auto rec: receivers) {
+    if (rec->Decimation() > 1) {
+      throw std::runtime_error("The misfit of receiver " + rec->Name() + " needs a sample every time step.");
+    }
+    const std::vector<std::string> fields = MeasuredFields(*rec);
+    const std::vector<std::vector<double>> &observed = mObserved[rec->Num()];
+    Eigen::MatrixXd trace = Eigen::MatrixXd::Zero(fields.size(), num_steps + 1);
+    for (size_t c = 0; c < fields.size(); c++) {
+      size_t num; const float *samples = rec->Samples(fields[c], num);
+      num = std::min(num, observed[c].size());
+      std::vector<double> syn(samples, samples + num), obs(observed[c].begin(), observed[c].begin() + num), adj;
+      local += measure(syn, obs, dt, adj);
+
+      /* Adjoint step k is forward step N - k. */
+      for (PetscInt k = 0; k <= num_steps; k++) {
+        const PetscInt i = num_steps - k;
+        if (i < static_cast<PetscInt>(adj.size())) { trace(c, k) = adj[i]; }
+      }
+    }
+    AdjointSource::SetTrace(rec->Num(), trace);
+  }
+  double total = 0;
+  MPI_Allreduce(&local, &total, 1, MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
+  return total;
+
+}
+
+double Misfit::measure(const std::vector<double> &syn, const std::vector<double> &obs, const PetscReal dt,
+                       std::vector<double> &adj) const {
+  adj.assign(syn.size(), 0);
+  if (syn.empty()) { return 0; }
+  switch (mType) {
+    case CrossCorrelation: return crossCorrelation(syn, obs, dt, adj);
+    case TimeFrequencyPhase: return timeFrequencyPhase(syn, obs, dt, adj);
+    default: return l2(syn, obs, dt, adj);
+  }
+}
+
+double Misfit::l2(const std::vector<double> &syn, const std::vector<double> &obs, const PetscReal dt,
+                  std::vector<double> &adj) const {
+  double chi = 0;
+  for (size_t i = 0; i < syn.size(); i++) {
+    adj[i] = syn[i] - obs[i];
+    chi += 0.5 * adj[i] * adj[i] * dt;
+  }
+  return chi;
+}
+
+double Misfit::crossCorrelation(const std::vector<double> &syn, const std::vector<double> &obs, const PetscReal dt,
+                                std::vector<double> &adj) const {
+
+  const PetscInt n = syn.size();
+  PetscInt max_lag = mMaxShift > 0 ? static_cast<PetscInt>(std::ceil(mMaxShift / dt)) : n / 4;
+  max_lag = std::min(max_lag, n - 1);
+
+  /* The lag by which the data trails the synthetic, at the peak of their cross-correlation, refined by a parabola
+   * through the peak and its neighbours. */
+  auto correlation = [&](const PetscInt lag) {
+    double sum = 0;
+    for (PetscInt i = std::max<PetscInt>(lag, 0); i < std::min(n, n + lag); i++) { sum += obs[i] * syn[i - lag]; }
+    return sum;
+  };
+  PetscInt best = 0;
+  double peak = correlation(0);
+  for (PetscInt lag = -max_lag; lag <= max_lag; lag++) {
+    const double c = correlation(lag);
+    if (c > peak) { peak = c; best = lag; }
+  }
+  double shift = best;
+  if (std::abs(best) < max_lag) {
+    const double before = correlation(best - 1), after = correlation(best + 1);
+    const double curvature = before - 2 * peak + after;
+    if (curvature < 0) { shift += 0.5 * (before - after) / curvature; }
+  }
+  const double delta_t = shift * dt;
+
+  /* dT s' / int s'^2 dt, with the velocity by central differences. */
+  std::vector<double> velocity(n, 0);
+  for (PetscInt i = 0; i < n; i++) {
+    const PetscInt lo = std::max<PetscInt>(i - 1, 0), hi = std::min<PetscInt>(i + 1, n - 1);
+    if (hi > lo) { velocity[i] = (syn[hi] - syn[lo]) / ((hi - lo) * dt); }
+  }
+  double norm = 0;
+  for (auto v: velocity) { norm += v * v * dt; }
+  if (norm > 0) {
+    for (PetscInt i = 0; i < n; i++) { adj[i] = delta_t * velocity[i] / norm; }
+  }
+  return 0.5 * delta_t * delta_t;
+
+}
+
+double Misfit::timeFrequencyPhase(const std::vector<double> &syn, const std::vector<double> &obs,
+                                  const PetscReal dt, std::vector<double> &adj) const {
+
+  typedef std::complex<double> Complex;
+  const PetscInt n = syn.size(), num_freq = 32;
+  const double max_freq = mMaxFrequency > 0 ? mMaxFrequency : 0.1 / dt;
+  const double sigma = 1 / max_freq, d_omega = 2 * M_PI * max_freq / num_freq;
+  const PetscInt half = static_cast<PetscInt>(std::ceil(4 * sigma / dt));
+  const PetscInt hop = std::max<PetscInt>(1, std::lround(0.5 * sigma / dt));
+  const PetscInt num_time = (n - 1) / hop + 1;
+
+  /* The Gabor transforms, G(t_j, w_k) = int s(t) h(t - t_j) exp(-i w_k t) dt. */
+  std::vector<double> window(2 * half + 1);
+  for (PetscInt i = -half; i <= half; i++) {
+    window[i + half] = std::exp(-0.5 * (i * dt) * (i * dt) / (sigma * sigma));
+  }
+  auto gabor = [&](const std::vector<double> &f, std::vector<Complex> &g) {
+    g.assign(num_time * num_freq, 0);
+    for (PetscInt j = 0; j < num_time; j++) {
+      const PetscInt centre = j * hop;
+      for (PetscInt i = std::max<PetscInt>(centre - half, 0); i <= std::min(centre + half, n - 1); i++) {
+        const double value = f[i] * window[i - centre + half] * dt;
+        for (PetscInt k = 0; k < num_freq; k++) {
+          g[j * num_freq + k] += value * std::polar(1.0, -(k + 1) * d_omega * i * dt);
+        }
+      }
+    }
+  };
+  std::vector<Complex> g_syn, g_obs;
+  gabor(syn, g_syn); gabor(obs, g_obs);
+  double max_obs = 0, max_syn = 0;
+  for (size_t p = 0; p < g_obs.size(); p++) {
+    max_obs = std::max(max_obs, std::abs(g_obs[p])); max_syn = std::max(max_syn, std::abs(g_syn[p]));
+  }
+  if (max_obs <= 0 || max_syn <= 0) { return 0; }
+
+  /* The phase differences, weighted by the envelope of the data, where the phase of the synthetic is defined.
+   * A change of the synthetic changes its phase by Im(dG conj(G)) / |G|^2. */
+  const double cell = hop * dt * d_omega;
+  double chi = 0;
+  std::vector<Complex> factor(g_syn.size(), 0);
+  for (size_t p = 0; p < g_syn.size(); p++) {
+    const double amplitude = std::norm(g_syn[p]);
+    if (std::sqrt(amplitude) <= 1e-8 * max_syn) { continue; }
+    const double weight = std::abs(g_obs[p]) / max_obs;
+    const double phase = std::arg(g_syn[p] * std::conj(g_obs[p]));
+    chi += 0.5 * cell * weight * weight * phase * phase;
+    factor[p] = cell * weight * weight * phase * std::conj(g_syn[p]) / amplitude;
+  }
+  for (PetscInt j = 0; j < num_time; j++) {
+    const PetscInt centre = j * hop;
+    for (PetscInt i = std::max<PetscInt>(centre - half, 0); i <= std::min(centre + half, n - 1); i++) {
+      Complex sum = 0;
+      for (PetscInt k = 0; k < num_freq; k++) {
+        sum += factor[j * num_freq + k] * std::polar(1.0, -(k + 1) * d_omega * i * dt);
+      }
+      /* d chi / d s_i holds a dt from the transform, which the adjoint source (per unit time) does not. */
+      adj[i] += window[i - centre + half] * sum.imag();
+    }
+  }
+  return chi;
+
+}
@@ -1,21 +1,33 @@
 #include <iostream>
+#include <algorithm>
 #include <assert.h>
+#include <cmath>
 #include <Utilities/Options.h>
 #include <Receiver/Receiver.h>
 #include <Receiver/ReceiverHdf5.h>
+#include <Source/Source.h>
 #include <stdexcept>
 #include <Utilities/Utilities.h>
 #include <Utilities/Logging.h>
+#include <Utilities/Memory.h>
 
 // Initialize counter to zero.
 PetscInt Receiver::mNumRecs = 0;
+std::vector<float> Receiver::mBlock;
+std::vector<Receiver*> Receiver::mStoreReceivers;
+std::vector<std::string> Receiver::mStoreFields;
+size_t Receiver::mStoreCapacity = 0;
 
-std::vector<std::unique_ptr<Receiver>> Receiver::Factory(std::unique_ptr<Options> const &options) {
+std::vector<std::unique_ptr<Receiver>> Receiver::Factory(std::unique_ptr<Options> const &options,
+                                                         const std::vector<double> &box) {
 
   std::vector<std::unique_ptr<Receiver>> receivers;
+  auto &x = options->RecLocX(), &y = options->RecLocY(), &z = options->RecLocZ();
   for (int i = 0; i < options->NumberReceivers(); i++) {
-    if (utilities::stringHasExtension(options->ReceiverFileName(), ".h5")) {
-      receivers.push_back(std::unique_ptr<ReceiverHdf5>(new ReceiverHdf5(options)));
+    if (!utilities::pointInBox(box, x[i], y[i], z.size() ? z[i] : 0)) { continue; }
+    /* Without a file, the samples are only kept in the store (e.g. for the reciprocal shots). */
+    if (options->ReceiverFileName().empty() || utilities::stringHasExtension(options->ReceiverFileName(), ".h5")) {
+      receivers.push_back(std::unique_ptr<ReceiverHdf5>(new ReceiverHdf5(options, i)));
     } else {
       throw std::runtime_error("Runtime error: Filetype of receiver file cannot be deduced from extension."
                                    " Use [ .h5 ]");
@@ -24,10 +36,80 @@ std::vector<std::unique_ptr<Receiver>> Receiver::Factory(std::unique_ptr<Options
   return receivers;
 }
 
-Receiver::Receiver(std::unique_ptr<Options> const &options) {
+void Receiver::openOutput(std::unique_ptr<Options> const &options) {
+  if (!options->NumberReceivers() || options->ReceiverFileName().empty()) { return; }
+  if (utilities::stringHasExtension(options->ReceiverFileName(), ".h5")) {
+    // Room for the samples of the least decimated receiver.
+    auto decimation = options->RecDecimation();
+    PetscInt min_decimation = *std::min_element(decimation.begin(), decimation.end());
+    ReceiverHdf5::openStream(options->ReceiverFileName(), options->NumberReceivers(),
+                             NumOutputs(options->NumTimeSteps() + 1, min_decimation), decimation,
+                             options->AsyncOutput(), !options->RestartFrom().empty());
+    // The encoding of the sources, with the shifts they are tabulated with.
+    if (!options->SrcPolarity().empty() && options->RestartFrom().empty()) {
+      std::vector<double> shift;
+      for (auto s: options->SrcTimeShift()) {
+        shift.push_back(Source::ShiftSteps(s, options->TimeStep()) * options->TimeStep());
+      }
+      ReceiverHdf5::writeStreamEncoding(options->SrcShot(), options->SrcPolarity(), shift);
+    }
+  } else {
+    throw std::runtime_error("Runtime error: Filetype of receiver file cannot be deduced from extension."
+                                 " Use [ .h5 ]");
+  }
+}
+
+void Receiver::writeOutput() { ReceiverHdf5::writeStream(); }
+
+void Receiver::waitOutput() { ReceiverHdf5::waitStream(); }
+
+void Receiver::closeOutput() {
+  for (auto rec: mStoreReceivers) { rec->flushFilter(); }
+  ReceiverHdf5::closeStream();
+}
+
+void Receiver::flushOutput() { ReceiverHdf5::flushStream(); }
+
+std::vector<unsigned long long> Receiver::OutputWritten() {
+  return std::vector<unsigned long long>(ReceiverHdf5::StreamRowWritten().begin(),
+                                         ReceiverHdf5::StreamRowWritten().end());
+}
 
-  // Get receiver number and increment.
-  SetNum(mNumRecs++);
+void Receiver::SetOutputWritten(const std::vector<unsigned long long> &written) {
+  ReceiverHdf5::SetStreamRowWritten(std::vector<hsize_t>(written.begin(), written.end()));
+}
+
+std::vector<double> Receiver::FilterState() {
+  std::vector<double> state;
+  for (auto rec: mStoreReceivers) {
+    if (rec->mDecimation <= 1) { continue; }
+    for (size_t f = 0; f < rec->mHistory.size(); f++) {
+      state.push_back(rec->mNumInputs[f]);
+      state.insert(state.end(), rec->mHistory[f].begin(), rec->mHistory[f].end());
+    }
+  }
+  return state;
+}
+
+void Receiver::SetFilterState(const std::vector<double> &state) {
+  if (state.size() != FilterState().size()) {
+    throw std::runtime_error("The decimation filter state does not match the receivers.");
+  }
+  auto val = state.begin();
+  for (auto rec: mStoreReceivers) {
+    if (rec->mDecimation <= 1) { continue; }
+    for (size_t f = 0; f < rec->mHistory.size(); f++) {
+      rec->mNumInputs[f] = static_cast<size_t>(*val++);
+      std::copy(val, val + rec->mHistory[f].size(), rec->mHistory[f].begin());
+      val += rec->mHistory[f].size();
+    }
+  }
+}
+
+Receiver::Receiver(std::unique_ptr<Options> const &options, const PetscInt num) {
+
+  // Set receiver number, and count it.
+  SetNum(num); mNumRecs++;
 
   // Set physical location.
   mLocX = options->RecLocX()[mNum];
@@ -38,12 +120,33 @@ Receiver::Receiver(std::unique_ptr<Options> const &options) {
 
   // Set name.
   mName = options->RecNames()[mNum];
+  mStrain = options->ReceiverStrain();
+  mStress = options->ReceiverStress();
+  mRotation = options->ReceiverRotation();
+
+  // No room for samples until the store is allocated.
+  mCapacity = 0;
+
+  // Decimation, and its anti-alias filter.
+  mDecimation = options->RecDecimation().size() > mNum ? options->RecDecimation()[mNum] : 1;
+  if (mDecimation > 1) { mTaps = LowPass(mDecimation); }
 
 }
 
 
 
-Receiver::~Receiver() { --mNumRecs; }
+Receiver::~Receiver() {
+
+  --mNumRecs;
+
+  // The store is laid out for all of its receivers, so it goes with any one of them.
+  if (std::find(mStoreReceivers.begin(), mStoreReceivers.end(), this) != mStoreReceivers.end()) {
+    for (auto rec: mStoreReceivers) { rec->mCapacity = 0; }
+    mStoreReceivers.clear(); mStoreFields.clear(); mStoreCapacity = 0;
+    std::vector<float>().swap(mBlock);
+  }
+
+}
 
 void Receiver::record(const double val, const std::string &field) {
 
@@ -57,3 +160,155 @@ void Receiver::record(const double val, const std::string &field) {
 
 }
 
+void Receiver::registerFields(const std::vector<std::string> &fields) {
+  mFields = fields;
+  mSeries.assign(fields.size(), NULL);
+  mCount.assign(fields.size(), 0);
+  mCapacity = 0;
+  mHistory.assign(fields.size(), std::vector<double>(mTaps.size(), 0));
+  mNumInputs.assign(fields.size(), 0);
+}
+
+std::vector<double> Receiver::LowPass(const PetscInt decimation) {
+
+  const PetscInt half = mFilterHalfWidth * decimation;
+  const double fc = 0.8 * 0.5 / decimation;
+  std::vector<double> taps(2 * half + 1);
+  double sum = 0;
+  for (PetscInt j = 0; j <= 2 * half; j++) {
+    double t = j - half, x = M_PI * j / half;
+    double sinc = t ? std::sin(2 * M_PI * fc * t) / (M_PI * t) : 2 * fc;
+    taps[j] = sinc * (0.42 - 0.5 * std::cos(x) + 0.08 * std::cos(2 * x));
+    sum += taps[j];
+  }
+  for (auto &tap: taps) { tap /= sum; }
+  return taps;
+
+}
+
+size_t Receiver::StoreCapacityFor(const std::vector<Receiver*> &receivers, const size_t num_steps) {
+  size_t capacity = 0;
+  for (auto rec: receivers) {
+    size_t lag = rec->mDecimation > 1 ? mFilterHalfWidth + 1 : 0;
+    capacity = std::max(capacity, NumOutputs(num_steps, rec->mDecimation) + lag);
+  }
+  return capacity;
+}
+
+void Receiver::filter(const double val, const PetscInt field) {
+
+  // The latest inputs, in a ring.
+  std::vector<double> &ring = mHistory[field];
+  const size_t len = mTaps.size(), half = len / 2;
+  const size_t m = mNumInputs[field]++, head = m % len;
+  ring[head] = val;
+
+  // Output k is centred on input k * decimation, so it is complete once input k * decimation + half is in. Only
+  // these outputs are computed (the polyphase form of filtering, then decimating).
+  if (m < half || (m - half) % mDecimation) { return; }
+  double sum = 0;
+  for (size_t j = 0; j <= head; j++) { sum += mTaps[j] * ring[head - j]; }
+  for (size_t j = head + 1; j < len; j++) { sum += mTaps[j] * ring[head + len - j]; }
+  if (mCount[field] < mCapacity) { mSeries[field][mCount[field]++] = sum; }
+
+}
+
+void Receiver::flushFilter() {
+  if (mDecimation <= 1) { return; }
+  const size_t half = mTaps.size() / 2;
+  for (size_t f = 0; f < mNumInputs.size(); f++) {
+    if (!mNumInputs[f]) { continue; }
+    const size_t last = (mNumInputs[f] - 1) / mDecimation * mDecimation + half;
+    while (mNumInputs[f] <= last) { filter(0, f); }
+  }
+}
+
+void Receiver::allocateStore(const std::vector<Receiver*> &receivers, const size_t num_samples) {
+
+  // Fields of all receivers, in order of appearance.
+  std::vector<std::string> fields;
+  for (auto rec: receivers) {
+    for (auto &f: rec->mFields) {
+      if (std::find(fields.begin(), fields.end(), f) == fields.end()) { fields.push_back(f); }
+    }
+  }
+
+  // Each receiver's series of field f start at (f * #receivers + r) * num_samples.
+  std::vector<float>(fields.size() * receivers.size() * num_samples, 0).swap(mBlock);
+  for (size_t r = 0; r < receivers.size(); r++) {
+    Receiver *rec = receivers[r];
+    for (size_t i = 0; i < rec->mFields.size(); i++) {
+      size_t f = std::find(fields.begin(), fields.end(), rec->mFields[i]) - fields.begin();
+      rec->mSeries[i] = mBlock.data() + (f * receivers.size() + r) * num_samples;
+      rec->mCount[i] = 0;
+    }
+    rec->mCapacity = num_samples;
+  }
+  mStoreReceivers = receivers; mStoreFields = fields; mStoreCapacity = num_samples;
+
+}
+
+size_t Receiver::StorePending() {
+  size_t num = 0;
+  for (auto rec: mStoreReceivers) { num = std::max(num, rec->Pending()); }
+  return num;
+}
+
+size_t Receiver::BufferBytes() {
+  size_t bytes = Memory::bytes(mBlock) + ReceiverHdf5::StreamBytes();
+  for (auto rec: mStoreReceivers) { bytes += Memory::bytes(rec->mTaps) + Memory::bytes(rec->mHistory); }
+  return bytes;
+}
+
+void Receiver::rewindStore() {
+  for (auto rec: mStoreReceivers) { std::fill(rec->mCount.begin(), rec->mCount.end(), 0); }
+}
+
+void Receiver::swapStore(std::vector<float> &block) {
+
+  // Each series keeps its offset into the block.
+  block.resize(mBlock.size());
+  for (auto rec: mStoreReceivers) {
+    for (auto &series: rec->mSeries) { series = block.data() + (series - mBlock.data()); }
+  }
+  mBlock.swap(block);
+  rewindStore();
+
+}
+
+std::vector<std::string> Receiver::GradientFields(const PetscInt num_dim) const {
+  std::vector<std::string> fields;
+  for (auto names: {std::make_pair(mStrain, StrainNames(num_dim)), std::make_pair(mStress, StressNames(num_dim)),
+                    std::make_pair(mRotation, RotationNames(num_dim))}) {
+    if (names.first) { fields.insert(fields.end(), names.second.begin(), names.second.end()); }
+  }
+  return fields;
+}
+
+std::vector<std::string> Receiver::GradientNames() {
+  std::vector<std::string> names = StrainNames(3), stress = StressNames(3), rotation = RotationNames(3);
+  names.insert(names.end(), stress.begin(), stress.end());
+  names.insert(names.end(), rotation.begin(), rotation.end());
+  return names;
+}
+
+std::vector<std::string> Receiver::Fields() const {
+  std::vector<std::string> fields(mFields);
+  for (auto &dict: store) {
+    if (std::find(fields.begin(), fields.end(), dict.first) == fields.end()) { fields.push_back(dict.first); }
+  }
+  return fields;
+}
+
+const float *Receiver::Samples(const std::string &field, size_t &num) const {
+  auto it = std::find(mFields.begin(), mFields.end(), field);
+  if (it != mFields.end() && mCapacity) {
+    num = mCount[it - mFields.begin()];
+    return mSeries[it - mFields.begin()];
+  }
+  auto dict = store.find(field);
+  if (dict != store.end()) { num = dict->second.size(); return dict->second.data(); }
+  num = 0;
+  return NULL;
+}
+
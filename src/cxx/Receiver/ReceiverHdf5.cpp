@@ -1,37 +1,70 @@
+#include <algorithm>
+#include <stdexcept>
 #include <Utilities/Options.h>
 #include <Utilities/Utilities.h>
+#include <Utilities/FieldId.h>
+#include <Utilities/Logging.h>
 #include <Receiver/ReceiverHdf5.h>
 
 // Initialize hdf5 static.
 hid_t ReceiverHdf5::mFileId;
+std::string ReceiverHdf5::mFileName;
 std::vector<std::string> ReceiverHdf5::mWriteRegisteredFields;
+hid_t ReceiverHdf5::mStreamFileId = 0;
+std::vector<hid_t> ReceiverHdf5::mStreamSets;
+std::vector<PetscInt> ReceiverHdf5::mStreamStoreField;
+hsize_t ReceiverHdf5::mStreamNumSamples = 0;
+std::vector<hsize_t> ReceiverHdf5::mStreamRowWritten;
+std::unique_ptr<AsyncWriter> ReceiverHdf5::mStreamWriter;
+std::vector<float> ReceiverHdf5::mStreamSnapshot;
+MPI_Comm ReceiverHdf5::mStreamComm = MPI_COMM_NULL;
 
-ReceiverHdf5::ReceiverHdf5(std::unique_ptr<Options> const &options) : Receiver(options) {
-
-  // Only create one hdf5 file for all receivers.
-  if ((Num() == 0) && (options->ReceiverFileName().size())) {
+// A 1D dataset of the streamed output, written by the first rank (collective).
+static void writeFirstRank(hid_t file_id, const std::string &name, hid_t type, const void *buf, hsize_t size) {
+  int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+  hid_t filespace = H5Screate_simple(1, &size, NULL);
+  hid_t set = H5Dcreate(file_id, name.c_str(), type, filespace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  hid_t memspace = H5Screate_simple(1, &size, NULL);
+  if (rank) { H5Sselect_none(filespace); H5Sselect_none(memspace); }
+  hid_t plist_id = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
+  H5Dwrite(set, type, memspace, filespace, plist_id, buf);
+  H5Pclose(plist_id);
+  H5Sclose(memspace);
+  H5Sclose(filespace);
+  H5Dclose(set);
+}
 
-    // Create file and set access.
-    std::string fname = options->ReceiverFileName();
-    hid_t plist_id = H5Pcreate(H5P_FILE_ACCESS);
-    H5Pset_fapl_mpio(plist_id, PETSC_COMM_WORLD, MPI_INFO_NULL);
-    mFileId = H5Fcreate(fname.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, plist_id);
-    H5Pclose(plist_id);
+ReceiverHdf5::ReceiverHdf5(std::unique_ptr<Options> const &options, const PetscInt num) : Receiver(options, num) {
 
-  }
+  // Only create one hdf5 file for all receivers, once they are written (see write). Runs stream their
+  // output into the same file instead (see openStream).
+  if (Num() == 0) { mFileName = options->ReceiverFileName(); }
 
 }
 
 ReceiverHdf5::~ReceiverHdf5() {
   if ((Num() == 0) && mFileId) {
     H5Fclose(mFileId);
+    mFileId = 0;
   }
 }
 
 void ReceiverHdf5::write() {
 
+  // Create file and set access.
+  if (!mFileId && mFileName.size()) {
+    hid_t plist_id = H5Pcreate(H5P_FILE_ACCESS);
+    H5Pset_fapl_mpio(plist_id, PETSC_COMM_WORLD, MPI_INFO_NULL);
+    mFileId = H5Fcreate(mFileName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, plist_id);
+    H5Pclose(plist_id);
+  }
+
   // Send maximum length to all processors. Also send all field names (just once).
-  hsize_t loc_size = (store.size()) ? store.begin()->second.size() : 0;
+  std::vector<std::string> fields = Fields();
+  size_t num_samples = 0;
+  if (!fields.empty()) { Samples(fields.front(), num_samples); }
+  hsize_t loc_size = num_samples;
   hsize_t n_samples = 0;
   MPI_Allreduce(&loc_size, &n_samples, 1, MPI_UNSIGNED_LONG_LONG,
                 MPI_SUM, MPI_COMM_WORLD);
@@ -40,8 +73,8 @@ void ReceiverHdf5::write() {
   if (Num() == 0) {
     int name_rank = 0;
     std::vector<std::string> name;
-    for (auto &dict: store) {
-      name.push_back(dict.first);
+    for (auto &field: fields) {
+      name.push_back(field);
       MPI_Comm_rank(PETSC_COMM_WORLD, &name_rank);
     }
     MPI_Allreduce(MPI_IN_PLACE, &name_rank, 1, MPI_INT, MPI_SUM, PETSC_COMM_WORLD);
@@ -72,10 +105,12 @@ void ReceiverHdf5::write() {
     H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
 
     // Write if field is present on this processor. Else write zeros. */
-    if (store.find(field) != store.end()) {
-      H5Dwrite(dset_id, H5T_NATIVE_FLOAT, memspace, filespace, plist_id, store[field].data());
+    size_t num_field;
+    const float *samples = Samples(field, num_field);
+    if (samples) {
+      H5Dwrite(dset_id, H5T_NATIVE_FLOAT, memspace, filespace, plist_id, samples);
     } else {
-      Eigen::VectorXf zeros = Eigen::VectorXf::Zero(store.begin()->second.size());
+      Eigen::VectorXf zeros = Eigen::VectorXf::Zero(loc_size);
       H5Dwrite(dset_id, H5T_NATIVE_FLOAT, memspace, filespace, plist_id, zeros.data());
     }
     H5Dclose(dset_id);
@@ -88,3 +123,187 @@ void ReceiverHdf5::write() {
 
 
 
+
+void ReceiverHdf5::openStream(const std::string &filename, const hsize_t num_receivers,
+                              const hsize_t num_samples, const std::vector<PetscInt> &decimation,
+                              const bool async, const bool resume) {
+
+  // Fields recorded on any rank, as a mask of field identifiers, followed by the quantities recorded from the
+  // gradient (see Receiver::GradientNames).
+  const std::vector<std::string> gradient = GradientNames();
+  unsigned long long mask = 0;
+  for (auto &field: StoreFields()) {
+    auto it = std::find(gradient.begin(), gradient.end(), field);
+    const int bit = it == gradient.end() ? static_cast<int>(FieldIdFromName(field)) :
+                                          NumFieldIds + static_cast<int>(it - gradient.begin());
+    mask |= 1ull << bit;
+  }
+  MPI_Allreduce(MPI_IN_PLACE, &mask, 1, MPI_UNSIGNED_LONG_LONG, MPI_BOR, PETSC_COMM_WORLD);
+
+  // The writing thread makes MPI calls alongside the main thread. Its collectives go over a communicator of
+  // their own, so that they cannot be matched with those of the time loop.
+  int level = MPI_THREAD_SINGLE;
+  if (async) {
+    MPI_Query_thread(&level);
+    if (level < MPI_THREAD_MULTIPLE) {
+      LOG() << "Warning: MPI was not initialized with MPI_THREAD_MULTIPLE. Receivers are written synchronously.";
+    }
+  }
+  mStreamComm = PETSC_COMM_WORLD;
+  if (async && level >= MPI_THREAD_MULTIPLE) {
+    MPI_Comm_dup(PETSC_COMM_WORLD, &mStreamComm);
+    mStreamWriter.reset(new AsyncWriter);
+  }
+
+  // Create file (or open that of the run resumed) and set access.
+  hid_t plist_id = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fapl_mpio(plist_id, mStreamComm, MPI_INFO_NULL);
+  mStreamFileId = resume ? H5Fopen(filename.c_str(), H5F_ACC_RDWR, plist_id) :
+                           H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, plist_id);
+  H5Pclose(plist_id);
+  if (mStreamFileId < 0) {
+    mStreamFileId = 0;
+    throw std::runtime_error("Can't open receiver file '" + filename + "' to resume its output.");
+  }
+
+  // Chunks hold a few receivers, over the samples of one write.
+  hsize_t dims[2] = {num_receivers, num_samples};
+  hsize_t chunk[2] = {std::min<hsize_t>(num_receivers, 64),
+                      std::max<hsize_t>(1, std::min<hsize_t>(num_samples, StoreCapacity()))};
+  hid_t dcpl_id = H5Pcreate(H5P_DATASET_CREATE);
+  H5Pset_chunk(dcpl_id, 2, chunk);
+
+  mStreamSets.clear(); mStreamStoreField.clear();
+  for (int i = 0; i < NumFieldIds + static_cast<int>(gradient.size()); i++) {
+    if (!(mask & (1ull << i))) { continue; }
+    std::string field = i < NumFieldIds ? FieldName(static_cast<FieldId>(i)) : gradient[i - NumFieldIds];
+    if (resume) {
+      mStreamSets.push_back(H5Dopen(mStreamFileId, ("/" + field).c_str(), H5P_DEFAULT));
+    } else {
+      hid_t filespace = H5Screate_simple(2, dims, NULL);
+      mStreamSets.push_back(H5Dcreate(mStreamFileId, ("/" + field).c_str(), H5T_NATIVE_FLOAT, filespace,
+                                      H5P_DEFAULT, dcpl_id, H5P_DEFAULT));
+      H5Sclose(filespace);
+    }
+    auto store = std::find(StoreFields().begin(), StoreFields().end(), field);
+    mStreamStoreField.push_back(store == StoreFields().end() ? -1 : store - StoreFields().begin());
+  }
+  H5Pclose(dcpl_id);
+
+  // Decimation factor of each receiver, written by the first rank (when the file is created).
+  if (!decimation.empty() && !resume) {
+    std::vector<int> factors(decimation.begin(), decimation.end());
+    writeFirstRank(mStreamFileId, "/decimation", H5T_NATIVE_INT, factors.data(), factors.size());
+  }
+
+  mStreamNumSamples = num_samples;
+  mStreamRowWritten.assign(num_receivers, 0);
+
+}
+
+void ReceiverHdf5::writeStreamEncoding(const std::vector<PetscInt> &shot, const std::vector<double> &polarity,
+                                       const std::vector<double> &time_shift) {
+  std::vector<int> shots(shot.begin(), shot.end());
+  writeFirstRank(mStreamFileId, "/source_shot", H5T_NATIVE_INT, shots.data(), shots.size());
+  writeFirstRank(mStreamFileId, "/source_polarity", H5T_NATIVE_DOUBLE, polarity.data(), polarity.size());
+  writeFirstRank(mStreamFileId, "/source_time_shift", H5T_NATIVE_DOUBLE, time_shift.data(), time_shift.size());
+}
+
+void ReceiverHdf5::writeStream() {
+
+  if (!mStreamFileId) { return; }
+
+  // The second block is free once the previous write is done.
+  waitStream();
+
+  // All ranks write the same datasets, whether or not they hold receivers (or samples).
+  unsigned long long pending = StorePending();
+  MPI_Allreduce(MPI_IN_PLACE, &pending, 1, MPI_UNSIGNED_LONG_LONG, MPI_MAX, PETSC_COMM_WORLD);
+
+  // Row, first column and number of samples of the receivers on this rank (which are in increasing order in the
+  // store). Decimated receivers take fewer samples, so each row has its own columns. The receivers may be gone by
+  // the time the samples are written.
+  std::vector<hsize_t> rows, starts, counts;
+  for (auto rec: StoreReceivers()) {
+    hsize_t row = rec->Num(), &written = mStreamRowWritten[row];
+    hsize_t count = std::min<hsize_t>(rec->Pending(), mStreamNumSamples - written);
+    rows.push_back(row); starts.push_back(written); counts.push_back(count);
+    written += count;
+  }
+  const hsize_t capacity = StoreCapacity();
+  swapStore(mStreamSnapshot);
+
+  auto task = [rows, starts, counts, capacity, pending]() {
+
+    hsize_t mem_dims[2] = {rows.size(), capacity};
+    bool any = false;
+    for (auto count: counts) { any = any || count; }
+    hid_t plist_id = H5Pcreate(H5P_DATASET_XFER);
+    H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
+    for (size_t d = 0; d < mStreamSets.size() && pending; d++) {
+
+      // Rows of the receivers on this rank, in their new columns.
+      hid_t filespace = H5Dget_space(mStreamSets[d]);
+      H5Sselect_none(filespace);
+      hid_t memspace;
+      float none = 0;
+      const bool own = mStreamStoreField[d] >= 0 && any;
+      if (own) {
+        memspace = H5Screate_simple(2, mem_dims, NULL);
+        H5Sselect_none(memspace);
+        for (size_t r = 0; r < rows.size(); r++) {
+          if (!counts[r]) { continue; }
+          hsize_t file_start[2] = {rows[r], starts[r]}, mem_start[2] = {r, 0}, count[2] = {1, counts[r]};
+          H5Sselect_hyperslab(filespace, H5S_SELECT_OR, file_start, NULL, count, NULL);
+          H5Sselect_hyperslab(memspace, H5S_SELECT_OR, mem_start, NULL, count, NULL);
+        }
+      } else {
+        hsize_t one = 1;
+        memspace = H5Screate_simple(1, &one, NULL);
+        H5Sselect_none(memspace);
+      }
+      H5Dwrite(mStreamSets[d], H5T_NATIVE_FLOAT, memspace, filespace, plist_id,
+               own ? mStreamSnapshot.data() + mStreamStoreField[d] * rows.size() * capacity : &none);
+      H5Sclose(memspace);
+      H5Sclose(filespace);
+
+    }
+    H5Pclose(plist_id);
+
+  };
+
+  if (mStreamWriter) { mStreamWriter->submit(task); } else { task(); }
+
+}
+
+void ReceiverHdf5::waitStream() {
+  if (mStreamWriter) { mStreamWriter->wait(); }
+}
+
+void ReceiverHdf5::closeStream() {
+
+  if (!mStreamFileId) { return; }
+  writeStream();
+  waitStream();
+  mStreamWriter.reset();
+  for (auto set: mStreamSets) { H5Dclose(set); }
+  mStreamSets.clear(); mStreamStoreField.clear(); mStreamRowWritten.clear();
+  H5Fclose(mStreamFileId);
+  mStreamFileId = 0;
+  if (mStreamComm != PETSC_COMM_WORLD) { MPI_Comm_free(&mStreamComm); }
+  mStreamComm = MPI_COMM_NULL;
+  std::vector<float>().swap(mStreamSnapshot);
+
+}
+
+void ReceiverHdf5::flushStream() {
+  if (mStreamFileId) { H5Fflush(mStreamFileId, H5F_SCOPE_GLOBAL); }
+}
+
+void ReceiverHdf5::SetStreamRowWritten(const std::vector<hsize_t> &written) {
+  if (written.size() != mStreamRowWritten.size()) {
+    throw std::runtime_error("The receiver output holds " + std::to_string(mStreamRowWritten.size()) +
+                             " receivers, not " + std::to_string(written.size()) + ".");
+  }
+  mStreamRowWritten = written;
+}
@@ -0,0 +1,49 @@
+#include <Source/AdjointSource.h>
+#include <Utilities/Options.h>
+#include <stdexcept>
+
+std::map<PetscInt, Eigen::MatrixXd> AdjointSource::mTraces;
+
+AdjointSource::AdjointSource(std::unique_ptr<Options> const &options, const PetscInt num): Source(options, num) {
+
+  SetLocX(options->SrcLocX()[Num()]);
+  SetLocY(options->SrcLocY()[Num()]);
+  if (options->SrcLocZ().size()) {
+    SetLocZ(options->SrcLocZ()[Num()]);
+  }
+  mNumComponents = options->SrcNumComponents()[Num()];
+
+  /* Looked up by loadData, on the rank the source is attached to. */
+  mTrace = NULL;
+
+}
+
+void AdjointSource::loadData() {
+
+  auto trace = mTraces.find(Num());
+  if (trace == mTraces.end() || trace->second.rows() != mNumComponents) {
+    throw std::runtime_error("No adjoint source of " + std::to_string(mNumComponents) + " component(s) was "
+                             "computed for source " + std::to_string(Num()) + " on this rank.");
+  }
+  mTrace = &trace->second;
+
+}
+
+Eigen::VectorXd AdjointSource::evaluate(const double &time, const PetscInt &time_idx) {
+
+  Eigen::VectorXd src(mNumComponents);
+  tabulate(src.data(), time_idx, 1, 0);
+  return src;
+
+}
+
+void AdjointSource::tabulate(double *forces, const PetscInt first_step, const PetscInt num_steps, const double dt) {
+
+  loadData();
+  Eigen::Map<Eigen::MatrixXd> out(forces, mNumComponents, num_steps);
+  out.setZero();
+  const PetscInt begin = std::max<PetscInt>(first_step, 0);
+  const PetscInt end = std::min<PetscInt>(first_step + num_steps, mTrace->cols());
+  if (begin < end) { out.middleCols(begin - first_step, end - begin) = mTrace->middleCols(begin, end - begin); }
+
+}
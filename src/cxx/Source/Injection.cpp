@@ -0,0 +1,195 @@
+#include <Source/Injection.h>
+#include <Utilities/Options.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "hdf5.h"
+#include "hdf5_hl.h"
+
+hid_t Injection::mFile = -1;
+hid_t Injection::mDsp = -1;
+hid_t Injection::mTrcSet = -1;
+PetscInt Injection::mNumSamples = 0;
+PetscInt Injection::mNumPoints = 0;
+PetscInt Injection::mNumCmp = 0;
+PetscReal Injection::mStartTime = 0;
+PetscReal Injection::mDt = 0;
+StaticKdTree Injection::mTree;
+PetscReal Injection::mTol = 0;
+std::vector<PetscInt> Injection::mRows;
+std::vector<PetscInt> Injection::mSlot;
+PetscInt Injection::mWindow = 0;
+PetscInt Injection::mFirst = 0;
+std::vector<PetscReal> Injection::mDspWin;
+std::vector<PetscReal> Injection::mTrcWin;
+PetscReal Injection::mTime = 0;
+std::vector<PetscReal> Injection::mVel;
+std::vector<PetscReal> Injection::mTrc;
+
+/* Dimensions of a dataset, or empty if it can not be opened. */
+static std::vector<hsize_t> datasetDims(const hid_t set) {
+  if (set < 0) { return {}; }
+  hid_t space = H5Dget_space(set);
+  std::vector<hsize_t> dims(H5Sget_simple_extent_ndims(space));
+  H5Sget_simple_extent_dims(space, dims.data(), NULL);
+  H5Sclose(space);
+  return dims;
+}
+
+void Injection::Open(std::unique_ptr<Options> const &options) {
+
+  Close();
+  const std::string name = options->InjectionFile();
+  mFile = H5Fopen(name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  if (mFile < 0) { throw std::runtime_error("Can't open injection file '" + name + "'."); }
+
+  /* The points on the boundary, and the samples of their wavefield. */
+  hid_t crd = H5Dopen2(mFile, "coordinates", H5P_DEFAULT);
+  mDsp = H5Dopen2(mFile, "displacement", H5P_DEFAULT);
+  mTrcSet = H5Dopen2(mFile, "traction", H5P_DEFAULT);
+  const std::vector<hsize_t> crd_dims = datasetDims(crd), dims = datasetDims(mDsp);
+  if (crd_dims.size() != 2 || dims.size() != 3 || datasetDims(mTrcSet) != dims || dims[1] != crd_dims[0]) {
+    if (crd >= 0) { H5Dclose(crd); }
+    Close();
+    throw std::runtime_error("Injection file '" + name + "' must hold the datasets coordinates (#points x #dim), "
+                             "and displacement and traction (#samples x #points x #components).");
+  }
+  mNumSamples = dims[0]; mNumPoints = dims[1]; mNumCmp = dims[2];
+  double dt = 0, start_time = 0;
+  if (H5LTget_attribute_double(mFile, "/", "dt", &dt) < 0 ||
+      H5LTget_attribute_double(mFile, "/", "start_time", &start_time) < 0 || !(dt > 0)) {
+    H5Dclose(crd);
+    Close();
+    throw std::runtime_error("Injection file '" + name + "' must give the (positive) attribute dt and the "
+                             "attribute start_time of its samples.");
+  }
+  mDt = dt; mStartTime = start_time;
+
+  /* All points are indexed, as it is not known yet which lie on the elements of this rank. */
+  const PetscInt num_dim = crd_dims[1];
+  std::vector<PetscReal> pts(mNumPoints * num_dim);
+  herr_t status = H5Dread(crd, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, pts.data());
+  H5Dclose(crd);
+  if (status < 0) { Close(); throw std::runtime_error("Can't read the coordinates of '" + name + "'."); }
+  mTree.build(num_dim, pts.data(), mNumPoints);
+  PetscReal diameter = 0;
+  for (PetscInt d = 0; d < num_dim; d++) {
+    PetscReal lo = std::numeric_limits<PetscReal>::max(), hi = -lo;
+    for (PetscInt i = 0; i < mNumPoints; i++) {
+      lo = std::min(lo, pts[i * num_dim + d]); hi = std::max(hi, pts[i * num_dim + d]);
+    }
+    if (mNumPoints) { diameter += (hi - lo) * (hi - lo); }
+  }
+  mTol = 1e-6 * std::sqrt(diameter);
+
+  mSlot.assign(mNumPoints, -1);
+  mWindow = options->InjectionWindow();
+
+}
+
+void Injection::Close() {
+  if (mDsp >= 0) { H5Dclose(mDsp); }
+  if (mTrcSet >= 0) { H5Dclose(mTrcSet); }
+  if (mFile >= 0) { H5Fclose(mFile); }
+  mFile = mDsp = mTrcSet = -1;
+  mTree.clear();
+  std::vector<PetscInt>().swap(mRows); std::vector<PetscInt>().swap(mSlot);
+  std::vector<PetscReal>().swap(mDspWin); std::vector<PetscReal>().swap(mTrcWin);
+  std::vector<PetscReal>().swap(mVel); std::vector<PetscReal>().swap(mTrc);
+}
+
+PetscInt Injection::Lookup(const PetscReal *x) {
+
+  const PetscInt row = mTree.nearest(x);
+  std::vector<PetscInt> near;
+  mTree.within(x, mTol, near);
+  if (near.empty()) {
+    throw std::runtime_error("A node of an injection boundary is not among the points of the injection file. "
+                             "The file must give the wavefield at the nodes of the boundary of this mesh.");
+  }
+
+  /* Rows may be looked up by elements set up concurrently. */
+  #pragma omp critical (injection_lookup)
+  {
+    if (mSlot[row] < 0) { mSlot[row] = mRows.size(); mRows.push_back(row); }
+  }
+  return row;
+
+}
+
+void Injection::Finalize() {
+
+  /* In the order of the file, as the selection of a read returns them. */
+  std::sort(mRows.begin(), mRows.end());
+  for (PetscInt i = 0; i < mRows.size(); i++) { mSlot[mRows[i]] = i; }
+  mVel.assign(mRows.size() * mNumCmp, 0); mTrc.assign(mRows.size() * mNumCmp, 0);
+  mDspWin.clear(); mTrcWin.clear();
+  mTime = std::numeric_limits<PetscReal>::quiet_NaN();
+
+}
+
+void Injection::read(const PetscInt first) {
+
+  const PetscInt num_rows = mRows.size(), size = num_rows * mNumCmp;
+  mFirst = first;
+  mDspWin.assign(mWindow * size, 0); mTrcWin.assign(mWindow * size, 0);
+  const PetscInt beg = std::max<PetscInt>(first, 0), end = std::min(first + mWindow, mNumSamples);
+  if (beg >= end || !num_rows) { return; }
+
+  /* The rows read by this rank, as one hyperslab per run of consecutive rows. */
+  for (auto set: {mDsp, mTrcSet}) {
+    hid_t file_space = H5Dget_space(set);
+    H5Sselect_none(file_space);
+    for (PetscInt i = 0; i < num_rows; ) {
+      PetscInt j = i + 1;
+      while (j < num_rows && mRows[j] == mRows[j - 1] + 1) { j++; }
+      hsize_t start[3] = {(hsize_t) beg, (hsize_t) mRows[i], 0};
+      hsize_t count[3] = {(hsize_t) (end - beg), (hsize_t) (j - i), (hsize_t) mNumCmp};
+      H5Sselect_hyperslab(file_space, H5S_SELECT_OR, start, NULL, count, NULL);
+      i = j;
+    }
+    hsize_t mem_size = (end - beg) * size;
+    hid_t mem_space = H5Screate_simple(1, &mem_size, NULL);
+    PetscReal *win = (set == mDsp ? mDspWin : mTrcWin).data() + (beg - first) * size;
+    herr_t status = H5Dread(set, H5T_NATIVE_DOUBLE, mem_space, file_space, H5P_DEFAULT, win);
+    H5Sclose(mem_space); H5Sclose(file_space);
+    if (status < 0) { throw std::runtime_error("Can't read the wavefield of the injection file."); }
+  }
+
+}
+
+const PetscReal *Injection::sample(const std::vector<PetscReal> &win, const PetscInt k, const PetscInt slot) {
+  static const std::vector<PetscReal> zero(16, 0);
+  if (k < 0 || k >= mNumSamples) { return zero.data(); }
+  return &win[((k - mFirst) * mRows.size() + slot) * mNumCmp];
+}
+
+void Injection::Advance(const PetscReal time) {
+
+  if (!Active() || time == mTime) { return; }
+  mTime = time;
+
+  /* Between samples k and k + 1, whose velocities take the samples on either side. */
+  const PetscReal pos = (time - mStartTime) / mDt;
+  const PetscInt k = std::floor(pos);
+  const PetscReal a = pos - k;
+  if (mDspWin.empty() || k - 1 < mFirst || k + 2 >= mFirst + mWindow) { read(k - 1); }
+
+  for (PetscInt slot = 0; slot < mRows.size(); slot++) {
+    for (PetscInt c = 0; c < mNumCmp; c++) {
+      PetscReal vel[2] = {0, 0};
+      for (PetscInt i = 0; i < 2; i++) {
+        /* Central differences, one-sided at the first and last sample, and nothing outside the file. */
+        const PetscInt j = k + i;
+        if (j < 0 || j >= mNumSamples) { continue; }
+        const PetscInt lo = std::max<PetscInt>(j - 1, 0), hi = std::min(j + 1, mNumSamples - 1);
+        if (hi > lo) { vel[i] = (sample(mDspWin, hi, slot)[c] - sample(mDspWin, lo, slot)[c]) / ((hi - lo) * mDt); }
+      }
+      mVel[slot * mNumCmp + c] = (1 - a) * vel[0] + a * vel[1];
+      mTrc[slot * mNumCmp + c] = (1 - a) * sample(mTrcWin, k, slot)[c] + a * sample(mTrcWin, k + 1, slot)[c];
+    }
+  }
+
+}
@@ -6,7 +6,7 @@
 #include <iostream>
 #include <Utilities/Logging.h>
 
-Ricker::Ricker(std::unique_ptr<Options> const &options): Source(options) {
+Ricker::Ricker(std::unique_ptr<Options> const &options, const PetscInt num): Source(options, num) {
 
   /* Set locations. */
   SetLocX(options->SrcLocX()[Num()]);
@@ -21,13 +21,28 @@ Ricker::Ricker(std::unique_ptr<Options> const &options): Source(options) {
   mAmplitude = options->SrcRickerAmplitude()[Num()];
   mCenterFreq = options->SrcRickerCenterFreq()[Num()];
   mDirection = options->SrcRickerDirection(Num());
+  if (mDirection.size() != mNumComponents) {
+    throw std::runtime_error("The direction of source " + std::to_string(Num()) + " does not match its number of "
+                             "components.");
+  }
   
 }
 
-Eigen::VectorXd Ricker::fire(const double &time, const PetscInt &time_idx) {
+Eigen::VectorXd Ricker::evaluate(const double &time, const PetscInt &time_idx) {
 
   const double factor = M_PI * M_PI * mCenterFreq * mCenterFreq * (time - mTimeDelay) * (time - mTimeDelay);
   const double ricker_force = (mAmplitude * ((1 - 2 * factor) * exp(-1 * factor)));
   return ricker_force * mDirection;
 
 }
+
+void Ricker::tabulate(double *forces, const PetscInt first_step, const PetscInt num_steps, const double dt) {
+
+  /* All steps at once, as array expressions. */
+  Eigen::ArrayXd time =
+      Eigen::ArrayXd::LinSpaced(num_steps, first_step, first_step + num_steps - 1) * dt - mTimeDelay;
+  Eigen::ArrayXd factor = M_PI * M_PI * mCenterFreq * mCenterFreq * time.square();
+  Eigen::ArrayXd ricker_force = mAmplitude * ((1 - 2 * factor) * (-factor).exp());
+  Eigen::Map<Eigen::MatrixXd>(forces, mNumComponents, num_steps) = mDirection * ricker_force.matrix().transpose();
+
+}
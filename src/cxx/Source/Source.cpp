@@ -2,36 +2,59 @@
 #include <Source/Source.h>
 #include <Source/Ricker.h>
 #include <Source/SourceHdf5.h>
+#include <Source/AdjointSource.h>
 #include <Utilities/Options.h>
 #include <stdexcept>
+#include <algorithm>
 #include <iostream>
 #include <Utilities/Logging.h>
+#include <Utilities/Utilities.h>
 
 /* Initialize counter. */
 PetscInt Source::number = 0;
+PetscInt Source::mActiveWavefield = Source::Forward;
+std::vector<double> Source::mTable;
+std::vector<Source*> Source::mTableSources;
+PetscInt Source::mTableFirst = 0;
+PetscInt Source::mTableSteps = 0;
+PetscInt Source::mTableWindow = 0;
+PetscInt Source::mTableTotal = 0;
+double Source::mTableDt = 0;
 
-enum source_type { sRicker, sHDF5, sTypeError };
+enum source_type { sRicker, sHDF5, sAdjoint, sTypeError };
 source_type stype(const std::string &stype) {
   if (stype == "ricker") return sRicker;
   if (stype == "file")  return sHDF5;
+  if (stype == "adjoint") return sAdjoint;
   return sTypeError;
 }
 
-std::vector<std::unique_ptr<Source>> Source::Factory(std::unique_ptr<Options> const &options) {
+std::vector<std::unique_ptr<Source>> Source::Factory(std::unique_ptr<Options> const &options,
+                                                     const std::vector<double> &box) {
 
+  /* The sources of each call are numbered from zero, as their options are indexed by that number, even if other
+   * sources are still alive (i.e. of the forward wavefield, while those of the adjoint are created). */
   std::vector<std::unique_ptr<Source>> sources;
+  auto &x = options->SrcLocX(), &y = options->SrcLocY(), &z = options->SrcLocZ();
+  auto inside = [&](const PetscInt i) { return utilities::pointInBox(box, x[i], y[i], z.size() ? z[i] : 0); };
   if ( options->NumberSources() > 0) {
     switch (stype(options->SourceType())) {
 
       case sRicker:
         for (PetscInt i = 0; i < options->NumberSources(); i++) {
-          sources.push_back(std::unique_ptr<Ricker>(new Ricker(options)));
+          if (inside(i)) { sources.push_back(std::unique_ptr<Ricker>(new Ricker(options, i))); }
         }
         return sources;
 
       case sHDF5:
         for (PetscInt i = 0; i < options->NumberSources(); i++) {
-          sources.push_back(std::unique_ptr<SourceHdf5>(new SourceHdf5(options)));
+          if (inside(i)) { sources.push_back(std::unique_ptr<SourceHdf5>(new SourceHdf5(options, i))); }
+        }
+        return sources;
+
+      case sAdjoint:
+        for (PetscInt i = 0; i < options->NumberSources(); i++) {
+          if (inside(i)) { sources.push_back(std::unique_ptr<AdjointSource>(new AdjointSource(options, i))); }
         }
         return sources;
 
@@ -44,13 +67,110 @@ std::vector<std::unique_ptr<Source>> Source::Factory(std::unique_ptr<Options> co
   return sources;
 }
 
-Source::Source(std::unique_ptr<Options> const &options) {
+Source::Source(std::unique_ptr<Options> const &options, const PetscInt num) {
+
+  /* Save this source's number, and count it. */
+  SetNum(num); number++;
+
+  /* Shot this source belongs to, with --simultaneous-shots (options set by hand may not list them). */
+  auto &shots = options->SrcShot();
+  mShot = mNum < shots.size() ? shots[mNum] : 0;
+
+  /* A point force, unless a moment tensor is given. */
+  mMomentTensor = options->SrcMomentTensor(mNum);
+
+  /* Not encoded, unless the options draw an encoding. The shift takes steps once tabulated. */
+  auto &polarity = options->SrcPolarity(), &time_shift = options->SrcTimeShift();
+  mPolarity = mNum < polarity.size() ? polarity[mNum] : 1;
+  mTimeShift = mNum < time_shift.size() ? time_shift[mNum] : 0;
+  mShiftSteps = 0;
+
+  /* Not tabulated yet, and of the forward wavefield. */
+  mForces = NULL;
+  mWavefield = Forward;
+
+}
+
+Source::~Source() {
+
+  --number;
+
+  /* The table is laid out for all of its sources, so it goes with any one of them. */
+  if (std::find(mTableSources.begin(), mTableSources.end(), this) != mTableSources.end()) {
+    for (auto src: mTableSources) { src->mForces = NULL; }
+    mTableSources.clear(); mTableFirst = mTableSteps = mTableWindow = mTableTotal = 0;
+    std::vector<double>().swap(mTable);
+  }
+
+}
+
+Eigen::MatrixXd Source::MomentTensor(const PetscInt num_dim) const {
+  if (mMomentTensor.size() != (num_dim == 3 ? 6 : 3)) {
+    throw std::runtime_error("Source " + std::to_string(mNum) + " has no moment tensor of dimension " +
+                             std::to_string(num_dim) + ".");
+  }
+  Eigen::MatrixXd m(num_dim, num_dim);
+  if (num_dim == 3) {
+    m << mMomentTensor(0), mMomentTensor(5), mMomentTensor(4),
+         mMomentTensor(5), mMomentTensor(1), mMomentTensor(3),
+         mMomentTensor(4), mMomentTensor(3), mMomentTensor(2);
+  } else {
+    m << mMomentTensor(0), mMomentTensor(2),
+         mMomentTensor(2), mMomentTensor(1);
+  }
+  return m;
+}
+
+void Source::tabulate(double *forces, const PetscInt first_step, const PetscInt num_steps, const double dt) {
+  for (PetscInt i = 0; i < num_steps; i++) {
+    Eigen::Map<Eigen::VectorXd>(forces + i * mNumComponents, mNumComponents) =
+        evaluate((first_step + i) * dt, first_step + i);
+  }
+}
+
+void Source::tabulate(const std::vector<Source*> &sources, const PetscInt num_steps, const double dt,
+                      const PetscInt window) {
+
+  /* The sources tabulated before fall back to evaluate (their table goes). */
+  for (auto src: mTableSources) { src->mForces = NULL; }
+
+  /* Each source's window starts at the sum of the sizes of those before it. */
+  mTableWindow = window > 0 ? std::min(window, num_steps) : num_steps;
+  size_t size = 0;
+  for (auto src: sources) { size += mTableWindow * src->mNumComponents; }
+  std::vector<double>(size, 0).swap(mTable);
+  size_t off = 0;
+  for (auto src: sources) {
+    src->mForces = mTable.data() + off;
+    off += mTableWindow * src->mNumComponents;
+  }
+  mTableSources = sources; mTableFirst = 0; mTableTotal = num_steps; mTableDt = dt;
+  for (auto src: sources) { src->mShiftSteps = ShiftSteps(src->mTimeShift, dt); }
+  fillTable();
 
-  /* Increment global number, save this particular one. */
-  SetNum(number++);
+}
 
+void Source::advanceTable(const PetscInt time_idx) {
+  if (mTableSources.empty() || time_idx < 0 || time_idx >= mTableTotal) { return; }
+  if (time_idx >= mTableFirst && time_idx < mTableFirst + mTableSteps) { return; }
+  /* Stepping back in time, the window ends with the step. */
+  mTableFirst = time_idx < mTableFirst ? std::max<PetscInt>(0, time_idx - mTableWindow + 1) : time_idx;
+  fillTable();
 }
 
-Source::~Source() { --number; }
+void Source::fillTable() {
+  /* The last window may be cut short by the end of the run. */
+  mTableSteps = std::min(mTableWindow, mTableTotal - mTableFirst);
+  for (auto src: mTableSources) {
+    /* A shifted source is at rest for its first steps. */
+    const PetscInt first = mTableFirst - src->mShiftSteps, nc = src->mNumComponents;
+    const PetscInt rest = std::min(std::max<PetscInt>(-first, 0), mTableSteps);
+    std::fill(src->mForces, src->mForces + rest * nc, 0.0);
+    if (rest < mTableSteps) { src->tabulate(src->mForces + rest * nc, first + rest, mTableSteps - rest, mTableDt); }
+    if (src->mPolarity != 1) {
+      for (PetscInt i = 0; i < mTableSteps * nc; i++) { src->mForces[i] *= src->mPolarity; }
+    }
+  }
+}
 
 void Source::loadData() {}
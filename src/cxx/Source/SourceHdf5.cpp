@@ -3,14 +3,17 @@
 #include <Source/SourceHdf5.h>
 #include <Utilities/Options.h>
 #include <stdexcept>
+#include <algorithm>
 #include <iostream>
 #include <Utilities/Logging.h>
 
 #include "hdf5.h"
 #include "hdf5_hl.h"
 
+hid_t SourceHdf5::mFileId = -1;
+PetscInt SourceHdf5::mNumOpen = 0;
 
-SourceHdf5::SourceHdf5(std::unique_ptr<Options> const &options): Source(options) {
+SourceHdf5::SourceHdf5(std::unique_ptr<Options> const &options, const PetscInt num): Source(options, num) {
 
   /* Set locations. */
 
@@ -25,27 +28,92 @@ SourceHdf5::SourceHdf5(std::unique_ptr<Options> const &options): Source(options)
   mSourceName = options->SrcName()[Num()];
   mNumTimeSteps = options->NumTimeSteps();
   mNumComponents = options->SrcNumComponents()[Num()];
+
+  /* The dataset is opened by loadData, on the rank the source is attached to. */
+  mSet = -1;
+  mSetRank = 0;
+  mSetSteps = 0;
+}
+
+SourceHdf5::~SourceHdf5() {
+  if (mSet < 0) { return; }
+  H5Dclose(mSet);
+  if (!--mNumOpen) { H5Fclose(mFileId); mFileId = -1; }
 }
 
-Eigen::VectorXd SourceHdf5::fire(const double &time, const PetscInt &time_idx) {
+Eigen::VectorXd SourceHdf5::evaluate(const double &time, const PetscInt &time_idx) {
 
-  Eigen::VectorXd src = source_time_function.row(time_idx);
+  /* Off the table, the step is read by itself. */
+  Eigen::VectorXd src(mNumComponents);
+  read(src.data(), time_idx, 1);
   return src;
 
 }
 
+void SourceHdf5::tabulate(double *forces, const PetscInt first_step, const PetscInt num_steps, const double dt) {
+  read(forces, first_step, num_steps);
+}
 
 void SourceHdf5::loadData() {
 
-  hid_t           file;
-  herr_t          status;
+  if (mSet >= 0) { return; }
+
+  /* The first source of this rank opens the file for all of them. */
+  if (!mNumOpen) {
+    mFileId = H5Fopen(mSourceFileName.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if (mFileId < 0) { throw std::runtime_error("Can't open source file '" + mSourceFileName + "'."); }
+  }
 
-  file = H5Fopen (mSourceFileName.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
-  
   std::string dataset_name = mSourceName + "/data";
-  source_time_function.setZero(mNumTimeSteps,mNumComponents);
-  
-  status = H5LTread_dataset_double(file, dataset_name.c_str(), source_time_function.data());
-  if ( status < 0 ) throw std::runtime_error("Can't read data for source '" + mSourceName + " from file '" + mSourceFileName + "'.");
-  H5Fclose (file);
-}
\ No newline at end of file
+  mSet = H5Dopen2(mFileId, dataset_name.c_str(), H5P_DEFAULT);
+  if (mSet < 0) {
+    if (!mNumOpen) { H5Fclose(mFileId); mFileId = -1; }
+    throw std::runtime_error("Can't read data for source '" + mSourceName + "' from file '" + mSourceFileName + "'.");
+  }
+  ++mNumOpen;
+
+  /* Only the shape is read here, the data a window at a time. */
+  hsize_t dims[2] = {1, 1};
+  hid_t space = H5Dget_space(mSet);
+  mSetRank = H5Sget_simple_extent_ndims(space);
+  if (mSetRank == 1) {
+    H5Sget_simple_extent_dims(space, &dims[1], NULL);
+  } else if (mSetRank == 2) {
+    H5Sget_simple_extent_dims(space, dims, NULL);
+  }
+  H5Sclose(space);
+  if ((mSetRank != 1 && mSetRank != 2) || dims[0] != (hsize_t) mNumComponents) {
+    throw std::runtime_error("Data for source '" + mSourceName + "' must be " + std::to_string(mNumComponents) +
+                             " (num-components) x #steps.");
+  }
+  mSetSteps = dims[1];
+
+}
+
+void SourceHdf5::read(double *forces, const PetscInt first_step, const PetscInt num_steps) {
+
+  loadData();
+  Eigen::Map<Eigen::MatrixXd> out(forces, mNumComponents, num_steps);
+  out.setZero();
+  if (first_step < 0 || (hsize_t) first_step >= mSetSteps) { return; }
+  const hsize_t rows = std::min<hsize_t>(num_steps, mSetSteps - first_step);
+
+  /* A hyperslab of the steps, of all components. */
+  hsize_t start[2] = {0, (hsize_t) first_step}, count[2] = {(hsize_t) mNumComponents, rows};
+  hid_t file_space = H5Dget_space(mSet);
+  H5Sselect_hyperslab(file_space, H5S_SELECT_SET, mSetRank == 1 ? &start[1] : start, NULL,
+                      mSetRank == 1 ? &count[1] : count, NULL);
+  hsize_t size = mNumComponents * rows;
+  hid_t mem_space = H5Screate_simple(1, &size, NULL);
+  mRead.resize(size);
+  herr_t status = H5Dread(mSet, H5T_NATIVE_DOUBLE, mem_space, file_space, H5P_DEFAULT, mRead.data());
+  H5Sclose(mem_space); H5Sclose(file_space);
+  if (status < 0) {
+    throw std::runtime_error("Can't read data for source '" + mSourceName + "' from file '" + mSourceFileName + "'.");
+  }
+
+  /* The file holds the components one after the other, the table the steps. */
+  typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> RowMajorMatrixXd;
+  out.leftCols(rows) = Eigen::Map<RowMajorMatrixXd>(mRead.data(), mNumComponents, rows);
+
+}
@@ -1,5 +1,8 @@
 #include <iostream>
 #include <salvus.h>
+#include <Physics/Scalar.h>
+#include <Physics/Attenuating.h>
+#include <Element/HyperCube/HexP1.h>
 #include "catch.h"
 
 
@@ -21,28 +24,47 @@ TEST_CASE("Test to make sure proper elements are returned.", "[element]") {
   REQUIRE(Element::Factory("quad", {"fluid"}, {}, options)->Name() ==
       "Scalar_TensorQuad_QuadP1");
   REQUIRE(Element::Factory("quad", {"fluid"}, {"boundary_homo_dirichlet"}, options)->Name() ==
-      "HomogeneousDirichlet_Scalar_TensorQuad_QuadP1");
+      "Scalar_TensorQuad_QuadP1");
   REQUIRE(Element::Factory("quad", {"fluid"}, {"2delastic"}, options)->Name() ==
       "SolidToFluid2D_Scalar_TensorQuad_QuadP1");
   REQUIRE(Element::Factory("quad", {"fluid"}, {"2delastic", "boundary_homo_dirichlet"}, options)->Name() ==
-      "HomogeneousDirichlet_SolidToFluid2D_Scalar_TensorQuad_QuadP1");
+      "SolidToFluid2D_Scalar_TensorQuad_QuadP1");
   REQUIRE(Element::Factory("quad", {"2delastic"}, {}, options)->Name() ==
       "Elastic2D_TensorQuad_QuadP1");
   REQUIRE(Element::Factory("quad", {"2delastic"}, {"fluid"}, options)->Name() ==
       "FluidToSolid2D_Elastic2D_TensorQuad_QuadP1");
   REQUIRE(Element::Factory("quad", {"2delastic"}, {"boundary_homo_dirichlet"}, options)->Name() ==
-      "HomogeneousDirichlet_Elastic2D_TensorQuad_QuadP1");
+      "Elastic2D_TensorQuad_QuadP1");
   REQUIRE(Element::Factory("quad", {"2delastic"}, {"fluid", "boundary_homo_dirichlet"}, options)->Name() ==
-      "HomogeneousDirichlet_FluidToSolid2D_Elastic2D_TensorQuad_QuadP1");
+      "FluidToSolid2D_Elastic2D_TensorQuad_QuadP1");
 
   REQUIRE(Element::Factory("hex", {"fluid"}, {}, options)->Name() ==
       "Scalar_TensorHex_HexP1");
   REQUIRE(Element::Factory("hex", {"fluid"}, {"boundary_homo_dirichlet"}, options)->Name() ==
-      "HomogeneousDirichlet_Scalar_TensorHex_HexP1");
+      "Scalar_TensorHex_HexP1");
   REQUIRE(Element::Factory("hex", {"3delastic"}, {}, options)->Name() ==
       "Elastic3D_TensorHex_HexP1");
   REQUIRE(Element::Factory("hex", {"3delastic"}, {"boundary_homo_dirichlet"}, options)->Name() ==
-      "HomogeneousDirichlet_Elastic3D_TensorHex_HexP1");
+      "Elastic3D_TensorHex_HexP1");
+  REQUIRE(Element::Factory("hex", {"fluid"}, {"3delastic"}, options)->Name() ==
+      "SolidToFluid3D_Scalar_TensorHex_HexP1");
+  REQUIRE(Element::Factory("hex", {"3delastic"}, {"fluid", "boundary_homo_dirichlet"}, options)->Name() ==
+      "FluidToSolid3D_Elastic3D_TensorHex_HexP1");
+  REQUIRE_THROWS_AS(Element::Factory("quad", {"fluid"}, {"3delastic"}, options)->Name(), std::runtime_error);
+
+  /* Absorbing boundaries, without coupling. */
+  REQUIRE(Element::Factory("quad", {"fluid"}, {"boundary_absorbing"}, options)->Name() ==
+      "Absorbing_Scalar_TensorQuad_QuadP1");
+  REQUIRE(Element::Factory("quad", {"2delastic"}, {"boundary_absorbing"}, options)->Name() ==
+      "Absorbing_Elastic2D_TensorQuad_QuadP1");
+  REQUIRE(Element::Factory("hex", {"fluid"}, {"boundary_absorbing", "boundary_homo_dirichlet"}, options)->Name() ==
+      "Absorbing_Scalar_TensorHex_HexP1");
+  REQUIRE(Element::Factory("hex", {"3delastic"}, {"boundary_absorbing"}, options)->Name() ==
+      "Absorbing_Elastic3D_TensorHex_HexP1");
+  REQUIRE_THROWS_AS(Element::Factory("quad", {"fluid"}, {"2delastic", "boundary_absorbing"}, options)->Name(),
+                    std::runtime_error);
+  REQUIRE_THROWS_AS(Element::Factory("tri", {"fluid"}, {"boundary_absorbing"}, options)->Name(),
+                    std::runtime_error);
 
   /* Make sure dumb values are not allowed. */
   REQUIRE_THROWS_AS(Element::Factory("hex", {"2delastic"}, {}, options)->Name(),
@@ -67,5 +89,161 @@ TEST_CASE("Test to make sure proper elements are returned.", "[element]") {
   REQUIRE_THROWS_AS(Element::Factory("hex", {"3delastic"}, {"fluid", "boundary", "dog"}, options)->Name(),
                     std::runtime_error);
 
+  /* Attenuation, for fluids and 3d elastic media only. */
+  options->SetAttenuation(PETSC_TRUE, {0.1, 10.0});
+  REQUIRE(Element::Factory("quad", {"fluid"}, {}, options)->Name() == "Attenuating_Scalar_TensorQuad_QuadP1");
+  REQUIRE(Element::Factory("hex", {"3delastic"}, {}, options)->Name() == "Attenuating_Elastic3D_TensorHex_HexP1");
+  REQUIRE(Element::Factory("hex", {"fluid"}, {"boundary_absorbing"}, options)->Name() ==
+      "Absorbing_Attenuating_Scalar_TensorHex_HexP1");
+  REQUIRE_THROWS_AS(Element::Factory("quad", {"2delastic"}, {}, options)->Name(), std::runtime_error);
+  REQUIRE_THROWS_AS(Element::Factory("tri", {"fluid"}, {}, options)->Name(), std::runtime_error);
+  options->SetAttenuation(PETSC_FALSE, {});
+
+}
+
+TEST_CASE("Elements are built from their type codes.", "[element]") {
+
+  PetscOptionsClear(NULL);
+  const char *arg[] = {
+      "salvus_test",
+      "--testing", "true",
+      "--polynomial-order", "1", NULL };
+  char **argv = const_cast<char **> (arg);
+  int argc = sizeof(arg) / sizeof(const char *) - 1;
+  PetscOptionsInsert(NULL, &argc, &argv, NULL);
+  std::unique_ptr<Options> options(new Options);
+  options->setOptions();
+
+  /* Each supported type has a code of its own, which builds the same element as its fields. */
+  std::set<PetscInt> codes;
+  for (auto &shape: {"quad", "hex"}) {
+    for (auto &base: {"fluid", "2delastic", "3delastic"}) {
+      for (auto &couple: std::vector<std::vector<std::string>> {{}, {"boundary_absorbing"}}) {
+        for (bool attenuation: {false, true}) {
+          const PetscInt code = Element::TypeCode(shape, {base}, couple, attenuation);
+          if (code < 0) { continue; }
+          REQUIRE(code < Element::NumTypeCodes());
+          REQUIRE(codes.insert(code).second);
+          options->SetAttenuation(attenuation ? PETSC_TRUE : PETSC_FALSE, {0.1, 10.0});
+          REQUIRE(Element::Factory(code, options)->Name() == Element::Factory(shape, {base}, couple, options)->Name());
+        }
+      }
+    }
+  }
+  options->SetAttenuation(PETSC_FALSE, {});
+  REQUIRE(codes.size() == 14);
+
+  /* Unsupported types have none. */
+  REQUIRE(Element::TypeCode("quad", {"fluid"}, {"2delastic", "boundary_absorbing"}, false) == -1);
+  REQUIRE(Element::TypeCode("quad", {"2delastic"}, {}, true) == -1);
+  REQUIRE(Element::TypeCode("prism", {"fluid"}, {}, false) == -1);
+  REQUIRE_THROWS_AS(Element::Factory(-1, options), std::runtime_error);
+
+}
+
+TEST_CASE("Attenuation mechanisms hold Q constant over the band.", "[element]") {
+
+  /* 1/Q of the fitted mechanisms, for a unit Q, across the band of a decade. */
+  Eigen::VectorXd tau, wgt;
+  Attenuating<Scalar<Hexahedra<HexP1>>>::RelaxationMechanisms(1.0, 10.0, 8, tau, wgt);
+  REQUIRE(wgt.minCoeff() >= 0);
+  for (PetscReal f: {1.0, 2.0, 5.0, 10.0}) {
+    const PetscReal w = 2 * M_PI * f;
+    PetscReal q_inv = 0;
+    for (PetscInt l = 0; l < tau.size(); l++) { q_inv += wgt(l) * w * tau(l) / (1 + w * w * tau(l) * tau(l)); }
+    REQUIRE(std::abs(q_inv - 1) < 0.05);
+  }
+
 }
 
+
+TEST_CASE("Elements of a type are carved out of one pool.", "[element]") {
+
+  PetscOptionsClear(NULL);
+  const char *arg[] = {
+      "salvus_test",
+      "--testing", "true",
+      "--polynomial-order", "1", NULL };
+  char **argv = const_cast<char **> (arg);
+  int argc = sizeof(arg) / sizeof(const char *) - 1;
+  PetscOptionsInsert(NULL, &argc, &argv, NULL);
+  std::unique_ptr<Options> options(new Options);
+  options->setOptions();
+
+  /* Reserved siblings follow each other, one cache line aligned slot apart. */
+  ElemVec elements;
+  elements.push_back(Element::Factory("quad", {"fluid"}, {}, options));
+  elements.back()->reserveSiblings(3);
+  for (int i = 0; i < 3; i++) { elements.push_back(Element::Factory("quad", {"fluid"}, {}, options)); }
+  const char *first = reinterpret_cast<const char *>(elements[1].get());
+  std::ptrdiff_t stride = reinterpret_cast<const char *>(elements[2].get()) - first;
+  REQUIRE(stride > 0);
+  REQUIRE(stride % Pool::Alignment == 0);
+  REQUIRE(reinterpret_cast<const char *>(elements[3].get()) - first == 2 * stride);
+
+  /* Freed slots are reused, and the pool is empty once all elements are freed. */
+  Element *freed = elements[2].get();
+  elements[2].reset();
+  elements[2] = Element::Factory("quad", {"fluid"}, {}, options);
+  REQUIRE(elements[2].get() == freed);
+  REQUIRE(elements[2]->Name() == "Scalar_TensorQuad_QuadP1");
+
+  Pool pool(100);
+  std::vector<void*> objects;
+  for (int i = 0; i < 1000; i++) { objects.push_back(pool.allocate()); }
+  REQUIRE(pool.NumObjects() == 1000);
+  REQUIRE(pool.SlabBytes() >= 1000 * 128);
+  for (auto ptr: objects) { REQUIRE(reinterpret_cast<size_t>(ptr) % Pool::Alignment == 0); pool.deallocate(ptr); }
+  REQUIRE(pool.NumObjects() == 0);
+  REQUIRE(pool.SlabBytes() == 0);
+
+}
+
+TEST_CASE("Work-stealing schedule of the element loop.", "[element]") {
+
+  /* Chunks of 4 of [10, 50), the chunk of [30, 34) ten times as expensive as the others. */
+  std::vector<double> cost(40, 1);
+  for (int i = 20; i < 24; i++) { cost[i] = 10; }
+  WorkStealing schedule;
+  schedule.plan(10, 50, 4, 3, cost);
+  REQUIRE(schedule.NumChunks() == 10);
+
+  /* The most expensive chunk comes first, and the queues are dealt round robin. */
+  REQUIRE(schedule.Queue(0).front() == 5);
+  size_t queued = 0;
+  for (PetscInt t = 0; t < 3; t++) { queued += schedule.Queue(t).size(); }
+  REQUIRE(queued == 10);
+  REQUIRE(schedule.Queue(0).size() == 4);
+  REQUIRE(schedule.Queue(2).size() == 3);
+
+  /* Every index runs once, however the chunks are stolen, and again in the next run. */
+  std::vector<int> runs(50, 0);
+  int oversized = 0;
+  for (int pass = 0; pass < 2; pass++) {
+    schedule.run([&](const PetscInt beg, const PetscInt end, const PetscInt t) {
+      if (end - beg > 4) {
+        #pragma omp atomic
+        oversized++;
+      }
+      for (PetscInt i = beg; i < end; i++) {
+        #pragma omp atomic
+        runs[i]++;
+      }
+    });
+  }
+  REQUIRE(oversized == 0);
+  for (int i = 0; i < 50; i++) { REQUIRE(runs[i] == (i < 10 ? 0 : 2)); }
+
+}
+
+TEST_CASE("Rank-local indices are 32-bit.", "[element]") {
+
+  REQUIRE(sizeof(LocalInt) == 4);
+  REQUIRE_NOTHROW(CheckLocalIndex(std::numeric_limits<LocalInt>::max(), "dofs"));
+  /* Only 64-bit PetscInt holds an index past the range of LocalInt. */
+#if defined(PETSC_USE_64BIT_INDICES)
+  REQUIRE_THROWS_AS(CheckLocalIndex(static_cast<PetscInt>(std::numeric_limits<LocalInt>::max()) + 1, "dofs"),
+                    std::runtime_error);
+#endif
+
+}
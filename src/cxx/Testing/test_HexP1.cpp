@@ -145,6 +145,34 @@ TEST_CASE("test functions in HexP1", "[hexP1]") {
 
   }
 
+  SECTION("Bounding box and trilinear map") {
+
+    HexVtx vtx;
+    vtx <<
+        -2, -2, -2,
+        -3, +2, -2,
+        +3, +3, -4,
+        +2, -2, -2,
+        -1, -3, +2,
+        +1, -2, +2,
+        +2, +2, +2,
+        -2, +2, +2;
+
+    REQUIRE(HexP1::checkBoundingBox(0, 0, 0, vtx));
+    REQUIRE(HexP1::checkBoundingBox(3, 3, -4, vtx));
+    REQUIRE_FALSE(HexP1::checkBoundingBox(3.1, 0, 0, vtx));
+    REQUIRE_FALSE(HexP1::checkBoundingBox(0, 0, 2.1, vtx));
+
+    /* The coefficients reproduce the shape functions, and the inverse transform undoes them. */
+    Eigen::Matrix<PetscReal,8,3> c = HexP1::trilinearCoefficients(vtx);
+    PetscReal r = 0.3, s = -0.6, t = 0.2;
+    Eigen::Matrix<PetscReal,8,1> mono; mono << 1, r, s, t, r * s, r * t, s * t, r * s * t;
+    RealVec3 x = vtx.transpose() * HexP1::interpolateAtPoint(r, s, t);
+    REQUIRE((c.transpose() * mono).isApprox(x, 1e-12));
+    REQUIRE(HexP1::inverseCoordinateTransform(x(0), x(1), x(2), vtx).isApprox(RealVec3(r, s, t), 1e-5));
+
+  }
+
   SECTION("Inverse coordinate transform") {
 
     HexVtx vtx;
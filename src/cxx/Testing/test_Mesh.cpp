@@ -1,5 +1,8 @@
 #include <iostream>
 #include <salvus.h>
+#include <Physics/Scalar.h>
+#include <Physics/Attenuating.h>
+#include <Element/HyperCube/HexP1.h>
 #include "catch.h"
 
 
@@ -79,6 +82,12 @@ TEST_CASE("Unit test mesh", "[mesh]") {
     /* Ensure vertices are correct. */
     QuadVtx vtx; vtx << 0, 0, 25000, 0, 25000, 25000, 0, 25000;
     REQUIRE(mesh->getElementCoordinateClosure(0).isApprox(vtx));
+    REQUIRE(RealMat(mesh->ElementVertexCoordinates(0)).isApprox(vtx));
+    REQUIRE(mesh->ElementCenters().rows() == mesh->NumberElementsLocal());
+    REQUIRE(mesh->ElementCenters().row(0).isApprox(vtx.colwise().mean()));
+    /* Cells of an exodus mesh are the model elements (in order, on a single rank). */
+    REQUIRE(mesh->ModelElement(0) == 0);
+    REQUIRE(mesh->ModelElements().size() == mesh->NumberElementsLocal());
 
     /* Ensure edges are consistent. */
     std::vector<PetscInt> true_edges = { 41, 42, 43, 44 };
@@ -95,6 +104,16 @@ TEST_CASE("Unit test mesh", "[mesh]") {
     REQUIRE(mesh->CouplingFields((1)).size() == 3);
     REQUIRE(mesh->CouplingFields((5)).size() == 4);
 
+    /* The closures extracted at distribution are those of the DMPlex, orientations included. */
+    for (PetscInt e = 0; e < mesh->NumberElementsLocal(); e++) {
+      PetscInt num_dm, num_cached, *dm_pts = NULL;
+      DMPlexGetTransitiveClosure(mesh->DistributedMesh(), e, PETSC_TRUE, &num_dm, &dm_pts);
+      const PetscInt *cached = mesh->ElementClosure(e, num_cached);
+      REQUIRE(num_cached == num_dm);
+      REQUIRE(std::equal(dm_pts, dm_pts + 2 * num_dm, cached));
+      DMPlexRestoreTransitiveClosure(mesh->DistributedMesh(), e, PETSC_TRUE, &num_dm, &dm_pts);
+    }
+
     /* Ensure that we can get the proper physics from neighbour elements. */
     for (auto &f: mesh->CouplingFields(0)) {
       REQUIRE(std::get<1>(f).size() == 1);
@@ -135,6 +154,50 @@ TEST_CASE("Unit test mesh", "[mesh]") {
 
     REQUIRE(mesh->BoundaryPoints() == all_boundaries_true);
 
+    /* The indexed lookup agrees with the listing. */
+    for (auto &bnd: all_boundaries_true) { REQUIRE(mesh->OnSideSet(std::get<1>(bnd), std::get<0>(bnd))); }
+    REQUIRE(!mesh->OnSideSet(0, 0));
+    REQUIRE(!mesh->OnSideSet(16, 1));
+
+    /* Element 0 sits in a corner, element 5 in the interior. */
+    REQUIRE(!mesh->BoundaryEntities(0).empty());
+    REQUIRE(mesh->BoundaryEntities(5).empty());
+
+  }
+
+  SECTION("Absorbing boundaries (2D quad).") {
+
+    PetscOptionsSetValue(NULL, "--mesh-file", "quad_eigenfunction.e");
+    PetscOptionsSetValue(NULL, "--model-file", "quad_eigenfunction.e");
+    PetscOptionsSetValue(NULL, "--absorbing-boundaries", "x0");
+    std::unique_ptr<Options> options(new Options);
+    options->setOptions();
+    auto mesh = Mesh::Factory(options);
+    mesh->read();
+    std::unique_ptr<ExodusModel> model(new ExodusModel(options));
+    model->read();
+    mesh->setupTopology(model, options);
+
+    /* Exactly the elements with a face on x0 absorb, and a unit velocity there is damped. */
+    std::unique_ptr<Problem> problem(Problem::Factory(options));
+    auto elements = problem->initializeElements(mesh, model, options);
+    PetscInt num_absorbing = 0;
+    for (auto &elm: elements) {
+      const bool absorbing = !mesh->AbsorbingFaces(elm->Num()).empty();
+      REQUIRE(elm->Name() == (absorbing ? "Absorbing_Scalar_TensorQuad_QuadP1" : "Scalar_TensorQuad_QuadP1"));
+      if (!absorbing) { continue; }
+      num_absorbing++;
+      REQUIRE(elm->PullElementalFields().size() == 2);
+      Eigen::MatrixXd u(elm->NumIntPnt(), 2);
+      u.col(0).setZero(); u.col(1).setOnes();
+      REQUIRE(elm->computeSurfaceIntegral(u).sum() < 0);
+      u.col(1).setZero();
+      REQUIRE(elm->computeSurfaceIntegral(u).isZero());
+    }
+    REQUIRE(num_absorbing > 0);
+    REQUIRE(num_absorbing < elements.size());
+    PetscOptionsClear(NULL);
+
   }
 
   SECTION("Correctly initialize DM (3D hex).") {
@@ -287,18 +350,21 @@ TEST_CASE("Unit test mesh", "[mesh]") {
     std::unique_ptr<Problem> problem(Problem::Factory(options));
     auto elements = problem->initializeElements(mesh, model, options);
 
-    std::string bnd("HomogeneousDirichlet_ScalarTri_Scalar_TriP1");
-    /* Ensure that the proper element types are pushed back. */
+    /* Boundary elements are labeled, but built as interior ones. */
     std::string normal("ScalarTri_Scalar_TriP1");
     PetscInt cnt = 0; for (auto &e: elements) {
-      if (cnt < 10 || cnt >= 14 && cnt < 18 || cnt >= 22) {
-        REQUIRE(e->Name() == bnd);
-      } else {
-        REQUIRE(e->Name() == normal);
-      }
+      auto couple = mesh->TotalCouplingFields(e->Num());
+      const bool bnd = std::find(couple.begin(), couple.end(), "boundary_homo_dirichlet") != couple.end();
+      REQUIRE(bnd == (cnt < 10 || cnt >= 14 && cnt < 18 || cnt >= 22));
+      REQUIRE(e->Name() == normal);
       cnt++;
     }
 
+    /* Their dofs are zeroed on the global vectors instead. */
+    mesh->setupGlobalDof(elements[0], options);
+    auto fields = problem->initializeGlobalDofs(elements, mesh);
+    REQUIRE(!problem->BoundaryDofs().empty());
+
   }
 
   SECTION("Mesh with at least some multi physics") {
@@ -321,6 +387,74 @@ TEST_CASE("Unit test mesh", "[mesh]") {
 
   }
 
+  SECTION("Synthetic box meshes.") {
+
+    /* Quads, triangles, hexahedra and tetrahedra, perturbed, with a homogeneous model. */
+    std::vector<std::tuple<std::string, bool, std::string, PetscInt>> boxes = {
+        std::make_tuple("3,2", false, "quad", 6), std::make_tuple("3,2", true, "tri", 12),
+        std::make_tuple("2,2,2", false, "hex", 8), std::make_tuple("2,2,2", true, "tet", 48)};
+    for (auto &box: boxes) {
+
+      PetscOptionsSetValue(NULL, "--box-elements", std::get<0>(box).c_str());
+      PetscOptionsSetValue(NULL, "--box-simplex", std::get<1>(box) ? "true" : "false");
+      PetscOptionsSetValue(NULL, "--box-perturbation", "0.2");
+      PetscOptionsSetValue(NULL, "--box-material", "VP:2,QKAPPA:50");
+      std::unique_ptr<Options> options(new Options);
+      options->setOptions();
+      const PetscInt dim = options->BoxElements().size();
+
+      std::unique_ptr<ExodusModel> model(new ExodusModel(options));
+      model->setHomogeneous(dim, "fluid", options->BoxMaterial());
+      auto mesh = Mesh::Factory(options);
+      mesh->readBox(options);
+      mesh->setupTopology(model, options);
+      REQUIRE(mesh->baseElementType() == std::get<2>(box));
+      REQUIRE(mesh->NumberElementsLocal() == std::get<3>(box));
+
+      /* The elements tile the (unit) box, without side sets. */
+      REQUIRE(mesh->ElementCenters().colwise().mean().isApprox(Eigen::RowVectorXd::Constant(dim, 0.5), 0.1));
+      REQUIRE(mesh->BoundaryPoints().empty());
+      REQUIRE(model->getElementalMaterialParameterAtVertex(mesh->ElementCenters().row(0).transpose(), "VP", 1) == 2);
+      REQUIRE(model->getElementType(0) == "fluid");
+
+      std::unique_ptr<Problem> problem(Problem::Factory(options));
+      auto elements = problem->initializeElements(mesh, model, options);
+      REQUIRE(elements.size() == std::get<3>(box));
+
+      /* Dense element stiffness matrices (tensor elements only) give the same stiffness terms. */
+      options->SetDenseElementStiffness(PETSC_TRUE);
+      auto dense = problem->initializeElements(mesh, model, options);
+      options->SetDenseElementStiffness(PETSC_FALSE);
+      for (PetscInt i = 0; i < elements.size(); i++) {
+        Eigen::MatrixXd u = Eigen::MatrixXd::Random(elements[i]->NumIntPnt(), 1);
+        Eigen::MatrixXd sum_factorized = elements[i]->computeStiffnessTerm(u);
+        REQUIRE(dense[i]->computeStiffnessTerm(u).isApprox(sum_factorized));
+      }
+
+      /* Attenuating tensor elements start with the unrelaxed modulus, and then relax. */
+      if (std::get<1>(box)) { continue; }
+      options->SetAttenuation(PETSC_TRUE, {1.0, 10.0});
+      auto attenuating = problem->initializeElements(mesh, model, options);
+      options->SetAttenuation(PETSC_FALSE, {});
+      Eigen::VectorXd tau, wgt;
+      Attenuating<Scalar<Hexahedra<HexP1>>>::RelaxationMechanisms(1.0, 10.0, 1 << dim, tau, wgt);
+      const PetscReal w_ref = 1 / std::sqrt(tau(0) * tau(tau.size() - 1));
+      PetscReal relax = 0;
+      for (PetscInt l = 0; l < tau.size(); l++) { relax += wgt(l) / (1 + w_ref * w_ref * tau(l) * tau(l)); }
+      for (PetscInt i = 0; i < elements.size(); i++) {
+        REQUIRE(attenuating[i]->Name() == "Attenuating_" + elements[i]->Name());
+        attenuating[i]->SetTimeStep(0.01);
+        Eigen::MatrixXd u = Eigen::MatrixXd::Random(elements[i]->NumIntPnt(), 1);
+        Eigen::MatrixXd unrelaxed = elements[i]->computeStiffnessTerm(u) / (1 - relax / 50);
+        REQUIRE(attenuating[i]->computeStiffnessTerm(u).isApprox(unrelaxed));
+        REQUIRE(!attenuating[i]->computeStiffnessTerm(u).isApprox(unrelaxed));
+        REQUIRE(attenuating[i]->CFL_estimate() < elements[i]->CFL_estimate());
+      }
+
+    }
+
+  }
+
   SECTION("Mesh independent functionality.") {
 
     PetscOptionsClear(NULL);
@@ -329,6 +463,27 @@ TEST_CASE("Unit test mesh", "[mesh]") {
     REQUIRE(Mesh::numFieldPerPhysics("3delastic") == 3);
     REQUIRE_THROWS_AS(Mesh::numFieldPerPhysics("4delastic"), std::runtime_error);
 
+    /* Only DMPlex HDF5 files are read in parallel. */
+    REQUIRE(Mesh::isParallelMeshFile("mesh.h5"));
+    REQUIRE(!Mesh::isParallelMeshFile("mesh.e"));
+    REQUIRE(!Mesh::isParallelMeshFile(".h5"));
+
+    /* Consecutive points along the Hilbert curve through a grid are neighbours. */
+    Eigen::MatrixXd grid(64, 2);
+    for (PetscInt i = 0; i < 64; i++) { grid(i, 0) = i % 8; grid(i, 1) = i / 8; }
+    std::vector<unsigned long long> key = Mesh::hilbertKeys(grid);
+    std::vector<PetscInt> order(64);
+    for (PetscInt i = 0; i < 64; i++) { order[i] = i; }
+    std::sort(order.begin(), order.end(), [&](PetscInt a, PetscInt b) { return key[a] < key[b]; });
+    for (PetscInt i = 1; i < 64; i++) {
+      REQUIRE((grid.row(order[i]) - grid.row(order[i - 1])).norm() == Approx(1.0));
+    }
+
+    /* Order resolving the wavelength (1000 m/s at 10 Hz) with 5 points on 100 m and 250 m elements. */
+    REQUIRE(Mesh::resolvingPolynomialOrder(100, 1000, 10, 5) == 5);
+    REQUIRE(Mesh::resolvingPolynomialOrder(250, 1000, 10, 5) == 13);
+    REQUIRE(Mesh::resolvingPolynomialOrder(1, 1000, 10, 5) == 1);
+
   }
 
 }
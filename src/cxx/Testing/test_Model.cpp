@@ -1,5 +1,8 @@
 #include <iostream>
+#include <algorithm>
+#include <thread>
 #include <salvus.h>
+#include <hdf5.h>
 #include "catch.h"
 
 
@@ -45,6 +48,81 @@ TEST_CASE("Unit test model", "[model]") {
 
     }
 
+    SECTION("Look up elements by index") {
+
+      PetscInt elm = 0;
+      std::string type = model->getElementType(elm);
+      PetscScalar vpv = model->getElementalMaterialParameterAtVertex(elm, "VPV", 0);
+      REQUIRE_THROWS_AS(model->getElementType(PetscInt(-1)), std::runtime_error);
+
+      /* Localizing by index keeps the index lookups. */
+      Eigen::MatrixXd centers(1, 2); centers.row(0) = test_center.transpose();
+      model->localize(centers, std::vector<PetscInt> { elm });
+      REQUIRE(model->getElementType(elm) == type);
+      REQUIRE(model->getElementalMaterialParameterAtVertex(elm, "VPV", 0) == Approx(vpv));
+      REQUIRE_THROWS_AS(model->getElementType(PetscInt(1)), std::runtime_error);
+
+    }
+
+    SECTION("Query all parameters of several elements at once") {
+
+      Eigen::MatrixXd centers(2, 2); centers << 0.0, 0.0, 0.0, 0.0;
+      std::vector<PetscInt> elements { -1, 1 };
+      std::vector<std::string> names { "VPV", "VS" };
+      std::vector<PetscReal> values;
+      model->getElementalMaterialParameters(centers, elements, names, 4, values);
+      REQUIRE(values.size() == 2 * 4 * 2);
+      for (PetscInt v = 0; v < 4; v++) {
+        for (PetscInt p = 0; p < 2; p++) {
+          REQUIRE(values[(0 * 4 + v) * 2 + p] ==
+                  Approx(model->getElementalMaterialParameterAtVertex(test_center, names[p], v)));
+          REQUIRE(values[(1 * 4 + v) * 2 + p] ==
+                  Approx(model->getElementalMaterialParameterAtVertex(PetscInt(1), names[p], v)));
+        }
+      }
+      names.push_back("korbinian");
+      REQUIRE_THROWS_AS(model->getElementalMaterialParameters(centers, elements, names, 4, values),
+                        std::runtime_error);
+
+    }
+
+    SECTION("Share the model between the ranks of a node") {
+
+      options->SetNodeSharedModel(PETSC_TRUE);
+      std::unique_ptr<ExodusModel> shared(new ExodusModel(options));
+      shared->read();
+      REQUIRE(shared->getElementType(test_center) == model->getElementType(test_center));
+      for (auto i : {0, 1, 2, 3}) {
+        REQUIRE(shared->getElementalMaterialParameterAtVertex(test_center, "VPV", i) ==
+                Approx(model->getElementalMaterialParameterAtVertex(test_center, "VPV", i)));
+      }
+
+    }
+
+    SECTION("Parse the file on another thread") {
+
+      std::unique_ptr<ExodusModel> parsed(new ExodusModel(options));
+      std::thread parse([&]() { parsed->readFile(); });
+      parse.join();
+      parsed->broadcastFile();
+      REQUIRE(parsed->getElementType(test_center) == model->getElementType(test_center));
+      REQUIRE(parsed->getElementalMaterialParameterAtVertex(test_center, "VPV", 0) == Approx(5800));
+      REQUIRE(parsed->SideSetName(3) == model->SideSetName(3));
+
+    }
+
+    SECTION("Keep the parameters of some elements only") {
+
+      Eigen::MatrixXd centers(1, 2); centers.row(0) = test_center.transpose();
+      model->localize(centers);
+      REQUIRE(model->getElementalMaterialParameterAtVertex(test_center, "VPV", 0) == Approx(5800));
+      REQUIRE(model->getElementType(test_center) == "fluid");
+      REQUIRE_THROWS_AS(model->localize(centers), std::runtime_error);
+      REQUIRE_THROWS_AS(model->getElementType(0), std::runtime_error);
+      REQUIRE_THROWS_AS(model->write("localized.e"), std::runtime_error);
+
+    }
+
     SECTION("Fail because a parameter does not exist.") {
 
       for (auto i : {0, 1, 2, 3}) {
@@ -215,6 +293,24 @@ TEST_CASE("Unit test model", "[model]") {
       REQUIRE(f.good());
     }
 
+    SECTION("Write the elemental variables to HDF5 in parallel") {
+      std::map<std::string,std::vector<PetscReal>> fields;
+      fields["gradient"] = std::vector<PetscReal>();
+      REQUIRE_THROWS_AS(model->writeHdf5("quad_eigenfunction_out.h5", fields), std::runtime_error);
+
+      model->writeHdf5("quad_eigenfunction_out.h5");
+      hid_t file_id = H5Fopen("quad_eigenfunction_out.h5", H5F_ACC_RDONLY, H5P_DEFAULT);
+      hid_t dset_id = H5Dopen(file_id, "/model_element", H5P_DEFAULT);
+      hid_t space_id = H5Dget_space(dset_id);
+      hsize_t num_elm; H5Sget_simple_extent_dims(space_id, &num_elm, NULL);
+      H5Sclose(space_id); H5Dclose(dset_id);
+      std::vector<long long> elements(num_elm);
+      H5LTread_dataset(file_id, "/model_element", H5T_NATIVE_LLONG, elements.data());
+      H5Fclose(file_id);
+      REQUIRE(num_elm > 0);
+      for (hsize_t i = 0; i < num_elm; i++) { REQUIRE(elements[i] == i); }
+    }
+
     SECTION("Write nodal pars in exodus model to disk") {
       std::unique_ptr<ExodusModel> model(new ExodusModel());
       model->setExodusFilename( "nodal_hex.e" );
@@ -225,4 +321,69 @@ TEST_CASE("Unit test model", "[model]") {
       REQUIRE(f.good());
     }
   }
+  SECTION("Static kd-tree matches a brute force search") {
+
+    /* Pseudo-random points and queries in the unit cube. */
+    PetscInt num_pts = 500, num_qry = 200;
+    std::vector<PetscReal> pts(3 * num_pts), qry(3 * num_qry);
+    unsigned int seed = 1;
+    auto random = [&]() { seed = seed * 1103515245 + 12345; return (seed / 65536 % 32768) / 32768.0; };
+    for (auto &p: pts) { p = random(); }
+    for (auto &q: qry) { q = random(); }
+
+    StaticKdTree tree; tree.build(3, pts.data(), num_pts);
+    std::vector<PetscInt> idx(num_qry);
+    tree.nearest(qry.data(), num_qry, idx.data());
+    for (PetscInt q = 0; q < num_qry; q++) {
+      PetscInt best = 0; PetscReal best_d2 = 1e10;
+      for (PetscInt p = 0; p < num_pts; p++) {
+        PetscReal d2 = 0;
+        for (PetscInt d = 0; d < 3; d++) { d2 += std::pow(qry[3 * q + d] - pts[3 * p + d], 2); }
+        if (d2 < best_d2) { best_d2 = d2; best = p; }
+      }
+      REQUIRE(idx[q] == best);
+      REQUIRE(tree.nearest(&qry[3 * q]) == best);
+    }
+
+    /* Points are found exactly. */
+    for (PetscInt p = 0; p < num_pts; p++) { REQUIRE(tree.nearest(&pts[3 * p]) == p); }
+
+    /* Points within a radius. */
+    std::vector<PetscInt> found;
+    for (PetscInt q = 0; q < num_qry; q++) {
+      std::vector<PetscInt> brute;
+      for (PetscInt p = 0; p < num_pts; p++) {
+        PetscReal d2 = 0;
+        for (PetscInt d = 0; d < 3; d++) { d2 += std::pow(qry[3 * q + d] - pts[3 * p + d], 2); }
+        if (d2 <= 0.2 * 0.2) { brute.push_back(p); }
+      }
+      tree.within(&qry[3 * q], 0.2, found);
+      std::sort(found.begin(), found.end());
+      REQUIRE(found == brute);
+    }
+
+  }
+
+  SECTION("Material cache round trip") {
+
+    /* Two of three elements, with two integration points each. */
+    std::string filename = "material_cache_test.bin";
+    std::vector<PetscReal> values { 1, 2, 3, 4 };
+    MaterialCache::write(filename, 42, 3, 2, std::vector<PetscInt> { 2, 0 }, std::vector<std::string> { "VP" },
+                         values);
+
+    MaterialCache cache;
+    REQUIRE(cache.open(filename, 42, 3));
+    REQUIRE(cache.NumPnt() == 2);
+    REQUIRE(cache.parameter(0, "VP")[0] == Approx(3));
+    REQUIRE(cache.parameter(2, "VP")[1] == Approx(2));
+    REQUIRE(cache.parameter(1, "VP") == NULL);
+    REQUIRE(cache.parameter(0, "RHO") == NULL);
+
+    /* The cache belongs to a single model. */
+    REQUIRE(!cache.open(filename, 43, 3));
+    REQUIRE(!cache.open(filename, 42, 4));
+    REQUIRE(cache.empty());
+
+  }
 }
@@ -25,4 +25,436 @@ TEST_CASE("Unit test options", "[options]") {
 
   }
 
+  SECTION("Periodic boundaries") {
+    PetscOptionsClear(NULL);
+    const char *arg[] = {
+        "salvus_test",
+        "--testing", "true",
+        "--periodic-boundaries", "x0,x1,y0,y1",
+        NULL};
+
+    /* Fake setting via command line. */
+    char **argv = const_cast<char **> (arg);
+    int argc = sizeof(arg) / sizeof(const char *) - 1;
+    PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+    std::unique_ptr<Options> options(new Options);
+    options->setOptions();
+    std::vector<std::string> pairs {"x0", "x1", "y0", "y1"};
+    REQUIRE(options->PeriodicBoundaries() == pairs);
+
+    /* Side sets come in pairs, and are constrained on the global vectors of a single level. */
+    PetscOptionsSetValue(NULL, "--periodic-boundaries", "x0,x1,y0");
+    REQUIRE_THROWS_AS(options->setOptions(), std::runtime_error);
+    PetscOptionsSetValue(NULL, "--periodic-boundaries", "x0,x1");
+    PetscOptionsSetValue(NULL, "--hanging-nodes", "true");
+    REQUIRE_THROWS_AS(options->setOptions(), std::runtime_error);
+
+  }
+
+  SECTION("Axisymmetry") {
+    PetscOptionsClear(NULL);
+    const char *arg[] = {
+        "salvus_test",
+        "--testing", "true",
+        "--axisymmetric", "true",
+        NULL};
+
+    /* Fake setting via command line. */
+    char **argv = const_cast<char **> (arg);
+    int argc = sizeof(arg) / sizeof(const char *) - 1;
+    PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+    std::unique_ptr<Options> options(new Options);
+    options->setOptions();
+    REQUIRE(options->Axisymmetric());
+
+    /* Gradients would miss the radial weight. */
+    PetscOptionsSetValue(NULL, "--adjoint-shot-file", "adjoint.toml");
+    REQUIRE_THROWS_AS(options->setOptions(), std::runtime_error);
+    PetscOptionsClear(NULL);
+    PetscOptionsInsert(NULL, &argc, &argv, NULL);
+    PetscOptionsSetValue(NULL, "--observed-data-file", "observed.h5");
+    REQUIRE_THROWS_AS(options->setOptions(), std::runtime_error);
+
+  }
+
+  SECTION("Threads per rank") {
+    PetscOptionsClear(NULL);
+    const char *arg[] = {
+        "salvus_test",
+        "--testing", "true",
+        NULL};
+
+    /* Fake setting via command line. */
+    char **argv = const_cast<char **> (arg);
+    int argc = sizeof(arg) / sizeof(const char *) - 1;
+    PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+    std::unique_ptr<Options> options(new Options);
+    options->setOptions();
+    REQUIRE(options->NumThreads() == 1);
+
+    PetscOptionsSetValue(NULL, "--threads-per-rank", "0");
+    REQUIRE_THROWS_AS(options->setOptions(), std::runtime_error);
+
+  }
+
+  SECTION("Element costs") {
+    PetscOptionsClear(NULL);
+    const char *arg[] = {
+        "salvus_test",
+        "--testing", "true",
+        "--weighted-partitioning", "true",
+        "--element-costs", "3delastic:4.5",
+        NULL};
+
+    /* Fake setting via command line. */
+    char **argv = const_cast<char **> (arg);
+    int argc = sizeof(arg) / sizeof(const char *) - 1;
+    PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+    /* Given costs override the defaults, the others are kept. */
+    std::unique_ptr<Options> options(new Options);
+    options->setOptions();
+    REQUIRE(options->WeightedPartitioning());
+    REQUIRE(options->ElementCosts().at("3delastic") == 4.5);
+    REQUIRE(options->ElementCosts().at("fluid") == 1.0);
+    REQUIRE(options->CouplingCost() == 0.5);
+
+    PetscOptionsSetValue(NULL, "--element-costs", "fluid");
+    REQUIRE_THROWS_AS(options->setOptions(), std::runtime_error);
+
+  }
+
+  SECTION("Time step") {
+    PetscOptionsClear(NULL);
+    const char *arg[] = {
+        "salvus_test",
+        "--testing", "true",
+        "--duration", "1.0",
+        NULL};
+
+    /* Fake setting via command line. */
+    char **argv = const_cast<char **> (arg);
+    int argc = sizeof(arg) / sizeof(const char *) - 1;
+    PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+    /* Without --time-step, the stable time step is chosen later on. */
+    std::unique_ptr<Options> options(new Options);
+    options->setOptions();
+    REQUIRE(options->AutomaticTimeStep());
+    REQUIRE(options->TimeStepSafetyFactor() == 1.0);
+
+    /* Chosen time steps divide the duration into whole steps. */
+    options->SetTimeStep(0.3);
+    REQUIRE(!options->AutomaticTimeStep());
+    REQUIRE(options->NumTimeSteps() == 4);
+    REQUIRE(options->TimeStep() == Approx(0.25));
+
+  }
+
+  SECTION("Restarts") {
+    PetscOptionsClear(NULL);
+    const char *arg[] = {
+        "salvus_test",
+        "--testing", "true",
+        NULL};
+
+    /* Fake setting via command line. */
+    char **argv = const_cast<char **> (arg);
+    int argc = sizeof(arg) / sizeof(const char *) - 1;
+    PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+    std::unique_ptr<Options> options(new Options);
+    options->setOptions();
+    REQUIRE(options->RestartEvery() == 0);
+    REQUIRE(options->RestartFile() == "restart.h5");
+    REQUIRE(options->RestartFrom().empty());
+
+    PetscOptionsSetValue(NULL, "--restart-every", "100");
+    PetscOptionsSetValue(NULL, "--restart-from", "previous.h5");
+    options->setOptions();
+    REQUIRE(options->RestartEvery() == 100);
+    REQUIRE(options->RestartFrom() == "previous.h5");
+
+    PetscOptionsSetValue(NULL, "--restart-every", "-1");
+    REQUIRE_THROWS_AS(options->setOptions(), std::runtime_error);
+
+  }
+
+  SECTION("In-situ staging") {
+    PetscOptionsClear(NULL);
+    const char *arg[] = {
+        "salvus_test",
+        "--testing", "true",
+        NULL};
+
+    /* Fake setting via command line. */
+    char **argv = const_cast<char **> (arg);
+    int argc = sizeof(arg) / sizeof(const char *) - 1;
+    PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+    std::unique_ptr<Options> options(new Options);
+    options->setOptions();
+    REQUIRE(options->StagingStream().empty());
+    REQUIRE(options->StagingEngine() == "SST");
+    REQUIRE(options->StagingEvery() == 1);
+    REQUIRE(options->StagingFields().empty());
+
+    PetscOptionsSetValue(NULL, "--staging-stream", "monitor");
+    PetscOptionsSetValue(NULL, "--staging-engine", "SSC");
+    PetscOptionsSetValue(NULL, "--staging-every", "10");
+    PetscOptionsSetValue(NULL, "--staging-fields", "ux,uy");
+    options->setOptions();
+    REQUIRE(options->StagingStream() == "monitor");
+    REQUIRE(options->StagingEngine() == "SSC");
+    REQUIRE(options->StagingEvery() == 10);
+    REQUIRE(options->StagingFields() == std::vector<std::string>({"ux", "uy"}));
+
+    /* Without ADIOS2, a stream can't be opened. */
+    if (!Staging::Available()) { REQUIRE_THROWS_AS(Staging{options}, std::runtime_error); }
+
+    PetscOptionsSetValue(NULL, "--staging-every", "0");
+    REQUIRE_THROWS_AS(options->setOptions(), std::runtime_error);
+
+  }
+
+  SECTION("Rebalancing") {
+    PetscOptionsClear(NULL);
+    const char *arg[] = {
+        "salvus_test",
+        "--testing", "true",
+        "--rebalance-steps", "20",
+        NULL};
+
+    /* Fake setting via command line. */
+    char **argv = const_cast<char **> (arg);
+    int argc = sizeof(arg) / sizeof(const char *) - 1;
+    PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+    /* The measured partition is handed over through the partition cache, which has a default. */
+    std::unique_ptr<Options> options(new Options);
+    options->setOptions();
+    REQUIRE(options->RebalanceSteps() == 20);
+    REQUIRE(options->PartitionCacheFile() == "rebalance.partition");
+
+    PetscOptionsSetValue(NULL, "--partition-cache-file", "mesh.partition");
+    options->setOptions();
+    REQUIRE(options->PartitionCacheFile() == "mesh.partition");
+
+    /* The nodes are ordered by their first rank unless asked otherwise. */
+    REQUIRE(options->HierarchicalPartitioning() == PETSC_FALSE);
+    REQUIRE(options->NodeOrder() == "rank");
+    PetscOptionsSetValue(NULL, "--hierarchical-partitioning", "true");
+    PetscOptionsSetValue(NULL, "--node-order", "hostname");
+    options->setOptions();
+    REQUIRE(options->HierarchicalPartitioning() == PETSC_TRUE);
+    REQUIRE(options->NodeOrder() == "hostname");
+    PetscOptionsSetValue(NULL, "--node-order", "network");
+    REQUIRE_THROWS_AS(options->setOptions(), std::runtime_error);
+
+  }
+
+  SECTION("Receiver catalogue") {
+    std::unique_ptr<Options> options(new Options);
+    options->SetDimension(2);
+    options->readReceiverCatalogue("# name, x, y\nrec0, 1.5, -2\n\n  rec1 ,3e2,4\r\n", "test.csv");
+    REQUIRE(options->NumberReceivers() == 2);
+    REQUIRE(options->RecNames()[1] == "rec1");
+    REQUIRE(options->RecLocX()[0] == 1.5);
+    REQUIRE(options->RecLocX()[1] == 300);
+    REQUIRE(options->RecLocY()[0] == -2);
+    REQUIRE(options->RecLocZ().empty());
+
+    /* Every line needs a name and a coordinate per dimension. */
+    REQUIRE_THROWS_AS(options->readReceiverCatalogue("rec0, 1, 2, 3\n", "test.csv"), std::runtime_error);
+    REQUIRE_THROWS_AS(options->readReceiverCatalogue("rec0, 1, y\n", "test.csv"), std::runtime_error);
+    options->SetDimension(3);
+    options->readReceiverCatalogue("rec0, 1, 2, 3\n", "test.csv");
+    REQUIRE(options->RecLocZ()[0] == 3);
+  }
+
+  SECTION("Receiver windows") {
+    PetscOptionsClear(NULL);
+    const char *arg[] = {
+        "salvus_test",
+        "--testing", "true",
+        "--dimension", "2",
+        "--duration", "2.0",
+        "--number-of-receivers", "2",
+        "--receiver-names", "rec0,rec1",
+        "--receiver-location-x", "1,2",
+        "--receiver-location-y", "3,4",
+        NULL};
+
+    /* Fake setting via command line. */
+    char **argv = const_cast<char **> (arg);
+    int argc = sizeof(arg) / sizeof(const char *) - 1;
+    PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+    /* Without windows, the shot runs through its duration. */
+    std::unique_ptr<Options> options(new Options);
+    options->setOptions();
+    REQUIRE(options->RecWindowEnd().empty());
+    REQUIRE(options->StopTime() == Approx(2.0));
+
+    /* It stops with the last window, but never after its duration. */
+    PetscOptionsSetValue(NULL, "--receiver-window-end", "0.5,1.25");
+    options->setOptions();
+    REQUIRE(options->RecWindowEnd().size() == 2);
+    REQUIRE(options->StopTime() == Approx(1.25));
+    PetscOptionsSetValue(NULL, "--receiver-window-end", "3");
+    options->setOptions();
+    REQUIRE(options->RecWindowEnd()[1] == Approx(3.0));
+    REQUIRE(options->StopTime() == Approx(2.0));
+
+    /* No windows are left once the receivers are cleared. */
+    options->ClearReceivers();
+    REQUIRE(options->StopTime() == Approx(2.0));
+
+    PetscOptionsSetValue(NULL, "--receiver-window-end", "1,2,3");
+    REQUIRE_THROWS_AS(options->setOptions(), std::runtime_error);
+    PetscOptionsSetValue(NULL, "--receiver-window-end", "0");
+    REQUIRE_THROWS_AS(options->setOptions(), std::runtime_error);
+
+    /* Nor may a gradient stop early. */
+    PetscOptionsSetValue(NULL, "--receiver-window-end", "1");
+    PetscOptionsSetValue(NULL, "--adjoint-shot-file", "adjoint.toml");
+    REQUIRE_THROWS_AS(options->setOptions(), std::runtime_error);
+
+    /* Windows without any receivers are an error, rather than ignored. */
+    PetscOptionsClear(NULL);
+    const char *none[] = {"salvus_test", "--testing", "true", "--dimension", "2", "--duration", "2.0",
+                          "--receiver-window-end", "1", NULL};
+    argv = const_cast<char **> (none);
+    argc = sizeof(none) / sizeof(const char *) - 1;
+    PetscOptionsInsert(NULL, &argc, &argv, NULL);
+    REQUIRE_THROWS_AS(options->setOptions(), std::runtime_error);
+
+  }
+
+  SECTION("Model ensembles") {
+    PetscOptionsClear(NULL);
+    const char *arg[] = {
+        "salvus_test",
+        "--testing", "true",
+        "--ensemble-model-files", "member1.e,member2.e",
+        NULL};
+
+    /* Fake setting via command line. */
+    char **argv = const_cast<char **> (arg);
+    int argc = sizeof(arg) / sizeof(const char *) - 1;
+    PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+    /* The --model-file is the first member, and each member is one of the simultaneous shots. */
+    std::unique_ptr<Options> options(new Options);
+    options->setOptions();
+    std::vector<std::string> files {"member1.e", "member2.e"};
+    REQUIRE(options->EnsembleModelFiles() == files);
+    REQUIRE(options->SimultaneousShots() == 3);
+    PetscOptionsSetValue(NULL, "--simultaneous-shots", "3");
+    options->setOptions();
+    REQUIRE(options->SimultaneousShots() == 3);
+
+    PetscOptionsSetValue(NULL, "--simultaneous-shots", "2");
+    REQUIRE_THROWS_AS(options->setOptions(), std::runtime_error);
+    PetscOptionsSetValue(NULL, "--simultaneous-shots", "3");
+    PetscOptionsSetValue(NULL, "--absorbing-boundaries", "x0");
+    REQUIRE_THROWS_AS(options->setOptions(), std::runtime_error);
+
+  }
+
+  SECTION("Reciprocal shots") {
+    PetscOptionsClear(NULL);
+    const char *arg[] = {
+        "salvus_test",
+        "--testing", "true",
+        "--dimension", "2",
+        "--reciprocal", "true",
+        "--number-of-sources", "2",
+        "--source-type", "ricker",
+        "--source-location-x", "1,2",
+        "--source-location-y", "3,4",
+        "--source-num-components", "1,1",
+        "--source-moment-tensor", "1,0,0,0,1,0",
+        "--ricker-amplitude", "1,2",
+        "--ricker-time-delay", "0.1,0.1",
+        "--ricker-center-freq", "10,10",
+        "--number-of-receivers", "1",
+        "--receiver-names", "rec0",
+        "--receiver-location-x", "5",
+        "--receiver-location-y", "6",
+        "--receiver-file-name", "reciprocal.h5",
+        NULL};
+
+    /* Fake setting via command line. */
+    char **argv = const_cast<char **> (arg);
+    int argc = sizeof(arg) / sizeof(const char *) - 1;
+    PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+    std::unique_ptr<Options> options(new Options);
+    options->setOptions();
+    REQUIRE(options->Reciprocal() == PETSC_TRUE);
+
+    /* A unit force along y at the receiver, and a receiver of the strain at each source. */
+    std::unique_ptr<Options> shot = options->ReciprocalShot(0, 1);
+    REQUIRE(shot->Reciprocal() == PETSC_FALSE);
+    REQUIRE(shot->ReceiverStrain() == PETSC_TRUE);
+    REQUIRE(shot->NumberSources() == 1);
+    REQUIRE(shot->SrcLocX()[0] == 5);
+    REQUIRE(shot->SrcLocY()[0] == 6);
+    REQUIRE(shot->SrcNumComponents()[0] == 2);
+    REQUIRE(shot->SrcRickerAmplitude()[0] == 1);
+    REQUIRE(shot->SrcRickerDirection(0)(0) == 0);
+    REQUIRE(shot->SrcRickerDirection(0)(1) == 1);
+    REQUIRE(shot->SrcMomentTensor(0).size() == 0);
+    REQUIRE(shot->NumberReceivers() == 2);
+    REQUIRE(shot->RecLocX()[1] == 2);
+    REQUIRE(shot->RecLocY()[1] == 4);
+    REQUIRE(shot->RecNames()[0] == "source_0");
+    REQUIRE(shot->ReceiverFileName().empty());
+
+    /* The points of a strain database follow the sources, decimated. */
+    options->readSgtCatalogue("# name, x, y\np0, 7, 8\n", "points.csv");
+    options->SetSgt("sgt.h5", 4, 0);
+    shot = options->ReciprocalShot(0, 0);
+    REQUIRE(shot->NumberReceivers() == 3);
+    REQUIRE(shot->RecNames()[2] == "p0");
+    REQUIRE(shot->RecLocX()[2] == 7);
+    REQUIRE(shot->RecLocY()[2] == 8);
+    REQUIRE(shot->RecDecimation()[0] == 1);
+    REQUIRE(shot->RecDecimation()[2] == 4);
+    REQUIRE(shot->SrcRickerCenterFreq()[0] == 10);
+    REQUIRE_THROWS_AS(options->readSgtCatalogue("p1, 7\n", "points.csv"), std::runtime_error);
+
+    /* The sources share the time function of the reciprocal force. */
+    PetscOptionsSetValue(NULL, "--ricker-center-freq", "10,20");
+    REQUIRE_THROWS_AS(options->setOptions(), std::runtime_error);
+
+    /* Encoded sources fire together, each with a polarity and shift drawn from the seed. */
+    PetscOptionsSetValue(NULL, "--ricker-center-freq", "10,10");
+    PetscOptionsSetValue(NULL, "--reciprocal", "false");
+    PetscOptionsSetValue(NULL, "--source-encoding", "polarity,shift");
+    PetscOptionsSetValue(NULL, "--encoding-max-shift", "0.5");
+    PetscOptionsSetValue(NULL, "--encoding-seed", "7");
+    options->setOptions();
+    REQUIRE(options->SrcPolarity().size() == 2);
+    REQUIRE(options->SrcTimeShift().size() == 2);
+    for (PetscInt i = 0; i < 2; i++) {
+      REQUIRE(std::abs(options->SrcPolarity()[i]) == 1);
+      REQUIRE(options->SrcTimeShift()[i] >= 0);
+      REQUIRE(options->SrcTimeShift()[i] <= 0.5);
+    }
+    std::unique_ptr<Options> again(new Options);
+    again->setOptions();
+    REQUIRE(again->SrcPolarity() == options->SrcPolarity());
+    REQUIRE(again->SrcTimeShift() == options->SrcTimeShift());
+    PetscOptionsSetValue(NULL, "--source-encoding", "phase");
+    REQUIRE_THROWS_AS(options->setOptions(), std::runtime_error);
+    PetscOptionsSetValue(NULL, "--source-encoding", "shift");
+    PetscOptionsSetValue(NULL, "--encoding-max-shift", "0");
+    REQUIRE_THROWS_AS(options->setOptions(), std::runtime_error);
+  }
+
 }
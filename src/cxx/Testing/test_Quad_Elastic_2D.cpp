@@ -84,3 +84,58 @@ TEST_CASE("Test elastic in 2D", "[elastic_2d]") {
 //  REQUIRE(ind == regression_ind);
 
 }
+
+TEST_CASE("Moment tensor source in 2D", "[elastic_2d]") {
+
+  std::string e_file = "elastic_test.e";
+
+  PetscOptionsClear(NULL);
+  const char *arg[] = {
+      "salvus_test",
+      "--testing", "true",
+      "--mesh-file", e_file.c_str(),
+      "--model-file", e_file.c_str(),
+      "--polynomial-order", "4",
+      "--time-step", "1e-2",
+      "--duration", "0.1",
+      "--number-of-sources", "1",
+      "--source-type", "ricker",
+      "--source-location-x", "51000",
+      "--source-location-y", "52000",
+      "--source-num-components", "1",
+      "--source-moment-tensor", "1,2,0.5",
+      "--ricker-amplitude", "100",
+      "--ricker-time-delay", "1.0",
+      "--ricker-center-freq", "0.5",
+      NULL };
+
+  char **argv = const_cast<char **> (arg);
+  int argc = sizeof(arg) / sizeof(const char *) - 1;
+  PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+  std::unique_ptr<Options> options(new Options);
+  options->setOptions();
+
+  std::unique_ptr<Problem>      problem(Problem::Factory(options));
+  std::unique_ptr<ExodusModel>  model(new ExodusModel(options));
+  std::unique_ptr<Mesh>         mesh(Mesh::Factory(options));
+
+  model->read();
+  mesh->read();
+  mesh->setupTopology(model, options);
+  auto elements = problem->initializeElements(mesh, model, options);
+
+  /* The forces of the gradient of a delta function sum to zero, and their first moment is the moment tensor
+   * (times the time function, i.e. the amplitude at the time delay). */
+  Eigen::MatrixXd moment(2, 2); moment << 1, 0.5, 0.5, 2;
+  PetscInt num_found = 0;
+  for (auto &e: elements) {
+    Eigen::MatrixXd force = e->computeSourceTerm(1.0, 0);
+    if (force.isZero()) { continue; }
+    num_found++;
+    REQUIRE(force.colwise().sum().norm() < 1e-8 * force.norm());
+    REQUIRE((e->NodalCoordinates().transpose() * force).isApprox(100 * moment, 1e-8));
+  }
+  REQUIRE(num_found == 1);
+
+}
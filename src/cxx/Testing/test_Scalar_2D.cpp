@@ -1,4 +1,7 @@
+#include <atomic>
+#include <cstdlib>
 #include <iostream>
+#include <fstream>
 #include <Utilities/Types.h>
 #include <Mesh/Mesh.h>
 #include <Model/ExodusModel.h>
@@ -11,10 +14,35 @@
 #include <Element/HyperCube/TensorQuad.h>
 #include <Element/Simplex/Triangle.h>
 #include <Problem/Problem.h>
-#include <Problem/Problem.h>
+#include <Problem/Simulation.h>
+#include <Problem/Fourier.h>
+#include <Problem/RegularGrid.h>
+#include <Problem/Checkpoints.h>
+#include <Problem/BoundaryWavefield.h>
+#include <Problem/HaloWire.h>
+#include <Utilities/Compression.h>
 #include <petscviewerhdf5.h>
 #include "catch.h"
 
+/* Heap allocations of the test, counted while count_allocations is set. With glibc, malloc itself is replaced,
+ * which sees those of Eigen as well as those of operator new. Elsewhere, only operator new is counted. */
+static std::atomic<bool> count_allocations(false);
+static std::atomic<size_t> num_allocations(0);
+#ifdef __GLIBC__
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *malloc(size_t size) noexcept {
+  if (count_allocations) { num_allocations++; }
+  return __libc_malloc(size);
+}
+#else
+void *operator new(size_t size) {
+  if (count_allocations) { num_allocations++; }
+  if (void *p = std::malloc(size)) { return p; }
+  throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept { std::free(p); }
+#endif
+
 template <typename Element>
 class TestPlugin: public Element {
 
@@ -161,6 +189,103 @@ PetscReal runEigenFunctionTest(std::vector<std::unique_ptr<Element>> test_elemen
 }
 
 
+/**
+ * The setup the time stepping tests share: the scalar wave equation on quad_eigenfunction.e at order 3, stepped at
+ * 1e-2 s over 0.1 s. Each test adds options, or overrides these, as pairs of name and value.
+ */
+struct Scalar2D {
+
+  std::unique_ptr<Options> options;
+  std::unique_ptr<Problem> problem;
+  std::unique_ptr<ExodusModel> model;
+  std::unique_ptr<Mesh> mesh;
+  ElemVec elements;
+  FieldDict fields;
+  DM dm;
+  PetscReal time;
+  PetscInt time_idx;
+
+  explicit Scalar2D(const std::vector<std::string> &args): time(0), time_idx(0) {
+
+    PetscOptionsClear(NULL);
+    const char *arg[] = {
+        "salvus_test",
+        "--testing", "true",
+        "--mesh-file", "quad_eigenfunction.e",
+        "--model-file", "quad_eigenfunction.e",
+        "--time-step", "1e-2",
+        "--duration", "1e-1",
+        "--polynomial-order", "3",
+        NULL};
+    char **argv = const_cast<char **> (arg);
+    int argc = sizeof(arg) / sizeof(const char *) - 1;
+    PetscOptionsInsert(NULL, &argc, &argv, NULL);
+    for (size_t i = 0; i + 1 < args.size(); i += 2) {
+      PetscOptionsSetValue(NULL, args[i].c_str(), args[i + 1].c_str());
+    }
+
+    options.reset(new Options);
+    options->setOptions();
+    problem = Problem::Factory(options);
+    model.reset(new ExodusModel(options));
+    mesh = Mesh::Factory(options);
+
+    /* A synthetic box (i.e. of hexahedra or triangles) replaces the files, if one is given. */
+    if (options->BoxElements().empty()) {
+      model->read();
+      mesh->read();
+    } else {
+      model->setHomogeneous(options->BoxElements().size(), options->BoxPhysics(), options->BoxMaterial());
+      mesh->readBox(options);
+    }
+    mesh->setupTopology(model, options);
+    elements = problem->initializeElements(mesh, model, options);
+    mesh->setupGlobalDof(elements[0], options);
+    fields = problem->initializeGlobalDofs(elements, mesh);
+    dm = mesh->DistributedMesh();
+
+  }
+
+  /** Set the displacement to sin(0.1 i) at dof i, at rest (on the local vectors too, with a ghosted state). */
+  void setDisplacement() {
+    PetscInt size; VecGetLocalSize(fields["u"]->mGlb, &size);
+    PetscScalar *val; VecGetArray(fields["u"]->mGlb, &val);
+    for (PetscInt i = 0; i < size; i++) { val[i] = std::sin(0.1 * i); }
+    VecRestoreArray(fields["u"]->mGlb, &val);
+    problem->updateLocalState(fields, dm);
+  }
+
+  /** Take a number of time steps, or those left of the duration. */
+  void step(const PetscInt num = -1) {
+    const PetscInt last = num < 0 ? options->NumTimeSteps() : time_idx + num;
+    for (; time_idx < last; time_idx++) {
+      std::tie(elements, fields) = problem->assembleIntoGlobalDof(
+          std::move(elements), std::move(fields), time, time_idx, dm, mesh->MeshSection(), options);
+      fields = problem->applyInverseMassMatrix(std::move(fields));
+      std::tie(fields, time) = problem->takeTimeStep(std::move(fields), time, options);
+    }
+  }
+
+  /** The displacement of the owned dofs, once brought up to date on the global vector. */
+  std::vector<PetscScalar> displacement() {
+    problem->updateGlobalState(fields, dm);
+    PetscInt size; VecGetLocalSize(fields["u"]->mGlb, &size);
+    const PetscScalar *u; VecGetArrayRead(fields["u"]->mGlb, &u);
+    std::vector<PetscScalar> copy(u, u + size);
+    VecRestoreArrayRead(fields["u"]->mGlb, &u);
+    return copy;
+  }
+
+};
+
+/** The displacement after the whole duration, from sin(0.1 i) at rest (see Scalar2D). */
+static std::vector<PetscScalar> runScalar2D(const std::vector<std::string> &args) {
+  Scalar2D run(args);
+  run.setDisplacement();
+  run.step();
+  return run.displacement();
+}
+
 TEST_CASE("Test point source receiver for scalar equation "
               "in 2D", "[quad_pointsource]") {
 
@@ -235,6 +360,930 @@ TEST_CASE("Test point source receiver for scalar equation "
 
 }
 
+TEST_CASE("Run several shots on the same elements", "[simulation]") {
+
+  std::string e_file = "test_pointsource.e";
+
+  PetscOptionsClear(NULL);
+  const char *arg[] = {
+      "salvus_test",
+      "--testing", "true",
+      "--mesh-file", e_file.c_str(),
+      "--model-file", e_file.c_str(),
+      "--polynomial-order", "4",
+      "--time-step", "1e-2",
+      "--duration", "0.1",
+      "--number-of-sources", "1",
+      "--source-type", "ricker",
+      "--source-location-x", "50000",
+      "--source-location-y", "50000",
+      "--source-num-components", "1",
+      "--ricker-amplitude", "100",
+      "--ricker-time-delay", "0.05",
+      "--ricker-center-freq", "0.5",
+      NULL };
+
+  char **argv = const_cast<char **> (arg);
+  int argc = sizeof(arg) / sizeof(const char *) - 1;
+  PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+  std::unique_ptr<Options> options(new Options);
+  options->setOptions();
+
+  /* The second shot starts from rest again, with the source re-attached, so it matches the first. */
+  std::unique_ptr<Simulation> simulation(new Simulation(options));
+  PetscReal norm[2];
+  for (auto i: {0, 1}) {
+    simulation->run(options);
+    VecNorm(simulation->Fields()["u"]->mGlb, NORM_2, &norm[i]);
+  }
+  REQUIRE(norm[0] > 0);
+  REQUIRE(norm[1] == Approx(norm[0]));
+
+}
+
+TEST_CASE("Run two shots at once", "[simultaneous_shots]") {
+
+  std::string e_file = "test_pointsource.e";
+
+  /* Run with some extra options, and return the norm of each component of u. */
+  auto shot_norm = [&](const std::vector<const char *> &extra, const PetscInt nc, PetscReal *norm) {
+    PetscOptionsClear(NULL);
+    std::vector<const char *> arg {
+        "salvus_test",
+        "--testing", "true",
+        "--mesh-file", e_file.c_str(),
+        "--model-file", e_file.c_str(),
+        "--polynomial-order", "4",
+        "--time-step", "1e-2",
+        "--duration", "0.1",
+        "--source-type", "ricker" };
+    arg.insert(arg.end(), extra.begin(), extra.end());
+    arg.push_back(NULL);
+    char **argv = const_cast<char **> (arg.data());
+    int argc = arg.size() - 1;
+    PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+    std::unique_ptr<Options> options(new Options);
+    options->setOptions();
+    std::unique_ptr<Simulation> simulation(new Simulation(options));
+    simulation->run(options);
+    for (PetscInt c = 0; c < nc; c++) { VecStrideNorm(simulation->Fields()["u"]->mGlb, c, NORM_2, &norm[c]); }
+  };
+
+  /* Reference: a single shot. */
+  PetscReal single;
+  shot_norm({"--number-of-sources", "1",
+             "--source-location-x", "50000",
+             "--source-location-y", "50000",
+             "--source-num-components", "1",
+             "--ricker-amplitude", "100",
+             "--ricker-time-delay", "0.05",
+             "--ricker-center-freq", "0.5"}, 1, &single);
+
+  /* Two shots, with the same source at twice the amplitude in the second shot. Each shot is
+   * one component of the field, and propagates independently. */
+  PetscReal both[2];
+  shot_norm({"--number-of-sources", "2",
+             "--simultaneous-shots", "2",
+             "--source-shot", "0,1",
+             "--source-location-x", "50000,50000",
+             "--source-location-y", "50000,50000",
+             "--source-num-components", "1,1",
+             "--ricker-amplitude", "100,200",
+             "--ricker-time-delay", "0.05,0.05",
+             "--ricker-center-freq", "0.5,0.5"}, 2, both);
+
+  REQUIRE(single > 0);
+  REQUIRE(both[0] == Approx(single));
+  REQUIRE(both[1] == Approx(2 * single));
+
+  /* An ensemble of two members, the second with the material of its own file (here the same), both driven by
+   * the single source. */
+  PetscReal members[2];
+  shot_norm({"--number-of-sources", "1",
+             "--ensemble-model-files", e_file.c_str(),
+             "--source-location-x", "50000",
+             "--source-location-y", "50000",
+             "--source-num-components", "1",
+             "--ricker-amplitude", "100",
+             "--ricker-time-delay", "0.05",
+             "--ricker-center-freq", "0.5"}, 2, members);
+  REQUIRE(members[0] == Approx(single));
+  REQUIRE(members[1] == Approx(single));
+
+}
+
+TEST_CASE("Update the model of existing elements", "[model_update]") {
+
+  std::string e_file = "quad_eigenfunction.e";
+
+  PetscOptionsClear(NULL);
+  const char *arg[] = {
+      "salvus_test",
+      "--testing", "true",
+      "--mesh-file", e_file.c_str(),
+      "--model-file", e_file.c_str(),
+      "--time-step", "1e-2",
+      "--polynomial-order", "3",
+      NULL};
+  char **argv = const_cast<char **> (arg);
+  int argc = sizeof(arg) / sizeof(const char *) - 1;
+  PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+  std::unique_ptr<Options> options(new Options);
+  options->setOptions();
+
+  std::unique_ptr<Problem> problem(Problem::Factory(options));
+  std::unique_ptr<ExodusModel> model(new ExodusModel(options));
+  std::unique_ptr<Mesh> mesh(Mesh::Factory(options));
+
+  model->read();
+  mesh->read();
+  mesh->setupTopology(model, options);
+  auto elements = problem->initializeElements(mesh, model, options);
+  mesh->setupGlobalDof(elements[0], options);
+  auto fields = problem->initializeGlobalDofs(elements, mesh);
+
+  PetscReal mi_norm; VecNorm(fields["mi"]->mGlb, NORM_2, &mi_norm);
+  VecSet(fields["u"]->mGlb, 1.0);
+
+  /* The same material again, read into a new model: the mass matrix is rebuilt, and the fields reset. */
+  std::unique_ptr<ExodusModel> new_model(new ExodusModel(options));
+  new_model->read();
+  fields = problem->updateModel(elements, mesh, new_model, options, std::move(fields));
+
+  PetscReal new_mi_norm, u_norm;
+  VecNorm(fields["mi"]->mGlb, NORM_2, &new_mi_norm);
+  VecNorm(fields["u"]->mGlb, NORM_2, &u_norm);
+  REQUIRE(new_mi_norm == Approx(mi_norm));
+  REQUIRE(u_norm == 0);
+
+}
+
+TEST_CASE("Update the model of hexahedra and triangles", "[model_update]") {
+
+  /* Their stiffness kernels read the material from the assembly plan, which must follow the new model: the
+   * steps after the update are those of a fresh setup with the new material. */
+  for (auto &box: std::vector<std::pair<std::string, std::string>>{{"2,2,2", "false"}, {"3,2", "true"}}) {
+    std::vector<std::string> args = {"--box-elements", box.first, "--box-simplex", box.second,
+                                     "--box-perturbation", "0.2", "--box-material", "VP:1"};
+    Scalar2D updated(args);
+    std::unique_ptr<ExodusModel> new_model(new ExodusModel(updated.options));
+    new_model->setHomogeneous(updated.options->BoxElements().size(), "fluid", {{"VP", 2}});
+    updated.fields = updated.problem->updateModel(updated.elements, updated.mesh, new_model, updated.options,
+                                                  std::move(updated.fields));
+    args.back() = "VP:2";
+    Scalar2D fresh(args);
+
+    updated.setDisplacement(); updated.step(2);
+    fresh.setDisplacement(); fresh.step(2);
+    std::vector<PetscScalar> u = updated.displacement(), ref = fresh.displacement();
+    REQUIRE(u.size() == ref.size());
+    for (size_t i = 0; i < u.size(); i++) { REQUIRE(u[i] == Approx(ref[i])); }
+  }
+
+}
+
+TEST_CASE("Movie of a side set in single precision", "[movie]") {
+
+  std::string e_file = "quad_eigenfunction.e";
+
+  PetscOptionsClear(NULL);
+  const char *arg[] = {
+      "salvus_test",
+      "--testing", "true",
+      "--mesh-file", e_file.c_str(),
+      "--model-file", e_file.c_str(),
+      "--time-step", "1e-2",
+      "--polynomial-order", "3",
+      "--save-movie", "true",
+      "--movie-file-name", "./movie_side_set.h5",
+      "--movie-field", "u",
+      "--movie-side-set", "x0",
+      "--movie-precision", "float",
+      NULL};
+  char **argv = const_cast<char **> (arg);
+  int argc = sizeof(arg) / sizeof(const char *) - 1;
+  PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+  std::unique_ptr<Options> options(new Options);
+  options->setOptions();
+
+  std::unique_ptr<Problem> problem(Problem::Factory(options));
+  std::unique_ptr<ExodusModel> model(new ExodusModel(options));
+  std::unique_ptr<Mesh> mesh(Mesh::Factory(options));
+
+  model->read();
+  mesh->read();
+  mesh->setupTopology(model, options);
+  auto elements = problem->initializeElements(mesh, model, options);
+  mesh->setupGlobalDof(elements[0], options);
+  auto fields = problem->initializeGlobalDofs(elements, mesh);
+
+  /* Two frames. */
+  VecSet(fields["u"]->mGlb, 1.0);
+  problem->saveSolution(0.0, {"u"}, fields, mesh->DistributedMesh());
+  VecSet(fields["u"]->mGlb, 2.0);
+  problem->saveSolution(1.0, {"u"}, fields, mesh->DistributedMesh());
+  problem.reset();
+
+  /* The dofs of a side set all lie on the same edge of the square. */
+  hid_t file_id = H5Fopen("./movie_side_set.h5", H5F_ACC_RDONLY, H5P_DEFAULT);
+  hid_t set_id = H5Dopen2(file_id, "/coordinates", H5P_DEFAULT);
+  hid_t space_id = H5Dget_space(set_id);
+  hsize_t dims[3]; H5Sget_simple_extent_dims(space_id, dims, NULL);
+  H5Sclose(space_id);
+  Eigen::Matrix<double, Eigen::Dynamic, 2, Eigen::RowMajor> crd(dims[0], 2);
+  H5Dread(set_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, crd.data());
+  H5Dclose(set_id);
+  REQUIRE(crd.rows() > 0);
+  bool same_x = (crd.col(0).array() == crd(0, 0)).all(), same_y = (crd.col(1).array() == crd(0, 1)).all();
+  REQUIRE((same_x || same_y));
+
+  /* One row of each field per frame. */
+  set_id = H5Dopen2(file_id, "/u", H5P_DEFAULT);
+  space_id = H5Dget_space(set_id);
+  hsize_t num = crd.rows();
+  H5Sget_simple_extent_dims(space_id, dims, NULL);
+  H5Sclose(space_id);
+  REQUIRE(dims[0] == 2);
+  REQUIRE(dims[1] == num);
+  Eigen::Matrix<float, 2, Eigen::Dynamic, Eigen::RowMajor> u(2, num);
+  H5Dread(set_id, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, u.data());
+  H5Dclose(set_id);
+  H5Fclose(file_id);
+  REQUIRE((u.row(0).array() == 1).all());
+  REQUIRE((u.row(1).array() == 2).all());
+
+}
+
+TEST_CASE("Frequency domain wavefields accumulated while stepping", "[dft]") {
+
+  std::string e_file = "quad_eigenfunction.e";
+
+  PetscOptionsClear(NULL);
+  const char *arg[] = {
+      "salvus_test",
+      "--testing", "true",
+      "--mesh-file", e_file.c_str(),
+      "--model-file", e_file.c_str(),
+      "--time-step", "1e-2",
+      "--polynomial-order", "3",
+      "--dft-frequencies", "1,2",
+      NULL};
+  char **argv = const_cast<char **> (arg);
+  int argc = sizeof(arg) / sizeof(const char *) - 1;
+  PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+  std::unique_ptr<Options> options(new Options);
+  options->setOptions();
+
+  std::unique_ptr<Problem> problem(Problem::Factory(options));
+  std::unique_ptr<ExodusModel> model(new ExodusModel(options));
+  std::unique_ptr<Mesh> mesh(Mesh::Factory(options));
+
+  model->read();
+  mesh->read();
+  mesh->setupTopology(model, options);
+  auto elements = problem->initializeElements(mesh, model, options);
+  mesh->setupGlobalDof(elements[0], options);
+  auto fields = problem->initializeGlobalDofs(elements, mesh);
+
+  PetscInt num_owned; VecGetLocalSize(fields["u"]->mGlb, &num_owned);
+
+  SECTION("One period of a 1 Hz cosine") {
+
+    /* 100 samples over one period: the discrete transform is exact, T / 2 at 1 Hz and zero at 2 Hz. */
+    Fourier dft(options);
+    dft.setup(elements, mesh->DistributedMesh(), mesh->MeshSection(), fields);
+    REQUIRE(dft.Fields() == std::vector<std::string>({"u"}));
+    for (PetscInt i = 1; i <= 100; i++) {
+      VecSet(fields["u"]->mGlb, std::cos(2 * M_PI * i * 1e-2));
+      dft.accumulate(i, i * 1e-2, fields);
+    }
+    REQUIRE(dft.Real("u").rows() == num_owned);
+    REQUIRE((dft.Real("u").col(0).array() - 0.5).abs().maxCoeff() < 1e-12);
+    REQUIRE(dft.Imag("u").cwiseAbs().maxCoeff() < 1e-12);
+    REQUIRE(dft.Real("u").col(1).cwiseAbs().maxCoeff() < 1e-12);
+
+  }
+
+  SECTION("Every other step, within a region") {
+
+    /* Half of the square, sampled half as often. */
+    options->SetDft({1, 2}, 2, {0, 5e4, 0, 1e5});
+    Fourier dft(options);
+    dft.setup(elements, mesh->DistributedMesh(), mesh->MeshSection(), fields);
+    REQUIRE(dft.Real("u").rows() > 0);
+    REQUIRE(dft.Real("u").rows() < num_owned);
+    for (PetscInt i = 1; i <= 100; i++) {
+      VecSet(fields["u"]->mGlb, std::cos(2 * M_PI * i * 1e-2));
+      dft.accumulate(i, i * 1e-2, fields);
+    }
+    REQUIRE((dft.Real("u").col(0).array() - 0.5).abs().maxCoeff() < 1e-12);
+
+    /* Beyond the Nyquist frequency of the sampling. */
+    options->SetDft({30}, 2, {});
+    REQUIRE_THROWS_AS(Fourier{options}, std::runtime_error);
+
+  }
+
+}
+
+TEST_CASE("Wavefields interpolated to a regular grid", "[grid]") {
+
+  std::string e_file = "quad_eigenfunction.e";
+
+  PetscOptionsClear(NULL);
+  const char *arg[] = {
+      "salvus_test",
+      "--testing", "true",
+      "--mesh-file", e_file.c_str(),
+      "--model-file", e_file.c_str(),
+      "--time-step", "1e-2",
+      "--polynomial-order", "3",
+      NULL};
+  char **argv = const_cast<char **> (arg);
+  int argc = sizeof(arg) / sizeof(const char *) - 1;
+  PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+  std::unique_ptr<Options> options(new Options);
+  options->setOptions();
+
+  std::unique_ptr<Problem> problem(Problem::Factory(options));
+  std::unique_ptr<ExodusModel> model(new ExodusModel(options));
+  std::unique_ptr<Mesh> mesh(Mesh::Factory(options));
+
+  model->read();
+  mesh->read();
+  mesh->setupTopology(model, options);
+  auto elements = problem->initializeElements(mesh, model, options);
+  mesh->setupGlobalDof(elements[0], options);
+  auto fields = problem->initializeGlobalDofs(elements, mesh);
+
+  /* A column of points left of the square, and 11 x 11 points on it (including its edges). */
+  options->SetGrid("grid.h5", {-1e4, 0}, {1e4, 1e4}, {12, 11}, 2);
+  {
+    RegularGrid grid(options);
+    grid.setup(elements, mesh->DistributedMesh(), mesh->MeshSection(), fields);
+    REQUIRE(grid.NumInside() == 121);
+    REQUIRE(grid.Due(4));
+    REQUIRE(!grid.Due(3));
+    VecSet(fields["u"]->mGlb, 2);
+    grid.write(0.5, fields);
+  }
+
+  /* The weights of a point sum to one, so a constant field is that constant at every point inside. */
+  std::vector<double> u(11 * 12);
+  hid_t file_id = H5Fopen("grid.h5", H5F_ACC_RDONLY, H5P_DEFAULT);
+  hid_t set_id = H5Dopen(file_id, "/u", H5P_DEFAULT);
+  hid_t space = H5Dget_space(set_id);
+  hsize_t dims[4]; H5Sget_simple_extent_dims(space, dims, NULL);
+  H5Sclose(space);
+  H5Dread(set_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, u.data());
+  H5Dclose(set_id);
+  H5Fclose(file_id);
+  REQUIRE(dims[0] == 1); REQUIRE(dims[1] == 11); REQUIRE(dims[2] == 12); REQUIRE(dims[3] == 1);
+  for (hsize_t j = 0; j < 11; j++) {
+    REQUIRE(std::isnan(u[j * 12]));
+    for (hsize_t i = 1; i < 12; i++) { REQUIRE(std::abs(u[j * 12 + i] - 2) < 1e-10); }
+  }
+
+}
+
+TEST_CASE("Checkpoints of the forward wavefield", "[adjoint]") {
+
+  SECTION("Schedules deliver the states in reverse order") {
+
+    for (PetscInt num_steps: {1, 7, 50, 333}) {
+      for (PetscInt num_slots: {1, 2, 3, 5, 400}) {
+
+        /* Play the schedule, with the state held by each checkpoint. */
+        std::vector<PetscInt> held(num_slots, -1), delivered;
+        PetscInt state = 0, advanced = 0;
+        for (auto &s: Checkpoints::Schedule(num_steps, num_slots)) {
+          switch (s.action) {
+            case Checkpoints::Advance: REQUIRE(s.arg > state); advanced += s.arg - state; state = s.arg; break;
+            case Checkpoints::Store: held[s.arg] = state; break;
+            case Checkpoints::Restore: REQUIRE(held[s.arg] >= 0); state = held[s.arg]; break;
+            case Checkpoints::Deliver: REQUIRE(s.arg == state); delivered.push_back(state); break;
+          }
+        }
+        REQUIRE(delivered.size() == num_steps + 1);
+        for (PetscInt i = 0; i <= num_steps; i++) { REQUIRE(delivered[i] == num_steps - i); }
+
+        /* A checkpoint per state needs no recomputation, and the recomputations grow slowly with the steps. */
+        if (num_slots > num_steps) { REQUIRE(advanced == num_steps); }
+        PetscInt num_times = 1;
+        while (Checkpoints::ReversibleSteps(num_slots, num_times) < num_steps) { num_times++; }
+        REQUIRE(advanced <= num_times * num_steps);
+
+      }
+    }
+
+  }
+
+  SECTION("States are restored from memory and from disk") {
+
+    std::string e_file = "quad_eigenfunction.e";
+
+    PetscOptionsClear(NULL);
+    const char *arg[] = {
+        "salvus_test",
+        "--testing", "true",
+        "--mesh-file", e_file.c_str(),
+        "--model-file", e_file.c_str(),
+        "--time-step", "1e-2",
+        "--duration", "1e-1",
+        "--polynomial-order", "3",
+        NULL};
+    char **argv = const_cast<char **> (arg);
+    int argc = sizeof(arg) / sizeof(const char *) - 1;
+    PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+    std::unique_ptr<Options> options(new Options);
+    options->setOptions();
+
+    std::unique_ptr<Problem> problem(Problem::Factory(options));
+    std::unique_ptr<ExodusModel> model(new ExodusModel(options));
+    std::unique_ptr<Mesh> mesh(Mesh::Factory(options));
+
+    model->read();
+    mesh->read();
+    mesh->setupTopology(model, options);
+    auto elements = problem->initializeElements(mesh, model, options);
+    mesh->setupGlobalDof(elements[0], options);
+    auto fields = problem->initializeGlobalDofs(elements, mesh);
+
+    /* A single checkpoint in memory (u, v and a_), and two on disk. */
+    PetscInt size; VecGetLocalSize(fields["u"]->mGlb, &size);
+    options->SetCheckpoints(1.5 * 3 * size * sizeof(PetscScalar) / (1024 * 1024), 2, ".");
+    Checkpoints checkpoints(options, fields);
+    REQUIRE(checkpoints.NumSlots() == 3);
+
+    for (PetscInt slot = 0; slot < 3; slot++) {
+      VecSet(fields["u"]->mGlb, slot + 1); VecSet(fields["v"]->mGlb, -slot);
+      checkpoints.store(slot, slot, 0.5 * slot, fields);
+    }
+    for (PetscInt slot: {2, 0, 1}) {
+      PetscInt time_idx; PetscReal time, u_max, v_min;
+      checkpoints.restore(slot, time_idx, time, fields);
+      VecMax(fields["u"]->mGlb, NULL, &u_max); VecMin(fields["v"]->mGlb, NULL, &v_min);
+      REQUIRE(time_idx == slot);
+      REQUIRE(time == 0.5 * slot);
+      REQUIRE(u_max == slot + 1);
+      REQUIRE(v_min == -slot);
+    }
+
+    /* Compressed to 10 bits per value, the same budget holds more checkpoints in memory. */
+    options->SetCheckpointTolerance(1e-3);
+    Checkpoints compressed(options, fields);
+    REQUIRE(compressed.NumSlots() > 3);
+    VecSet(fields["u"]->mGlb, 2); VecSetValue(fields["u"]->mGlb, 0, -1, INSERT_VALUES);
+    VecAssemblyBegin(fields["u"]->mGlb); VecAssemblyEnd(fields["u"]->mGlb);
+    compressed.store(compressed.NumSlots() - 1, 1, 0.1, fields);
+    VecSet(fields["u"]->mGlb, 0);
+    PetscInt time_idx; PetscReal time, u_max, u_min;
+    compressed.restore(compressed.NumSlots() - 1, time_idx, time, fields);
+    VecMax(fields["u"]->mGlb, NULL, &u_max); VecMin(fields["u"]->mGlb, NULL, &u_min);
+    REQUIRE(std::abs(u_max - 2) <= 2e-3);
+    REQUIRE(std::abs(u_min + 1) <= 2e-3);
+
+  }
+
+}
+
+TEST_CASE("Error bounded compression of field snapshots", "[compression]") {
+
+  REQUIRE(Compression::Bits(1) == 1);
+  REQUIRE(Compression::Bits(1e-3) == 10);
+  REQUIRE_THROWS_AS(Compression::Bits(0), std::runtime_error);
+
+  /* A smooth block with both signs, and one of zeros. */
+  for (double tolerance: {0.5, 1e-2, 1e-3, 1e-6}) {
+    for (double scale: {0.0, 3.0}) {
+      const size_t num = 1001;
+      std::vector<PetscScalar> val(num), out(num);
+      for (size_t i = 0; i < num; i++) { val[i] = scale * std::sin(0.01 * i) - 0.5 * scale; }
+      std::vector<unsigned char> block(Compression::Bytes(num, tolerance));
+      Compression::compress(val.data(), num, tolerance, block.data());
+      Compression::decompress(block.data(), num, tolerance, out.data());
+      for (size_t i = 0; i < num; i++) { REQUIRE(std::abs(out[i] - val[i]) <= tolerance * 1.5 * scale + 1e-15); }
+    }
+  }
+
+}
+
+TEST_CASE("Halo wire formats round trip", "[halo]") {
+
+  /* Half precision: exact for numbers it holds, subnormals down to 2^-24, and NaNs and infinities kept. */
+  REQUIRE(ToHalf(1) == 0x3c00);
+  REQUIRE(FromHalf(ToHalf(-0.375f)) == -0.375f);
+  REQUIRE(FromHalf(ToHalf(std::ldexp(1.0f, -24))) == std::ldexp(1.0f, -24));
+  REQUIRE(FromHalf(ToHalf(std::ldexp(1.0f, -26))) == 0);
+  REQUIRE(std::isnan(FromHalf(ToHalf(NAN))));
+  REQUIRE(std::isinf(FromHalf(ToHalf(INFINITY))));
+
+  /* A segment of two fields: one of tiny magnitude, and one whose values span many orders of magnitude. */
+  const PetscInt num = 101, width = 2;
+  std::vector<PetscScalar> val(num * width), out(num * width);
+  for (PetscInt i = 0; i < num; i++) {
+    val[i * width] = 1e-20 * std::sin(0.1 * i);
+    val[i * width + 1] = std::pow(10.0, -0.1 * i) * (i % 2 ? -1 : 1);
+  }
+  auto value = [&](const PetscInt i, const PetscInt f) { return val[i * width + f]; };
+  auto put = [&](const PetscInt i, const PetscInt f, const PetscScalar x) { out[i * width + f] = x; };
+
+  /* Each value is off by at most 2^-11 of the largest magnitude of its field, even if that is tiny. */
+  std::vector<char> seg(HalfWire::bytes(num, width));
+  REQUIRE(seg.size() % 8 == 0);
+  HalfWire::pack(seg.data(), num, width, value);
+  HalfWire::unpack(seg.data(), num, width, put);
+  for (PetscInt f = 0; f < width; f++) {
+    PetscScalar max_abs = 0;
+    for (PetscInt i = 0; i < num; i++) { max_abs = std::max(max_abs, std::abs(val[i * width + f])); }
+    for (PetscInt i = 0; i < num; i++) {
+      REQUIRE(std::abs(out[i * width + f] - val[i * width + f]) <= std::ldexp(1.0, -11) * max_abs * (1 + 1e-6));
+    }
+  }
+
+  /* A NaN arrives as a NaN, and leaves the other values of its field alone. */
+  val[10 * width + 1] = NAN;
+  HalfWire::pack(seg.data(), num, width, value);
+  HalfWire::unpack(seg.data(), num, width, put);
+  REQUIRE(std::isnan(out[10 * width + 1]));
+  for (PetscInt i = 0; i < 10; i++) {
+    REQUIRE(std::abs(out[i * width + 1] - val[i * width + 1]) <= std::ldexp(1.0, -11) * (1 + 1e-6));
+  }
+
+  /* Single precision rounds each value on its own, so that tiny ones keep their relative precision. */
+  val[10 * width + 1] = 0;
+  seg.resize(PlainWire<float>::bytes(num, width));
+  PlainWire<float>::pack(seg.data(), num, width, value);
+  PlainWire<float>::unpack(seg.data(), num, width, put);
+  for (PetscInt i = 0; i < num * width; i++) { REQUIRE(std::abs(out[i] - val[i]) <= 1e-7 * std::abs(val[i])); }
+
+}
+
+TEST_CASE("Kernels at the integration points", "[adjoint]") {
+
+  std::string e_file = "quad_eigenfunction.e";
+
+  PetscOptionsClear(NULL);
+  const char *arg[] = {
+      "salvus_test",
+      "--testing", "true",
+      "--mesh-file", e_file.c_str(),
+      "--model-file", e_file.c_str(),
+      "--time-step", "1e-2",
+      "--polynomial-order", "3",
+      NULL};
+  char **argv = const_cast<char **> (arg);
+  int argc = sizeof(arg) / sizeof(const char *) - 1;
+  PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+  std::unique_ptr<Options> options(new Options);
+  options->setOptions();
+
+  std::unique_ptr<Problem> problem(Problem::Factory(options));
+  std::unique_ptr<ExodusModel> model(new ExodusModel(options));
+  std::unique_ptr<Mesh> mesh(Mesh::Factory(options));
+
+  model->read();
+  mesh->read();
+  mesh->setupTopology(model, options);
+  auto elements = problem->initializeElements(mesh, model, options);
+
+  /* Integrated over the element (the lumped mass holds the quadrature weights), the velocity kernel is the
+   * derivative of u+ . K u, which is quadratic in vp. */
+  for (auto &elm: elements) {
+    REQUIRE(elm->KernelNames() == std::vector<std::string> {"VP"});
+    const PetscInt num_pnt = elm->NumIntPnt();
+    RealMat u(num_pnt, 1), u_adj(num_pnt, 1);
+    for (PetscInt i = 0; i < num_pnt; i++) { u(i, 0) = std::sin(0.3 * i); u_adj(i, 0) = std::cos(0.7 * i); }
+    const RealMat kernels = elm->computeKernels(u, u_adj);
+    REQUIRE(kernels.rows() == num_pnt);
+    const RealVec mass = elm->assembleElementMassMatrix();
+    const PetscReal energy = u_adj.col(0).dot(elm->computeStiffnessTerm(u).col(0));
+    REQUIRE(mass.dot(kernels.col(0)) == Approx(2 * energy));
+  }
+
+}
+
+TEST_CASE("Newmark update through vector operations", "[newmark]") {
+
+  /* Any vector type but the standard one takes the update of device vectors, which must match the fused loop
+   * (mpi vectors are on the host, so this runs without a device). */
+  std::vector<PetscReal> norms;
+  for (std::string type: {"standard", "mpi"}) {
+    Scalar2D run({"--vec-type", type});
+    REQUIRE(run.options->FieldVecType() == type);
+    run.setDisplacement();
+    run.step(4);
+    PetscReal norm; VecNorm(run.fields["u"]->mGlb, NORM_2, &norm);
+    norms.push_back(norm);
+  }
+  REQUIRE(norms[1] == Approx(norms[0]));
+
+}
+
+TEST_CASE("Newmark state kept on the ghosted local vectors", "[newmark]") {
+
+  /* The local vectors step the same state as the global ones, once brought up to date, also when the halo is
+   * only exchanged every other step (on overlapping cells, when run in parallel), or through node aware
+   * exchanges. */
+  std::vector<std::vector<PetscScalar>> wavefields;
+  const std::vector<std::vector<std::string>> runs = {
+      {"false", "0", "false"}, {"true", "0", "false"}, {"true", "2", "false"}, {"false", "0", "true"},
+      {"true", "0", "true"}};
+  for (auto &run: runs) {
+    const std::string ghosted = run[0], overlap = run[1], node_aware = run[2];
+    Scalar2D setup({"--ghosted-state", ghosted, "--halo-overlap", overlap, "--node-aware-halo", node_aware});
+
+    /* Without a ghosted state, only the pulled displacement and the pushed acceleration have local vectors. */
+    for (auto &name: setup.fields.Names()) {
+      REQUIRE((setup.fields[name]->mLoc != nullptr) == (ghosted == "true" || name == "u" || name == "a"));
+    }
+
+    setup.setDisplacement();
+    setup.step();
+    wavefields.push_back(setup.displacement());
+  }
+
+  for (size_t r = 1; r < wavefields.size(); r++) {
+    for (size_t i = 0; i < wavefields[0].size(); i++) { REQUIRE(wavefields[r][i] == Approx(wavefields[0][i])); }
+  }
+
+}
+
+TEST_CASE("Mixed precision against double precision", "[newmark]") {
+
+  /* Ten steps with the dense stiffness in double and in single precision. */
+  std::vector<std::vector<PetscScalar>> wavefields;
+  for (std::string mixed: {"false", "true"}) {
+    wavefields.push_back(runScalar2D({"--dense-element-stiffness", "true", "--mixed-precision", mixed}));
+  }
+
+  /* Single precision stiffness is off by its rounding, relative to the largest displacement. */
+  PetscReal max_u = 0, max_diff = 0;
+  for (size_t i = 0; i < wavefields[0].size(); i++) {
+    max_u = std::max<PetscReal>(max_u, std::abs(wavefields[0][i]));
+    max_diff = std::max<PetscReal>(max_diff, std::abs(wavefields[1][i] - wavefields[0][i]));
+  }
+  REQUIRE(max_diff > 0);
+  REQUIRE(max_diff < 1e-5 * max_u);
+
+}
+
+TEST_CASE("Compressed halo against double precision", "[newmark]") {
+
+  /* Ten steps with the halo values sent in double, single and half precision (also node aware). On one rank
+   * there is no halo, and all runs agree exactly (the wire formats are tested on their own above). */
+  std::vector<std::vector<PetscScalar>> wavefields;
+  const std::vector<std::vector<std::string>> runs = {
+      {"double", "false"}, {"single", "false"}, {"half", "false"}, {"half", "true"}};
+  for (auto &run: runs) {
+    wavefields.push_back(runScalar2D({"--halo-precision", run[0], "--node-aware-halo", run[1]}));
+  }
+
+  /* Each exchange is off by the rounding of its precision, relative to the largest value of a message. */
+  const std::vector<PetscReal> tolerance = {0, 1e-5, 1e-2, 1e-2};
+  PetscReal max_u = 0;
+  for (auto v: wavefields[0]) { max_u = std::max<PetscReal>(max_u, std::abs(v)); }
+  for (size_t r = 1; r < wavefields.size(); r++) {
+    PetscReal max_diff = 0;
+    for (size_t i = 0; i < wavefields[0].size(); i++) {
+      max_diff = std::max<PetscReal>(max_diff, std::abs(wavefields[r][i] - wavefields[0][i]));
+    }
+    REQUIRE(max_diff <= tolerance[r] * max_u);
+  }
+
+}
+
+TEST_CASE("Fourth order time stepping against Newmark", "[newmark4]") {
+
+  /* Over 0.1 s, with the second and fourth order schemes at the same step, and a reference with the fourth order
+   * scheme at an eighth of it. All share the spatial discretization, so only the time stepping error remains. */
+  std::vector<std::vector<PetscScalar>> wavefields;
+  const std::vector<std::vector<std::string>> runs = {
+      {"newmark4", "1.25e-3"}, {"newmark", "1e-2"}, {"newmark4", "1e-2"}};
+  for (auto &run: runs) {
+    wavefields.push_back(runScalar2D({"--time-stepping-scheme", run[0], "--time-step", run[1]}));
+  }
+
+  /* Per step, the phase error of a mode is (w dt)^2 / 30 times that of Newmark, and at most 4 / 30 where Newmark
+   * is stable. */
+  std::vector<PetscReal> error(wavefields.size(), 0);
+  for (size_t r = 1; r < wavefields.size(); r++) {
+    for (size_t i = 0; i < wavefields[0].size(); i++) {
+      error[r] = std::max<PetscReal>(error[r], std::abs(wavefields[r][i] - wavefields[0][i]));
+    }
+  }
+  REQUIRE(error[1] > 0);
+  REQUIRE(error[2] < 0.5 * error[1]);
+
+  /* The scheme is only offered where its second assembly per step is sound. */
+  PetscOptionsSetValue(NULL, "--max-time-step-levels", "2");
+  std::unique_ptr<Options> options(new Options);
+  REQUIRE_THROWS_AS(options->setOptions(), std::runtime_error);
+
+}
+
+TEST_CASE("Leapfrog time stepping against Newmark", "[leapfrog]") {
+
+  /* Without damping, both schemes advance the same wavefield, up to round off. */
+  std::vector<std::vector<PetscScalar>> wavefields;
+  for (std::string scheme: {"newmark", "leapfrog"}) {
+    Scalar2D run({"--time-stepping-scheme", scheme});
+
+    /* The leapfrog scheme holds u, u_ and a besides the mass matrix, and Newmark v and a_ in place of u_. */
+    REQUIRE(run.fields.Names().size() == (scheme == "leapfrog" ? 4 : 5));
+
+    run.setDisplacement();
+    run.step();
+    wavefields.push_back(run.displacement());
+  }
+
+  PetscReal error = 0, norm = 0;
+  for (size_t i = 0; i < wavefields[0].size(); i++) {
+    error = std::max<PetscReal>(error, std::abs(wavefields[1][i] - wavefields[0][i]));
+    norm = std::max<PetscReal>(norm, std::abs(wavefields[0][i]));
+  }
+  REQUIRE(norm > 0);
+  REQUIRE(error < 1e-10 * norm);
+
+}
+
+TEST_CASE("Leapfrog wavefields each start from rest", "[leapfrog]") {
+
+  /* The steps of a wavefield from rest, with a checkpoint of its start (u and u_). */
+  Scalar2D run({"--time-stepping-scheme", "leapfrog"});
+  PetscInt size; VecGetLocalSize(run.fields["u"]->mGlb, &size);
+  run.options->SetCheckpoints(1.5 * 2 * size * sizeof(PetscScalar) / (1024 * 1024), 0, ".");
+  Checkpoints checkpoints(run.options, run.fields);
+  run.setDisplacement();
+  checkpoints.store(0, 0, 0, run.fields);
+  run.step();
+  const std::vector<PetscScalar> ref = run.displacement();
+
+  /* Another wavefield of the same problem (i.e. the adjoint one of a gradient) starts from rest as well. */
+  FieldDict other;
+  for (auto &name: run.fields.Names()) {
+    other.insert(std::unique_ptr<field>(new field(name, run.dm, run.fields[name]->mLoc != nullptr)));
+  }
+  VecCopy(run.fields["mi"]->mGlb, other["mi"]->mGlb);
+  if (other["mi"]->mLoc) { VecCopy(run.fields["mi"]->mLoc, other["mi"]->mLoc); }
+  std::swap(run.fields, other);
+  run.time = 0; run.time_idx = 0;
+  run.setDisplacement();
+  run.step();
+  std::vector<PetscScalar> u = run.displacement();
+  for (PetscInt i = 0; i < size; i++) { REQUIRE(u[i] == Approx(ref[i])); }
+
+  /* And so does the first one, restored to its start. */
+  std::swap(run.fields, other);
+  checkpoints.restore(0, run.time_idx, run.time, run.fields);
+  run.problem->updateLocalState(run.fields, run.dm);
+  run.step();
+  u = run.displacement();
+  for (PetscInt i = 0; i < size; i++) { REQUIRE(u[i] == Approx(ref[i])); }
+
+}
+
+TEST_CASE("Static solve with the element stiffness terms", "[static]") {
+
+  /* Without loads, and with the boundary held, the solution is at rest, from any initial displacement. */
+  for (std::string preconditioner: {"jacobi", "none"}) {
+    Scalar2D run({"--homogeneous-dirichlet", "x0,x1,y0,y1", "--static-problem", "true",
+                  "--static-tolerance", "1e-10", "--static-preconditioner", preconditioner});
+    REQUIRE(run.fields.Names().size() == 2);
+
+    run.setDisplacement();
+    PetscReal initial; VecNorm(run.fields["u"]->mGlb, NORM_2, &initial);
+    run.fields = run.problem->solveStatic(std::move(run.fields), 0, run.dm);
+    PetscReal final; VecNorm(run.fields["u"]->mGlb, NORM_2, &final);
+    REQUIRE(initial > 0);
+    REQUIRE(final < 1e-6 * initial);
+
+    /* Nor is it stepped through time. */
+    PetscReal time = 0;
+    REQUIRE_THROWS_AS(run.problem->takeTimeStep(std::move(run.fields), time, run.options), std::runtime_error);
+  }
+
+}
+
+TEST_CASE("Time steps without heap allocations", "[allocation]") {
+
+  /* Point sources and a receiver, so that every term of the element loop is evaluated. */
+  std::string e_file = "test_pointsource.e";
+  Scalar2D run({
+      "--mesh-file", e_file,
+      "--model-file", e_file,
+      "--polynomial-order", "4",
+      "--number-of-sources", "1",
+      "--source-type", "ricker",
+      "--source-location-x", "50000",
+      "--source-location-y", "50000",
+      "--source-num-components", "1",
+      "--ricker-amplitude", "100",
+      "--ricker-time-delay", "0.01",
+      "--ricker-center-freq", "0.5",
+      "--receiver-file-name", "allocations.h5",
+      "--number-of-receivers", "1",
+      "--receiver-names", "rec1",
+      "--receiver-location-x", "90000",
+      "--receiver-location-y", "90000"});
+
+  /* The first steps size the scratch arena and the halo exchanges, after which a step must not allocate. */
+  while (run.time_idx < run.options->NumTimeSteps()) {
+    num_allocations = 0;
+    count_allocations = run.time_idx >= 2;
+    run.step(1);
+    count_allocations = false;
+    if (run.time_idx > 2) { REQUIRE(num_allocations == 0); }
+  }
+
+  /* The views handed out by the elements are those of the elements themselves. */
+  REQUIRE(&run.elements[0]->ClsMap() == &run.elements[1]->ClsMap());
+  REQUIRE(run.elements[0]->VtxCrd().rows() == 4);
+
+}
+
+TEST_CASE("Elements set up by several threads", "[initialize]") {
+
+  /* Each element is the same, whichever thread set it up. */
+  std::vector<ElemVec> setups;
+  for (std::string threads: {"1", "4"}) {
+    Scalar2D run({"--threads-per-rank", threads});
+    setups.push_back(std::move(run.elements));
+  }
+
+  REQUIRE(setups[0].size() == setups[1].size());
+  for (size_t e = 0; e < setups[0].size(); e++) {
+    REQUIRE(setups[1][e]->Num() == setups[0][e]->Num());
+    REQUIRE(setups[1][e]->VtxCrd() == setups[0][e]->VtxCrd());
+    REQUIRE(setups[1][e]->MaterialParameterAtIntPts("VP") == setups[0][e]->MaterialParameterAtIntPts("VP"));
+    REQUIRE(setups[1][e]->CFL_estimate() == setups[0][e]->CFL_estimate());
+  }
+
+}
+
+TEST_CASE("Forward wavefield reconstructed from its absorbing boundaries", "[adjoint]") {
+
+  for (bool absorbing: {false, true}) {
+
+    std::vector<std::string> args;
+    if (absorbing) { args = {"--absorbing-boundaries", "x0,x1,y0,y1"}; }
+    Scalar2D run(args);
+    auto &problem = run.problem; auto &mesh = run.mesh; auto &options = run.options;
+    auto &elements = run.elements; auto &fields = run.fields;
+    DM dm = run.dm;
+
+    /* A smooth displacement, at rest. */
+    run.setDisplacement();
+    BoundaryWavefield boundary(mesh, options, fields);
+    REQUIRE(boundary.Dofs().empty() == !absorbing);
+
+    /* Four steps forward, keeping the state after the first. */
+    const PetscReal dt = options->TimeStep();
+    std::vector<Vec> state;
+    while (run.time_idx < 4) {
+      boundary.record(run.time_idx, fields);
+      run.step(1);
+      if (run.time_idx == 1) {
+        for (auto &name: Checkpoints::StateFields(fields)) {
+          Vec copy; VecDuplicate(fields[name]->mGlb, &copy); VecCopy(fields[name]->mGlb, copy);
+          state.push_back(copy);
+        }
+      }
+    }
+
+    /* And three back. */
+    PetscReal &time = run.time;
+    for (PetscInt time_idx = run.time_idx; time_idx > 1; time_idx--) {
+      fields = problem->rewindDisplacement(std::move(fields));
+      std::tie(elements, fields) = problem->assembleIntoGlobalDof(
+          std::move(elements), std::move(fields), time - 2 * dt, time_idx - 2, dm, mesh->MeshSection(), options);
+      fields = problem->applyInverseMassMatrix(std::move(fields));
+      std::tie(fields, time) = problem->takeTimeStepBack(std::move(fields), time, options);
+      boundary.impose(time_idx - 1, fields);
+    }
+    REQUIRE(time == Approx(dt));
+
+    PetscReal u_norm; VecNorm(state[0], NORM_2, &u_norm);
+    auto names = Checkpoints::StateFields(fields);
+    for (size_t i = 0; i < names.size(); i++) {
+      PetscReal error;
+      VecAXPY(state[i], -1, fields[names[i]]->mGlb); VecNorm(state[i], NORM_2, &error);
+      REQUIRE(error < 1e-8 * u_norm);
+      VecDestroy(&state[i]);
+    }
+
+  }
+
+}
+
 TEST_CASE("Test analytic eigenfunction solution for scalar "
               "equation in 2D with quadrilateral", "[quad_eigenfunction]") {
 
@@ -292,7 +1341,7 @@ TEST_CASE("Test analytic eigenfunction solution for scalar "
 
     l3->setupEigenfunctionTest(mesh, options, problem, fields);
 
-    /* TODO: How does this work?? Static cast magic? Where is the HomogeneousDirichlet? */
+    /* Homogeneous Dirichlet boundaries are enforced on the global dofs (see Problem::initializeBoundaryDofs). */
     /* Now we have a class with testing, which is still really an element :) */
     test_elements.emplace_back(static_cast<test_insert_quadP1*>(l3));
 
@@ -378,3 +1427,62 @@ TEST_CASE("Test analytic eigenfunction solution for scalar "
 
 }
 
+
+TEST_CASE("Element loop timed element by element", "[initialize]") {
+
+  Scalar2D run({"--element-timing-every", "2"});
+  REQUIRE(run.options->ElementTimingEvery() == 2);
+
+  /* Four steps, of which two are timed. Every element takes some time. */
+  run.step(4);
+  std::vector<PetscReal> seconds = run.problem->ElementSeconds();
+  REQUIRE(seconds.size() == run.elements.size());
+  for (auto &elm: run.elements) { REQUIRE(seconds[elm->Num()] > 0); }
+
+  /* The report starts anew. */
+  run.problem->reportElementTiming(run.dm, "");
+  seconds = run.problem->ElementSeconds();
+  REQUIRE(*std::max_element(seconds.begin(), seconds.end()) == 0);
+
+}
+
+TEST_CASE("Halo traffic report", "[initialize]") {
+
+  Scalar2D run({"--halo-report-file", "halo_report.txt"});
+  REQUIRE(run.options->HaloReportFile() == "halo_report.txt");
+  run.step(2);
+  run.problem->reportHalo(run.dm, 2, run.options->HaloReportFile());
+
+  /* A single rank owns all dofs, and sends nothing. */
+  std::ifstream in("halo_report.txt");
+  REQUIRE(in.good());
+  std::string line;
+  std::getline(in, line); REQUIRE(line == "# Halo exchange of 1 ranks over 2 step(s).");
+  std::getline(in, line);
+  PetscInt r; double neighbours, owned, shared, ghosts, sent, received, waited;
+  in >> r >> neighbours >> owned >> shared >> ghosts >> sent >> received >> waited;
+  REQUIRE(r == 0);
+  REQUIRE(neighbours == 0);
+  REQUIRE(owned > 0);
+  REQUIRE(shared == 0);
+  REQUIRE(ghosts == 0);
+  REQUIRE(sent == 0);
+  REQUIRE(received == 0);
+  std::getline(in, line); std::getline(in, line);
+  REQUIRE(line[0] == '#');
+  std::getline(in, line); REQUIRE(line == "0");
+
+}
+
+TEST_CASE("Field dictionary lookups by name", "[fields]") {
+
+  /* Names of no registered field are simply not there, but may not be accessed. */
+  FieldDict fields;
+  REQUIRE_FALSE(fields.count("u"));
+  REQUIRE_FALSE(fields.count(FieldId::u));
+  REQUIRE_FALSE(fields.count("not_a_field"));
+  REQUIRE_THROWS_AS(fields["not_a_field"], std::runtime_error);
+  REQUIRE(FieldIdFromName("u") == FieldId::u);
+  REQUIRE_THROWS_AS(FieldIdFromName("not_a_field"), std::runtime_error);
+
+}
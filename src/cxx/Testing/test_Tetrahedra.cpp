@@ -163,3 +163,48 @@ TEST_CASE("test closure mapping tetrahedra","[tet/closure]") {
   
   
 }
+
+TEST_CASE("test reference stiffness tetrahedra","[tet/stiffness]") {
+
+  PetscOptionsClear(NULL);
+  const char *arg[] = {
+    "salvus_test",
+    "--testing", "true",
+    "--polynomial-order", "3", NULL};
+  char **argv = const_cast<char **> (arg);
+  int argc = sizeof(arg) / sizeof(const char *) - 1;
+  PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+  std::unique_ptr<Options> options(new Options);
+  options->setOptions();
+
+  Eigen::Matrix<double,4,3> vtx;
+  vtx << 0.1, 0.2, 0.0, 1.3, -0.1, 0.2, 0.4, 0.9, -0.1, 0.3, 0.4, 1.1;
+
+  /* The element matrix, and the physical derivative operators it is built from. */
+  Tetrahedra<TetP1> dense(options);
+  dense.SetVtxCrd(vtx);
+  RealVec vp2 = RealVec::LinSpaced(dense.NumIntPnt(), 1.0, 2.0);
+  RealMat stiffness = dense.buildStiffnessMatrix(vp2);
+  REQUIRE(!dense.ReferenceStiffness());
+
+  /* Only the Jacobian, and the stacked reference derivatives. */
+  options->SetSimplexReferenceStiffness(PETSC_TRUE);
+  Tetrahedra<TetP1> reference(options);
+  reference.SetVtxCrd(vtx);
+  reference.precomputeElementTerms();
+  REQUIRE(reference.ReferenceStiffness());
+  REQUIRE(reference.OperatorBytes() == 0);
+
+  /* The stiffness as the physics applies it: gradient, material, gradient of the test functions. */
+  RealVec u = RealVec::LinSpaced(dense.NumIntPnt(), -1.0, 3.0).array().sin();
+  RealVec expected = stiffness * u;
+  for (auto elm: {&dense, &reference}) {
+    RealMat grad = elm->computeGradient(u);
+    REQUIRE((grad - dense.computeGradient(u)).norm() < 1e-10 * grad.norm());
+    for (int i = 0; i < grad.rows(); i++) { grad.row(i) *= vp2(i); }
+    RealVec stiff = elm->applyGradTestAndIntegrate(grad);
+    REQUIRE((stiff - expected).norm() < 1e-10 * expected.norm());
+  }
+
+}
@@ -10,6 +10,7 @@
 #include <petscviewerhdf5.h>
 #include <Element/Simplex/Triangle.h>
 #include <Element/Simplex/TriP1.h>
+#include <Element/ElementBatch.h>
 
 #include <stdexcept>
 
@@ -134,3 +135,53 @@ TEST_CASE("test closure mapping triangle","[tri/closure]") {
   
   
 }
+
+TEST_CASE("test reference stiffness triangle","[tri/stiffness]") {
+
+  PetscOptionsClear(NULL);
+  const char *arg[] = {
+    "salvus_test",
+    "--testing", "true",
+    "--polynomial-order", "3", NULL};
+  char **argv = const_cast<char **> (arg);
+  int argc = sizeof(arg) / sizeof(const char *) - 1;
+  PetscOptionsInsert(NULL, &argc, &argv, NULL);
+
+  std::unique_ptr<Options> options(new Options);
+  options->setOptions();
+
+  Eigen::Matrix<double,3,2> vtx;
+  vtx << 0.1, 0.2, 1.3, -0.1, 0.4, 0.9;
+
+  /* Dense matrix, with a varying velocity. */
+  Triangle<TriP1> dense(options);
+  dense.SetVtxCrd(vtx);
+  RealVec vp = RealVec::LinSpaced(dense.NumIntPnt(), 1.0, 2.0);
+  RealMat stiffness = dense.buildStiffnessMatrix(vp);
+
+  /* Geometric coefficients only. The material is passed at the GLL points. */
+  options->SetSimplexReferenceStiffness(PETSC_TRUE);
+  Triangle<TriP1> reference(options);
+  reference.SetVtxCrd(vtx);
+  reference.precomputeElementTerms();
+  REQUIRE(reference.ReferenceStiffness());
+
+  RealVec u = RealVec::LinSpaced(reference.NumIntPnt(), -1.0, 3.0).array().sin();
+  RealVec vp_squared = vp.array().square();
+  RealVec stiff = reference.applyReferenceStiffness(u, vp_squared);
+  REQUIRE((stiff - stiffness * u).norm() < 1e-10 * (stiffness * u).norm());
+
+  /* All lanes give the same result. */
+  const int L = ELEMENT_SIMD_LANES;
+  const int n = reference.NumIntPnt();
+  RealVec geo(3 * L), coef(n * L), ul(n * L), out(n * L), work(2 * n * L);
+  for (int l = 0; l < L; l++) {
+    geo.segment(3 * l, 3) = reference.ReferenceStiffnessCoefficients();
+    for (int i = 0; i < n; i++) { coef(L * i + l) = vp_squared(i); ul(L * i + l) = u(i); }
+  }
+  reference.referenceStiffnessLanes<L>(geo.data(), coef.data(), ul.data(), out.data(), work.data());
+  for (int l = 0; l < L; l++) {
+    for (int i = 0; i < n; i++) { REQUIRE(out(L * i + l) == Approx(stiff(i))); }
+  }
+
+}
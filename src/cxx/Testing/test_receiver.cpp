@@ -47,13 +47,21 @@ TEST_CASE("Test receiver functionality", "[receiver]") {
         REQUIRE(receivers[i]->LocZ() == z[i]);
       }
 
-      /* Test that we're recording something. */
+      /* Test that we're recording something, by name and by registered index (into the preallocated
+       * store, which drops samples past its size). */
       RealVec trial_vals = RealVec::LinSpaced(10, 1, 10);
+      receivers[0]->registerFields({"test_2"});
+      Receiver::allocateStore({receivers[0].get()}, 10);
       for (PetscInt i = 0; i < trial_vals.size(); i++) {
         receivers[0]->record(trial_vals[i] + 0, "test_0");
         receivers[0]->record(trial_vals[i] + 1, "test_1");
         receivers[1]->record(trial_vals[i] + 2, "test_0");
+        receivers[0]->record(trial_vals[i] + 3, 0);
       }
+      receivers[0]->record(0, 0);
+      size_t num_samples;
+      REQUIRE(receivers[0]->Samples("test_2", num_samples)[9] == trial_vals[9] + 3);
+      REQUIRE(num_samples == 10);
 
       /* Write. */
       for (auto &rec: receivers) {
@@ -81,6 +89,11 @@ TEST_CASE("Test receiver functionality", "[receiver]") {
                               data.data());
       REQUIRE(data.isApprox(Eigen::VectorXf::LinSpaced(10, 2, 11)));
       H5Dclose(dset_id);
+      dset_id = H5Dopen2(groupid, "/rec1/test_2", H5P_DEFAULT);
+      status = H5Dread(dset_id, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT,
+                       data.data());
+      REQUIRE(data.isApprox(Eigen::VectorXf::LinSpaced(10, 4, 13)));
+      H5Dclose(dset_id);
       H5Gclose(groupid);
       groupid = H5Gopen(fileid, "/rec2", H5P_DEFAULT);
       dset_id = H5Dopen2(groupid, "/rec2/test_0", H5P_DEFAULT);
@@ -98,6 +111,210 @@ TEST_CASE("Test receiver functionality", "[receiver]") {
 
     }
 
+    SECTION("stream") {
+
+      unique_ptr<Options> options(new Options);
+      options->SetDimension(3);
+      options->setOptions();
+      auto receivers = Receiver::Factory(options);
+
+      for (bool async: {false, true}) {
+
+        /* Room for 4 samples, written out every 4 samples (and the rest on close), from this thread or another. */
+        receivers[0]->registerFields({"u"});
+        receivers[1]->registerFields({"u"});
+        Receiver::allocateStore({receivers[0].get(), receivers[1].get()}, 4);
+        ReceiverHdf5::openStream("test_receiver_stream.h5", 2, 10, {}, async, false);
+        for (PetscInt i = 0; i < 10; i++) {
+          receivers[0]->record(i, 0);
+          receivers[1]->record(-i, 0);
+          if (Receiver::StorePending() == 4) { ReceiverHdf5::writeStream(); }
+        }
+        ReceiverHdf5::closeStream();
+
+        /* One row per receiver. */
+        Eigen::Matrix<float, 2, 10, Eigen::RowMajor> data;
+        hid_t fileid = H5Fopen("test_receiver_stream.h5", H5F_ACC_RDONLY, H5P_DEFAULT);
+        hid_t dset_id = H5Dopen2(fileid, "/u", H5P_DEFAULT);
+        H5Dread(dset_id, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data());
+        H5Dclose(dset_id);
+        H5Fclose(fileid);
+        REQUIRE(data.row(0).isApprox(Eigen::RowVectorXf::LinSpaced(10, 0, 9)));
+        REQUIRE(data.row(1).isApprox(Eigen::RowVectorXf::LinSpaced(10, 0, -9)));
+
+      }
+
+      /* A resumed run continues the rows of the file from the samples written before. */
+      receivers[0]->registerFields({"u"});
+      receivers[1]->registerFields({"u"});
+      Receiver::allocateStore({receivers[0].get(), receivers[1].get()}, 4);
+      ReceiverHdf5::openStream("test_receiver_stream.h5", 2, 10, {}, false, false);
+      for (PetscInt i = 0; i < 6; i++) { receivers[0]->record(i, 0); receivers[1]->record(-i, 0); }
+      ReceiverHdf5::writeStream();
+      const std::vector<hsize_t> written = ReceiverHdf5::StreamRowWritten();
+      ReceiverHdf5::closeStream();
+      REQUIRE(written == std::vector<hsize_t>({6, 6}));
+
+      Receiver::allocateStore({receivers[0].get(), receivers[1].get()}, 4);
+      ReceiverHdf5::openStream("test_receiver_stream.h5", 2, 10, {}, false, true);
+      ReceiverHdf5::SetStreamRowWritten(written);
+      for (PetscInt i = 6; i < 10; i++) { receivers[0]->record(i, 0); receivers[1]->record(-i, 0); }
+      ReceiverHdf5::closeStream();
+
+      Eigen::Matrix<float, 2, 10, Eigen::RowMajor> data;
+      hid_t fileid = H5Fopen("test_receiver_stream.h5", H5F_ACC_RDONLY, H5P_DEFAULT);
+      hid_t dset_id = H5Dopen2(fileid, "/u", H5P_DEFAULT);
+      H5Dread(dset_id, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data());
+      H5Dclose(dset_id);
+      H5Fclose(fileid);
+      REQUIRE(data.row(0).isApprox(Eigen::RowVectorXf::LinSpaced(10, 0, 9)));
+      REQUIRE(data.row(1).isApprox(Eigen::RowVectorXf::LinSpaced(10, 0, -9)));
+
+    }
+
+  }
+
+  SECTION("decimation") {
+
+    unique_ptr<Options> options(new Options);
+    options->SetDimension(3);
+    options->setOptions();
+    options->SetRecDecimation({4, 4});
+    auto receivers = Receiver::Factory(options);
+
+    /* A constant, and the input's Nyquist frequency, over 201 steps. */
+    receivers[0]->registerFields({"u"});
+    receivers[1]->registerFields({"u"});
+    std::vector<Receiver*> recs{receivers[0].get(), receivers[1].get()};
+    Receiver::allocateStore(recs, Receiver::StoreCapacityFor(recs, 201));
+    for (PetscInt i = 0; i < 201; i++) {
+      receivers[0]->record(1, 0);
+      receivers[1]->record(i % 2 ? -1 : 1, 0);
+    }
+
+    /* Outputs lag by the filter's half width (8 outputs), and are taken every 4 steps. Away from the start, the
+     * constant passes and the Nyquist frequency is removed. */
+    size_t num;
+    const float *dc = receivers[0]->Samples("u", num);
+    REQUIRE(num == (200 - 8 * 4) / 4 + 1);
+    const float *nyquist = receivers[1]->Samples("u", num);
+    for (size_t k = 8; k < num; k++) {
+      REQUIRE(dc[k] == Approx(1).epsilon(1e-3));
+      REQUIRE(std::abs(nyquist[k]) < 1e-3);
+    }
+
+    /* A run resumed from the state of the filters (see Restart) takes the same outputs as one which went on. */
+    auto run = [&](const PetscInt first, const PetscInt last) {
+      for (PetscInt i = first; i < last; i++) {
+        receivers[0]->record(std::sin(0.1 * i), 0);
+        receivers[1]->record(1, 0);
+      }
+    };
+    receivers[0]->registerFields({"u"});
+    receivers[1]->registerFields({"u"});
+    Receiver::allocateStore(recs, Receiver::StoreCapacityFor(recs, 201));
+    run(0, 100);
+    std::vector<double> state = Receiver::FilterState();
+    size_t before; receivers[0]->Samples("u", before);
+    run(100, 201);
+    const float *went_on = receivers[0]->Samples("u", num);
+    std::vector<float> expected(went_on + before, went_on + num);
+
+    receivers[0]->registerFields({"u"});
+    receivers[1]->registerFields({"u"});
+    Receiver::allocateStore(recs, Receiver::StoreCapacityFor(recs, 201));
+    Receiver::SetFilterState(state);
+    run(100, 201);
+    const float *resumed = receivers[0]->Samples("u", num);
+    REQUIRE(std::vector<float>(resumed, resumed + num) == expected);
+    REQUIRE_THROWS_AS(Receiver::SetFilterState({}), std::runtime_error);
+
+  }
+
+  SECTION("gradient fields") {
+
+    unique_ptr<Options> options(new Options);
+    options->SetDimension(3);
+    options->setOptions();
+    options->SetReceiverStress(PETSC_TRUE);
+    options->SetReceiverRotation(PETSC_TRUE);
+    auto receivers = Receiver::Factory(options);
+
+    /* Only the quantities asked for, in the order the physics records them. */
+    REQUIRE(receivers[0]->RecordsGradient());
+    REQUIRE(!receivers[0]->RecordsStrain());
+    REQUIRE(receivers[0]->GradientFields(3) ==
+            std::vector<std::string>({"sxx", "syy", "szz", "syz", "sxz", "sxy", "rx", "ry", "rz"}));
+    REQUIRE(receivers[0]->GradientFields(2) == std::vector<std::string>({"sxx", "syy", "sxy", "rz"}));
+    REQUIRE(Receiver::GradientNames().size() == 15);
+
+  }
+
+  SECTION("misfit") {
+
+    unique_ptr<Options> options(new Options);
+    options->SetDimension(3);
+    options->setOptions();
+
+    /* A Gaussian pulse, and the same pulse later (as the data). */
+    const PetscReal dt = 1e-3;
+    const PetscInt n = 400;
+    auto pulse = [&](const PetscReal delay) {
+      std::vector<double> s(n);
+      for (PetscInt i = 0; i < n; i++) { s[i] = std::exp(-std::pow((i * dt - delay) / 0.02, 2)); }
+      return s;
+    };
+    std::vector<double> syn = pulse(0.15), obs = pulse(0.16), adj;
+
+    /* The residual, for the l2 misfit. */
+    options->SetMisfit("", "l2", 0, 0);
+    const double l2 = Misfit(options).measure(syn, obs, dt, adj);
+    double expected = 0;
+    for (PetscInt i = 0; i < n; i++) {
+      REQUIRE(adj[i] == Approx(syn[i] - obs[i]));
+      expected += 0.5 * (syn[i] - obs[i]) * (syn[i] - obs[i]) * dt;
+    }
+    REQUIRE(l2 == Approx(expected));
+
+    /* The traveltime shift, between samples. */
+    options->SetMisfit("", "cc", 0, 0.05);
+    REQUIRE(Misfit(options).measure(syn, obs, dt, adj) == Approx(0.5 * 0.01 * 0.01).epsilon(1e-3));
+
+    /* The adjoint source of the phase misfit is its derivative: a step along a perturbation changes the misfit
+     * by the adjoint source projected on it. */
+    options->SetMisfit("", "tf-phase", 50, 0);
+    Misfit phase(options);
+    const double chi = phase.measure(syn, obs, dt, adj);
+    REQUIRE(chi > 0);
+    std::vector<double> step(syn), ignored;
+    const double h = 1e-6;
+    double predicted = 0;
+    for (PetscInt i = 0; i < n; i++) {
+      const double d = std::sin(0.05 * i) * syn[i];
+      step[i] += h * d;
+      predicted += adj[i] * d * dt;
+    }
+    REQUIRE((phase.measure(step, obs, dt, ignored) - chi) / h == Approx(predicted).epsilon(1e-3));
+
+    /* An adjoint shot has a source at each receiver, and no receivers. */
+    auto adjoint = options->AdjointShot(3);
+    REQUIRE(adjoint->NumberSources() == 2);
+    REQUIRE(adjoint->NumberReceivers() == 0);
+    REQUIRE(adjoint->SourceType() == "adjoint");
+    REQUIRE(adjoint->SrcNumComponents() == std::vector<PetscInt>({3, 3}));
+
+    /* Its sources look their time functions up, zero past the end. */
+    Eigen::MatrixXd trace = Eigen::MatrixXd::Zero(3, 2);
+    trace(1, 0) = 1; trace(2, 1) = 2;
+    AdjointSource::SetTrace(1, trace);
+    auto sources = Source::Factory(adjoint);
+    REQUIRE_THROWS_AS(sources[0]->loadData(), std::runtime_error);
+    sources[1]->loadData();
+    REQUIRE(sources[1]->evaluate(0, 0)(1) == 1);
+    REQUIRE(sources[1]->evaluate(dt, 1)(2) == 2);
+    REQUIRE(sources[1]->evaluate(2 * dt, 2).isZero());
+    AdjointSource::ClearTraces();
+
   }
 
   SECTION("exceptions") {
@@ -108,6 +325,17 @@ TEST_CASE("Test receiver functionality", "[receiver]") {
     REQUIRE_THROWS_AS(Receiver::Factory(options), std::runtime_error);
   }
 
+  SECTION("async writer") {
+
+    /* Tasks run one at a time, in order of submission. */
+    std::vector<int> done;
+    AsyncWriter writer;
+    for (int i = 0; i < 5; i++) { writer.submit([&done, i]() { done.push_back(i); }); }
+    writer.wait();
+    REQUIRE(done == std::vector<int>({0, 1, 2, 3, 4}));
+
+  }
+
 
 
 }
@@ -2,6 +2,7 @@
 #include <Eigen/Dense>
 #include <Utilities/Options.h>
 #include <Source/Source.h>
+#include <Source/Injection.h>
 #include <Mesh/Mesh.h>
 #include <Model/ExodusModel.h>
 #include <Problem/Problem.h>
@@ -213,6 +214,17 @@ TEST_CASE("Test source functionality", "[source]") {
                       == Approx((i+1.0) * true_ricker(time, ricker_freq[i], ricker_time[i], ricker_amp[i])));
         }
       }
+
+      /* Read a window at a time, the same forces are looked up. */
+      Source::tabulate({sources[0].get(), sources[1].get()}, nTimeSteps, 1e-3, 128);
+      for (PetscInt j = 0; j < nTimeSteps; j++) {
+        PetscReal time = j * 1e-3;
+        Source::advanceTable(j);
+        for (PetscInt i = 0; i < Source::NumSources(); i++) {
+          REQUIRE(sources[i]->fire(time, j).sum()
+                      == Approx((i+1.0) * true_ricker(time, ricker_freq[i], ricker_time[i], ricker_amp[i])));
+        }
+      }
     }
 
 
@@ -288,6 +300,43 @@ TEST_CASE("Test source functionality", "[source]") {
         }
       }
 
+      /* Tabulated, the same forces are looked up. */
+      Source::tabulate({sources[0].get(), sources[1].get()}, 1000, 1e-3);
+      for (PetscInt i = 0; i < Source::NumSources(); i++) {
+        for (PetscInt j = 0; j < 1000; j++) {
+          PetscReal time = j * 1e-3;
+          REQUIRE(sources[i]->fire(time, j)(0)
+                      == Approx(true_ricker(time, ricker_freq[i], ricker_time[i], ricker_amp[i])));
+        }
+      }
+
+      /* As well as a window of steps, moved along in time. */
+      Source::tabulate({sources[0].get(), sources[1].get()}, 1000, 1e-3, 64);
+      for (PetscInt j = 0; j < 1000; j++) {
+        PetscReal time = j * 1e-3;
+        Source::advanceTable(j);
+        for (PetscInt i = 0; i < Source::NumSources(); i++) {
+          REQUIRE(sources[i]->fire(time, j)(0)
+                      == Approx(true_ricker(time, ricker_freq[i], ricker_time[i], ricker_amp[i])));
+        }
+      }
+
+      /* Encoded, a source is flipped and shifted by whole steps, in the table and off it. */
+      options->SetSrcEncoding({-1, 1}, {0.01, 0});
+      sources.clear();
+      sources = Source::Factory(options);
+      Source::tabulate({sources[0].get(), sources[1].get()}, 1000, 1e-3, 64);
+      for (PetscInt j = 0; j < 1000; j++) {
+        PetscReal time = j * 1e-3;
+        Source::advanceTable(j);
+        REQUIRE(sources[0]->fire(time, j)(0) ==
+                    Approx(j < 10 ? 0 : -true_ricker(time - 0.01, ricker_freq[0], ricker_time[0], ricker_amp[0])));
+        REQUIRE(sources[1]->fire(time, j)(0)
+                    == Approx(true_ricker(time, ricker_freq[1], ricker_time[1], ricker_amp[1])));
+        REQUIRE(sources[0]->fire(time + 5e-4, j)(0) == Approx(j < 10 ? 0 :
+                    -true_ricker(time + 5e-4 - 0.01, ricker_freq[0], ricker_time[0], ricker_amp[0])));
+      }
+
     }
 
     SECTION("integration_3d") {
@@ -397,3 +446,49 @@ TEST_CASE("Test source functionality", "[source]") {
   }
 
 }
+
+TEST_CASE("Injected wavefield", "[source]") {
+
+  /* Three points, whose displacement (p + 1) t^2 has the velocity 2 (p + 1) t, and traction (p + 1) t. */
+  PetscMPIInt rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+  const std::string name = "injection_" + std::to_string(rank) + ".h5";
+  const PetscInt num_samples = 20, num_points = 3;
+  const double dt = 0.1, start_time = 0;
+  std::vector<double> crd {0, 0, 1, 0, 2, 0}, dsp, trc;
+  for (PetscInt k = 0; k < num_samples; k++) {
+    for (PetscInt p = 0; p < num_points; p++) {
+      dsp.push_back((p + 1) * (k * dt) * (k * dt)); trc.push_back((p + 1) * k * dt);
+    }
+  }
+  hid_t file = H5Fcreate(name.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+  hsize_t crd_dims[2] = {num_points, 2}, dims[3] = {num_samples, num_points, 1};
+  H5LTmake_dataset_double(file, "/coordinates", 2, crd_dims, crd.data());
+  H5LTmake_dataset_double(file, "/displacement", 3, dims, dsp.data());
+  H5LTmake_dataset_double(file, "/traction", 3, dims, trc.data());
+  H5LTset_attribute_double(file, "/", "dt", &dt, 1);
+  H5LTset_attribute_double(file, "/", "start_time", &start_time, 1);
+  H5Fclose(file);
+
+  /* The first and last point, read 4 samples at a time. */
+  std::unique_ptr<Options> options(new Options);
+  options->SetInjection({"x0"}, name, 4);
+  Injection::Open(options);
+  REQUIRE(Injection::NumComponents() == 1);
+  const double x0[2] = {0, 0}, x2[2] = {2, 0}, off[2] = {0.5, 0};
+  const PetscInt row0 = Injection::Lookup(x0), row2 = Injection::Lookup(x2);
+  REQUIRE(row0 == 0); REQUIRE(row2 == 2);
+  REQUIRE_THROWS_AS(Injection::Lookup(off), std::runtime_error);
+  Injection::Finalize();
+
+  for (double time: {0.55, 0.35, 1.24}) {
+    Injection::Advance(time);
+    REQUIRE(Injection::Velocity(row0)[0] == Approx(2 * time));
+    REQUIRE(Injection::Velocity(row2)[0] == Approx(6 * time));
+    REQUIRE(Injection::Traction(row2)[0] == Approx(3 * time));
+  }
+  Injection::Advance(-1);
+  REQUIRE(Injection::Velocity(row2)[0] == 0); REQUIRE(Injection::Traction(row2)[0] == 0);
+  Injection::Close();
+  REQUIRE(!Injection::Active());
+
+}
@@ -0,0 +1,42 @@
+#include <Utilities/AsyncWriter.h>
+#include <utility>
+
+AsyncWriter::~AsyncWriter() {
+  if (!mThread.joinable()) { return; }
+  {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mCond.wait(lock, [this] { return !mBusy; });
+    mStop = true;
+  }
+  mCond.notify_all();
+  mThread.join();
+}
+
+void AsyncWriter::submit(std::function<void()> task) {
+  if (!mThread.joinable()) { mThread = std::thread(&AsyncWriter::loop, this); }
+  {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mCond.wait(lock, [this] { return !mBusy; });
+    mTask = std::move(task); mBusy = true;
+  }
+  mCond.notify_all();
+}
+
+void AsyncWriter::wait() {
+  std::unique_lock<std::mutex> lock(mMutex);
+  mCond.wait(lock, [this] { return !mBusy; });
+}
+
+void AsyncWriter::loop() {
+  std::unique_lock<std::mutex> lock(mMutex);
+  while (true) {
+    mCond.wait(lock, [this] { return mBusy || mStop; });
+    if (!mBusy) { return; }
+    /* Run without the lock, so that the caller can check on the task. */
+    lock.unlock();
+    mTask();
+    lock.lock();
+    mTask = nullptr; mBusy = false;
+    mCond.notify_all();
+  }
+}
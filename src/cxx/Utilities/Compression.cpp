@@ -0,0 +1,62 @@
+#include <Utilities/Compression.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+int Compression::Bits(const double tolerance) {
+  if (!(tolerance > 0 && tolerance <= 1)) {
+    throw std::runtime_error("A compression tolerance must lie in (0, 1], not " + std::to_string(tolerance) + ".");
+  }
+  const double levels = std::ceil(1 / tolerance) + 1;
+  const int bits = std::max<int>(1, std::ceil(std::log2(levels)));
+  if (bits > 32) {
+    throw std::runtime_error("A compression tolerance of " + std::to_string(tolerance) + " takes more than 32 bits.");
+  }
+  return bits;
+}
+
+size_t Compression::Bytes(const size_t num, const double tolerance) {
+  return 2 * sizeof(double) + (num * Bits(tolerance) + 7) / 8;
+}
+
+void Compression::compress(const PetscScalar *val, const size_t num, const double tolerance, unsigned char *out) {
+
+  double lowest = 0, max_abs = 0;
+  if (num) { lowest = *std::min_element(val, val + num); }
+  for (size_t i = 0; i < num; i++) { max_abs = std::max<double>(max_abs, std::abs(val[i])); }
+  const double step = Step(max_abs, tolerance);
+  std::memcpy(out, &lowest, sizeof(double));
+  std::memcpy(out + sizeof(double), &step, sizeof(double));
+
+  /* Pack the levels, lowest bits first. */
+  const int bits = Bits(tolerance);
+  unsigned char *p = out + 2 * sizeof(double);
+  uint64_t acc = 0; int filled = 0;
+  for (size_t i = 0; i < num; i++) {
+    acc |= static_cast<uint64_t>(Level(val[i], lowest, step)) << filled;
+    filled += bits;
+    while (filled >= 8) { *p++ = acc & 0xff; acc >>= 8; filled -= 8; }
+  }
+  if (filled) { *p = acc & 0xff; }
+
+}
+
+void Compression::decompress(const unsigned char *in, const size_t num, const double tolerance, PetscScalar *val) {
+
+  double lowest, step;
+  std::memcpy(&lowest, in, sizeof(double));
+  std::memcpy(&step, in + sizeof(double), sizeof(double));
+
+  const int bits = Bits(tolerance);
+  const uint64_t mask = (static_cast<uint64_t>(1) << bits) - 1;
+  const unsigned char *p = in + 2 * sizeof(double);
+  uint64_t acc = 0; int filled = 0;
+  for (size_t i = 0; i < num; i++) {
+    while (filled < bits) { acc |= static_cast<uint64_t>(*p++) << filled; filled += 8; }
+    val[i] = lowest + step * (acc & mask);
+    acc >>= bits; filled -= bits;
+  }
+
+}
@@ -0,0 +1,117 @@
+#include <Utilities/HardwareCounters.h>
+#include <cstring>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+constexpr double HardwareCounters::LineBytes;
+
+namespace {
+
+/** The group of counters of one thread: the position of each counter in the group (-1 if not counted). */
+struct Group {
+  bool opened = false;
+  int leader = -1, size = 0;
+  std::array<int, HardwareCounters::NumCounters> slot;
+  std::vector<int> fds;
+  Group() { slot.fill(-1); }
+  ~Group() {
+#ifdef __linux__
+    for (auto fd: fds) { close(fd); }
+#endif
+  }
+};
+
+thread_local Group group;
+
+#ifdef __linux__
+int perfOpen(const unsigned type, const unsigned long long config, const int leader) {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.disabled = leader == -1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP;
+  return syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0);
+}
+#endif
+
+}
+
+const char *HardwareCounters::Name(const Counter counter) {
+  switch (counter) {
+    case Cycles: return "cycles";
+    case Instructions: return "instructions";
+    case CacheMisses: return "cache-misses";
+    case FpScalar: return "fp-scalar-double";
+    case Fp128: return "fp-128b-packed-double";
+    case Fp256: return "fp-256b-packed-double";
+    case Fp512: return "fp-512b-packed-double";
+    default: return "unknown";
+  }
+}
+
+bool HardwareCounters::open() {
+
+  if (group.opened) { return group.slot[Cycles] >= 0; }
+  group.opened = true;
+#ifdef __linux__
+  struct Event { Counter counter; unsigned type; unsigned long long config; };
+  std::vector<Event> events = {
+      {Cycles, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+      {Instructions, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+      {CacheMisses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES}};
+#if defined(__x86_64__)
+  /* FP_ARITH_INST_RETIRED (event 0xc7), by umask. */
+  events.push_back({FpScalar, PERF_TYPE_RAW, 0xc7 | (0x01 << 8)});
+  events.push_back({Fp128, PERF_TYPE_RAW, 0xc7 | (0x04 << 8)});
+  events.push_back({Fp256, PERF_TYPE_RAW, 0xc7 | (0x10 << 8)});
+  events.push_back({Fp512, PERF_TYPE_RAW, 0xc7 | (0x40 << 8)});
+#endif
+  for (auto &e: events) {
+    const int fd = perfOpen(e.type, e.config, group.leader);
+    if (fd < 0) {
+      /* Without the leader (cycles), nothing is counted. */
+      if (group.leader == -1) { return false; }
+      continue;
+    }
+    if (group.leader == -1) { group.leader = fd; }
+    group.fds.push_back(fd);
+    group.slot[e.counter] = group.size++;
+  }
+  ioctl(group.leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl(group.leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  return true;
+#else
+  return false;
+#endif
+
+}
+
+bool HardwareCounters::available(const Counter counter) {
+  open();
+  return group.slot[counter] >= 0;
+}
+
+void HardwareCounters::read(Values &values) {
+
+  values.fill(0);
+  if (!open()) { return; }
+#ifdef __linux__
+  /* The number of counters, then their values in the order they were opened. */
+  unsigned long long buffer[1 + NumCounters];
+  if (::read(group.leader, buffer, sizeof(unsigned long long) * (1 + group.size)) <= 0) { return; }
+  for (int c = 0; c < NumCounters; c++) {
+    if (group.slot[c] >= 0) { values[c] = buffer[1 + group.slot[c]]; }
+  }
+#endif
+
+}
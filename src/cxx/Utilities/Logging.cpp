@@ -3,6 +3,21 @@
 #include <stdio.h>
 Logger::Logger() {}
 
+int Logger::Rank() {
+  if (GLOBAL_LOGGER_STATE.rank < 0) {
+    PetscBool initialized; PetscInitialized(&initialized);
+    if (!initialized) { return 0; }
+    MPI_Comm_rank(PETSC_COMM_WORLD, &GLOBAL_LOGGER_STATE.rank);
+  }
+  return GLOBAL_LOGGER_STATE.rank;
+}
+
+bool Logger::Enabled(LogLevel level_) {
+  if (level_ == LogLevel::ERROR) { return true; }
+  if (GLOBAL_LOGGER_STATE.proc == LogProc::ALLPROCS) { return level_ == GLOBAL_LOGGER_STATE.level; }
+  return GLOBAL_LOGGER_STATE.level >= level_ && Rank() == 0;
+}
+
 Logger::~Logger() {
 
   // catch error case
@@ -11,7 +26,7 @@ Logger::~Logger() {
     MPI_Abort(PETSC_COMM_WORLD,-1);
   }
   
-  int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+  const int rank = Rank();
   if (GLOBAL_LOGGER_STATE.proc == LogProc::ROOTONLY && rank == 0) {        
     // only print at correct verbosity level or higher
     if(GLOBAL_LOGGER_STATE.level >= level) {
@@ -0,0 +1,48 @@
+#include <Utilities/Memory.h>
+#include <Utilities/Logging.h>
+#include <cstdio>
+#include <mpi.h>
+#include <sys/resource.h>
+
+constexpr size_t Memory::NodeBytes;
+
+const char *Memory::Name(const Category category) {
+  switch (category) {
+    case Elements: return "Elements";
+    case Operators: return "Operators";
+    case Fields: return "Fields";
+    case Model: return "Model";
+    case KdTrees: return "KdTrees";
+    case Receivers: return "Receivers";
+    case Mesh: return "Mesh";
+    case PetscMesh: return "PetscMesh";
+    default: return "Unknown";
+  }
+}
+
+void Memory::report(const std::string &when, const Bytes &bytes) {
+
+  /* The categories, their sum, and the resident and peak memory of the process. */
+  std::array<double, NumCategories + 3> local, max, sum;
+  double total = 0;
+  for (PetscInt c = 0; c < NumCategories; c++) { local[c] = bytes[c]; total += bytes[c]; }
+  PetscLogDouble resident = 0; PetscMemoryGetCurrentUsage(&resident);
+  struct rusage usage; getrusage(RUSAGE_SELF, &usage);
+  local[NumCategories] = total;
+  local[NumCategories + 1] = resident;
+  local[NumCategories + 2] = 1024.0 * usage.ru_maxrss;
+  MPI_Allreduce(local.data(), max.data(), local.size(), MPI_DOUBLE, MPI_MAX, PETSC_COMM_WORLD);
+  MPI_Allreduce(local.data(), sum.data(), local.size(), MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
+  int size; MPI_Comm_size(PETSC_COMM_WORLD, &size);
+
+  char line[128];
+  std::snprintf(line, sizeof(line), "%-17s %12s %12s", "Category", "Max (MB)", "Avg (MB)");
+  LOG() << "Memory per rank " << when << ", over " << size << " rank(s):\n" << line;
+  for (PetscInt c = 0; c < NumCategories + 3; c++) {
+    const char *name = c < NumCategories ? Name(static_cast<Category>(c)) :
+                       c == NumCategories ? "Total counted" : c == NumCategories + 1 ? "Resident" : "Peak resident";
+    std::snprintf(line, sizeof(line), "%-17s %12.2f %12.2f", name, max[c] / 1048576, sum[c] / size / 1048576);
+    LOG() << line;
+  }
+
+}
@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <sstream>
 #include <salvus.h>
 #include <petsc.h>
 
@@ -44,17 +48,81 @@ void Options::setOptions() {
   /********************************************************************************
                           Spacial discretization and model.
   ********************************************************************************/
+  /* A structured box of --box-elements elements per dimension (i.e. for scaling runs), built in memory with a
+   * homogeneous model, replaces the mesh and model files. */
+  mBoxElements.resize(3); int_buffer = mBoxElements.size();
+  PetscOptionsGetIntArray(NULL, NULL, "--box-elements", mBoxElements.data(), &int_buffer, &parameter_set);
+  mBoxElements.resize(parameter_set ? int_buffer : 0);
+  const bool box = !mBoxElements.empty();
+  if (box) {
+    if (mBoxElements.size() < 2) { throw std::runtime_error("--box-elements takes 2 or 3 values (one per dimension)."); }
+    for (auto n: mBoxElements) { if (n < 1) throw std::runtime_error("--box-elements must be positive."); }
+  }
+  mBoxExtent.assign(3, 1.0); int_buffer = mBoxExtent.size();
+  PetscOptionsGetScalarArray(NULL, NULL, "--box-extent", mBoxExtent.data(), &int_buffer, &parameter_set);
+  if (parameter_set && box && int_buffer != mBoxElements.size()) {
+    throw std::runtime_error("--box-extent takes one length per dimension of --box-elements.");
+  }
+  mBoxExtent.resize(mBoxElements.size(), 1.0);
+  PetscOptionsGetBool(NULL, NULL, "--box-simplex", &mBoxSimplex, &parameter_set);
+  if (!parameter_set) {
+    mBoxSimplex = PETSC_FALSE;
+  }
+  /* At half an element, neighbouring vertices could meet (elements may already degenerate before). */
+  PetscOptionsGetReal(NULL, NULL, "--box-perturbation", &real_buffer, &parameter_set);
+  if (parameter_set) {
+    if (real_buffer < 0 || real_buffer >= 0.5) throw std::runtime_error("--box-perturbation must be in [0, 0.5).");
+    mBoxPerturbation = real_buffer;
+  } else {
+    mBoxPerturbation = 0;
+  }
+  PetscOptionsGetInt(NULL, NULL, "--box-seed", &int_buffer, &parameter_set);
+  if (parameter_set) {
+    mBoxSeed = int_buffer;
+  } else {
+    mBoxSeed = 0;
+  }
+  PetscOptionsGetString(NULL, NULL, "--box-physics", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  if (parameter_set) {
+    mBoxPhysics = std::string(char_buffer);
+    if (mBoxPhysics != "fluid" && mBoxPhysics != "elastic") {
+      throw std::runtime_error("--box-physics must be one of [ fluid, elastic ].");
+    }
+  } else {
+    mBoxPhysics = "fluid";
+  }
+  /* Overrides of the default material (see ExodusModel::setHomogeneous), given as e.g. "VP:1500,RHO:1000". */
+  mBoxMaterial.clear();
+  char *material[PETSC_MAX_PATH_LEN]; PetscInt num_material = PETSC_MAX_PATH_LEN;
+  PetscOptionsGetStringArray(NULL, NULL, "--box-material", material, &num_material, &parameter_set);
+  if (parameter_set) {
+    for (PetscInt i = 0; i < num_material; i++) {
+      std::string entry(material[i]); size_t sep = entry.find(':');
+      if (sep == std::string::npos) {
+        throw std::runtime_error("--box-material expects entries of the form name:value, got '" + entry + "'.");
+      }
+      mBoxMaterial[entry.substr(0, sep)] = std::stod(entry.substr(sep + 1));
+    }
+  }
+
   PetscOptionsGetString(NULL, NULL, "--mesh-file", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
   if (parameter_set) {
     mMeshFile = std::string(char_buffer);
   } else {
-    if (! testing) throw std::runtime_error(epre + "--mesh-file" + epst);
+    if (! testing && ! box) throw std::runtime_error(epre + "--mesh-file" + epst);
+  }
+  /* Write the distributed mesh to a DMPlex HDF5 file, which later runs can read in parallel. */
+  PetscOptionsGetString(NULL, NULL, "--save-mesh-file", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  if (parameter_set) {
+    mSaveMeshFile = std::string(char_buffer);
+  } else {
+    mSaveMeshFile = "";
   }
   PetscOptionsGetString(NULL, NULL, "--model-file", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
   if (parameter_set) {
     mModelFile = std::string(char_buffer);
   } else {
-    if (! testing) throw std::runtime_error(epre + "--model-file" + epst);
+    if (! testing && ! box) throw std::runtime_error(epre + "--model-file" + epst);
   }
   PetscOptionsGetInt(NULL, NULL, "--polynomial-order", &int_buffer, &parameter_set);
   if (parameter_set) {
@@ -62,6 +130,22 @@ void Options::setOptions() {
   } else {
     if (! testing) throw std::runtime_error(epre + "--polynomial-order" + epst);
   }
+  /* With a maximum frequency, --polynomial-order is an upper bound: the lowest order which resolves the
+   * minimum wavelength of every element is used instead (see Mesh::setupTopology). */
+  PetscOptionsGetReal(NULL, NULL, "--max-frequency", &real_buffer, &parameter_set);
+  if (parameter_set) {
+    if (real_buffer <= 0) throw std::runtime_error("--max-frequency must be positive.");
+    mMaxFrequency = real_buffer;
+  } else {
+    mMaxFrequency = 0;
+  }
+  PetscOptionsGetReal(NULL, NULL, "--points-per-wavelength", &real_buffer, &parameter_set);
+  if (parameter_set) {
+    if (real_buffer <= 0) throw std::runtime_error("--points-per-wavelength must be positive.");
+    mPointsPerWavelength = real_buffer;
+  } else {
+    mPointsPerWavelength = 5;
+  }
   /* TODO: Get this from the problem itself. */
   PetscOptionsGetInt(NULL, NULL, "--dimension", &int_buffer, &parameter_set);
   if (parameter_set) {
@@ -69,6 +153,79 @@ void Options::setOptions() {
   } else {
     if (! testing) throw std::runtime_error(epre + "--dimension" + epst);
   }
+  /* Store the components of vector physics (i.e. elastic) interleaved in one block vector. */
+  PetscOptionsGetBool(NULL, NULL, "--interleaved-components", &mInterleavedComponents, &parameter_set);
+  if (!parameter_set) {
+    mInterleavedComponents = PETSC_FALSE;
+  }
+  /* PETSc vector type of the fields (i.e. cuda, hip or kokkos for device resident fields, with a PETSc built
+   * for them). */
+  PetscOptionsGetString(NULL, NULL, "--vec-type", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mFieldVecType = parameter_set ? std::string(char_buffer) : "standard";
+  /* Only store the element vertices, and recompute the Jacobian at each GLL point when needed. */
+  PetscOptionsGetBool(NULL, NULL, "--low-memory-geometry", &mLowMemoryGeometry, &parameter_set);
+  if (!parameter_set) {
+    mLowMemoryGeometry = PETSC_FALSE;
+  }
+  /* Elements of the same precomputed geometry (i.e. the translates in a structured region) share one record. */
+  PetscOptionsGetBool(NULL, NULL, "--share-geometry", &mShareGeometry, &parameter_set);
+  if (!parameter_set) {
+    mShareGeometry = PETSC_FALSE;
+  }
+  /* Process the elements, and number their dofs, along a space-filling curve for locality. */
+  PetscOptionsGetBool(NULL, NULL, "--reorder-elements", &mReorderElements, &parameter_set);
+  if (!parameter_set) {
+    mReorderElements = PETSC_FALSE;
+  }
+  /* Only store the geometric coefficients of (affine) simplices, and apply their stiffness through the
+   * reference derivatives, instead of a dense matrix per element. */
+  PetscOptionsGetBool(NULL, NULL, "--simplex-reference-stiffness", &mSimplexReferenceStiffness, &parameter_set);
+  if (!parameter_set) {
+    mSimplexReferenceStiffness = PETSC_FALSE;
+  }
+  /* Single precision where it halves memory or traffic without touching the time integration: dense element
+   * stiffness matrices, and the halo exchange. The fields, and their sums, stay in double. */
+  PetscOptionsGetBool(NULL, NULL, "--mixed-precision", &mMixedPrecision, &parameter_set);
+  if (!parameter_set) {
+    mMixedPrecision = PETSC_FALSE;
+  }
+  /* Precision in which the halo exchange sends the values: "double", "single", or "half" (scaled per message).
+   * Single by default with --mixed-precision. */
+  PetscOptionsGetString(NULL, NULL, "--halo-precision", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mHaloPrecision = parameter_set ? std::string(char_buffer) : mMixedPrecision ? "single" : "double";
+  if (mHaloPrecision != "double" && mHaloPrecision != "single" && mHaloPrecision != "half") {
+    throw std::runtime_error("--halo-precision must be 'double', 'single' or 'half', not '" + mHaloPrecision + "'.");
+  }
+  /* Scalar quads and hexes apply a dense stiffness matrix per element, assembled once (for low orders). */
+  PetscOptionsGetBool(NULL, NULL, "--dense-element-stiffness", &mDenseElementStiffness, &parameter_set);
+  if (!parameter_set) {
+    mDenseElementStiffness = PETSC_FALSE;
+  }
+  /* The 1D contractions of quads and hexes as small matrix products, through kernels generated for the
+   * processor if built with LIBXSMM (see SmallGemm). */
+  PetscOptionsGetBool(NULL, NULL, "--small-gemm", &mSmallGemm, &parameter_set);
+  if (!parameter_set) {
+    mSmallGemm = PETSC_FALSE;
+  }
+  /* Choose the ones above by timing them on a sample of the elements, within a memory limit per rank (in MB),
+   * and remember the choice in --auto-tune-file (see Tuner). */
+  PetscOptionsGetBool(NULL, NULL, "--auto-tune", &mAutoTune, &parameter_set);
+  if (!parameter_set) {
+    mAutoTune = PETSC_FALSE;
+  }
+  PetscOptionsGetString(NULL, NULL, "--auto-tune-file", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  if (parameter_set) {
+    mAutoTuneFile = std::string(char_buffer);
+  } else {
+    mAutoTuneFile = "";
+  }
+  PetscOptionsGetReal(NULL, NULL, "--auto-tune-memory", &real_buffer, &parameter_set);
+  if (parameter_set) {
+    if (real_buffer < 0) throw std::runtime_error("--auto-tune-memory must not be negative.");
+    mAutoTuneMemory = real_buffer;
+  } else {
+    mAutoTuneMemory = 0;
+  }
 
   /********************************************************************************
                               Time-dependent problems.
@@ -81,23 +238,361 @@ void Options::setOptions() {
     mDuration = -1.0;
     if (! testing && ! static_problem ) throw std::runtime_error(epre + "--duration" + epst);
   }
+  /* If no time step is given, the largest stable one is computed once the elements are set up. */
   PetscOptionsGetReal(NULL, NULL, "--time-step", &real_buffer, &parameter_set);
   if (parameter_set) {
-    mTimeStep = real_buffer;
-
-    // compute number of time steps and ensure that it is integer
-    // (i.e., adjust (decrease) mTimeStep if necessary)
-    if ( mDuration > 0) {
-      mNumTimeSteps = std::ceil(mDuration / mTimeStep);
-      mTimeStep = mDuration / (double)(mNumTimeSteps);
-    }
-   } else {
+    if (real_buffer <= 0) throw std::runtime_error("--time-step must be positive.");
+    SetTimeStep(real_buffer);
+  } else {
+    mTimeStep = 0;
     mNumTimeSteps = 0;
-    if (! testing && ! static_problem ) throw std::runtime_error(epre + "--time-step" + epst);
+  }
+  PetscOptionsGetReal(NULL, NULL, "--time-step-safety-factor", &real_buffer, &parameter_set);
+  if (parameter_set) {
+    if (real_buffer <= 0) throw std::runtime_error("--time-step-safety-factor must be positive.");
+    mTimeStepSafetyFactor = real_buffer;
+  } else {
+    mTimeStepSafetyFactor = 1.0;
+  }
+  /* Report the --cfl-report elements which limit the time step, and a histogram of the stable time steps of all
+   * elements, at setup. --cfl-report-file also writes the stable time step of every element (see CflReport). */
+  PetscOptionsGetInt(NULL, NULL, "--cfl-report", &int_buffer, &parameter_set);
+  if (parameter_set) {
+    if (int_buffer < 0) throw std::runtime_error("--cfl-report must not be negative.");
+    mCflReport = int_buffer;
+  } else {
+    mCflReport = 0;
+  }
+  PetscOptionsGetString(NULL, NULL, "--cfl-report-file", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mCflReportFile = parameter_set ? std::string(char_buffer) : "";
+  /* Local time stepping: elements are binned into levels of --time-step / 2^level. */
+  PetscOptionsGetInt(NULL, NULL, "--max-time-step-levels", &int_buffer, &parameter_set);
+  if (parameter_set) {
+    if (int_buffer < 1) throw std::runtime_error("--max-time-step-levels must be at least 1.");
+    mMaxTimeStepLevels = int_buffer;
+  } else {
+    mMaxTimeStepLevels = 1;
+  }
+  /* Time stepping scheme: "newmark" (second order), "newmark4", fourth order at two assemblies per step (see
+   * Order4Newmark), or "leapfrog", second order without the velocity and the previous acceleration (see
+   * Order2Leapfrog). */
+  PetscOptionsGetString(NULL, NULL, "--time-stepping-scheme", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mTimeSteppingScheme = parameter_set ? std::string(char_buffer) : "newmark";
+  if (mTimeSteppingScheme != "newmark" && mTimeSteppingScheme != "newmark4" && mTimeSteppingScheme != "leapfrog") {
+    throw std::runtime_error("--time-stepping-scheme must be 'newmark', 'newmark4' or 'leapfrog', not '" +
+                                 mTimeSteppingScheme + "'.");
+  }
+  if (mTimeSteppingScheme != "newmark" && mMaxTimeStepLevels > 1) {
+    throw std::runtime_error("--time-stepping-scheme " + mTimeSteppingScheme + " can not be combined with "
+                                 "--max-time-step-levels.");
+  }
+  /* Number of shots propagated at once, as interleaved components of each (scalar) field. */
+  PetscOptionsGetInt(NULL, NULL, "--simultaneous-shots", &int_buffer, &parameter_set);
+  if (parameter_set) {
+    if (int_buffer < 1) throw std::runtime_error("--simultaneous-shots must be at least 1.");
+    mNumSimultaneousShots = int_buffer;
+  } else {
+    mNumSimultaneousShots = 1;
+  }
+  /* An ensemble of models on the same mesh, member m being shot m of the fields. Each member is driven by all
+   * sources, and the first member is the --model-file. */
+  char *members[PETSC_MAX_PATH_LEN]; PetscInt num_members = PETSC_MAX_PATH_LEN;
+  PetscOptionsGetStringArray(NULL, NULL, "--ensemble-model-files", members, &num_members, &parameter_set);
+  mEnsembleModelFiles.clear();
+  if (parameter_set) {
+    for (PetscInt i = 0; i < num_members; i++) { mEnsembleModelFiles.push_back(members[i]); }
+  }
+  if (!mEnsembleModelFiles.empty()) {
+    const PetscInt num = mEnsembleModelFiles.size() + 1;
+    if (box) { throw std::runtime_error("--ensemble-model-files needs a --model-file, not a box mesh."); }
+    if (mNumSimultaneousShots > 1 && mNumSimultaneousShots != num) {
+      throw std::runtime_error("--simultaneous-shots must be the number of ensemble members (" +
+                               std::to_string(num) + ", the --model-file and the --ensemble-model-files).");
+    }
+    mNumSimultaneousShots = num;
+  }
+  if (mNumSimultaneousShots > 1 && (mInterleavedComponents || mMaxTimeStepLevels > 1)) {
+    throw std::runtime_error("--simultaneous-shots can not be combined with --interleaved-components or "
+                                 "--max-time-step-levels.");
+  }
+  /* Keep the Newmark state in the local (ghosted) vectors, and step the ghosts along with the owned dofs, so
+   * that each step only sums the acceleration over the halo (see Problem::assembleLevel). */
+  PetscOptionsGetBool(NULL, NULL, "--ghosted-state", &mGhostedState, &parameter_set);
+  if (!parameter_set) {
+    mGhostedState = PETSC_FALSE;
+  }
+  if (mGhostedState && mMaxTimeStepLevels > 1) {
+    throw std::runtime_error("--ghosted-state can not be combined with --max-time-step-levels.");
+  }
+  /* Distribute the mesh with this many layers of overlapping cells, which a ghosted state steps redundantly, so
+   * that the halo is only exchanged every so many steps (see Problem::assembleLevel). */
+  PetscOptionsGetInt(NULL, NULL, "--halo-overlap", &int_buffer, &parameter_set);
+  if (parameter_set) {
+    if (int_buffer < 0) throw std::runtime_error("--halo-overlap must be non-negative.");
+    mHaloOverlap = int_buffer;
+  } else {
+    mHaloOverlap = 0;
+  }
+  if (mHaloOverlap && !mGhostedState) {
+    throw std::runtime_error("--halo-overlap requires --ghosted-state.");
+  }
+  /* The second assembly of a step would refresh the ghosts of the shifted displacement, not of the state. */
+  if (mHaloOverlap && mTimeSteppingScheme == "newmark4") {
+    throw std::runtime_error("--halo-overlap can not be combined with --time-stepping-scheme newmark4.");
+  }
+  /* A static problem is solved matrix free, by preconditioned conjugate gradients on the assembled stiffness
+   * term (see StaticSolver), to a relative residual of --static-tolerance. */
+  mStaticProblem = static_problem;
+  PetscOptionsGetReal(NULL, NULL, "--static-tolerance", &real_buffer, &parameter_set);
+  if (parameter_set) {
+    if (real_buffer <= 0) throw std::runtime_error("--static-tolerance must be positive.");
+    mStaticTolerance = real_buffer;
+  } else {
+    mStaticTolerance = 1e-8;
+  }
+  PetscOptionsGetString(NULL, NULL, "--static-preconditioner", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mStaticPreconditioner = parameter_set ? std::string(char_buffer) : "jacobi";
+  if (mStaticPreconditioner != "jacobi" && mStaticPreconditioner != "none") {
+    throw std::runtime_error("--static-preconditioner must be 'jacobi' or 'none', not '" + mStaticPreconditioner +
+                                 "'.");
+  }
+  if (mStaticProblem && (mGhostedState || mHaloOverlap || mMaxTimeStepLevels > 1 || mNumSimultaneousShots > 1)) {
+    throw std::runtime_error("--static-problem can not be combined with --ghosted-state, --halo-overlap, "
+                                 "--max-time-step-levels or --simultaneous-shots.");
+  }
+  /* Constrain the nodes of fine elements on the faces of coarse ones, which the (non-ghosted, single level)
+   * assembly enforces on the global vectors (see HangingNodes). */
+  PetscOptionsGetBool(NULL, NULL, "--hanging-nodes", &mHangingNodes, &parameter_set);
+  if (!parameter_set) {
+    mHangingNodes = PETSC_FALSE;
+  }
+  if (mHangingNodes && (mGhostedState || mMaxTimeStepLevels > 1 || mStaticProblem)) {
+    throw std::runtime_error("--hanging-nodes can not be combined with --ghosted-state, --max-time-step-levels "
+                                 "or --static-problem.");
   }
   
 
 
+  /********************************************************************************
+                                    Parallelism.
+  ********************************************************************************/
+  PetscOptionsGetInt(NULL, NULL, "--threads-per-rank", &int_buffer, &parameter_set);
+  if (parameter_set) {
+    if (int_buffer < 1) throw std::runtime_error("--threads-per-rank must be at least 1.");
+    mNumThreads = int_buffer;
+#ifndef _OPENMP
+    if (mNumThreads > 1) {
+      LOG() << "Warning: --threads-per-rank set, but Salvus was built without OpenMP. "
+          "Running with a single thread per rank.";
+      mNumThreads = 1;
+    }
+#endif
+  } else {
+    mNumThreads = 1;
+  }
+  /* Run the colors of the element loop as chunks of this many elements, which idle threads steal from the
+   * others, most expensive first (see WorkStealing). 0 splits each color statically. */
+  PetscOptionsGetInt(NULL, NULL, "--work-stealing-chunk", &int_buffer, &parameter_set);
+  if (parameter_set) {
+    if (int_buffer < 0) throw std::runtime_error("--work-stealing-chunk must be at least 0.");
+    mWorkStealingChunk = int_buffer;
+  } else {
+    mWorkStealingChunk = 0;
+  }
+  /* Share the halo buffers of the ranks of a node, and send one message between two nodes (see HaloExchange). */
+  PetscOptionsGetBool(NULL, NULL, "--node-aware-halo", &mNodeAwareHalo, &parameter_set);
+  if (!parameter_set) {
+    mNodeAwareHalo = PETSC_FALSE;
+  }
+
+  /* Time each phase of the setup and the time loop, and print a summary at the end (see Profiler). */
+  PetscOptionsGetBool(NULL, NULL, "--profile", &mProfile, &parameter_set);
+  if (!parameter_set) {
+    mProfile = PETSC_FALSE;
+  }
+  /* Also count the floating point operations and memory traffic of each phase (implies --profile). */
+  PetscOptionsGetBool(NULL, NULL, "--profile-counters", &mProfileCounters, &parameter_set);
+  if (!parameter_set) {
+    mProfileCounters = PETSC_FALSE;
+  }
+  if (mProfileCounters) { mProfile = PETSC_TRUE; }
+  /* Record the phases of the time loop, the halo posts and waits, and the output of every rank, and write them
+   * as a Chrome trace at the end (see Profiler::EnableTrace). */
+  PetscOptionsGetString(NULL, NULL, "--trace-file", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  if (parameter_set) {
+    mTraceFile = std::string(char_buffer);
+  } else {
+    mTraceFile = "";
+  }
+  /* Time the element loop element by element every --element-timing-every steps (0 for never), and report the
+   * seconds per element and step of each element type at the end of a shot. --element-cost-file also writes
+   * the seconds of each element as a cell field of the mesh (and times every 10 steps unless given). */
+  PetscOptionsGetString(NULL, NULL, "--element-cost-file", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  if (parameter_set) {
+    mElementCostFile = std::string(char_buffer);
+  } else {
+    mElementCostFile = "";
+  }
+  PetscOptionsGetInt(NULL, NULL, "--element-timing-every", &int_buffer, &parameter_set);
+  if (parameter_set) {
+    if (int_buffer < 0) throw std::runtime_error("--element-timing-every must not be negative.");
+    mElementTimingEvery = int_buffer;
+  } else {
+    mElementTimingEvery = mElementCostFile.empty() ? 0 : 10;
+  }
+  /* Write the bytes each rank sends to each other rank per step, and the seconds it waits for them, at the end
+   * of a shot, and log the number of neighbours, the largest volume and the ratio of shared to owned dofs. */
+  PetscOptionsGetString(NULL, NULL, "--halo-report-file", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  if (parameter_set) {
+    mHaloReportFile = std::string(char_buffer);
+  } else {
+    mHaloReportFile = "";
+  }
+  /* Report the progress of a shot about every --progress-interval seconds (0 for never), or every
+   * --progress-every steps (see Progress). */
+  PetscOptionsGetReal(NULL, NULL, "--progress-interval", &real_buffer, &parameter_set);
+  if (parameter_set) {
+    if (real_buffer < 0) throw std::runtime_error("--progress-interval must not be negative.");
+    mProgressInterval = real_buffer;
+  } else {
+    mProgressInterval = 10;
+  }
+  PetscOptionsGetInt(NULL, NULL, "--progress-every", &int_buffer, &parameter_set);
+  if (parameter_set) {
+    if (int_buffer < 0) throw std::runtime_error("--progress-every must not be negative.");
+    mProgressEvery = int_buffer;
+  } else {
+    mProgressEvery = 0;
+  }
+  /* Check the energy of the fields every --energy-check-every steps (0 for never), and abort once it grows
+   * by more than --energy-growth between checks for a while, or is not finite (see Monitor). */
+  PetscOptionsGetInt(NULL, NULL, "--energy-check-every", &int_buffer, &parameter_set);
+  if (parameter_set) {
+    if (int_buffer < 0) throw std::runtime_error("--energy-check-every must not be negative.");
+    mEnergyCheckEvery = int_buffer;
+  } else {
+    mEnergyCheckEvery = 0;
+  }
+  PetscOptionsGetReal(NULL, NULL, "--energy-growth", &real_buffer, &parameter_set);
+  if (parameter_set) {
+    if (real_buffer <= 1) throw std::runtime_error("--energy-growth must be larger than 1.");
+    mEnergyGrowth = real_buffer;
+  } else {
+    mEnergyGrowth = 10;
+  }
+  /* Report the bytes held by each subsystem, per rank (see Memory). */
+  PetscOptionsGetBool(NULL, NULL, "--memory-report", &mMemoryReport, &parameter_set);
+  if (!parameter_set) {
+    mMemoryReport = PETSC_FALSE;
+  }
+  /* Set up, time --dry-run-steps steps, and predict the time of the run and the ranks at which it still runs at
+   * --target-efficiency, instead of running it (see Simulation::dryRun). */
+  PetscOptionsGetBool(NULL, NULL, "--dry-run", &mDryRun, &parameter_set);
+  if (!parameter_set) {
+    mDryRun = PETSC_FALSE;
+  }
+  PetscOptionsGetInt(NULL, NULL, "--dry-run-steps", &int_buffer, &parameter_set);
+  if (parameter_set) {
+    if (int_buffer < 1) throw std::runtime_error("--dry-run-steps must be at least 1.");
+    mDryRunSteps = int_buffer;
+  } else {
+    mDryRunSteps = 10;
+  }
+  PetscOptionsGetReal(NULL, NULL, "--target-efficiency", &real_buffer, &parameter_set);
+  if (parameter_set) {
+    if (real_buffer <= 0 || real_buffer > 1) throw std::runtime_error("--target-efficiency must be in (0, 1].");
+    mTargetEfficiency = real_buffer;
+  } else {
+    mTargetEfficiency = 0.7;
+  }
+
+  /********************************************************************************
+                                    Partitioning.
+  ********************************************************************************/
+  /* Balance the (estimated) cost of the elements across ranks, instead of their number. */
+  PetscOptionsGetBool(NULL, NULL, "--weighted-partitioning", &mWeightedPartitioning, &parameter_set);
+  if (!parameter_set) {
+    mWeightedPartitioning = PETSC_FALSE;
+  }
+  /* Relative cost per element of each physics, given as e.g. "fluid:1,3delastic:3.2". By default
+   * the cost is taken to scale with the number of field components. */
+  mElementCosts = {{"fluid", 1.0}, {"2delastic", 2.0}, {"3delastic", 3.0}};
+  char *costs[PETSC_MAX_PATH_LEN]; PetscInt num_cost = PETSC_MAX_PATH_LEN;
+  PetscOptionsGetStringArray(NULL, NULL, "--element-costs", costs, &num_cost, &parameter_set);
+  if (parameter_set) {
+    for (PetscInt i = 0; i < num_cost; i++) {
+      std::string entry(costs[i]); size_t sep = entry.find(':');
+      if (sep == std::string::npos) {
+        throw std::runtime_error("--element-costs expects entries of the form physics:cost, got '" + entry + "'.");
+      }
+      mElementCosts[entry.substr(0, sep)] = std::stod(entry.substr(sep + 1));
+    }
+  }
+  /* Cache the partition of an exodus mesh, so that repeated runs on the same mesh and number of ranks skip
+   * the partitioner. */
+  PetscOptionsGetString(NULL, NULL, "--partition-cache-file", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  if (parameter_set) {
+    mPartitionCacheFile = std::string(char_buffer);
+  } else {
+    mPartitionCacheFile = "";
+  }
+  /* Extra cost of elements which couple to a different physics, relative to their own cost. */
+  PetscOptionsGetReal(NULL, NULL, "--coupling-cost", &real_buffer, &parameter_set);
+  if (parameter_set) {
+    if (real_buffer < 0) throw std::runtime_error("--coupling-cost must not be negative.");
+    mCouplingCost = real_buffer;
+  } else {
+    mCouplingCost = 0.5;
+  }
+  /* Time the elements over the first steps, and set up again on a partition which balances the measured cost
+   * (see Simulation::rebalance). It is handed over through the partition cache, which later runs reuse. */
+  PetscOptionsGetInt(NULL, NULL, "--rebalance-steps", &mRebalanceSteps, &parameter_set);
+  if (!parameter_set) { mRebalanceSteps = 0; }
+  if (mRebalanceSteps < 0) { throw std::runtime_error("--rebalance-steps must not be negative."); }
+  if (mRebalanceSteps && mPartitionCacheFile.empty()) { mPartitionCacheFile = "rebalance.partition"; }
+  /* Bisect the cells first onto the shared memory nodes, then within each node onto its ranks, so that the
+   * cut between nodes is that of as many parts as nodes (see Mesh::partitionCells). */
+  PetscOptionsGetBool(NULL, NULL, "--hierarchical-partitioning", &mHierarchicalPartitioning, &parameter_set);
+  if (!parameter_set) {
+    mHierarchicalPartitioning = PETSC_FALSE;
+  }
+  if (mHierarchicalPartitioning && !mWeightedPartitioning && !mRebalanceSteps) {
+    throw std::runtime_error("--hierarchical-partitioning requires --weighted-partitioning or --rebalance-steps, "
+                                 "which bisect the cells.");
+  }
+  /* Order of the nodes along the bisection: "rank" (of their first rank) or "hostname", which on most machines
+   * follows the network, so that neighbouring parts land on nearby nodes. */
+  PetscOptionsGetString(NULL, NULL, "--node-order", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mNodeOrder = parameter_set ? std::string(char_buffer) : "rank";
+  if (mNodeOrder != "rank" && mNodeOrder != "hostname") {
+    throw std::runtime_error("--node-order must be 'rank' or 'hostname', not '" + mNodeOrder + "'.");
+  }
+  /* Only the first rank reads the full model. The other ranks receive the parameters of their own elements
+   * once the mesh is distributed (see ExodusModel::localize). */
+  PetscOptionsGetBool(NULL, NULL, "--distribute-model", &mDistributeModel, &parameter_set);
+  if (!parameter_set) {
+    mDistributeModel = PETSC_FALSE;
+  }
+  /* Every rank holds the whole model, unless it is distributed. The ranks of a node can share one copy. */
+  PetscOptionsGetBool(NULL, NULL, "--node-shared-model", &mNodeSharedModel, &parameter_set);
+  if (!parameter_set) {
+    mNodeSharedModel = PETSC_FALSE;
+  }
+  /* The first rank parses the model file on a second thread while the mesh is partitioned and distributed,
+   * unless the partition weighs the cells by their model (see Simulation::Simulation). */
+  PetscOptionsGetBool(NULL, NULL, "--overlap-setup", &mOverlapSetup, &parameter_set);
+  if (!parameter_set) {
+    mOverlapSetup = PETSC_TRUE;
+  }
+  /* Material at the integration points. Read if it was written for this model and polynomial order, and
+   * written otherwise. */
+  PetscOptionsGetString(NULL, NULL, "--material-cache-file", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  if (parameter_set) {
+    mMaterialCacheFile = std::string(char_buffer);
+  } else {
+    mMaterialCacheFile = "";
+  }
+
   /********************************************************************************
                                      Boundaries.
   ********************************************************************************/
@@ -106,6 +601,94 @@ void Options::setOptions() {
   if (parameter_set) {
     for (PetscInt i = 0; i < num_bnd; i++) { mHomogeneousDirichletBoundaries.push_back(bounds[i]); }
   }
+  num_bnd = PETSC_MAX_PATH_LEN;
+  PetscOptionsGetStringArray(NULL, NULL, "--absorbing-boundaries", bounds, &num_bnd, &parameter_set);
+  if (parameter_set) {
+    for (PetscInt i = 0; i < num_bnd; i++) { mAbsorbingBoundaries.push_back(bounds[i]); }
+  }
+  /* The absorbing faces are weighted by the impedance of a single model. */
+  if (!mAbsorbingBoundaries.empty() && !mEnsembleModelFiles.empty()) {
+    throw std::runtime_error("--absorbing-boundaries can not be combined with --ensemble-model-files.");
+  }
+
+  /* Side sets through which the wavefield of a previous run is injected (and the outgoing waves absorbed). */
+  num_bnd = PETSC_MAX_PATH_LEN;
+  PetscOptionsGetStringArray(NULL, NULL, "--injection-boundaries", bounds, &num_bnd, &parameter_set);
+  if (parameter_set) {
+    for (PetscInt i = 0; i < num_bnd; i++) { mInjectionBoundaries.push_back(bounds[i]); }
+  }
+  PetscOptionsGetString(NULL, NULL, "--injection-file", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mInjectionFile = parameter_set ? std::string(char_buffer) : "";
+  PetscOptionsGetInt(NULL, NULL, "--injection-window", &mInjectionWindow, &parameter_set);
+  if (!parameter_set) { mInjectionWindow = 256; }
+  if (!mInjectionBoundaries.empty()) {
+    if (mInjectionFile.empty()) { throw std::runtime_error("--injection-boundaries needs an --injection-file."); }
+    /* Two samples on either side of the time of a step, for the velocity at both. */
+    if (mInjectionWindow < 4) { throw std::runtime_error("--injection-window must hold at least 4 samples."); }
+    if (mNumSimultaneousShots > 1 || mStaticProblem) {
+      throw std::runtime_error("--injection-boundaries drive a single wavefield in time, and can not be combined "
+                               "with --simultaneous-shots or --static-problem.");
+    }
+  }
+
+  /* Pairs of side sets whose dofs are identified (master, then slave), which the assembly enforces on the global
+   * vectors as the hanging nodes are (see PeriodicBoundaries). */
+  num_bnd = PETSC_MAX_PATH_LEN;
+  mPeriodicBoundaries.clear();
+  PetscOptionsGetStringArray(NULL, NULL, "--periodic-boundaries", bounds, &num_bnd, &parameter_set);
+  if (parameter_set) {
+    for (PetscInt i = 0; i < num_bnd; i++) { mPeriodicBoundaries.push_back(bounds[i]); }
+  }
+  if (mPeriodicBoundaries.size() % 2) {
+    throw std::runtime_error("--periodic-boundaries takes pairs of side sets (i.e. x0,x1,y0,y1).");
+  }
+  if (!mPeriodicBoundaries.empty() && (mHangingNodes || mGhostedState || mMaxTimeStepLevels > 1 || mStaticProblem)) {
+    throw std::runtime_error("--periodic-boundaries can not be combined with --hanging-nodes, --ghosted-state, "
+                                 "--max-time-step-levels or --static-problem.");
+  }
+
+  /********************************************************************************
+                                     Attenuation.
+  ********************************************************************************/
+  PetscOptionsGetBool(NULL, NULL, "--attenuation", &mAttenuation, &parameter_set);
+  if (!parameter_set) {
+    mAttenuation = PETSC_FALSE;
+  }
+  PetscInt n_band = 2; mAttenuationBand.resize(n_band);
+  PetscOptionsGetScalarArray(NULL, NULL, "--attenuation-band", mAttenuationBand.data(), &n_band, &parameter_set);
+  mAttenuationBand.resize(parameter_set ? n_band : 0);
+  if (mAttenuation) {
+    if (mAttenuationBand.size() != 2) {
+      throw std::runtime_error("--attenuation needs --attenuation-band, the lowest and highest frequency.");
+    }
+    if (mAttenuationBand[0] <= 0 || mAttenuationBand[0] >= mAttenuationBand[1]) {
+      throw std::runtime_error("--attenuation-band must give a positive frequency before a higher one.");
+    }
+    /* The memory variables advance once per step, by the (single) time step, for a single wavefield. */
+    if (mMaxTimeStepLevels > 1 || mNumSimultaneousShots > 1) {
+      throw std::runtime_error("--attenuation does not support local time stepping or simultaneous shots.");
+    }
+    /* Nor a second assembly per step (--time-stepping-scheme newmark4), which would advance them twice. */
+    if (mTimeSteppingScheme == "newmark4") {
+      throw std::runtime_error("--attenuation can not be combined with --time-stepping-scheme newmark4.");
+    }
+    /* Nor overlapping cells, whose memory variables would not be refreshed by the halo exchanges. */
+    if (mHaloOverlap) { throw std::runtime_error("--attenuation can not be combined with --halo-overlap."); }
+    /* Nor a static problem, in which nothing relaxes. */
+    if (mStaticProblem) { throw std::runtime_error("--attenuation can not be combined with --static-problem."); }
+  }
+
+  /********************************************************************************
+                                    Axisymmetry.
+  ********************************************************************************/
+  PetscOptionsGetBool(NULL, NULL, "--axisymmetric", &mAxisymmetric, &parameter_set);
+  if (!parameter_set) {
+    mAxisymmetric = PETSC_FALSE;
+  }
+  /* The memory variables are integrated without the hoop terms. */
+  if (mAxisymmetric && mAttenuation) {
+    throw std::runtime_error("--axisymmetric can not be combined with --attenuation.");
+  }
 
   /********************************************************************************
                                        Movies.
@@ -134,8 +717,235 @@ void Options::setOptions() {
     }
     PetscOptionsGetInt(NULL, NULL, "--save-frame-every", &mSaveFrameEvery, &parameter_set);
     if (!parameter_set) { mSaveFrameEvery = 10; }
+    if (mSaveFrameEvery < 1) { throw std::runtime_error("--save-frame-every must be positive."); }
   }
 
+  /* Movies may be restricted to a bounding box (min,max per dimension), a side set, and to the mesh vertices,
+   * and written in lower precision. Any of these writes the selected dofs with their coordinates, instead of
+   * the whole DMPlex vectors (see Movie). */
+  PetscInt n_region = 6; mMovieRegion.resize(n_region);
+  PetscOptionsGetScalarArray(NULL, NULL, "--movie-region", mMovieRegion.data(), &n_region, &parameter_set);
+  mMovieRegion.resize(parameter_set ? n_region : 0);
+  if (parameter_set && n_region != 2 * mNumDim) {
+    throw std::runtime_error("--movie-region takes a minimum and a maximum per dimension.");
+  }
+  for (size_t i = 0; i + 1 < mMovieRegion.size(); i += 2) {
+    if (mMovieRegion[i] > mMovieRegion[i + 1]) {
+      throw std::runtime_error("--movie-region must give each minimum before its maximum.");
+    }
+  }
+
+  PetscOptionsGetString(NULL, NULL, "--movie-side-set", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mMovieSideSet = parameter_set ? std::string(char_buffer) : "";
+
+  PetscOptionsGetBool(NULL, NULL, "--movie-vertices-only", &mMovieVerticesOnly, &parameter_set);
+  if (!parameter_set) {
+    mMovieVerticesOnly = PETSC_FALSE;
+  }
+
+  PetscOptionsGetString(NULL, NULL, "--movie-precision", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  if (parameter_set) {
+    mMoviePrecision = std::string(char_buffer);
+    if (mMoviePrecision != "double" && mMoviePrecision != "float" && mMoviePrecision != "half") {
+      throw std::runtime_error("--movie-precision must be one of [ double, float, half ].");
+    }
+  } else {
+    mMoviePrecision = "double";
+  }
+
+  /* An error bound relative to the largest magnitude of each frame, which writes the frames compressed instead
+   * (see Compression), and overrides --movie-precision. */
+  PetscOptionsGetReal(NULL, NULL, "--movie-tolerance", &mMovieTolerance, &parameter_set);
+  if (!parameter_set) { mMovieTolerance = 0; }
+  if (mMovieTolerance < 0 || mMovieTolerance > 1) {
+    throw std::runtime_error("--movie-tolerance must lie in [0, 1].");
+  }
+
+  /********************************************************************************
+                              Frequency domain wavefields.
+  ********************************************************************************/
+  /* Fields transformed on the fly at some frequencies, every --dft-every steps and within a bounding box (see
+   * Fourier). */
+  PetscInt n_freq = PETSC_MAX_PATH_LEN; mDftFrequencies.resize(n_freq);
+  PetscOptionsGetScalarArray(NULL, NULL, "--dft-frequencies", mDftFrequencies.data(), &n_freq, &parameter_set);
+  mDftFrequencies.resize(parameter_set ? n_freq : 0);
+  for (auto f: mDftFrequencies) {
+    if (f <= 0) { throw std::runtime_error("--dft-frequencies must be positive."); }
+  }
+
+  PetscOptionsGetInt(NULL, NULL, "--dft-every", &mDftEvery, &parameter_set);
+  if (!parameter_set) { mDftEvery = 1; }
+  if (mDftEvery < 1) { throw std::runtime_error("--dft-every must be positive."); }
+
+  char *dft_fields[PETSC_MAX_PATH_LEN]; PetscInt num_dft_fields = PETSC_MAX_PATH_LEN;
+  PetscOptionsGetStringArray(NULL, NULL, "--dft-fields", dft_fields, &num_dft_fields, &parameter_set);
+  if (parameter_set) {
+    for (PetscInt i = 0; i < num_dft_fields; i++) { mDftFields.push_back(dft_fields[i]); }
+  }
+
+  n_region = 6; mDftRegion.resize(n_region);
+  PetscOptionsGetScalarArray(NULL, NULL, "--dft-region", mDftRegion.data(), &n_region, &parameter_set);
+  mDftRegion.resize(parameter_set ? n_region : 0);
+  if (parameter_set && n_region != 2 * mNumDim) {
+    throw std::runtime_error("--dft-region takes a minimum and a maximum per dimension.");
+  }
+  for (size_t i = 0; i + 1 < mDftRegion.size(); i += 2) {
+    if (mDftRegion[i] > mDftRegion[i + 1]) {
+      throw std::runtime_error("--dft-region must give each minimum before its maximum.");
+    }
+  }
+
+  PetscOptionsGetString(NULL, NULL, "--dft-file", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mDftFile = parameter_set ? std::string(char_buffer) : "";
+  if (!mDftFrequencies.empty() && mDftFile.empty() && !testing) {
+    throw std::runtime_error("--dft-frequencies requested, but no output file specified. Set --dft-file.");
+  }
+
+  /********************************************************************************
+                              Regular grid wavefields.
+  ********************************************************************************/
+  /* Fields interpolated to a regular grid every --grid-every steps (see RegularGrid). The grid gives its first
+   * point, the spacing and the number of points along each axis. */
+  PetscOptionsGetString(NULL, NULL, "--grid-file", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mGridFile = parameter_set ? std::string(char_buffer) : "";
+
+  PetscInt n_grid = 3; mGridOrigin.resize(n_grid);
+  PetscOptionsGetScalarArray(NULL, NULL, "--grid-origin", mGridOrigin.data(), &n_grid, &parameter_set);
+  mGridOrigin.resize(parameter_set ? n_grid : 0);
+  n_grid = 3; mGridSpacing.resize(n_grid);
+  PetscOptionsGetScalarArray(NULL, NULL, "--grid-spacing", mGridSpacing.data(), &n_grid, &parameter_set);
+  mGridSpacing.resize(parameter_set ? n_grid : 0);
+  n_grid = 3; mGridShape.resize(n_grid);
+  PetscOptionsGetIntArray(NULL, NULL, "--grid-shape", mGridShape.data(), &n_grid, &parameter_set);
+  mGridShape.resize(parameter_set ? n_grid : 0);
+  if (!mGridFile.empty()) {
+    if (mGridOrigin.size() != mNumDim || mGridSpacing.size() != mNumDim || mGridShape.size() != mNumDim) {
+      throw std::runtime_error("--grid-file requires --grid-origin, --grid-spacing and --grid-shape, with one "
+                               "value per dimension.");
+    }
+    for (PetscInt d = 0; d < mNumDim; d++) {
+      if (mGridSpacing[d] <= 0 || mGridShape[d] < 1) {
+        throw std::runtime_error("--grid-spacing and --grid-shape must be positive.");
+      }
+    }
+  }
+
+  PetscOptionsGetInt(NULL, NULL, "--grid-every", &mGridEvery, &parameter_set);
+  if (!parameter_set) { mGridEvery = 1; }
+  if (mGridEvery < 1) { throw std::runtime_error("--grid-every must be positive."); }
+
+  char *grid_fields[PETSC_MAX_PATH_LEN]; PetscInt num_grid_fields = PETSC_MAX_PATH_LEN;
+  PetscOptionsGetStringArray(NULL, NULL, "--grid-fields", grid_fields, &num_grid_fields, &parameter_set);
+  if (parameter_set) {
+    for (PetscInt i = 0; i < num_grid_fields; i++) { mGridFields.push_back(grid_fields[i]); }
+  }
+
+  /********************************************************************************
+                                 In-situ staging.
+  ********************************************************************************/
+  /* Fields and receiver samples published to an ADIOS2 stream every --staging-every steps, for analysis running
+   * alongside (see Staging). The engine is any of ADIOS2's, i.e. SST or SSC for staging, or BP4 for a file. */
+  PetscOptionsGetString(NULL, NULL, "--staging-stream", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mStagingStream = parameter_set ? std::string(char_buffer) : "";
+
+  PetscOptionsGetString(NULL, NULL, "--staging-engine", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mStagingEngine = parameter_set ? std::string(char_buffer) : "SST";
+
+  PetscOptionsGetInt(NULL, NULL, "--staging-every", &mStagingEvery, &parameter_set);
+  if (!parameter_set) { mStagingEvery = 1; }
+  if (mStagingEvery < 1) { throw std::runtime_error("--staging-every must be positive."); }
+
+  char *staging_fields[PETSC_MAX_PATH_LEN]; PetscInt num_staging_fields = PETSC_MAX_PATH_LEN;
+  PetscOptionsGetStringArray(NULL, NULL, "--staging-fields", staging_fields, &num_staging_fields, &parameter_set);
+  if (parameter_set) {
+    for (PetscInt i = 0; i < num_staging_fields; i++) { mStagingFields.push_back(staging_fields[i]); }
+  }
+
+  /********************************************************************************
+                                 Adjoint simulations.
+  ********************************************************************************/
+  /* A gradient: the adjoint of each shot, with the forward wavefield reconstructed from checkpoints (see
+   * Simulation::runAdjoint and Checkpoints). */
+  PetscOptionsGetString(NULL, NULL, "--adjoint-shot-file", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mAdjointShotFile = parameter_set ? std::string(char_buffer) : "";
+
+  /* Or a gradient whose adjoint sources are computed in process, from the misfit of the synthetics at the
+   * receivers against observed data (see Simulation::runGradient and Misfit). */
+  PetscOptionsGetString(NULL, NULL, "--observed-data-file", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mObservedDataFile = parameter_set ? std::string(char_buffer) : "";
+
+  PetscOptionsGetString(NULL, NULL, "--misfit", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mMisfit = parameter_set ? std::string(char_buffer) : "l2";
+  if (mMisfit != "l2" && mMisfit != "cc" && mMisfit != "tf-phase") {
+    throw std::runtime_error("--misfit must be one of [ l2, cc, tf-phase ].");
+  }
+
+  PetscOptionsGetReal(NULL, NULL, "--misfit-max-frequency", &mMisfitMaxFrequency, &parameter_set);
+  if (!parameter_set) { mMisfitMaxFrequency = mMaxFrequency; }
+  if (mMisfitMaxFrequency < 0) { throw std::runtime_error("--misfit-max-frequency must not be negative."); }
+
+  PetscOptionsGetReal(NULL, NULL, "--misfit-max-shift", &mMisfitMaxShift, &parameter_set);
+  if (!parameter_set) { mMisfitMaxShift = 0; }
+  if (mMisfitMaxShift < 0) { throw std::runtime_error("--misfit-max-shift must not be negative."); }
+  if (!mObservedDataFile.empty() && !mAdjointShotFile.empty()) {
+    throw std::runtime_error("--observed-data-file computes the adjoint sources of --adjoint-shot-file. Give one.");
+  }
+
+  /* The kernels are integrated without the radial weight of the axisymmetric elements. */
+  if (mAxisymmetric && (!mObservedDataFile.empty() || !mAdjointShotFile.empty())) {
+    throw std::runtime_error("--axisymmetric can not be combined with --adjoint-shot-file or --observed-data-file.");
+  }
+
+  PetscOptionsGetReal(NULL, NULL, "--checkpoint-memory", &mCheckpointMemory, &parameter_set);
+  if (!parameter_set) { mCheckpointMemory = 1024; }
+  if (mCheckpointMemory < 0) { throw std::runtime_error("--checkpoint-memory must not be negative."); }
+
+  PetscOptionsGetInt(NULL, NULL, "--checkpoint-disk-slots", &mCheckpointDiskSlots, &parameter_set);
+  if (!parameter_set) { mCheckpointDiskSlots = 0; }
+  if (mCheckpointDiskSlots < 0) { throw std::runtime_error("--checkpoint-disk-slots must not be negative."); }
+
+  PetscOptionsGetString(NULL, NULL, "--checkpoint-dir", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mCheckpointDir = parameter_set ? std::string(char_buffer) : ".";
+
+  PetscOptionsGetReal(NULL, NULL, "--checkpoint-tolerance", &mCheckpointTolerance, &parameter_set);
+  if (!parameter_set) { mCheckpointTolerance = 0; }
+  if (mCheckpointTolerance < 0 || mCheckpointTolerance > 1) {
+    throw std::runtime_error("--checkpoint-tolerance must lie in [0, 1].");
+  }
+
+  PetscOptionsGetString(NULL, NULL, "--kernel-file", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mKernelFile = parameter_set ? std::string(char_buffer) : "";
+
+  /* Kernels at the integration points are accumulated every few adjoint steps, and may be written at the
+   * vertices of the model, too. */
+  PetscOptionsGetInt(NULL, NULL, "--kernel-every", &mKernelEvery, &parameter_set);
+  if (!parameter_set) { mKernelEvery = 1; }
+  if (mKernelEvery < 1) { throw std::runtime_error("--kernel-every must be positive."); }
+
+  PetscOptionsGetString(NULL, NULL, "--kernel-vertex-file", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mKernelVertexFile = parameter_set ? std::string(char_buffer) : "";
+
+  /* Or reconstructed backwards in time from its values on the absorbing boundaries (see BoundaryWavefield). */
+  PetscOptionsGetString(NULL, NULL, "--adjoint-reconstruction", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mAdjointReconstruction = parameter_set ? std::string(char_buffer) : "checkpoints";
+  if (mAdjointReconstruction != "checkpoints" && mAdjointReconstruction != "boundary") {
+    throw std::runtime_error("--adjoint-reconstruction must be one of [ checkpoints, boundary ].");
+  }
+
+  /********************************************************************************
+                                    Restarts.
+  ********************************************************************************/
+  /* The state of a run every few steps, from which a later job resumes it (see Restart). */
+  PetscOptionsGetInt(NULL, NULL, "--restart-every", &mRestartEvery, &parameter_set);
+  if (!parameter_set) { mRestartEvery = 0; }
+  if (mRestartEvery < 0) { throw std::runtime_error("--restart-every must not be negative."); }
+
+  PetscOptionsGetString(NULL, NULL, "--restart-file", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mRestartFile = parameter_set ? std::string(char_buffer) : "restart.h5";
+
+  PetscOptionsGetString(NULL, NULL, "--restart-from", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mRestartFrom = parameter_set ? std::string(char_buffer) : "";
+
   /********************************************************************************
                                     Sources.
   ********************************************************************************/
@@ -176,6 +986,16 @@ void Options::setOptions() {
       status = H5LTget_attribute_int(file, mSourceNames.at(i).c_str(), "num-components", &int_buffer);
       if ( status < 0 ) throw std::runtime_error("Can't read attribute 'num-components' of source '" + mSourceNames.at(i) + "'.");
       mSrcNumComponents.push_back(int_buffer);
+
+      /* A moment tensor (Voigt order), if the source is one, drives its single component into the gradient of a
+       * delta function. */
+      Eigen::VectorXd moment_tensor;
+      if (H5Aexists_by_name(file, mSourceNames.at(i).c_str(), "moment-tensor", H5P_DEFAULT) > 0) {
+        moment_tensor.setZero(mNumDim == 3 ? 6 : 3);
+        status = H5LTget_attribute_double(file, mSourceNames.at(i).c_str(), "moment-tensor", moment_tensor.data());
+        if ( status < 0 ) throw std::runtime_error("Can't read attribute 'moment-tensor' of source '" + mSourceNames.at(i) + "'.");
+      }
+      mSrcMomentTensor.push_back(moment_tensor);
       if (mSourceType == "ricker") {
         double double_buffer;
         int int_buffer;
@@ -240,6 +1060,21 @@ void Options::setOptions() {
       PetscOptionsGetIntArray(NULL, NULL, "--source-num-components", mSrcNumComponents.data(), &n_par, NULL);
       if (n_par != mNumSrc) { throw std::runtime_error(err + "--source-num-components"); }
 
+      /* Moment tensors of all sources, one after the other (Mxx, Myy, Mzz, Myz, Mxz, Mxy in 3D, and Mxx, Myy,
+       * Mxy in 2D). Without them, sources are point forces. */
+      const PetscInt num_voigt = mNumDim == 3 ? 6 : 3;
+      std::vector<PetscReal> moment_tensor(mNumSrc * num_voigt);
+      n_par = moment_tensor.size();
+      PetscOptionsGetScalarArray(NULL, NULL, "--source-moment-tensor", moment_tensor.data(), &n_par, &parameter_set);
+      mSrcMomentTensor.assign(mNumSrc, Eigen::VectorXd());
+      if (parameter_set) {
+        if (n_par != mNumSrc * num_voigt) { throw std::runtime_error(err + "--source-moment-tensor"); }
+        for (PetscInt i = 0; i < mNumSrc; i++) {
+          mSrcMomentTensor[i] = Eigen::Map<Eigen::VectorXd>(moment_tensor.data() + i * num_voigt, num_voigt);
+        }
+      }
+      n_par = mNumSrc;
+
       if (mSourceType == "ricker") {
         n_par = mNumSrc;
         mSrcRickerTimeDelay.resize(mNumSrc);
@@ -279,6 +1114,75 @@ void Options::setOptions() {
     }
   }
 
+  /* The time function of a moment tensor source is a scalar. */
+  for (PetscInt i = 0; i < mSrcMomentTensor.size(); i++) {
+    if (mSrcMomentTensor[i].size() && mSrcNumComponents[i] != 1) {
+      throw std::runtime_error("A moment tensor source must have a single component (source " +
+                               std::to_string(i) + ").");
+    }
+  }
+
+  /* Shot of each source, with --simultaneous-shots. By default, source i belongs to shot i (modulo the
+   * number of shots). The sources of an ensemble drive all members, and are left at shot 0. */
+  mSrcShot.assign(mNumSrc, 0);
+  for (PetscInt i = 0; i < mNumSrc && mEnsembleModelFiles.empty(); i++) { mSrcShot[i] = i % mNumSimultaneousShots; }
+  if (mNumSrc > 0 && mEnsembleModelFiles.empty()) {
+    PetscInt n_par = mNumSrc;
+    PetscOptionsGetIntArray(NULL, NULL, "--source-shot", mSrcShot.data(), &n_par, &parameter_set);
+    if (parameter_set && n_par != mNumSrc) {
+      throw std::runtime_error("Incorrect number of source parameters: --source-shot");
+    }
+    for (auto shot: mSrcShot) {
+      if (shot < 0 || shot >= mNumSimultaneousShots) {
+        throw std::runtime_error("--source-shot must lie between 0 and --simultaneous-shots - 1.");
+      }
+    }
+  }
+
+  /* The sources of a shot may fire with a random polarity and/or time shift each (source encoding), so that one
+   * simulation stands in for many shots. Observed data encoded the same way (see the receiver file) then gives
+   * the misfit of this super shot. The draws only depend on the seed, so all ranks agree on them. */
+  char *encoding[2]; PetscInt num_encoding = 2;
+  PetscOptionsGetStringArray(NULL, NULL, "--source-encoding", encoding, &num_encoding, &parameter_set);
+  mSourceEncoding.clear(); mSrcPolarity.clear(); mSrcTimeShift.clear();
+  if (parameter_set) {
+    for (PetscInt i = 0; i < num_encoding; i++) { mSourceEncoding.push_back(encoding[i]); }
+  }
+  if (!mSourceEncoding.empty()) {
+    auto encoded = [&](const std::string &kind) {
+      return std::find(mSourceEncoding.begin(), mSourceEncoding.end(), kind) != mSourceEncoding.end();
+    };
+    for (auto &kind: mSourceEncoding) {
+      if (kind != "polarity" && kind != "shift") {
+        throw std::runtime_error("--source-encoding takes polarity and/or shift, not '" + kind + "'.");
+      }
+    }
+    if (!mNumSrc) { throw std::runtime_error("--source-encoding needs sources."); }
+    PetscReal max_shift = 0;
+    PetscOptionsGetReal(NULL, NULL, "--encoding-max-shift", &max_shift, &parameter_set);
+    if (encoded("shift") && !(max_shift > 0)) {
+      throw std::runtime_error("--source-encoding shift needs a positive --encoding-max-shift.");
+    }
+    PetscOptionsGetInt(NULL, NULL, "--encoding-seed", &int_buffer, &parameter_set);
+    std::mt19937 generator(parameter_set ? int_buffer : 0);
+    std::uniform_real_distribution<PetscReal> shift(0, max_shift);
+    std::bernoulli_distribution flip(0.5);
+    for (PetscInt i = 0; i < mNumSrc; i++) {
+      mSrcPolarity.push_back(encoded("polarity") && flip(generator) ? -1 : 1);
+      mSrcTimeShift.push_back(encoded("shift") ? shift(generator) : 0);
+    }
+  }
+
+  /* Source time functions are held (and read from the source file) this many time steps at a time, or for the
+   * whole run if 0. */
+  PetscOptionsGetInt(NULL, NULL, "--source-window", &int_buffer, &parameter_set);
+  if (parameter_set) {
+    if (int_buffer < 0) throw std::runtime_error("--source-window must not be negative.");
+    mSourceWindow = int_buffer;
+  } else {
+    mSourceWindow = 0;
+  }
+
   /********************************************************************************
                                     Receivers.
   ********************************************************************************/
@@ -289,9 +1193,24 @@ void Options::setOptions() {
     mNumRec = 0;
   }
 
-  if (mNumRec > 0) {
+  /* Many receivers are better given as a catalogue (CSV, one "name, x, y[, z]" line per receiver, and '#' for
+   * comments), read by rank 0 and broadcast, than on the command line. The rows of the output follow its order. */
+  PetscBool catalogue_given;
+  PetscOptionsGetString(NULL, NULL, "--receiver-catalogue", char_buffer, PETSC_MAX_PATH_LEN, &catalogue_given);
+  if (catalogue_given) {
+    std::string catalogue(char_buffer), contents;
+    if (!utilities::readFileToAll(catalogue, contents)) {
+      throw std::runtime_error("Can't read receiver catalogue '" + catalogue + "'.");
+    }
+    const PetscInt num_given = mNumRec;
+    readReceiverCatalogue(contents, catalogue);
+    if (num_given && num_given != mNumRec) {
+      throw std::runtime_error("--number-of-receivers does not match the " + std::to_string(mNumRec) +
+                               " receivers of '" + catalogue + "'.");
+    }
+  }
 
-    mRecLocX.resize(mNumRec); mRecLocY.resize(mNumRec);
+  if (mNumRec > 0) {
 
     PetscOptionsGetString(NULL, NULL, "--receiver-file-name", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
     if (parameter_set) {
@@ -300,6 +1219,11 @@ void Options::setOptions() {
       if (! testing)
         throw std::runtime_error("Receivers were requested, but no output file was specfied.");
     }
+  }
+
+  if (mNumRec > 0 && !catalogue_given) {
+
+    mRecLocX.resize(mNumRec); mRecLocY.resize(mNumRec);
 
     char *names[PETSC_MAX_PATH_LEN];
     PetscInt n_par = mNumRec; std::string err = "Incorrect number of reciever parameters: ";
@@ -316,4 +1240,314 @@ void Options::setOptions() {
       if (n_par != mNumRec) { throw std::runtime_error(err + "--receiver-location-z"); }
     }
   }
+
+  /* Receivers may keep only every so many samples (one factor for all, or one per receiver), low-pass
+   * filtered on the fly against aliasing (see Receiver::record). */
+  mRecDecimation.assign(mNumRec, 1);
+  if (mNumRec > 0) {
+    std::vector<PetscInt> decimation(mNumRec);
+    PetscInt n_par = mNumRec;
+    PetscOptionsGetIntArray(NULL, NULL, "--receiver-decimation", decimation.data(), &n_par, &parameter_set);
+    if (parameter_set) {
+      if (n_par != 1 && n_par != mNumRec) {
+        throw std::runtime_error("Incorrect number of reciever parameters: --receiver-decimation");
+      }
+      for (PetscInt i = 0; i < mNumRec; i++) { mRecDecimation[i] = decimation[n_par == 1 ? 0 : i]; }
+      for (auto d: mRecDecimation) {
+        if (d < 1) throw std::runtime_error("--receiver-decimation must be positive.");
+      }
+    }
+  }
+
+  /* The samples needed of each receiver may end before the shot does (one end time for all, or one per
+   * receiver, be they given on the command line or in a catalogue). A forward shot then stops once the last
+   * window is complete (see StopTime). A gradient needs the synthetics, and the adjoint wavefield, over the
+   * whole shot. One more value than there are receivers is read, so that too many are not cut short. */
+  mRecWindowEnd.clear();
+  {
+    std::vector<PetscReal> end(mNumRec + 1);
+    PetscInt n_par = end.size();
+    PetscOptionsGetScalarArray(NULL, NULL, "--receiver-window-end", end.data(), &n_par, &parameter_set);
+    if (parameter_set) {
+      if (!mAdjointShotFile.empty() || !mObservedDataFile.empty()) {
+        throw std::runtime_error("--receiver-window-end can not be combined with --adjoint-shot-file or "
+                                 "--observed-data-file.");
+      }
+      if (mNumRec == 0) {
+        throw std::runtime_error("--receiver-window-end was given, but there are no receivers.");
+      }
+      if (n_par != 1 && n_par != mNumRec) {
+        throw std::runtime_error("Incorrect number of reciever parameters: --receiver-window-end");
+      }
+      for (PetscInt i = 0; i < mNumRec; i++) { mRecWindowEnd.push_back(end[n_par == 1 ? 0 : i]); }
+      for (auto t: mRecWindowEnd) {
+        if (t <= 0) throw std::runtime_error("--receiver-window-end must be positive.");
+      }
+    }
+  }
+
+  /* Receivers may record the strain, stress and rotation (i.e. for DAS fibres and rotational seismometers) from
+   * the gradient of the displacement in their element, at their location. */
+  char *quantities[3]; PetscInt num_quantities = 3;
+  PetscOptionsGetStringArray(NULL, NULL, "--receiver-quantities", quantities, &num_quantities, &parameter_set);
+  mReceiverStrain = mReceiverStress = mReceiverRotation = PETSC_FALSE;
+  for (PetscInt i = 0; parameter_set && i < num_quantities; i++) {
+    const std::string quantity(quantities[i]);
+    if (quantity == "strain") {
+      mReceiverStrain = PETSC_TRUE;
+    } else if (quantity == "stress") {
+      mReceiverStress = PETSC_TRUE;
+    } else if (quantity == "rotation") {
+      mReceiverRotation = PETSC_TRUE;
+    } else {
+      throw std::runtime_error("--receiver-quantities takes strain, stress and rotation, not '" + quantity + "'.");
+    }
+  }
+  if ((mReceiverStrain || mReceiverStress || mReceiverRotation) && mAxisymmetric) {
+    throw std::runtime_error("--receiver-quantities does not support --axisymmetric.");
+  }
+
+  /* Receiver samples are written every so many time steps (0 for once, at the end), and only that many
+   * are held in memory. */
+  PetscOptionsGetInt(NULL, NULL, "--receiver-write-every", &int_buffer, &parameter_set);
+  if (parameter_set) {
+    if (int_buffer < 0) throw std::runtime_error("--receiver-write-every must not be negative.");
+    mReceiverWriteEvery = int_buffer;
+  } else {
+    mReceiverWriteEvery = 0;
+  }
+
+  /* Receiver samples may be written from a background thread, which needs MPI to be initialized with
+   * MPI_THREAD_MULTIPLE (see Main.cpp). Otherwise, they are written synchronously. */
+  PetscOptionsGetBool(NULL, NULL, "--async-output", &mAsyncOutput, &parameter_set);
+  if (!parameter_set) {
+    mAsyncOutput = PETSC_FALSE;
+  }
+
+  /********************************************************************************
+                                      Shots.
+  ********************************************************************************/
+  /* Each file holds the source, receiver and duration options of one shot, which are run one after the other
+   * on the same mesh and elements. */
+  char *shots[PETSC_MAX_PATH_LEN]; PetscInt num_shot = PETSC_MAX_PATH_LEN;
+  PetscOptionsGetStringArray(NULL, NULL, "--shot-files", shots, &num_shot, &parameter_set);
+  if (parameter_set) {
+    for (PetscInt i = 0; i < num_shot; i++) { mShotFiles.push_back(shots[i]); }
+  }
+
+  /********************************************************************************
+                                   Reciprocity.
+  ********************************************************************************/
+  /* With many more sources than receivers, a shot per receiver and component gives the seismograms of all sources
+   * (see Simulation::runReciprocal). They share the reciprocal force, so they must share its time function. */
+  PetscOptionsGetBool(NULL, NULL, "--reciprocal", &mReciprocal, &parameter_set);
+  if (!parameter_set) { mReciprocal = PETSC_FALSE; }
+
+  /* The strain at many candidate source points (e.g. on a fault), from which the seismograms of any source among
+   * them are assembled later (see StrainDatabase). The points are a catalogue like --receiver-catalogue. */
+  PetscOptionsGetString(NULL, NULL, "--sgt-file", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  mSgtFile = parameter_set ? std::string(char_buffer) : "";
+  mSgtNames.clear(); mSgtLocX.clear(); mSgtLocY.clear(); mSgtLocZ.clear();
+  PetscOptionsGetString(NULL, NULL, "--sgt-points", char_buffer, PETSC_MAX_PATH_LEN, &parameter_set);
+  if (parameter_set) {
+    std::string catalogue(char_buffer), contents;
+    if (!utilities::readFileToAll(catalogue, contents)) {
+      throw std::runtime_error("Can't read point catalogue '" + catalogue + "'.");
+    }
+    readSgtCatalogue(contents, catalogue);
+  }
+  PetscOptionsGetInt(NULL, NULL, "--sgt-every", &mSgtEvery, &parameter_set);
+  if (!parameter_set) { mSgtEvery = 1; }
+  PetscOptionsGetReal(NULL, NULL, "--sgt-tolerance", &mSgtTolerance, &parameter_set);
+  if (!parameter_set) { mSgtTolerance = 0; }
+  if (!mSgtFile.empty() && (!mReciprocal || mSgtNames.empty())) {
+    throw std::runtime_error("--sgt-file needs --reciprocal, and points given by --sgt-points.");
+  }
+  if (mSgtEvery < 1) { throw std::runtime_error("--sgt-every must be at least 1."); }
+  if (mSgtTolerance < 0 || mSgtTolerance > 1) { throw std::runtime_error("--sgt-tolerance must lie in [0, 1]."); }
+
+  if (mReciprocal) {
+    if (!mNumRec || (!mNumSrc && mSgtFile.empty()) || (mNumSrc && mSourceType != "ricker")) {
+      throw std::runtime_error("--reciprocal needs receivers, and sources with a Ricker time function or "
+                               "--sgt-file.");
+    }
+    if (mNumSimultaneousShots > 1 || !mShotFiles.empty() || !mAdjointShotFile.empty() || !mKernelFile.empty() ||
+        mStaticProblem || !mInjectionBoundaries.empty() || mAxisymmetric || !mSourceEncoding.empty()) {
+      throw std::runtime_error("--reciprocal can not be combined with --simultaneous-shots, --shot-files, "
+                               "--adjoint-shot-file, --kernel-file, --static-problem, --injection-boundaries, "
+                               "--axisymmetric or --source-encoding.");
+    }
+    for (PetscInt i = 0; i < mNumSrc; i++) {
+      if (mSrcRickerCenterFreq[i] != mSrcRickerCenterFreq[0] || mSrcRickerTimeDelay[i] != mSrcRickerTimeDelay[0]) {
+        throw std::runtime_error("With --reciprocal, all sources must have the same --ricker-center-freq and "
+                                 "--ricker-time-delay.");
+      }
+      if (!mSrcMomentTensor[i].size() && mSrcNumComponents[i] != mNumDim) {
+        throw std::runtime_error("With --reciprocal, a source must be a moment tensor, or a force with one "
+                                 "component per dimension (source " + std::to_string(i) + ").");
+      }
+    }
+    for (auto d: mRecDecimation) {
+      if (d != 1) { throw std::runtime_error("--reciprocal does not decimate the receivers."); }
+    }
+
+    /* Without sources, the time function of the force is given. */
+    if (mNumSrc) {
+      mReciprocalCenterFreq = mSrcRickerCenterFreq[0]; mReciprocalTimeDelay = mSrcRickerTimeDelay[0];
+    } else {
+      PetscBool delay_set;
+      PetscOptionsGetReal(NULL, NULL, "--sgt-center-freq", &mReciprocalCenterFreq, &parameter_set);
+      PetscOptionsGetReal(NULL, NULL, "--sgt-time-delay", &mReciprocalTimeDelay, &delay_set);
+      if (!parameter_set || !delay_set || mReciprocalCenterFreq <= 0) {
+        throw std::runtime_error("--reciprocal without sources needs the (positive) --sgt-center-freq and the "
+                                 "--sgt-time-delay of the force.");
+      }
+    }
+  }
+
+  /********************************************************************************
+                                  Activity mask.
+  ********************************************************************************/
+  /* Elements whose fields are at rest are skipped, which is exact for a threshold of zero. */
+  PetscOptionsGetBool(NULL, NULL, "--activity-mask", &mActivityMask, &parameter_set);
+  if (!parameter_set) { mActivityMask = PETSC_FALSE; }
+  PetscOptionsGetReal(NULL, NULL, "--activity-threshold", &mActivityThreshold, &parameter_set);
+  if (!parameter_set) { mActivityThreshold = 0; }
+  PetscOptionsGetBool(NULL, NULL, "--activity-arrival", &mActivityArrival, &parameter_set);
+  if (!parameter_set) { mActivityArrival = PETSC_FALSE; }
+  if (mActivityThreshold < 0) { throw std::runtime_error("--activity-threshold must not be negative."); }
+  if (mActivityArrival && !mActivityMask) { throw std::runtime_error("--activity-arrival needs --activity-mask."); }
+  if (mActivityMask && mStaticProblem) {
+    throw std::runtime_error("--activity-mask can not be combined with --static-problem.");
+  }
+  /* The arrivals are those of the forward sources of a single shot, from the start of the run. */
+  if (mActivityArrival && (!mKernelFile.empty() || !mAdjointShotFile.empty() || !mShotFiles.empty() ||
+                           !mInjectionBoundaries.empty() || mReciprocal)) {
+    throw std::runtime_error("--activity-arrival can not be combined with --kernel-file, --adjoint-shot-file, "
+                             "--shot-files, --injection-boundaries or --reciprocal.");
+  }
+}
+
+/* Points of a catalogue, one "name, x, y[, z]" line each (see --receiver-catalogue). */
+static void readCatalogue(const std::string &contents, const std::string &kind, const std::string &name,
+                          const PetscInt num_dim, std::vector<std::string> &names, std::vector<PetscReal> &loc_x,
+                          std::vector<PetscReal> &loc_y, std::vector<PetscReal> &loc_z) {
+
+  names.clear(); loc_x.clear(); loc_y.clear(); loc_z.clear();
+  std::istringstream lines(contents);
+  std::string line;
+  for (PetscInt num_line = 1; std::getline(lines, line); num_line++) {
+    const size_t start = line.find_first_not_of(" \t\r");
+    if (start == std::string::npos || line[start] == '#') { continue; }
+
+    /* Comma separated, with the space around each entry dropped. */
+    std::vector<std::string> entries;
+    std::istringstream entry_stream(line);
+    std::string entry;
+    while (std::getline(entry_stream, entry, ',')) {
+      const size_t first = entry.find_first_not_of(" \t\r");
+      entries.push_back(first == std::string::npos ? "" :
+                        entry.substr(first, entry.find_last_not_of(" \t\r") - first + 1));
+    }
+
+    std::string err = "Line " + std::to_string(num_line) + " of " + kind + " catalogue '" + name + "' ";
+    if (entries.size() != num_dim + 1 || entries[0].empty()) {
+      throw std::runtime_error(err + "does not hold a name and " + std::to_string(num_dim) + " coordinates.");
+    }
+    PetscReal loc[3] = {0, 0, 0};
+    for (PetscInt d = 0; d < num_dim; d++) {
+      char *end; loc[d] = std::strtod(entries[d + 1].c_str(), &end);
+      if (entries[d + 1].empty() || *end != '\0') { throw std::runtime_error(err + "has a bad coordinate."); }
+    }
+    names.push_back(entries[0]);
+    loc_x.push_back(loc[0]); loc_y.push_back(loc[1]);
+    if (num_dim == 3) { loc_z.push_back(loc[2]); }
+  }
+
+}
+
+void Options::readReceiverCatalogue(const std::string &contents, const std::string &name) {
+  readCatalogue(contents, "receiver", name, mNumDim, mRecNames, mRecLocX, mRecLocY, mRecLocZ);
+  mNumRec = mRecNames.size();
+}
+
+void Options::readSgtCatalogue(const std::string &contents, const std::string &name) {
+  readCatalogue(contents, "point", name, mNumDim, mSgtNames, mSgtLocX, mSgtLocY, mSgtLocZ);
+}
+
+std::unique_ptr<Options> Options::ReciprocalShot(const PetscInt receiver, const PetscInt component) const {
+
+  std::unique_ptr<Options> shot(new Options(*this));
+  shot->mReciprocal = PETSC_FALSE;
+
+  /* The sources, and then the points of the database, as receivers of the strain. */
+  shot->mNumRec = mNumSrc + mSgtNames.size();
+  shot->mRecLocX = mSrcLocX; shot->mRecLocY = mSrcLocY; shot->mRecLocZ = mSrcLocZ;
+  shot->mRecNames.clear();
+  for (PetscInt i = 0; i < mNumSrc; i++) {
+    shot->mRecNames.push_back(i < mSourceNames.size() ? mSourceNames[i] : "source_" + std::to_string(i));
+  }
+  shot->mRecDecimation.assign(mNumSrc, 1);
+  shot->mRecWindowEnd.clear();
+  shot->mRecNames.insert(shot->mRecNames.end(), mSgtNames.begin(), mSgtNames.end());
+  shot->mRecLocX.insert(shot->mRecLocX.end(), mSgtLocX.begin(), mSgtLocX.end());
+  shot->mRecLocY.insert(shot->mRecLocY.end(), mSgtLocY.begin(), mSgtLocY.end());
+  shot->mRecLocZ.insert(shot->mRecLocZ.end(), mSgtLocZ.begin(), mSgtLocZ.end());
+  shot->mRecDecimation.resize(shot->mNumRec, mSgtEvery);
+  shot->mReceiverStrain = PETSC_TRUE; shot->mReceiverStress = shot->mReceiverRotation = PETSC_FALSE;
+  shot->mReceiverFileName = ""; shot->mReceiverWriteEvery = 0;
+
+  /* The receiver, as a unit force along the axis. */
+  Eigen::VectorXd direction = Eigen::VectorXd::Zero(mNumDim);
+  direction(component) = 1;
+  shot->mNumSrc = 1; shot->mSourceType = "ricker"; shot->mSourceFileName = "";
+  shot->mSourceNames = {mRecNames[receiver]};
+  shot->mSrcLocX = {mRecLocX[receiver]}; shot->mSrcLocY = {mRecLocY[receiver]};
+  shot->mSrcLocZ = mRecLocZ.empty() ? std::vector<PetscReal>() : std::vector<PetscReal>{mRecLocZ[receiver]};
+  shot->mSrcNumComponents = {mNumDim}; shot->mSrcShot = {0};
+  shot->mSrcRickerAmplitude = {1};
+  shot->mSrcRickerCenterFreq = {mReciprocalCenterFreq}; shot->mSrcRickerTimeDelay = {mReciprocalTimeDelay};
+  shot->mSrcRickerDirection = {direction}; shot->mSrcMomentTensor = {Eigen::VectorXd()};
+
+  /* Nothing but the receivers of a shot is kept, as each would overwrite the output of the one before. */
+  shot->mSaveMovie = PETSC_FALSE;
+  shot->mDftFrequencies.clear(); shot->mGridFile = ""; shot->mStagingStream = "";
+  shot->mRestartEvery = 0; shot->mRestartFrom = "";
+  return shot;
+
+}
+
+std::unique_ptr<Options> Options::AdjointShot(const PetscInt num_components) const {
+
+  std::unique_ptr<Options> shot(new Options(*this));
+  shot->mObservedDataFile = ""; shot->mAdjointShotFile = "";
+
+  /* A source at each receiver. */
+  shot->mNumSrc = mNumRec; shot->mSourceType = "adjoint"; shot->mSourceFileName = "";
+  shot->mSourceNames = mRecNames;
+  shot->mSrcLocX = mRecLocX; shot->mSrcLocY = mRecLocY; shot->mSrcLocZ = mRecLocZ;
+  shot->mSrcNumComponents.assign(mNumRec, num_components); shot->mSrcShot.assign(mNumRec, 0);
+  shot->mSrcPolarity.clear(); shot->mSrcTimeShift.clear(); shot->mSrcMomentTensor.clear();
+  shot->ClearReceivers();
+  shot->mReceiverFileName = ""; shot->mReceiverWriteEvery = 0;
+
+  /* Nothing is written by the adjoint shot but the kernels. */
+  shot->mSaveMovie = PETSC_FALSE;
+  shot->mDftFrequencies.clear(); shot->mGridFile = ""; shot->mStagingStream = "";
+  shot->mRestartEvery = 0; shot->mRestartFrom = "";
+  return shot;
+
+}
+
+void Options::SetTimeStep(const PetscReal dt) {
+
+  mTimeStep = dt;
+
+  // compute number of time steps and ensure that it is integer
+  // (i.e., adjust (decrease) mTimeStep if necessary)
+  if ( mDuration > 0) {
+    mNumTimeSteps = std::ceil(mDuration / mTimeStep);
+    mTimeStep = mDuration / (double)(mNumTimeSteps);
+  }
+
 }
@@ -0,0 +1,63 @@
+#include <Utilities/Pool.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+PetscInt Pool::mNumThreads = 1;
+
+Pool::Pool(const size_t size) {
+  /* Whole cache lines per object. */
+  mSize = (std::max<size_t>(size, 1) + Alignment - 1) / Alignment * Alignment;
+  mSlabObjects = std::max<size_t>(64, (1 << 20) / mSize);
+  mNumObjects = 0; mNext = mEnd = NULL;
+}
+
+Pool::~Pool() { release(); }
+
+void Pool::release() {
+  for (auto slab: mSlabs) { std::free(slab); }
+  mSlabs.clear(); mSlabSizes.clear(); mFree.clear();
+  mNext = mEnd = NULL;
+}
+
+size_t Pool::SlabBytes() const {
+  size_t num = 0;
+  for (auto n: mSlabSizes) { num += n; }
+  return num * mSize;
+}
+
+void Pool::addSlab(const size_t num) {
+
+  void *slab = NULL;
+  if (posix_memalign(&slab, Alignment, num * mSize)) { throw std::bad_alloc(); }
+  mSlabs.push_back(static_cast<char *>(slab)); mSlabSizes.push_back(num);
+  mNext = mSlabs.back(); mEnd = mNext + num * mSize;
+
+  /* First touch, one contiguous range of objects per thread (as the element loop splits them). */
+  char *base = mNext;
+  const PetscInt num_obj = num, size = mSize;
+  #pragma omp parallel for num_threads(mNumThreads) schedule(static)
+  for (PetscInt i = 0; i < num_obj; i++) { std::memset(base + i * size, 0, size); }
+
+}
+
+void Pool::reserve(const size_t num) {
+  if (static_cast<size_t>(mEnd - mNext) / mSize < num) { addSlab(std::max(num, mSlabObjects)); }
+}
+
+void *Pool::allocate() {
+
+  if (!mFree.empty()) { mNumObjects++; void *ptr = mFree.back(); mFree.pop_back(); return ptr; }
+  if (mNext == mEnd) { addSlab(mSlabObjects); }
+  void *ptr = mNext; mNext += mSize;
+  mNumObjects++;
+  return ptr;
+
+}
+
+void Pool::deallocate(void *ptr) {
+  if (!ptr) { return; }
+  mFree.push_back(ptr);
+  if (!--mNumObjects) { release(); }
+}
@@ -0,0 +1,202 @@
+#include <Utilities/Profiler.h>
+#include <Utilities/Logging.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <mpi.h>
+#include <stdexcept>
+
+bool Profiler::mRegistered = false;
+bool Profiler::mEnabled = false;
+bool Profiler::mCounting = false;
+bool Profiler::mTracing = false;
+std::array<PetscLogEvent, Profiler::NumPhases> Profiler::mEvents;
+std::array<PetscLogStage, Profiler::NumStages> Profiler::mStages;
+std::vector<std::array<double, Profiler::NumPhases>> Profiler::mSeconds;
+std::vector<std::array<PetscInt, Profiler::NumPhases>> Profiler::mCalls;
+std::vector<std::array<HardwareCounters::Values, Profiler::NumPhases>> Profiler::mCounts;
+std::vector<Profiler::Event> Profiler::mTrace;
+std::chrono::steady_clock::time_point Profiler::mTraceStart;
+std::string Profiler::mTraceFile;
+
+const char *Profiler::Name(const Phase phase) {
+  switch (phase) {
+    case MeshRead: return "MeshRead";
+    case Distribute: return "Distribute";
+    case Topology: return "Topology";
+    case ElementInit: return "ElementInit";
+    case MassMatrix: return "MassMatrix";
+    case Gather: return "Gather";
+    case SourceTerm: return "SourceTerm";
+    case StiffnessTerm: return "StiffnessTerm";
+    case SurfaceTerm: return "SurfaceTerm";
+    case Scatter: return "Scatter";
+    case HaloExchange: return "HaloExchange";
+    case InverseMass: return "InverseMass";
+    case TimeStep: return "TimeStep";
+    case Output: return "Output";
+    default: return "Unknown";
+  }
+}
+
+void Profiler::Register() {
+  if (mRegistered) { return; }
+  PetscClassId id;
+  PetscClassIdRegister("Salvus", &id);
+  for (PetscInt p = 0; p < NumPhases; p++) {
+    if (!PerElement(static_cast<Phase>(p))) { PetscLogEventRegister(Name(static_cast<Phase>(p)), id, &mEvents[p]); }
+  }
+  PetscLogStageRegister("Setup", &mStages[Setup]);
+  PetscLogStageRegister("Time loop", &mStages[TimeLoop]);
+  mRegistered = true;
+}
+
+void Profiler::Enable(const PetscInt num_threads) {
+  const size_t size = std::max<PetscInt>(num_threads, 1);
+  std::array<double, NumPhases> seconds; seconds.fill(0);
+  std::array<PetscInt, NumPhases> calls; calls.fill(0);
+  mSeconds.assign(size, seconds);
+  mCalls.assign(size, calls);
+  mEnabled = true;
+}
+
+bool Profiler::EnableCounters() {
+  if (!mEnabled) { throw std::runtime_error("Profiler::EnableCounters requires Profiler::Enable."); }
+  if (!HardwareCounters::open()) {
+    LOG() << "Warning: hardware counters are not available (see perf_event_paranoid). Only timing phases.";
+    return false;
+  }
+  if (!HardwareCounters::available(HardwareCounters::FpScalar)) {
+    LOG() << "Warning: floating point operations are not counted on this processor.";
+  }
+  HardwareCounters::Values zero; zero.fill(0);
+  std::array<HardwareCounters::Values, NumPhases> counts; counts.fill(zero);
+  mCounts.assign(mSeconds.size(), counts);
+  mCounting = true;
+  return true;
+}
+
+void Profiler::EnableTrace(const std::string &file) {
+  mTraceFile = file;
+  mTrace.clear();
+  /* Room for the events of a few thousand steps, so that the time loop rarely allocates. */
+  mTrace.reserve(1 << 16);
+  MPI_Barrier(PETSC_COMM_WORLD);
+  mTraceStart = std::chrono::steady_clock::now();
+  mTracing = true;
+}
+
+void Profiler::writeTrace() {
+
+  if (!mTracing) { return; }
+  mTracing = false;
+
+  /* Each rank formats its own events (one process of the trace per rank), and rank 0 writes them all. */
+  int rank, size;
+  MPI_Comm_rank(PETSC_COMM_WORLD, &rank); MPI_Comm_size(PETSC_COMM_WORLD, &size);
+  std::string text;
+  char line[160];
+  std::snprintf(line, sizeof(line), "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+                "\"args\":{\"name\":\"rank %d\"}}", rank, rank);
+  text += line;
+  for (auto &event: mTrace) {
+    std::snprintf(line, sizeof(line), ",\n{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+                  "\"pid\":%d,\"tid\":0}", event.name, event.start, event.duration, rank);
+    text += line;
+  }
+  std::vector<Event>().swap(mTrace);
+
+  int length = text.size();
+  std::vector<int> lengths(rank ? 0 : size), offsets(rank ? 0 : size);
+  MPI_Gather(&length, 1, MPI_INT, lengths.data(), 1, MPI_INT, 0, PETSC_COMM_WORLD);
+  std::string all;
+  if (!rank) {
+    for (int r = 1; r < size; r++) { offsets[r] = offsets[r - 1] + lengths[r - 1]; }
+    all.resize(offsets[size - 1] + lengths[size - 1]);
+  }
+  MPI_Gatherv(&text[0], length, MPI_CHAR, &all[0], lengths.data(), offsets.data(), MPI_CHAR, 0, PETSC_COMM_WORLD);
+  if (rank) { return; }
+
+  std::ofstream file(mTraceFile);
+  if (!file) { throw std::runtime_error("Could not open trace file " + mTraceFile + "."); }
+  file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+  for (int r = 0; r < size; r++) {
+    if (r) { file << ",\n"; }
+    file.write(&all[offsets[r]], lengths[r]);
+  }
+  file << "\n]}\n";
+  LOG() << "Wrote the trace of " << size << " rank(s) to " << mTraceFile << ".";
+
+}
+
+void Profiler::summary() {
+
+  if (!mEnabled) { return; }
+
+  /* On each rank, the slowest thread of a phase, and the calls of all threads. */
+  std::array<double, NumPhases> local, min, max, sum;
+  std::array<PetscInt, NumPhases> calls;
+  local.fill(0); calls.fill(0);
+  for (size_t t = 0; t < mSeconds.size(); t++) {
+    for (PetscInt p = 0; p < NumPhases; p++) {
+      local[p] = std::max(local[p], mSeconds[t][p]);
+      calls[p] += mCalls[t][p];
+    }
+  }
+  int size; MPI_Comm_size(PETSC_COMM_WORLD, &size);
+  MPI_Allreduce(local.data(), min.data(), NumPhases, MPI_DOUBLE, MPI_MIN, PETSC_COMM_WORLD);
+  MPI_Allreduce(local.data(), max.data(), NumPhases, MPI_DOUBLE, MPI_MAX, PETSC_COMM_WORLD);
+  MPI_Allreduce(local.data(), sum.data(), NumPhases, MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, calls.data(), NumPhases, MPIU_INT, MPI_MAX, PETSC_COMM_WORLD);
+
+  /* The imbalance (max / avg) of a phase shows the time ranks wait for each other in the next exchange. */
+  char line[128];
+  std::snprintf(line, sizeof(line), "%-14s %10s %12s %12s %12s %9s",
+                "Phase", "Calls", "Min (s)", "Max (s)", "Avg (s)", "Max/Avg");
+  LOG() << "Time per phase, over " << size << " rank(s) (calls: the most of any rank):\n" << line;
+  for (PetscInt p = 0; p < NumPhases; p++) {
+    if (!max[p]) { continue; }
+    const double avg = sum[p] / size;
+    std::snprintf(line, sizeof(line), "%-14s %10d %12.4e %12.4e %12.4e %9.2f",
+                  Name(static_cast<Phase>(p)), static_cast<int>(calls[p]), min[p], max[p], avg, max[p] / avg);
+    LOG() << line;
+  }
+  if (mCounting) { counterSummary(sum); }
+
+}
+
+void Profiler::counterSummary(const std::array<double, NumPhases> &seconds) {
+
+  /* Counts of all threads and ranks, against the seconds of all ranks: the rates are per rank. */
+  const PetscInt num = NumPhases * HardwareCounters::NumCounters;
+  std::vector<double> counts(num, 0);
+  for (size_t t = 0; t < mCounts.size(); t++) {
+    for (PetscInt p = 0; p < NumPhases; p++) {
+      for (PetscInt c = 0; c < HardwareCounters::NumCounters; c++) {
+        counts[p * HardwareCounters::NumCounters + c] += mCounts[t][p][c];
+      }
+    }
+  }
+  MPI_Allreduce(MPI_IN_PLACE, counts.data(), num, MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
+
+  char line[128];
+  std::snprintf(line, sizeof(line), "%-14s %10s %10s %12s %8s %9s",
+                "Phase", "GFLOP/s", "GB/s", "Flop/byte", "IPC", "Vector %");
+  LOG() << "Hardware counters per rank (bytes: " << HardwareCounters::LineBytes
+        << " per last level cache miss):\n" << line;
+  for (PetscInt p = 0; p < NumPhases; p++) {
+    if (!seconds[p]) { continue; }
+    HardwareCounters::Values v;
+    for (PetscInt c = 0; c < HardwareCounters::NumCounters; c++) {
+      v[c] = counts[p * HardwareCounters::NumCounters + c];
+    }
+    const double flops = HardwareCounters::Flops(v);
+    const double bytes = HardwareCounters::LineBytes * v[HardwareCounters::CacheMisses];
+    const double cycles = v[HardwareCounters::Cycles], ipc = cycles ? v[HardwareCounters::Instructions] / cycles : 0;
+    std::snprintf(line, sizeof(line), "%-14s %10.3f %10.3f %12.3f %8.2f %9.1f",
+                  Name(static_cast<Phase>(p)), 1e-9 * flops / seconds[p], 1e-9 * bytes / seconds[p],
+                  bytes ? flops / bytes : 0, ipc, 100 * HardwareCounters::VectorRatio(v));
+    LOG() << line;
+  }
+
+}
@@ -0,0 +1,4 @@
+#include <Utilities/Scratch.h>
+
+/* The calling (main) thread can always borrow buffers, e.g. during setup and in the tests. */
+std::vector<std::array<std::vector<PetscReal>, Scratch::NumSlots>> Scratch::mBuffers(1);
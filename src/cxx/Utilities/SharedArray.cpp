@@ -0,0 +1,73 @@
+#include <Utilities/SharedArray.h>
+#include <algorithm>
+#include <utility>
+
+template <typename T>
+void SharedArray<T>::assign(std::vector<T> values) {
+  clear();
+  mLocal = std::move(values);
+  mData = mLocal.data(); mSize = mLocal.size();
+}
+
+template <typename T>
+void SharedArray<T>::clear() {
+  if (mWin != MPI_WIN_NULL) {
+    int finalized; MPI_Finalized(&finalized);
+    if (!finalized) { MPI_Win_free(&mWin); }
+    mWin = MPI_WIN_NULL;
+  }
+  mWinBytes = 0;
+  std::vector<T>().swap(mLocal);
+  mData = NULL; mSize = 0;
+}
+
+template <typename T>
+void SharedArray<T>::broadcast(const int root, const bool node_shared) {
+
+  int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+  long size = rank == root ? mSize : 0;
+  MPI_Bcast(&size, 1, MPI_LONG, root, PETSC_COMM_WORLD);
+
+  /* Sent as whole elements, so that large arrays do not overflow the count. */
+  MPI_Datatype type;
+  MPI_Type_contiguous(sizeof(T), MPI_BYTE, &type); MPI_Type_commit(&type);
+
+  if (!node_shared) {
+    std::vector<T> values(size);
+    if (rank == root) { std::copy(begin(), end(), values.begin()); }
+    MPI_Bcast(values.data(), size, type, root, PETSC_COMM_WORLD);
+    MPI_Type_free(&type);
+    assign(std::move(values));
+    return;
+  }
+
+  /* Group the ranks by node, with root first on its own node. The first rank of each node allocates the
+   * node's copy, and these ranks broadcast the values among themselves. */
+  const int key = rank == root ? -1 : rank;
+  MPI_Comm node; MPI_Comm_split_type(PETSC_COMM_WORLD, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL, &node);
+  int node_rank; MPI_Comm_rank(node, &node_rank);
+  MPI_Comm leaders; MPI_Comm_split(PETSC_COMM_WORLD, node_rank ? MPI_UNDEFINED : 0, key, &leaders);
+
+  T *values; MPI_Win win;
+  MPI_Win_allocate_shared(node_rank ? 0 : size * sizeof(T), sizeof(T), MPI_INFO_NULL, node, &values, &win);
+  if (!node_rank) {
+    if (rank == root) { std::copy(begin(), end(), values); }
+    MPI_Bcast(values, size, type, 0, leaders);
+    MPI_Comm_free(&leaders);
+  }
+  MPI_Type_free(&type);
+
+  /* Wait for the copy of the node, and look at it. */
+  MPI_Win_fence(0, win);
+  MPI_Aint seg_size; int disp_unit;
+  MPI_Win_shared_query(win, 0, &seg_size, &disp_unit, &values);
+  MPI_Comm_free(&node);
+  clear();
+  mWin = win; mData = values; mSize = size;
+  mWinBytes = node_rank ? 0 : size * sizeof(T);
+
+}
+
+template class SharedArray<PetscReal>;
+template class SharedArray<PetscInt>;
+template class SharedArray<char>;
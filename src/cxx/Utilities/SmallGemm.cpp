@@ -0,0 +1,31 @@
+#include <Utilities/SmallGemm.h>
+#include <Eigen/Dense>
+
+bool SmallGemm::Available() {
+#ifdef SALVUS_LIBXSMM
+  return true;
+#else
+  return false;
+#endif
+}
+
+SmallGemm::SmallGemm(const int m, const int n, const int k): mM(m), mN(n), mK(k) {
+#ifdef SALVUS_LIBXSMM
+  /* Packed operands, and beta = 0 (LIBXSMM accumulates into C by default). */
+  const double alpha = 1, beta = 0;
+  mKernel = libxsmm_dmmdispatch(m, n, k, NULL, NULL, NULL, &alpha, &beta, NULL, NULL);
+#endif
+}
+
+bool SmallGemm::Generated() const {
+#ifdef SALVUS_LIBXSMM
+  return mKernel != NULL;
+#else
+  return false;
+#endif
+}
+
+void SmallGemm::fallback(const PetscReal *a, const PetscReal *b, PetscReal *c) const {
+  typedef Eigen::Matrix<PetscReal, Eigen::Dynamic, Eigen::Dynamic> Mat;
+  Eigen::Map<Mat>(c, mM, mN).noalias() = Eigen::Map<const Mat>(a, mM, mK) * Eigen::Map<const Mat>(b, mK, mN);
+}
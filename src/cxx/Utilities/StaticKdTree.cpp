@@ -0,0 +1,116 @@
+#include <Utilities/StaticKdTree.h>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+void StaticKdTree::build(const PetscInt dim, const PetscReal *pts, const PetscInt num_pts) {
+
+  mDim = dim;
+  std::vector<PetscInt> idx(num_pts); std::vector<char> axis(num_pts, 0);
+  for (PetscInt i = 0; i < num_pts; i++) { idx[i] = i; }
+  split(pts, 0, num_pts, idx, axis);
+
+  /* Store the points in tree order. */
+  std::vector<PetscReal> tree_pts(num_pts * mDim);
+  for (PetscInt i = 0; i < num_pts; i++) {
+    std::copy(pts + idx[i] * mDim, pts + (idx[i] + 1) * mDim, tree_pts.begin() + i * mDim);
+  }
+  mPts.assign(std::move(tree_pts)); mIdx.assign(std::move(idx)); mAxis.assign(std::move(axis));
+
+}
+
+void StaticKdTree::broadcast(const int root, const bool node_shared) {
+  MPI_Bcast(&mDim, 1, MPIU_INT, root, PETSC_COMM_WORLD);
+  mPts.broadcast(root, node_shared); mIdx.broadcast(root, node_shared); mAxis.broadcast(root, node_shared);
+}
+
+void StaticKdTree::split(const PetscReal *pts, const PetscInt lo, const PetscInt hi, std::vector<PetscInt> &idx,
+                         std::vector<char> &axis) const {
+
+  if (hi - lo < 2) { return; }
+
+  /* Split along the widest extent of the points in this range. */
+  PetscInt split_axis = 0; PetscReal widest = -1;
+  for (PetscInt d = 0; d < mDim; d++) {
+    PetscReal min = std::numeric_limits<PetscReal>::max(), max = -min;
+    for (PetscInt i = lo; i < hi; i++) {
+      min = std::min(min, pts[idx[i] * mDim + d]); max = std::max(max, pts[idx[i] * mDim + d]);
+    }
+    if (max - min > widest) { widest = max - min; split_axis = d; }
+  }
+
+  /* The median is the node. Smaller points go left, larger points right. */
+  const PetscInt mid = lo + (hi - lo) / 2;
+  std::nth_element(idx.begin() + lo, idx.begin() + mid, idx.begin() + hi, [&](PetscInt a, PetscInt b) {
+    return pts[a * mDim + split_axis] < pts[b * mDim + split_axis];
+  });
+  axis[mid] = split_axis;
+  split(pts, lo, mid, idx, axis); split(pts, mid + 1, hi, idx, axis);
+
+}
+
+void StaticKdTree::search(const PetscReal *pt, const PetscInt lo, const PetscInt hi,
+                          PetscInt &best, PetscReal &best_d2) const {
+
+  if (lo >= hi) { return; }
+  const PetscInt mid = lo + (hi - lo) / 2;
+  const PetscReal *node = mPts.data() + mid * mDim;
+  PetscReal d2 = 0;
+  for (PetscInt d = 0; d < mDim; d++) { d2 += (pt[d] - node[d]) * (pt[d] - node[d]); }
+  if (d2 < best_d2) { best_d2 = d2; best = mid; }
+
+  /* Descend into the half containing the point first, and only visit the other if it may be closer. */
+  const PetscReal diff = pt[mAxis[mid]] - node[mAxis[mid]];
+  if (diff < 0) {
+    search(pt, lo, mid, best, best_d2);
+    if (diff * diff < best_d2) { search(pt, mid + 1, hi, best, best_d2); }
+  } else {
+    search(pt, mid + 1, hi, best, best_d2);
+    if (diff * diff < best_d2) { search(pt, lo, mid, best, best_d2); }
+  }
+
+}
+
+PetscInt StaticKdTree::nearest(const PetscReal *pt) const {
+
+  if (empty()) { throw std::runtime_error("Nearest point requested from an empty kd-tree."); }
+  PetscInt best = 0; PetscReal best_d2 = std::numeric_limits<PetscReal>::max();
+  search(pt, 0, mIdx.size(), best, best_d2);
+  return mIdx[best];
+
+}
+
+void StaticKdTree::nearest(const PetscReal *pts, const PetscInt num_pts, PetscInt *idx) const {
+
+  if (empty()) { throw std::runtime_error("Nearest point requested from an empty kd-tree."); }
+#pragma omp parallel for schedule(static)
+  for (PetscInt i = 0; i < num_pts; i++) {
+    PetscInt best = 0; PetscReal best_d2 = std::numeric_limits<PetscReal>::max();
+    search(pts + i * mDim, 0, mIdx.size(), best, best_d2);
+    idx[i] = mIdx[best];
+  }
+
+}
+
+void StaticKdTree::collect(const PetscReal *pt, const PetscInt lo, const PetscInt hi, const PetscReal r2,
+                           std::vector<PetscInt> &idx) const {
+
+  if (lo >= hi) { return; }
+  const PetscInt mid = lo + (hi - lo) / 2;
+  const PetscReal *node = mPts.data() + mid * mDim;
+  PetscReal d2 = 0;
+  for (PetscInt d = 0; d < mDim; d++) { d2 += (pt[d] - node[d]) * (pt[d] - node[d]); }
+  if (d2 <= r2) { idx.push_back(mIdx[mid]); }
+
+  /* Only visit a half if the ball reaches across the split. */
+  const PetscReal diff = pt[mAxis[mid]] - node[mAxis[mid]];
+  if (diff <= 0 || diff * diff <= r2) { collect(pt, lo, mid, r2, idx); }
+  if (diff >= 0 || diff * diff <= r2) { collect(pt, mid + 1, hi, r2, idx); }
+
+}
+
+void StaticKdTree::within(const PetscReal *pt, const PetscReal radius, std::vector<PetscInt> &idx) const {
+  idx.clear();
+  collect(pt, 0, mIdx.size(), radius * radius, idx);
+}
@@ -1,5 +1,6 @@
 #include <mpi.h>
 #include <petsc.h>
+#include <fstream>
 #include <Utilities/Utilities.h>
 
 /* Template specifications for different MPI datatypes. */
@@ -94,6 +95,50 @@ std::string utilities::broadcastStringFromRank(std::string &buf, int rank) {
   return ret_string;
 
 }
+unsigned long long utilities::hashFile(const std::string &filename) {
+  std::ifstream f(filename.c_str(), std::ios::binary);
+  unsigned long long hash = 14695981039346656037ULL;
+  std::vector<char> buf(1 << 20);
+  while (f) {
+    f.read(buf.data(), buf.size());
+    for (std::streamsize i = 0; i < f.gcount(); i++) {
+      hash = (hash ^ static_cast<unsigned char>(buf[i])) * 1099511628211ULL;
+    }
+  }
+  return hash;
+}
+
+bool utilities::readFileToAll(const std::string &filename, std::string &contents) {
+  int rank; MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+  PetscInt ok = 0;
+  if (rank == 0) {
+    std::ifstream f(filename.c_str(), std::ios::binary);
+    if (f) {
+      std::ostringstream buf; buf << f.rdbuf();
+      contents = buf.str(); ok = 1;
+    }
+  }
+  if (!broadcastNumberFromRank(ok, 0)) { contents.clear(); return false; }
+  contents = broadcastStringFromRank(contents, 0);
+  return true;
+}
+
+bool utilities::pointInBox(const std::vector<double> &box, const double x, const double y, const double z) {
+  if (box.empty()) { return true; }
+  const size_t dim = box.size() / 2;
+  const double pnt[3] = {x, y, z};
+  for (size_t d = 0; d < dim; d++) {
+    if (pnt[d] < box[d] || pnt[d] > box[dim + d]) { return false; }
+  }
+  return true;
+}
+
+bool utilities::isConstant(const Eigen::Ref<const Eigen::ArrayXd> &values) {
+  if (values.size() < 2) { return true; }
+  const double tol = 1e-12;
+  return (values - values(0)).abs().maxCoeff() <= tol * values.abs().maxCoeff();
+}
+
 bool ::utilities::stringHasExtension(const std::string &str, const std::string &ext) {
   return str.size() >= ext.size() &&
       str.compare(str.size() - ext.size(), ext.size(), ext) == 0;
@@ -0,0 +1,77 @@
+#include <Utilities/WorkStealing.h>
+#include <algorithm>
+#include <numeric>
+
+void WorkStealing::plan(const PetscInt begin, const PetscInt end, const PetscInt size, const PetscInt num_threads,
+                        const std::vector<double> &cost) {
+
+  mNumThreads = std::max<PetscInt>(num_threads, 1);
+  mQueues.reset(new Range[mNumThreads]);
+  mBegin.clear(); mCost.clear();
+  for (PetscInt b = begin; b < end; b += size) {
+    mBegin.push_back(b);
+    const PetscInt e = std::min(b + size, end);
+    mCost.push_back(std::accumulate(cost.begin() + (b - begin), cost.begin() + (e - begin), 0.0));
+  }
+  mBegin.push_back(end);
+  mSeconds.assign(mCost.size(), 0);
+  mMeasured = false;
+  deal();
+
+}
+
+bool WorkStealing::take(const PetscInt queue, const bool front, PetscInt &chunk) {
+
+  std::atomic<unsigned long long> &range = mQueues[queue].range;
+  unsigned long long current = range.load();
+  while (true) {
+    const PetscInt head = current >> 32, tail = current & 0xffffffffULL;
+    if (head >= tail) { return false; }
+    const unsigned long long taken = front ? pack(head + 1, tail) : pack(head, tail - 1);
+    if (range.compare_exchange_weak(current, taken)) {
+      chunk = mOrder[front ? head : tail - 1];
+      return true;
+    }
+  }
+
+}
+
+bool WorkStealing::next(const PetscInt thread, PetscInt &chunk) {
+
+  /* The most expensive chunk of the thread's own queue. */
+  if (take(thread, true, chunk)) { return true; }
+
+  /* Otherwise the cheapest chunk of another queue, starting at the next thread (so that the thieves spread). */
+  for (PetscInt v = 1; v < mNumThreads; v++) {
+    if (take((thread + v) % mNumThreads, false, chunk)) { return true; }
+  }
+  return false;
+
+}
+
+void WorkStealing::deal() {
+
+  /* Most expensive first, dealt round robin: every queue is sorted, and they hold about the same cost. */
+  std::vector<PetscInt> sorted(mCost.size());
+  std::iota(sorted.begin(), sorted.end(), 0);
+  std::stable_sort(sorted.begin(), sorted.end(), [this](const PetscInt a, const PetscInt b) {
+    return mCost[a] > mCost[b];
+  });
+  mOrder.clear(); mQueueBegin.assign(1, 0);
+  for (PetscInt t = 0; t < mNumThreads; t++) {
+    for (size_t i = t; i < sorted.size(); i += mNumThreads) { mOrder.push_back(sorted[i]); }
+    mQueueBegin.push_back(mOrder.size());
+  }
+
+}
+
+void WorkStealing::measured() {
+
+  /* The estimate is replaced by the first timing, and later ones are averaged in. */
+  for (size_t c = 0; c < mCost.size(); c++) {
+    mCost[c] = mMeasured ? 0.5 * (mCost[c] + mSeconds[c]) : mSeconds[c];
+  }
+  mMeasured = true;
+  deal();
+
+}